@@ -0,0 +1,55 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BFLOAT16_HPP_
+#define _ONEMKL_BFLOAT16_HPP_
+
+#include <cstdint>
+#include <cstring>
+
+namespace onemkl {
+
+// bfloat16: seeeeeee'emmmmmmm, the upper 16 bits of an IEEE single precision value.
+
+struct bfloat16 {
+    std::uint16_t raw;
+
+    bfloat16() : raw(0) {}
+    bfloat16(float f) : raw(from_float(f)) {}
+
+    operator float() const {
+        std::uint32_t i = std::uint32_t(raw) << 16;
+        float f;
+        std::memcpy(&f, &i, sizeof(f));
+        return f;
+    }
+
+    // Rounds to nearest even, NaNs stay (quiet) NaNs.
+    static std::uint16_t from_float(float f) {
+        std::uint32_t i;
+        std::memcpy(&i, &f, sizeof(i));
+        if ((i & 0x7FFFFFFF) > 0x7F800000)
+            return std::uint16_t((i >> 16) | 0x0040);
+        return std::uint16_t((i + 0x7FFF + ((i >> 16) & 1)) >> 16);
+    }
+};
+
+} //namespace onemkl
+
+#endif //_ONEMKL_BFLOAT16_HPP_
@@ -23,6 +23,7 @@
 #include <CL/sycl.hpp>
 #include <complex>
 #include <cstdint>
+#include <utility>
 
 #include "onemkl/types.hpp"
 
@@ -35,6 +36,10 @@
 #include "onemkl/blas/detail/mklcpu/blas_ct.hpp"
 #include "onemkl/blas/detail/mklgpu/blas_ct.hpp"
 
+#include "onemkl/blas/detail/gemm_multi_queue.hpp"
+#include "onemkl/blas/detail/gemv_coalescer.hpp"
+#include "onemkl/blas/detail/level1_expression.hpp"
+
 namespace onemkl {
 namespace blas {
 
@@ -68,6 +73,165 @@ static inline void asum(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer
     asum_postcondition(queue, n, x, incx, result);
 }
 
+static inline void asum(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                        std::int64_t incx, cl::sycl::buffer<float, 1> &result, accumulation acc) {
+    asum_precondition(queue, n, x, incx, result, acc);
+    detail::asum(select_backend(queue), queue, n, x, incx, result, acc);
+    asum_postcondition(queue, n, x, incx, result, acc);
+}
+
+static inline cl::sycl::event asum(cl::sycl::queue &queue, std::int64_t n,
+                                   cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                   float *result) {
+    asum_precondition(queue, n, x, incx, result);
+    auto res = detail::asum(select_backend(queue), queue, n, x, incx, result);
+    asum_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+static inline cl::sycl::event asum(cl::sycl::queue &queue, std::int64_t n,
+                                   cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                                   double *result) {
+    asum_precondition(queue, n, x, incx, result);
+    auto res = detail::asum(select_backend(queue), queue, n, x, incx, result);
+    asum_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+static inline cl::sycl::event asum(cl::sycl::queue &queue, std::int64_t n,
+                                   cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                   float *result) {
+    asum_precondition(queue, n, x, incx, result);
+    auto res = detail::asum(select_backend(queue), queue, n, x, incx, result);
+    asum_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+static inline cl::sycl::event asum(cl::sycl::queue &queue, std::int64_t n,
+                                   cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                   double *result) {
+    asum_precondition(queue, n, x, incx, result);
+    auto res = detail::asum(select_backend(queue), queue, n, x, incx, result);
+    asum_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+static inline void axpby(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                         cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                         cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    axpby_precondition(queue, n, alpha, x, incx, beta, y, incy);
+    detail::axpby(select_backend(queue), queue, n, alpha, x, incx, beta, y, incy);
+    axpby_postcondition(queue, n, alpha, x, incx, beta, y, incy);
+}
+
+static inline void axpby(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                         cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                         cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+    axpby_precondition(queue, n, alpha, x, incx, beta, y, incy);
+    detail::axpby(select_backend(queue), queue, n, alpha, x, incx, beta, y, incy);
+    axpby_postcondition(queue, n, alpha, x, incx, beta, y, incy);
+}
+
+static inline void axpby(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                         std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
+                         std::int64_t incy) {
+    axpby_precondition(queue, n, alpha, x, incx, beta, y, incy);
+    detail::axpby(select_backend(queue), queue, n, alpha, x, incx, beta, y, incy);
+    axpby_postcondition(queue, n, alpha, x, incx, beta, y, incy);
+}
+
+static inline void axpby(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                         std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
+                         std::int64_t incy) {
+    axpby_precondition(queue, n, alpha, x, incx, beta, y, incy);
+    detail::axpby(select_backend(queue), queue, n, alpha, x, incx, beta, y, incy);
+    axpby_postcondition(queue, n, alpha, x, incx, beta, y, incy);
+}
+
+static inline void axpbypcz(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                            cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                            cl::sycl::buffer<float, 1> &y, std::int64_t incy, float gamma,
+                            cl::sycl::buffer<float, 1> &z, std::int64_t incz) {
+    axpbypcz_precondition(queue, n, alpha, x, incx, beta, y, incy, gamma, z, incz);
+    detail::axpbypcz(select_backend(queue), queue, n, alpha, x, incx, beta, y, incy, gamma, z,
+                     incz);
+    axpbypcz_postcondition(queue, n, alpha, x, incx, beta, y, incy, gamma, z, incz);
+}
+
+static inline void axpbypcz(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                            cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                            cl::sycl::buffer<double, 1> &y, std::int64_t incy, double gamma,
+                            cl::sycl::buffer<double, 1> &z, std::int64_t incz) {
+    axpbypcz_precondition(queue, n, alpha, x, incx, beta, y, incy, gamma, z, incz);
+    detail::axpbypcz(select_backend(queue), queue, n, alpha, x, incx, beta, y, incy, gamma, z,
+                     incz);
+    axpbypcz_postcondition(queue, n, alpha, x, incx, beta, y, incy, gamma, z, incz);
+}
+
+static inline void axpbypcz_dot(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                                cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                                cl::sycl::buffer<float, 1> &y, std::int64_t incy, float gamma,
+                                cl::sycl::buffer<float, 1> &z, std::int64_t incz,
+                                cl::sycl::buffer<float, 1> &w, std::int64_t incw,
+                                cl::sycl::buffer<float, 1> &result) {
+    axpbypcz_dot_precondition(queue, n, alpha, x, incx, beta, y, incy, gamma, z, incz, w, incw,
+                              result);
+    detail::axpbypcz_dot(select_backend(queue), queue, n, alpha, x, incx, beta, y, incy, gamma, z,
+                         incz, w, incw, result);
+    axpbypcz_dot_postcondition(queue, n, alpha, x, incx, beta, y, incy, gamma, z, incz, w, incw,
+                               result);
+}
+
+static inline void axpbypcz_dot(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                                cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                                cl::sycl::buffer<double, 1> &y, std::int64_t incy, double gamma,
+                                cl::sycl::buffer<double, 1> &z, std::int64_t incz,
+                                cl::sycl::buffer<double, 1> &w, std::int64_t incw,
+                                cl::sycl::buffer<double, 1> &result) {
+    axpbypcz_dot_precondition(queue, n, alpha, x, incx, beta, y, incy, gamma, z, incz, w, incw,
+                              result);
+    detail::axpbypcz_dot(select_backend(queue), queue, n, alpha, x, incx, beta, y, incy, gamma, z,
+                         incz, w, incw, result);
+    axpbypcz_dot_postcondition(queue, n, alpha, x, incx, beta, y, incy, gamma, z, incz, w, incw,
+                               result);
+}
+
+// Evaluates y := e for a linear combination of vectors, such as
+// assign(queue, n, strided(y), a * strided(x) + b * strided(y) + c * strided(z)), with
+// one fused axpbypcz per pass over the vectors.
+template <typename T>
+static inline void assign(cl::sycl::queue &queue, std::int64_t n, strided_vector<T> y,
+                          const linear_combination<T> &e) {
+    detail::evaluate_linear_combination(
+        n, y, e,
+        [&](T alpha, strided_vector<T> &x, T beta, strided_vector<T> &out, T gamma,
+            strided_vector<T> &z, bool last) {
+            axpbypcz(queue, n, alpha, x.buffer, x.inc, beta, out.buffer, out.inc, gamma, z.buffer,
+                     z.inc);
+        });
+}
+
+// Evaluates y := e followed by result := y^T w, the dot product being fused
+// into the last pass over y.
+template <typename T>
+static inline void assign_dot(cl::sycl::queue &queue, std::int64_t n, strided_vector<T> y,
+                              const linear_combination<T> &e, strided_vector<T> w,
+                              cl::sycl::buffer<T, 1> &result) {
+    detail::evaluate_linear_combination(
+        n, y, e,
+        [&](T alpha, strided_vector<T> &x, T beta, strided_vector<T> &out, T gamma,
+            strided_vector<T> &z, bool last) {
+            if (last)
+                axpbypcz_dot(queue, n, alpha, x.buffer, x.inc, beta, out.buffer, out.inc, gamma,
+                             z.buffer, z.inc, w.buffer, w.inc, result);
+            else
+                axpbypcz(queue, n, alpha, x.buffer, x.inc, beta, out.buffer, out.inc, gamma,
+                         z.buffer, z.inc);
+        });
+}
+
 static inline void axpy(cl::sycl::queue &queue, std::int64_t n, float alpha,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
@@ -100,6 +264,156 @@ static inline void axpy(cl::sycl::queue &queue, std::int64_t n, std::complex<dou
     axpy_postcondition(queue, n, alpha, x, incx, y, incy);
 }
 
+static inline void axpy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<float, 1> &y,
+                              cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, y, incy, group_count, group_size);
+    detail::axpy_batch(select_backend(queue), queue, n, alpha, x, incx, y, incy, group_count,
+                       group_size);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, y, incy, group_count, group_size);
+}
+
+static inline void axpy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<double, 1> &y,
+                              cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, y, incy, group_count, group_size);
+    detail::axpy_batch(select_backend(queue), queue, n, alpha, x, incx, y, incy, group_count,
+                       group_size);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, y, incy, group_count, group_size);
+}
+
+static inline void axpy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<std::complex<float>, 1> &y,
+                              cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, y, incy, group_count, group_size);
+    detail::axpy_batch(select_backend(queue), queue, n, alpha, x, incx, y, incy, group_count,
+                       group_size);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, y, incy, group_count, group_size);
+}
+
+static inline void axpy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<std::complex<double>, 1> &y,
+                              cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, y, incy, group_count, group_size);
+    detail::axpy_batch(select_backend(queue), queue, n, alpha, x, incx, y, incy, group_count,
+                       group_size);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, y, incy, group_count, group_size);
+}
+
+static inline void axpy_batch(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                              cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, cl::sycl::buffer<float, 1> &y,
+                              std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, stride_x, y, incy, stride_y, batch_size);
+    detail::axpy_batch(select_backend(queue), queue, n, alpha, x, incx, stride_x, y, incy, stride_y,
+                       batch_size);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, stride_x, y, incy, stride_y, batch_size);
+}
+
+static inline void axpy_batch(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                              cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, cl::sycl::buffer<double, 1> &y,
+                              std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, stride_x, y, incy, stride_y, batch_size);
+    detail::axpy_batch(select_backend(queue), queue, n, alpha, x, incx, stride_x, y, incy, stride_y,
+                       batch_size);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, stride_x, y, incy, stride_y, batch_size);
+}
+
+static inline void axpy_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, cl::sycl::buffer<std::complex<float>, 1> &y,
+                              std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, stride_x, y, incy, stride_y, batch_size);
+    detail::axpy_batch(select_backend(queue), queue, n, alpha, x, incx, stride_x, y, incy, stride_y,
+                       batch_size);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, stride_x, y, incy, stride_y, batch_size);
+}
+
+static inline void axpy_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, cl::sycl::buffer<std::complex<double>, 1> &y,
+                              std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, stride_x, y, incy, stride_y, batch_size);
+    detail::axpy_batch(select_backend(queue), queue, n, alpha, x, incx, stride_x, y, incy, stride_y,
+                       batch_size);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, stride_x, y, incy, stride_y, batch_size);
+}
+
+static inline void convert(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<half, 1> &x,
+                           cl::sycl::buffer<float, 1> &y) {
+    convert_precondition(queue, n, x, y);
+    detail::convert(select_backend(queue), queue, n, x, y);
+    convert_postcondition(queue, n, x, y);
+}
+
+static inline void convert(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                           cl::sycl::buffer<half, 1> &y) {
+    convert_precondition(queue, n, x, y);
+    detail::convert(select_backend(queue), queue, n, x, y);
+    convert_postcondition(queue, n, x, y);
+}
+
+static inline void convert(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<bfloat16, 1> &x,
+                           cl::sycl::buffer<float, 1> &y) {
+    convert_precondition(queue, n, x, y);
+    detail::convert(select_backend(queue), queue, n, x, y);
+    convert_postcondition(queue, n, x, y);
+}
+
+static inline void convert(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                           cl::sycl::buffer<bfloat16, 1> &y) {
+    convert_precondition(queue, n, x, y);
+    detail::convert(select_backend(queue), queue, n, x, y);
+    convert_postcondition(queue, n, x, y);
+}
+
+static inline void convert(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<float, 1> &b, std::int64_t ldb) {
+    convert_precondition(queue, m, n, a, lda, b, ldb);
+    detail::convert(select_backend(queue), queue, m, n, a, lda, b, ldb);
+    convert_postcondition(queue, m, n, a, lda, b, ldb);
+}
+
+static inline void convert(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<half, 1> &b, std::int64_t ldb) {
+    convert_precondition(queue, m, n, a, lda, b, ldb);
+    detail::convert(select_backend(queue), queue, m, n, a, lda, b, ldb);
+    convert_postcondition(queue, m, n, a, lda, b, ldb);
+}
+
+static inline void convert(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<float, 1> &b, std::int64_t ldb) {
+    convert_precondition(queue, m, n, a, lda, b, ldb);
+    detail::convert(select_backend(queue), queue, m, n, a, lda, b, ldb);
+    convert_postcondition(queue, m, n, a, lda, b, ldb);
+}
+
+static inline void convert(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<bfloat16, 1> &b, std::int64_t ldb) {
+    convert_precondition(queue, m, n, a, lda, b, ldb);
+    detail::convert(select_backend(queue), queue, m, n, a, lda, b, ldb);
+    convert_postcondition(queue, m, n, a, lda, b, ldb);
+}
+
 static inline void copy(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
                         std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
     copy_precondition(queue, n, x, incx, y, incy);
@@ -130,6 +444,215 @@ static inline void copy(cl::sycl::queue &queue, std::int64_t n,
     copy_postcondition(queue, n, x, incx, y, incy);
 }
 
+static inline void copy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<float, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<float, 1> &y,
+                              cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    copy_batch_precondition(queue, n, x, incx, y, incy, group_count, group_size);
+    detail::copy_batch(select_backend(queue), queue, n, x, incx, y, incy, group_count, group_size);
+    copy_batch_postcondition(queue, n, x, incx, y, incy, group_count, group_size);
+}
+
+static inline void copy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<double, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<double, 1> &y,
+                              cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    copy_batch_precondition(queue, n, x, incx, y, incy, group_count, group_size);
+    detail::copy_batch(select_backend(queue), queue, n, x, incx, y, incy, group_count, group_size);
+    copy_batch_postcondition(queue, n, x, incx, y, incy, group_count, group_size);
+}
+
+static inline void copy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::complex<float>, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<std::complex<float>, 1> &y,
+                              cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    copy_batch_precondition(queue, n, x, incx, y, incy, group_count, group_size);
+    detail::copy_batch(select_backend(queue), queue, n, x, incx, y, incy, group_count, group_size);
+    copy_batch_postcondition(queue, n, x, incx, y, incy, group_count, group_size);
+}
+
+static inline void copy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::complex<double>, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<std::complex<double>, 1> &y,
+                              cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    copy_batch_precondition(queue, n, x, incx, y, incy, group_count, group_size);
+    detail::copy_batch(select_backend(queue), queue, n, x, incx, y, incy, group_count, group_size);
+    copy_batch_postcondition(queue, n, x, incx, y, incy, group_count, group_size);
+}
+
+static inline void copy_batch(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                              std::int64_t incx, std::int64_t stride_x,
+                              cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                              std::int64_t stride_y, std::int64_t batch_size) {
+    copy_batch_precondition(queue, n, x, incx, stride_x, y, incy, stride_y, batch_size);
+    detail::copy_batch(select_backend(queue), queue, n, x, incx, stride_x, y, incy, stride_y,
+                       batch_size);
+    copy_batch_postcondition(queue, n, x, incx, stride_x, y, incy, stride_y, batch_size);
+}
+
+static inline void copy_batch(cl::sycl::queue &queue, std::int64_t n,
+                              cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, cl::sycl::buffer<double, 1> &y,
+                              std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    copy_batch_precondition(queue, n, x, incx, stride_x, y, incy, stride_y, batch_size);
+    detail::copy_batch(select_backend(queue), queue, n, x, incx, stride_x, y, incy, stride_y,
+                       batch_size);
+    copy_batch_postcondition(queue, n, x, incx, stride_x, y, incy, stride_y, batch_size);
+}
+
+static inline void copy_batch(cl::sycl::queue &queue, std::int64_t n,
+                              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, cl::sycl::buffer<std::complex<float>, 1> &y,
+                              std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    copy_batch_precondition(queue, n, x, incx, stride_x, y, incy, stride_y, batch_size);
+    detail::copy_batch(select_backend(queue), queue, n, x, incx, stride_x, y, incy, stride_y,
+                       batch_size);
+    copy_batch_postcondition(queue, n, x, incx, stride_x, y, incy, stride_y, batch_size);
+}
+
+static inline void copy_batch(cl::sycl::queue &queue, std::int64_t n,
+                              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, cl::sycl::buffer<std::complex<double>, 1> &y,
+                              std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    copy_batch_precondition(queue, n, x, incx, stride_x, y, incy, stride_y, batch_size);
+    detail::copy_batch(select_backend(queue), queue, n, x, incx, stride_x, y, incy, stride_y,
+                       batch_size);
+    copy_batch_postcondition(queue, n, x, incx, stride_x, y, incy, stride_y, batch_size);
+}
+
+static inline void dgmm_batch(cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                              cl::sycl::buffer<std::int64_t, 1> &m,
+                              cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<float, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<float, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                              std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    dgmm_batch_precondition(queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                            group_size);
+    detail::dgmm_batch(select_backend(queue), queue, left_right, m, n, a, lda, x, incx, c, ldc,
+                       group_count, group_size);
+    dgmm_batch_postcondition(queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                             group_size);
+}
+
+static inline void dgmm_batch(cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                              cl::sycl::buffer<std::int64_t, 1> &m,
+                              cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<double, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<double, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<double, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    dgmm_batch_precondition(queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                            group_size);
+    detail::dgmm_batch(select_backend(queue), queue, left_right, m, n, a, lda, x, incx, c, ldc,
+                       group_count, group_size);
+    dgmm_batch_postcondition(queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                             group_size);
+}
+
+static inline void dgmm_batch(cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                              cl::sycl::buffer<std::int64_t, 1> &m,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::complex<float>, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<std::complex<float>, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<std::complex<float>, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    dgmm_batch_precondition(queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                            group_size);
+    detail::dgmm_batch(select_backend(queue), queue, left_right, m, n, a, lda, x, incx, c, ldc,
+                       group_count, group_size);
+    dgmm_batch_postcondition(queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                             group_size);
+}
+
+static inline void dgmm_batch(cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                              cl::sycl::buffer<std::int64_t, 1> &m,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::complex<double>, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<std::complex<double>, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<std::complex<double>, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    dgmm_batch_precondition(queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                            group_size);
+    detail::dgmm_batch(select_backend(queue), queue, left_right, m, n, a, lda, x, incx, c, ldc,
+                       group_count, group_size);
+    dgmm_batch_postcondition(queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                             group_size);
+}
+
+static inline void dgmm_batch(cl::sycl::queue &queue, side left_right, std::int64_t m,
+                              std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, cl::sycl::buffer<float, 1> &x,
+                              std::int64_t incx, std::int64_t stride_x,
+                              cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size) {
+    dgmm_batch_precondition(queue, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                            stride_c, batch_size);
+    detail::dgmm_batch(select_backend(queue), queue, left_right, m, n, a, lda, stride_a, x, incx,
+                       stride_x, c, ldc, stride_c, batch_size);
+    dgmm_batch_postcondition(queue, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                             stride_c, batch_size);
+}
+
+static inline void dgmm_batch(cl::sycl::queue &queue, side left_right, std::int64_t m,
+                              std::int64_t n, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, cl::sycl::buffer<double, 1> &x,
+                              std::int64_t incx, std::int64_t stride_x,
+                              cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size) {
+    dgmm_batch_precondition(queue, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                            stride_c, batch_size);
+    detail::dgmm_batch(select_backend(queue), queue, left_right, m, n, a, lda, stride_a, x, incx,
+                       stride_x, c, ldc, stride_c, batch_size);
+    dgmm_batch_postcondition(queue, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                             stride_c, batch_size);
+}
+
+static inline void dgmm_batch(cl::sycl::queue &queue, side left_right, std::int64_t m,
+                              std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
+                              std::int64_t lda, std::int64_t stride_a,
+                              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, cl::sycl::buffer<std::complex<float>, 1> &c,
+                              std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    dgmm_batch_precondition(queue, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                            stride_c, batch_size);
+    detail::dgmm_batch(select_backend(queue), queue, left_right, m, n, a, lda, stride_a, x, incx,
+                       stride_x, c, ldc, stride_c, batch_size);
+    dgmm_batch_postcondition(queue, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                             stride_c, batch_size);
+}
+
+static inline void dgmm_batch(cl::sycl::queue &queue, side left_right, std::int64_t m,
+                              std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &a,
+                              std::int64_t lda, std::int64_t stride_a,
+                              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, cl::sycl::buffer<std::complex<double>, 1> &c,
+                              std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    dgmm_batch_precondition(queue, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                            stride_c, batch_size);
+    detail::dgmm_batch(select_backend(queue), queue, left_right, m, n, a, lda, stride_a, x, incx,
+                       stride_x, c, ldc, stride_c, batch_size);
+    dgmm_batch_postcondition(queue, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                             stride_c, batch_size);
+}
+
 static inline void dot(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
                        std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
                        cl::sycl::buffer<float, 1> &result) {
@@ -154,6 +677,89 @@ static inline void dot(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<
     dot_postcondition(queue, n, x, incx, y, incy, result);
 }
 
+static inline void dot(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                       std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                       cl::sycl::buffer<float, 1> &result, accumulation acc) {
+    dot_precondition(queue, n, x, incx, y, incy, result, acc);
+    detail::dot(select_backend(queue), queue, n, x, incx, y, incy, result, acc);
+    dot_postcondition(queue, n, x, incx, y, incy, result, acc);
+}
+
+static inline cl::sycl::event dot(cl::sycl::queue &queue, std::int64_t n,
+                                  cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                  cl::sycl::buffer<float, 1> &y, std::int64_t incy, float *result) {
+    dot_precondition(queue, n, x, incx, y, incy, result);
+    auto res = detail::dot(select_backend(queue), queue, n, x, incx, y, incy, result);
+    dot_postcondition(queue, n, x, incx, y, incy, result);
+    return res;
+}
+
+static inline cl::sycl::event dot(cl::sycl::queue &queue, std::int64_t n,
+                                  cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                  cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                                  double *result) {
+    dot_precondition(queue, n, x, incx, y, incy, result);
+    auto res = detail::dot(select_backend(queue), queue, n, x, incx, y, incy, result);
+    dot_postcondition(queue, n, x, incx, y, incy, result);
+    return res;
+}
+
+static inline cl::sycl::event dot(cl::sycl::queue &queue, std::int64_t n,
+                                  cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                  cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                                  double *result) {
+    dot_precondition(queue, n, x, incx, y, incy, result);
+    auto res = detail::dot(select_backend(queue), queue, n, x, incx, y, incy, result);
+    dot_postcondition(queue, n, x, incx, y, incy, result);
+    return res;
+}
+
+static inline void dot_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                             cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+                             cl::sycl::buffer<float, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+                             cl::sycl::buffer<float, 1> &result, std::int64_t group_count,
+                             cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    dot_batch_precondition(queue, n, x, incx, y, incy, result, group_count, group_size);
+    detail::dot_batch(select_backend(queue), queue, n, x, incx, y, incy, result, group_count,
+                      group_size);
+    dot_batch_postcondition(queue, n, x, incx, y, incy, result, group_count, group_size);
+}
+
+static inline void dot_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                             cl::sycl::buffer<double, 1> &x,
+                             cl::sycl::buffer<std::int64_t, 1> &incx,
+                             cl::sycl::buffer<double, 1> &y,
+                             cl::sycl::buffer<std::int64_t, 1> &incy,
+                             cl::sycl::buffer<double, 1> &result, std::int64_t group_count,
+                             cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    dot_batch_precondition(queue, n, x, incx, y, incy, result, group_count, group_size);
+    detail::dot_batch(select_backend(queue), queue, n, x, incx, y, incy, result, group_count,
+                      group_size);
+    dot_batch_postcondition(queue, n, x, incx, y, incy, result, group_count, group_size);
+}
+
+static inline void dot_batch(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                             std::int64_t incx, std::int64_t stride_x,
+                             cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                             std::int64_t stride_y, cl::sycl::buffer<float, 1> &result,
+                             std::int64_t batch_size) {
+    dot_batch_precondition(queue, n, x, incx, stride_x, y, incy, stride_y, result, batch_size);
+    detail::dot_batch(select_backend(queue), queue, n, x, incx, stride_x, y, incy, stride_y, result,
+                      batch_size);
+    dot_batch_postcondition(queue, n, x, incx, stride_x, y, incy, stride_y, result, batch_size);
+}
+
+static inline void dot_batch(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                             std::int64_t incx, std::int64_t stride_x,
+                             cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                             std::int64_t stride_y, cl::sycl::buffer<double, 1> &result,
+                             std::int64_t batch_size) {
+    dot_batch_precondition(queue, n, x, incx, stride_x, y, incy, stride_y, result, batch_size);
+    detail::dot_batch(select_backend(queue), queue, n, x, incx, stride_x, y, incy, stride_y, result,
+                      batch_size);
+    dot_batch_postcondition(queue, n, x, incx, stride_x, y, incy, stride_y, result, batch_size);
+}
+
 static inline void dotc(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
@@ -236,6 +842,92 @@ static inline void gbmv(cl::sycl::queue &queue, transpose trans, std::int64_t m,
     gbmv_postcondition(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
 }
 
+static inline void gbtge(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                         std::int64_t ku, cl::sycl::buffer<float, 1> &ab, std::int64_t ldab,
+                         cl::sycl::buffer<float, 1> &a, std::int64_t lda) {
+    gbtge_precondition(queue, m, n, kl, ku, ab, ldab, a, lda);
+    detail::gbtge(select_backend(queue), queue, m, n, kl, ku, ab, ldab, a, lda);
+    gbtge_postcondition(queue, m, n, kl, ku, ab, ldab, a, lda);
+}
+
+static inline void gbtge(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                         std::int64_t ku, cl::sycl::buffer<double, 1> &ab, std::int64_t ldab,
+                         cl::sycl::buffer<double, 1> &a, std::int64_t lda) {
+    gbtge_precondition(queue, m, n, kl, ku, ab, ldab, a, lda);
+    detail::gbtge(select_backend(queue), queue, m, n, kl, ku, ab, ldab, a, lda);
+    gbtge_postcondition(queue, m, n, kl, ku, ab, ldab, a, lda);
+}
+
+static inline void gbtge(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                         std::int64_t ku, cl::sycl::buffer<std::complex<float>, 1> &ab,
+                         std::int64_t ldab, cl::sycl::buffer<std::complex<float>, 1> &a,
+                         std::int64_t lda) {
+    gbtge_precondition(queue, m, n, kl, ku, ab, ldab, a, lda);
+    detail::gbtge(select_backend(queue), queue, m, n, kl, ku, ab, ldab, a, lda);
+    gbtge_postcondition(queue, m, n, kl, ku, ab, ldab, a, lda);
+}
+
+static inline void gbtge(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                         std::int64_t ku, cl::sycl::buffer<std::complex<double>, 1> &ab,
+                         std::int64_t ldab, cl::sycl::buffer<std::complex<double>, 1> &a,
+                         std::int64_t lda) {
+    gbtge_precondition(queue, m, n, kl, ku, ab, ldab, a, lda);
+    detail::gbtge(select_backend(queue), queue, m, n, kl, ku, ab, ldab, a, lda);
+    gbtge_postcondition(queue, m, n, kl, ku, ab, ldab, a, lda);
+}
+
+static inline void gbtge_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                               std::int64_t kl, std::int64_t ku, cl::sycl::buffer<float, 1> &ab,
+                               std::int64_t ldab, std::int64_t stride_ab,
+                               cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                               std::int64_t stride_a, std::int64_t batch_size) {
+    gbtge_batch_precondition(queue, m, n, kl, ku, ab, ldab, stride_ab, a, lda, stride_a,
+                             batch_size);
+    detail::gbtge_batch(select_backend(queue), queue, m, n, kl, ku, ab, ldab, stride_ab, a, lda,
+                        stride_a, batch_size);
+    gbtge_batch_postcondition(queue, m, n, kl, ku, ab, ldab, stride_ab, a, lda, stride_a,
+                              batch_size);
+}
+
+static inline void gbtge_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                               std::int64_t kl, std::int64_t ku, cl::sycl::buffer<double, 1> &ab,
+                               std::int64_t ldab, std::int64_t stride_ab,
+                               cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                               std::int64_t stride_a, std::int64_t batch_size) {
+    gbtge_batch_precondition(queue, m, n, kl, ku, ab, ldab, stride_ab, a, lda, stride_a,
+                             batch_size);
+    detail::gbtge_batch(select_backend(queue), queue, m, n, kl, ku, ab, ldab, stride_ab, a, lda,
+                        stride_a, batch_size);
+    gbtge_batch_postcondition(queue, m, n, kl, ku, ab, ldab, stride_ab, a, lda, stride_a,
+                              batch_size);
+}
+
+static inline void gbtge_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                               std::int64_t kl, std::int64_t ku,
+                               cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t ldab,
+                               std::int64_t stride_ab, cl::sycl::buffer<std::complex<float>, 1> &a,
+                               std::int64_t lda, std::int64_t stride_a, std::int64_t batch_size) {
+    gbtge_batch_precondition(queue, m, n, kl, ku, ab, ldab, stride_ab, a, lda, stride_a,
+                             batch_size);
+    detail::gbtge_batch(select_backend(queue), queue, m, n, kl, ku, ab, ldab, stride_ab, a, lda,
+                        stride_a, batch_size);
+    gbtge_batch_postcondition(queue, m, n, kl, ku, ab, ldab, stride_ab, a, lda, stride_a,
+                              batch_size);
+}
+
+static inline void gbtge_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                               std::int64_t kl, std::int64_t ku,
+                               cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t ldab,
+                               std::int64_t stride_ab, cl::sycl::buffer<std::complex<double>, 1> &a,
+                               std::int64_t lda, std::int64_t stride_a, std::int64_t batch_size) {
+    gbtge_batch_precondition(queue, m, n, kl, ku, ab, ldab, stride_ab, a, lda, stride_a,
+                             batch_size);
+    detail::gbtge_batch(select_backend(queue), queue, m, n, kl, ku, ab, ldab, stride_ab, a, lda,
+                        stride_a, batch_size);
+    gbtge_batch_postcondition(queue, m, n, kl, ku, ab, ldab, stride_ab, a, lda, stride_a,
+                              batch_size);
+}
+
 static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
                         std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
@@ -291,6 +983,606 @@ static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose tran
     gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
+// Splits one gemm into column panels of C and runs them on all the queues.
+template <typename T>
+static inline void gemm(std::vector<cl::sycl::queue> &queues, tile_schedule schedule,
+                        transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                        std::int64_t k, T alpha, cl::sycl::buffer<T, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<T, 1> &b, std::int64_t ldb, T beta,
+                        cl::sycl::buffer<T, 1> &c, std::int64_t ldc) {
+    detail::gemm_multi_queue(
+        queues, schedule, transb, m, n, k, b, ldb, c, ldc,
+        [&](cl::sycl::queue &queue, std::int64_t nc, cl::sycl::buffer<T, 1> &b_tile,
+            std::int64_t ldb_tile, cl::sycl::buffer<T, 1> &c_tile) {
+            gemm(queue, transa, transb, m, nc, k, alpha, a, lda, b_tile, ldb_tile, beta, c_tile,
+                 ldc);
+        });
+}
+
+static inline void gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb,
+                          std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                          cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                          cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                          std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+                          std::int64_t ldc) {
+    gemm3m_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    detail::gemm3m(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                   beta, c, ldc);
+    gemm3m_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+static inline void gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb,
+                          std::int64_t m, std::int64_t n, std::int64_t k,
+                          std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                          std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
+                          std::int64_t ldb, std::complex<double> beta,
+                          cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    gemm3m_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    detail::gemm3m(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                   beta, c, ldc);
+    gemm3m_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+static inline void gemm3m_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                std::int64_t m, std::int64_t n, std::int64_t k,
+                                std::complex<float> alpha,
+                                cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                                std::int64_t ldb, std::int64_t stride_b, std::complex<float> beta,
+                                cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                                std::int64_t stride_c, std::int64_t batch_size) {
+    gemm3m_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                              stride_b, beta, c, ldc, stride_c, batch_size);
+    detail::gemm3m_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                         stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+    gemm3m_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size);
+}
+
+static inline void gemm3m_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                std::int64_t m, std::int64_t n, std::int64_t k,
+                                std::complex<double> alpha,
+                                cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                                std::int64_t ldb, std::int64_t stride_b, std::complex<double> beta,
+                                cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                std::int64_t stride_c, std::int64_t batch_size) {
+    gemm3m_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                              stride_b, beta, c, ldc, stride_c, batch_size);
+    detail::gemm3m_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                         stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+    gemm3m_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size);
+}
+
+static inline void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                              cl::sycl::buffer<transpose, 1> &transb,
+                              cl::sycl::buffer<std::int64_t, 1> &m,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::int64_t, 1> &k,
+                              cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<float, 1> &b,
+                              cl::sycl::buffer<std::int64_t, 1> &ldb,
+                              cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            group_count, group_size);
+    detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                       beta, c, ldc, group_count, group_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             group_count, group_size);
+}
+
+static inline void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                              cl::sycl::buffer<transpose, 1> &transb,
+                              cl::sycl::buffer<std::int64_t, 1> &m,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::int64_t, 1> &k,
+                              cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<double, 1> &b,
+                              cl::sycl::buffer<std::int64_t, 1> &ldb,
+                              cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            group_count, group_size);
+    detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                       beta, c, ldc, group_count, group_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             group_count, group_size);
+}
+
+static inline void gemm_batch(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<std::complex<float>, 1> &alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::complex<float>, 1> &b,
+    cl::sycl::buffer<std::int64_t, 1> &ldb, cl::sycl::buffer<std::complex<float>, 1> &beta,
+    cl::sycl::buffer<std::complex<float>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            group_count, group_size);
+    detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                       beta, c, ldc, group_count, group_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             group_count, group_size);
+}
+
+static inline void gemm_batch(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<std::complex<double>, 1> &alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::complex<double>, 1> &b,
+    cl::sycl::buffer<std::int64_t, 1> &ldb, cl::sycl::buffer<std::complex<double>, 1> &beta,
+    cl::sycl::buffer<std::complex<double>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            group_count, group_size);
+    detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                       beta, c, ldc, group_count, group_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             group_count, group_size);
+}
+
+static inline void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                              cl::sycl::buffer<transpose, 1> &transb,
+                              cl::sycl::buffer<std::int64_t, 1> &m,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::int64_t, 1> &k,
+                              cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                              cl::sycl::buffer<float, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+                              cl::sycl::buffer<std::int64_t, 1> &offset_b,
+                              cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc,
+                              cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                            offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                       offset_a, b, ldb, offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                             offset_b, beta, c, ldc, offset_c, group_count, group_size);
+}
+
+static inline void gemm_batch(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<double, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<double, 1> &beta,
+    cl::sycl::buffer<double, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                            offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                       offset_a, b, ldb, offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                             offset_b, beta, c, ldc, offset_c, group_count, group_size);
+}
+
+static inline void gemm_batch(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<std::complex<float>, 1> &alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<std::complex<float>, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<std::complex<float>, 1> &beta,
+    cl::sycl::buffer<std::complex<float>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                            offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                       offset_a, b, ldb, offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                             offset_b, beta, c, ldc, offset_c, group_count, group_size);
+}
+
+static inline void gemm_batch(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<std::complex<double>, 1> &alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<std::complex<double>, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<std::complex<double>, 1> &beta,
+    cl::sycl::buffer<std::complex<double>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                            offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                       offset_a, b, ldb, offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                             offset_b, beta, c, ldc, offset_c, group_count, group_size);
+}
+
+static inline void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                              std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                              cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, cl::sycl::buffer<float, 1> &b,
+                              std::int64_t ldb, std::int64_t stride_b, float beta,
+                              cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                            stride_b, beta, c, ldc, stride_c, batch_size);
+    detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                       stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                             stride_b, beta, c, ldc, stride_c, batch_size);
+}
+
+static inline void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                              std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                              cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, cl::sycl::buffer<double, 1> &b,
+                              std::int64_t ldb, std::int64_t stride_b, double beta,
+                              cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                            stride_b, beta, c, ldc, stride_c, batch_size);
+    detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                       stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                             stride_b, beta, c, ldc, stride_c, batch_size);
+}
+
+static inline void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                              std::int64_t m, std::int64_t n, std::int64_t k,
+                              std::complex<float> alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::complex<float> beta,
+                              cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                            stride_b, beta, c, ldc, stride_c, batch_size);
+    detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                       stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                             stride_b, beta, c, ldc, stride_c, batch_size);
+}
+
+static inline void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                              std::int64_t m, std::int64_t n, std::int64_t k,
+                              std::complex<double> alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::complex<double> beta,
+                              cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                            stride_b, beta, c, ldc, stride_c, batch_size);
+    detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                       stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                             stride_b, beta, c, ldc, stride_c, batch_size);
+}
+
+static inline void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                              cl::sycl::buffer<transpose, 1> &transb,
+                              cl::sycl::buffer<std::int64_t, 1> &m,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::int64_t, 1> &k,
+                              cl::sycl::buffer<half, 1> &alpha, cl::sycl::buffer<half, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                              cl::sycl::buffer<half, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+                              cl::sycl::buffer<std::int64_t, 1> &offset_b,
+                              cl::sycl::buffer<half, 1> &beta, cl::sycl::buffer<half, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc,
+                              cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                            offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                       offset_a, b, ldb, offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                             offset_b, beta, c, ldc, offset_c, group_count, group_size);
+}
+
+static inline void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                              std::int64_t m, std::int64_t n, std::int64_t k, half alpha,
+                              cl::sycl::buffer<half, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                              cl::sycl::buffer<half, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                              half beta, cl::sycl::buffer<half, 1> &c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                            stride_b, beta, c, ldc, stride_c, batch_size);
+    detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                       stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                             stride_b, beta, c, ldc, stride_c, batch_size);
+}
+
+static inline void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                              cl::sycl::buffer<transpose, 1> &transb,
+                              cl::sycl::buffer<std::int64_t, 1> &m,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::int64_t, 1> &k,
+                              cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<half, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                              cl::sycl::buffer<half, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+                              cl::sycl::buffer<std::int64_t, 1> &offset_b,
+                              cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc,
+                              cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                            offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                       offset_a, b, ldb, offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                             offset_b, beta, c, ldc, offset_c, group_count, group_size);
+}
+
+static inline void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                              std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                              cl::sycl::buffer<half, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                              cl::sycl::buffer<half, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                              float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                            stride_b, beta, c, ldc, stride_c, batch_size);
+    detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                       stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                             stride_b, beta, c, ldc, stride_c, batch_size);
+}
+
+static inline void gemm_batch(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<int8_t, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<uint8_t, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+    cl::sycl::buffer<int32_t, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                            offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                       offset_a, b, ldb, offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                             offset_b, beta, c, ldc, offset_c, group_count, group_size);
+}
+
+static inline void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                              std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                              cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, cl::sycl::buffer<uint8_t, 1> &b,
+                              std::int64_t ldb, std::int64_t stride_b, float beta,
+                              cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                            stride_b, beta, c, ldc, stride_c, batch_size);
+    detail::gemm_batch(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                       stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                             stride_b, beta, c, ldc, stride_c, batch_size);
+}
+
+static inline void gemm_compact(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+                                cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                std::int64_t batch_size) {
+    gemm_compact_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                              batch_size);
+    detail::gemm_compact(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
+                         ldb, beta, c, ldc, batch_size);
+    gemm_compact_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                               batch_size);
+}
+
+static inline void gemm_compact(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                                cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+                                cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                std::int64_t batch_size) {
+    gemm_compact_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                              batch_size);
+    detail::gemm_compact(select_backend(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
+                         ldb, beta, c, ldc, batch_size);
+    gemm_compact_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                               batch_size);
+}
+
+static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k,
+                            float alpha, cl::sycl::buffer<int16_t, 1> &a, std::int64_t lda,
+                            int16_t ao, cl::sycl::buffer<int16_t, 1> &b, std::int64_t ldb,
+                            int16_t bo, float beta, cl::sycl::buffer<int32_t, 1> &c,
+                            std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+    gemm_ext_precondition(queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                          beta, c, ldc, co);
+    detail::gemm_ext(select_backend(queue), queue, transa, transb, offsetc, m, n, k, alpha, a, lda,
+                     ao, b, ldb, bo, beta, c, ldc, co);
+    gemm_ext_postcondition(queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                           beta, c, ldc, co);
+}
+
+static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k,
+                            float alpha, cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda,
+                            int8_t ao, cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+                            float beta, cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                            cl::sycl::buffer<int32_t, 1> &co) {
+    gemm_ext_precondition(queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                          beta, c, ldc, co);
+    detail::gemm_ext(select_backend(queue), queue, transa, transb, offsetc, m, n, k, alpha, a, lda,
+                     ao, b, ldb, bo, beta, c, ldc, co);
+    gemm_ext_postcondition(queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                           beta, c, ldc, co);
+}
+
+static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k,
+                            float alpha, cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda,
+                            uint8_t ao, cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+                            float beta, cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                            cl::sycl::buffer<int32_t, 1> &co) {
+    gemm_ext_precondition(queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                          beta, c, ldc, co);
+    detail::gemm_ext(select_backend(queue), queue, transa, transb, offsetc, m, n, k, alpha, a, lda,
+                     ao, b, ldb, bo, beta, c, ldc, co);
+    gemm_ext_postcondition(queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                           beta, c, ldc, co);
+}
+
+static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+                            cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+                            cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo,
+                            cl::sycl::buffer<float, 1> &scales, int8_t zc,
+                            cl::sycl::buffer<int8_t, 1> &c, std::int64_t ldc) {
+    gemm_ext_precondition(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                          zc, c, ldc);
+    detail::gemm_ext(select_backend(queue), queue, transa, transb, scalec, m, n, k, a, lda, ao, b,
+                     ldb, bo, scales, zc, c, ldc);
+    gemm_ext_postcondition(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                           zc, c, ldc);
+}
+
+static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+                            cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+                            cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo,
+                            cl::sycl::buffer<float, 1> &scales, uint8_t zc,
+                            cl::sycl::buffer<uint8_t, 1> &c, std::int64_t ldc) {
+    gemm_ext_precondition(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                          zc, c, ldc);
+    detail::gemm_ext(select_backend(queue), queue, transa, transb, scalec, m, n, k, a, lda, ao, b,
+                     ldb, bo, scales, zc, c, ldc);
+    gemm_ext_postcondition(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                           zc, c, ldc);
+}
+
+static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+                            cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+                            cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+                            cl::sycl::buffer<float, 1> &scales, int8_t zc,
+                            cl::sycl::buffer<int8_t, 1> &c, std::int64_t ldc) {
+    gemm_ext_precondition(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                          zc, c, ldc);
+    detail::gemm_ext(select_backend(queue), queue, transa, transb, scalec, m, n, k, a, lda, ao, b,
+                     ldb, bo, scales, zc, c, ldc);
+    gemm_ext_postcondition(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                           zc, c, ldc);
+}
+
+static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+                            cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+                            cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+                            cl::sycl::buffer<float, 1> &scales, uint8_t zc,
+                            cl::sycl::buffer<uint8_t, 1> &c, std::int64_t ldc) {
+    gemm_ext_precondition(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                          zc, c, ldc);
+    detail::gemm_ext(select_backend(queue), queue, transa, transb, scalec, m, n, k, a, lda, ao, b,
+                     ldb, bo, scales, zc, c, ldc);
+    gemm_ext_postcondition(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                           zc, c, ldc);
+}
+
+static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+                            cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
+                            cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+                            cl::sycl::buffer<float, 1> &scales, int8_t zc,
+                            cl::sycl::buffer<int8_t, 1> &c, std::int64_t ldc) {
+    gemm_ext_precondition(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                          zc, c, ldc);
+    detail::gemm_ext(select_backend(queue), queue, transa, transb, scalec, m, n, k, a, lda, ao, b,
+                     ldb, bo, scales, zc, c, ldc);
+    gemm_ext_postcondition(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                           zc, c, ldc);
+}
+
+static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+                            cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
+                            cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+                            cl::sycl::buffer<float, 1> &scales, uint8_t zc,
+                            cl::sycl::buffer<uint8_t, 1> &c, std::int64_t ldc) {
+    gemm_ext_precondition(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                          zc, c, ldc);
+    detail::gemm_ext(select_backend(queue), queue, transa, transb, scalec, m, n, k, a, lda, ao, b,
+                     ldb, bo, scales, zc, c, ldc);
+    gemm_ext_postcondition(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                           zc, c, ldc);
+}
+
+static inline void gemm_s8u8s32_compute(cl::sycl::queue &queue, transpose transb, offset offsetc,
+                                        std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                        cl::sycl::buffer<int8_t, 1> &packed_a, int8_t ao,
+                                        cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb,
+                                        uint8_t bo, float beta, cl::sycl::buffer<int32_t, 1> &c,
+                                        std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+    gemm_s8u8s32_compute_precondition(queue, transb, offsetc, m, n, k, alpha, packed_a, ao, b, ldb,
+                                      bo, beta, c, ldc, co);
+    detail::gemm_s8u8s32_compute(select_backend(queue), queue, transb, offsetc, m, n, k, alpha,
+                                 packed_a, ao, b, ldb, bo, beta, c, ldc, co);
+    gemm_s8u8s32_compute_postcondition(queue, transb, offsetc, m, n, k, alpha, packed_a, ao, b, ldb,
+                                       bo, beta, c, ldc, co);
+}
+
+static inline void gemm_s8u8s32_compute(cl::sycl::queue &queue, transpose transa, offset offsetc,
+                                        std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                        cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+                                        cl::sycl::buffer<uint8_t, 1> &packed_b, uint8_t bo,
+                                        float beta, cl::sycl::buffer<int32_t, 1> &c,
+                                        std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+    gemm_s8u8s32_compute_precondition(queue, transa, offsetc, m, n, k, alpha, a, lda, ao, packed_b,
+                                      bo, beta, c, ldc, co);
+    detail::gemm_s8u8s32_compute(select_backend(queue), queue, transa, offsetc, m, n, k, alpha, a,
+                                 lda, ao, packed_b, bo, beta, c, ldc, co);
+    gemm_s8u8s32_compute_postcondition(queue, transa, offsetc, m, n, k, alpha, a, lda, ao, packed_b,
+                                       bo, beta, c, ldc, co);
+}
+
+static inline void gemm_s8u8s32_pack(cl::sycl::queue &queue, transpose transa, std::int64_t m,
+                                     std::int64_t n, std::int64_t k, cl::sycl::buffer<int8_t, 1> &a,
+                                     std::int64_t lda, cl::sycl::buffer<int8_t, 1> &packed_a) {
+    gemm_s8u8s32_pack_precondition(queue, transa, m, n, k, a, lda, packed_a);
+    detail::gemm_s8u8s32_pack(select_backend(queue), queue, transa, m, n, k, a, lda, packed_a);
+    gemm_s8u8s32_pack_postcondition(queue, transa, m, n, k, a, lda, packed_a);
+}
+
+static inline void gemm_s8u8s32_pack(cl::sycl::queue &queue, transpose transb, std::int64_t m,
+                                     std::int64_t n, std::int64_t k,
+                                     cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb,
+                                     cl::sycl::buffer<uint8_t, 1> &packed_b) {
+    gemm_s8u8s32_pack_precondition(queue, transb, m, n, k, b, ldb, packed_b);
+    detail::gemm_s8u8s32_pack(select_backend(queue), queue, transb, m, n, k, b, ldb, packed_b);
+    gemm_s8u8s32_pack_postcondition(queue, transb, m, n, k, b, ldb, packed_b);
+}
+
+static inline std::int64_t gemm_s8u8s32_pack_get_size(cl::sycl::queue &queue, identifier which,
+                                                      std::int64_t m, std::int64_t n,
+                                                      std::int64_t k) {
+    gemm_s8u8s32_pack_get_size_precondition(queue, which, m, n, k);
+    auto res = detail::gemm_s8u8s32_pack_get_size(select_backend(queue), queue, which, m, n, k);
+    gemm_s8u8s32_pack_get_size_postcondition(queue, which, m, n, k);
+    return res;
+}
+
 static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
                         float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
@@ -329,6 +1621,197 @@ static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m,
     gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
+static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        float alpha, cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                        cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    detail::gemv(select_backend(queue), queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+}
+
+static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        float alpha, cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                        cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    detail::gemv(select_backend(queue), queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+}
+
+static inline void gemv_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+                              cl::sycl::buffer<std::int64_t, 1> &m,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<float, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &y,
+                              cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemv_batch_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                            group_size);
+    detail::gemv_batch(select_backend(queue), queue, trans, m, n, alpha, a, lda, x, incx, beta, y,
+                       incy, group_count, group_size);
+    gemv_batch_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                             group_size);
+}
+
+static inline void gemv_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+                              cl::sycl::buffer<std::int64_t, 1> &m,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<double, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &y,
+                              cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemv_batch_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                            group_size);
+    detail::gemv_batch(select_backend(queue), queue, trans, m, n, alpha, a, lda, x, incx, beta, y,
+                       incy, group_count, group_size);
+    gemv_batch_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                             group_size);
+}
+
+static inline void gemv_batch(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::complex<float>, 1> &alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::complex<float>, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<std::complex<float>, 1> &beta,
+    cl::sycl::buffer<std::complex<float>, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemv_batch_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                            group_size);
+    detail::gemv_batch(select_backend(queue), queue, trans, m, n, alpha, a, lda, x, incx, beta, y,
+                       incy, group_count, group_size);
+    gemv_batch_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                             group_size);
+}
+
+static inline void gemv_batch(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::complex<double>, 1> &alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::complex<double>, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<std::complex<double>, 1> &beta,
+    cl::sycl::buffer<std::complex<double>, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemv_batch_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                            group_size);
+    detail::gemv_batch(select_backend(queue), queue, trans, m, n, alpha, a, lda, x, incx, beta, y,
+                       incy, group_count, group_size);
+    gemv_batch_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                             group_size);
+}
+
+static inline void gemv_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                              std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                              std::int64_t lda, std::int64_t stride_a,
+                              cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, float beta, cl::sycl::buffer<float, 1> &y,
+                              std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    gemv_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta, y,
+                            incy, stride_y, batch_size);
+    detail::gemv_batch(select_backend(queue), queue, trans, m, n, alpha, a, lda, stride_a, x, incx,
+                       stride_x, beta, y, incy, stride_y, batch_size);
+    gemv_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta,
+                             y, incy, stride_y, batch_size);
+}
+
+static inline void gemv_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                              std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+                              std::int64_t lda, std::int64_t stride_a,
+                              cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, double beta, cl::sycl::buffer<double, 1> &y,
+                              std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    gemv_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta, y,
+                            incy, stride_y, batch_size);
+    detail::gemv_batch(select_backend(queue), queue, trans, m, n, alpha, a, lda, stride_a, x, incx,
+                       stride_x, beta, y, incy, stride_y, batch_size);
+    gemv_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta,
+                             y, incy, stride_y, batch_size);
+}
+
+static inline void gemv_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                              std::int64_t n, std::complex<float> alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &x,
+                              std::int64_t incx, std::int64_t stride_x, std::complex<float> beta,
+                              cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                              std::int64_t stride_y, std::int64_t batch_size) {
+    gemv_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta, y,
+                            incy, stride_y, batch_size);
+    detail::gemv_batch(select_backend(queue), queue, trans, m, n, alpha, a, lda, stride_a, x, incx,
+                       stride_x, beta, y, incy, stride_y, batch_size);
+    gemv_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta,
+                             y, incy, stride_y, batch_size);
+}
+
+static inline void gemv_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                              std::int64_t n, std::complex<double> alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &x,
+                              std::int64_t incx, std::int64_t stride_x, std::complex<double> beta,
+                              cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                              std::int64_t stride_y, std::int64_t batch_size) {
+    gemv_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta, y,
+                            incy, stride_y, batch_size);
+    detail::gemv_batch(select_backend(queue), queue, trans, m, n, alpha, a, lda, stride_a, x, incx,
+                       stride_x, beta, y, incy, stride_y, batch_size);
+    gemv_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta,
+                             y, incy, stride_y, batch_size);
+}
+
+static inline void gemv_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                              std::int64_t n, float alpha, cl::sycl::buffer<half, 1> &a,
+                              std::int64_t lda, std::int64_t stride_a,
+                              cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, float beta, cl::sycl::buffer<float, 1> &y,
+                              std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    gemv_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta, y,
+                            incy, stride_y, batch_size);
+    detail::gemv_batch(select_backend(queue), queue, trans, m, n, alpha, a, lda, stride_a, x, incx,
+                       stride_x, beta, y, incy, stride_y, batch_size);
+    gemv_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta,
+                             y, incy, stride_y, batch_size);
+}
+
+static inline void gemv_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                              std::int64_t n, float alpha, cl::sycl::buffer<bfloat16, 1> &a,
+                              std::int64_t lda, std::int64_t stride_a,
+                              cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, float beta, cl::sycl::buffer<float, 1> &y,
+                              std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    gemv_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta, y,
+                            incy, stride_y, batch_size);
+    detail::gemv_batch(select_backend(queue), queue, trans, m, n, alpha, a, lda, stride_a, x, incx,
+                       stride_x, beta, y, incy, stride_y, batch_size);
+    gemv_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta,
+                             y, incy, stride_y, batch_size);
+}
+
+static inline void gepack_compact(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                                  cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                  std::int64_t stride_a, cl::sycl::buffer<float, 1> &ap,
+                                  std::int64_t ldap, std::int64_t batch_size) {
+    gepack_compact_precondition(queue, rows, cols, a, lda, stride_a, ap, ldap, batch_size);
+    detail::gepack_compact(select_backend(queue), queue, rows, cols, a, lda, stride_a, ap, ldap,
+                           batch_size);
+    gepack_compact_postcondition(queue, rows, cols, a, lda, stride_a, ap, ldap, batch_size);
+}
+
+static inline void gepack_compact(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                                  cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                  std::int64_t stride_a, cl::sycl::buffer<double, 1> &ap,
+                                  std::int64_t ldap, std::int64_t batch_size) {
+    gepack_compact_precondition(queue, rows, cols, a, lda, stride_a, ap, ldap, batch_size);
+    detail::gepack_compact(select_backend(queue), queue, rows, cols, a, lda, stride_a, ap, ldap,
+                           batch_size);
+    gepack_compact_postcondition(queue, rows, cols, a, lda, stride_a, ap, ldap, batch_size);
+}
+
 static inline void ger(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float alpha,
                        cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<float, 1> &y, std::int64_t incy,
@@ -387,6 +1870,130 @@ static inline void geru(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
     geru_postcondition(queue, m, n, alpha, x, incx, y, incy, a, lda);
 }
 
+static inline void getrfnp_compact(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                   cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                   std::int64_t batch_size) {
+    getrfnp_compact_precondition(queue, m, n, a, lda, batch_size);
+    detail::getrfnp_compact(select_backend(queue), queue, m, n, a, lda, batch_size);
+    getrfnp_compact_postcondition(queue, m, n, a, lda, batch_size);
+}
+
+static inline void getrfnp_compact(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                   cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                   std::int64_t batch_size) {
+    getrfnp_compact_precondition(queue, m, n, a, lda, batch_size);
+    detail::getrfnp_compact(select_backend(queue), queue, m, n, a, lda, batch_size);
+    getrfnp_compact_postcondition(queue, m, n, a, lda, batch_size);
+}
+
+static inline void gettgb(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                          std::int64_t ku, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                          cl::sycl::buffer<float, 1> &ab, std::int64_t ldab) {
+    gettgb_precondition(queue, m, n, kl, ku, a, lda, ab, ldab);
+    detail::gettgb(select_backend(queue), queue, m, n, kl, ku, a, lda, ab, ldab);
+    gettgb_postcondition(queue, m, n, kl, ku, a, lda, ab, ldab);
+}
+
+static inline void gettgb(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                          std::int64_t ku, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                          cl::sycl::buffer<double, 1> &ab, std::int64_t ldab) {
+    gettgb_precondition(queue, m, n, kl, ku, a, lda, ab, ldab);
+    detail::gettgb(select_backend(queue), queue, m, n, kl, ku, a, lda, ab, ldab);
+    gettgb_postcondition(queue, m, n, kl, ku, a, lda, ab, ldab);
+}
+
+static inline void gettgb(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                          std::int64_t ku, cl::sycl::buffer<std::complex<float>, 1> &a,
+                          std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &ab,
+                          std::int64_t ldab) {
+    gettgb_precondition(queue, m, n, kl, ku, a, lda, ab, ldab);
+    detail::gettgb(select_backend(queue), queue, m, n, kl, ku, a, lda, ab, ldab);
+    gettgb_postcondition(queue, m, n, kl, ku, a, lda, ab, ldab);
+}
+
+static inline void gettgb(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                          std::int64_t ku, cl::sycl::buffer<std::complex<double>, 1> &a,
+                          std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &ab,
+                          std::int64_t ldab) {
+    gettgb_precondition(queue, m, n, kl, ku, a, lda, ab, ldab);
+    detail::gettgb(select_backend(queue), queue, m, n, kl, ku, a, lda, ab, ldab);
+    gettgb_postcondition(queue, m, n, kl, ku, a, lda, ab, ldab);
+}
+
+static inline void gettgb_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t kl, std::int64_t ku, cl::sycl::buffer<float, 1> &a,
+                                std::int64_t lda, std::int64_t stride_a,
+                                cl::sycl::buffer<float, 1> &ab, std::int64_t ldab,
+                                std::int64_t stride_ab, std::int64_t batch_size) {
+    gettgb_batch_precondition(queue, m, n, kl, ku, a, lda, stride_a, ab, ldab, stride_ab,
+                              batch_size);
+    detail::gettgb_batch(select_backend(queue), queue, m, n, kl, ku, a, lda, stride_a, ab, ldab,
+                         stride_ab, batch_size);
+    gettgb_batch_postcondition(queue, m, n, kl, ku, a, lda, stride_a, ab, ldab, stride_ab,
+                               batch_size);
+}
+
+static inline void gettgb_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t kl, std::int64_t ku, cl::sycl::buffer<double, 1> &a,
+                                std::int64_t lda, std::int64_t stride_a,
+                                cl::sycl::buffer<double, 1> &ab, std::int64_t ldab,
+                                std::int64_t stride_ab, std::int64_t batch_size) {
+    gettgb_batch_precondition(queue, m, n, kl, ku, a, lda, stride_a, ab, ldab, stride_ab,
+                              batch_size);
+    detail::gettgb_batch(select_backend(queue), queue, m, n, kl, ku, a, lda, stride_a, ab, ldab,
+                         stride_ab, batch_size);
+    gettgb_batch_postcondition(queue, m, n, kl, ku, a, lda, stride_a, ab, ldab, stride_ab,
+                               batch_size);
+}
+
+static inline void gettgb_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t kl, std::int64_t ku,
+                                cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &ab,
+                                std::int64_t ldab, std::int64_t stride_ab,
+                                std::int64_t batch_size) {
+    gettgb_batch_precondition(queue, m, n, kl, ku, a, lda, stride_a, ab, ldab, stride_ab,
+                              batch_size);
+    detail::gettgb_batch(select_backend(queue), queue, m, n, kl, ku, a, lda, stride_a, ab, ldab,
+                         stride_ab, batch_size);
+    gettgb_batch_postcondition(queue, m, n, kl, ku, a, lda, stride_a, ab, ldab, stride_ab,
+                               batch_size);
+}
+
+static inline void gettgb_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t kl, std::int64_t ku,
+                                cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                std::int64_t stride_a,
+                                cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t ldab,
+                                std::int64_t stride_ab, std::int64_t batch_size) {
+    gettgb_batch_precondition(queue, m, n, kl, ku, a, lda, stride_a, ab, ldab, stride_ab,
+                              batch_size);
+    detail::gettgb_batch(select_backend(queue), queue, m, n, kl, ku, a, lda, stride_a, ab, ldab,
+                         stride_ab, batch_size);
+    gettgb_batch_postcondition(queue, m, n, kl, ku, a, lda, stride_a, ab, ldab, stride_ab,
+                               batch_size);
+}
+
+static inline void geunpack_compact(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                                    cl::sycl::buffer<float, 1> &ap, std::int64_t ldap,
+                                    cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                    std::int64_t stride_a, std::int64_t batch_size) {
+    geunpack_compact_precondition(queue, rows, cols, ap, ldap, a, lda, stride_a, batch_size);
+    detail::geunpack_compact(select_backend(queue), queue, rows, cols, ap, ldap, a, lda, stride_a,
+                             batch_size);
+    geunpack_compact_postcondition(queue, rows, cols, ap, ldap, a, lda, stride_a, batch_size);
+}
+
+static inline void geunpack_compact(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                                    cl::sycl::buffer<double, 1> &ap, std::int64_t ldap,
+                                    cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                    std::int64_t stride_a, std::int64_t batch_size) {
+    geunpack_compact_precondition(queue, rows, cols, ap, ldap, a, lda, stride_a, batch_size);
+    detail::geunpack_compact(select_backend(queue), queue, rows, cols, ap, ldap, a, lda, stride_a,
+                             batch_size);
+    geunpack_compact_postcondition(queue, rows, cols, ap, ldap, a, lda, stride_a, batch_size);
+}
+
 static inline void hbmv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, std::int64_t k,
                         std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x,
@@ -534,6 +2141,72 @@ static inline void herk(cl::sycl::queue &queue, uplo upper_lower, transpose tran
     herk_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
+static inline void herk_batch(cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                              cl::sycl::buffer<transpose, 1> &trans,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::int64_t, 1> &k,
+                              cl::sycl::buffer<float, 1> &alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<float, 1> &beta,
+                              cl::sycl::buffer<std::complex<float>, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    herk_batch_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                            group_count, group_size);
+    detail::herk_batch(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda, beta,
+                       c, ldc, group_count, group_size);
+    herk_batch_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                             group_count, group_size);
+}
+
+static inline void herk_batch(cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                              cl::sycl::buffer<transpose, 1> &trans,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::int64_t, 1> &k,
+                              cl::sycl::buffer<double, 1> &alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<double, 1> &beta,
+                              cl::sycl::buffer<std::complex<double>, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    herk_batch_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                            group_count, group_size);
+    detail::herk_batch(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda, beta,
+                       c, ldc, group_count, group_size);
+    herk_batch_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                             group_count, group_size);
+}
+
+static inline void herk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                              std::int64_t n, std::int64_t k, float alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, float beta,
+                              cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size) {
+    herk_batch_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                            stride_c, batch_size);
+    detail::herk_batch(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda,
+                       stride_a, beta, c, ldc, stride_c, batch_size);
+    herk_batch_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                             stride_c, batch_size);
+}
+
+static inline void herk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                              std::int64_t n, std::int64_t k, double alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, double beta,
+                              cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size) {
+    herk_batch_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                            stride_c, batch_size);
+    detail::herk_batch(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda,
+                       stride_a, beta, c, ldc, stride_c, batch_size);
+    herk_batch_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                             stride_c, batch_size);
+}
+
 static inline void hpmv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
                         std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
@@ -618,6 +2291,42 @@ static inline void iamax(cl::sycl::queue &queue, std::int64_t n,
     iamax_postcondition(queue, n, x, incx, result);
 }
 
+static inline cl::sycl::event iamax(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                    std::int64_t *result) {
+    iamax_precondition(queue, n, x, incx, result);
+    auto res = detail::iamax(select_backend(queue), queue, n, x, incx, result);
+    iamax_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+static inline cl::sycl::event iamax(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                    std::int64_t *result) {
+    iamax_precondition(queue, n, x, incx, result);
+    auto res = detail::iamax(select_backend(queue), queue, n, x, incx, result);
+    iamax_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+static inline cl::sycl::event iamax(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                    std::int64_t *result) {
+    iamax_precondition(queue, n, x, incx, result);
+    auto res = detail::iamax(select_backend(queue), queue, n, x, incx, result);
+    iamax_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+static inline cl::sycl::event iamax(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                                    std::int64_t *result) {
+    iamax_precondition(queue, n, x, incx, result);
+    auto res = detail::iamax(select_backend(queue), queue, n, x, incx, result);
+    iamax_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
 static inline void iamin(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
                          std::int64_t incx, cl::sycl::buffer<std::int64_t, 1> &result) {
     iamin_precondition(queue, n, x, incx, result);
@@ -648,6 +2357,131 @@ static inline void iamin(cl::sycl::queue &queue, std::int64_t n,
     iamin_postcondition(queue, n, x, incx, result);
 }
 
+static inline cl::sycl::event iamin(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                    std::int64_t *result) {
+    iamin_precondition(queue, n, x, incx, result);
+    auto res = detail::iamin(select_backend(queue), queue, n, x, incx, result);
+    iamin_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+static inline cl::sycl::event iamin(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                    std::int64_t *result) {
+    iamin_precondition(queue, n, x, incx, result);
+    auto res = detail::iamin(select_backend(queue), queue, n, x, incx, result);
+    iamin_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+static inline cl::sycl::event iamin(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                    std::int64_t *result) {
+    iamin_precondition(queue, n, x, incx, result);
+    auto res = detail::iamin(select_backend(queue), queue, n, x, incx, result);
+    iamin_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+static inline cl::sycl::event iamin(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                                    std::int64_t *result) {
+    iamin_precondition(queue, n, x, incx, result);
+    auto res = detail::iamin(select_backend(queue), queue, n, x, incx, result);
+    iamin_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+static inline void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            float alpha, cl::sycl::buffer<float, 1> &ab, std::int64_t lda,
+                            std::int64_t ldb) {
+    imatcopy_precondition(queue, trans, m, n, alpha, ab, lda, ldb);
+    detail::imatcopy(select_backend(queue), queue, trans, m, n, alpha, ab, lda, ldb);
+    imatcopy_postcondition(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+static inline void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            double alpha, cl::sycl::buffer<double, 1> &ab, std::int64_t lda,
+                            std::int64_t ldb) {
+    imatcopy_precondition(queue, trans, m, n, alpha, ab, lda, ldb);
+    detail::imatcopy(select_backend(queue), queue, trans, m, n, alpha, ab, lda, ldb);
+    imatcopy_postcondition(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+static inline void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &ab,
+                            std::int64_t lda, std::int64_t ldb) {
+    imatcopy_precondition(queue, trans, m, n, alpha, ab, lda, ldb);
+    detail::imatcopy(select_backend(queue), queue, trans, m, n, alpha, ab, lda, ldb);
+    imatcopy_postcondition(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+static inline void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            std::complex<double> alpha,
+                            cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t lda,
+                            std::int64_t ldb) {
+    imatcopy_precondition(queue, trans, m, n, alpha, ab, lda, ldb);
+    detail::imatcopy(select_backend(queue), queue, trans, m, n, alpha, ab, lda, ldb);
+    imatcopy_postcondition(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+static inline void imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &ab,
+                                  std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                                  std::int64_t batch_size) {
+    imatcopy_batch_precondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    detail::imatcopy_batch(select_backend(queue), queue, trans, m, n, alpha, ab, lda, ldb, stride,
+                           batch_size);
+    imatcopy_batch_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+}
+
+static inline void imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &ab,
+                                  std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                                  std::int64_t batch_size) {
+    imatcopy_batch_precondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    detail::imatcopy_batch(select_backend(queue), queue, trans, m, n, alpha, ab, lda, ldb, stride,
+                           batch_size);
+    imatcopy_batch_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+}
+
+static inline void imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, std::complex<float> alpha,
+                                  cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t lda,
+                                  std::int64_t ldb, std::int64_t stride, std::int64_t batch_size) {
+    imatcopy_batch_precondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    detail::imatcopy_batch(select_backend(queue), queue, trans, m, n, alpha, ab, lda, ldb, stride,
+                           batch_size);
+    imatcopy_batch_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+}
+
+static inline void imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, std::complex<double> alpha,
+                                  cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t lda,
+                                  std::int64_t ldb, std::int64_t stride, std::int64_t batch_size) {
+    imatcopy_batch_precondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    detail::imatcopy_batch(select_backend(queue), queue, trans, m, n, alpha, ab, lda, ldb, stride,
+                           batch_size);
+    imatcopy_batch_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+}
+
+static inline void lange(cl::sycl::queue &queue, norm_type norm, transpose trans, std::int64_t m,
+                         std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                         cl::sycl::buffer<float, 1> &result) {
+    lange_precondition(queue, norm, trans, m, n, a, lda, result);
+    detail::lange(select_backend(queue), queue, norm, trans, m, n, a, lda, result);
+    lange_postcondition(queue, norm, trans, m, n, a, lda, result);
+}
+
+static inline void lange(cl::sycl::queue &queue, norm_type norm, transpose trans, std::int64_t m,
+                         std::int64_t n, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                         cl::sycl::buffer<double, 1> &result) {
+    lange_precondition(queue, norm, trans, m, n, a, lda, result);
+    detail::lange(select_backend(queue), queue, norm, trans, m, n, a, lda, result);
+    lange_postcondition(queue, norm, trans, m, n, a, lda, result);
+}
+
 static inline void nrm2(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<float, 1> &result) {
@@ -678,6 +2512,604 @@ static inline void nrm2(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer
     nrm2_postcondition(queue, n, x, incx, result);
 }
 
+static inline void nrm2(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                        std::int64_t incx, cl::sycl::buffer<float, 1> &result, accumulation acc) {
+    nrm2_precondition(queue, n, x, incx, result, acc);
+    detail::nrm2(select_backend(queue), queue, n, x, incx, result, acc);
+    nrm2_postcondition(queue, n, x, incx, result, acc);
+}
+
+static inline cl::sycl::event nrm2(cl::sycl::queue &queue, std::int64_t n,
+                                   cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                   float *result) {
+    nrm2_precondition(queue, n, x, incx, result);
+    auto res = detail::nrm2(select_backend(queue), queue, n, x, incx, result);
+    nrm2_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+static inline cl::sycl::event nrm2(cl::sycl::queue &queue, std::int64_t n,
+                                   cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                   double *result) {
+    nrm2_precondition(queue, n, x, incx, result);
+    auto res = detail::nrm2(select_backend(queue), queue, n, x, incx, result);
+    nrm2_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+static inline cl::sycl::event nrm2(cl::sycl::queue &queue, std::int64_t n,
+                                   cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                   float *result) {
+    nrm2_precondition(queue, n, x, incx, result);
+    auto res = detail::nrm2(select_backend(queue), queue, n, x, incx, result);
+    nrm2_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+static inline cl::sycl::event nrm2(cl::sycl::queue &queue, std::int64_t n,
+                                   cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                                   double *result) {
+    nrm2_precondition(queue, n, x, incx, result);
+    auto res = detail::nrm2(select_backend(queue), queue, n, x, incx, result);
+    nrm2_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+static inline void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, float alpha,
+                           cl::sycl::buffer<float, 1> &a, std::int64_t lda, float beta,
+                           cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    omatadd_precondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    detail::omatadd(select_backend(queue), queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb,
+                    c, ldc);
+    omatadd_postcondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+}
+
+static inline void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, double alpha,
+                           cl::sycl::buffer<double, 1> &a, std::int64_t lda, double beta,
+                           cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    omatadd_precondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    detail::omatadd(select_backend(queue), queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb,
+                    c, ldc);
+    omatadd_postcondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+}
+
+static inline void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                           std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &b,
+                           std::int64_t ldb, cl::sycl::buffer<std::complex<float>, 1> &c,
+                           std::int64_t ldc) {
+    omatadd_precondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    detail::omatadd(select_backend(queue), queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb,
+                    c, ldc);
+    omatadd_postcondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+}
+
+static inline void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &b,
+                           std::int64_t ldb, cl::sycl::buffer<std::complex<double>, 1> &c,
+                           std::int64_t ldc) {
+    omatadd_precondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    detail::omatadd(select_backend(queue), queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb,
+                    c, ldc);
+    omatadd_postcondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+}
+
+static inline void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                 std::int64_t m, std::int64_t n, float alpha,
+                                 cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, float beta, cl::sycl::buffer<float, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b,
+                                 cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size) {
+    omatadd_batch_precondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                               stride_b, c, ldc, stride_c, batch_size);
+    detail::omatadd_batch(select_backend(queue), queue, transa, transb, m, n, alpha, a, lda,
+                          stride_a, beta, b, ldb, stride_b, c, ldc, stride_c, batch_size);
+    omatadd_batch_postcondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size);
+}
+
+static inline void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                 std::int64_t m, std::int64_t n, double alpha,
+                                 cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, double beta, cl::sycl::buffer<double, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b,
+                                 cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size) {
+    omatadd_batch_precondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                               stride_b, c, ldc, stride_c, batch_size);
+    detail::omatadd_batch(select_backend(queue), queue, transa, transb, m, n, alpha, a, lda,
+                          stride_a, beta, b, ldb, stride_b, c, ldc, stride_c, batch_size);
+    omatadd_batch_postcondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size);
+}
+
+static inline void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                 std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, std::complex<float> beta,
+                                 cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                                 std::int64_t stride_b, cl::sycl::buffer<std::complex<float>, 1> &c,
+                                 std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    omatadd_batch_precondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                               stride_b, c, ldc, stride_c, batch_size);
+    detail::omatadd_batch(select_backend(queue), queue, transa, transb, m, n, alpha, a, lda,
+                          stride_a, beta, b, ldb, stride_b, c, ldc, stride_c, batch_size);
+    omatadd_batch_postcondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size);
+}
+
+static inline void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                 std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, std::complex<double> beta,
+                                 cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                 std::int64_t stride_b,
+                                 cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size) {
+    omatadd_batch_precondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                               stride_b, c, ldc, stride_c, batch_size);
+    detail::omatadd_batch(select_backend(queue), queue, transa, transb, m, n, alpha, a, lda,
+                          stride_a, beta, b, ldb, stride_b, c, ldc, stride_c, batch_size);
+    omatadd_batch_postcondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size);
+}
+
+static inline void omatclamp(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float lo,
+                             float hi, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                             cl::sycl::buffer<float, 1> &b, std::int64_t ldb) {
+    omatclamp_precondition(queue, m, n, lo, hi, a, lda, b, ldb);
+    detail::omatclamp(select_backend(queue), queue, m, n, lo, hi, a, lda, b, ldb);
+    omatclamp_postcondition(queue, m, n, lo, hi, a, lda, b, ldb);
+}
+
+static inline void omatclamp(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, double lo,
+                             double hi, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                             cl::sycl::buffer<double, 1> &b, std::int64_t ldb) {
+    omatclamp_precondition(queue, m, n, lo, hi, a, lda, b, ldb);
+    detail::omatclamp(select_backend(queue), queue, m, n, lo, hi, a, lda, b, ldb);
+    omatclamp_postcondition(queue, m, n, lo, hi, a, lda, b, ldb);
+}
+
+static inline void omatclamp_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float lo,
+                                   float hi, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                   std::int64_t stride_a, cl::sycl::buffer<float, 1> &b,
+                                   std::int64_t ldb, std::int64_t stride_b,
+                                   std::int64_t batch_size) {
+    omatclamp_batch_precondition(queue, m, n, lo, hi, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size);
+    detail::omatclamp_batch(select_backend(queue), queue, m, n, lo, hi, a, lda, stride_a, b, ldb,
+                            stride_b, batch_size);
+    omatclamp_batch_postcondition(queue, m, n, lo, hi, a, lda, stride_a, b, ldb, stride_b,
+                                  batch_size);
+}
+
+static inline void omatclamp_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                   double lo, double hi, cl::sycl::buffer<double, 1> &a,
+                                   std::int64_t lda, std::int64_t stride_a,
+                                   cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                   std::int64_t stride_b, std::int64_t batch_size) {
+    omatclamp_batch_precondition(queue, m, n, lo, hi, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size);
+    detail::omatclamp_batch(select_backend(queue), queue, m, n, lo, hi, a, lda, stride_a, b, ldb,
+                            stride_b, batch_size);
+    omatclamp_batch_postcondition(queue, m, n, lo, hi, a, lda, stride_a, b, ldb, stride_b,
+                                  batch_size);
+}
+
+static inline void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                            cl::sycl::buffer<float, 1> &b, std::int64_t ldb) {
+    omatcopy_precondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+    detail::omatcopy(select_backend(queue), queue, trans, m, n, alpha, a, lda, b, ldb);
+    omatcopy_postcondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+static inline void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                            cl::sycl::buffer<double, 1> &b, std::int64_t ldb) {
+    omatcopy_precondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+    detail::omatcopy(select_backend(queue), queue, trans, m, n, alpha, a, lda, b, ldb);
+    omatcopy_postcondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+static inline void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                            std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
+                            std::int64_t ldb) {
+    omatcopy_precondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+    detail::omatcopy(select_backend(queue), queue, trans, m, n, alpha, a, lda, b, ldb);
+    omatcopy_postcondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+static inline void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            std::complex<double> alpha,
+                            cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                            cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
+    omatcopy_precondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+    detail::omatcopy(select_backend(queue), queue, trans, m, n, alpha, a, lda, b, ldb);
+    omatcopy_postcondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+static inline void omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                                  std::int64_t lda, std::int64_t stride_a,
+                                  cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                  std::int64_t stride_b, std::int64_t batch_size) {
+    omatcopy_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size);
+    detail::omatcopy_batch(select_backend(queue), queue, trans, m, n, alpha, a, lda, stride_a, b,
+                           ldb, stride_b, batch_size);
+    omatcopy_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size);
+}
+
+static inline void omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+                                  std::int64_t lda, std::int64_t stride_a,
+                                  cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                  std::int64_t stride_b, std::int64_t batch_size) {
+    omatcopy_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size);
+    detail::omatcopy_batch(select_backend(queue), queue, trans, m, n, alpha, a, lda, stride_a, b,
+                           ldb, stride_b, batch_size);
+    omatcopy_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size);
+}
+
+static inline void omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, std::complex<float> alpha,
+                                  cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                  std::int64_t stride_a,
+                                  cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                                  std::int64_t stride_b, std::int64_t batch_size) {
+    omatcopy_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size);
+    detail::omatcopy_batch(select_backend(queue), queue, trans, m, n, alpha, a, lda, stride_a, b,
+                           ldb, stride_b, batch_size);
+    omatcopy_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size);
+}
+
+static inline void omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, std::complex<double> alpha,
+                                  cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                  std::int64_t stride_a,
+                                  cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                  std::int64_t stride_b, std::int64_t batch_size) {
+    omatcopy_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size);
+    detail::omatcopy_batch(select_backend(queue), queue, trans, m, n, alpha, a, lda, stride_a, b,
+                           ldb, stride_b, batch_size);
+    omatcopy_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size);
+}
+
+static inline void omatdiv(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    omatdiv_precondition(queue, m, n, a, lda, b, ldb, c, ldc);
+    detail::omatdiv(select_backend(queue), queue, m, n, a, lda, b, ldb, c, ldc);
+    omatdiv_postcondition(queue, m, n, a, lda, b, ldb, c, ldc);
+}
+
+static inline void omatdiv(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    omatdiv_precondition(queue, m, n, a, lda, b, ldb, c, ldc);
+    detail::omatdiv(select_backend(queue), queue, m, n, a, lda, b, ldb, c, ldc);
+    omatdiv_postcondition(queue, m, n, a, lda, b, ldb, c, ldc);
+}
+
+static inline void omatdiv(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    omatdiv_precondition(queue, m, n, a, lda, b, ldb, c, ldc);
+    detail::omatdiv(select_backend(queue), queue, m, n, a, lda, b, ldb, c, ldc);
+    omatdiv_postcondition(queue, m, n, a, lda, b, ldb, c, ldc);
+}
+
+static inline void omatdiv(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    omatdiv_precondition(queue, m, n, a, lda, b, ldb, c, ldc);
+    detail::omatdiv(select_backend(queue), queue, m, n, a, lda, b, ldb, c, ldc);
+    omatdiv_postcondition(queue, m, n, a, lda, b, ldb, c, ldc);
+}
+
+static inline void omatdiv_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, cl::sycl::buffer<float, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b,
+                                 cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size) {
+    omatdiv_batch_precondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                               batch_size);
+    detail::omatdiv_batch(select_backend(queue), queue, m, n, a, lda, stride_a, b, ldb, stride_b, c,
+                          ldc, stride_c, batch_size);
+    omatdiv_batch_postcondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                                batch_size);
+}
+
+static inline void omatdiv_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, cl::sycl::buffer<double, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b,
+                                 cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size) {
+    omatdiv_batch_precondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                               batch_size);
+    detail::omatdiv_batch(select_backend(queue), queue, m, n, a, lda, stride_a, b, ldb, stride_b, c,
+                          ldc, stride_c, batch_size);
+    omatdiv_batch_postcondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                                batch_size);
+}
+
+static inline void omatdiv_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b,
+                                 cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size) {
+    omatdiv_batch_precondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                               batch_size);
+    detail::omatdiv_batch(select_backend(queue), queue, m, n, a, lda, stride_a, b, ldb, stride_b, c,
+                          ldc, stride_c, batch_size);
+    omatdiv_batch_postcondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                                batch_size);
+}
+
+static inline void omatdiv_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a,
+                                 cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                 std::int64_t stride_b,
+                                 cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size) {
+    omatdiv_batch_precondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                               batch_size);
+    detail::omatdiv_batch(select_backend(queue), queue, m, n, a, lda, stride_a, b, ldb, stride_b, c,
+                          ldc, stride_c, batch_size);
+    omatdiv_batch_postcondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                                batch_size);
+}
+
+static inline void omatfma(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float alpha,
+                           cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+                           cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    omatfma_precondition(queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+    detail::omatfma(select_backend(queue), queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+    omatfma_postcondition(queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+static inline void omatfma(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, double alpha,
+                           cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+                           cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    omatfma_precondition(queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+    detail::omatfma(select_backend(queue), queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+    omatfma_postcondition(queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+static inline void omatfma(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                           std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
+                           std::int64_t ldb, std::complex<float> beta,
+                           cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    omatfma_precondition(queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+    detail::omatfma(select_backend(queue), queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+    omatfma_postcondition(queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+static inline void omatfma(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                           std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
+                           std::int64_t ldb, std::complex<double> beta,
+                           cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    omatfma_precondition(queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+    detail::omatfma(select_backend(queue), queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+    omatfma_postcondition(queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+static inline void omatfma_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, cl::sycl::buffer<float, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b, float beta,
+                                 cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size) {
+    omatfma_batch_precondition(queue, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+                               stride_c, batch_size);
+    detail::omatfma_batch(select_backend(queue), queue, m, n, alpha, a, lda, stride_a, b, ldb,
+                          stride_b, beta, c, ldc, stride_c, batch_size);
+    omatfma_batch_postcondition(queue, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c,
+                                ldc, stride_c, batch_size);
+}
+
+static inline void omatfma_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, cl::sycl::buffer<double, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b, double beta,
+                                 cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size) {
+    omatfma_batch_precondition(queue, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+                               stride_c, batch_size);
+    detail::omatfma_batch(select_backend(queue), queue, m, n, alpha, a, lda, stride_a, b, ldb,
+                          stride_b, beta, c, ldc, stride_c, batch_size);
+    omatfma_batch_postcondition(queue, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c,
+                                ldc, stride_c, batch_size);
+}
+
+static inline void omatfma_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 std::complex<float> alpha,
+                                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b, std::complex<float> beta,
+                                 cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size) {
+    omatfma_batch_precondition(queue, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+                               stride_c, batch_size);
+    detail::omatfma_batch(select_backend(queue), queue, m, n, alpha, a, lda, stride_a, b, ldb,
+                          stride_b, beta, c, ldc, stride_c, batch_size);
+    omatfma_batch_postcondition(queue, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c,
+                                ldc, stride_c, batch_size);
+}
+
+static inline void omatfma_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 std::complex<double> alpha,
+                                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a,
+                                 cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                 std::int64_t stride_b, std::complex<double> beta,
+                                 cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size) {
+    omatfma_batch_precondition(queue, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+                               stride_c, batch_size);
+    detail::omatfma_batch(select_backend(queue), queue, m, n, alpha, a, lda, stride_a, b, ldb,
+                          stride_b, beta, c, ldc, stride_c, batch_size);
+    omatfma_batch_postcondition(queue, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c,
+                                ldc, stride_c, batch_size);
+}
+
+static inline void omatmul(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    omatmul_precondition(queue, m, n, a, lda, b, ldb, c, ldc);
+    detail::omatmul(select_backend(queue), queue, m, n, a, lda, b, ldb, c, ldc);
+    omatmul_postcondition(queue, m, n, a, lda, b, ldb, c, ldc);
+}
+
+static inline void omatmul(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    omatmul_precondition(queue, m, n, a, lda, b, ldb, c, ldc);
+    detail::omatmul(select_backend(queue), queue, m, n, a, lda, b, ldb, c, ldc);
+    omatmul_postcondition(queue, m, n, a, lda, b, ldb, c, ldc);
+}
+
+static inline void omatmul(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    omatmul_precondition(queue, m, n, a, lda, b, ldb, c, ldc);
+    detail::omatmul(select_backend(queue), queue, m, n, a, lda, b, ldb, c, ldc);
+    omatmul_postcondition(queue, m, n, a, lda, b, ldb, c, ldc);
+}
+
+static inline void omatmul(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    omatmul_precondition(queue, m, n, a, lda, b, ldb, c, ldc);
+    detail::omatmul(select_backend(queue), queue, m, n, a, lda, b, ldb, c, ldc);
+    omatmul_postcondition(queue, m, n, a, lda, b, ldb, c, ldc);
+}
+
+static inline void omatmul_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, cl::sycl::buffer<float, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b,
+                                 cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size) {
+    omatmul_batch_precondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                               batch_size);
+    detail::omatmul_batch(select_backend(queue), queue, m, n, a, lda, stride_a, b, ldb, stride_b, c,
+                          ldc, stride_c, batch_size);
+    omatmul_batch_postcondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                                batch_size);
+}
+
+static inline void omatmul_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, cl::sycl::buffer<double, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b,
+                                 cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size) {
+    omatmul_batch_precondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                               batch_size);
+    detail::omatmul_batch(select_backend(queue), queue, m, n, a, lda, stride_a, b, ldb, stride_b, c,
+                          ldc, stride_c, batch_size);
+    omatmul_batch_postcondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                                batch_size);
+}
+
+static inline void omatmul_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b,
+                                 cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size) {
+    omatmul_batch_precondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                               batch_size);
+    detail::omatmul_batch(select_backend(queue), queue, m, n, a, lda, stride_a, b, ldb, stride_b, c,
+                          ldc, stride_c, batch_size);
+    omatmul_batch_postcondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                                batch_size);
+}
+
+static inline void omatmul_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a,
+                                 cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                 std::int64_t stride_b,
+                                 cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size) {
+    omatmul_batch_precondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                               batch_size);
+    detail::omatmul_batch(select_backend(queue), queue, m, n, a, lda, stride_a, b, ldb, stride_b, c,
+                          ldc, stride_c, batch_size);
+    omatmul_batch_postcondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                                batch_size);
+}
+
+static inline void reduce_columns(cl::sycl::queue &queue, reduction op, transpose trans,
+                                  std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a,
+                                  std::int64_t lda, cl::sycl::buffer<float, 1> &y,
+                                  std::int64_t incy) {
+    reduce_columns_precondition(queue, op, trans, m, n, a, lda, y, incy);
+    detail::reduce_columns(select_backend(queue), queue, op, trans, m, n, a, lda, y, incy);
+    reduce_columns_postcondition(queue, op, trans, m, n, a, lda, y, incy);
+}
+
+static inline void reduce_columns(cl::sycl::queue &queue, reduction op, transpose trans,
+                                  std::int64_t m, std::int64_t n, cl::sycl::buffer<double, 1> &a,
+                                  std::int64_t lda, cl::sycl::buffer<double, 1> &y,
+                                  std::int64_t incy) {
+    reduce_columns_precondition(queue, op, trans, m, n, a, lda, y, incy);
+    detail::reduce_columns(select_backend(queue), queue, op, trans, m, n, a, lda, y, incy);
+    reduce_columns_postcondition(queue, op, trans, m, n, a, lda, y, incy);
+}
+
+static inline void reduce_rows(cl::sycl::queue &queue, reduction op, transpose trans,
+                               std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a,
+                               std::int64_t lda, cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    reduce_rows_precondition(queue, op, trans, m, n, a, lda, y, incy);
+    detail::reduce_rows(select_backend(queue), queue, op, trans, m, n, a, lda, y, incy);
+    reduce_rows_postcondition(queue, op, trans, m, n, a, lda, y, incy);
+}
+
+static inline void reduce_rows(cl::sycl::queue &queue, reduction op, transpose trans,
+                               std::int64_t m, std::int64_t n, cl::sycl::buffer<double, 1> &a,
+                               std::int64_t lda, cl::sycl::buffer<double, 1> &y,
+                               std::int64_t incy) {
+    reduce_rows_precondition(queue, op, trans, m, n, a, lda, y, incy);
+    detail::reduce_rows(select_backend(queue), queue, op, trans, m, n, a, lda, y, incy);
+    reduce_rows_postcondition(queue, op, trans, m, n, a, lda, y, incy);
+}
+
 static inline void rot(cl::sycl::queue &queue, std::int64_t n,
                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy, float c,
@@ -839,6 +3271,112 @@ static inline void scal(cl::sycl::queue &queue, std::int64_t n, double alpha,
     scal_postcondition(queue, n, alpha, x, incx);
 }
 
+static inline void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    scal_batch_precondition(queue, n, alpha, x, incx, group_count, group_size);
+    detail::scal_batch(select_backend(queue), queue, n, alpha, x, incx, group_count, group_size);
+    scal_batch_postcondition(queue, n, alpha, x, incx, group_count, group_size);
+}
+
+static inline void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    scal_batch_precondition(queue, n, alpha, x, incx, group_count, group_size);
+    detail::scal_batch(select_backend(queue), queue, n, alpha, x, incx, group_count, group_size);
+    scal_batch_postcondition(queue, n, alpha, x, incx, group_count, group_size);
+}
+
+static inline void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    scal_batch_precondition(queue, n, alpha, x, incx, group_count, group_size);
+    detail::scal_batch(select_backend(queue), queue, n, alpha, x, incx, group_count, group_size);
+    scal_batch_postcondition(queue, n, alpha, x, incx, group_count, group_size);
+}
+
+static inline void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    scal_batch_precondition(queue, n, alpha, x, incx, group_count, group_size);
+    detail::scal_batch(select_backend(queue), queue, n, alpha, x, incx, group_count, group_size);
+    scal_batch_postcondition(queue, n, alpha, x, incx, group_count, group_size);
+}
+
+static inline void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<float, 1> &alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    scal_batch_precondition(queue, n, alpha, x, incx, group_count, group_size);
+    detail::scal_batch(select_backend(queue), queue, n, alpha, x, incx, group_count, group_size);
+    scal_batch_postcondition(queue, n, alpha, x, incx, group_count, group_size);
+}
+
+static inline void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<double, 1> &alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    scal_batch_precondition(queue, n, alpha, x, incx, group_count, group_size);
+    detail::scal_batch(select_backend(queue), queue, n, alpha, x, incx, group_count, group_size);
+    scal_batch_postcondition(queue, n, alpha, x, incx, group_count, group_size);
+}
+
+static inline void scal_batch(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                              cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, std::int64_t batch_size) {
+    scal_batch_precondition(queue, n, alpha, x, incx, stride_x, batch_size);
+    detail::scal_batch(select_backend(queue), queue, n, alpha, x, incx, stride_x, batch_size);
+    scal_batch_postcondition(queue, n, alpha, x, incx, stride_x, batch_size);
+}
+
+static inline void scal_batch(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                              cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, std::int64_t batch_size) {
+    scal_batch_precondition(queue, n, alpha, x, incx, stride_x, batch_size);
+    detail::scal_batch(select_backend(queue), queue, n, alpha, x, incx, stride_x, batch_size);
+    scal_batch_postcondition(queue, n, alpha, x, incx, stride_x, batch_size);
+}
+
+static inline void scal_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, std::int64_t batch_size) {
+    scal_batch_precondition(queue, n, alpha, x, incx, stride_x, batch_size);
+    detail::scal_batch(select_backend(queue), queue, n, alpha, x, incx, stride_x, batch_size);
+    scal_batch_postcondition(queue, n, alpha, x, incx, stride_x, batch_size);
+}
+
+static inline void scal_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, std::int64_t batch_size) {
+    scal_batch_precondition(queue, n, alpha, x, incx, stride_x, batch_size);
+    detail::scal_batch(select_backend(queue), queue, n, alpha, x, incx, stride_x, batch_size);
+    scal_batch_postcondition(queue, n, alpha, x, incx, stride_x, batch_size);
+}
+
+static inline void scal_batch(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, std::int64_t batch_size) {
+    scal_batch_precondition(queue, n, alpha, x, incx, stride_x, batch_size);
+    detail::scal_batch(select_backend(queue), queue, n, alpha, x, incx, stride_x, batch_size);
+    scal_batch_postcondition(queue, n, alpha, x, incx, stride_x, batch_size);
+}
+
+static inline void scal_batch(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, std::int64_t batch_size) {
+    scal_batch_precondition(queue, n, alpha, x, incx, stride_x, batch_size);
+    detail::scal_batch(select_backend(queue), queue, n, alpha, x, incx, stride_x, batch_size);
+    scal_batch_postcondition(queue, n, alpha, x, incx, stride_x, batch_size);
+}
+
 static inline void sdsdot(cl::sycl::queue &queue, std::int64_t n, float sb,
                           cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                           cl::sycl::buffer<float, 1> &y, std::int64_t incy,
@@ -1114,6 +3652,132 @@ static inline void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose tran
     syrk_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
+static inline void syrk_batch(cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                              cl::sycl::buffer<transpose, 1> &trans,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::int64_t, 1> &k,
+                              cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    syrk_batch_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                            group_count, group_size);
+    detail::syrk_batch(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda, beta,
+                       c, ldc, group_count, group_size);
+    syrk_batch_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                             group_count, group_size);
+}
+
+static inline void syrk_batch(cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                              cl::sycl::buffer<transpose, 1> &trans,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::int64_t, 1> &k,
+                              cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    syrk_batch_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                            group_count, group_size);
+    detail::syrk_batch(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda, beta,
+                       c, ldc, group_count, group_size);
+    syrk_batch_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                             group_count, group_size);
+}
+
+static inline void syrk_batch(cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                              cl::sycl::buffer<transpose, 1> &trans,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::int64_t, 1> &k,
+                              cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<std::complex<float>, 1> &beta,
+                              cl::sycl::buffer<std::complex<float>, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    syrk_batch_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                            group_count, group_size);
+    detail::syrk_batch(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda, beta,
+                       c, ldc, group_count, group_size);
+    syrk_batch_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                             group_count, group_size);
+}
+
+static inline void syrk_batch(cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                              cl::sycl::buffer<transpose, 1> &trans,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::int64_t, 1> &k,
+                              cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<std::complex<double>, 1> &beta,
+                              cl::sycl::buffer<std::complex<double>, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    syrk_batch_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                            group_count, group_size);
+    detail::syrk_batch(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda, beta,
+                       c, ldc, group_count, group_size);
+    syrk_batch_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                             group_count, group_size);
+}
+
+static inline void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                              std::int64_t n, std::int64_t k, float alpha,
+                              cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, float beta, cl::sycl::buffer<float, 1> &c,
+                              std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    syrk_batch_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                            stride_c, batch_size);
+    detail::syrk_batch(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda,
+                       stride_a, beta, c, ldc, stride_c, batch_size);
+    syrk_batch_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                             stride_c, batch_size);
+}
+
+static inline void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                              std::int64_t n, std::int64_t k, double alpha,
+                              cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, double beta, cl::sycl::buffer<double, 1> &c,
+                              std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    syrk_batch_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                            stride_c, batch_size);
+    detail::syrk_batch(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda,
+                       stride_a, beta, c, ldc, stride_c, batch_size);
+    syrk_batch_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                             stride_c, batch_size);
+}
+
+static inline void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                              std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, std::complex<float> beta,
+                              cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size) {
+    syrk_batch_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                            stride_c, batch_size);
+    detail::syrk_batch(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda,
+                       stride_a, beta, c, ldc, stride_c, batch_size);
+    syrk_batch_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                             stride_c, batch_size);
+}
+
+static inline void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                              std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, std::complex<double> beta,
+                              cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size) {
+    syrk_batch_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                            stride_c, batch_size);
+    detail::syrk_batch(select_backend(queue), queue, upper_lower, trans, n, k, alpha, a, lda,
+                       stride_a, beta, c, ldc, stride_c, batch_size);
+    syrk_batch_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                             stride_c, batch_size);
+}
+
 static inline void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                         std::int64_t n, std::int64_t k, cl::sycl::buffer<float, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
@@ -1254,6 +3918,78 @@ static inline void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
     tpsv_postcondition(queue, upper_lower, trans, unit_diag, n, a, x, incx);
 }
 
+static inline void tpttr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                         cl::sycl::buffer<float, 1> &ap, cl::sycl::buffer<float, 1> &a,
+                         std::int64_t lda) {
+    tpttr_precondition(queue, upper_lower, n, ap, a, lda);
+    detail::tpttr(select_backend(queue), queue, upper_lower, n, ap, a, lda);
+    tpttr_postcondition(queue, upper_lower, n, ap, a, lda);
+}
+
+static inline void tpttr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                         cl::sycl::buffer<double, 1> &ap, cl::sycl::buffer<double, 1> &a,
+                         std::int64_t lda) {
+    tpttr_precondition(queue, upper_lower, n, ap, a, lda);
+    detail::tpttr(select_backend(queue), queue, upper_lower, n, ap, a, lda);
+    tpttr_postcondition(queue, upper_lower, n, ap, a, lda);
+}
+
+static inline void tpttr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                         cl::sycl::buffer<std::complex<float>, 1> &ap,
+                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
+    tpttr_precondition(queue, upper_lower, n, ap, a, lda);
+    detail::tpttr(select_backend(queue), queue, upper_lower, n, ap, a, lda);
+    tpttr_postcondition(queue, upper_lower, n, ap, a, lda);
+}
+
+static inline void tpttr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                         cl::sycl::buffer<std::complex<double>, 1> &ap,
+                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
+    tpttr_precondition(queue, upper_lower, n, ap, a, lda);
+    detail::tpttr(select_backend(queue), queue, upper_lower, n, ap, a, lda);
+    tpttr_postcondition(queue, upper_lower, n, ap, a, lda);
+}
+
+static inline void tpttr_batch(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                               cl::sycl::buffer<float, 1> &ap, std::int64_t stride_ap,
+                               cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                               std::int64_t stride_a, std::int64_t batch_size) {
+    tpttr_batch_precondition(queue, upper_lower, n, ap, stride_ap, a, lda, stride_a, batch_size);
+    detail::tpttr_batch(select_backend(queue), queue, upper_lower, n, ap, stride_ap, a, lda,
+                        stride_a, batch_size);
+    tpttr_batch_postcondition(queue, upper_lower, n, ap, stride_ap, a, lda, stride_a, batch_size);
+}
+
+static inline void tpttr_batch(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                               cl::sycl::buffer<double, 1> &ap, std::int64_t stride_ap,
+                               cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                               std::int64_t stride_a, std::int64_t batch_size) {
+    tpttr_batch_precondition(queue, upper_lower, n, ap, stride_ap, a, lda, stride_a, batch_size);
+    detail::tpttr_batch(select_backend(queue), queue, upper_lower, n, ap, stride_ap, a, lda,
+                        stride_a, batch_size);
+    tpttr_batch_postcondition(queue, upper_lower, n, ap, stride_ap, a, lda, stride_a, batch_size);
+}
+
+static inline void tpttr_batch(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                               cl::sycl::buffer<std::complex<float>, 1> &ap, std::int64_t stride_ap,
+                               cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                               std::int64_t stride_a, std::int64_t batch_size) {
+    tpttr_batch_precondition(queue, upper_lower, n, ap, stride_ap, a, lda, stride_a, batch_size);
+    detail::tpttr_batch(select_backend(queue), queue, upper_lower, n, ap, stride_ap, a, lda,
+                        stride_a, batch_size);
+    tpttr_batch_postcondition(queue, upper_lower, n, ap, stride_ap, a, lda, stride_a, batch_size);
+}
+
+static inline void tpttr_batch(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                               cl::sycl::buffer<std::complex<double>, 1> &ap,
+                               std::int64_t stride_ap, cl::sycl::buffer<std::complex<double>, 1> &a,
+                               std::int64_t lda, std::int64_t stride_a, std::int64_t batch_size) {
+    tpttr_batch_precondition(queue, upper_lower, n, ap, stride_ap, a, lda, stride_a, batch_size);
+    detail::tpttr_batch(select_backend(queue), queue, upper_lower, n, ap, stride_ap, a, lda,
+                        stride_a, batch_size);
+    tpttr_batch_postcondition(queue, upper_lower, n, ap, stride_ap, a, lda, stride_a, batch_size);
+}
+
 static inline void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
                         diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
                         cl::sycl::buffer<float, 1> &a, std::int64_t lda,
@@ -1384,6 +4120,155 @@ static inline void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lowe
                        ldb);
 }
 
+static inline void trsm_batch(cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                              cl::sycl::buffer<uplo, 1> &upper_lower,
+                              cl::sycl::buffer<transpose, 1> &trans,
+                              cl::sycl::buffer<diag, 1> &unit_diag,
+                              cl::sycl::buffer<std::int64_t, 1> &m,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<float, 1> &b,
+                              cl::sycl::buffer<std::int64_t, 1> &ldb, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            b, ldb, group_count, group_size);
+    detail::trsm_batch(select_backend(queue), queue, left_right, upper_lower, trans, unit_diag, m,
+                       n, alpha, a, lda, b, ldb, group_count, group_size);
+    trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             b, ldb, group_count, group_size);
+}
+
+static inline void trsm_batch(cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                              cl::sycl::buffer<uplo, 1> &upper_lower,
+                              cl::sycl::buffer<transpose, 1> &trans,
+                              cl::sycl::buffer<diag, 1> &unit_diag,
+                              cl::sycl::buffer<std::int64_t, 1> &m,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<double, 1> &b,
+                              cl::sycl::buffer<std::int64_t, 1> &ldb, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            b, ldb, group_count, group_size);
+    detail::trsm_batch(select_backend(queue), queue, left_right, upper_lower, trans, unit_diag, m,
+                       n, alpha, a, lda, b, ldb, group_count, group_size);
+    trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             b, ldb, group_count, group_size);
+}
+
+static inline void trsm_batch(
+    cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+    cl::sycl::buffer<uplo, 1> &upper_lower, cl::sycl::buffer<transpose, 1> &trans,
+    cl::sycl::buffer<diag, 1> &unit_diag, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::complex<float>, 1> &alpha,
+    cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<std::complex<float>, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            b, ldb, group_count, group_size);
+    detail::trsm_batch(select_backend(queue), queue, left_right, upper_lower, trans, unit_diag, m,
+                       n, alpha, a, lda, b, ldb, group_count, group_size);
+    trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             b, ldb, group_count, group_size);
+}
+
+static inline void trsm_batch(
+    cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+    cl::sycl::buffer<uplo, 1> &upper_lower, cl::sycl::buffer<transpose, 1> &trans,
+    cl::sycl::buffer<diag, 1> &unit_diag, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::complex<double>, 1> &alpha,
+    cl::sycl::buffer<std::complex<double>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<std::complex<double>, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            b, ldb, group_count, group_size);
+    detail::trsm_batch(select_backend(queue), queue, left_right, upper_lower, trans, unit_diag, m,
+                       n, alpha, a, lda, b, ldb, group_count, group_size);
+    trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             b, ldb, group_count, group_size);
+}
+
+static inline void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                              transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
+                              float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, cl::sycl::buffer<float, 1> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+    trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            stride_a, b, ldb, stride_b, batch_size);
+    detail::trsm_batch(select_backend(queue), queue, left_right, upper_lower, trans, unit_diag, m,
+                       n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
+    trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             stride_a, b, ldb, stride_b, batch_size);
+}
+
+static inline void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                              transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
+                              double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, cl::sycl::buffer<double, 1> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+    trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            stride_a, b, ldb, stride_b, batch_size);
+    detail::trsm_batch(select_backend(queue), queue, left_right, upper_lower, trans, unit_diag, m,
+                       n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
+    trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             stride_a, b, ldb, stride_b, batch_size);
+}
+
+static inline void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                              transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
+                              std::complex<float> alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+    trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            stride_a, b, ldb, stride_b, batch_size);
+    detail::trsm_batch(select_backend(queue), queue, left_right, upper_lower, trans, unit_diag, m,
+                       n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
+    trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             stride_a, b, ldb, stride_b, batch_size);
+}
+
+static inline void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                              transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
+                              std::complex<double> alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+    trsm_batch_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            stride_a, b, ldb, stride_b, batch_size);
+    detail::trsm_batch(select_backend(queue), queue, left_right, upper_lower, trans, unit_diag, m,
+                       n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
+    trsm_batch_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             stride_a, b, ldb, stride_b, batch_size);
+}
+
+static inline void trsm_compact(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                                transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
+                                float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                std::int64_t batch_size) {
+    trsm_compact_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                              b, ldb, batch_size);
+    detail::trsm_compact(select_backend(queue), queue, left_right, upper_lower, trans, unit_diag, m,
+                         n, alpha, a, lda, b, ldb, batch_size);
+    trsm_compact_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                               lda, b, ldb, batch_size);
+}
+
+static inline void trsm_compact(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                                transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
+                                double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                std::int64_t batch_size) {
+    trsm_compact_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                              b, ldb, batch_size);
+    detail::trsm_compact(select_backend(queue), queue, left_right, upper_lower, trans, unit_diag, m,
+                         n, alpha, a, lda, b, ldb, batch_size);
+    trsm_compact_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                               lda, b, ldb, batch_size);
+}
+
 static inline void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                         std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
@@ -1418,6 +4303,228 @@ static inline void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose tran
     trsv_postcondition(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
 }
 
+// Routines of the run-time API used by gemv_coalescer.
+struct rt_routines {
+    template <typename... Args>
+    static void gemm(Args &&... args) {
+        onemkl::blas::gemm(std::forward<Args>(args)...);
+    }
+    template <typename... Args>
+    static void gemv(Args &&... args) {
+        onemkl::blas::gemv(std::forward<Args>(args)...);
+    }
+    template <typename... Args>
+    static void ger(Args &&... args) {
+        onemkl::blas::ger(std::forward<Args>(args)...);
+    }
+    template <typename... Args>
+    static void copy(Args &&... args) {
+        onemkl::blas::copy(std::forward<Args>(args)...);
+    }
+    template <typename... Args>
+    static void scal(Args &&... args) {
+        onemkl::blas::scal(std::forward<Args>(args)...);
+    }
+    template <typename... Args>
+    static void axpy(Args &&... args) {
+        onemkl::blas::axpy(std::forward<Args>(args)...);
+    }
+};
+
+static inline void trttp(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                         cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                         cl::sycl::buffer<float, 1> &ap) {
+    trttp_precondition(queue, upper_lower, n, a, lda, ap);
+    detail::trttp(select_backend(queue), queue, upper_lower, n, a, lda, ap);
+    trttp_postcondition(queue, upper_lower, n, a, lda, ap);
+}
+
+static inline void trttp(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                         cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                         cl::sycl::buffer<double, 1> &ap) {
+    trttp_precondition(queue, upper_lower, n, a, lda, ap);
+    detail::trttp(select_backend(queue), queue, upper_lower, n, a, lda, ap);
+    trttp_postcondition(queue, upper_lower, n, a, lda, ap);
+}
+
+static inline void trttp(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                         cl::sycl::buffer<std::complex<float>, 1> &ap) {
+    trttp_precondition(queue, upper_lower, n, a, lda, ap);
+    detail::trttp(select_backend(queue), queue, upper_lower, n, a, lda, ap);
+    trttp_postcondition(queue, upper_lower, n, a, lda, ap);
+}
+
+static inline void trttp(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                         cl::sycl::buffer<std::complex<double>, 1> &ap) {
+    trttp_precondition(queue, upper_lower, n, a, lda, ap);
+    detail::trttp(select_backend(queue), queue, upper_lower, n, a, lda, ap);
+    trttp_postcondition(queue, upper_lower, n, a, lda, ap);
+}
+
+static inline void trttp_batch(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                               cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                               std::int64_t stride_a, cl::sycl::buffer<float, 1> &ap,
+                               std::int64_t stride_ap, std::int64_t batch_size) {
+    trttp_batch_precondition(queue, upper_lower, n, a, lda, stride_a, ap, stride_ap, batch_size);
+    detail::trttp_batch(select_backend(queue), queue, upper_lower, n, a, lda, stride_a, ap,
+                        stride_ap, batch_size);
+    trttp_batch_postcondition(queue, upper_lower, n, a, lda, stride_a, ap, stride_ap, batch_size);
+}
+
+static inline void trttp_batch(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                               cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                               std::int64_t stride_a, cl::sycl::buffer<double, 1> &ap,
+                               std::int64_t stride_ap, std::int64_t batch_size) {
+    trttp_batch_precondition(queue, upper_lower, n, a, lda, stride_a, ap, stride_ap, batch_size);
+    detail::trttp_batch(select_backend(queue), queue, upper_lower, n, a, lda, stride_a, ap,
+                        stride_ap, batch_size);
+    trttp_batch_postcondition(queue, upper_lower, n, a, lda, stride_a, ap, stride_ap, batch_size);
+}
+
+static inline void trttp_batch(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                               cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                               std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &ap,
+                               std::int64_t stride_ap, std::int64_t batch_size) {
+    trttp_batch_precondition(queue, upper_lower, n, a, lda, stride_a, ap, stride_ap, batch_size);
+    detail::trttp_batch(select_backend(queue), queue, upper_lower, n, a, lda, stride_a, ap,
+                        stride_ap, batch_size);
+    trttp_batch_postcondition(queue, upper_lower, n, a, lda, stride_a, ap, stride_ap, batch_size);
+}
+
+static inline void trttp_batch(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                               cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                               std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &ap,
+                               std::int64_t stride_ap, std::int64_t batch_size) {
+    trttp_batch_precondition(queue, upper_lower, n, a, lda, stride_a, ap, stride_ap, batch_size);
+    detail::trttp_batch(select_backend(queue), queue, upper_lower, n, a, lda, stride_a, ap,
+                        stride_ap, batch_size);
+    trttp_batch_postcondition(queue, upper_lower, n, a, lda, stride_a, ap, stride_ap, batch_size);
+}
+
+static inline void vclamp(cl::sycl::queue &queue, std::int64_t n, float lo, float hi,
+                          cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                          cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    vclamp_precondition(queue, n, lo, hi, x, incx, y, incy);
+    detail::vclamp(select_backend(queue), queue, n, lo, hi, x, incx, y, incy);
+    vclamp_postcondition(queue, n, lo, hi, x, incx, y, incy);
+}
+
+static inline void vclamp(cl::sycl::queue &queue, std::int64_t n, double lo, double hi,
+                          cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                          cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+    vclamp_precondition(queue, n, lo, hi, x, incx, y, incy);
+    detail::vclamp(select_backend(queue), queue, n, lo, hi, x, incx, y, incy);
+    vclamp_postcondition(queue, n, lo, hi, x, incx, y, incy);
+}
+
+static inline void vdiv(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                        std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                        cl::sycl::buffer<float, 1> &z, std::int64_t incz) {
+    vdiv_precondition(queue, n, x, incx, y, incy, z, incz);
+    detail::vdiv(select_backend(queue), queue, n, x, incx, y, incy, z, incz);
+    vdiv_postcondition(queue, n, x, incx, y, incy, z, incz);
+}
+
+static inline void vdiv(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                        std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                        cl::sycl::buffer<double, 1> &z, std::int64_t incz) {
+    vdiv_precondition(queue, n, x, incx, y, incy, z, incz);
+    detail::vdiv(select_backend(queue), queue, n, x, incx, y, incy, z, incz);
+    vdiv_postcondition(queue, n, x, incx, y, incy, z, incz);
+}
+
+static inline void vdiv(cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                        cl::sycl::buffer<std::complex<float>, 1> &z, std::int64_t incz) {
+    vdiv_precondition(queue, n, x, incx, y, incy, z, incz);
+    detail::vdiv(select_backend(queue), queue, n, x, incx, y, incy, z, incz);
+    vdiv_postcondition(queue, n, x, incx, y, incy, z, incz);
+}
+
+static inline void vdiv(cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                        cl::sycl::buffer<std::complex<double>, 1> &z, std::int64_t incz) {
+    vdiv_precondition(queue, n, x, incx, y, incy, z, incz);
+    detail::vdiv(select_backend(queue), queue, n, x, incx, y, incy, z, incz);
+    vdiv_postcondition(queue, n, x, incx, y, incy, z, incz);
+}
+
+static inline void vfma(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                        cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<float, 1> &y, std::int64_t incy, float beta,
+                        cl::sycl::buffer<float, 1> &z, std::int64_t incz) {
+    vfma_precondition(queue, n, alpha, x, incx, y, incy, beta, z, incz);
+    detail::vfma(select_backend(queue), queue, n, alpha, x, incx, y, incy, beta, z, incz);
+    vfma_postcondition(queue, n, alpha, x, incx, y, incy, beta, z, incz);
+}
+
+static inline void vfma(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                        cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<double, 1> &y, std::int64_t incy, double beta,
+                        cl::sycl::buffer<double, 1> &z, std::int64_t incz) {
+    vfma_precondition(queue, n, alpha, x, incx, y, incy, beta, z, incz);
+    detail::vfma(select_backend(queue), queue, n, alpha, x, incx, y, incy, beta, z, incz);
+    vfma_postcondition(queue, n, alpha, x, incx, y, incy, beta, z, incz);
+}
+
+static inline void vfma(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                        std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &z,
+                        std::int64_t incz) {
+    vfma_precondition(queue, n, alpha, x, incx, y, incy, beta, z, incz);
+    detail::vfma(select_backend(queue), queue, n, alpha, x, incx, y, incy, beta, z, incz);
+    vfma_postcondition(queue, n, alpha, x, incx, y, incy, beta, z, incz);
+}
+
+static inline void vfma(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                        std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &z,
+                        std::int64_t incz) {
+    vfma_precondition(queue, n, alpha, x, incx, y, incy, beta, z, incz);
+    detail::vfma(select_backend(queue), queue, n, alpha, x, incx, y, incy, beta, z, incz);
+    vfma_postcondition(queue, n, alpha, x, incx, y, incy, beta, z, incz);
+}
+
+static inline void vmul(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                        std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                        cl::sycl::buffer<float, 1> &z, std::int64_t incz) {
+    vmul_precondition(queue, n, x, incx, y, incy, z, incz);
+    detail::vmul(select_backend(queue), queue, n, x, incx, y, incy, z, incz);
+    vmul_postcondition(queue, n, x, incx, y, incy, z, incz);
+}
+
+static inline void vmul(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                        std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                        cl::sycl::buffer<double, 1> &z, std::int64_t incz) {
+    vmul_precondition(queue, n, x, incx, y, incy, z, incz);
+    detail::vmul(select_backend(queue), queue, n, x, incx, y, incy, z, incz);
+    vmul_postcondition(queue, n, x, incx, y, incy, z, incz);
+}
+
+static inline void vmul(cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                        cl::sycl::buffer<std::complex<float>, 1> &z, std::int64_t incz) {
+    vmul_precondition(queue, n, x, incx, y, incy, z, incz);
+    detail::vmul(select_backend(queue), queue, n, x, incx, y, incy, z, incz);
+    vmul_postcondition(queue, n, x, incx, y, incy, z, incz);
+}
+
+static inline void vmul(cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                        cl::sycl::buffer<std::complex<double>, 1> &z, std::int64_t incz) {
+    vmul_precondition(queue, n, x, incx, y, incy, z, incz);
+    detail::vmul(select_backend(queue), queue, n, x, incx, y, incy, z, incz);
+    vmul_postcondition(queue, n, x, incx, y, incy, z, incz);
+}
+
 } //namespace blas
 } //namespace onemkl
 
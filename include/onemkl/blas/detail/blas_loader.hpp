@@ -749,6 +749,1083 @@ void rotg(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::complex<f
 void rotg(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::complex<double>, 1> &a,
           cl::sycl::buffer<std::complex<double>, 1> &b, cl::sycl::buffer<double, 1> &c,
           cl::sycl::buffer<std::complex<double>, 1> &s);
+void convert(char *libname, cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<half, 1> &x,
+             cl::sycl::buffer<float, 1> &y);
+void convert(char *libname, cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+             cl::sycl::buffer<half, 1> &y);
+void convert(char *libname, cl::sycl::queue &queue, std::int64_t n,
+             cl::sycl::buffer<bfloat16, 1> &x, cl::sycl::buffer<float, 1> &y);
+void convert(char *libname, cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+             cl::sycl::buffer<bfloat16, 1> &y);
+void convert(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<half, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+             std::int64_t ldb);
+void convert(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<half, 1> &b,
+             std::int64_t ldb);
+void convert(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+             std::int64_t ldb);
+void convert(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<bfloat16, 1> &b,
+             std::int64_t ldb);
+void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+              offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+              cl::sycl::buffer<int16_t, 1> &a, std::int64_t lda, int16_t ao,
+              cl::sycl::buffer<int16_t, 1> &b, std::int64_t ldb, int16_t bo, float beta,
+              cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co);
+void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+              offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+              cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+              cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo, float beta,
+              cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co);
+void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+              offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+              cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
+              cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo, float beta,
+              cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co);
+void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+              offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+              cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo,
+              cl::sycl::buffer<float, 1> &scales, int8_t zc, cl::sycl::buffer<int8_t, 1> &c,
+              std::int64_t ldc);
+void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+              offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+              cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo,
+              cl::sycl::buffer<float, 1> &scales, uint8_t zc, cl::sycl::buffer<uint8_t, 1> &c,
+              std::int64_t ldc);
+void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+              offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+              cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+              cl::sycl::buffer<float, 1> &scales, int8_t zc, cl::sycl::buffer<int8_t, 1> &c,
+              std::int64_t ldc);
+void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+              offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+              cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+              cl::sycl::buffer<float, 1> &scales, uint8_t zc, cl::sycl::buffer<uint8_t, 1> &c,
+              std::int64_t ldc);
+void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+              offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
+              cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+              cl::sycl::buffer<float, 1> &scales, int8_t zc, cl::sycl::buffer<int8_t, 1> &c,
+              std::int64_t ldc);
+void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+              offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
+              cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+              cl::sycl::buffer<float, 1> &scales, uint8_t zc, cl::sycl::buffer<uint8_t, 1> &c,
+              std::int64_t ldc);
+void gemm_s8u8s32_compute(char *libname, cl::sycl::queue &queue, transpose transb, offset offsetc,
+                          std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                          cl::sycl::buffer<int8_t, 1> &packed_a, int8_t ao,
+                          cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo, float beta,
+                          cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                          cl::sycl::buffer<int32_t, 1> &co);
+void gemm_s8u8s32_compute(char *libname, cl::sycl::queue &queue, transpose transa, offset offsetc,
+                          std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                          cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+                          cl::sycl::buffer<uint8_t, 1> &packed_b, uint8_t bo, float beta,
+                          cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                          cl::sycl::buffer<int32_t, 1> &co);
+void gemm_s8u8s32_pack(char *libname, cl::sycl::queue &queue, transpose transa, std::int64_t m,
+                       std::int64_t n, std::int64_t k, cl::sycl::buffer<int8_t, 1> &a,
+                       std::int64_t lda, cl::sycl::buffer<int8_t, 1> &packed_a);
+void gemm_s8u8s32_pack(char *libname, cl::sycl::queue &queue, transpose transb, std::int64_t m,
+                       std::int64_t n, std::int64_t k, cl::sycl::buffer<uint8_t, 1> &b,
+                       std::int64_t ldb, cl::sycl::buffer<uint8_t, 1> &packed_b);
+std::int64_t gemm_s8u8s32_pack_get_size(char *libname, cl::sycl::queue &queue, identifier which,
+                                        std::int64_t m, std::int64_t n, std::int64_t k);
+void gemm_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+                cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                cl::sycl::buffer<float, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+                cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+                cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void gemm_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+                cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                cl::sycl::buffer<double, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+                cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<double, 1> &beta,
+                cl::sycl::buffer<double, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void gemm_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+                cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                cl::sycl::buffer<std::complex<float>, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+                cl::sycl::buffer<std::int64_t, 1> &offset_b,
+                cl::sycl::buffer<std::complex<float>, 1> &beta,
+                cl::sycl::buffer<std::complex<float>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void gemm_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+                cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                cl::sycl::buffer<std::complex<double>, 1> &b,
+                cl::sycl::buffer<std::int64_t, 1> &ldb, cl::sycl::buffer<std::int64_t, 1> &offset_b,
+                cl::sycl::buffer<std::complex<double>, 1> &beta,
+                cl::sycl::buffer<std::complex<double>, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, cl::sycl::buffer<std::int64_t, 1> &offset_c,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size);
+void herk_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<float, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void herk_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<double, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<double, 1> &beta,
+                cl::sycl::buffer<std::complex<double>, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void herk_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                std::int64_t n, std::int64_t k, float alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, float beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+                std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size);
+void herk_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                std::int64_t n, std::int64_t k, double alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, double beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+                std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size);
+void syrk_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<float, 1> &alpha,
+                cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void syrk_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<double, 1> &alpha,
+                cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void syrk_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<float>, 1> &beta,
+                cl::sycl::buffer<std::complex<float>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size);
+void syrk_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<double>, 1> &beta,
+                cl::sycl::buffer<std::complex<double>, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void syrk_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a,
+                std::int64_t lda, std::int64_t stride_a, float beta, cl::sycl::buffer<float, 1> &c,
+                std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size);
+void syrk_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                std::int64_t n, std::int64_t k, double alpha, cl::sycl::buffer<double, 1> &a,
+                std::int64_t lda, std::int64_t stride_a, double beta,
+                cl::sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                std::int64_t batch_size);
+void syrk_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, std::complex<float> beta,
+                cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size);
+void syrk_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, std::complex<double> beta,
+                cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size);
+void gemv_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<float, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<float, 1> &beta,
+                cl::sycl::buffer<float, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size);
+void gemv_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<double, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<double, 1> &beta,
+                cl::sycl::buffer<double, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size);
+void gemv_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<float>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<float>, 1> &beta,
+                cl::sycl::buffer<std::complex<float>, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void gemv_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<double>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<double>, 1> &beta,
+                cl::sycl::buffer<std::complex<double>, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void gemv_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                std::int64_t stride_y, std::int64_t batch_size);
+void gemv_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, double beta, cl::sycl::buffer<double, 1> &y,
+                std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size);
+void gemv_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                std::int64_t n, std::complex<float> alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &x,
+                std::int64_t incx, std::int64_t stride_x, std::complex<float> beta,
+                cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                std::int64_t stride_y, std::int64_t batch_size);
+void gemv_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                std::int64_t n, std::complex<double> alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &x,
+                std::int64_t incx, std::int64_t stride_x, std::complex<double> beta,
+                cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                std::int64_t stride_y, std::int64_t batch_size);
+void dgmm_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size);
+void dgmm_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<double, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<double, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size);
+void dgmm_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<float>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<float>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size);
+void dgmm_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<double>, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<double>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<double>, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void dgmm_batch(char *libname, cl::sycl::queue &queue, side left_right, std::int64_t m,
+                std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size);
+void dgmm_batch(char *libname, cl::sycl::queue &queue, side left_right, std::int64_t m,
+                std::int64_t n, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size);
+void dgmm_batch(char *libname, cl::sycl::queue &queue, side left_right, std::int64_t m,
+                std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &x,
+                std::int64_t incx, std::int64_t stride_x,
+                cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size);
+void dgmm_batch(char *libname, cl::sycl::queue &queue, side left_right, std::int64_t m,
+                std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &x,
+                std::int64_t incx, std::int64_t stride_x,
+                cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size);
+void axpy_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<float, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void axpy_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<double, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void axpy_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<float>, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void axpy_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<double>, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void axpy_batch(char *libname, cl::sycl::queue &queue, std::int64_t n, float alpha,
+                cl::sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stride_x,
+                cl::sycl::buffer<float, 1> &y, std::int64_t incy, std::int64_t stride_y,
+                std::int64_t batch_size);
+void axpy_batch(char *libname, cl::sycl::queue &queue, std::int64_t n, double alpha,
+                cl::sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stride_x,
+                cl::sycl::buffer<double, 1> &y, std::int64_t incy, std::int64_t stride_y,
+                std::int64_t batch_size);
+void axpy_batch(char *libname, cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, cl::sycl::buffer<std::complex<float>, 1> &y,
+                std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size);
+void axpy_batch(char *libname, cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, cl::sycl::buffer<std::complex<double>, 1> &y,
+                std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size);
+void copy_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<float, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size);
+void copy_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<double, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size);
+void copy_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<float>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<float>, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void copy_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<double>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<double>, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void copy_batch(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                cl::sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stride_x,
+                cl::sycl::buffer<float, 1> &y, std::int64_t incy, std::int64_t stride_y,
+                std::int64_t batch_size);
+void copy_batch(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                cl::sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stride_x,
+                cl::sycl::buffer<double, 1> &y, std::int64_t incy, std::int64_t stride_y,
+                std::int64_t batch_size);
+void copy_batch(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, cl::sycl::buffer<std::complex<float>, 1> &y,
+                std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size);
+void copy_batch(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, cl::sycl::buffer<std::complex<double>, 1> &y,
+                std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size);
+void dot_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+               cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+               cl::sycl::buffer<float, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+               cl::sycl::buffer<float, 1> &result, std::int64_t group_count,
+               cl::sycl::buffer<std::int64_t, 1> &group_size);
+void dot_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+               cl::sycl::buffer<double, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+               cl::sycl::buffer<double, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+               cl::sycl::buffer<double, 1> &result, std::int64_t group_count,
+               cl::sycl::buffer<std::int64_t, 1> &group_size);
+void dot_batch(char *libname, cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+               std::int64_t incx, std::int64_t stride_x, cl::sycl::buffer<float, 1> &y,
+               std::int64_t incy, std::int64_t stride_y, cl::sycl::buffer<float, 1> &result,
+               std::int64_t batch_size);
+void dot_batch(char *libname, cl::sycl::queue &queue, std::int64_t n,
+               cl::sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stride_x,
+               cl::sycl::buffer<double, 1> &y, std::int64_t incy, std::int64_t stride_y,
+               cl::sycl::buffer<double, 1> &result, std::int64_t batch_size);
+void scal_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void scal_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void scal_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void scal_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void scal_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void scal_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void scal_batch(char *libname, cl::sycl::queue &queue, std::int64_t n, float alpha,
+                cl::sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stride_x,
+                std::int64_t batch_size);
+void scal_batch(char *libname, cl::sycl::queue &queue, std::int64_t n, double alpha,
+                cl::sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stride_x,
+                std::int64_t batch_size);
+void scal_batch(char *libname, cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, std::int64_t batch_size);
+void scal_batch(char *libname, cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, std::int64_t batch_size);
+void scal_batch(char *libname, cl::sycl::queue &queue, std::int64_t n, float alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, std::int64_t batch_size);
+void scal_batch(char *libname, cl::sycl::queue &queue, std::int64_t n, double alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, std::int64_t batch_size);
+void gemm_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+                cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<half, 1> &alpha, cl::sycl::buffer<half, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                cl::sycl::buffer<half, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+                cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<half, 1> &beta,
+                cl::sycl::buffer<half, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void gemm_batch(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+                std::int64_t m, std::int64_t n, std::int64_t k, half alpha,
+                cl::sycl::buffer<half, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                cl::sycl::buffer<half, 1> &b, std::int64_t ldb, std::int64_t stride_b, half beta,
+                cl::sycl::buffer<half, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                std::int64_t batch_size);
+void gemm_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+                cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<half, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                cl::sycl::buffer<half, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+                cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+                cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void gemm_batch(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+                std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                cl::sycl::buffer<half, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                cl::sycl::buffer<half, 1> &b, std::int64_t ldb, std::int64_t stride_b, float beta,
+                cl::sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                std::int64_t batch_size);
+void gemm_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+                cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<int8_t, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                cl::sycl::buffer<uint8_t, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+                cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+                cl::sycl::buffer<int32_t, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size);
+void gemm_batch(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+                std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                float beta, cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size);
+void gepack_compact(char *libname, cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                    cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                    cl::sycl::buffer<float, 1> &ap, std::int64_t ldap, std::int64_t batch_size);
+void gepack_compact(char *libname, cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                    cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                    cl::sycl::buffer<double, 1> &ap, std::int64_t ldap, std::int64_t batch_size);
+void geunpack_compact(char *libname, cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                      cl::sycl::buffer<float, 1> &ap, std::int64_t ldap,
+                      cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                      std::int64_t batch_size);
+void geunpack_compact(char *libname, cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                      cl::sycl::buffer<double, 1> &ap, std::int64_t ldap,
+                      cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                      std::int64_t batch_size);
+void gemm_compact(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+                  std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                  cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+                  std::int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                  std::int64_t batch_size);
+void gemm_compact(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+                  std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                  cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+                  std::int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                  std::int64_t batch_size);
+void trsm_compact(char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                  transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
+                  cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+                  std::int64_t ldb, std::int64_t batch_size);
+void trsm_compact(char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                  transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
+                  cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+                  std::int64_t ldb, std::int64_t batch_size);
+void getrfnp_compact(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                     cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t batch_size);
+void getrfnp_compact(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                     cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t batch_size);
+void axpby(char *libname, cl::sycl::queue &queue, std::int64_t n, float alpha,
+           cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+           cl::sycl::buffer<float, 1> &y, std::int64_t incy);
+void axpby(char *libname, cl::sycl::queue &queue, std::int64_t n, double alpha,
+           cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+           cl::sycl::buffer<double, 1> &y, std::int64_t incy);
+void axpby(char *libname, cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::complex<float> beta,
+           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy);
+void axpby(char *libname, cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
+           std::int64_t incy);
+void imatcopy(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &ab, std::int64_t lda,
+              std::int64_t ldb);
+void imatcopy(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &ab, std::int64_t lda,
+              std::int64_t ldb);
+void imatcopy(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, std::complex<float> alpha,
+              cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t lda, std::int64_t ldb);
+void imatcopy(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, std::complex<double> alpha,
+              cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t lda, std::int64_t ldb);
+void omatadd(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+             std::int64_t m, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+             std::int64_t lda, float beta, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+void omatadd(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+             std::int64_t m, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+             std::int64_t lda, double beta, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
+void omatadd(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+             std::int64_t m, std::int64_t n, std::complex<float> alpha,
+             cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+             std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &b,
+             std::int64_t ldb, cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+void omatadd(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+             std::int64_t m, std::int64_t n, std::complex<double> alpha,
+             cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+             std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &b,
+             std::int64_t ldb, cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+void omatcopy(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<float, 1> &b, std::int64_t ldb);
+void omatcopy(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<double, 1> &b, std::int64_t ldb);
+void omatcopy(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, std::complex<float> alpha,
+              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb);
+void omatcopy(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, std::complex<double> alpha,
+              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb);
+void imatcopy_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                    std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &ab, std::int64_t lda,
+                    std::int64_t ldb, std::int64_t stride, std::int64_t batch_size);
+void imatcopy_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                    std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &ab, std::int64_t lda,
+                    std::int64_t ldb, std::int64_t stride, std::int64_t batch_size);
+void imatcopy_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                    std::int64_t n, std::complex<float> alpha,
+                    cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t lda,
+                    std::int64_t ldb, std::int64_t stride, std::int64_t batch_size);
+void imatcopy_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                    std::int64_t n, std::complex<double> alpha,
+                    cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t lda,
+                    std::int64_t ldb, std::int64_t stride, std::int64_t batch_size);
+void omatadd_batch(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+                   std::int64_t m, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                   std::int64_t lda, std::int64_t stride_a, float beta,
+                   cl::sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                   std::int64_t batch_size);
+void omatadd_batch(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+                   std::int64_t m, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+                   std::int64_t lda, std::int64_t stride_a, double beta,
+                   cl::sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                   std::int64_t batch_size);
+void omatadd_batch(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+                   std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                   cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, std::complex<float> beta,
+                   cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, cl::sycl::buffer<std::complex<float>, 1> &c,
+                   std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size);
+void omatadd_batch(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+                   std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                   cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, std::complex<double> beta,
+                   cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, cl::sycl::buffer<std::complex<double>, 1> &c,
+                   std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size);
+void omatcopy_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                    std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                    std::int64_t stride_b, std::int64_t batch_size);
+void omatcopy_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                    std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                    std::int64_t stride_b, std::int64_t batch_size);
+void omatcopy_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                    std::int64_t n, std::complex<float> alpha,
+                    cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size);
+void omatcopy_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                    std::int64_t n, std::complex<double> alpha,
+                    cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size);
+void asum(char *libname, cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+          std::int64_t incx, cl::sycl::buffer<float, 1> &result, accumulation acc);
+void dot(char *libname, cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+         std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+         cl::sycl::buffer<float, 1> &result, accumulation acc);
+void nrm2(char *libname, cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+          std::int64_t incx, cl::sycl::buffer<float, 1> &result, accumulation acc);
+void axpbypcz(char *libname, cl::sycl::queue &queue, std::int64_t n, float alpha,
+              cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+              cl::sycl::buffer<float, 1> &y, std::int64_t incy, float gamma,
+              cl::sycl::buffer<float, 1> &z, std::int64_t incz);
+void axpbypcz(char *libname, cl::sycl::queue &queue, std::int64_t n, double alpha,
+              cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+              cl::sycl::buffer<double, 1> &y, std::int64_t incy, double gamma,
+              cl::sycl::buffer<double, 1> &z, std::int64_t incz);
+void axpbypcz_dot(char *libname, cl::sycl::queue &queue, std::int64_t n, float alpha,
+                  cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                  cl::sycl::buffer<float, 1> &y, std::int64_t incy, float gamma,
+                  cl::sycl::buffer<float, 1> &z, std::int64_t incz, cl::sycl::buffer<float, 1> &w,
+                  std::int64_t incw, cl::sycl::buffer<float, 1> &result);
+void axpbypcz_dot(char *libname, cl::sycl::queue &queue, std::int64_t n, double alpha,
+                  cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                  cl::sycl::buffer<double, 1> &y, std::int64_t incy, double gamma,
+                  cl::sycl::buffer<double, 1> &z, std::int64_t incz, cl::sycl::buffer<double, 1> &w,
+                  std::int64_t incw, cl::sycl::buffer<double, 1> &result);
+cl::sycl::event asum(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                     cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, float *result);
+cl::sycl::event asum(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                     cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                     double *result);
+cl::sycl::event asum(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                     cl::sycl::buffer<float, 1> &x, std::int64_t incx, float *result);
+cl::sycl::event asum(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                     cl::sycl::buffer<double, 1> &x, std::int64_t incx, double *result);
+cl::sycl::event dot(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                    cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
+                    std::int64_t incy, float *result);
+cl::sycl::event dot(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                    cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                    cl::sycl::buffer<double, 1> &y, std::int64_t incy, double *result);
+cl::sycl::event dot(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                    cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
+                    std::int64_t incy, double *result);
+cl::sycl::event iamin(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                      cl::sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t *result);
+cl::sycl::event iamin(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                      cl::sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t *result);
+cl::sycl::event iamin(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                      cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                      std::int64_t *result);
+cl::sycl::event iamin(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                      cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                      std::int64_t *result);
+cl::sycl::event iamax(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                      cl::sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t *result);
+cl::sycl::event iamax(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                      cl::sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t *result);
+cl::sycl::event iamax(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                      cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                      std::int64_t *result);
+cl::sycl::event iamax(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                      cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                      std::int64_t *result);
+cl::sycl::event nrm2(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                     cl::sycl::buffer<float, 1> &x, std::int64_t incx, float *result);
+cl::sycl::event nrm2(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                     cl::sycl::buffer<double, 1> &x, std::int64_t incx, double *result);
+cl::sycl::event nrm2(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                     cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, float *result);
+cl::sycl::event nrm2(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                     cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                     double *result);
+void gbtge(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+           std::int64_t ku, cl::sycl::buffer<float, 1> &ab, std::int64_t ldab,
+           cl::sycl::buffer<float, 1> &a, std::int64_t lda);
+void gbtge(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+           std::int64_t ku, cl::sycl::buffer<double, 1> &ab, std::int64_t ldab,
+           cl::sycl::buffer<double, 1> &a, std::int64_t lda);
+void gbtge(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+           std::int64_t ku, cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t ldab,
+           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda);
+void gbtge(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+           std::int64_t ku, cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t ldab,
+           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda);
+void gettgb(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+            std::int64_t ku, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<float, 1> &ab, std::int64_t ldab);
+void gettgb(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+            std::int64_t ku, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<double, 1> &ab, std::int64_t ldab);
+void gettgb(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+            std::int64_t ku, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t ldab);
+void gettgb(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+            std::int64_t ku, cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t ldab);
+void tpttr(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<float, 1> &ap, cl::sycl::buffer<float, 1> &a, std::int64_t lda);
+void tpttr(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<double, 1> &ap, cl::sycl::buffer<double, 1> &a, std::int64_t lda);
+void tpttr(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<std::complex<float>, 1> &ap,
+           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda);
+void tpttr(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<std::complex<double>, 1> &ap,
+           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda);
+void trttp(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &ap);
+void trttp(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &ap);
+void trttp(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+           cl::sycl::buffer<std::complex<float>, 1> &ap);
+void trttp(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+           cl::sycl::buffer<std::complex<double>, 1> &ap);
+void gbtge_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                 std::int64_t kl, std::int64_t ku, cl::sycl::buffer<float, 1> &ab,
+                 std::int64_t ldab, std::int64_t stride_ab, cl::sycl::buffer<float, 1> &a,
+                 std::int64_t lda, std::int64_t stride_a, std::int64_t batch_size);
+void gbtge_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                 std::int64_t kl, std::int64_t ku, cl::sycl::buffer<double, 1> &ab,
+                 std::int64_t ldab, std::int64_t stride_ab, cl::sycl::buffer<double, 1> &a,
+                 std::int64_t lda, std::int64_t stride_a, std::int64_t batch_size);
+void gbtge_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                 std::int64_t kl, std::int64_t ku, cl::sycl::buffer<std::complex<float>, 1> &ab,
+                 std::int64_t ldab, std::int64_t stride_ab,
+                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                 std::int64_t stride_a, std::int64_t batch_size);
+void gbtge_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                 std::int64_t kl, std::int64_t ku, cl::sycl::buffer<std::complex<double>, 1> &ab,
+                 std::int64_t ldab, std::int64_t stride_ab,
+                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                 std::int64_t stride_a, std::int64_t batch_size);
+void gettgb_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                  std::int64_t kl, std::int64_t ku, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                  std::int64_t stride_a, cl::sycl::buffer<float, 1> &ab, std::int64_t ldab,
+                  std::int64_t stride_ab, std::int64_t batch_size);
+void gettgb_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                  std::int64_t kl, std::int64_t ku, cl::sycl::buffer<double, 1> &a,
+                  std::int64_t lda, std::int64_t stride_a, cl::sycl::buffer<double, 1> &ab,
+                  std::int64_t ldab, std::int64_t stride_ab, std::int64_t batch_size);
+void gettgb_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                  std::int64_t kl, std::int64_t ku, cl::sycl::buffer<std::complex<float>, 1> &a,
+                  std::int64_t lda, std::int64_t stride_a,
+                  cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t ldab,
+                  std::int64_t stride_ab, std::int64_t batch_size);
+void gettgb_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                  std::int64_t kl, std::int64_t ku, cl::sycl::buffer<std::complex<double>, 1> &a,
+                  std::int64_t lda, std::int64_t stride_a,
+                  cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t ldab,
+                  std::int64_t stride_ab, std::int64_t batch_size);
+void tpttr_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<float, 1> &ap, std::int64_t stride_ap,
+                 cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                 std::int64_t batch_size);
+void tpttr_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<double, 1> &ap, std::int64_t stride_ap,
+                 cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                 std::int64_t batch_size);
+void tpttr_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<std::complex<float>, 1> &ap, std::int64_t stride_ap,
+                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                 std::int64_t stride_a, std::int64_t batch_size);
+void tpttr_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<std::complex<double>, 1> &ap, std::int64_t stride_ap,
+                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                 std::int64_t stride_a, std::int64_t batch_size);
+void trttp_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                 cl::sycl::buffer<float, 1> &ap, std::int64_t stride_ap, std::int64_t batch_size);
+void trttp_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                 cl::sycl::buffer<double, 1> &ap, std::int64_t stride_ap, std::int64_t batch_size);
+void trttp_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                 std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &ap,
+                 std::int64_t stride_ap, std::int64_t batch_size);
+void trttp_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                 std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &ap,
+                 std::int64_t stride_ap, std::int64_t batch_size);
+void gemv(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+          float alpha, cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+          cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+          cl::sycl::buffer<float, 1> &y, std::int64_t incy);
+void gemv(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+          float alpha, cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+          cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+          cl::sycl::buffer<float, 1> &y, std::int64_t incy);
+void gemv_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                std::int64_t n, float alpha, cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                std::int64_t stride_y, std::int64_t batch_size);
+void gemv_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                std::int64_t n, float alpha, cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                std::int64_t stride_y, std::int64_t batch_size);
+void lange(char *libname, cl::sycl::queue &queue, norm_type norm, transpose trans, std::int64_t m,
+           std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+           cl::sycl::buffer<float, 1> &result);
+void lange(char *libname, cl::sycl::queue &queue, norm_type norm, transpose trans, std::int64_t m,
+           std::int64_t n, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+           cl::sycl::buffer<double, 1> &result);
+void reduce_columns(char *libname, cl::sycl::queue &queue, reduction op, transpose trans,
+                    std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                    cl::sycl::buffer<float, 1> &y, std::int64_t incy);
+void reduce_columns(char *libname, cl::sycl::queue &queue, reduction op, transpose trans,
+                    std::int64_t m, std::int64_t n, cl::sycl::buffer<double, 1> &a,
+                    std::int64_t lda, cl::sycl::buffer<double, 1> &y, std::int64_t incy);
+void reduce_rows(char *libname, cl::sycl::queue &queue, reduction op, transpose trans,
+                 std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                 cl::sycl::buffer<float, 1> &y, std::int64_t incy);
+void reduce_rows(char *libname, cl::sycl::queue &queue, reduction op, transpose trans,
+                 std::int64_t m, std::int64_t n, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                 cl::sycl::buffer<double, 1> &y, std::int64_t incy);
+void omatclamp(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float lo,
+               float hi, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+               cl::sycl::buffer<float, 1> &b, std::int64_t ldb);
+void omatclamp(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n, double lo,
+               double hi, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+               cl::sycl::buffer<double, 1> &b, std::int64_t ldb);
+void omatclamp_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                     float lo, float hi, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                     std::int64_t stride_a, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                     std::int64_t stride_b, std::int64_t batch_size);
+void omatclamp_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                     double lo, double hi, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                     std::int64_t stride_a, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                     std::int64_t stride_b, std::int64_t batch_size);
+void omatdiv(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+             std::int64_t ldb, cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+void omatdiv(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+             std::int64_t ldb, cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
+void omatdiv(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+             cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+void omatdiv(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+             cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+void omatdiv_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                   std::int64_t batch_size);
+void omatdiv_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                   std::int64_t batch_size);
+void omatdiv_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                   std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size);
+void omatdiv_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                   std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size);
+void omatfma(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float alpha,
+             cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+             std::int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+void omatfma(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n, double alpha,
+             cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+             std::int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
+void omatfma(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+             std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+             std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+             std::int64_t ldc);
+void omatfma(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+             std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+             std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+             std::int64_t ldc);
+void omatfma_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, float beta, cl::sycl::buffer<float, 1> &c,
+                   std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size);
+void omatfma_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, double beta, cl::sycl::buffer<double, 1> &c,
+                   std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size);
+void omatfma_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                   std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, std::complex<float> beta,
+                   cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size);
+void omatfma_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                   std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, std::complex<double> beta,
+                   cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size);
+void omatmul(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+             std::int64_t ldb, cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+void omatmul(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+             std::int64_t ldb, cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
+void omatmul(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+             cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+void omatmul(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+             cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+void omatmul_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                   std::int64_t batch_size);
+void omatmul_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                   std::int64_t batch_size);
+void omatmul_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                   std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size);
+void omatmul_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                   std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size);
+void vclamp(char *libname, cl::sycl::queue &queue, std::int64_t n, float lo, float hi,
+            cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
+            std::int64_t incy);
+void vclamp(char *libname, cl::sycl::queue &queue, std::int64_t n, double lo, double hi,
+            cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
+            std::int64_t incy);
+void vdiv(char *libname, cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+          std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+          cl::sycl::buffer<float, 1> &z, std::int64_t incz);
+void vdiv(char *libname, cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+          std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+          cl::sycl::buffer<double, 1> &z, std::int64_t incz);
+void vdiv(char *libname, cl::sycl::queue &queue, std::int64_t n,
+          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+          cl::sycl::buffer<std::complex<float>, 1> &z, std::int64_t incz);
+void vdiv(char *libname, cl::sycl::queue &queue, std::int64_t n,
+          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+          cl::sycl::buffer<std::complex<double>, 1> &z, std::int64_t incz);
+void vfma(char *libname, cl::sycl::queue &queue, std::int64_t n, float alpha,
+          cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
+          std::int64_t incy, float beta, cl::sycl::buffer<float, 1> &z, std::int64_t incz);
+void vfma(char *libname, cl::sycl::queue &queue, std::int64_t n, double alpha,
+          cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
+          std::int64_t incy, double beta, cl::sycl::buffer<double, 1> &z, std::int64_t incz);
+void vfma(char *libname, cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy, std::complex<float> beta,
+          cl::sycl::buffer<std::complex<float>, 1> &z, std::int64_t incz);
+void vfma(char *libname, cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+          std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &z,
+          std::int64_t incz);
+void vmul(char *libname, cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+          std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+          cl::sycl::buffer<float, 1> &z, std::int64_t incz);
+void vmul(char *libname, cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+          std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+          cl::sycl::buffer<double, 1> &z, std::int64_t incz);
+void vmul(char *libname, cl::sycl::queue &queue, std::int64_t n,
+          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+          cl::sycl::buffer<std::complex<float>, 1> &z, std::int64_t incz);
+void vmul(char *libname, cl::sycl::queue &queue, std::int64_t n,
+          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+          cl::sycl::buffer<std::complex<double>, 1> &z, std::int64_t incz);
+void gemm3m(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+            std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+            cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+            cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+void gemm3m(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+            std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+            cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+            std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+            std::int64_t ldc);
+void gemm3m_batch(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+                  std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                  cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                  std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                  std::int64_t ldb, std::int64_t stride_b, std::complex<float> beta,
+                  cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                  std::int64_t stride_c, std::int64_t batch_size);
+void gemm3m_batch(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+                  std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                  cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                  std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                  std::int64_t ldb, std::int64_t stride_b, std::complex<double> beta,
+                  cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                  std::int64_t stride_c, std::int64_t batch_size);
 } //namespace detail
 } //namespace blas
 } //namespace onemkl
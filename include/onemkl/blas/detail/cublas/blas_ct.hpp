@@ -3016,6 +3016,4656 @@ void symv<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, uplo uppe
     symv_postcondition(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
+template <onemkl::library lib, onemkl::backend backend>
+static inline void convert(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<half, 1> &x,
+                           cl::sycl::buffer<float, 1> &y);
+template <>
+void convert<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                  cl::sycl::buffer<half, 1> &x,
+                                                  cl::sycl::buffer<float, 1> &y) {
+    convert_precondition(queue, n, x, y);
+    onemkl::cublas::convert(queue, n, x, y);
+    convert_postcondition(queue, n, x, y);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void convert(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                           cl::sycl::buffer<half, 1> &y);
+template <>
+void convert<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                  cl::sycl::buffer<float, 1> &x,
+                                                  cl::sycl::buffer<half, 1> &y) {
+    convert_precondition(queue, n, x, y);
+    onemkl::cublas::convert(queue, n, x, y);
+    convert_postcondition(queue, n, x, y);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void convert(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<bfloat16, 1> &x,
+                           cl::sycl::buffer<float, 1> &y);
+template <>
+void convert<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                  cl::sycl::buffer<bfloat16, 1> &x,
+                                                  cl::sycl::buffer<float, 1> &y) {
+    convert_precondition(queue, n, x, y);
+    onemkl::cublas::convert(queue, n, x, y);
+    convert_postcondition(queue, n, x, y);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void convert(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                           cl::sycl::buffer<bfloat16, 1> &y);
+template <>
+void convert<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                  cl::sycl::buffer<float, 1> &x,
+                                                  cl::sycl::buffer<bfloat16, 1> &y) {
+    convert_precondition(queue, n, x, y);
+    onemkl::cublas::convert(queue, n, x, y);
+    convert_postcondition(queue, n, x, y);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void convert(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<float, 1> &b, std::int64_t ldb);
+template <>
+void convert<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                  std::int64_t n, cl::sycl::buffer<half, 1> &a,
+                                                  std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+                                                  std::int64_t ldb) {
+    convert_precondition(queue, m, n, a, lda, b, ldb);
+    onemkl::cublas::convert(queue, m, n, a, lda, b, ldb);
+    convert_postcondition(queue, m, n, a, lda, b, ldb);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void convert(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<half, 1> &b, std::int64_t ldb);
+template <>
+void convert<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                  std::int64_t n, cl::sycl::buffer<float, 1> &a,
+                                                  std::int64_t lda, cl::sycl::buffer<half, 1> &b,
+                                                  std::int64_t ldb) {
+    convert_precondition(queue, m, n, a, lda, b, ldb);
+    onemkl::cublas::convert(queue, m, n, a, lda, b, ldb);
+    convert_postcondition(queue, m, n, a, lda, b, ldb);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void convert(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<float, 1> &b, std::int64_t ldb);
+template <>
+void convert<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                  std::int64_t n, cl::sycl::buffer<bfloat16, 1> &a,
+                                                  std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+                                                  std::int64_t ldb) {
+    convert_precondition(queue, m, n, a, lda, b, ldb);
+    onemkl::cublas::convert(queue, m, n, a, lda, b, ldb);
+    convert_postcondition(queue, m, n, a, lda, b, ldb);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void convert(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<bfloat16, 1> &b, std::int64_t ldb);
+template <>
+void convert<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                  std::int64_t n, cl::sycl::buffer<float, 1> &a,
+                                                  std::int64_t lda,
+                                                  cl::sycl::buffer<bfloat16, 1> &b,
+                                                  std::int64_t ldb) {
+    convert_precondition(queue, m, n, a, lda, b, ldb);
+    onemkl::cublas::convert(queue, m, n, a, lda, b, ldb);
+    convert_postcondition(queue, m, n, a, lda, b, ldb);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k,
+                            float alpha, cl::sycl::buffer<int16_t, 1> &a, std::int64_t lda,
+                            int16_t ao, cl::sycl::buffer<int16_t, 1> &b, std::int64_t ldb,
+                            int16_t bo, float beta, cl::sycl::buffer<int32_t, 1> &c,
+                            std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co);
+template <>
+void gemm_ext<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, offset offsetc, std::int64_t m,
+    std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<int16_t, 1> &a, std::int64_t lda,
+    int16_t ao, cl::sycl::buffer<int16_t, 1> &b, std::int64_t ldb, int16_t bo, float beta,
+    cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+    gemm_ext_precondition(queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                          beta, c, ldc, co);
+    onemkl::cublas::gemm_ext(queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                             beta, c, ldc, co);
+    gemm_ext_postcondition(queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                           beta, c, ldc, co);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k,
+                            float alpha, cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda,
+                            int8_t ao, cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+                            float beta, cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                            cl::sycl::buffer<int32_t, 1> &co);
+template <>
+void gemm_ext<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, offset offsetc, std::int64_t m,
+    std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda,
+    int8_t ao, cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo, float beta,
+    cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+    gemm_ext_precondition(queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                          beta, c, ldc, co);
+    onemkl::cublas::gemm_ext(queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                             beta, c, ldc, co);
+    gemm_ext_postcondition(queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                           beta, c, ldc, co);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k,
+                            float alpha, cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda,
+                            uint8_t ao, cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+                            float beta, cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                            cl::sycl::buffer<int32_t, 1> &co);
+template <>
+void gemm_ext<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, offset offsetc, std::int64_t m,
+    std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda,
+    uint8_t ao, cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo, float beta,
+    cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+    gemm_ext_precondition(queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                          beta, c, ldc, co);
+    onemkl::cublas::gemm_ext(queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                             beta, c, ldc, co);
+    gemm_ext_postcondition(queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                           beta, c, ldc, co);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+                            cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+                            cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo,
+                            cl::sycl::buffer<float, 1> &scales, int8_t zc,
+                            cl::sycl::buffer<int8_t, 1> &c, std::int64_t ldc);
+template <>
+void gemm_ext<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, transpose transa,
+                                                   transpose transb, offset scalec, std::int64_t m,
+                                                   std::int64_t n, std::int64_t k,
+                                                   cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda,
+                                                   int8_t ao, cl::sycl::buffer<uint8_t, 1> &b,
+                                                   std::int64_t ldb, uint8_t bo,
+                                                   cl::sycl::buffer<float, 1> &scales, int8_t zc,
+                                                   cl::sycl::buffer<int8_t, 1> &c,
+                                                   std::int64_t ldc) {
+    gemm_ext_precondition(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                          zc, c, ldc);
+    onemkl::cublas::gemm_ext(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                             zc, c, ldc);
+    gemm_ext_postcondition(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                           zc, c, ldc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+                            cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+                            cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo,
+                            cl::sycl::buffer<float, 1> &scales, uint8_t zc,
+                            cl::sycl::buffer<uint8_t, 1> &c, std::int64_t ldc);
+template <>
+void gemm_ext<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, transpose transa,
+                                                   transpose transb, offset scalec, std::int64_t m,
+                                                   std::int64_t n, std::int64_t k,
+                                                   cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda,
+                                                   int8_t ao, cl::sycl::buffer<uint8_t, 1> &b,
+                                                   std::int64_t ldb, uint8_t bo,
+                                                   cl::sycl::buffer<float, 1> &scales, uint8_t zc,
+                                                   cl::sycl::buffer<uint8_t, 1> &c,
+                                                   std::int64_t ldc) {
+    gemm_ext_precondition(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                          zc, c, ldc);
+    onemkl::cublas::gemm_ext(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                             zc, c, ldc);
+    gemm_ext_postcondition(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                           zc, c, ldc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+                            cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+                            cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+                            cl::sycl::buffer<float, 1> &scales, int8_t zc,
+                            cl::sycl::buffer<int8_t, 1> &c, std::int64_t ldc);
+template <>
+void gemm_ext<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, offset scalec, std::int64_t m,
+    std::int64_t n, std::int64_t k, cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+    cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo, cl::sycl::buffer<float, 1> &scales,
+    int8_t zc, cl::sycl::buffer<int8_t, 1> &c, std::int64_t ldc) {
+    gemm_ext_precondition(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                          zc, c, ldc);
+    onemkl::cublas::gemm_ext(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                             zc, c, ldc);
+    gemm_ext_postcondition(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                           zc, c, ldc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+                            cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+                            cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+                            cl::sycl::buffer<float, 1> &scales, uint8_t zc,
+                            cl::sycl::buffer<uint8_t, 1> &c, std::int64_t ldc);
+template <>
+void gemm_ext<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, offset scalec, std::int64_t m,
+    std::int64_t n, std::int64_t k, cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+    cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo, cl::sycl::buffer<float, 1> &scales,
+    uint8_t zc, cl::sycl::buffer<uint8_t, 1> &c, std::int64_t ldc) {
+    gemm_ext_precondition(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                          zc, c, ldc);
+    onemkl::cublas::gemm_ext(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                             zc, c, ldc);
+    gemm_ext_postcondition(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                           zc, c, ldc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+                            cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
+                            cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+                            cl::sycl::buffer<float, 1> &scales, int8_t zc,
+                            cl::sycl::buffer<int8_t, 1> &c, std::int64_t ldc);
+template <>
+void gemm_ext<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, offset scalec, std::int64_t m,
+    std::int64_t n, std::int64_t k, cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
+    cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo, cl::sycl::buffer<float, 1> &scales,
+    int8_t zc, cl::sycl::buffer<int8_t, 1> &c, std::int64_t ldc) {
+    gemm_ext_precondition(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                          zc, c, ldc);
+    onemkl::cublas::gemm_ext(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                             zc, c, ldc);
+    gemm_ext_postcondition(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                           zc, c, ldc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb,
+                            offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+                            cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
+                            cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+                            cl::sycl::buffer<float, 1> &scales, uint8_t zc,
+                            cl::sycl::buffer<uint8_t, 1> &c, std::int64_t ldc);
+template <>
+void gemm_ext<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, offset scalec, std::int64_t m,
+    std::int64_t n, std::int64_t k, cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
+    cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo, cl::sycl::buffer<float, 1> &scales,
+    uint8_t zc, cl::sycl::buffer<uint8_t, 1> &c, std::int64_t ldc) {
+    gemm_ext_precondition(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                          zc, c, ldc);
+    onemkl::cublas::gemm_ext(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                             zc, c, ldc);
+    gemm_ext_postcondition(queue, transa, transb, scalec, m, n, k, a, lda, ao, b, ldb, bo, scales,
+                           zc, c, ldc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_s8u8s32_compute(cl::sycl::queue &queue, transpose transb, offset offsetc,
+                                        std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                        cl::sycl::buffer<int8_t, 1> &packed_a, int8_t ao,
+                                        cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb,
+                                        uint8_t bo, float beta, cl::sycl::buffer<int32_t, 1> &c,
+                                        std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co);
+template <>
+void gemm_s8u8s32_compute<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transb, offset offsetc, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, cl::sycl::buffer<int8_t, 1> &packed_a, int8_t ao,
+    cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo, float beta,
+    cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+    gemm_s8u8s32_compute_precondition(queue, transb, offsetc, m, n, k, alpha, packed_a, ao, b, ldb,
+                                      bo, beta, c, ldc, co);
+    onemkl::cublas::gemm_s8u8s32_compute(queue, transb, offsetc, m, n, k, alpha, packed_a, ao, b,
+                                         ldb, bo, beta, c, ldc, co);
+    gemm_s8u8s32_compute_postcondition(queue, transb, offsetc, m, n, k, alpha, packed_a, ao, b, ldb,
+                                       bo, beta, c, ldc, co);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_s8u8s32_compute(cl::sycl::queue &queue, transpose transa, offset offsetc,
+                                        std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                        cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+                                        cl::sycl::buffer<uint8_t, 1> &packed_b, uint8_t bo,
+                                        float beta, cl::sycl::buffer<int32_t, 1> &c,
+                                        std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co);
+template <>
+void gemm_s8u8s32_compute<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, offset offsetc, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+    cl::sycl::buffer<uint8_t, 1> &packed_b, uint8_t bo, float beta, cl::sycl::buffer<int32_t, 1> &c,
+    std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+    gemm_s8u8s32_compute_precondition(queue, transa, offsetc, m, n, k, alpha, a, lda, ao, packed_b,
+                                      bo, beta, c, ldc, co);
+    onemkl::cublas::gemm_s8u8s32_compute(queue, transa, offsetc, m, n, k, alpha, a, lda, ao,
+                                         packed_b, bo, beta, c, ldc, co);
+    gemm_s8u8s32_compute_postcondition(queue, transa, offsetc, m, n, k, alpha, a, lda, ao, packed_b,
+                                       bo, beta, c, ldc, co);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_s8u8s32_pack(cl::sycl::queue &queue, transpose transa, std::int64_t m,
+                                     std::int64_t n, std::int64_t k, cl::sycl::buffer<int8_t, 1> &a,
+                                     std::int64_t lda, cl::sycl::buffer<int8_t, 1> &packed_a);
+template <>
+void gemm_s8u8s32_pack<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue,
+                                                            transpose transa, std::int64_t m,
+                                                            std::int64_t n, std::int64_t k,
+                                                            cl::sycl::buffer<int8_t, 1> &a,
+                                                            std::int64_t lda,
+                                                            cl::sycl::buffer<int8_t, 1> &packed_a) {
+    gemm_s8u8s32_pack_precondition(queue, transa, m, n, k, a, lda, packed_a);
+    onemkl::cublas::gemm_s8u8s32_pack(queue, transa, m, n, k, a, lda, packed_a);
+    gemm_s8u8s32_pack_postcondition(queue, transa, m, n, k, a, lda, packed_a);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_s8u8s32_pack(cl::sycl::queue &queue, transpose transb, std::int64_t m,
+                                     std::int64_t n, std::int64_t k,
+                                     cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb,
+                                     cl::sycl::buffer<uint8_t, 1> &packed_b);
+template <>
+void gemm_s8u8s32_pack<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+    cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, cl::sycl::buffer<uint8_t, 1> &packed_b) {
+    gemm_s8u8s32_pack_precondition(queue, transb, m, n, k, b, ldb, packed_b);
+    onemkl::cublas::gemm_s8u8s32_pack(queue, transb, m, n, k, b, ldb, packed_b);
+    gemm_s8u8s32_pack_postcondition(queue, transb, m, n, k, b, ldb, packed_b);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline std::int64_t gemm_s8u8s32_pack_get_size(cl::sycl::queue &queue, identifier which,
+                                                      std::int64_t m, std::int64_t n,
+                                                      std::int64_t k);
+template <>
+std::int64_t gemm_s8u8s32_pack_get_size<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue,
+                                                                             identifier which,
+                                                                             std::int64_t m,
+                                                                             std::int64_t n,
+                                                                             std::int64_t k) {
+    gemm_s8u8s32_pack_get_size_precondition(queue, which, m, n, k);
+    auto res = onemkl::cublas::gemm_s8u8s32_pack_get_size(queue, which, m, n, k);
+    gemm_s8u8s32_pack_get_size_postcondition(queue, which, m, n, k);
+    return res;
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                              cl::sycl::buffer<transpose, 1> &transb,
+                              cl::sycl::buffer<std::int64_t, 1> &m,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::int64_t, 1> &k,
+                              cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                              cl::sycl::buffer<float, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+                              cl::sycl::buffer<std::int64_t, 1> &offset_b,
+                              cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc,
+                              cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void gemm_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<float, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+    cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                            offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    onemkl::cublas::gemm_batch(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                               offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                             offset_b, beta, c, ldc, offset_c, group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_batch(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<double, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<double, 1> &beta,
+    cl::sycl::buffer<double, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void gemm_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<double, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<double, 1> &beta,
+    cl::sycl::buffer<double, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                            offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    onemkl::cublas::gemm_batch(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                               offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                             offset_b, beta, c, ldc, offset_c, group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_batch(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<std::complex<float>, 1> &alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<std::complex<float>, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<std::complex<float>, 1> &beta,
+    cl::sycl::buffer<std::complex<float>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void gemm_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<std::complex<float>, 1> &alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<std::complex<float>, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<std::complex<float>, 1> &beta,
+    cl::sycl::buffer<std::complex<float>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                            offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    onemkl::cublas::gemm_batch(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                               offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                             offset_b, beta, c, ldc, offset_c, group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_batch(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<std::complex<double>, 1> &alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<std::complex<double>, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<std::complex<double>, 1> &beta,
+    cl::sycl::buffer<std::complex<double>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void gemm_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<std::complex<double>, 1> &alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<std::complex<double>, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<std::complex<double>, 1> &beta,
+    cl::sycl::buffer<std::complex<double>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                            offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    onemkl::cublas::gemm_batch(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                               offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                             offset_b, beta, c, ldc, offset_c, group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void herk_batch(cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                              cl::sycl::buffer<transpose, 1> &trans,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::int64_t, 1> &k,
+                              cl::sycl::buffer<float, 1> &alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<float, 1> &beta,
+                              cl::sycl::buffer<std::complex<float>, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void herk_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+    cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<float, 1> &alpha,
+    cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+    cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    herk_batch_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                            group_count, group_size);
+    onemkl::cublas::herk_batch(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                               group_count, group_size);
+    herk_batch_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                             group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void herk_batch(cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                              cl::sycl::buffer<transpose, 1> &trans,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::int64_t, 1> &k,
+                              cl::sycl::buffer<double, 1> &alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<double, 1> &beta,
+                              cl::sycl::buffer<std::complex<double>, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void herk_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+    cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<double, 1> &alpha,
+    cl::sycl::buffer<std::complex<double>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+    cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    herk_batch_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                            group_count, group_size);
+    onemkl::cublas::herk_batch(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                               group_count, group_size);
+    herk_batch_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                             group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void herk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                              std::int64_t n, std::int64_t k, float alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, float beta,
+                              cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void herk_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+    float alpha, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+    std::int64_t stride_a, float beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    herk_batch_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                            stride_c, batch_size);
+    onemkl::cublas::herk_batch(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                               ldc, stride_c, batch_size);
+    herk_batch_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                             stride_c, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void herk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                              std::int64_t n, std::int64_t k, double alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, double beta,
+                              cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void herk_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+    double alpha, cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+    std::int64_t stride_a, double beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    herk_batch_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                            stride_c, batch_size);
+    onemkl::cublas::herk_batch(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                               ldc, stride_c, batch_size);
+    herk_batch_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                             stride_c, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void syrk_batch(cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                              cl::sycl::buffer<transpose, 1> &trans,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::int64_t, 1> &k,
+                              cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void syrk_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+    cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<float, 1> &alpha,
+    cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &c,
+    cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    syrk_batch_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                            group_count, group_size);
+    onemkl::cublas::syrk_batch(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                               group_count, group_size);
+    syrk_batch_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                             group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void syrk_batch(cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                              cl::sycl::buffer<transpose, 1> &trans,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::int64_t, 1> &k,
+                              cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void syrk_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+    cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<double, 1> &alpha,
+    cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &c,
+    cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    syrk_batch_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                            group_count, group_size);
+    onemkl::cublas::syrk_batch(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                               group_count, group_size);
+    syrk_batch_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                             group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void syrk_batch(cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                              cl::sycl::buffer<transpose, 1> &trans,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::int64_t, 1> &k,
+                              cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<std::complex<float>, 1> &beta,
+                              cl::sycl::buffer<std::complex<float>, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void syrk_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+    cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<std::complex<float>, 1> &alpha,
+    cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<std::complex<float>, 1> &beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+    cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    syrk_batch_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                            group_count, group_size);
+    onemkl::cublas::syrk_batch(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                               group_count, group_size);
+    syrk_batch_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                             group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void syrk_batch(cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                              cl::sycl::buffer<transpose, 1> &trans,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::int64_t, 1> &k,
+                              cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<std::complex<double>, 1> &beta,
+                              cl::sycl::buffer<std::complex<double>, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void syrk_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+    cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<std::complex<double>, 1> &alpha,
+    cl::sycl::buffer<std::complex<double>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<std::complex<double>, 1> &beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+    cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    syrk_batch_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                            group_count, group_size);
+    onemkl::cublas::syrk_batch(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                               group_count, group_size);
+    syrk_batch_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                             group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                              std::int64_t n, std::int64_t k, float alpha,
+                              cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, float beta, cl::sycl::buffer<float, 1> &c,
+                              std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void syrk_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, uplo upper_lower,
+                                                     transpose trans, std::int64_t n,
+                                                     std::int64_t k, float alpha,
+                                                     cl::sycl::buffer<float, 1> &a,
+                                                     std::int64_t lda, std::int64_t stride_a,
+                                                     float beta, cl::sycl::buffer<float, 1> &c,
+                                                     std::int64_t ldc, std::int64_t stride_c,
+                                                     std::int64_t batch_size) {
+    syrk_batch_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                            stride_c, batch_size);
+    onemkl::cublas::syrk_batch(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                               ldc, stride_c, batch_size);
+    syrk_batch_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                             stride_c, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                              std::int64_t n, std::int64_t k, double alpha,
+                              cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, double beta, cl::sycl::buffer<double, 1> &c,
+                              std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void syrk_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, uplo upper_lower,
+                                                     transpose trans, std::int64_t n,
+                                                     std::int64_t k, double alpha,
+                                                     cl::sycl::buffer<double, 1> &a,
+                                                     std::int64_t lda, std::int64_t stride_a,
+                                                     double beta, cl::sycl::buffer<double, 1> &c,
+                                                     std::int64_t ldc, std::int64_t stride_c,
+                                                     std::int64_t batch_size) {
+    syrk_batch_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                            stride_c, batch_size);
+    onemkl::cublas::syrk_batch(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                               ldc, stride_c, batch_size);
+    syrk_batch_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                             stride_c, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                              std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, std::complex<float> beta,
+                              cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void syrk_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+    std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    syrk_batch_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                            stride_c, batch_size);
+    onemkl::cublas::syrk_batch(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                               ldc, stride_c, batch_size);
+    syrk_batch_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                             stride_c, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                              std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, std::complex<double> beta,
+                              cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void syrk_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+    std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    syrk_batch_precondition(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                            stride_c, batch_size);
+    onemkl::cublas::syrk_batch(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                               ldc, stride_c, batch_size);
+    syrk_batch_postcondition(queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                             stride_c, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemv_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+                              cl::sycl::buffer<std::int64_t, 1> &m,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<float, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &y,
+                              cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void gemv_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<float, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<float, 1> &beta,
+    cl::sycl::buffer<float, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemv_batch_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                            group_size);
+    onemkl::cublas::gemv_batch(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                               group_count, group_size);
+    gemv_batch_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                             group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemv_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+                              cl::sycl::buffer<std::int64_t, 1> &m,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<double, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &y,
+                              cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void gemv_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<double, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<double, 1> &beta,
+    cl::sycl::buffer<double, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemv_batch_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                            group_size);
+    onemkl::cublas::gemv_batch(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                               group_count, group_size);
+    gemv_batch_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                             group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemv_batch(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::complex<float>, 1> &alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::complex<float>, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<std::complex<float>, 1> &beta,
+    cl::sycl::buffer<std::complex<float>, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void gemv_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::complex<float>, 1> &alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::complex<float>, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<std::complex<float>, 1> &beta,
+    cl::sycl::buffer<std::complex<float>, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemv_batch_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                            group_size);
+    onemkl::cublas::gemv_batch(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                               group_count, group_size);
+    gemv_batch_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                             group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemv_batch(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::complex<double>, 1> &alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::complex<double>, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<std::complex<double>, 1> &beta,
+    cl::sycl::buffer<std::complex<double>, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void gemv_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::complex<double>, 1> &alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::complex<double>, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<std::complex<double>, 1> &beta,
+    cl::sycl::buffer<std::complex<double>, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemv_batch_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                            group_size);
+    onemkl::cublas::gemv_batch(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                               group_count, group_size);
+    gemv_batch_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                             group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemv_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                              std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                              std::int64_t lda, std::int64_t stride_a,
+                              cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, float beta, cl::sycl::buffer<float, 1> &y,
+                              std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size);
+template <>
+void gemv_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, transpose trans,
+                                                     std::int64_t m, std::int64_t n, float alpha,
+                                                     cl::sycl::buffer<float, 1> &a,
+                                                     std::int64_t lda, std::int64_t stride_a,
+                                                     cl::sycl::buffer<float, 1> &x,
+                                                     std::int64_t incx, std::int64_t stride_x,
+                                                     float beta, cl::sycl::buffer<float, 1> &y,
+                                                     std::int64_t incy, std::int64_t stride_y,
+                                                     std::int64_t batch_size) {
+    gemv_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta, y,
+                            incy, stride_y, batch_size);
+    onemkl::cublas::gemv_batch(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta,
+                               y, incy, stride_y, batch_size);
+    gemv_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta,
+                             y, incy, stride_y, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemv_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                              std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+                              std::int64_t lda, std::int64_t stride_a,
+                              cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, double beta, cl::sycl::buffer<double, 1> &y,
+                              std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size);
+template <>
+void gemv_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, transpose trans,
+                                                     std::int64_t m, std::int64_t n, double alpha,
+                                                     cl::sycl::buffer<double, 1> &a,
+                                                     std::int64_t lda, std::int64_t stride_a,
+                                                     cl::sycl::buffer<double, 1> &x,
+                                                     std::int64_t incx, std::int64_t stride_x,
+                                                     double beta, cl::sycl::buffer<double, 1> &y,
+                                                     std::int64_t incy, std::int64_t stride_y,
+                                                     std::int64_t batch_size) {
+    gemv_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta, y,
+                            incy, stride_y, batch_size);
+    onemkl::cublas::gemv_batch(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta,
+                               y, incy, stride_y, batch_size);
+    gemv_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta,
+                             y, incy, stride_y, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemv_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                              std::int64_t n, std::complex<float> alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &x,
+                              std::int64_t incx, std::int64_t stride_x, std::complex<float> beta,
+                              cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                              std::int64_t stride_y, std::int64_t batch_size);
+template <>
+void gemv_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+    std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+    std::int64_t stride_x, std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
+    std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    gemv_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta, y,
+                            incy, stride_y, batch_size);
+    onemkl::cublas::gemv_batch(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta,
+                               y, incy, stride_y, batch_size);
+    gemv_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta,
+                             y, incy, stride_y, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemv_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                              std::int64_t n, std::complex<double> alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &x,
+                              std::int64_t incx, std::int64_t stride_x, std::complex<double> beta,
+                              cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                              std::int64_t stride_y, std::int64_t batch_size);
+template <>
+void gemv_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+    std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+    std::int64_t stride_x, std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
+    std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    gemv_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta, y,
+                            incy, stride_y, batch_size);
+    onemkl::cublas::gemv_batch(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta,
+                               y, incy, stride_y, batch_size);
+    gemv_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta,
+                             y, incy, stride_y, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void dgmm_batch(cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                              cl::sycl::buffer<std::int64_t, 1> &m,
+                              cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<float, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<float, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                              std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void dgmm_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+    cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    dgmm_batch_precondition(queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                            group_size);
+    onemkl::cublas::dgmm_batch(queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                               group_size);
+    dgmm_batch_postcondition(queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                             group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void dgmm_batch(cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                              cl::sycl::buffer<std::int64_t, 1> &m,
+                              cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<double, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<double, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<double, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void dgmm_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<double, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+    cl::sycl::buffer<double, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    dgmm_batch_precondition(queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                            group_size);
+    onemkl::cublas::dgmm_batch(queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                               group_size);
+    dgmm_batch_postcondition(queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                             group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void dgmm_batch(cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                              cl::sycl::buffer<std::int64_t, 1> &m,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::complex<float>, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<std::complex<float>, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<std::complex<float>, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void dgmm_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<std::complex<float>, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+    cl::sycl::buffer<std::complex<float>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    dgmm_batch_precondition(queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                            group_size);
+    onemkl::cublas::dgmm_batch(queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                               group_size);
+    dgmm_batch_postcondition(queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                             group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void dgmm_batch(cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                              cl::sycl::buffer<std::int64_t, 1> &m,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::complex<double>, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<std::complex<double>, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<std::complex<double>, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void dgmm_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::complex<double>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<std::complex<double>, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+    cl::sycl::buffer<std::complex<double>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    dgmm_batch_precondition(queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                            group_size);
+    onemkl::cublas::dgmm_batch(queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                               group_size);
+    dgmm_batch_postcondition(queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                             group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void dgmm_batch(cl::sycl::queue &queue, side left_right, std::int64_t m,
+                              std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, cl::sycl::buffer<float, 1> &x,
+                              std::int64_t incx, std::int64_t stride_x,
+                              cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void dgmm_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, side left_right,
+                                                     std::int64_t m, std::int64_t n,
+                                                     cl::sycl::buffer<float, 1> &a,
+                                                     std::int64_t lda, std::int64_t stride_a,
+                                                     cl::sycl::buffer<float, 1> &x,
+                                                     std::int64_t incx, std::int64_t stride_x,
+                                                     cl::sycl::buffer<float, 1> &c,
+                                                     std::int64_t ldc, std::int64_t stride_c,
+                                                     std::int64_t batch_size) {
+    dgmm_batch_precondition(queue, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                            stride_c, batch_size);
+    onemkl::cublas::dgmm_batch(queue, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                               stride_c, batch_size);
+    dgmm_batch_postcondition(queue, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                             stride_c, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void dgmm_batch(cl::sycl::queue &queue, side left_right, std::int64_t m,
+                              std::int64_t n, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, cl::sycl::buffer<double, 1> &x,
+                              std::int64_t incx, std::int64_t stride_x,
+                              cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void dgmm_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, side left_right,
+                                                     std::int64_t m, std::int64_t n,
+                                                     cl::sycl::buffer<double, 1> &a,
+                                                     std::int64_t lda, std::int64_t stride_a,
+                                                     cl::sycl::buffer<double, 1> &x,
+                                                     std::int64_t incx, std::int64_t stride_x,
+                                                     cl::sycl::buffer<double, 1> &c,
+                                                     std::int64_t ldc, std::int64_t stride_c,
+                                                     std::int64_t batch_size) {
+    dgmm_batch_precondition(queue, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                            stride_c, batch_size);
+    onemkl::cublas::dgmm_batch(queue, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                               stride_c, batch_size);
+    dgmm_batch_postcondition(queue, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                             stride_c, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void dgmm_batch(cl::sycl::queue &queue, side left_right, std::int64_t m,
+                              std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
+                              std::int64_t lda, std::int64_t stride_a,
+                              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, cl::sycl::buffer<std::complex<float>, 1> &c,
+                              std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void dgmm_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, side left_right,
+                                                     std::int64_t m, std::int64_t n,
+                                                     cl::sycl::buffer<std::complex<float>, 1> &a,
+                                                     std::int64_t lda, std::int64_t stride_a,
+                                                     cl::sycl::buffer<std::complex<float>, 1> &x,
+                                                     std::int64_t incx, std::int64_t stride_x,
+                                                     cl::sycl::buffer<std::complex<float>, 1> &c,
+                                                     std::int64_t ldc, std::int64_t stride_c,
+                                                     std::int64_t batch_size) {
+    dgmm_batch_precondition(queue, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                            stride_c, batch_size);
+    onemkl::cublas::dgmm_batch(queue, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                               stride_c, batch_size);
+    dgmm_batch_postcondition(queue, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                             stride_c, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void dgmm_batch(cl::sycl::queue &queue, side left_right, std::int64_t m,
+                              std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &a,
+                              std::int64_t lda, std::int64_t stride_a,
+                              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, cl::sycl::buffer<std::complex<double>, 1> &c,
+                              std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void dgmm_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, side left_right,
+                                                     std::int64_t m, std::int64_t n,
+                                                     cl::sycl::buffer<std::complex<double>, 1> &a,
+                                                     std::int64_t lda, std::int64_t stride_a,
+                                                     cl::sycl::buffer<std::complex<double>, 1> &x,
+                                                     std::int64_t incx, std::int64_t stride_x,
+                                                     cl::sycl::buffer<std::complex<double>, 1> &c,
+                                                     std::int64_t ldc, std::int64_t stride_c,
+                                                     std::int64_t batch_size) {
+    dgmm_batch_precondition(queue, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                            stride_c, batch_size);
+    onemkl::cublas::dgmm_batch(queue, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                               stride_c, batch_size);
+    dgmm_batch_postcondition(queue, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                             stride_c, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void axpy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<float, 1> &y,
+                              cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void axpy_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<float, 1> &alpha,
+    cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+    cl::sycl::buffer<float, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, y, incy, group_count, group_size);
+    onemkl::cublas::axpy_batch(queue, n, alpha, x, incx, y, incy, group_count, group_size);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, y, incy, group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void axpy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<double, 1> &y,
+                              cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void axpy_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<double, 1> &y,
+    cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, y, incy, group_count, group_size);
+    onemkl::cublas::axpy_batch(queue, n, alpha, x, incx, y, incy, group_count, group_size);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, y, incy, group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void axpy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<std::complex<float>, 1> &y,
+                              cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void axpy_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::complex<float>, 1> &alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<std::complex<float>, 1> &y,
+    cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, y, incy, group_count, group_size);
+    onemkl::cublas::axpy_batch(queue, n, alpha, x, incx, y, incy, group_count, group_size);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, y, incy, group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void axpy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<std::complex<double>, 1> &y,
+                              cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void axpy_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::complex<double>, 1> &alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<std::complex<double>, 1> &y,
+    cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, y, incy, group_count, group_size);
+    onemkl::cublas::axpy_batch(queue, n, alpha, x, incx, y, incy, group_count, group_size);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, y, incy, group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void axpy_batch(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                              cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, cl::sycl::buffer<float, 1> &y,
+                              std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size);
+template <>
+void axpy_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                     float alpha, cl::sycl::buffer<float, 1> &x,
+                                                     std::int64_t incx, std::int64_t stride_x,
+                                                     cl::sycl::buffer<float, 1> &y,
+                                                     std::int64_t incy, std::int64_t stride_y,
+                                                     std::int64_t batch_size) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, stride_x, y, incy, stride_y, batch_size);
+    onemkl::cublas::axpy_batch(queue, n, alpha, x, incx, stride_x, y, incy, stride_y, batch_size);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, stride_x, y, incy, stride_y, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void axpy_batch(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                              cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, cl::sycl::buffer<double, 1> &y,
+                              std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size);
+template <>
+void axpy_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                     double alpha, cl::sycl::buffer<double, 1> &x,
+                                                     std::int64_t incx, std::int64_t stride_x,
+                                                     cl::sycl::buffer<double, 1> &y,
+                                                     std::int64_t incy, std::int64_t stride_y,
+                                                     std::int64_t batch_size) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, stride_x, y, incy, stride_y, batch_size);
+    onemkl::cublas::axpy_batch(queue, n, alpha, x, incx, stride_x, y, incy, stride_y, batch_size);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, stride_x, y, incy, stride_y, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void axpy_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, cl::sycl::buffer<std::complex<float>, 1> &y,
+                              std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size);
+template <>
+void axpy_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                     std::complex<float> alpha,
+                                                     cl::sycl::buffer<std::complex<float>, 1> &x,
+                                                     std::int64_t incx, std::int64_t stride_x,
+                                                     cl::sycl::buffer<std::complex<float>, 1> &y,
+                                                     std::int64_t incy, std::int64_t stride_y,
+                                                     std::int64_t batch_size) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, stride_x, y, incy, stride_y, batch_size);
+    onemkl::cublas::axpy_batch(queue, n, alpha, x, incx, stride_x, y, incy, stride_y, batch_size);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, stride_x, y, incy, stride_y, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void axpy_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, cl::sycl::buffer<std::complex<double>, 1> &y,
+                              std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size);
+template <>
+void axpy_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                     std::complex<double> alpha,
+                                                     cl::sycl::buffer<std::complex<double>, 1> &x,
+                                                     std::int64_t incx, std::int64_t stride_x,
+                                                     cl::sycl::buffer<std::complex<double>, 1> &y,
+                                                     std::int64_t incy, std::int64_t stride_y,
+                                                     std::int64_t batch_size) {
+    axpy_batch_precondition(queue, n, alpha, x, incx, stride_x, y, incy, stride_y, batch_size);
+    onemkl::cublas::axpy_batch(queue, n, alpha, x, incx, stride_x, y, incy, stride_y, batch_size);
+    axpy_batch_postcondition(queue, n, alpha, x, incx, stride_x, y, incy, stride_y, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void copy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<float, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<float, 1> &y,
+                              cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void copy_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<float, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<float, 1> &y,
+    cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    copy_batch_precondition(queue, n, x, incx, y, incy, group_count, group_size);
+    onemkl::cublas::copy_batch(queue, n, x, incx, y, incy, group_count, group_size);
+    copy_batch_postcondition(queue, n, x, incx, y, incy, group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void copy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<double, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<double, 1> &y,
+                              cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void copy_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<double, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<double, 1> &y,
+    cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    copy_batch_precondition(queue, n, x, incx, y, incy, group_count, group_size);
+    onemkl::cublas::copy_batch(queue, n, x, incx, y, incy, group_count, group_size);
+    copy_batch_postcondition(queue, n, x, incx, y, incy, group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void copy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::complex<float>, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<std::complex<float>, 1> &y,
+                              cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void copy_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::complex<float>, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+    cl::sycl::buffer<std::complex<float>, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    copy_batch_precondition(queue, n, x, incx, y, incy, group_count, group_size);
+    onemkl::cublas::copy_batch(queue, n, x, incx, y, incy, group_count, group_size);
+    copy_batch_postcondition(queue, n, x, incx, y, incy, group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void copy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::complex<double>, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx,
+                              cl::sycl::buffer<std::complex<double>, 1> &y,
+                              cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void copy_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::complex<double>, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+    cl::sycl::buffer<std::complex<double>, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    copy_batch_precondition(queue, n, x, incx, y, incy, group_count, group_size);
+    onemkl::cublas::copy_batch(queue, n, x, incx, y, incy, group_count, group_size);
+    copy_batch_postcondition(queue, n, x, incx, y, incy, group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void copy_batch(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                              std::int64_t incx, std::int64_t stride_x,
+                              cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                              std::int64_t stride_y, std::int64_t batch_size);
+template <>
+void copy_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                     cl::sycl::buffer<float, 1> &x,
+                                                     std::int64_t incx, std::int64_t stride_x,
+                                                     cl::sycl::buffer<float, 1> &y,
+                                                     std::int64_t incy, std::int64_t stride_y,
+                                                     std::int64_t batch_size) {
+    copy_batch_precondition(queue, n, x, incx, stride_x, y, incy, stride_y, batch_size);
+    onemkl::cublas::copy_batch(queue, n, x, incx, stride_x, y, incy, stride_y, batch_size);
+    copy_batch_postcondition(queue, n, x, incx, stride_x, y, incy, stride_y, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void copy_batch(cl::sycl::queue &queue, std::int64_t n,
+                              cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, cl::sycl::buffer<double, 1> &y,
+                              std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size);
+template <>
+void copy_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                     cl::sycl::buffer<double, 1> &x,
+                                                     std::int64_t incx, std::int64_t stride_x,
+                                                     cl::sycl::buffer<double, 1> &y,
+                                                     std::int64_t incy, std::int64_t stride_y,
+                                                     std::int64_t batch_size) {
+    copy_batch_precondition(queue, n, x, incx, stride_x, y, incy, stride_y, batch_size);
+    onemkl::cublas::copy_batch(queue, n, x, incx, stride_x, y, incy, stride_y, batch_size);
+    copy_batch_postcondition(queue, n, x, incx, stride_x, y, incy, stride_y, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void copy_batch(cl::sycl::queue &queue, std::int64_t n,
+                              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, cl::sycl::buffer<std::complex<float>, 1> &y,
+                              std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size);
+template <>
+void copy_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                     cl::sycl::buffer<std::complex<float>, 1> &x,
+                                                     std::int64_t incx, std::int64_t stride_x,
+                                                     cl::sycl::buffer<std::complex<float>, 1> &y,
+                                                     std::int64_t incy, std::int64_t stride_y,
+                                                     std::int64_t batch_size) {
+    copy_batch_precondition(queue, n, x, incx, stride_x, y, incy, stride_y, batch_size);
+    onemkl::cublas::copy_batch(queue, n, x, incx, stride_x, y, incy, stride_y, batch_size);
+    copy_batch_postcondition(queue, n, x, incx, stride_x, y, incy, stride_y, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void copy_batch(cl::sycl::queue &queue, std::int64_t n,
+                              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, cl::sycl::buffer<std::complex<double>, 1> &y,
+                              std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size);
+template <>
+void copy_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                     cl::sycl::buffer<std::complex<double>, 1> &x,
+                                                     std::int64_t incx, std::int64_t stride_x,
+                                                     cl::sycl::buffer<std::complex<double>, 1> &y,
+                                                     std::int64_t incy, std::int64_t stride_y,
+                                                     std::int64_t batch_size) {
+    copy_batch_precondition(queue, n, x, incx, stride_x, y, incy, stride_y, batch_size);
+    onemkl::cublas::copy_batch(queue, n, x, incx, stride_x, y, incy, stride_y, batch_size);
+    copy_batch_postcondition(queue, n, x, incx, stride_x, y, incy, stride_y, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void dot_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                             cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+                             cl::sycl::buffer<float, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+                             cl::sycl::buffer<float, 1> &result, std::int64_t group_count,
+                             cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void dot_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<float, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<float, 1> &y,
+    cl::sycl::buffer<std::int64_t, 1> &incy, cl::sycl::buffer<float, 1> &result,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    dot_batch_precondition(queue, n, x, incx, y, incy, result, group_count, group_size);
+    onemkl::cublas::dot_batch(queue, n, x, incx, y, incy, result, group_count, group_size);
+    dot_batch_postcondition(queue, n, x, incx, y, incy, result, group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void dot_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                             cl::sycl::buffer<double, 1> &x,
+                             cl::sycl::buffer<std::int64_t, 1> &incx,
+                             cl::sycl::buffer<double, 1> &y,
+                             cl::sycl::buffer<std::int64_t, 1> &incy,
+                             cl::sycl::buffer<double, 1> &result, std::int64_t group_count,
+                             cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void dot_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<double, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<double, 1> &y,
+    cl::sycl::buffer<std::int64_t, 1> &incy, cl::sycl::buffer<double, 1> &result,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    dot_batch_precondition(queue, n, x, incx, y, incy, result, group_count, group_size);
+    onemkl::cublas::dot_batch(queue, n, x, incx, y, incy, result, group_count, group_size);
+    dot_batch_postcondition(queue, n, x, incx, y, incy, result, group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void dot_batch(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                             std::int64_t incx, std::int64_t stride_x,
+                             cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                             std::int64_t stride_y, cl::sycl::buffer<float, 1> &result,
+                             std::int64_t batch_size);
+template <>
+void dot_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                    cl::sycl::buffer<float, 1> &x,
+                                                    std::int64_t incx, std::int64_t stride_x,
+                                                    cl::sycl::buffer<float, 1> &y,
+                                                    std::int64_t incy, std::int64_t stride_y,
+                                                    cl::sycl::buffer<float, 1> &result,
+                                                    std::int64_t batch_size) {
+    dot_batch_precondition(queue, n, x, incx, stride_x, y, incy, stride_y, result, batch_size);
+    onemkl::cublas::dot_batch(queue, n, x, incx, stride_x, y, incy, stride_y, result, batch_size);
+    dot_batch_postcondition(queue, n, x, incx, stride_x, y, incy, stride_y, result, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void dot_batch(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                             std::int64_t incx, std::int64_t stride_x,
+                             cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                             std::int64_t stride_y, cl::sycl::buffer<double, 1> &result,
+                             std::int64_t batch_size);
+template <>
+void dot_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                    cl::sycl::buffer<double, 1> &x,
+                                                    std::int64_t incx, std::int64_t stride_x,
+                                                    cl::sycl::buffer<double, 1> &y,
+                                                    std::int64_t incy, std::int64_t stride_y,
+                                                    cl::sycl::buffer<double, 1> &result,
+                                                    std::int64_t batch_size) {
+    dot_batch_precondition(queue, n, x, incx, stride_x, y, incy, stride_y, result, batch_size);
+    onemkl::cublas::dot_batch(queue, n, x, incx, stride_x, y, incy, stride_y, result, batch_size);
+    dot_batch_postcondition(queue, n, x, incx, stride_x, y, incy, stride_y, result, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void scal_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<float, 1> &alpha,
+    cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    scal_batch_precondition(queue, n, alpha, x, incx, group_count, group_size);
+    onemkl::cublas::scal_batch(queue, n, alpha, x, incx, group_count, group_size);
+    scal_batch_postcondition(queue, n, alpha, x, incx, group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void scal_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    scal_batch_precondition(queue, n, alpha, x, incx, group_count, group_size);
+    onemkl::cublas::scal_batch(queue, n, alpha, x, incx, group_count, group_size);
+    scal_batch_postcondition(queue, n, alpha, x, incx, group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void scal_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::complex<float>, 1> &alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    scal_batch_precondition(queue, n, alpha, x, incx, group_count, group_size);
+    onemkl::cublas::scal_batch(queue, n, alpha, x, incx, group_count, group_size);
+    scal_batch_postcondition(queue, n, alpha, x, incx, group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void scal_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::complex<double>, 1> &alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    scal_batch_precondition(queue, n, alpha, x, incx, group_count, group_size);
+    onemkl::cublas::scal_batch(queue, n, alpha, x, incx, group_count, group_size);
+    scal_batch_postcondition(queue, n, alpha, x, incx, group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<float, 1> &alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void scal_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<float, 1> &alpha,
+    cl::sycl::buffer<std::complex<float>, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    scal_batch_precondition(queue, n, alpha, x, incx, group_count, group_size);
+    onemkl::cublas::scal_batch(queue, n, alpha, x, incx, group_count, group_size);
+    scal_batch_postcondition(queue, n, alpha, x, incx, group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<double, 1> &alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &x,
+                              cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void scal_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    scal_batch_precondition(queue, n, alpha, x, incx, group_count, group_size);
+    onemkl::cublas::scal_batch(queue, n, alpha, x, incx, group_count, group_size);
+    scal_batch_postcondition(queue, n, alpha, x, incx, group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void scal_batch(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                              cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, std::int64_t batch_size);
+template <>
+void scal_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                     float alpha, cl::sycl::buffer<float, 1> &x,
+                                                     std::int64_t incx, std::int64_t stride_x,
+                                                     std::int64_t batch_size) {
+    scal_batch_precondition(queue, n, alpha, x, incx, stride_x, batch_size);
+    onemkl::cublas::scal_batch(queue, n, alpha, x, incx, stride_x, batch_size);
+    scal_batch_postcondition(queue, n, alpha, x, incx, stride_x, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void scal_batch(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                              cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, std::int64_t batch_size);
+template <>
+void scal_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                     double alpha, cl::sycl::buffer<double, 1> &x,
+                                                     std::int64_t incx, std::int64_t stride_x,
+                                                     std::int64_t batch_size) {
+    scal_batch_precondition(queue, n, alpha, x, incx, stride_x, batch_size);
+    onemkl::cublas::scal_batch(queue, n, alpha, x, incx, stride_x, batch_size);
+    scal_batch_postcondition(queue, n, alpha, x, incx, stride_x, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void scal_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, std::int64_t batch_size);
+template <>
+void scal_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                     std::complex<float> alpha,
+                                                     cl::sycl::buffer<std::complex<float>, 1> &x,
+                                                     std::int64_t incx, std::int64_t stride_x,
+                                                     std::int64_t batch_size) {
+    scal_batch_precondition(queue, n, alpha, x, incx, stride_x, batch_size);
+    onemkl::cublas::scal_batch(queue, n, alpha, x, incx, stride_x, batch_size);
+    scal_batch_postcondition(queue, n, alpha, x, incx, stride_x, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void scal_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, std::int64_t batch_size);
+template <>
+void scal_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                     std::complex<double> alpha,
+                                                     cl::sycl::buffer<std::complex<double>, 1> &x,
+                                                     std::int64_t incx, std::int64_t stride_x,
+                                                     std::int64_t batch_size) {
+    scal_batch_precondition(queue, n, alpha, x, incx, stride_x, batch_size);
+    onemkl::cublas::scal_batch(queue, n, alpha, x, incx, stride_x, batch_size);
+    scal_batch_postcondition(queue, n, alpha, x, incx, stride_x, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void scal_batch(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, std::int64_t batch_size);
+template <>
+void scal_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                     float alpha,
+                                                     cl::sycl::buffer<std::complex<float>, 1> &x,
+                                                     std::int64_t incx, std::int64_t stride_x,
+                                                     std::int64_t batch_size) {
+    scal_batch_precondition(queue, n, alpha, x, incx, stride_x, batch_size);
+    onemkl::cublas::scal_batch(queue, n, alpha, x, incx, stride_x, batch_size);
+    scal_batch_postcondition(queue, n, alpha, x, incx, stride_x, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void scal_batch(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, std::int64_t batch_size);
+template <>
+void scal_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                     double alpha,
+                                                     cl::sycl::buffer<std::complex<double>, 1> &x,
+                                                     std::int64_t incx, std::int64_t stride_x,
+                                                     std::int64_t batch_size) {
+    scal_batch_precondition(queue, n, alpha, x, incx, stride_x, batch_size);
+    onemkl::cublas::scal_batch(queue, n, alpha, x, incx, stride_x, batch_size);
+    scal_batch_postcondition(queue, n, alpha, x, incx, stride_x, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                              cl::sycl::buffer<transpose, 1> &transb,
+                              cl::sycl::buffer<std::int64_t, 1> &m,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::int64_t, 1> &k,
+                              cl::sycl::buffer<half, 1> &alpha, cl::sycl::buffer<half, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                              cl::sycl::buffer<half, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+                              cl::sycl::buffer<std::int64_t, 1> &offset_b,
+                              cl::sycl::buffer<half, 1> &beta, cl::sycl::buffer<half, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc,
+                              cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void gemm_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<half, 1> &alpha, cl::sycl::buffer<half, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<half, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<half, 1> &beta,
+    cl::sycl::buffer<half, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                            offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    onemkl::cublas::gemm_batch(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                               offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                             offset_b, beta, c, ldc, offset_c, group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                              std::int64_t m, std::int64_t n, std::int64_t k, half alpha,
+                              cl::sycl::buffer<half, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                              cl::sycl::buffer<half, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                              half beta, cl::sycl::buffer<half, 1> &c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void gemm_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, half alpha, cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+    std::int64_t stride_a, cl::sycl::buffer<half, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+    half beta, cl::sycl::buffer<half, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                            stride_b, beta, c, ldc, stride_c, batch_size);
+    onemkl::cublas::gemm_batch(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                             stride_b, beta, c, ldc, stride_c, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                              cl::sycl::buffer<transpose, 1> &transb,
+                              cl::sycl::buffer<std::int64_t, 1> &m,
+                              cl::sycl::buffer<std::int64_t, 1> &n,
+                              cl::sycl::buffer<std::int64_t, 1> &k,
+                              cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<half, 1> &a,
+                              cl::sycl::buffer<std::int64_t, 1> &lda,
+                              cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                              cl::sycl::buffer<half, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+                              cl::sycl::buffer<std::int64_t, 1> &offset_b,
+                              cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &c,
+                              cl::sycl::buffer<std::int64_t, 1> &ldc,
+                              cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+                              cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void gemm_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<half, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<half, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+    cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                            offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    onemkl::cublas::gemm_batch(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                               offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                             offset_b, beta, c, ldc, offset_c, group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                              std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                              cl::sycl::buffer<half, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                              cl::sycl::buffer<half, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                              float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void gemm_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+    std::int64_t stride_a, cl::sycl::buffer<half, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+    float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                            stride_b, beta, c, ldc, stride_c, batch_size);
+    onemkl::cublas::gemm_batch(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                             stride_b, beta, c, ldc, stride_c, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_batch(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<int8_t, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<uint8_t, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+    cl::sycl::buffer<int32_t, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size);
+template <>
+void gemm_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<int8_t, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<uint8_t, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+    cl::sycl::buffer<int32_t, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                            offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    onemkl::cublas::gemm_batch(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                               offset_b, beta, c, ldc, offset_c, group_count, group_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, offset_a, b, ldb,
+                             offset_b, beta, c, ldc, offset_c, group_count, group_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                              std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                              cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda,
+                              std::int64_t stride_a, cl::sycl::buffer<uint8_t, 1> &b,
+                              std::int64_t ldb, std::int64_t stride_b, float beta,
+                              cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void gemm_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda,
+    std::int64_t stride_a, cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+    float beta, cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                            stride_b, beta, c, ldc, stride_c, batch_size);
+    onemkl::cublas::gemm_batch(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size);
+    gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                             stride_b, beta, c, ldc, stride_c, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gepack_compact(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                                  cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                  std::int64_t stride_a, cl::sycl::buffer<float, 1> &ap,
+                                  std::int64_t ldap, std::int64_t batch_size);
+template <>
+void gepack_compact<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t rows,
+                                                         std::int64_t cols,
+                                                         cl::sycl::buffer<float, 1> &a,
+                                                         std::int64_t lda, std::int64_t stride_a,
+                                                         cl::sycl::buffer<float, 1> &ap,
+                                                         std::int64_t ldap,
+                                                         std::int64_t batch_size) {
+    gepack_compact_precondition(queue, rows, cols, a, lda, stride_a, ap, ldap, batch_size);
+    onemkl::cublas::gepack_compact(queue, rows, cols, a, lda, stride_a, ap, ldap, batch_size);
+    gepack_compact_postcondition(queue, rows, cols, a, lda, stride_a, ap, ldap, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gepack_compact(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                                  cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                  std::int64_t stride_a, cl::sycl::buffer<double, 1> &ap,
+                                  std::int64_t ldap, std::int64_t batch_size);
+template <>
+void gepack_compact<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t rows,
+                                                         std::int64_t cols,
+                                                         cl::sycl::buffer<double, 1> &a,
+                                                         std::int64_t lda, std::int64_t stride_a,
+                                                         cl::sycl::buffer<double, 1> &ap,
+                                                         std::int64_t ldap,
+                                                         std::int64_t batch_size) {
+    gepack_compact_precondition(queue, rows, cols, a, lda, stride_a, ap, ldap, batch_size);
+    onemkl::cublas::gepack_compact(queue, rows, cols, a, lda, stride_a, ap, ldap, batch_size);
+    gepack_compact_postcondition(queue, rows, cols, a, lda, stride_a, ap, ldap, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void geunpack_compact(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                                    cl::sycl::buffer<float, 1> &ap, std::int64_t ldap,
+                                    cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                    std::int64_t stride_a, std::int64_t batch_size);
+template <>
+void geunpack_compact<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue,
+                                                           std::int64_t rows, std::int64_t cols,
+                                                           cl::sycl::buffer<float, 1> &ap,
+                                                           std::int64_t ldap,
+                                                           cl::sycl::buffer<float, 1> &a,
+                                                           std::int64_t lda, std::int64_t stride_a,
+                                                           std::int64_t batch_size) {
+    geunpack_compact_precondition(queue, rows, cols, ap, ldap, a, lda, stride_a, batch_size);
+    onemkl::cublas::geunpack_compact(queue, rows, cols, ap, ldap, a, lda, stride_a, batch_size);
+    geunpack_compact_postcondition(queue, rows, cols, ap, ldap, a, lda, stride_a, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void geunpack_compact(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                                    cl::sycl::buffer<double, 1> &ap, std::int64_t ldap,
+                                    cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                    std::int64_t stride_a, std::int64_t batch_size);
+template <>
+void geunpack_compact<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue,
+                                                           std::int64_t rows, std::int64_t cols,
+                                                           cl::sycl::buffer<double, 1> &ap,
+                                                           std::int64_t ldap,
+                                                           cl::sycl::buffer<double, 1> &a,
+                                                           std::int64_t lda, std::int64_t stride_a,
+                                                           std::int64_t batch_size) {
+    geunpack_compact_precondition(queue, rows, cols, ap, ldap, a, lda, stride_a, batch_size);
+    onemkl::cublas::geunpack_compact(queue, rows, cols, ap, ldap, a, lda, stride_a, batch_size);
+    geunpack_compact_postcondition(queue, rows, cols, ap, ldap, a, lda, stride_a, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_compact(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+                                cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                std::int64_t batch_size);
+template <>
+void gemm_compact<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+    cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c,
+    std::int64_t ldc, std::int64_t batch_size) {
+    gemm_compact_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                              batch_size);
+    onemkl::cublas::gemm_compact(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                                 ldc, batch_size);
+    gemm_compact_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                               batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm_compact(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                                cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+                                cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                std::int64_t batch_size);
+template <>
+void gemm_compact<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+    cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c,
+    std::int64_t ldc, std::int64_t batch_size) {
+    gemm_compact_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                              batch_size);
+    onemkl::cublas::gemm_compact(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                                 ldc, batch_size);
+    gemm_compact_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                               batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void trsm_compact(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                                transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
+                                float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                std::int64_t batch_size);
+template <>
+void trsm_compact<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+    cl::sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t batch_size) {
+    trsm_compact_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                              b, ldb, batch_size);
+    onemkl::cublas::trsm_compact(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                 lda, b, ldb, batch_size);
+    trsm_compact_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                               lda, b, ldb, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void trsm_compact(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                                transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
+                                double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                std::int64_t batch_size);
+template <>
+void trsm_compact<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+    cl::sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t batch_size) {
+    trsm_compact_precondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                              b, ldb, batch_size);
+    onemkl::cublas::trsm_compact(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                 lda, b, ldb, batch_size);
+    trsm_compact_postcondition(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                               lda, b, ldb, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void getrfnp_compact(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                   cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                   std::int64_t batch_size);
+template <>
+void getrfnp_compact<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                          std::int64_t n,
+                                                          cl::sycl::buffer<float, 1> &a,
+                                                          std::int64_t lda,
+                                                          std::int64_t batch_size) {
+    getrfnp_compact_precondition(queue, m, n, a, lda, batch_size);
+    onemkl::cublas::getrfnp_compact(queue, m, n, a, lda, batch_size);
+    getrfnp_compact_postcondition(queue, m, n, a, lda, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void getrfnp_compact(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                   cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                   std::int64_t batch_size);
+template <>
+void getrfnp_compact<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                          std::int64_t n,
+                                                          cl::sycl::buffer<double, 1> &a,
+                                                          std::int64_t lda,
+                                                          std::int64_t batch_size) {
+    getrfnp_compact_precondition(queue, m, n, a, lda, batch_size);
+    onemkl::cublas::getrfnp_compact(queue, m, n, a, lda, batch_size);
+    getrfnp_compact_postcondition(queue, m, n, a, lda, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void axpby(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                         cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                         cl::sycl::buffer<float, 1> &y, std::int64_t incy);
+template <>
+void axpby<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                                                cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                                float beta, cl::sycl::buffer<float, 1> &y,
+                                                std::int64_t incy) {
+    axpby_precondition(queue, n, alpha, x, incx, beta, y, incy);
+    onemkl::cublas::axpby(queue, n, alpha, x, incx, beta, y, incy);
+    axpby_postcondition(queue, n, alpha, x, incx, beta, y, incy);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void axpby(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                         cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                         cl::sycl::buffer<double, 1> &y, std::int64_t incy);
+template <>
+void axpby<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                double alpha, cl::sycl::buffer<double, 1> &x,
+                                                std::int64_t incx, double beta,
+                                                cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+    axpby_precondition(queue, n, alpha, x, incx, beta, y, incy);
+    onemkl::cublas::axpby(queue, n, alpha, x, incx, beta, y, incy);
+    axpby_postcondition(queue, n, alpha, x, incx, beta, y, incy);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void axpby(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                         std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
+                         std::int64_t incy);
+template <>
+void axpby<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                std::complex<float> alpha,
+                                                cl::sycl::buffer<std::complex<float>, 1> &x,
+                                                std::int64_t incx, std::complex<float> beta,
+                                                cl::sycl::buffer<std::complex<float>, 1> &y,
+                                                std::int64_t incy) {
+    axpby_precondition(queue, n, alpha, x, incx, beta, y, incy);
+    onemkl::cublas::axpby(queue, n, alpha, x, incx, beta, y, incy);
+    axpby_postcondition(queue, n, alpha, x, incx, beta, y, incy);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void axpby(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                         std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
+                         std::int64_t incy);
+template <>
+void axpby<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                std::complex<double> alpha,
+                                                cl::sycl::buffer<std::complex<double>, 1> &x,
+                                                std::int64_t incx, std::complex<double> beta,
+                                                cl::sycl::buffer<std::complex<double>, 1> &y,
+                                                std::int64_t incy) {
+    axpby_precondition(queue, n, alpha, x, incx, beta, y, incy);
+    onemkl::cublas::axpby(queue, n, alpha, x, incx, beta, y, incy);
+    axpby_postcondition(queue, n, alpha, x, incx, beta, y, incy);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            float alpha, cl::sycl::buffer<float, 1> &ab, std::int64_t lda,
+                            std::int64_t ldb);
+template <>
+void imatcopy<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, transpose trans,
+                                                   std::int64_t m, std::int64_t n, float alpha,
+                                                   cl::sycl::buffer<float, 1> &ab, std::int64_t lda,
+                                                   std::int64_t ldb) {
+    imatcopy_precondition(queue, trans, m, n, alpha, ab, lda, ldb);
+    onemkl::cublas::imatcopy(queue, trans, m, n, alpha, ab, lda, ldb);
+    imatcopy_postcondition(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            double alpha, cl::sycl::buffer<double, 1> &ab, std::int64_t lda,
+                            std::int64_t ldb);
+template <>
+void imatcopy<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, transpose trans,
+                                                   std::int64_t m, std::int64_t n, double alpha,
+                                                   cl::sycl::buffer<double, 1> &ab,
+                                                   std::int64_t lda, std::int64_t ldb) {
+    imatcopy_precondition(queue, trans, m, n, alpha, ab, lda, ldb);
+    onemkl::cublas::imatcopy(queue, trans, m, n, alpha, ab, lda, ldb);
+    imatcopy_postcondition(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &ab,
+                            std::int64_t lda, std::int64_t ldb);
+template <>
+void imatcopy<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, transpose trans,
+                                                   std::int64_t m, std::int64_t n,
+                                                   std::complex<float> alpha,
+                                                   cl::sycl::buffer<std::complex<float>, 1> &ab,
+                                                   std::int64_t lda, std::int64_t ldb) {
+    imatcopy_precondition(queue, trans, m, n, alpha, ab, lda, ldb);
+    onemkl::cublas::imatcopy(queue, trans, m, n, alpha, ab, lda, ldb);
+    imatcopy_postcondition(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            std::complex<double> alpha,
+                            cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t lda,
+                            std::int64_t ldb);
+template <>
+void imatcopy<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, transpose trans,
+                                                   std::int64_t m, std::int64_t n,
+                                                   std::complex<double> alpha,
+                                                   cl::sycl::buffer<std::complex<double>, 1> &ab,
+                                                   std::int64_t lda, std::int64_t ldb) {
+    imatcopy_precondition(queue, trans, m, n, alpha, ab, lda, ldb);
+    onemkl::cublas::imatcopy(queue, trans, m, n, alpha, ab, lda, ldb);
+    imatcopy_postcondition(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, float alpha,
+                           cl::sycl::buffer<float, 1> &a, std::int64_t lda, float beta,
+                           cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+template <>
+void omatadd<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, transpose transa,
+                                                  transpose transb, std::int64_t m, std::int64_t n,
+                                                  float alpha, cl::sycl::buffer<float, 1> &a,
+                                                  std::int64_t lda, float beta,
+                                                  cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                                  cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    omatadd_precondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    onemkl::cublas::omatadd(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    omatadd_postcondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, double alpha,
+                           cl::sycl::buffer<double, 1> &a, std::int64_t lda, double beta,
+                           cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
+template <>
+void omatadd<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, transpose transa,
+                                                  transpose transb, std::int64_t m, std::int64_t n,
+                                                  double alpha, cl::sycl::buffer<double, 1> &a,
+                                                  std::int64_t lda, double beta,
+                                                  cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                                  cl::sycl::buffer<double, 1> &c,
+                                                  std::int64_t ldc) {
+    omatadd_precondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    onemkl::cublas::omatadd(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    omatadd_postcondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                           std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &b,
+                           std::int64_t ldb, cl::sycl::buffer<std::complex<float>, 1> &c,
+                           std::int64_t ldc);
+template <>
+void omatadd<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+    std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+    cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    omatadd_precondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    onemkl::cublas::omatadd(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    omatadd_postcondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &b,
+                           std::int64_t ldb, cl::sycl::buffer<std::complex<double>, 1> &c,
+                           std::int64_t ldc);
+template <>
+void omatadd<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+    std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+    cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    omatadd_precondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    onemkl::cublas::omatadd(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    omatadd_postcondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                            cl::sycl::buffer<float, 1> &b, std::int64_t ldb);
+template <>
+void omatcopy<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, transpose trans,
+                                                   std::int64_t m, std::int64_t n, float alpha,
+                                                   cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                                   cl::sycl::buffer<float, 1> &b,
+                                                   std::int64_t ldb) {
+    omatcopy_precondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+    onemkl::cublas::omatcopy(queue, trans, m, n, alpha, a, lda, b, ldb);
+    omatcopy_postcondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                            cl::sycl::buffer<double, 1> &b, std::int64_t ldb);
+template <>
+void omatcopy<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, transpose trans,
+                                                   std::int64_t m, std::int64_t n, double alpha,
+                                                   cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                                   cl::sycl::buffer<double, 1> &b,
+                                                   std::int64_t ldb) {
+    omatcopy_precondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+    onemkl::cublas::omatcopy(queue, trans, m, n, alpha, a, lda, b, ldb);
+    omatcopy_postcondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                            std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
+                            std::int64_t ldb);
+template <>
+void omatcopy<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, transpose trans,
+                                                   std::int64_t m, std::int64_t n,
+                                                   std::complex<float> alpha,
+                                                   cl::sycl::buffer<std::complex<float>, 1> &a,
+                                                   std::int64_t lda,
+                                                   cl::sycl::buffer<std::complex<float>, 1> &b,
+                                                   std::int64_t ldb) {
+    omatcopy_precondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+    onemkl::cublas::omatcopy(queue, trans, m, n, alpha, a, lda, b, ldb);
+    omatcopy_postcondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            std::complex<double> alpha,
+                            cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                            cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb);
+template <>
+void omatcopy<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, transpose trans,
+                                                   std::int64_t m, std::int64_t n,
+                                                   std::complex<double> alpha,
+                                                   cl::sycl::buffer<std::complex<double>, 1> &a,
+                                                   std::int64_t lda,
+                                                   cl::sycl::buffer<std::complex<double>, 1> &b,
+                                                   std::int64_t ldb) {
+    omatcopy_precondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+    onemkl::cublas::omatcopy(queue, trans, m, n, alpha, a, lda, b, ldb);
+    omatcopy_postcondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &ab,
+                                  std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                                  std::int64_t batch_size);
+template <>
+void imatcopy_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, transpose trans,
+                                                         std::int64_t m, std::int64_t n,
+                                                         float alpha,
+                                                         cl::sycl::buffer<float, 1> &ab,
+                                                         std::int64_t lda, std::int64_t ldb,
+                                                         std::int64_t stride,
+                                                         std::int64_t batch_size) {
+    imatcopy_batch_precondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    onemkl::cublas::imatcopy_batch(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    imatcopy_batch_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &ab,
+                                  std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                                  std::int64_t batch_size);
+template <>
+void imatcopy_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, transpose trans,
+                                                         std::int64_t m, std::int64_t n,
+                                                         double alpha,
+                                                         cl::sycl::buffer<double, 1> &ab,
+                                                         std::int64_t lda, std::int64_t ldb,
+                                                         std::int64_t stride,
+                                                         std::int64_t batch_size) {
+    imatcopy_batch_precondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    onemkl::cublas::imatcopy_batch(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    imatcopy_batch_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, std::complex<float> alpha,
+                                  cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t lda,
+                                  std::int64_t ldb, std::int64_t stride, std::int64_t batch_size);
+template <>
+void imatcopy_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t lda,
+    std::int64_t ldb, std::int64_t stride, std::int64_t batch_size) {
+    imatcopy_batch_precondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    onemkl::cublas::imatcopy_batch(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    imatcopy_batch_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, std::complex<double> alpha,
+                                  cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t lda,
+                                  std::int64_t ldb, std::int64_t stride, std::int64_t batch_size);
+template <>
+void imatcopy_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t lda,
+    std::int64_t ldb, std::int64_t stride, std::int64_t batch_size) {
+    imatcopy_batch_precondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    onemkl::cublas::imatcopy_batch(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    imatcopy_batch_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                 std::int64_t m, std::int64_t n, float alpha,
+                                 cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, float beta, cl::sycl::buffer<float, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b,
+                                 cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void omatadd_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a, float beta,
+    cl::sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+    cl::sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size) {
+    omatadd_batch_precondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                               stride_b, c, ldc, stride_c, batch_size);
+    onemkl::cublas::omatadd_batch(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b,
+                                  ldb, stride_b, c, ldc, stride_c, batch_size);
+    omatadd_batch_postcondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                 std::int64_t m, std::int64_t n, double alpha,
+                                 cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, double beta, cl::sycl::buffer<double, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b,
+                                 cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void omatadd_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+    double beta, cl::sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+    cl::sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size) {
+    omatadd_batch_precondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                               stride_b, c, ldc, stride_c, batch_size);
+    onemkl::cublas::omatadd_batch(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b,
+                                  ldb, stride_b, c, ldc, stride_c, batch_size);
+    omatadd_batch_postcondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                 std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, std::complex<float> beta,
+                                 cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                                 std::int64_t stride_b, cl::sycl::buffer<std::complex<float>, 1> &c,
+                                 std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void omatadd_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &b,
+    std::int64_t ldb, std::int64_t stride_b, cl::sycl::buffer<std::complex<float>, 1> &c,
+    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    omatadd_batch_precondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                               stride_b, c, ldc, stride_c, batch_size);
+    onemkl::cublas::omatadd_batch(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b,
+                                  ldb, stride_b, c, ldc, stride_c, batch_size);
+    omatadd_batch_postcondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                 std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, std::complex<double> beta,
+                                 cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                 std::int64_t stride_b,
+                                 cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void omatadd_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &b,
+    std::int64_t ldb, std::int64_t stride_b, cl::sycl::buffer<std::complex<double>, 1> &c,
+    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    omatadd_batch_precondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                               stride_b, c, ldc, stride_c, batch_size);
+    onemkl::cublas::omatadd_batch(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b,
+                                  ldb, stride_b, c, ldc, stride_c, batch_size);
+    omatadd_batch_postcondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                                  std::int64_t lda, std::int64_t stride_a,
+                                  cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                  std::int64_t stride_b, std::int64_t batch_size);
+template <>
+void omatcopy_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, transpose trans,
+                                                         std::int64_t m, std::int64_t n,
+                                                         float alpha, cl::sycl::buffer<float, 1> &a,
+                                                         std::int64_t lda, std::int64_t stride_a,
+                                                         cl::sycl::buffer<float, 1> &b,
+                                                         std::int64_t ldb, std::int64_t stride_b,
+                                                         std::int64_t batch_size) {
+    omatcopy_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size);
+    onemkl::cublas::omatcopy_batch(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                   batch_size);
+    omatcopy_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+                                  std::int64_t lda, std::int64_t stride_a,
+                                  cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                  std::int64_t stride_b, std::int64_t batch_size);
+template <>
+void omatcopy_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, transpose trans,
+                                                         std::int64_t m, std::int64_t n,
+                                                         double alpha,
+                                                         cl::sycl::buffer<double, 1> &a,
+                                                         std::int64_t lda, std::int64_t stride_a,
+                                                         cl::sycl::buffer<double, 1> &b,
+                                                         std::int64_t ldb, std::int64_t stride_b,
+                                                         std::int64_t batch_size) {
+    omatcopy_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size);
+    onemkl::cublas::omatcopy_batch(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                   batch_size);
+    omatcopy_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, std::complex<float> alpha,
+                                  cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                  std::int64_t stride_a,
+                                  cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                                  std::int64_t stride_b, std::int64_t batch_size);
+template <>
+void omatcopy_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+    std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size) {
+    omatcopy_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size);
+    onemkl::cublas::omatcopy_batch(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                   batch_size);
+    omatcopy_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, std::complex<double> alpha,
+                                  cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                  std::int64_t stride_a,
+                                  cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                  std::int64_t stride_b, std::int64_t batch_size);
+template <>
+void omatcopy_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+    std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size) {
+    omatcopy_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size);
+    onemkl::cublas::omatcopy_batch(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                   batch_size);
+    omatcopy_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void asum(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                        std::int64_t incx, cl::sycl::buffer<float, 1> &result, accumulation acc);
+template <>
+void asum<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                               cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                               cl::sycl::buffer<float, 1> &result,
+                                               accumulation acc) {
+    asum_precondition(queue, n, x, incx, result, acc);
+    onemkl::cublas::asum(queue, n, x, incx, result, acc);
+    asum_postcondition(queue, n, x, incx, result, acc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void dot(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                       std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                       cl::sycl::buffer<float, 1> &result, accumulation acc);
+template <>
+void dot<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                              cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                              cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                                              cl::sycl::buffer<float, 1> &result,
+                                              accumulation acc) {
+    dot_precondition(queue, n, x, incx, y, incy, result, acc);
+    onemkl::cublas::dot(queue, n, x, incx, y, incy, result, acc);
+    dot_postcondition(queue, n, x, incx, y, incy, result, acc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void nrm2(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                        std::int64_t incx, cl::sycl::buffer<float, 1> &result, accumulation acc);
+template <>
+void nrm2<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                               cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                               cl::sycl::buffer<float, 1> &result,
+                                               accumulation acc) {
+    nrm2_precondition(queue, n, x, incx, result, acc);
+    onemkl::cublas::nrm2(queue, n, x, incx, result, acc);
+    nrm2_postcondition(queue, n, x, incx, result, acc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void axpbypcz(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                            cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                            cl::sycl::buffer<float, 1> &y, std::int64_t incy, float gamma,
+                            cl::sycl::buffer<float, 1> &z, std::int64_t incz);
+template <>
+void axpbypcz<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                   float alpha, cl::sycl::buffer<float, 1> &x,
+                                                   std::int64_t incx, float beta,
+                                                   cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                                                   float gamma, cl::sycl::buffer<float, 1> &z,
+                                                   std::int64_t incz) {
+    axpbypcz_precondition(queue, n, alpha, x, incx, beta, y, incy, gamma, z, incz);
+    onemkl::cublas::axpbypcz(queue, n, alpha, x, incx, beta, y, incy, gamma, z, incz);
+    axpbypcz_postcondition(queue, n, alpha, x, incx, beta, y, incy, gamma, z, incz);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void axpbypcz(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                            cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                            cl::sycl::buffer<double, 1> &y, std::int64_t incy, double gamma,
+                            cl::sycl::buffer<double, 1> &z, std::int64_t incz);
+template <>
+void axpbypcz<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                   double alpha, cl::sycl::buffer<double, 1> &x,
+                                                   std::int64_t incx, double beta,
+                                                   cl::sycl::buffer<double, 1> &y,
+                                                   std::int64_t incy, double gamma,
+                                                   cl::sycl::buffer<double, 1> &z,
+                                                   std::int64_t incz) {
+    axpbypcz_precondition(queue, n, alpha, x, incx, beta, y, incy, gamma, z, incz);
+    onemkl::cublas::axpbypcz(queue, n, alpha, x, incx, beta, y, incy, gamma, z, incz);
+    axpbypcz_postcondition(queue, n, alpha, x, incx, beta, y, incy, gamma, z, incz);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void axpbypcz_dot(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                                cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                                cl::sycl::buffer<float, 1> &y, std::int64_t incy, float gamma,
+                                cl::sycl::buffer<float, 1> &z, std::int64_t incz,
+                                cl::sycl::buffer<float, 1> &w, std::int64_t incw,
+                                cl::sycl::buffer<float, 1> &result);
+template <>
+void axpbypcz_dot<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+    std::int64_t incx, float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy, float gamma,
+    cl::sycl::buffer<float, 1> &z, std::int64_t incz, cl::sycl::buffer<float, 1> &w,
+    std::int64_t incw, cl::sycl::buffer<float, 1> &result) {
+    axpbypcz_dot_precondition(queue, n, alpha, x, incx, beta, y, incy, gamma, z, incz, w, incw,
+                              result);
+    onemkl::cublas::axpbypcz_dot(queue, n, alpha, x, incx, beta, y, incy, gamma, z, incz, w, incw,
+                                 result);
+    axpbypcz_dot_postcondition(queue, n, alpha, x, incx, beta, y, incy, gamma, z, incz, w, incw,
+                               result);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void axpbypcz_dot(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                                cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                                cl::sycl::buffer<double, 1> &y, std::int64_t incy, double gamma,
+                                cl::sycl::buffer<double, 1> &z, std::int64_t incz,
+                                cl::sycl::buffer<double, 1> &w, std::int64_t incw,
+                                cl::sycl::buffer<double, 1> &result);
+template <>
+void axpbypcz_dot<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
+    std::int64_t incx, double beta, cl::sycl::buffer<double, 1> &y, std::int64_t incy, double gamma,
+    cl::sycl::buffer<double, 1> &z, std::int64_t incz, cl::sycl::buffer<double, 1> &w,
+    std::int64_t incw, cl::sycl::buffer<double, 1> &result) {
+    axpbypcz_dot_precondition(queue, n, alpha, x, incx, beta, y, incy, gamma, z, incz, w, incw,
+                              result);
+    onemkl::cublas::axpbypcz_dot(queue, n, alpha, x, incx, beta, y, incy, gamma, z, incz, w, incw,
+                                 result);
+    axpbypcz_dot_postcondition(queue, n, alpha, x, incx, beta, y, incy, gamma, z, incz, w, incw,
+                               result);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event asum(cl::sycl::queue &queue, std::int64_t n,
+                                   cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                   float *result);
+template <>
+cl::sycl::event asum<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
+    std::int64_t incx, float *result) {
+    asum_precondition(queue, n, x, incx, result);
+    auto res = onemkl::cublas::asum(queue, n, x, incx, result);
+    asum_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event asum(cl::sycl::queue &queue, std::int64_t n,
+                                   cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                                   double *result);
+template <>
+cl::sycl::event asum<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x,
+    std::int64_t incx, double *result) {
+    asum_precondition(queue, n, x, incx, result);
+    auto res = onemkl::cublas::asum(queue, n, x, incx, result);
+    asum_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event asum(cl::sycl::queue &queue, std::int64_t n,
+                                   cl::sycl::buffer<float, 1> &x, std::int64_t incx, float *result);
+template <>
+cl::sycl::event asum<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                          cl::sycl::buffer<float, 1> &x,
+                                                          std::int64_t incx, float *result) {
+    asum_precondition(queue, n, x, incx, result);
+    auto res = onemkl::cublas::asum(queue, n, x, incx, result);
+    asum_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event asum(cl::sycl::queue &queue, std::int64_t n,
+                                   cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                   double *result);
+template <>
+cl::sycl::event asum<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                          cl::sycl::buffer<double, 1> &x,
+                                                          std::int64_t incx, double *result) {
+    asum_precondition(queue, n, x, incx, result);
+    auto res = onemkl::cublas::asum(queue, n, x, incx, result);
+    asum_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event dot(cl::sycl::queue &queue, std::int64_t n,
+                                  cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                  cl::sycl::buffer<float, 1> &y, std::int64_t incy, float *result);
+template <>
+cl::sycl::event dot<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                         cl::sycl::buffer<float, 1> &x,
+                                                         std::int64_t incx,
+                                                         cl::sycl::buffer<float, 1> &y,
+                                                         std::int64_t incy, float *result) {
+    dot_precondition(queue, n, x, incx, y, incy, result);
+    auto res = onemkl::cublas::dot(queue, n, x, incx, y, incy, result);
+    dot_postcondition(queue, n, x, incx, y, incy, result);
+    return res;
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event dot(cl::sycl::queue &queue, std::int64_t n,
+                                  cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                  cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                                  double *result);
+template <>
+cl::sycl::event dot<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                         cl::sycl::buffer<double, 1> &x,
+                                                         std::int64_t incx,
+                                                         cl::sycl::buffer<double, 1> &y,
+                                                         std::int64_t incy, double *result) {
+    dot_precondition(queue, n, x, incx, y, incy, result);
+    auto res = onemkl::cublas::dot(queue, n, x, incx, y, incy, result);
+    dot_postcondition(queue, n, x, incx, y, incy, result);
+    return res;
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event dot(cl::sycl::queue &queue, std::int64_t n,
+                                  cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                  cl::sycl::buffer<float, 1> &y, std::int64_t incy, double *result);
+template <>
+cl::sycl::event dot<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                         cl::sycl::buffer<float, 1> &x,
+                                                         std::int64_t incx,
+                                                         cl::sycl::buffer<float, 1> &y,
+                                                         std::int64_t incy, double *result) {
+    dot_precondition(queue, n, x, incx, y, incy, result);
+    auto res = onemkl::cublas::dot(queue, n, x, incx, y, incy, result);
+    dot_postcondition(queue, n, x, incx, y, incy, result);
+    return res;
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event iamin(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                    std::int64_t *result);
+template <>
+cl::sycl::event iamin<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                           cl::sycl::buffer<float, 1> &x,
+                                                           std::int64_t incx,
+                                                           std::int64_t *result) {
+    iamin_precondition(queue, n, x, incx, result);
+    auto res = onemkl::cublas::iamin(queue, n, x, incx, result);
+    iamin_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event iamin(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                    std::int64_t *result);
+template <>
+cl::sycl::event iamin<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                           cl::sycl::buffer<double, 1> &x,
+                                                           std::int64_t incx,
+                                                           std::int64_t *result) {
+    iamin_precondition(queue, n, x, incx, result);
+    auto res = onemkl::cublas::iamin(queue, n, x, incx, result);
+    iamin_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event iamin(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                    std::int64_t *result);
+template <>
+cl::sycl::event iamin<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
+    std::int64_t incx, std::int64_t *result) {
+    iamin_precondition(queue, n, x, incx, result);
+    auto res = onemkl::cublas::iamin(queue, n, x, incx, result);
+    iamin_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event iamin(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                                    std::int64_t *result);
+template <>
+cl::sycl::event iamin<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x,
+    std::int64_t incx, std::int64_t *result) {
+    iamin_precondition(queue, n, x, incx, result);
+    auto res = onemkl::cublas::iamin(queue, n, x, incx, result);
+    iamin_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event iamax(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                    std::int64_t *result);
+template <>
+cl::sycl::event iamax<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                           cl::sycl::buffer<float, 1> &x,
+                                                           std::int64_t incx,
+                                                           std::int64_t *result) {
+    iamax_precondition(queue, n, x, incx, result);
+    auto res = onemkl::cublas::iamax(queue, n, x, incx, result);
+    iamax_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event iamax(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                    std::int64_t *result);
+template <>
+cl::sycl::event iamax<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                           cl::sycl::buffer<double, 1> &x,
+                                                           std::int64_t incx,
+                                                           std::int64_t *result) {
+    iamax_precondition(queue, n, x, incx, result);
+    auto res = onemkl::cublas::iamax(queue, n, x, incx, result);
+    iamax_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event iamax(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                    std::int64_t *result);
+template <>
+cl::sycl::event iamax<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
+    std::int64_t incx, std::int64_t *result) {
+    iamax_precondition(queue, n, x, incx, result);
+    auto res = onemkl::cublas::iamax(queue, n, x, incx, result);
+    iamax_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event iamax(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                                    std::int64_t *result);
+template <>
+cl::sycl::event iamax<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x,
+    std::int64_t incx, std::int64_t *result) {
+    iamax_precondition(queue, n, x, incx, result);
+    auto res = onemkl::cublas::iamax(queue, n, x, incx, result);
+    iamax_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event nrm2(cl::sycl::queue &queue, std::int64_t n,
+                                   cl::sycl::buffer<float, 1> &x, std::int64_t incx, float *result);
+template <>
+cl::sycl::event nrm2<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                          cl::sycl::buffer<float, 1> &x,
+                                                          std::int64_t incx, float *result) {
+    nrm2_precondition(queue, n, x, incx, result);
+    auto res = onemkl::cublas::nrm2(queue, n, x, incx, result);
+    nrm2_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event nrm2(cl::sycl::queue &queue, std::int64_t n,
+                                   cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                   double *result);
+template <>
+cl::sycl::event nrm2<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                                          cl::sycl::buffer<double, 1> &x,
+                                                          std::int64_t incx, double *result) {
+    nrm2_precondition(queue, n, x, incx, result);
+    auto res = onemkl::cublas::nrm2(queue, n, x, incx, result);
+    nrm2_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event nrm2(cl::sycl::queue &queue, std::int64_t n,
+                                   cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                   float *result);
+template <>
+cl::sycl::event nrm2<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
+    std::int64_t incx, float *result) {
+    nrm2_precondition(queue, n, x, incx, result);
+    auto res = onemkl::cublas::nrm2(queue, n, x, incx, result);
+    nrm2_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline cl::sycl::event nrm2(cl::sycl::queue &queue, std::int64_t n,
+                                   cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                                   double *result);
+template <>
+cl::sycl::event nrm2<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x,
+    std::int64_t incx, double *result) {
+    nrm2_precondition(queue, n, x, incx, result);
+    auto res = onemkl::cublas::nrm2(queue, n, x, incx, result);
+    nrm2_postcondition(queue, n, x, incx, result);
+    return res;
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gbtge(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                         std::int64_t ku, cl::sycl::buffer<float, 1> &ab, std::int64_t ldab,
+                         cl::sycl::buffer<float, 1> &a, std::int64_t lda);
+template <>
+void gbtge<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                std::int64_t n, std::int64_t kl, std::int64_t ku,
+                                                cl::sycl::buffer<float, 1> &ab, std::int64_t ldab,
+                                                cl::sycl::buffer<float, 1> &a, std::int64_t lda) {
+    gbtge_precondition(queue, m, n, kl, ku, ab, ldab, a, lda);
+    onemkl::cublas::gbtge(queue, m, n, kl, ku, ab, ldab, a, lda);
+    gbtge_postcondition(queue, m, n, kl, ku, ab, ldab, a, lda);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gbtge(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                         std::int64_t ku, cl::sycl::buffer<double, 1> &ab, std::int64_t ldab,
+                         cl::sycl::buffer<double, 1> &a, std::int64_t lda);
+template <>
+void gbtge<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                std::int64_t n, std::int64_t kl, std::int64_t ku,
+                                                cl::sycl::buffer<double, 1> &ab, std::int64_t ldab,
+                                                cl::sycl::buffer<double, 1> &a, std::int64_t lda) {
+    gbtge_precondition(queue, m, n, kl, ku, ab, ldab, a, lda);
+    onemkl::cublas::gbtge(queue, m, n, kl, ku, ab, ldab, a, lda);
+    gbtge_postcondition(queue, m, n, kl, ku, ab, ldab, a, lda);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gbtge(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                         std::int64_t ku, cl::sycl::buffer<std::complex<float>, 1> &ab,
+                         std::int64_t ldab, cl::sycl::buffer<std::complex<float>, 1> &a,
+                         std::int64_t lda);
+template <>
+void gbtge<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                std::int64_t n, std::int64_t kl, std::int64_t ku,
+                                                cl::sycl::buffer<std::complex<float>, 1> &ab,
+                                                std::int64_t ldab,
+                                                cl::sycl::buffer<std::complex<float>, 1> &a,
+                                                std::int64_t lda) {
+    gbtge_precondition(queue, m, n, kl, ku, ab, ldab, a, lda);
+    onemkl::cublas::gbtge(queue, m, n, kl, ku, ab, ldab, a, lda);
+    gbtge_postcondition(queue, m, n, kl, ku, ab, ldab, a, lda);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gbtge(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                         std::int64_t ku, cl::sycl::buffer<std::complex<double>, 1> &ab,
+                         std::int64_t ldab, cl::sycl::buffer<std::complex<double>, 1> &a,
+                         std::int64_t lda);
+template <>
+void gbtge<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                std::int64_t n, std::int64_t kl, std::int64_t ku,
+                                                cl::sycl::buffer<std::complex<double>, 1> &ab,
+                                                std::int64_t ldab,
+                                                cl::sycl::buffer<std::complex<double>, 1> &a,
+                                                std::int64_t lda) {
+    gbtge_precondition(queue, m, n, kl, ku, ab, ldab, a, lda);
+    onemkl::cublas::gbtge(queue, m, n, kl, ku, ab, ldab, a, lda);
+    gbtge_postcondition(queue, m, n, kl, ku, ab, ldab, a, lda);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gettgb(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                          std::int64_t ku, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                          cl::sycl::buffer<float, 1> &ab, std::int64_t ldab);
+template <>
+void gettgb<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                 std::int64_t n, std::int64_t kl, std::int64_t ku,
+                                                 cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                                 cl::sycl::buffer<float, 1> &ab,
+                                                 std::int64_t ldab) {
+    gettgb_precondition(queue, m, n, kl, ku, a, lda, ab, ldab);
+    onemkl::cublas::gettgb(queue, m, n, kl, ku, a, lda, ab, ldab);
+    gettgb_postcondition(queue, m, n, kl, ku, a, lda, ab, ldab);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gettgb(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                          std::int64_t ku, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                          cl::sycl::buffer<double, 1> &ab, std::int64_t ldab);
+template <>
+void gettgb<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                 std::int64_t n, std::int64_t kl, std::int64_t ku,
+                                                 cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                                 cl::sycl::buffer<double, 1> &ab,
+                                                 std::int64_t ldab) {
+    gettgb_precondition(queue, m, n, kl, ku, a, lda, ab, ldab);
+    onemkl::cublas::gettgb(queue, m, n, kl, ku, a, lda, ab, ldab);
+    gettgb_postcondition(queue, m, n, kl, ku, a, lda, ab, ldab);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gettgb(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                          std::int64_t ku, cl::sycl::buffer<std::complex<float>, 1> &a,
+                          std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &ab,
+                          std::int64_t ldab);
+template <>
+void gettgb<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                 std::int64_t n, std::int64_t kl, std::int64_t ku,
+                                                 cl::sycl::buffer<std::complex<float>, 1> &a,
+                                                 std::int64_t lda,
+                                                 cl::sycl::buffer<std::complex<float>, 1> &ab,
+                                                 std::int64_t ldab) {
+    gettgb_precondition(queue, m, n, kl, ku, a, lda, ab, ldab);
+    onemkl::cublas::gettgb(queue, m, n, kl, ku, a, lda, ab, ldab);
+    gettgb_postcondition(queue, m, n, kl, ku, a, lda, ab, ldab);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gettgb(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                          std::int64_t ku, cl::sycl::buffer<std::complex<double>, 1> &a,
+                          std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &ab,
+                          std::int64_t ldab);
+template <>
+void gettgb<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                 std::int64_t n, std::int64_t kl, std::int64_t ku,
+                                                 cl::sycl::buffer<std::complex<double>, 1> &a,
+                                                 std::int64_t lda,
+                                                 cl::sycl::buffer<std::complex<double>, 1> &ab,
+                                                 std::int64_t ldab) {
+    gettgb_precondition(queue, m, n, kl, ku, a, lda, ab, ldab);
+    onemkl::cublas::gettgb(queue, m, n, kl, ku, a, lda, ab, ldab);
+    gettgb_postcondition(queue, m, n, kl, ku, a, lda, ab, ldab);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void tpttr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                         cl::sycl::buffer<float, 1> &ap, cl::sycl::buffer<float, 1> &a,
+                         std::int64_t lda);
+template <>
+void tpttr<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, uplo upper_lower,
+                                                std::int64_t n, cl::sycl::buffer<float, 1> &ap,
+                                                cl::sycl::buffer<float, 1> &a, std::int64_t lda) {
+    tpttr_precondition(queue, upper_lower, n, ap, a, lda);
+    onemkl::cublas::tpttr(queue, upper_lower, n, ap, a, lda);
+    tpttr_postcondition(queue, upper_lower, n, ap, a, lda);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void tpttr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                         cl::sycl::buffer<double, 1> &ap, cl::sycl::buffer<double, 1> &a,
+                         std::int64_t lda);
+template <>
+void tpttr<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, uplo upper_lower,
+                                                std::int64_t n, cl::sycl::buffer<double, 1> &ap,
+                                                cl::sycl::buffer<double, 1> &a, std::int64_t lda) {
+    tpttr_precondition(queue, upper_lower, n, ap, a, lda);
+    onemkl::cublas::tpttr(queue, upper_lower, n, ap, a, lda);
+    tpttr_postcondition(queue, upper_lower, n, ap, a, lda);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void tpttr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                         cl::sycl::buffer<std::complex<float>, 1> &ap,
+                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda);
+template <>
+void tpttr<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, uplo upper_lower,
+                                                std::int64_t n,
+                                                cl::sycl::buffer<std::complex<float>, 1> &ap,
+                                                cl::sycl::buffer<std::complex<float>, 1> &a,
+                                                std::int64_t lda) {
+    tpttr_precondition(queue, upper_lower, n, ap, a, lda);
+    onemkl::cublas::tpttr(queue, upper_lower, n, ap, a, lda);
+    tpttr_postcondition(queue, upper_lower, n, ap, a, lda);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void tpttr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                         cl::sycl::buffer<std::complex<double>, 1> &ap,
+                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda);
+template <>
+void tpttr<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, uplo upper_lower,
+                                                std::int64_t n,
+                                                cl::sycl::buffer<std::complex<double>, 1> &ap,
+                                                cl::sycl::buffer<std::complex<double>, 1> &a,
+                                                std::int64_t lda) {
+    tpttr_precondition(queue, upper_lower, n, ap, a, lda);
+    onemkl::cublas::tpttr(queue, upper_lower, n, ap, a, lda);
+    tpttr_postcondition(queue, upper_lower, n, ap, a, lda);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void trttp(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                         cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                         cl::sycl::buffer<float, 1> &ap);
+template <>
+void trttp<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, uplo upper_lower,
+                                                std::int64_t n, cl::sycl::buffer<float, 1> &a,
+                                                std::int64_t lda, cl::sycl::buffer<float, 1> &ap) {
+    trttp_precondition(queue, upper_lower, n, a, lda, ap);
+    onemkl::cublas::trttp(queue, upper_lower, n, a, lda, ap);
+    trttp_postcondition(queue, upper_lower, n, a, lda, ap);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void trttp(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                         cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                         cl::sycl::buffer<double, 1> &ap);
+template <>
+void trttp<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, uplo upper_lower,
+                                                std::int64_t n, cl::sycl::buffer<double, 1> &a,
+                                                std::int64_t lda, cl::sycl::buffer<double, 1> &ap) {
+    trttp_precondition(queue, upper_lower, n, a, lda, ap);
+    onemkl::cublas::trttp(queue, upper_lower, n, a, lda, ap);
+    trttp_postcondition(queue, upper_lower, n, a, lda, ap);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void trttp(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                         cl::sycl::buffer<std::complex<float>, 1> &ap);
+template <>
+void trttp<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, uplo upper_lower,
+                                                std::int64_t n,
+                                                cl::sycl::buffer<std::complex<float>, 1> &a,
+                                                std::int64_t lda,
+                                                cl::sycl::buffer<std::complex<float>, 1> &ap) {
+    trttp_precondition(queue, upper_lower, n, a, lda, ap);
+    onemkl::cublas::trttp(queue, upper_lower, n, a, lda, ap);
+    trttp_postcondition(queue, upper_lower, n, a, lda, ap);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void trttp(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                         cl::sycl::buffer<std::complex<double>, 1> &ap);
+template <>
+void trttp<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, uplo upper_lower,
+                                                std::int64_t n,
+                                                cl::sycl::buffer<std::complex<double>, 1> &a,
+                                                std::int64_t lda,
+                                                cl::sycl::buffer<std::complex<double>, 1> &ap) {
+    trttp_precondition(queue, upper_lower, n, a, lda, ap);
+    onemkl::cublas::trttp(queue, upper_lower, n, a, lda, ap);
+    trttp_postcondition(queue, upper_lower, n, a, lda, ap);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gbtge_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                               std::int64_t kl, std::int64_t ku, cl::sycl::buffer<float, 1> &ab,
+                               std::int64_t ldab, std::int64_t stride_ab,
+                               cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                               std::int64_t stride_a, std::int64_t batch_size);
+template <>
+void gbtge_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                      std::int64_t n, std::int64_t kl,
+                                                      std::int64_t ku,
+                                                      cl::sycl::buffer<float, 1> &ab,
+                                                      std::int64_t ldab, std::int64_t stride_ab,
+                                                      cl::sycl::buffer<float, 1> &a,
+                                                      std::int64_t lda, std::int64_t stride_a,
+                                                      std::int64_t batch_size) {
+    gbtge_batch_precondition(queue, m, n, kl, ku, ab, ldab, stride_ab, a, lda, stride_a,
+                             batch_size);
+    onemkl::cublas::gbtge_batch(queue, m, n, kl, ku, ab, ldab, stride_ab, a, lda, stride_a,
+                                batch_size);
+    gbtge_batch_postcondition(queue, m, n, kl, ku, ab, ldab, stride_ab, a, lda, stride_a,
+                              batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gbtge_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                               std::int64_t kl, std::int64_t ku, cl::sycl::buffer<double, 1> &ab,
+                               std::int64_t ldab, std::int64_t stride_ab,
+                               cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                               std::int64_t stride_a, std::int64_t batch_size);
+template <>
+void gbtge_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                      std::int64_t n, std::int64_t kl,
+                                                      std::int64_t ku,
+                                                      cl::sycl::buffer<double, 1> &ab,
+                                                      std::int64_t ldab, std::int64_t stride_ab,
+                                                      cl::sycl::buffer<double, 1> &a,
+                                                      std::int64_t lda, std::int64_t stride_a,
+                                                      std::int64_t batch_size) {
+    gbtge_batch_precondition(queue, m, n, kl, ku, ab, ldab, stride_ab, a, lda, stride_a,
+                             batch_size);
+    onemkl::cublas::gbtge_batch(queue, m, n, kl, ku, ab, ldab, stride_ab, a, lda, stride_a,
+                                batch_size);
+    gbtge_batch_postcondition(queue, m, n, kl, ku, ab, ldab, stride_ab, a, lda, stride_a,
+                              batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gbtge_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                               std::int64_t kl, std::int64_t ku,
+                               cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t ldab,
+                               std::int64_t stride_ab, cl::sycl::buffer<std::complex<float>, 1> &a,
+                               std::int64_t lda, std::int64_t stride_a, std::int64_t batch_size);
+template <>
+void gbtge_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                      std::int64_t n, std::int64_t kl,
+                                                      std::int64_t ku,
+                                                      cl::sycl::buffer<std::complex<float>, 1> &ab,
+                                                      std::int64_t ldab, std::int64_t stride_ab,
+                                                      cl::sycl::buffer<std::complex<float>, 1> &a,
+                                                      std::int64_t lda, std::int64_t stride_a,
+                                                      std::int64_t batch_size) {
+    gbtge_batch_precondition(queue, m, n, kl, ku, ab, ldab, stride_ab, a, lda, stride_a,
+                             batch_size);
+    onemkl::cublas::gbtge_batch(queue, m, n, kl, ku, ab, ldab, stride_ab, a, lda, stride_a,
+                                batch_size);
+    gbtge_batch_postcondition(queue, m, n, kl, ku, ab, ldab, stride_ab, a, lda, stride_a,
+                              batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gbtge_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                               std::int64_t kl, std::int64_t ku,
+                               cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t ldab,
+                               std::int64_t stride_ab, cl::sycl::buffer<std::complex<double>, 1> &a,
+                               std::int64_t lda, std::int64_t stride_a, std::int64_t batch_size);
+template <>
+void gbtge_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                      std::int64_t n, std::int64_t kl,
+                                                      std::int64_t ku,
+                                                      cl::sycl::buffer<std::complex<double>, 1> &ab,
+                                                      std::int64_t ldab, std::int64_t stride_ab,
+                                                      cl::sycl::buffer<std::complex<double>, 1> &a,
+                                                      std::int64_t lda, std::int64_t stride_a,
+                                                      std::int64_t batch_size) {
+    gbtge_batch_precondition(queue, m, n, kl, ku, ab, ldab, stride_ab, a, lda, stride_a,
+                             batch_size);
+    onemkl::cublas::gbtge_batch(queue, m, n, kl, ku, ab, ldab, stride_ab, a, lda, stride_a,
+                                batch_size);
+    gbtge_batch_postcondition(queue, m, n, kl, ku, ab, ldab, stride_ab, a, lda, stride_a,
+                              batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gettgb_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t kl, std::int64_t ku, cl::sycl::buffer<float, 1> &a,
+                                std::int64_t lda, std::int64_t stride_a,
+                                cl::sycl::buffer<float, 1> &ab, std::int64_t ldab,
+                                std::int64_t stride_ab, std::int64_t batch_size);
+template <>
+void gettgb_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                       std::int64_t n, std::int64_t kl,
+                                                       std::int64_t ku,
+                                                       cl::sycl::buffer<float, 1> &a,
+                                                       std::int64_t lda, std::int64_t stride_a,
+                                                       cl::sycl::buffer<float, 1> &ab,
+                                                       std::int64_t ldab, std::int64_t stride_ab,
+                                                       std::int64_t batch_size) {
+    gettgb_batch_precondition(queue, m, n, kl, ku, a, lda, stride_a, ab, ldab, stride_ab,
+                              batch_size);
+    onemkl::cublas::gettgb_batch(queue, m, n, kl, ku, a, lda, stride_a, ab, ldab, stride_ab,
+                                 batch_size);
+    gettgb_batch_postcondition(queue, m, n, kl, ku, a, lda, stride_a, ab, ldab, stride_ab,
+                               batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gettgb_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t kl, std::int64_t ku, cl::sycl::buffer<double, 1> &a,
+                                std::int64_t lda, std::int64_t stride_a,
+                                cl::sycl::buffer<double, 1> &ab, std::int64_t ldab,
+                                std::int64_t stride_ab, std::int64_t batch_size);
+template <>
+void gettgb_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                       std::int64_t n, std::int64_t kl,
+                                                       std::int64_t ku,
+                                                       cl::sycl::buffer<double, 1> &a,
+                                                       std::int64_t lda, std::int64_t stride_a,
+                                                       cl::sycl::buffer<double, 1> &ab,
+                                                       std::int64_t ldab, std::int64_t stride_ab,
+                                                       std::int64_t batch_size) {
+    gettgb_batch_precondition(queue, m, n, kl, ku, a, lda, stride_a, ab, ldab, stride_ab,
+                              batch_size);
+    onemkl::cublas::gettgb_batch(queue, m, n, kl, ku, a, lda, stride_a, ab, ldab, stride_ab,
+                                 batch_size);
+    gettgb_batch_postcondition(queue, m, n, kl, ku, a, lda, stride_a, ab, ldab, stride_ab,
+                               batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gettgb_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t kl, std::int64_t ku,
+                                cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &ab,
+                                std::int64_t ldab, std::int64_t stride_ab, std::int64_t batch_size);
+template <>
+void gettgb_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                       std::int64_t n, std::int64_t kl,
+                                                       std::int64_t ku,
+                                                       cl::sycl::buffer<std::complex<float>, 1> &a,
+                                                       std::int64_t lda, std::int64_t stride_a,
+                                                       cl::sycl::buffer<std::complex<float>, 1> &ab,
+                                                       std::int64_t ldab, std::int64_t stride_ab,
+                                                       std::int64_t batch_size) {
+    gettgb_batch_precondition(queue, m, n, kl, ku, a, lda, stride_a, ab, ldab, stride_ab,
+                              batch_size);
+    onemkl::cublas::gettgb_batch(queue, m, n, kl, ku, a, lda, stride_a, ab, ldab, stride_ab,
+                                 batch_size);
+    gettgb_batch_postcondition(queue, m, n, kl, ku, a, lda, stride_a, ab, ldab, stride_ab,
+                               batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gettgb_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t kl, std::int64_t ku,
+                                cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                std::int64_t stride_a,
+                                cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t ldab,
+                                std::int64_t stride_ab, std::int64_t batch_size);
+template <>
+void gettgb_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl, std::int64_t ku,
+    cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda, std::int64_t stride_a,
+    cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t ldab, std::int64_t stride_ab,
+    std::int64_t batch_size) {
+    gettgb_batch_precondition(queue, m, n, kl, ku, a, lda, stride_a, ab, ldab, stride_ab,
+                              batch_size);
+    onemkl::cublas::gettgb_batch(queue, m, n, kl, ku, a, lda, stride_a, ab, ldab, stride_ab,
+                                 batch_size);
+    gettgb_batch_postcondition(queue, m, n, kl, ku, a, lda, stride_a, ab, ldab, stride_ab,
+                               batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void tpttr_batch(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                               cl::sycl::buffer<float, 1> &ap, std::int64_t stride_ap,
+                               cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                               std::int64_t stride_a, std::int64_t batch_size);
+template <>
+void tpttr_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, uplo upper_lower,
+                                                      std::int64_t n,
+                                                      cl::sycl::buffer<float, 1> &ap,
+                                                      std::int64_t stride_ap,
+                                                      cl::sycl::buffer<float, 1> &a,
+                                                      std::int64_t lda, std::int64_t stride_a,
+                                                      std::int64_t batch_size) {
+    tpttr_batch_precondition(queue, upper_lower, n, ap, stride_ap, a, lda, stride_a, batch_size);
+    onemkl::cublas::tpttr_batch(queue, upper_lower, n, ap, stride_ap, a, lda, stride_a, batch_size);
+    tpttr_batch_postcondition(queue, upper_lower, n, ap, stride_ap, a, lda, stride_a, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void tpttr_batch(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                               cl::sycl::buffer<double, 1> &ap, std::int64_t stride_ap,
+                               cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                               std::int64_t stride_a, std::int64_t batch_size);
+template <>
+void tpttr_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, uplo upper_lower,
+                                                      std::int64_t n,
+                                                      cl::sycl::buffer<double, 1> &ap,
+                                                      std::int64_t stride_ap,
+                                                      cl::sycl::buffer<double, 1> &a,
+                                                      std::int64_t lda, std::int64_t stride_a,
+                                                      std::int64_t batch_size) {
+    tpttr_batch_precondition(queue, upper_lower, n, ap, stride_ap, a, lda, stride_a, batch_size);
+    onemkl::cublas::tpttr_batch(queue, upper_lower, n, ap, stride_ap, a, lda, stride_a, batch_size);
+    tpttr_batch_postcondition(queue, upper_lower, n, ap, stride_ap, a, lda, stride_a, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void tpttr_batch(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                               cl::sycl::buffer<std::complex<float>, 1> &ap, std::int64_t stride_ap,
+                               cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                               std::int64_t stride_a, std::int64_t batch_size);
+template <>
+void tpttr_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, uplo upper_lower,
+                                                      std::int64_t n,
+                                                      cl::sycl::buffer<std::complex<float>, 1> &ap,
+                                                      std::int64_t stride_ap,
+                                                      cl::sycl::buffer<std::complex<float>, 1> &a,
+                                                      std::int64_t lda, std::int64_t stride_a,
+                                                      std::int64_t batch_size) {
+    tpttr_batch_precondition(queue, upper_lower, n, ap, stride_ap, a, lda, stride_a, batch_size);
+    onemkl::cublas::tpttr_batch(queue, upper_lower, n, ap, stride_ap, a, lda, stride_a, batch_size);
+    tpttr_batch_postcondition(queue, upper_lower, n, ap, stride_ap, a, lda, stride_a, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void tpttr_batch(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                               cl::sycl::buffer<std::complex<double>, 1> &ap,
+                               std::int64_t stride_ap, cl::sycl::buffer<std::complex<double>, 1> &a,
+                               std::int64_t lda, std::int64_t stride_a, std::int64_t batch_size);
+template <>
+void tpttr_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, uplo upper_lower,
+                                                      std::int64_t n,
+                                                      cl::sycl::buffer<std::complex<double>, 1> &ap,
+                                                      std::int64_t stride_ap,
+                                                      cl::sycl::buffer<std::complex<double>, 1> &a,
+                                                      std::int64_t lda, std::int64_t stride_a,
+                                                      std::int64_t batch_size) {
+    tpttr_batch_precondition(queue, upper_lower, n, ap, stride_ap, a, lda, stride_a, batch_size);
+    onemkl::cublas::tpttr_batch(queue, upper_lower, n, ap, stride_ap, a, lda, stride_a, batch_size);
+    tpttr_batch_postcondition(queue, upper_lower, n, ap, stride_ap, a, lda, stride_a, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void trttp_batch(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                               cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                               std::int64_t stride_a, cl::sycl::buffer<float, 1> &ap,
+                               std::int64_t stride_ap, std::int64_t batch_size);
+template <>
+void trttp_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, uplo upper_lower,
+                                                      std::int64_t n, cl::sycl::buffer<float, 1> &a,
+                                                      std::int64_t lda, std::int64_t stride_a,
+                                                      cl::sycl::buffer<float, 1> &ap,
+                                                      std::int64_t stride_ap,
+                                                      std::int64_t batch_size) {
+    trttp_batch_precondition(queue, upper_lower, n, a, lda, stride_a, ap, stride_ap, batch_size);
+    onemkl::cublas::trttp_batch(queue, upper_lower, n, a, lda, stride_a, ap, stride_ap, batch_size);
+    trttp_batch_postcondition(queue, upper_lower, n, a, lda, stride_a, ap, stride_ap, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void trttp_batch(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                               cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                               std::int64_t stride_a, cl::sycl::buffer<double, 1> &ap,
+                               std::int64_t stride_ap, std::int64_t batch_size);
+template <>
+void trttp_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, uplo upper_lower,
+                                                      std::int64_t n,
+                                                      cl::sycl::buffer<double, 1> &a,
+                                                      std::int64_t lda, std::int64_t stride_a,
+                                                      cl::sycl::buffer<double, 1> &ap,
+                                                      std::int64_t stride_ap,
+                                                      std::int64_t batch_size) {
+    trttp_batch_precondition(queue, upper_lower, n, a, lda, stride_a, ap, stride_ap, batch_size);
+    onemkl::cublas::trttp_batch(queue, upper_lower, n, a, lda, stride_a, ap, stride_ap, batch_size);
+    trttp_batch_postcondition(queue, upper_lower, n, a, lda, stride_a, ap, stride_ap, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void trttp_batch(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                               cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                               std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &ap,
+                               std::int64_t stride_ap, std::int64_t batch_size);
+template <>
+void trttp_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, uplo upper_lower,
+                                                      std::int64_t n,
+                                                      cl::sycl::buffer<std::complex<float>, 1> &a,
+                                                      std::int64_t lda, std::int64_t stride_a,
+                                                      cl::sycl::buffer<std::complex<float>, 1> &ap,
+                                                      std::int64_t stride_ap,
+                                                      std::int64_t batch_size) {
+    trttp_batch_precondition(queue, upper_lower, n, a, lda, stride_a, ap, stride_ap, batch_size);
+    onemkl::cublas::trttp_batch(queue, upper_lower, n, a, lda, stride_a, ap, stride_ap, batch_size);
+    trttp_batch_postcondition(queue, upper_lower, n, a, lda, stride_a, ap, stride_ap, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void trttp_batch(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                               cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                               std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &ap,
+                               std::int64_t stride_ap, std::int64_t batch_size);
+template <>
+void trttp_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, uplo upper_lower,
+                                                      std::int64_t n,
+                                                      cl::sycl::buffer<std::complex<double>, 1> &a,
+                                                      std::int64_t lda, std::int64_t stride_a,
+                                                      cl::sycl::buffer<std::complex<double>, 1> &ap,
+                                                      std::int64_t stride_ap,
+                                                      std::int64_t batch_size) {
+    trttp_batch_precondition(queue, upper_lower, n, a, lda, stride_a, ap, stride_ap, batch_size);
+    onemkl::cublas::trttp_batch(queue, upper_lower, n, a, lda, stride_a, ap, stride_ap, batch_size);
+    trttp_batch_postcondition(queue, upper_lower, n, a, lda, stride_a, ap, stride_ap, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        float alpha, cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                        cl::sycl::buffer<float, 1> &y, std::int64_t incy);
+template <>
+void gemv<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, transpose trans,
+                                               std::int64_t m, std::int64_t n, float alpha,
+                                               cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+                                               cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                               float beta, cl::sycl::buffer<float, 1> &y,
+                                               std::int64_t incy) {
+    gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    onemkl::cublas::gemv(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        float alpha, cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                        cl::sycl::buffer<float, 1> &y, std::int64_t incy);
+template <>
+void gemv<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, transpose trans,
+                                               std::int64_t m, std::int64_t n, float alpha,
+                                               cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                                               cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                               float beta, cl::sycl::buffer<float, 1> &y,
+                                               std::int64_t incy) {
+    gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    onemkl::cublas::gemv(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemv_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                              std::int64_t n, float alpha, cl::sycl::buffer<half, 1> &a,
+                              std::int64_t lda, std::int64_t stride_a,
+                              cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, float beta, cl::sycl::buffer<float, 1> &y,
+                              std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size);
+template <>
+void gemv_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, transpose trans,
+                                                     std::int64_t m, std::int64_t n, float alpha,
+                                                     cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+                                                     std::int64_t stride_a,
+                                                     cl::sycl::buffer<float, 1> &x,
+                                                     std::int64_t incx, std::int64_t stride_x,
+                                                     float beta, cl::sycl::buffer<float, 1> &y,
+                                                     std::int64_t incy, std::int64_t stride_y,
+                                                     std::int64_t batch_size) {
+    gemv_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta, y,
+                            incy, stride_y, batch_size);
+    onemkl::cublas::gemv_batch(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta,
+                               y, incy, stride_y, batch_size);
+    gemv_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta,
+                             y, incy, stride_y, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemv_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                              std::int64_t n, float alpha, cl::sycl::buffer<bfloat16, 1> &a,
+                              std::int64_t lda, std::int64_t stride_a,
+                              cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                              std::int64_t stride_x, float beta, cl::sycl::buffer<float, 1> &y,
+                              std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size);
+template <>
+void gemv_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, transpose trans,
+                                                     std::int64_t m, std::int64_t n, float alpha,
+                                                     cl::sycl::buffer<bfloat16, 1> &a,
+                                                     std::int64_t lda, std::int64_t stride_a,
+                                                     cl::sycl::buffer<float, 1> &x,
+                                                     std::int64_t incx, std::int64_t stride_x,
+                                                     float beta, cl::sycl::buffer<float, 1> &y,
+                                                     std::int64_t incy, std::int64_t stride_y,
+                                                     std::int64_t batch_size) {
+    gemv_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta, y,
+                            incy, stride_y, batch_size);
+    onemkl::cublas::gemv_batch(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta,
+                               y, incy, stride_y, batch_size);
+    gemv_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, x, incx, stride_x, beta,
+                             y, incy, stride_y, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void lange(cl::sycl::queue &queue, norm_type norm, transpose trans, std::int64_t m,
+                         std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                         cl::sycl::buffer<float, 1> &result);
+template <>
+void lange<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, norm_type norm,
+                                                transpose trans, std::int64_t m, std::int64_t n,
+                                                cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                                cl::sycl::buffer<float, 1> &result) {
+    lange_precondition(queue, norm, trans, m, n, a, lda, result);
+    onemkl::cublas::lange(queue, norm, trans, m, n, a, lda, result);
+    lange_postcondition(queue, norm, trans, m, n, a, lda, result);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void lange(cl::sycl::queue &queue, norm_type norm, transpose trans, std::int64_t m,
+                         std::int64_t n, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                         cl::sycl::buffer<double, 1> &result);
+template <>
+void lange<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, norm_type norm,
+                                                transpose trans, std::int64_t m, std::int64_t n,
+                                                cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                                cl::sycl::buffer<double, 1> &result) {
+    lange_precondition(queue, norm, trans, m, n, a, lda, result);
+    onemkl::cublas::lange(queue, norm, trans, m, n, a, lda, result);
+    lange_postcondition(queue, norm, trans, m, n, a, lda, result);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void reduce_columns(cl::sycl::queue &queue, reduction op, transpose trans,
+                                  std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a,
+                                  std::int64_t lda, cl::sycl::buffer<float, 1> &y,
+                                  std::int64_t incy);
+template <>
+void reduce_columns<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, reduction op,
+                                                         transpose trans, std::int64_t m,
+                                                         std::int64_t n,
+                                                         cl::sycl::buffer<float, 1> &a,
+                                                         std::int64_t lda,
+                                                         cl::sycl::buffer<float, 1> &y,
+                                                         std::int64_t incy) {
+    reduce_columns_precondition(queue, op, trans, m, n, a, lda, y, incy);
+    onemkl::cublas::reduce_columns(queue, op, trans, m, n, a, lda, y, incy);
+    reduce_columns_postcondition(queue, op, trans, m, n, a, lda, y, incy);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void reduce_columns(cl::sycl::queue &queue, reduction op, transpose trans,
+                                  std::int64_t m, std::int64_t n, cl::sycl::buffer<double, 1> &a,
+                                  std::int64_t lda, cl::sycl::buffer<double, 1> &y,
+                                  std::int64_t incy);
+template <>
+void reduce_columns<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, reduction op,
+                                                         transpose trans, std::int64_t m,
+                                                         std::int64_t n,
+                                                         cl::sycl::buffer<double, 1> &a,
+                                                         std::int64_t lda,
+                                                         cl::sycl::buffer<double, 1> &y,
+                                                         std::int64_t incy) {
+    reduce_columns_precondition(queue, op, trans, m, n, a, lda, y, incy);
+    onemkl::cublas::reduce_columns(queue, op, trans, m, n, a, lda, y, incy);
+    reduce_columns_postcondition(queue, op, trans, m, n, a, lda, y, incy);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void reduce_rows(cl::sycl::queue &queue, reduction op, transpose trans,
+                               std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a,
+                               std::int64_t lda, cl::sycl::buffer<float, 1> &y, std::int64_t incy);
+template <>
+void reduce_rows<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, reduction op,
+                                                      transpose trans, std::int64_t m,
+                                                      std::int64_t n, cl::sycl::buffer<float, 1> &a,
+                                                      std::int64_t lda,
+                                                      cl::sycl::buffer<float, 1> &y,
+                                                      std::int64_t incy) {
+    reduce_rows_precondition(queue, op, trans, m, n, a, lda, y, incy);
+    onemkl::cublas::reduce_rows(queue, op, trans, m, n, a, lda, y, incy);
+    reduce_rows_postcondition(queue, op, trans, m, n, a, lda, y, incy);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void reduce_rows(cl::sycl::queue &queue, reduction op, transpose trans,
+                               std::int64_t m, std::int64_t n, cl::sycl::buffer<double, 1> &a,
+                               std::int64_t lda, cl::sycl::buffer<double, 1> &y, std::int64_t incy);
+template <>
+void reduce_rows<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, reduction op,
+                                                      transpose trans, std::int64_t m,
+                                                      std::int64_t n,
+                                                      cl::sycl::buffer<double, 1> &a,
+                                                      std::int64_t lda,
+                                                      cl::sycl::buffer<double, 1> &y,
+                                                      std::int64_t incy) {
+    reduce_rows_precondition(queue, op, trans, m, n, a, lda, y, incy);
+    onemkl::cublas::reduce_rows(queue, op, trans, m, n, a, lda, y, incy);
+    reduce_rows_postcondition(queue, op, trans, m, n, a, lda, y, incy);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatclamp(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float lo,
+                             float hi, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                             cl::sycl::buffer<float, 1> &b, std::int64_t ldb);
+template <>
+void omatclamp<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                    std::int64_t n, float lo, float hi,
+                                                    cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                                    cl::sycl::buffer<float, 1> &b,
+                                                    std::int64_t ldb) {
+    omatclamp_precondition(queue, m, n, lo, hi, a, lda, b, ldb);
+    onemkl::cublas::omatclamp(queue, m, n, lo, hi, a, lda, b, ldb);
+    omatclamp_postcondition(queue, m, n, lo, hi, a, lda, b, ldb);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatclamp(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, double lo,
+                             double hi, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                             cl::sycl::buffer<double, 1> &b, std::int64_t ldb);
+template <>
+void omatclamp<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                    std::int64_t n, double lo, double hi,
+                                                    cl::sycl::buffer<double, 1> &a,
+                                                    std::int64_t lda,
+                                                    cl::sycl::buffer<double, 1> &b,
+                                                    std::int64_t ldb) {
+    omatclamp_precondition(queue, m, n, lo, hi, a, lda, b, ldb);
+    onemkl::cublas::omatclamp(queue, m, n, lo, hi, a, lda, b, ldb);
+    omatclamp_postcondition(queue, m, n, lo, hi, a, lda, b, ldb);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatclamp_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float lo,
+                                   float hi, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                   std::int64_t stride_a, cl::sycl::buffer<float, 1> &b,
+                                   std::int64_t ldb, std::int64_t stride_b,
+                                   std::int64_t batch_size);
+template <>
+void omatclamp_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                          std::int64_t n, float lo, float hi,
+                                                          cl::sycl::buffer<float, 1> &a,
+                                                          std::int64_t lda, std::int64_t stride_a,
+                                                          cl::sycl::buffer<float, 1> &b,
+                                                          std::int64_t ldb, std::int64_t stride_b,
+                                                          std::int64_t batch_size) {
+    omatclamp_batch_precondition(queue, m, n, lo, hi, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size);
+    onemkl::cublas::omatclamp_batch(queue, m, n, lo, hi, a, lda, stride_a, b, ldb, stride_b,
+                                    batch_size);
+    omatclamp_batch_postcondition(queue, m, n, lo, hi, a, lda, stride_a, b, ldb, stride_b,
+                                  batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatclamp_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                   double lo, double hi, cl::sycl::buffer<double, 1> &a,
+                                   std::int64_t lda, std::int64_t stride_a,
+                                   cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                   std::int64_t stride_b, std::int64_t batch_size);
+template <>
+void omatclamp_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                          std::int64_t n, double lo, double hi,
+                                                          cl::sycl::buffer<double, 1> &a,
+                                                          std::int64_t lda, std::int64_t stride_a,
+                                                          cl::sycl::buffer<double, 1> &b,
+                                                          std::int64_t ldb, std::int64_t stride_b,
+                                                          std::int64_t batch_size) {
+    omatclamp_batch_precondition(queue, m, n, lo, hi, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size);
+    onemkl::cublas::omatclamp_batch(queue, m, n, lo, hi, a, lda, stride_a, b, ldb, stride_b,
+                                    batch_size);
+    omatclamp_batch_postcondition(queue, m, n, lo, hi, a, lda, stride_a, b, ldb, stride_b,
+                                  batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatdiv(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+template <>
+void omatdiv<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                  std::int64_t n, cl::sycl::buffer<float, 1> &a,
+                                                  std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+                                                  std::int64_t ldb, cl::sycl::buffer<float, 1> &c,
+                                                  std::int64_t ldc) {
+    omatdiv_precondition(queue, m, n, a, lda, b, ldb, c, ldc);
+    onemkl::cublas::omatdiv(queue, m, n, a, lda, b, ldb, c, ldc);
+    omatdiv_postcondition(queue, m, n, a, lda, b, ldb, c, ldc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatdiv(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
+template <>
+void omatdiv<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                  std::int64_t n, cl::sycl::buffer<double, 1> &a,
+                                                  std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+                                                  std::int64_t ldb, cl::sycl::buffer<double, 1> &c,
+                                                  std::int64_t ldc) {
+    omatdiv_precondition(queue, m, n, a, lda, b, ldb, c, ldc);
+    onemkl::cublas::omatdiv(queue, m, n, a, lda, b, ldb, c, ldc);
+    omatdiv_postcondition(queue, m, n, a, lda, b, ldb, c, ldc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatdiv(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+template <>
+void omatdiv<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                  std::int64_t n,
+                                                  cl::sycl::buffer<std::complex<float>, 1> &a,
+                                                  std::int64_t lda,
+                                                  cl::sycl::buffer<std::complex<float>, 1> &b,
+                                                  std::int64_t ldb,
+                                                  cl::sycl::buffer<std::complex<float>, 1> &c,
+                                                  std::int64_t ldc) {
+    omatdiv_precondition(queue, m, n, a, lda, b, ldb, c, ldc);
+    onemkl::cublas::omatdiv(queue, m, n, a, lda, b, ldb, c, ldc);
+    omatdiv_postcondition(queue, m, n, a, lda, b, ldb, c, ldc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatdiv(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+template <>
+void omatdiv<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                  std::int64_t n,
+                                                  cl::sycl::buffer<std::complex<double>, 1> &a,
+                                                  std::int64_t lda,
+                                                  cl::sycl::buffer<std::complex<double>, 1> &b,
+                                                  std::int64_t ldb,
+                                                  cl::sycl::buffer<std::complex<double>, 1> &c,
+                                                  std::int64_t ldc) {
+    omatdiv_precondition(queue, m, n, a, lda, b, ldb, c, ldc);
+    onemkl::cublas::omatdiv(queue, m, n, a, lda, b, ldb, c, ldc);
+    omatdiv_postcondition(queue, m, n, a, lda, b, ldb, c, ldc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatdiv_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, cl::sycl::buffer<float, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b,
+                                 cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void omatdiv_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a,
+    std::int64_t lda, std::int64_t stride_a, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+    std::int64_t stride_b, cl::sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size) {
+    omatdiv_batch_precondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                               batch_size);
+    onemkl::cublas::omatdiv_batch(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                                  batch_size);
+    omatdiv_batch_postcondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                                batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatdiv_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, cl::sycl::buffer<double, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b,
+                                 cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void omatdiv_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t m, std::int64_t n, cl::sycl::buffer<double, 1> &a,
+    std::int64_t lda, std::int64_t stride_a, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+    std::int64_t stride_b, cl::sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size) {
+    omatdiv_batch_precondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                               batch_size);
+    onemkl::cublas::omatdiv_batch(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                                  batch_size);
+    omatdiv_batch_postcondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                                batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatdiv_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b,
+                                 cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void omatdiv_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                        std::int64_t n,
+                                                        cl::sycl::buffer<std::complex<float>, 1> &a,
+                                                        std::int64_t lda, std::int64_t stride_a,
+                                                        cl::sycl::buffer<std::complex<float>, 1> &b,
+                                                        std::int64_t ldb, std::int64_t stride_b,
+                                                        cl::sycl::buffer<std::complex<float>, 1> &c,
+                                                        std::int64_t ldc, std::int64_t stride_c,
+                                                        std::int64_t batch_size) {
+    omatdiv_batch_precondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                               batch_size);
+    onemkl::cublas::omatdiv_batch(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                                  batch_size);
+    omatdiv_batch_postcondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                                batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatdiv_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a,
+                                 cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                 std::int64_t stride_b,
+                                 cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void omatdiv_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+    cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda, std::int64_t stride_a,
+    cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+    cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size) {
+    omatdiv_batch_precondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                               batch_size);
+    onemkl::cublas::omatdiv_batch(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                                  batch_size);
+    omatdiv_batch_postcondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                                batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatfma(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float alpha,
+                           cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+                           cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+template <>
+void omatfma<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                  std::int64_t n, float alpha,
+                                                  cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                                  cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                                  float beta, cl::sycl::buffer<float, 1> &c,
+                                                  std::int64_t ldc) {
+    omatfma_precondition(queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+    onemkl::cublas::omatfma(queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+    omatfma_postcondition(queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatfma(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, double alpha,
+                           cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+                           cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
+template <>
+void omatfma<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                  std::int64_t n, double alpha,
+                                                  cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                                  cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                                  double beta, cl::sycl::buffer<double, 1> &c,
+                                                  std::int64_t ldc) {
+    omatfma_precondition(queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+    onemkl::cublas::omatfma(queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+    omatfma_postcondition(queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatfma(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                           std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
+                           std::int64_t ldb, std::complex<float> beta,
+                           cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+template <>
+void omatfma<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                  std::int64_t n, std::complex<float> alpha,
+                                                  cl::sycl::buffer<std::complex<float>, 1> &a,
+                                                  std::int64_t lda,
+                                                  cl::sycl::buffer<std::complex<float>, 1> &b,
+                                                  std::int64_t ldb, std::complex<float> beta,
+                                                  cl::sycl::buffer<std::complex<float>, 1> &c,
+                                                  std::int64_t ldc) {
+    omatfma_precondition(queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+    onemkl::cublas::omatfma(queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+    omatfma_postcondition(queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatfma(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                           std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
+                           std::int64_t ldb, std::complex<double> beta,
+                           cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+template <>
+void omatfma<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                  std::int64_t n, std::complex<double> alpha,
+                                                  cl::sycl::buffer<std::complex<double>, 1> &a,
+                                                  std::int64_t lda,
+                                                  cl::sycl::buffer<std::complex<double>, 1> &b,
+                                                  std::int64_t ldb, std::complex<double> beta,
+                                                  cl::sycl::buffer<std::complex<double>, 1> &c,
+                                                  std::int64_t ldc) {
+    omatfma_precondition(queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+    onemkl::cublas::omatfma(queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+    omatfma_postcondition(queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatfma_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, cl::sycl::buffer<float, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b, float beta,
+                                 cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void omatfma_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                        std::int64_t n, float alpha,
+                                                        cl::sycl::buffer<float, 1> &a,
+                                                        std::int64_t lda, std::int64_t stride_a,
+                                                        cl::sycl::buffer<float, 1> &b,
+                                                        std::int64_t ldb, std::int64_t stride_b,
+                                                        float beta, cl::sycl::buffer<float, 1> &c,
+                                                        std::int64_t ldc, std::int64_t stride_c,
+                                                        std::int64_t batch_size) {
+    omatfma_batch_precondition(queue, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+                               stride_c, batch_size);
+    onemkl::cublas::omatfma_batch(queue, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c,
+                                  ldc, stride_c, batch_size);
+    omatfma_batch_postcondition(queue, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c,
+                                ldc, stride_c, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatfma_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, cl::sycl::buffer<double, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b, double beta,
+                                 cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void omatfma_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                        std::int64_t n, double alpha,
+                                                        cl::sycl::buffer<double, 1> &a,
+                                                        std::int64_t lda, std::int64_t stride_a,
+                                                        cl::sycl::buffer<double, 1> &b,
+                                                        std::int64_t ldb, std::int64_t stride_b,
+                                                        double beta, cl::sycl::buffer<double, 1> &c,
+                                                        std::int64_t ldc, std::int64_t stride_c,
+                                                        std::int64_t batch_size) {
+    omatfma_batch_precondition(queue, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+                               stride_c, batch_size);
+    onemkl::cublas::omatfma_batch(queue, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c,
+                                  ldc, stride_c, batch_size);
+    omatfma_batch_postcondition(queue, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c,
+                                ldc, stride_c, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatfma_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 std::complex<float> alpha,
+                                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b, std::complex<float> beta,
+                                 cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void omatfma_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<float> alpha,
+    cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda, std::int64_t stride_a,
+    cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+    std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+    std::int64_t stride_c, std::int64_t batch_size) {
+    omatfma_batch_precondition(queue, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+                               stride_c, batch_size);
+    onemkl::cublas::omatfma_batch(queue, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c,
+                                  ldc, stride_c, batch_size);
+    omatfma_batch_postcondition(queue, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c,
+                                ldc, stride_c, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatfma_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 std::complex<double> alpha,
+                                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a,
+                                 cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                 std::int64_t stride_b, std::complex<double> beta,
+                                 cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void omatfma_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<double> alpha,
+    cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda, std::int64_t stride_a,
+    cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+    std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+    std::int64_t stride_c, std::int64_t batch_size) {
+    omatfma_batch_precondition(queue, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+                               stride_c, batch_size);
+    onemkl::cublas::omatfma_batch(queue, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c,
+                                  ldc, stride_c, batch_size);
+    omatfma_batch_postcondition(queue, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c,
+                                ldc, stride_c, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatmul(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+template <>
+void omatmul<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                  std::int64_t n, cl::sycl::buffer<float, 1> &a,
+                                                  std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+                                                  std::int64_t ldb, cl::sycl::buffer<float, 1> &c,
+                                                  std::int64_t ldc) {
+    omatmul_precondition(queue, m, n, a, lda, b, ldb, c, ldc);
+    onemkl::cublas::omatmul(queue, m, n, a, lda, b, ldb, c, ldc);
+    omatmul_postcondition(queue, m, n, a, lda, b, ldb, c, ldc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatmul(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
+template <>
+void omatmul<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                  std::int64_t n, cl::sycl::buffer<double, 1> &a,
+                                                  std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+                                                  std::int64_t ldb, cl::sycl::buffer<double, 1> &c,
+                                                  std::int64_t ldc) {
+    omatmul_precondition(queue, m, n, a, lda, b, ldb, c, ldc);
+    onemkl::cublas::omatmul(queue, m, n, a, lda, b, ldb, c, ldc);
+    omatmul_postcondition(queue, m, n, a, lda, b, ldb, c, ldc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatmul(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+template <>
+void omatmul<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                  std::int64_t n,
+                                                  cl::sycl::buffer<std::complex<float>, 1> &a,
+                                                  std::int64_t lda,
+                                                  cl::sycl::buffer<std::complex<float>, 1> &b,
+                                                  std::int64_t ldb,
+                                                  cl::sycl::buffer<std::complex<float>, 1> &c,
+                                                  std::int64_t ldc) {
+    omatmul_precondition(queue, m, n, a, lda, b, ldb, c, ldc);
+    onemkl::cublas::omatmul(queue, m, n, a, lda, b, ldb, c, ldc);
+    omatmul_postcondition(queue, m, n, a, lda, b, ldb, c, ldc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatmul(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+template <>
+void omatmul<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                  std::int64_t n,
+                                                  cl::sycl::buffer<std::complex<double>, 1> &a,
+                                                  std::int64_t lda,
+                                                  cl::sycl::buffer<std::complex<double>, 1> &b,
+                                                  std::int64_t ldb,
+                                                  cl::sycl::buffer<std::complex<double>, 1> &c,
+                                                  std::int64_t ldc) {
+    omatmul_precondition(queue, m, n, a, lda, b, ldb, c, ldc);
+    onemkl::cublas::omatmul(queue, m, n, a, lda, b, ldb, c, ldc);
+    omatmul_postcondition(queue, m, n, a, lda, b, ldb, c, ldc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatmul_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, cl::sycl::buffer<float, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b,
+                                 cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void omatmul_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a,
+    std::int64_t lda, std::int64_t stride_a, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+    std::int64_t stride_b, cl::sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size) {
+    omatmul_batch_precondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                               batch_size);
+    onemkl::cublas::omatmul_batch(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                                  batch_size);
+    omatmul_batch_postcondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                                batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatmul_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, cl::sycl::buffer<double, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b,
+                                 cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void omatmul_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t m, std::int64_t n, cl::sycl::buffer<double, 1> &a,
+    std::int64_t lda, std::int64_t stride_a, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+    std::int64_t stride_b, cl::sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size) {
+    omatmul_batch_precondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                               batch_size);
+    onemkl::cublas::omatmul_batch(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                                  batch_size);
+    omatmul_batch_postcondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                                batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatmul_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b,
+                                 cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void omatmul_batch<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t m,
+                                                        std::int64_t n,
+                                                        cl::sycl::buffer<std::complex<float>, 1> &a,
+                                                        std::int64_t lda, std::int64_t stride_a,
+                                                        cl::sycl::buffer<std::complex<float>, 1> &b,
+                                                        std::int64_t ldb, std::int64_t stride_b,
+                                                        cl::sycl::buffer<std::complex<float>, 1> &c,
+                                                        std::int64_t ldc, std::int64_t stride_c,
+                                                        std::int64_t batch_size) {
+    omatmul_batch_precondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                               batch_size);
+    onemkl::cublas::omatmul_batch(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                                  batch_size);
+    omatmul_batch_postcondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                                batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void omatmul_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a,
+                                 cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                 std::int64_t stride_b,
+                                 cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void omatmul_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+    cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda, std::int64_t stride_a,
+    cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+    cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size) {
+    omatmul_batch_precondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                               batch_size);
+    onemkl::cublas::omatmul_batch(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                                  batch_size);
+    omatmul_batch_postcondition(queue, m, n, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c,
+                                batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void vclamp(cl::sycl::queue &queue, std::int64_t n, float lo, float hi,
+                          cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                          cl::sycl::buffer<float, 1> &y, std::int64_t incy);
+template <>
+void vclamp<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n, float lo,
+                                                 float hi, cl::sycl::buffer<float, 1> &x,
+                                                 std::int64_t incx, cl::sycl::buffer<float, 1> &y,
+                                                 std::int64_t incy) {
+    vclamp_precondition(queue, n, lo, hi, x, incx, y, incy);
+    onemkl::cublas::vclamp(queue, n, lo, hi, x, incx, y, incy);
+    vclamp_postcondition(queue, n, lo, hi, x, incx, y, incy);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void vclamp(cl::sycl::queue &queue, std::int64_t n, double lo, double hi,
+                          cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                          cl::sycl::buffer<double, 1> &y, std::int64_t incy);
+template <>
+void vclamp<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n, double lo,
+                                                 double hi, cl::sycl::buffer<double, 1> &x,
+                                                 std::int64_t incx, cl::sycl::buffer<double, 1> &y,
+                                                 std::int64_t incy) {
+    vclamp_precondition(queue, n, lo, hi, x, incx, y, incy);
+    onemkl::cublas::vclamp(queue, n, lo, hi, x, incx, y, incy);
+    vclamp_postcondition(queue, n, lo, hi, x, incx, y, incy);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void vdiv(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                        std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                        cl::sycl::buffer<float, 1> &z, std::int64_t incz);
+template <>
+void vdiv<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                               cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                               cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                                               cl::sycl::buffer<float, 1> &z, std::int64_t incz) {
+    vdiv_precondition(queue, n, x, incx, y, incy, z, incz);
+    onemkl::cublas::vdiv(queue, n, x, incx, y, incy, z, incz);
+    vdiv_postcondition(queue, n, x, incx, y, incy, z, incz);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void vdiv(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                        std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                        cl::sycl::buffer<double, 1> &z, std::int64_t incz);
+template <>
+void vdiv<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                               cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                               cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                                               cl::sycl::buffer<double, 1> &z, std::int64_t incz) {
+    vdiv_precondition(queue, n, x, incx, y, incy, z, incz);
+    onemkl::cublas::vdiv(queue, n, x, incx, y, incy, z, incz);
+    vdiv_postcondition(queue, n, x, incx, y, incy, z, incz);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void vdiv(cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                        cl::sycl::buffer<std::complex<float>, 1> &z, std::int64_t incz);
+template <>
+void vdiv<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                               cl::sycl::buffer<std::complex<float>, 1> &x,
+                                               std::int64_t incx,
+                                               cl::sycl::buffer<std::complex<float>, 1> &y,
+                                               std::int64_t incy,
+                                               cl::sycl::buffer<std::complex<float>, 1> &z,
+                                               std::int64_t incz) {
+    vdiv_precondition(queue, n, x, incx, y, incy, z, incz);
+    onemkl::cublas::vdiv(queue, n, x, incx, y, incy, z, incz);
+    vdiv_postcondition(queue, n, x, incx, y, incy, z, incz);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void vdiv(cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                        cl::sycl::buffer<std::complex<double>, 1> &z, std::int64_t incz);
+template <>
+void vdiv<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                               cl::sycl::buffer<std::complex<double>, 1> &x,
+                                               std::int64_t incx,
+                                               cl::sycl::buffer<std::complex<double>, 1> &y,
+                                               std::int64_t incy,
+                                               cl::sycl::buffer<std::complex<double>, 1> &z,
+                                               std::int64_t incz) {
+    vdiv_precondition(queue, n, x, incx, y, incy, z, incz);
+    onemkl::cublas::vdiv(queue, n, x, incx, y, incy, z, incz);
+    vdiv_postcondition(queue, n, x, incx, y, incy, z, incz);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void vfma(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                        cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<float, 1> &y, std::int64_t incy, float beta,
+                        cl::sycl::buffer<float, 1> &z, std::int64_t incz);
+template <>
+void vfma<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                                               cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                               cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                                               float beta, cl::sycl::buffer<float, 1> &z,
+                                               std::int64_t incz) {
+    vfma_precondition(queue, n, alpha, x, incx, y, incy, beta, z, incz);
+    onemkl::cublas::vfma(queue, n, alpha, x, incx, y, incy, beta, z, incz);
+    vfma_postcondition(queue, n, alpha, x, incx, y, incy, beta, z, incz);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void vfma(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                        cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<double, 1> &y, std::int64_t incy, double beta,
+                        cl::sycl::buffer<double, 1> &z, std::int64_t incz);
+template <>
+void vfma<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                                               cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                               cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                                               double beta, cl::sycl::buffer<double, 1> &z,
+                                               std::int64_t incz) {
+    vfma_precondition(queue, n, alpha, x, incx, y, incy, beta, z, incz);
+    onemkl::cublas::vfma(queue, n, alpha, x, incx, y, incy, beta, z, incz);
+    vfma_postcondition(queue, n, alpha, x, incx, y, incy, beta, z, incz);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void vfma(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                        std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &z,
+                        std::int64_t incz);
+template <>
+void vfma<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                               std::complex<float> alpha,
+                                               cl::sycl::buffer<std::complex<float>, 1> &x,
+                                               std::int64_t incx,
+                                               cl::sycl::buffer<std::complex<float>, 1> &y,
+                                               std::int64_t incy, std::complex<float> beta,
+                                               cl::sycl::buffer<std::complex<float>, 1> &z,
+                                               std::int64_t incz) {
+    vfma_precondition(queue, n, alpha, x, incx, y, incy, beta, z, incz);
+    onemkl::cublas::vfma(queue, n, alpha, x, incx, y, incy, beta, z, incz);
+    vfma_postcondition(queue, n, alpha, x, incx, y, incy, beta, z, incz);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void vfma(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                        std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &z,
+                        std::int64_t incz);
+template <>
+void vfma<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                               std::complex<double> alpha,
+                                               cl::sycl::buffer<std::complex<double>, 1> &x,
+                                               std::int64_t incx,
+                                               cl::sycl::buffer<std::complex<double>, 1> &y,
+                                               std::int64_t incy, std::complex<double> beta,
+                                               cl::sycl::buffer<std::complex<double>, 1> &z,
+                                               std::int64_t incz) {
+    vfma_precondition(queue, n, alpha, x, incx, y, incy, beta, z, incz);
+    onemkl::cublas::vfma(queue, n, alpha, x, incx, y, incy, beta, z, incz);
+    vfma_postcondition(queue, n, alpha, x, incx, y, incy, beta, z, incz);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void vmul(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                        std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                        cl::sycl::buffer<float, 1> &z, std::int64_t incz);
+template <>
+void vmul<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                               cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                               cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                                               cl::sycl::buffer<float, 1> &z, std::int64_t incz) {
+    vmul_precondition(queue, n, x, incx, y, incy, z, incz);
+    onemkl::cublas::vmul(queue, n, x, incx, y, incy, z, incz);
+    vmul_postcondition(queue, n, x, incx, y, incy, z, incz);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void vmul(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                        std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                        cl::sycl::buffer<double, 1> &z, std::int64_t incz);
+template <>
+void vmul<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                               cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                               cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                                               cl::sycl::buffer<double, 1> &z, std::int64_t incz) {
+    vmul_precondition(queue, n, x, incx, y, incy, z, incz);
+    onemkl::cublas::vmul(queue, n, x, incx, y, incy, z, incz);
+    vmul_postcondition(queue, n, x, incx, y, incy, z, incz);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void vmul(cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                        cl::sycl::buffer<std::complex<float>, 1> &z, std::int64_t incz);
+template <>
+void vmul<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                               cl::sycl::buffer<std::complex<float>, 1> &x,
+                                               std::int64_t incx,
+                                               cl::sycl::buffer<std::complex<float>, 1> &y,
+                                               std::int64_t incy,
+                                               cl::sycl::buffer<std::complex<float>, 1> &z,
+                                               std::int64_t incz) {
+    vmul_precondition(queue, n, x, incx, y, incy, z, incz);
+    onemkl::cublas::vmul(queue, n, x, incx, y, incy, z, incz);
+    vmul_postcondition(queue, n, x, incx, y, incy, z, incz);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void vmul(cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                        cl::sycl::buffer<std::complex<double>, 1> &z, std::int64_t incz);
+template <>
+void vmul<library::cublas, backend::nvidiagpu>(cl::sycl::queue &queue, std::int64_t n,
+                                               cl::sycl::buffer<std::complex<double>, 1> &x,
+                                               std::int64_t incx,
+                                               cl::sycl::buffer<std::complex<double>, 1> &y,
+                                               std::int64_t incy,
+                                               cl::sycl::buffer<std::complex<double>, 1> &z,
+                                               std::int64_t incz) {
+    vmul_precondition(queue, n, x, incx, y, incy, z, incz);
+    onemkl::cublas::vmul(queue, n, x, incx, y, incy, z, incz);
+    vmul_postcondition(queue, n, x, incx, y, incy, z, incz);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb,
+                          std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                          cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                          cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                          std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+                          std::int64_t ldc);
+template <>
+void gemm3m<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+    std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+    std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    gemm3m_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    onemkl::cublas::gemm3m(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    gemm3m_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb,
+                          std::int64_t m, std::int64_t n, std::int64_t k,
+                          std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                          std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
+                          std::int64_t ldb, std::complex<double> beta,
+                          cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+template <>
+void gemm3m<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+    std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+    std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    gemm3m_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    onemkl::cublas::gemm3m(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    gemm3m_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm3m_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                std::int64_t m, std::int64_t n, std::int64_t k,
+                                std::complex<float> alpha,
+                                cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                                std::int64_t ldb, std::int64_t stride_b, std::complex<float> beta,
+                                cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                                std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void gemm3m_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+    std::int64_t lda, std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+    std::int64_t ldb, std::int64_t stride_b, std::complex<float> beta,
+    cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size) {
+    gemm3m_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                              stride_b, beta, c, ldc, stride_c, batch_size);
+    onemkl::cublas::gemm3m_batch(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                 stride_b, beta, c, ldc, stride_c, batch_size);
+    gemm3m_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size);
+}
+
+template <onemkl::library lib, onemkl::backend backend>
+static inline void gemm3m_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                std::int64_t m, std::int64_t n, std::int64_t k,
+                                std::complex<double> alpha,
+                                cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                                std::int64_t ldb, std::int64_t stride_b, std::complex<double> beta,
+                                cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                std::int64_t stride_c, std::int64_t batch_size);
+template <>
+void gemm3m_batch<library::cublas, backend::nvidiagpu>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+    std::int64_t lda, std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+    std::int64_t ldb, std::int64_t stride_b, std::complex<double> beta,
+    cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size) {
+    gemm3m_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                              stride_b, beta, c, ldc, stride_c, batch_size);
+    onemkl::cublas::gemm3m_batch(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                 stride_b, beta, c, ldc, stride_c, batch_size);
+    gemm3m_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size);
+}
+
 } //namespace blas
 } //namespace onemkl
 
@@ -0,0 +1,218 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _GEMM_MULTI_QUEUE_HPP_
+#define _GEMM_MULTI_QUEUE_HPP_
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <atomic>
+#include <complex>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "onemkl/types.hpp"
+
+#include "onemkl/blas/detail/cublas/blas_ct.hpp"
+#include "onemkl/blas/detail/mklcpu/blas_ct.hpp"
+#include "onemkl/blas/detail/mklgpu/blas_ct.hpp"
+
+namespace onemkl {
+namespace blas {
+namespace detail {
+
+// Tiles are whole column panels of C, which are disjoint ranges of the C
+// buffer. Their widths are multiples of this, so that the sub-buffer offsets
+// are aligned to 128 bytes for any element type of 2 bytes or more.
+static constexpr std::int64_t multi_queue_column_align = 64;
+
+// Number of tiles per queue with tile_schedule::work_stealing.
+static constexpr std::int64_t multi_queue_tiles_per_queue = 4;
+
+// Type the panels of a transposed op(B) are copied as. Complex values are
+// copied as pairs of reals, so that kernel names only involve real types.
+template <typename T>
+struct multi_queue_word {
+    using type = T;
+};
+
+template <typename R>
+struct multi_queue_word<std::complex<R>> {
+    using type = R;
+};
+
+template <typename W>
+class gemm_multi_queue_copy_b;
+
+// Copies rows [j0, j0 + nc) of the k columns of b into dest as an nc x k
+// matrix, every element being w consecutive words.
+template <typename W>
+static inline void multi_queue_copy_b(cl::sycl::queue &queue, cl::sycl::buffer<W, 1> &b,
+                                      std::int64_t ldb, std::int64_t j0, std::int64_t nc,
+                                      std::int64_t k, std::int64_t w,
+                                      cl::sycl::buffer<W, 1> &dest) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto src = b.template get_access<cl::sycl::access::mode::read>(cgh);
+        auto dst = dest.template get_access<cl::sycl::access::mode::discard_write>(cgh);
+        cgh.parallel_for<gemm_multi_queue_copy_b<W>>(
+            cl::sycl::range<2>(k, nc * w), [=](cl::sycl::item<2> item) {
+                const std::int64_t p  = item.get_id(0);
+                const std::int64_t jw = item.get_id(1);
+                dst[jw + nc * w * p]  = src[j0 * w + jw + ldb * w * p];
+            });
+    });
+}
+
+// Splits C = alpha * op(A) * op(B) + beta * C into column panels and runs
+// tile_gemm(queue, nc, b_tile, ldb_tile, c_tile) for each of them on one of
+// the queues. c_tile is a sub-buffer starting at the first column of the
+// panel of C. So is b_tile when B is not transposed. The panels of a
+// transposed op(B) are rows of B, whose ranges interleave in the buffer, so
+// each one is copied from the parent buffer into its own buffer instead of
+// being taken as overlapping sub-buffers. Returns once every tile has
+// completed, rethrowing the first exception raised on any of the queues.
+template <typename T, typename F>
+static inline void gemm_multi_queue(std::vector<cl::sycl::queue> &queues, tile_schedule schedule,
+                                    transpose transb, std::int64_t m, std::int64_t n,
+                                    std::int64_t k, cl::sycl::buffer<T, 1> &b, std::int64_t ldb,
+                                    cl::sycl::buffer<T, 1> &c, std::int64_t ldc, F tile_gemm) {
+    if (queues.empty())
+        throw std::runtime_error("gemm: no queue given");
+    if (m <= 0 || n <= 0)
+        return;
+
+    const std::int64_t nq = queues.size();
+    std::int64_t tiles    = nq;
+    if (schedule == tile_schedule::work_stealing)
+        tiles *= multi_queue_tiles_per_queue;
+
+    // Round the panel width up to a multiple of multi_queue_column_align.
+    const std::int64_t align = multi_queue_column_align;
+    const std::int64_t width = ((n + tiles - 1) / tiles + align - 1) / align * align;
+    tiles                    = (n + width - 1) / width;
+
+    // Copies of the panels of a transposed op(B), kept until every tile is done.
+    using W = typename multi_queue_word<T>::type;
+    std::vector<std::unique_ptr<cl::sycl::buffer<W, 1>>> b_copies(tiles);
+
+    auto run_tile = [&](cl::sycl::queue &queue, std::int64_t t) {
+        const std::int64_t j0 = t * width;
+        const std::int64_t nc = std::min(width, n - j0);
+        cl::sycl::buffer<T, 1> c_tile(c, cl::sycl::id<1>(ldc * j0),
+                                      cl::sycl::range<1>(ldc * (nc - 1) + m));
+        if (k == 0) {
+            // B is not referenced.
+            tile_gemm(queue, nc, b, ldb, c_tile);
+        }
+        else if (transb == transpose::nontrans) {
+            cl::sycl::buffer<T, 1> b_tile(b, cl::sycl::id<1>(ldb * j0),
+                                          cl::sycl::range<1>(ldb * (nc - 1) + k));
+            tile_gemm(queue, nc, b_tile, ldb, c_tile);
+        }
+        else {
+            const std::int64_t w = sizeof(T) / sizeof(W);
+            b_copies[t].reset(new cl::sycl::buffer<W, 1>(cl::sycl::range<1>(nc * k * w)));
+            auto b_words = b.template reinterpret<W, 1>(cl::sycl::range<1>(b.get_count() * w));
+            multi_queue_copy_b(queue, b_words, ldb, j0, nc, k, w, *b_copies[t]);
+            auto b_tile = b_copies[t]->template reinterpret<T, 1>(cl::sycl::range<1>(nc * k));
+            tile_gemm(queue, nc, b_tile, nc, c_tile);
+        }
+    };
+
+    // Exceptions are collected per queue and the first one is rethrown once
+    // every queue is idle, whatever the schedule.
+    std::vector<std::exception_ptr> errors(nq);
+    auto record = [&](std::int64_t q) {
+        if (!errors[q])
+            errors[q] = std::current_exception();
+    };
+
+    if (schedule == tile_schedule::work_stealing) {
+        // One host thread per queue. Each one takes the next tile that has not
+        // been started and waits for it before taking another one, so faster
+        // queues end up with more tiles.
+        std::atomic<std::int64_t> next(0);
+        auto worker = [&](std::int64_t q) {
+            try {
+                for (std::int64_t t = next++; t < tiles; t = next++) {
+                    run_tile(queues[q], t);
+                    queues[q].wait();
+                }
+            }
+            catch (...) {
+                record(q);
+            }
+        };
+        std::vector<std::thread> threads;
+        for (std::int64_t q = 1; q < nq; q++)
+            threads.emplace_back(worker, q);
+        worker(0);
+        for (auto &thread : threads)
+            thread.join();
+    }
+    else {
+        // Contiguous panels, one per queue, all submitted before waiting.
+        for (std::int64_t t = 0; t < tiles; t++) {
+            try {
+                run_tile(queues[t % nq], t);
+            }
+            catch (...) {
+                record(t % nq);
+            }
+        }
+        for (std::int64_t q = 0; q < nq; q++) {
+            try {
+                queues[q].wait();
+            }
+            catch (...) {
+                record(q);
+            }
+        }
+    }
+
+    for (auto &error : errors)
+        if (error)
+            std::rethrow_exception(error);
+}
+
+} // namespace detail
+
+template <onemkl::library lib, onemkl::backend backend, typename T>
+static inline void gemm(std::vector<cl::sycl::queue> &queues, tile_schedule schedule,
+                        transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                        std::int64_t k, T alpha, cl::sycl::buffer<T, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<T, 1> &b, std::int64_t ldb, T beta,
+                        cl::sycl::buffer<T, 1> &c, std::int64_t ldc) {
+    detail::gemm_multi_queue(
+        queues, schedule, transb, m, n, k, b, ldb, c, ldc,
+        [&](cl::sycl::queue &queue, std::int64_t nc, cl::sycl::buffer<T, 1> &b_tile,
+            std::int64_t ldb_tile, cl::sycl::buffer<T, 1> &c_tile) {
+            gemm<lib, backend>(queue, transa, transb, m, nc, k, alpha, a, lda, b_tile, ldb_tile,
+                               beta, c_tile, ldc);
+        });
+}
+
+} //namespace blas
+} //namespace onemkl
+
+#endif //_GEMM_MULTI_QUEUE_HPP_
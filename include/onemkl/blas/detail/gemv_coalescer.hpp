@@ -0,0 +1,276 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _GEMV_COALESCER_HPP_
+#define _GEMV_COALESCER_HPP_
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+#include "onemkl/types.hpp"
+
+#include "onemkl/blas/detail/cublas/blas_ct.hpp"
+#include "onemkl/blas/detail/mklcpu/blas_ct.hpp"
+#include "onemkl/blas/detail/mklgpu/blas_ct.hpp"
+
+namespace onemkl {
+namespace blas {
+
+// Routines used by gemv_coalescer: rt_routines dispatches through the
+// run-time API and ct_routines<lib, backend> through the compile-time API.
+struct rt_routines;
+
+template <onemkl::library lib, onemkl::backend backend>
+struct ct_routines {
+    template <typename... Args>
+    static void gemm(Args &&... args) {
+        blas::gemm<lib, backend>(std::forward<Args>(args)...);
+    }
+    template <typename... Args>
+    static void gemv(Args &&... args) {
+        blas::gemv<lib, backend>(std::forward<Args>(args)...);
+    }
+    template <typename... Args>
+    static void ger(Args &&... args) {
+        blas::ger<lib, backend>(std::forward<Args>(args)...);
+    }
+    template <typename... Args>
+    static void copy(Args &&... args) {
+        blas::copy<lib, backend>(std::forward<Args>(args)...);
+    }
+    template <typename... Args>
+    static void scal(Args &&... args) {
+        blas::scal<lib, backend>(std::forward<Args>(args)...);
+    }
+    template <typename... Args>
+    static void axpy(Args &&... args) {
+        blas::axpy<lib, backend>(std::forward<Args>(args)...);
+    }
+};
+
+// Deferred gemv and ger on one queue. Consecutive calls on the same matrix
+// with the same transpose and dimensions are held back and run together at
+// the next flush, as one gemm that reads the matrix once:
+//  - gemv calls y_i := alpha_i * op(A) * x_i + beta_i * y_i become
+//    Y := op(A) * X, the x_i being packed as the columns of X, after which
+//    each y_i is updated from its column of Y;
+//  - ger calls A := alpha_i * x_i * y_i^T + A become A := X * Y^T + A, the
+//    x_i scaled by alpha_i.
+// A call flushes the held ones first when it needs their results: a call on
+// another matrix, a gemv reading a y still pending, or a second gemv to the
+// same y. Otherwise the held calls run once max_calls of them have gathered,
+// on flush(), or when the coalescer is destroyed. Buffers given to it must
+// not be used elsewhere until then. Callers should end with flush(): the
+// destructor cannot report errors and drops any its flush throws. Buffers are told apart as SYCL handles,
+// so two sub-buffers of the same memory count as different vectors.
+template <typename T, typename Routines = rt_routines>
+class gemv_coalescer {
+public:
+    explicit gemv_coalescer(cl::sycl::queue &queue, std::int64_t max_calls = 32)
+            : queue_(queue),
+              max_calls_(std::max<std::int64_t>(max_calls, 1)) {}
+
+    gemv_coalescer(const gemv_coalescer &) = delete;
+    gemv_coalescer &operator=(const gemv_coalescer &) = delete;
+
+    ~gemv_coalescer() {
+        try {
+            flush();
+        }
+        catch (...) {
+        }
+    }
+
+    void gemv(transpose trans, std::int64_t m, std::int64_t n, T alpha,
+              cl::sycl::buffer<T, 1> &a, std::int64_t lda, cl::sycl::buffer<T, 1> &x,
+              std::int64_t incx, T beta, cl::sycl::buffer<T, 1> &y, std::int64_t incy) {
+        if (!holds(op::gemv, trans, m, n, a, lda))
+            flush();
+        for (auto &c : calls_) {
+            if (c.y == x || c.y == y) {
+                flush();
+                break;
+            }
+        }
+        hold(op::gemv, trans, m, n, a, lda, { alpha, x, incx, beta, y, incy });
+    }
+
+    void ger(std::int64_t m, std::int64_t n, T alpha, cl::sycl::buffer<T, 1> &x,
+             std::int64_t incx, cl::sycl::buffer<T, 1> &y, std::int64_t incy,
+             cl::sycl::buffer<T, 1> &a, std::int64_t lda) {
+        if (!holds(op::ger, transpose::nontrans, m, n, a, lda))
+            flush();
+        hold(op::ger, transpose::nontrans, m, n, a, lda, { alpha, x, incx, T(1), y, incy });
+    }
+
+    // Submits the calls held so far.
+    void flush() {
+        if (calls_.empty())
+            return;
+        const std::int64_t count = calls_.size();
+        if (count == 1 || m_ <= 0 || n_ <= 0)
+            replay();
+        else if (op_ == op::gemv)
+            flush_gemv(count);
+        else
+            flush_ger(count);
+        calls_.clear();
+        op_ = op::none;
+    }
+
+private:
+    enum class op { none, gemv, ger };
+
+    struct call {
+        T alpha;
+        cl::sycl::buffer<T, 1> x;
+        std::int64_t incx;
+        T beta;
+        cl::sycl::buffer<T, 1> y;
+        std::int64_t incy;
+    };
+
+    // Columns of the packed operands start at multiples of 64 elements, so
+    // that the sub-buffer offsets are aligned to 256 bytes or more.
+    static constexpr std::int64_t column_align = 64;
+
+    static std::int64_t column_stride(std::int64_t length) {
+        return (length + column_align - 1) / column_align * column_align;
+    }
+
+    bool holds(op o, transpose trans, std::int64_t m, std::int64_t n, cl::sycl::buffer<T, 1> &a,
+               std::int64_t lda) const {
+        return !calls_.empty() && op_ == o && trans_ == trans && m_ == m && n_ == n &&
+               lda_ == lda && a_[0] == a;
+    }
+
+    void hold(op o, transpose trans, std::int64_t m, std::int64_t n, cl::sycl::buffer<T, 1> &a,
+              std::int64_t lda, call c) {
+        if (calls_.empty()) {
+            op_    = o;
+            trans_ = trans;
+            m_     = m;
+            n_     = n;
+            lda_   = lda;
+            a_.clear();
+            a_.push_back(a);
+        }
+        calls_.push_back(c);
+        if (std::int64_t(calls_.size()) >= max_calls_)
+            flush();
+    }
+
+    // Runs the held calls one by one, when there is nothing to gain.
+    void replay() {
+        for (auto &c : calls_) {
+            if (op_ == op::gemv)
+                Routines::gemv(queue_, trans_, m_, n_, c.alpha, a_[0], lda_, c.x, c.incx, c.beta,
+                               c.y, c.incy);
+            else
+                Routines::ger(queue_, m_, n_, c.alpha, c.x, c.incx, c.y, c.incy, a_[0], lda_);
+        }
+    }
+
+    // Returns a workspace of at least size elements. It is kept across
+    // flushes, so that releasing it does not wait for the work using it.
+    cl::sycl::buffer<T, 1> &workspace(std::vector<cl::sycl::buffer<T, 1>> &w, std::int64_t size) {
+        if (w.empty() || std::int64_t(w[0].get_count()) < size) {
+            w.clear();
+            w.emplace_back(cl::sycl::range<1>(size));
+        }
+        return w[0];
+    }
+
+    // Copies alpha * v into column j of the packed operand p.
+    void pack(cl::sycl::buffer<T, 1> &p, std::int64_t ld, std::int64_t j, std::int64_t length,
+              T alpha, cl::sycl::buffer<T, 1> &v, std::int64_t inc) {
+        cl::sycl::buffer<T, 1> column(p, cl::sycl::id<1>(j * ld), cl::sycl::range<1>(length));
+        Routines::copy(queue_, length, v, inc, column, 1);
+        if (alpha != T(1))
+            Routines::scal(queue_, length, alpha, column, 1);
+    }
+
+    void flush_gemv(std::int64_t count) {
+        const bool nontrans      = (trans_ == transpose::nontrans);
+        const std::int64_t x_len = nontrans ? n_ : m_;
+        const std::int64_t y_len = nontrans ? m_ : n_;
+        const std::int64_t ldx   = column_stride(x_len);
+        const std::int64_t ldy   = column_stride(y_len);
+
+        auto &x_pack = workspace(x_pack_, ldx * count);
+        auto &y_pack = workspace(y_pack_, ldy * count);
+        for (std::int64_t j = 0; j < count; j++)
+            pack(x_pack, ldx, j, x_len, calls_[j].alpha, calls_[j].x, calls_[j].incx);
+
+        Routines::gemm(queue_, trans_, transpose::nontrans, y_len, count, x_len, T(1), a_[0], lda_,
+                       x_pack, ldx, T(0), y_pack, ldy);
+
+        // y_j := Y_j + beta_j * y_j. Scaling does not depend on the order of
+        //  the elements, so it runs with a positive increment, as scal needs.
+        for (std::int64_t j = 0; j < count; j++) {
+            auto &c = calls_[j];
+            cl::sycl::buffer<T, 1> column(y_pack, cl::sycl::id<1>(j * ldy),
+                                          cl::sycl::range<1>(y_len));
+            if (c.beta == T(0)) {
+                Routines::copy(queue_, y_len, column, 1, c.y, c.incy);
+            }
+            else {
+                if (c.beta != T(1))
+                    Routines::scal(queue_, y_len, c.beta, c.y, std::abs(c.incy));
+                Routines::axpy(queue_, y_len, T(1), column, 1, c.y, c.incy);
+            }
+        }
+    }
+
+    void flush_ger(std::int64_t count) {
+        const std::int64_t ldx = column_stride(m_);
+        const std::int64_t ldy = column_stride(n_);
+
+        auto &x_pack = workspace(x_pack_, ldx * count);
+        auto &y_pack = workspace(y_pack_, ldy * count);
+        for (std::int64_t j = 0; j < count; j++) {
+            pack(x_pack, ldx, j, m_, calls_[j].alpha, calls_[j].x, calls_[j].incx);
+            pack(y_pack, ldy, j, n_, T(1), calls_[j].y, calls_[j].incy);
+        }
+
+        Routines::gemm(queue_, transpose::nontrans, transpose::trans, m_, n_, count, T(1), x_pack,
+                       ldx, y_pack, ldy, T(1), a_[0], lda_);
+    }
+
+    cl::sycl::queue queue_;
+    std::int64_t max_calls_;
+
+    op op_           = op::none;
+    transpose trans_ = transpose::nontrans;
+    std::int64_t m_  = 0, n_ = 0, lda_ = 0;
+    // The matrix of the held calls, if any. A buffer has no empty state, so
+    //  it is kept in a vector.
+    std::vector<cl::sycl::buffer<T, 1>> a_;
+    std::vector<call> calls_;
+    std::vector<cl::sycl::buffer<T, 1>> x_pack_, y_pack_;
+};
+
+} //namespace blas
+} //namespace onemkl
+
+#endif //_GEMV_COALESCER_HPP_
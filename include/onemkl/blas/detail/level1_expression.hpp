@@ -0,0 +1,187 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _LEVEL1_EXPRESSION_HPP_
+#define _LEVEL1_EXPRESSION_HPP_
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "onemkl/types.hpp"
+
+#include "onemkl/blas/detail/cublas/blas_ct.hpp"
+#include "onemkl/blas/detail/mklcpu/blas_ct.hpp"
+#include "onemkl/blas/detail/mklgpu/blas_ct.hpp"
+
+namespace onemkl {
+namespace blas {
+
+template <typename T>
+class linear_combination;
+
+// Strided vector of a buffer, the operand of a linear_combination.
+template <typename T>
+struct strided_vector {
+    cl::sycl::buffer<T, 1> buffer;
+    std::int64_t inc;
+
+    friend linear_combination<T> operator*(T alpha, const strided_vector &x) {
+        return linear_combination<T>(alpha, x);
+    }
+    friend linear_combination<T> operator*(const strided_vector &x, T alpha) {
+        return linear_combination<T>(alpha, x);
+    }
+};
+
+template <typename T>
+static inline strided_vector<T> strided(cl::sycl::buffer<T, 1> &buffer, std::int64_t inc = 1) {
+    return { buffer, inc };
+}
+
+// Sum of scaled vectors, such as a * x + b * y + c * z. Nothing is computed
+// when it is built: assign and assign_dot evaluate it into a vector.
+template <typename T>
+class linear_combination {
+public:
+    struct term {
+        T alpha;
+        strided_vector<T> x;
+    };
+
+    linear_combination(T alpha, const strided_vector<T> &x) : terms_{ { alpha, x } } {}
+
+    const std::vector<term> &terms() const {
+        return terms_;
+    }
+
+    friend linear_combination operator+(linear_combination a, const linear_combination &b) {
+        a.terms_.insert(a.terms_.end(), b.terms_.begin(), b.terms_.end());
+        return a;
+    }
+    friend linear_combination operator-(linear_combination a, const linear_combination &b) {
+        for (auto &t : b.terms_)
+            a.terms_.push_back({ -t.alpha, t.x });
+        return a;
+    }
+
+private:
+    std::vector<term> terms_;
+};
+
+namespace detail {
+
+// Lowers y := e to passes of y := alpha * x + beta * y + gamma * z, calling
+// pass(alpha, x, beta, y, gamma, z, last) for each of them. Terms of the same
+// vector are merged first. The one of y, if any, becomes beta of the first
+// pass, and the other ones are taken two at a time, so that a combination of
+// up to three vectors including y runs in one pass over the vectors.
+template <typename T, typename F>
+static inline void lower_linear_combination(strided_vector<T> &y, const linear_combination<T> &e,
+                                            F pass) {
+    T beta = T(0);
+    std::vector<typename linear_combination<T>::term> terms;
+    for (auto &t : e.terms()) {
+        if (t.x.buffer == y.buffer && t.x.inc == y.inc) {
+            beta += t.alpha;
+            continue;
+        }
+        bool merged = false;
+        for (auto &u : terms) {
+            if (t.x.buffer == u.x.buffer && t.x.inc == u.x.inc) {
+                u.alpha += t.alpha;
+                merged = true;
+                break;
+            }
+        }
+        if (!merged)
+            terms.push_back(t);
+    }
+
+    // A missing term is y itself with a zero coefficient, which is not read.
+    const std::int64_t count = terms.size();
+    for (std::int64_t i = 0; i == 0 || i < count; i += 2) {
+        auto x = (i < count) ? terms[i] : typename linear_combination<T>::term{ T(0), y };
+        auto z = (i + 1 < count) ? terms[i + 1] : typename linear_combination<T>::term{ T(0), y };
+        pass(x.alpha, x.x, (i == 0) ? beta : T(1), y, z.alpha, z.x, i + 2 >= count);
+    }
+}
+
+// Evaluates y := e for vectors of n elements through lower_linear_combination.
+// A term on the buffer of y with another increment reads elements of y that
+// are overwritten first, so e is then evaluated into a temporary vector,
+// which the last pass copies into y.
+template <typename T, typename F>
+static inline void evaluate_linear_combination(std::int64_t n, strided_vector<T> &y,
+                                               const linear_combination<T> &e, F pass) {
+    bool overlaps = false;
+    for (auto &t : e.terms())
+        overlaps |= (t.x.buffer == y.buffer && t.x.inc != y.inc);
+    if (!overlaps) {
+        lower_linear_combination(y, e, pass);
+        return;
+    }
+    strided_vector<T> tmp{ cl::sycl::buffer<T, 1>(
+                               cl::sycl::range<1>(std::max<std::int64_t>(n, 1))),
+                           1 };
+    lower_linear_combination(tmp, e,
+                             [&](T alpha, strided_vector<T> &x, T beta, strided_vector<T> &out,
+                                 T gamma, strided_vector<T> &z, bool last) {
+                                 pass(alpha, x, beta, out, gamma, z, false);
+                             });
+    pass(T(1), tmp, T(0), y, T(0), y, true);
+}
+
+} // namespace detail
+
+template <onemkl::library lib, onemkl::backend backend, typename T>
+static inline void assign(cl::sycl::queue &queue, std::int64_t n, strided_vector<T> y,
+                          const linear_combination<T> &e) {
+    detail::evaluate_linear_combination(
+        n, y, e,
+        [&](T alpha, strided_vector<T> &x, T beta, strided_vector<T> &out, T gamma,
+            strided_vector<T> &z, bool last) {
+            axpbypcz<lib, backend>(queue, n, alpha, x.buffer, x.inc, beta, out.buffer, out.inc,
+                                   gamma, z.buffer, z.inc);
+        });
+}
+
+template <onemkl::library lib, onemkl::backend backend, typename T>
+static inline void assign_dot(cl::sycl::queue &queue, std::int64_t n, strided_vector<T> y,
+                              const linear_combination<T> &e, strided_vector<T> w,
+                              cl::sycl::buffer<T, 1> &result) {
+    detail::evaluate_linear_combination(
+        n, y, e,
+        [&](T alpha, strided_vector<T> &x, T beta, strided_vector<T> &out, T gamma,
+            strided_vector<T> &z, bool last) {
+            if (last)
+                axpbypcz_dot<lib, backend>(queue, n, alpha, x.buffer, x.inc, beta, out.buffer,
+                                           out.inc, gamma, z.buffer, z.inc, w.buffer, w.inc,
+                                           result);
+            else
+                axpbypcz<lib, backend>(queue, n, alpha, x.buffer, x.inc, beta, out.buffer,
+                                       out.inc, gamma, z.buffer, z.inc);
+        });
+}
+
+} //namespace blas
+} //namespace onemkl
+
+#endif //_LEVEL1_EXPRESSION_HPP_
@@ -3406,6 +3406,4998 @@ inline void rotg_postcondition(cl::sycl::queue &queue, cl::sycl::buffer<std::com
 #endif
 }
 
+inline void convert_precondition(cl::sycl::queue &queue, std::int64_t n,
+                                 cl::sycl::buffer<half, 1> &x, cl::sycl::buffer<float, 1> &y) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void convert_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                  cl::sycl::buffer<half, 1> &x, cl::sycl::buffer<float, 1> &y) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void convert_precondition(cl::sycl::queue &queue, std::int64_t n,
+                                 cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<half, 1> &y) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void convert_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                  cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<half, 1> &y) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void convert_precondition(cl::sycl::queue &queue, std::int64_t n,
+                                 cl::sycl::buffer<bfloat16, 1> &x, cl::sycl::buffer<float, 1> &y) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void convert_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                  cl::sycl::buffer<bfloat16, 1> &x, cl::sycl::buffer<float, 1> &y) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void convert_precondition(cl::sycl::queue &queue, std::int64_t n,
+                                 cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<bfloat16, 1> &y) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void convert_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                  cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<bfloat16, 1> &y) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void convert_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+                                 cl::sycl::buffer<float, 1> &b, std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void convert_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                  cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+                                  cl::sycl::buffer<float, 1> &b, std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void convert_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                 cl::sycl::buffer<half, 1> &b, std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void convert_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                  cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                  cl::sycl::buffer<half, 1> &b, std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void convert_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                                 cl::sycl::buffer<float, 1> &b, std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void convert_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                  cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                                  cl::sycl::buffer<float, 1> &b, std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void convert_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                 cl::sycl::buffer<bfloat16, 1> &b, std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void convert_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                  cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                  cl::sycl::buffer<bfloat16, 1> &b, std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_ext_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                  offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k,
+                                  float alpha, cl::sycl::buffer<int16_t, 1> &a, std::int64_t lda,
+                                  int16_t ao, cl::sycl::buffer<int16_t, 1> &b, std::int64_t ldb,
+                                  int16_t bo, float beta, cl::sycl::buffer<int32_t, 1> &c,
+                                  std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_ext_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                   offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k,
+                                   float alpha, cl::sycl::buffer<int16_t, 1> &a, std::int64_t lda,
+                                   int16_t ao, cl::sycl::buffer<int16_t, 1> &b, std::int64_t ldb,
+                                   int16_t bo, float beta, cl::sycl::buffer<int32_t, 1> &c,
+                                   std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_ext_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                  offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k,
+                                  float alpha, cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda,
+                                  int8_t ao, cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb,
+                                  int8_t bo, float beta, cl::sycl::buffer<int32_t, 1> &c,
+                                  std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_ext_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                   offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k,
+                                   float alpha, cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda,
+                                   int8_t ao, cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb,
+                                   int8_t bo, float beta, cl::sycl::buffer<int32_t, 1> &c,
+                                   std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_ext_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                  offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k,
+                                  float alpha, cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda,
+                                  uint8_t ao, cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb,
+                                  int8_t bo, float beta, cl::sycl::buffer<int32_t, 1> &c,
+                                  std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_ext_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                   offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k,
+                                   float alpha, cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda,
+                                   uint8_t ao, cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb,
+                                   int8_t bo, float beta, cl::sycl::buffer<int32_t, 1> &c,
+                                   std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_ext_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                  offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+                                  cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+                                  cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo,
+                                  cl::sycl::buffer<float, 1> &scales, int8_t zc,
+                                  cl::sycl::buffer<int8_t, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_ext_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                   offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+                                   cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+                                   cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo,
+                                   cl::sycl::buffer<float, 1> &scales, int8_t zc,
+                                   cl::sycl::buffer<int8_t, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_ext_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                  offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+                                  cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+                                  cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo,
+                                  cl::sycl::buffer<float, 1> &scales, uint8_t zc,
+                                  cl::sycl::buffer<uint8_t, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_ext_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                   offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+                                   cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+                                   cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo,
+                                   cl::sycl::buffer<float, 1> &scales, uint8_t zc,
+                                   cl::sycl::buffer<uint8_t, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_ext_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                  offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+                                  cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+                                  cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+                                  cl::sycl::buffer<float, 1> &scales, int8_t zc,
+                                  cl::sycl::buffer<int8_t, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_ext_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                   offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+                                   cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+                                   cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+                                   cl::sycl::buffer<float, 1> &scales, int8_t zc,
+                                   cl::sycl::buffer<int8_t, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_ext_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                  offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+                                  cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+                                  cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+                                  cl::sycl::buffer<float, 1> &scales, uint8_t zc,
+                                  cl::sycl::buffer<uint8_t, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_ext_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                   offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+                                   cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+                                   cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+                                   cl::sycl::buffer<float, 1> &scales, uint8_t zc,
+                                   cl::sycl::buffer<uint8_t, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_ext_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                  offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+                                  cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
+                                  cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+                                  cl::sycl::buffer<float, 1> &scales, int8_t zc,
+                                  cl::sycl::buffer<int8_t, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_ext_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                   offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+                                   cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
+                                   cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+                                   cl::sycl::buffer<float, 1> &scales, int8_t zc,
+                                   cl::sycl::buffer<int8_t, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_ext_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                  offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+                                  cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
+                                  cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+                                  cl::sycl::buffer<float, 1> &scales, uint8_t zc,
+                                  cl::sycl::buffer<uint8_t, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_ext_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                   offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+                                   cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
+                                   cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+                                   cl::sycl::buffer<float, 1> &scales, uint8_t zc,
+                                   cl::sycl::buffer<uint8_t, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_s8u8s32_compute_precondition(cl::sycl::queue &queue, transpose transb,
+                                              offset offsetc, std::int64_t m, std::int64_t n,
+                                              std::int64_t k, float alpha,
+                                              cl::sycl::buffer<int8_t, 1> &packed_a, int8_t ao,
+                                              cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb,
+                                              uint8_t bo, float beta,
+                                              cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                                              cl::sycl::buffer<int32_t, 1> &co) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_s8u8s32_compute_postcondition(cl::sycl::queue &queue, transpose transb,
+                                               offset offsetc, std::int64_t m, std::int64_t n,
+                                               std::int64_t k, float alpha,
+                                               cl::sycl::buffer<int8_t, 1> &packed_a, int8_t ao,
+                                               cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb,
+                                               uint8_t bo, float beta,
+                                               cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                                               cl::sycl::buffer<int32_t, 1> &co) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_s8u8s32_compute_precondition(cl::sycl::queue &queue, transpose transa,
+                                              offset offsetc, std::int64_t m, std::int64_t n,
+                                              std::int64_t k, float alpha,
+                                              cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda,
+                                              int8_t ao, cl::sycl::buffer<uint8_t, 1> &packed_b,
+                                              uint8_t bo, float beta,
+                                              cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                                              cl::sycl::buffer<int32_t, 1> &co) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_s8u8s32_compute_postcondition(cl::sycl::queue &queue, transpose transa,
+                                               offset offsetc, std::int64_t m, std::int64_t n,
+                                               std::int64_t k, float alpha,
+                                               cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda,
+                                               int8_t ao, cl::sycl::buffer<uint8_t, 1> &packed_b,
+                                               uint8_t bo, float beta,
+                                               cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                                               cl::sycl::buffer<int32_t, 1> &co) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_s8u8s32_pack_precondition(cl::sycl::queue &queue, transpose transa, std::int64_t m,
+                                           std::int64_t n, std::int64_t k,
+                                           cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda,
+                                           cl::sycl::buffer<int8_t, 1> &packed_a) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_s8u8s32_pack_postcondition(cl::sycl::queue &queue, transpose transa,
+                                            std::int64_t m, std::int64_t n, std::int64_t k,
+                                            cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda,
+                                            cl::sycl::buffer<int8_t, 1> &packed_a) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_s8u8s32_pack_precondition(cl::sycl::queue &queue, transpose transb, std::int64_t m,
+                                           std::int64_t n, std::int64_t k,
+                                           cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb,
+                                           cl::sycl::buffer<uint8_t, 1> &packed_b) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_s8u8s32_pack_postcondition(cl::sycl::queue &queue, transpose transb,
+                                            std::int64_t m, std::int64_t n, std::int64_t k,
+                                            cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb,
+                                            cl::sycl::buffer<uint8_t, 1> &packed_b) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_s8u8s32_pack_get_size_precondition(cl::sycl::queue &queue, identifier which,
+                                                    std::int64_t m, std::int64_t n,
+                                                    std::int64_t k) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_s8u8s32_pack_get_size_postcondition(cl::sycl::queue &queue, identifier which,
+                                                     std::int64_t m, std::int64_t n,
+                                                     std::int64_t k) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_batch_precondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<float, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+    cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_batch_postcondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<float, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+    cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_batch_precondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<double, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<double, 1> &beta,
+    cl::sycl::buffer<double, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_batch_postcondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<double, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<double, 1> &beta,
+    cl::sycl::buffer<double, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_batch_precondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<std::complex<float>, 1> &alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<std::complex<float>, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<std::complex<float>, 1> &beta,
+    cl::sycl::buffer<std::complex<float>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_batch_postcondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<std::complex<float>, 1> &alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<std::complex<float>, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<std::complex<float>, 1> &beta,
+    cl::sycl::buffer<std::complex<float>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_batch_precondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<std::complex<double>, 1> &alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<std::complex<double>, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<std::complex<double>, 1> &beta,
+    cl::sycl::buffer<std::complex<double>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_batch_postcondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<std::complex<double>, 1> &alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<std::complex<double>, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<std::complex<double>, 1> &beta,
+    cl::sycl::buffer<std::complex<double>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void herk_batch_precondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+    cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<float, 1> &alpha,
+    cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+    cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void herk_batch_postcondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+    cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<float, 1> &alpha,
+    cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+    cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void herk_batch_precondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+    cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<double, 1> &alpha,
+    cl::sycl::buffer<std::complex<double>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+    cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void herk_batch_postcondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+    cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<double, 1> &alpha,
+    cl::sycl::buffer<std::complex<double>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+    cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void herk_batch_precondition(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                                    std::int64_t n, std::int64_t k, float alpha,
+                                    cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                    std::int64_t stride_a, float beta,
+                                    cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                                    std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void herk_batch_postcondition(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                                     std::int64_t n, std::int64_t k, float alpha,
+                                     cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a, float beta,
+                                     cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                                     std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void herk_batch_precondition(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                                    std::int64_t n, std::int64_t k, double alpha,
+                                    cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                    std::int64_t stride_a, double beta,
+                                    cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                    std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void herk_batch_postcondition(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                                     std::int64_t n, std::int64_t k, double alpha,
+                                     cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a, double beta,
+                                     cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                     std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void syrk_batch_precondition(cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                                    cl::sycl::buffer<transpose, 1> &trans,
+                                    cl::sycl::buffer<std::int64_t, 1> &n,
+                                    cl::sycl::buffer<std::int64_t, 1> &k,
+                                    cl::sycl::buffer<float, 1> &alpha,
+                                    cl::sycl::buffer<float, 1> &a,
+                                    cl::sycl::buffer<std::int64_t, 1> &lda,
+                                    cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &c,
+                                    cl::sycl::buffer<std::int64_t, 1> &ldc,
+                                    std::int64_t group_count,
+                                    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void syrk_batch_postcondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+    cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<float, 1> &alpha,
+    cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &c,
+    cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void syrk_batch_precondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+    cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<double, 1> &alpha,
+    cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &c,
+    cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void syrk_batch_postcondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+    cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<double, 1> &alpha,
+    cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &c,
+    cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void syrk_batch_precondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+    cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<std::complex<float>, 1> &alpha,
+    cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<std::complex<float>, 1> &beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+    cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void syrk_batch_postcondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+    cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<std::complex<float>, 1> &alpha,
+    cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<std::complex<float>, 1> &beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+    cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void syrk_batch_precondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+    cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<std::complex<double>, 1> &alpha,
+    cl::sycl::buffer<std::complex<double>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<std::complex<double>, 1> &beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+    cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void syrk_batch_postcondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+    cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<std::complex<double>, 1> &alpha,
+    cl::sycl::buffer<std::complex<double>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<std::complex<double>, 1> &beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+    cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void syrk_batch_precondition(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                                    std::int64_t n, std::int64_t k, float alpha,
+                                    cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                    std::int64_t stride_a, float beta,
+                                    cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                    std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void syrk_batch_postcondition(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                                     std::int64_t n, std::int64_t k, float alpha,
+                                     cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a, float beta,
+                                     cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                     std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void syrk_batch_precondition(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                                    std::int64_t n, std::int64_t k, double alpha,
+                                    cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                    std::int64_t stride_a, double beta,
+                                    cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                    std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void syrk_batch_postcondition(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                                     std::int64_t n, std::int64_t k, double alpha,
+                                     cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a, double beta,
+                                     cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                     std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void syrk_batch_precondition(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                                    std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                                    cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                    std::int64_t stride_a, std::complex<float> beta,
+                                    cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                                    std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void syrk_batch_postcondition(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                                     std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                                     cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a, std::complex<float> beta,
+                                     cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                                     std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void syrk_batch_precondition(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                                    std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                                    cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                    std::int64_t stride_a, std::complex<double> beta,
+                                    cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                    std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void syrk_batch_postcondition(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                                     std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                                     cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a, std::complex<double> beta,
+                                     cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                     std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemv_batch_precondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<float, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<float, 1> &beta,
+    cl::sycl::buffer<float, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemv_batch_postcondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<float, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<float, 1> &beta,
+    cl::sycl::buffer<float, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemv_batch_precondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<double, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<double, 1> &beta,
+    cl::sycl::buffer<double, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemv_batch_postcondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<double, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<double, 1> &beta,
+    cl::sycl::buffer<double, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemv_batch_precondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::complex<float>, 1> &alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::complex<float>, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<std::complex<float>, 1> &beta,
+    cl::sycl::buffer<std::complex<float>, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemv_batch_postcondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::complex<float>, 1> &alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::complex<float>, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<std::complex<float>, 1> &beta,
+    cl::sycl::buffer<std::complex<float>, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemv_batch_precondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::complex<double>, 1> &alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::complex<double>, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<std::complex<double>, 1> &beta,
+    cl::sycl::buffer<std::complex<double>, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemv_batch_postcondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::complex<double>, 1> &alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::complex<double>, 1> &x,
+    cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<std::complex<double>, 1> &beta,
+    cl::sycl::buffer<std::complex<double>, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemv_batch_precondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                    std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                                    std::int64_t lda, std::int64_t stride_a,
+                                    cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x, float beta,
+                                    cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                                    std::int64_t stride_y, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemv_batch_postcondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                     std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                                     std::int64_t lda, std::int64_t stride_a,
+                                     cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x, float beta,
+                                     cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                                     std::int64_t stride_y, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemv_batch_precondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                    std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+                                    std::int64_t lda, std::int64_t stride_a,
+                                    cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x, double beta,
+                                    cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                                    std::int64_t stride_y, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemv_batch_postcondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                     std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+                                     std::int64_t lda, std::int64_t stride_a,
+                                     cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x, double beta,
+                                     cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                                     std::int64_t stride_y, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemv_batch_precondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                    std::int64_t n, std::complex<float> alpha,
+                                    cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                    std::int64_t stride_a,
+                                    cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x, std::complex<float> beta,
+                                    cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                                    std::int64_t stride_y, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemv_batch_postcondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                     std::int64_t n, std::complex<float> alpha,
+                                     cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a,
+                                     cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x, std::complex<float> beta,
+                                     cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                                     std::int64_t stride_y, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemv_batch_precondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                    std::int64_t n, std::complex<double> alpha,
+                                    cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                    std::int64_t stride_a,
+                                    cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x, std::complex<double> beta,
+                                    cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                                    std::int64_t stride_y, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemv_batch_postcondition(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+    std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+    std::int64_t stride_x, std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
+    std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void dgmm_batch_precondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+    cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void dgmm_batch_postcondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+    cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void dgmm_batch_precondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<double, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+    cl::sycl::buffer<double, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void dgmm_batch_postcondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<double, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+    cl::sycl::buffer<double, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void dgmm_batch_precondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<std::complex<float>, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+    cl::sycl::buffer<std::complex<float>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void dgmm_batch_postcondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<std::complex<float>, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+    cl::sycl::buffer<std::complex<float>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void dgmm_batch_precondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::complex<double>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<std::complex<double>, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+    cl::sycl::buffer<std::complex<double>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void dgmm_batch_postcondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+    cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+    cl::sycl::buffer<std::complex<double>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+    cl::sycl::buffer<std::complex<double>, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+    cl::sycl::buffer<std::complex<double>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void dgmm_batch_precondition(cl::sycl::queue &queue, side left_right, std::int64_t m,
+                                    std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                    std::int64_t stride_a, cl::sycl::buffer<float, 1> &x,
+                                    std::int64_t incx, std::int64_t stride_x,
+                                    cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                    std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void dgmm_batch_postcondition(cl::sycl::queue &queue, side left_right, std::int64_t m,
+                                     std::int64_t n, cl::sycl::buffer<float, 1> &a,
+                                     std::int64_t lda, std::int64_t stride_a,
+                                     cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x, cl::sycl::buffer<float, 1> &c,
+                                     std::int64_t ldc, std::int64_t stride_c,
+                                     std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void dgmm_batch_precondition(cl::sycl::queue &queue, side left_right, std::int64_t m,
+                                    std::int64_t n, cl::sycl::buffer<double, 1> &a,
+                                    std::int64_t lda, std::int64_t stride_a,
+                                    cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x, cl::sycl::buffer<double, 1> &c,
+                                    std::int64_t ldc, std::int64_t stride_c,
+                                    std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void dgmm_batch_postcondition(cl::sycl::queue &queue, side left_right, std::int64_t m,
+                                     std::int64_t n, cl::sycl::buffer<double, 1> &a,
+                                     std::int64_t lda, std::int64_t stride_a,
+                                     cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x, cl::sycl::buffer<double, 1> &c,
+                                     std::int64_t ldc, std::int64_t stride_c,
+                                     std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void dgmm_batch_precondition(cl::sycl::queue &queue, side left_right, std::int64_t m,
+                                    std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
+                                    std::int64_t lda, std::int64_t stride_a,
+                                    cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x,
+                                    cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                                    std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void dgmm_batch_postcondition(cl::sycl::queue &queue, side left_right, std::int64_t m,
+                                     std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
+                                     std::int64_t lda, std::int64_t stride_a,
+                                     cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x,
+                                     cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                                     std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void dgmm_batch_precondition(cl::sycl::queue &queue, side left_right, std::int64_t m,
+                                    std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &a,
+                                    std::int64_t lda, std::int64_t stride_a,
+                                    cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x,
+                                    cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                    std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void dgmm_batch_postcondition(cl::sycl::queue &queue, side left_right, std::int64_t m,
+                                     std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &a,
+                                     std::int64_t lda, std::int64_t stride_a,
+                                     cl::sycl::buffer<std::complex<double>, 1> &x,
+                                     std::int64_t incx, std::int64_t stride_x,
+                                     cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                     std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_precondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                    cl::sycl::buffer<float, 1> &alpha,
+                                    cl::sycl::buffer<float, 1> &x,
+                                    cl::sycl::buffer<std::int64_t, 1> &incx,
+                                    cl::sycl::buffer<float, 1> &y,
+                                    cl::sycl::buffer<std::int64_t, 1> &incy,
+                                    std::int64_t group_count,
+                                    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_postcondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                     cl::sycl::buffer<float, 1> &alpha,
+                                     cl::sycl::buffer<float, 1> &x,
+                                     cl::sycl::buffer<std::int64_t, 1> &incx,
+                                     cl::sycl::buffer<float, 1> &y,
+                                     cl::sycl::buffer<std::int64_t, 1> &incy,
+                                     std::int64_t group_count,
+                                     cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_precondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                    cl::sycl::buffer<double, 1> &alpha,
+                                    cl::sycl::buffer<double, 1> &x,
+                                    cl::sycl::buffer<std::int64_t, 1> &incx,
+                                    cl::sycl::buffer<double, 1> &y,
+                                    cl::sycl::buffer<std::int64_t, 1> &incy,
+                                    std::int64_t group_count,
+                                    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_postcondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                     cl::sycl::buffer<double, 1> &alpha,
+                                     cl::sycl::buffer<double, 1> &x,
+                                     cl::sycl::buffer<std::int64_t, 1> &incx,
+                                     cl::sycl::buffer<double, 1> &y,
+                                     cl::sycl::buffer<std::int64_t, 1> &incy,
+                                     std::int64_t group_count,
+                                     cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_precondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                    cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                                    cl::sycl::buffer<std::complex<float>, 1> &x,
+                                    cl::sycl::buffer<std::int64_t, 1> &incx,
+                                    cl::sycl::buffer<std::complex<float>, 1> &y,
+                                    cl::sycl::buffer<std::int64_t, 1> &incy,
+                                    std::int64_t group_count,
+                                    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_postcondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                     cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                                     cl::sycl::buffer<std::complex<float>, 1> &x,
+                                     cl::sycl::buffer<std::int64_t, 1> &incx,
+                                     cl::sycl::buffer<std::complex<float>, 1> &y,
+                                     cl::sycl::buffer<std::int64_t, 1> &incy,
+                                     std::int64_t group_count,
+                                     cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_precondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                    cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                                    cl::sycl::buffer<std::complex<double>, 1> &x,
+                                    cl::sycl::buffer<std::int64_t, 1> &incx,
+                                    cl::sycl::buffer<std::complex<double>, 1> &y,
+                                    cl::sycl::buffer<std::int64_t, 1> &incy,
+                                    std::int64_t group_count,
+                                    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_postcondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                     cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                                     cl::sycl::buffer<std::complex<double>, 1> &x,
+                                     cl::sycl::buffer<std::int64_t, 1> &incx,
+                                     cl::sycl::buffer<std::complex<double>, 1> &y,
+                                     cl::sycl::buffer<std::int64_t, 1> &incy,
+                                     std::int64_t group_count,
+                                     cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_precondition(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                                    cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x, cl::sycl::buffer<float, 1> &y,
+                                    std::int64_t incy, std::int64_t stride_y,
+                                    std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_postcondition(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                                     cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x, cl::sycl::buffer<float, 1> &y,
+                                     std::int64_t incy, std::int64_t stride_y,
+                                     std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_precondition(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                                    cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x, cl::sycl::buffer<double, 1> &y,
+                                    std::int64_t incy, std::int64_t stride_y,
+                                    std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_postcondition(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                                     cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x, cl::sycl::buffer<double, 1> &y,
+                                     std::int64_t incy, std::int64_t stride_y,
+                                     std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_precondition(cl::sycl::queue &queue, std::int64_t n,
+                                    std::complex<float> alpha,
+                                    cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x,
+                                    cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                                    std::int64_t stride_y, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                     std::complex<float> alpha,
+                                     cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x,
+                                     cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                                     std::int64_t stride_y, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_precondition(cl::sycl::queue &queue, std::int64_t n,
+                                    std::complex<double> alpha,
+                                    cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x,
+                                    cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                                    std::int64_t stride_y, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_batch_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                     std::complex<double> alpha,
+                                     cl::sycl::buffer<std::complex<double>, 1> &x,
+                                     std::int64_t incx, std::int64_t stride_x,
+                                     cl::sycl::buffer<std::complex<double>, 1> &y,
+                                     std::int64_t incy, std::int64_t stride_y,
+                                     std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void copy_batch_precondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                    cl::sycl::buffer<float, 1> &x,
+                                    cl::sycl::buffer<std::int64_t, 1> &incx,
+                                    cl::sycl::buffer<float, 1> &y,
+                                    cl::sycl::buffer<std::int64_t, 1> &incy,
+                                    std::int64_t group_count,
+                                    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void copy_batch_postcondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                     cl::sycl::buffer<float, 1> &x,
+                                     cl::sycl::buffer<std::int64_t, 1> &incx,
+                                     cl::sycl::buffer<float, 1> &y,
+                                     cl::sycl::buffer<std::int64_t, 1> &incy,
+                                     std::int64_t group_count,
+                                     cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void copy_batch_precondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                    cl::sycl::buffer<double, 1> &x,
+                                    cl::sycl::buffer<std::int64_t, 1> &incx,
+                                    cl::sycl::buffer<double, 1> &y,
+                                    cl::sycl::buffer<std::int64_t, 1> &incy,
+                                    std::int64_t group_count,
+                                    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void copy_batch_postcondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                     cl::sycl::buffer<double, 1> &x,
+                                     cl::sycl::buffer<std::int64_t, 1> &incx,
+                                     cl::sycl::buffer<double, 1> &y,
+                                     cl::sycl::buffer<std::int64_t, 1> &incy,
+                                     std::int64_t group_count,
+                                     cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void copy_batch_precondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                    cl::sycl::buffer<std::complex<float>, 1> &x,
+                                    cl::sycl::buffer<std::int64_t, 1> &incx,
+                                    cl::sycl::buffer<std::complex<float>, 1> &y,
+                                    cl::sycl::buffer<std::int64_t, 1> &incy,
+                                    std::int64_t group_count,
+                                    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void copy_batch_postcondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                     cl::sycl::buffer<std::complex<float>, 1> &x,
+                                     cl::sycl::buffer<std::int64_t, 1> &incx,
+                                     cl::sycl::buffer<std::complex<float>, 1> &y,
+                                     cl::sycl::buffer<std::int64_t, 1> &incy,
+                                     std::int64_t group_count,
+                                     cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void copy_batch_precondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                    cl::sycl::buffer<std::complex<double>, 1> &x,
+                                    cl::sycl::buffer<std::int64_t, 1> &incx,
+                                    cl::sycl::buffer<std::complex<double>, 1> &y,
+                                    cl::sycl::buffer<std::int64_t, 1> &incy,
+                                    std::int64_t group_count,
+                                    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void copy_batch_postcondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                     cl::sycl::buffer<std::complex<double>, 1> &x,
+                                     cl::sycl::buffer<std::int64_t, 1> &incx,
+                                     cl::sycl::buffer<std::complex<double>, 1> &y,
+                                     cl::sycl::buffer<std::int64_t, 1> &incy,
+                                     std::int64_t group_count,
+                                     cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void copy_batch_precondition(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x, cl::sycl::buffer<float, 1> &y,
+                                    std::int64_t incy, std::int64_t stride_y,
+                                    std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void copy_batch_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                     cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x, cl::sycl::buffer<float, 1> &y,
+                                     std::int64_t incy, std::int64_t stride_y,
+                                     std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void copy_batch_precondition(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x, cl::sycl::buffer<double, 1> &y,
+                                    std::int64_t incy, std::int64_t stride_y,
+                                    std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void copy_batch_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                     cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x, cl::sycl::buffer<double, 1> &y,
+                                     std::int64_t incy, std::int64_t stride_y,
+                                     std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void copy_batch_precondition(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x,
+                                    cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                                    std::int64_t stride_y, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void copy_batch_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                     cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x,
+                                     cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                                     std::int64_t stride_y, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void copy_batch_precondition(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x,
+                                    cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                                    std::int64_t stride_y, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void copy_batch_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                     cl::sycl::buffer<std::complex<double>, 1> &x,
+                                     std::int64_t incx, std::int64_t stride_x,
+                                     cl::sycl::buffer<std::complex<double>, 1> &y,
+                                     std::int64_t incy, std::int64_t stride_y,
+                                     std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void dot_batch_precondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                   cl::sycl::buffer<float, 1> &x,
+                                   cl::sycl::buffer<std::int64_t, 1> &incx,
+                                   cl::sycl::buffer<float, 1> &y,
+                                   cl::sycl::buffer<std::int64_t, 1> &incy,
+                                   cl::sycl::buffer<float, 1> &result, std::int64_t group_count,
+                                   cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void dot_batch_postcondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                    cl::sycl::buffer<float, 1> &x,
+                                    cl::sycl::buffer<std::int64_t, 1> &incx,
+                                    cl::sycl::buffer<float, 1> &y,
+                                    cl::sycl::buffer<std::int64_t, 1> &incy,
+                                    cl::sycl::buffer<float, 1> &result, std::int64_t group_count,
+                                    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void dot_batch_precondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                   cl::sycl::buffer<double, 1> &x,
+                                   cl::sycl::buffer<std::int64_t, 1> &incx,
+                                   cl::sycl::buffer<double, 1> &y,
+                                   cl::sycl::buffer<std::int64_t, 1> &incy,
+                                   cl::sycl::buffer<double, 1> &result, std::int64_t group_count,
+                                   cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void dot_batch_postcondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                    cl::sycl::buffer<double, 1> &x,
+                                    cl::sycl::buffer<std::int64_t, 1> &incx,
+                                    cl::sycl::buffer<double, 1> &y,
+                                    cl::sycl::buffer<std::int64_t, 1> &incy,
+                                    cl::sycl::buffer<double, 1> &result, std::int64_t group_count,
+                                    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void dot_batch_precondition(cl::sycl::queue &queue, std::int64_t n,
+                                   cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                   std::int64_t stride_x, cl::sycl::buffer<float, 1> &y,
+                                   std::int64_t incy, std::int64_t stride_y,
+                                   cl::sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void dot_batch_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x, cl::sycl::buffer<float, 1> &y,
+                                    std::int64_t incy, std::int64_t stride_y,
+                                    cl::sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void dot_batch_precondition(cl::sycl::queue &queue, std::int64_t n,
+                                   cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                   std::int64_t stride_x, cl::sycl::buffer<double, 1> &y,
+                                   std::int64_t incy, std::int64_t stride_y,
+                                   cl::sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void dot_batch_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x, cl::sycl::buffer<double, 1> &y,
+                                    std::int64_t incy, std::int64_t stride_y,
+                                    cl::sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_batch_precondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                    cl::sycl::buffer<float, 1> &alpha,
+                                    cl::sycl::buffer<float, 1> &x,
+                                    cl::sycl::buffer<std::int64_t, 1> &incx,
+                                    std::int64_t group_count,
+                                    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_batch_postcondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                     cl::sycl::buffer<float, 1> &alpha,
+                                     cl::sycl::buffer<float, 1> &x,
+                                     cl::sycl::buffer<std::int64_t, 1> &incx,
+                                     std::int64_t group_count,
+                                     cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_batch_precondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                    cl::sycl::buffer<double, 1> &alpha,
+                                    cl::sycl::buffer<double, 1> &x,
+                                    cl::sycl::buffer<std::int64_t, 1> &incx,
+                                    std::int64_t group_count,
+                                    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_batch_postcondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                     cl::sycl::buffer<double, 1> &alpha,
+                                     cl::sycl::buffer<double, 1> &x,
+                                     cl::sycl::buffer<std::int64_t, 1> &incx,
+                                     std::int64_t group_count,
+                                     cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_batch_precondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                    cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                                    cl::sycl::buffer<std::complex<float>, 1> &x,
+                                    cl::sycl::buffer<std::int64_t, 1> &incx,
+                                    std::int64_t group_count,
+                                    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_batch_postcondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                     cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                                     cl::sycl::buffer<std::complex<float>, 1> &x,
+                                     cl::sycl::buffer<std::int64_t, 1> &incx,
+                                     std::int64_t group_count,
+                                     cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_batch_precondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                    cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                                    cl::sycl::buffer<std::complex<double>, 1> &x,
+                                    cl::sycl::buffer<std::int64_t, 1> &incx,
+                                    std::int64_t group_count,
+                                    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_batch_postcondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                     cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                                     cl::sycl::buffer<std::complex<double>, 1> &x,
+                                     cl::sycl::buffer<std::int64_t, 1> &incx,
+                                     std::int64_t group_count,
+                                     cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_batch_precondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                    cl::sycl::buffer<float, 1> &alpha,
+                                    cl::sycl::buffer<std::complex<float>, 1> &x,
+                                    cl::sycl::buffer<std::int64_t, 1> &incx,
+                                    std::int64_t group_count,
+                                    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_batch_postcondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                     cl::sycl::buffer<float, 1> &alpha,
+                                     cl::sycl::buffer<std::complex<float>, 1> &x,
+                                     cl::sycl::buffer<std::int64_t, 1> &incx,
+                                     std::int64_t group_count,
+                                     cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_batch_precondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                    cl::sycl::buffer<double, 1> &alpha,
+                                    cl::sycl::buffer<std::complex<double>, 1> &x,
+                                    cl::sycl::buffer<std::int64_t, 1> &incx,
+                                    std::int64_t group_count,
+                                    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_batch_postcondition(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                     cl::sycl::buffer<double, 1> &alpha,
+                                     cl::sycl::buffer<std::complex<double>, 1> &x,
+                                     cl::sycl::buffer<std::int64_t, 1> &incx,
+                                     std::int64_t group_count,
+                                     cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_batch_precondition(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                                    cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_batch_postcondition(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                                     cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_batch_precondition(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                                    cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_batch_postcondition(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                                     cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_batch_precondition(cl::sycl::queue &queue, std::int64_t n,
+                                    std::complex<float> alpha,
+                                    cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_batch_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                     std::complex<float> alpha,
+                                     cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_batch_precondition(cl::sycl::queue &queue, std::int64_t n,
+                                    std::complex<double> alpha,
+                                    cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_batch_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                     std::complex<double> alpha,
+                                     cl::sycl::buffer<std::complex<double>, 1> &x,
+                                     std::int64_t incx, std::int64_t stride_x,
+                                     std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_batch_precondition(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                                    cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_batch_postcondition(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                                     cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_batch_precondition(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                                    cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_batch_postcondition(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                                     cl::sycl::buffer<std::complex<double>, 1> &x,
+                                     std::int64_t incx, std::int64_t stride_x,
+                                     std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_batch_precondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<half, 1> &alpha, cl::sycl::buffer<half, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<half, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<half, 1> &beta,
+    cl::sycl::buffer<half, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_batch_postcondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<half, 1> &alpha, cl::sycl::buffer<half, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<half, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<half, 1> &beta,
+    cl::sycl::buffer<half, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_batch_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                    std::int64_t m, std::int64_t n, std::int64_t k, half alpha,
+                                    cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+                                    std::int64_t stride_a, cl::sycl::buffer<half, 1> &b,
+                                    std::int64_t ldb, std::int64_t stride_b, half beta,
+                                    cl::sycl::buffer<half, 1> &c, std::int64_t ldc,
+                                    std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_batch_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                     std::int64_t m, std::int64_t n, std::int64_t k, half alpha,
+                                     cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a, cl::sycl::buffer<half, 1> &b,
+                                     std::int64_t ldb, std::int64_t stride_b, half beta,
+                                     cl::sycl::buffer<half, 1> &c, std::int64_t ldc,
+                                     std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_batch_precondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<half, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<half, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+    cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_batch_postcondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<half, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<half, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+    cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_batch_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                    std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                    cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+                                    std::int64_t stride_a, cl::sycl::buffer<half, 1> &b,
+                                    std::int64_t ldb, std::int64_t stride_b, float beta,
+                                    cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                    std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_batch_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                     std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                     cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a, cl::sycl::buffer<half, 1> &b,
+                                     std::int64_t ldb, std::int64_t stride_b, float beta,
+                                     cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                     std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_batch_precondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<int8_t, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<uint8_t, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+    cl::sycl::buffer<int32_t, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_batch_postcondition(
+    cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+    cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+    cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+    cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<int8_t, 1> &a,
+    cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+    cl::sycl::buffer<uint8_t, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+    cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+    cl::sycl::buffer<int32_t, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+    cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+    cl::sycl::buffer<std::int64_t, 1> &group_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_batch_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                    std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                    cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda,
+                                    std::int64_t stride_a, cl::sycl::buffer<uint8_t, 1> &b,
+                                    std::int64_t ldb, std::int64_t stride_b, float beta,
+                                    cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                                    std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_batch_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                     std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                     cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a, cl::sycl::buffer<uint8_t, 1> &b,
+                                     std::int64_t ldb, std::int64_t stride_b, float beta,
+                                     cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                                     std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gepack_compact_precondition(cl::sycl::queue &queue, std::int64_t rows,
+                                        std::int64_t cols, cl::sycl::buffer<float, 1> &a,
+                                        std::int64_t lda, std::int64_t stride_a,
+                                        cl::sycl::buffer<float, 1> &ap, std::int64_t ldap,
+                                        std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gepack_compact_postcondition(cl::sycl::queue &queue, std::int64_t rows,
+                                         std::int64_t cols, cl::sycl::buffer<float, 1> &a,
+                                         std::int64_t lda, std::int64_t stride_a,
+                                         cl::sycl::buffer<float, 1> &ap, std::int64_t ldap,
+                                         std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gepack_compact_precondition(cl::sycl::queue &queue, std::int64_t rows,
+                                        std::int64_t cols, cl::sycl::buffer<double, 1> &a,
+                                        std::int64_t lda, std::int64_t stride_a,
+                                        cl::sycl::buffer<double, 1> &ap, std::int64_t ldap,
+                                        std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gepack_compact_postcondition(cl::sycl::queue &queue, std::int64_t rows,
+                                         std::int64_t cols, cl::sycl::buffer<double, 1> &a,
+                                         std::int64_t lda, std::int64_t stride_a,
+                                         cl::sycl::buffer<double, 1> &ap, std::int64_t ldap,
+                                         std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void geunpack_compact_precondition(cl::sycl::queue &queue, std::int64_t rows,
+                                          std::int64_t cols, cl::sycl::buffer<float, 1> &ap,
+                                          std::int64_t ldap, cl::sycl::buffer<float, 1> &a,
+                                          std::int64_t lda, std::int64_t stride_a,
+                                          std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void geunpack_compact_postcondition(cl::sycl::queue &queue, std::int64_t rows,
+                                           std::int64_t cols, cl::sycl::buffer<float, 1> &ap,
+                                           std::int64_t ldap, cl::sycl::buffer<float, 1> &a,
+                                           std::int64_t lda, std::int64_t stride_a,
+                                           std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void geunpack_compact_precondition(cl::sycl::queue &queue, std::int64_t rows,
+                                          std::int64_t cols, cl::sycl::buffer<double, 1> &ap,
+                                          std::int64_t ldap, cl::sycl::buffer<double, 1> &a,
+                                          std::int64_t lda, std::int64_t stride_a,
+                                          std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void geunpack_compact_postcondition(cl::sycl::queue &queue, std::int64_t rows,
+                                           std::int64_t cols, cl::sycl::buffer<double, 1> &ap,
+                                           std::int64_t ldap, cl::sycl::buffer<double, 1> &a,
+                                           std::int64_t lda, std::int64_t stride_a,
+                                           std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_compact_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                      std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                      cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                      cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+                                      cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                      std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_compact_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                       std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                       cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                       cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+                                       cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                       std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_compact_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                      std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                                      cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                      cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+                                      cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                      std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_compact_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                       std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                                       cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                       cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                       double beta, cl::sycl::buffer<double, 1> &c,
+                                       std::int64_t ldc, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_compact_precondition(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                                      transpose trans, diag unit_diag, std::int64_t m,
+                                      std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                                      std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+                                      std::int64_t ldb, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_compact_postcondition(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                                       transpose trans, diag unit_diag, std::int64_t m,
+                                       std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                                       std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+                                       std::int64_t ldb, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_compact_precondition(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                                      transpose trans, diag unit_diag, std::int64_t m,
+                                      std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+                                      std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+                                      std::int64_t ldb, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void trsm_compact_postcondition(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                                       transpose trans, diag unit_diag, std::int64_t m,
+                                       std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+                                       std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+                                       std::int64_t ldb, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void getrfnp_compact_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                         cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                         std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void getrfnp_compact_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                          cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                          std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void getrfnp_compact_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                         cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                         std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void getrfnp_compact_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                          cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                          std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void axpby_precondition(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                               cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                               cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpby_postcondition(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                                cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                                cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void axpby_precondition(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                               cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                               cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpby_postcondition(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                                cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                                cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void axpby_precondition(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                               cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                               std::complex<float> beta,
+                               cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpby_postcondition(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                                cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                std::complex<float> beta,
+                                cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void axpby_precondition(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                               cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                               std::complex<double> beta,
+                               cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpby_postcondition(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                                cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                                std::complex<double> beta,
+                                cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void imatcopy_precondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &ab,
+                                  std::int64_t lda, std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void imatcopy_postcondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                   std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &ab,
+                                   std::int64_t lda, std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void imatcopy_precondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &ab,
+                                  std::int64_t lda, std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void imatcopy_postcondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                   std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &ab,
+                                   std::int64_t lda, std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void imatcopy_precondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, std::complex<float> alpha,
+                                  cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t lda,
+                                  std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void imatcopy_postcondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                   std::int64_t n, std::complex<float> alpha,
+                                   cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t lda,
+                                   std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void imatcopy_precondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, std::complex<double> alpha,
+                                  cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t lda,
+                                  std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void imatcopy_postcondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                   std::int64_t n, std::complex<double> alpha,
+                                   cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t lda,
+                                   std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatadd_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                 std::int64_t m, std::int64_t n, float alpha,
+                                 cl::sycl::buffer<float, 1> &a, std::int64_t lda, float beta,
+                                 cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                 cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatadd_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                  std::int64_t m, std::int64_t n, float alpha,
+                                  cl::sycl::buffer<float, 1> &a, std::int64_t lda, float beta,
+                                  cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                  cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatadd_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                 std::int64_t m, std::int64_t n, double alpha,
+                                 cl::sycl::buffer<double, 1> &a, std::int64_t lda, double beta,
+                                 cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                 cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatadd_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                  std::int64_t m, std::int64_t n, double alpha,
+                                  cl::sycl::buffer<double, 1> &a, std::int64_t lda, double beta,
+                                  cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                  cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatadd_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                 std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                 std::complex<float> beta,
+                                 cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                                 cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatadd_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                  std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                                  cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                  std::complex<float> beta,
+                                  cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                                  cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatadd_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                 std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                 std::complex<double> beta,
+                                 cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                 cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatadd_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                  std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                                  cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                  std::complex<double> beta,
+                                  cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                  cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatcopy_precondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                                  std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+                                  std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatcopy_postcondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                   std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                                   std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+                                   std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatcopy_precondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+                                  std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+                                  std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatcopy_postcondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                   std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+                                   std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+                                   std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatcopy_precondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, std::complex<float> alpha,
+                                  cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                  cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatcopy_postcondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                   std::int64_t n, std::complex<float> alpha,
+                                   cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                   cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatcopy_precondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, std::complex<double> alpha,
+                                  cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                  cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatcopy_postcondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                   std::int64_t n, std::complex<double> alpha,
+                                   cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                   cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void imatcopy_batch_precondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                        std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &ab,
+                                        std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                                        std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void imatcopy_batch_postcondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                         std::int64_t n, float alpha,
+                                         cl::sycl::buffer<float, 1> &ab, std::int64_t lda,
+                                         std::int64_t ldb, std::int64_t stride,
+                                         std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void imatcopy_batch_precondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                        std::int64_t n, double alpha,
+                                        cl::sycl::buffer<double, 1> &ab, std::int64_t lda,
+                                        std::int64_t ldb, std::int64_t stride,
+                                        std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void imatcopy_batch_postcondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                         std::int64_t n, double alpha,
+                                         cl::sycl::buffer<double, 1> &ab, std::int64_t lda,
+                                         std::int64_t ldb, std::int64_t stride,
+                                         std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void imatcopy_batch_precondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                        std::int64_t n, std::complex<float> alpha,
+                                        cl::sycl::buffer<std::complex<float>, 1> &ab,
+                                        std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                                        std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void imatcopy_batch_postcondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                         std::int64_t n, std::complex<float> alpha,
+                                         cl::sycl::buffer<std::complex<float>, 1> &ab,
+                                         std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                                         std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void imatcopy_batch_precondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                        std::int64_t n, std::complex<double> alpha,
+                                        cl::sycl::buffer<std::complex<double>, 1> &ab,
+                                        std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                                        std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void imatcopy_batch_postcondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                         std::int64_t n, std::complex<double> alpha,
+                                         cl::sycl::buffer<std::complex<double>, 1> &ab,
+                                         std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                                         std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatadd_batch_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                       std::int64_t m, std::int64_t n, float alpha,
+                                       cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                       std::int64_t stride_a, float beta,
+                                       cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                       std::int64_t stride_b, cl::sycl::buffer<float, 1> &c,
+                                       std::int64_t ldc, std::int64_t stride_c,
+                                       std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatadd_batch_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                        std::int64_t m, std::int64_t n, float alpha,
+                                        cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                        std::int64_t stride_a, float beta,
+                                        cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                        std::int64_t stride_b, cl::sycl::buffer<float, 1> &c,
+                                        std::int64_t ldc, std::int64_t stride_c,
+                                        std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatadd_batch_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                       std::int64_t m, std::int64_t n, double alpha,
+                                       cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                       std::int64_t stride_a, double beta,
+                                       cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                       std::int64_t stride_b, cl::sycl::buffer<double, 1> &c,
+                                       std::int64_t ldc, std::int64_t stride_c,
+                                       std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatadd_batch_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                        std::int64_t m, std::int64_t n, double alpha,
+                                        cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                        std::int64_t stride_a, double beta,
+                                        cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                        std::int64_t stride_b, cl::sycl::buffer<double, 1> &c,
+                                        std::int64_t ldc, std::int64_t stride_c,
+                                        std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatadd_batch_precondition(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &b,
+    std::int64_t ldb, std::int64_t stride_b, cl::sycl::buffer<std::complex<float>, 1> &c,
+    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatadd_batch_postcondition(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &b,
+    std::int64_t ldb, std::int64_t stride_b, cl::sycl::buffer<std::complex<float>, 1> &c,
+    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatadd_batch_precondition(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &b,
+    std::int64_t ldb, std::int64_t stride_b, cl::sycl::buffer<std::complex<double>, 1> &c,
+    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatadd_batch_postcondition(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &b,
+    std::int64_t ldb, std::int64_t stride_b, cl::sycl::buffer<std::complex<double>, 1> &c,
+    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatcopy_batch_precondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                        std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                                        std::int64_t lda, std::int64_t stride_a,
+                                        cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                        std::int64_t stride_b, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatcopy_batch_postcondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                         std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                                         std::int64_t lda, std::int64_t stride_a,
+                                         cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                         std::int64_t stride_b, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatcopy_batch_precondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                        std::int64_t n, double alpha,
+                                        cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                        std::int64_t stride_a, cl::sycl::buffer<double, 1> &b,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatcopy_batch_postcondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                         std::int64_t n, double alpha,
+                                         cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                         std::int64_t stride_a, cl::sycl::buffer<double, 1> &b,
+                                         std::int64_t ldb, std::int64_t stride_b,
+                                         std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatcopy_batch_precondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                        std::int64_t n, std::complex<float> alpha,
+                                        cl::sycl::buffer<std::complex<float>, 1> &a,
+                                        std::int64_t lda, std::int64_t stride_a,
+                                        cl::sycl::buffer<std::complex<float>, 1> &b,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatcopy_batch_postcondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                         std::int64_t n, std::complex<float> alpha,
+                                         cl::sycl::buffer<std::complex<float>, 1> &a,
+                                         std::int64_t lda, std::int64_t stride_a,
+                                         cl::sycl::buffer<std::complex<float>, 1> &b,
+                                         std::int64_t ldb, std::int64_t stride_b,
+                                         std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatcopy_batch_precondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                        std::int64_t n, std::complex<double> alpha,
+                                        cl::sycl::buffer<std::complex<double>, 1> &a,
+                                        std::int64_t lda, std::int64_t stride_a,
+                                        cl::sycl::buffer<std::complex<double>, 1> &b,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatcopy_batch_postcondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                         std::int64_t n, std::complex<double> alpha,
+                                         cl::sycl::buffer<std::complex<double>, 1> &a,
+                                         std::int64_t lda, std::int64_t stride_a,
+                                         cl::sycl::buffer<std::complex<double>, 1> &b,
+                                         std::int64_t ldb, std::int64_t stride_b,
+                                         std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void asum_precondition(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                              std::int64_t incx, cl::sycl::buffer<float, 1> &result,
+                              accumulation acc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void asum_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                               cl::sycl::buffer<float, 1> &result, accumulation acc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void dot_precondition(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                             std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                             cl::sycl::buffer<float, 1> &result, accumulation acc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void dot_postcondition(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                              std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                              cl::sycl::buffer<float, 1> &result, accumulation acc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void nrm2_precondition(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                              std::int64_t incx, cl::sycl::buffer<float, 1> &result,
+                              accumulation acc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void nrm2_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                               cl::sycl::buffer<float, 1> &result, accumulation acc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void axpbypcz_precondition(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                                  cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                                  cl::sycl::buffer<float, 1> &y, std::int64_t incy, float gamma,
+                                  cl::sycl::buffer<float, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpbypcz_postcondition(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                                   cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                                   cl::sycl::buffer<float, 1> &y, std::int64_t incy, float gamma,
+                                   cl::sycl::buffer<float, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void axpbypcz_precondition(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                                  cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                                  cl::sycl::buffer<double, 1> &y, std::int64_t incy, double gamma,
+                                  cl::sycl::buffer<double, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpbypcz_postcondition(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                                   cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                                   cl::sycl::buffer<double, 1> &y, std::int64_t incy, double gamma,
+                                   cl::sycl::buffer<double, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void axpbypcz_dot_precondition(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                                      cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                                      cl::sycl::buffer<float, 1> &y, std::int64_t incy, float gamma,
+                                      cl::sycl::buffer<float, 1> &z, std::int64_t incz,
+                                      cl::sycl::buffer<float, 1> &w, std::int64_t incw,
+                                      cl::sycl::buffer<float, 1> &result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpbypcz_dot_postcondition(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                                       cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                                       cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                                       float gamma, cl::sycl::buffer<float, 1> &z,
+                                       std::int64_t incz, cl::sycl::buffer<float, 1> &w,
+                                       std::int64_t incw, cl::sycl::buffer<float, 1> &result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void axpbypcz_dot_precondition(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                                      cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                      double beta, cl::sycl::buffer<double, 1> &y,
+                                      std::int64_t incy, double gamma,
+                                      cl::sycl::buffer<double, 1> &z, std::int64_t incz,
+                                      cl::sycl::buffer<double, 1> &w, std::int64_t incw,
+                                      cl::sycl::buffer<double, 1> &result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpbypcz_dot_postcondition(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                                       cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                       double beta, cl::sycl::buffer<double, 1> &y,
+                                       std::int64_t incy, double gamma,
+                                       cl::sycl::buffer<double, 1> &z, std::int64_t incz,
+                                       cl::sycl::buffer<double, 1> &w, std::int64_t incw,
+                                       cl::sycl::buffer<double, 1> &result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void asum_precondition(cl::sycl::queue &queue, std::int64_t n,
+                              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                              float *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void asum_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                               float *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void asum_precondition(cl::sycl::queue &queue, std::int64_t n,
+                              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                              double *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void asum_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                               double *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void asum_precondition(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                              std::int64_t incx, float *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void asum_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<float, 1> &x, std::int64_t incx, float *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void asum_precondition(cl::sycl::queue &queue, std::int64_t n,
+                              cl::sycl::buffer<double, 1> &x, std::int64_t incx, double *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void asum_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<double, 1> &x, std::int64_t incx, double *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void dot_precondition(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                             std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                             float *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void dot_postcondition(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                              std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                              float *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void dot_precondition(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                             std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                             double *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void dot_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                              cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                              cl::sycl::buffer<double, 1> &y, std::int64_t incy, double *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void dot_precondition(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                             std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                             double *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void dot_postcondition(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                              std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                              double *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void iamin_precondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                               std::int64_t *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void iamin_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                std::int64_t *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void iamin_precondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                               std::int64_t *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void iamin_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                std::int64_t *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void iamin_precondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                               std::int64_t *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void iamin_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                std::int64_t *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void iamin_precondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                               std::int64_t *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void iamin_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                                std::int64_t *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void iamax_precondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                               std::int64_t *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void iamax_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                std::int64_t *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void iamax_precondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                               std::int64_t *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void iamax_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                std::int64_t *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void iamax_precondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                               std::int64_t *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void iamax_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                std::int64_t *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void iamax_precondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                               std::int64_t *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void iamax_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                                cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                                std::int64_t *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void nrm2_precondition(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                              std::int64_t incx, float *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void nrm2_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<float, 1> &x, std::int64_t incx, float *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void nrm2_precondition(cl::sycl::queue &queue, std::int64_t n,
+                              cl::sycl::buffer<double, 1> &x, std::int64_t incx, double *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void nrm2_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<double, 1> &x, std::int64_t incx, double *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void nrm2_precondition(cl::sycl::queue &queue, std::int64_t n,
+                              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                              float *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void nrm2_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                               float *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void nrm2_precondition(cl::sycl::queue &queue, std::int64_t n,
+                              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                              double *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void nrm2_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                               double *result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gbtge_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                               std::int64_t kl, std::int64_t ku, cl::sycl::buffer<float, 1> &ab,
+                               std::int64_t ldab, cl::sycl::buffer<float, 1> &a, std::int64_t lda) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gbtge_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t kl, std::int64_t ku, cl::sycl::buffer<float, 1> &ab,
+                                std::int64_t ldab, cl::sycl::buffer<float, 1> &a,
+                                std::int64_t lda) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gbtge_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                               std::int64_t kl, std::int64_t ku, cl::sycl::buffer<double, 1> &ab,
+                               std::int64_t ldab, cl::sycl::buffer<double, 1> &a,
+                               std::int64_t lda) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gbtge_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t kl, std::int64_t ku, cl::sycl::buffer<double, 1> &ab,
+                                std::int64_t ldab, cl::sycl::buffer<double, 1> &a,
+                                std::int64_t lda) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gbtge_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                               std::int64_t kl, std::int64_t ku,
+                               cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t ldab,
+                               cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gbtge_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t kl, std::int64_t ku,
+                                cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t ldab,
+                                cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gbtge_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                               std::int64_t kl, std::int64_t ku,
+                               cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t ldab,
+                               cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gbtge_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t kl, std::int64_t ku,
+                                cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t ldab,
+                                cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gettgb_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t kl, std::int64_t ku, cl::sycl::buffer<float, 1> &a,
+                                std::int64_t lda, cl::sycl::buffer<float, 1> &ab,
+                                std::int64_t ldab) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gettgb_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 std::int64_t kl, std::int64_t ku, cl::sycl::buffer<float, 1> &a,
+                                 std::int64_t lda, cl::sycl::buffer<float, 1> &ab,
+                                 std::int64_t ldab) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gettgb_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t kl, std::int64_t ku, cl::sycl::buffer<double, 1> &a,
+                                std::int64_t lda, cl::sycl::buffer<double, 1> &ab,
+                                std::int64_t ldab) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gettgb_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 std::int64_t kl, std::int64_t ku, cl::sycl::buffer<double, 1> &a,
+                                 std::int64_t lda, cl::sycl::buffer<double, 1> &ab,
+                                 std::int64_t ldab) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gettgb_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t kl, std::int64_t ku,
+                                cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t ldab) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gettgb_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 std::int64_t kl, std::int64_t ku,
+                                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                 cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t ldab) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gettgb_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t kl, std::int64_t ku,
+                                cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t ldab) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gettgb_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 std::int64_t kl, std::int64_t ku,
+                                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                 cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t ldab) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void tpttr_precondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                               cl::sycl::buffer<float, 1> &ap, cl::sycl::buffer<float, 1> &a,
+                               std::int64_t lda) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void tpttr_postcondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                cl::sycl::buffer<float, 1> &ap, cl::sycl::buffer<float, 1> &a,
+                                std::int64_t lda) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void tpttr_precondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                               cl::sycl::buffer<double, 1> &ap, cl::sycl::buffer<double, 1> &a,
+                               std::int64_t lda) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void tpttr_postcondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                cl::sycl::buffer<double, 1> &ap, cl::sycl::buffer<double, 1> &a,
+                                std::int64_t lda) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void tpttr_precondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                               cl::sycl::buffer<std::complex<float>, 1> &ap,
+                               cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void tpttr_postcondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                cl::sycl::buffer<std::complex<float>, 1> &ap,
+                                cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void tpttr_precondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                               cl::sycl::buffer<std::complex<double>, 1> &ap,
+                               cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void tpttr_postcondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                cl::sycl::buffer<std::complex<double>, 1> &ap,
+                                cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void trttp_precondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                               cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                               cl::sycl::buffer<float, 1> &ap) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void trttp_postcondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                cl::sycl::buffer<float, 1> &ap) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void trttp_precondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                               cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                               cl::sycl::buffer<double, 1> &ap) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void trttp_postcondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                cl::sycl::buffer<double, 1> &ap) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void trttp_precondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                               cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                               cl::sycl::buffer<std::complex<float>, 1> &ap) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void trttp_postcondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                cl::sycl::buffer<std::complex<float>, 1> &ap) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void trttp_precondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                               cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                               cl::sycl::buffer<std::complex<double>, 1> &ap) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void trttp_postcondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                cl::sycl::buffer<std::complex<double>, 1> &ap) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gbtge_batch_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                     std::int64_t kl, std::int64_t ku,
+                                     cl::sycl::buffer<float, 1> &ab, std::int64_t ldab,
+                                     std::int64_t stride_ab, cl::sycl::buffer<float, 1> &a,
+                                     std::int64_t lda, std::int64_t stride_a,
+                                     std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gbtge_batch_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                      std::int64_t kl, std::int64_t ku,
+                                      cl::sycl::buffer<float, 1> &ab, std::int64_t ldab,
+                                      std::int64_t stride_ab, cl::sycl::buffer<float, 1> &a,
+                                      std::int64_t lda, std::int64_t stride_a,
+                                      std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gbtge_batch_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                     std::int64_t kl, std::int64_t ku,
+                                     cl::sycl::buffer<double, 1> &ab, std::int64_t ldab,
+                                     std::int64_t stride_ab, cl::sycl::buffer<double, 1> &a,
+                                     std::int64_t lda, std::int64_t stride_a,
+                                     std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gbtge_batch_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                      std::int64_t kl, std::int64_t ku,
+                                      cl::sycl::buffer<double, 1> &ab, std::int64_t ldab,
+                                      std::int64_t stride_ab, cl::sycl::buffer<double, 1> &a,
+                                      std::int64_t lda, std::int64_t stride_a,
+                                      std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gbtge_batch_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                     std::int64_t kl, std::int64_t ku,
+                                     cl::sycl::buffer<std::complex<float>, 1> &ab,
+                                     std::int64_t ldab, std::int64_t stride_ab,
+                                     cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gbtge_batch_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                      std::int64_t kl, std::int64_t ku,
+                                      cl::sycl::buffer<std::complex<float>, 1> &ab,
+                                      std::int64_t ldab, std::int64_t stride_ab,
+                                      cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                      std::int64_t stride_a, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gbtge_batch_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                     std::int64_t kl, std::int64_t ku,
+                                     cl::sycl::buffer<std::complex<double>, 1> &ab,
+                                     std::int64_t ldab, std::int64_t stride_ab,
+                                     cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gbtge_batch_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                      std::int64_t kl, std::int64_t ku,
+                                      cl::sycl::buffer<std::complex<double>, 1> &ab,
+                                      std::int64_t ldab, std::int64_t stride_ab,
+                                      cl::sycl::buffer<std::complex<double>, 1> &a,
+                                      std::int64_t lda, std::int64_t stride_a,
+                                      std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gettgb_batch_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                      std::int64_t kl, std::int64_t ku,
+                                      cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                      std::int64_t stride_a, cl::sycl::buffer<float, 1> &ab,
+                                      std::int64_t ldab, std::int64_t stride_ab,
+                                      std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gettgb_batch_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                       std::int64_t kl, std::int64_t ku,
+                                       cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                       std::int64_t stride_a, cl::sycl::buffer<float, 1> &ab,
+                                       std::int64_t ldab, std::int64_t stride_ab,
+                                       std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gettgb_batch_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                      std::int64_t kl, std::int64_t ku,
+                                      cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                      std::int64_t stride_a, cl::sycl::buffer<double, 1> &ab,
+                                      std::int64_t ldab, std::int64_t stride_ab,
+                                      std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gettgb_batch_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                       std::int64_t kl, std::int64_t ku,
+                                       cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                       std::int64_t stride_a, cl::sycl::buffer<double, 1> &ab,
+                                       std::int64_t ldab, std::int64_t stride_ab,
+                                       std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gettgb_batch_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                      std::int64_t kl, std::int64_t ku,
+                                      cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                      std::int64_t stride_a,
+                                      cl::sycl::buffer<std::complex<float>, 1> &ab,
+                                      std::int64_t ldab, std::int64_t stride_ab,
+                                      std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gettgb_batch_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                       std::int64_t kl, std::int64_t ku,
+                                       cl::sycl::buffer<std::complex<float>, 1> &a,
+                                       std::int64_t lda, std::int64_t stride_a,
+                                       cl::sycl::buffer<std::complex<float>, 1> &ab,
+                                       std::int64_t ldab, std::int64_t stride_ab,
+                                       std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gettgb_batch_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                      std::int64_t kl, std::int64_t ku,
+                                      cl::sycl::buffer<std::complex<double>, 1> &a,
+                                      std::int64_t lda, std::int64_t stride_a,
+                                      cl::sycl::buffer<std::complex<double>, 1> &ab,
+                                      std::int64_t ldab, std::int64_t stride_ab,
+                                      std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gettgb_batch_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                       std::int64_t kl, std::int64_t ku,
+                                       cl::sycl::buffer<std::complex<double>, 1> &a,
+                                       std::int64_t lda, std::int64_t stride_a,
+                                       cl::sycl::buffer<std::complex<double>, 1> &ab,
+                                       std::int64_t ldab, std::int64_t stride_ab,
+                                       std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void tpttr_batch_precondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                     cl::sycl::buffer<float, 1> &ap, std::int64_t stride_ap,
+                                     cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void tpttr_batch_postcondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                      cl::sycl::buffer<float, 1> &ap, std::int64_t stride_ap,
+                                      cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                      std::int64_t stride_a, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void tpttr_batch_precondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                     cl::sycl::buffer<double, 1> &ap, std::int64_t stride_ap,
+                                     cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void tpttr_batch_postcondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                      cl::sycl::buffer<double, 1> &ap, std::int64_t stride_ap,
+                                      cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                      std::int64_t stride_a, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void tpttr_batch_precondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                     cl::sycl::buffer<std::complex<float>, 1> &ap,
+                                     std::int64_t stride_ap,
+                                     cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void tpttr_batch_postcondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                      cl::sycl::buffer<std::complex<float>, 1> &ap,
+                                      std::int64_t stride_ap,
+                                      cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                      std::int64_t stride_a, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void tpttr_batch_precondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                     cl::sycl::buffer<std::complex<double>, 1> &ap,
+                                     std::int64_t stride_ap,
+                                     cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void tpttr_batch_postcondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                      cl::sycl::buffer<std::complex<double>, 1> &ap,
+                                      std::int64_t stride_ap,
+                                      cl::sycl::buffer<std::complex<double>, 1> &a,
+                                      std::int64_t lda, std::int64_t stride_a,
+                                      std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void trttp_batch_precondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                     cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a, cl::sycl::buffer<float, 1> &ap,
+                                     std::int64_t stride_ap, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void trttp_batch_postcondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                      cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                      std::int64_t stride_a, cl::sycl::buffer<float, 1> &ap,
+                                      std::int64_t stride_ap, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void trttp_batch_precondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                     cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a, cl::sycl::buffer<double, 1> &ap,
+                                     std::int64_t stride_ap, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void trttp_batch_postcondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                      cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                      std::int64_t stride_a, cl::sycl::buffer<double, 1> &ap,
+                                      std::int64_t stride_ap, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void trttp_batch_precondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                     cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a,
+                                     cl::sycl::buffer<std::complex<float>, 1> &ap,
+                                     std::int64_t stride_ap, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void trttp_batch_postcondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                      cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                      std::int64_t stride_a,
+                                      cl::sycl::buffer<std::complex<float>, 1> &ap,
+                                      std::int64_t stride_ap, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void trttp_batch_precondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                     cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a,
+                                     cl::sycl::buffer<std::complex<double>, 1> &ap,
+                                     std::int64_t stride_ap, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void trttp_batch_postcondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                                      cl::sycl::buffer<std::complex<double>, 1> &a,
+                                      std::int64_t lda, std::int64_t stride_a,
+                                      cl::sycl::buffer<std::complex<double>, 1> &ap,
+                                      std::int64_t stride_ap, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemv_precondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                              std::int64_t n, float alpha, cl::sycl::buffer<half, 1> &a,
+                              std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                              float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemv_postcondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                               std::int64_t n, float alpha, cl::sycl::buffer<half, 1> &a,
+                               std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                               float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemv_precondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                              std::int64_t n, float alpha, cl::sycl::buffer<bfloat16, 1> &a,
+                              std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                              float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemv_postcondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                               std::int64_t n, float alpha, cl::sycl::buffer<bfloat16, 1> &a,
+                               std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                               float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemv_batch_precondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                    std::int64_t n, float alpha, cl::sycl::buffer<half, 1> &a,
+                                    std::int64_t lda, std::int64_t stride_a,
+                                    cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x, float beta,
+                                    cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                                    std::int64_t stride_y, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemv_batch_postcondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                     std::int64_t n, float alpha, cl::sycl::buffer<half, 1> &a,
+                                     std::int64_t lda, std::int64_t stride_a,
+                                     cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x, float beta,
+                                     cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                                     std::int64_t stride_y, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemv_batch_precondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                    std::int64_t n, float alpha, cl::sycl::buffer<bfloat16, 1> &a,
+                                    std::int64_t lda, std::int64_t stride_a,
+                                    cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x, float beta,
+                                    cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                                    std::int64_t stride_y, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemv_batch_postcondition(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                     std::int64_t n, float alpha, cl::sycl::buffer<bfloat16, 1> &a,
+                                     std::int64_t lda, std::int64_t stride_a,
+                                     cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x, float beta,
+                                     cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                                     std::int64_t stride_y, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void lange_precondition(cl::sycl::queue &queue, norm_type norm, transpose trans,
+                               std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a,
+                               std::int64_t lda, cl::sycl::buffer<float, 1> &result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void lange_postcondition(cl::sycl::queue &queue, norm_type norm, transpose trans,
+                                std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a,
+                                std::int64_t lda, cl::sycl::buffer<float, 1> &result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void lange_precondition(cl::sycl::queue &queue, norm_type norm, transpose trans,
+                               std::int64_t m, std::int64_t n, cl::sycl::buffer<double, 1> &a,
+                               std::int64_t lda, cl::sycl::buffer<double, 1> &result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void lange_postcondition(cl::sycl::queue &queue, norm_type norm, transpose trans,
+                                std::int64_t m, std::int64_t n, cl::sycl::buffer<double, 1> &a,
+                                std::int64_t lda, cl::sycl::buffer<double, 1> &result) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void reduce_columns_precondition(cl::sycl::queue &queue, reduction op, transpose trans,
+                                        std::int64_t m, std::int64_t n,
+                                        cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                        cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void reduce_columns_postcondition(cl::sycl::queue &queue, reduction op, transpose trans,
+                                         std::int64_t m, std::int64_t n,
+                                         cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                         cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void reduce_columns_precondition(cl::sycl::queue &queue, reduction op, transpose trans,
+                                        std::int64_t m, std::int64_t n,
+                                        cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                        cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void reduce_columns_postcondition(cl::sycl::queue &queue, reduction op, transpose trans,
+                                         std::int64_t m, std::int64_t n,
+                                         cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                         cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void reduce_rows_precondition(cl::sycl::queue &queue, reduction op, transpose trans,
+                                     std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a,
+                                     std::int64_t lda, cl::sycl::buffer<float, 1> &y,
+                                     std::int64_t incy) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void reduce_rows_postcondition(cl::sycl::queue &queue, reduction op, transpose trans,
+                                      std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a,
+                                      std::int64_t lda, cl::sycl::buffer<float, 1> &y,
+                                      std::int64_t incy) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void reduce_rows_precondition(cl::sycl::queue &queue, reduction op, transpose trans,
+                                     std::int64_t m, std::int64_t n, cl::sycl::buffer<double, 1> &a,
+                                     std::int64_t lda, cl::sycl::buffer<double, 1> &y,
+                                     std::int64_t incy) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void reduce_rows_postcondition(cl::sycl::queue &queue, reduction op, transpose trans,
+                                      std::int64_t m, std::int64_t n,
+                                      cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                      cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatclamp_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float lo,
+                                   float hi, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                   cl::sycl::buffer<float, 1> &b, std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatclamp_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                    float lo, float hi, cl::sycl::buffer<float, 1> &a,
+                                    std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+                                    std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatclamp_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                   double lo, double hi, cl::sycl::buffer<double, 1> &a,
+                                   std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+                                   std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatclamp_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                    double lo, double hi, cl::sycl::buffer<double, 1> &a,
+                                    std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+                                    std::int64_t ldb) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatclamp_batch_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                         float lo, float hi, cl::sycl::buffer<float, 1> &a,
+                                         std::int64_t lda, std::int64_t stride_a,
+                                         cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                         std::int64_t stride_b, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatclamp_batch_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                          float lo, float hi, cl::sycl::buffer<float, 1> &a,
+                                          std::int64_t lda, std::int64_t stride_a,
+                                          cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                          std::int64_t stride_b, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatclamp_batch_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                         double lo, double hi, cl::sycl::buffer<double, 1> &a,
+                                         std::int64_t lda, std::int64_t stride_a,
+                                         cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                         std::int64_t stride_b, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatclamp_batch_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                          double lo, double hi, cl::sycl::buffer<double, 1> &a,
+                                          std::int64_t lda, std::int64_t stride_a,
+                                          cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                          std::int64_t stride_b, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatdiv_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                 cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                 cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatdiv_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                  cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                  cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                  cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatdiv_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                 cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                 cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatdiv_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                  cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                  cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                  cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatdiv_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                 cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                                 cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatdiv_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                  cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                  cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                                  cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatdiv_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                 cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                 cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatdiv_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                  cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                  cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                  cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatdiv_batch_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                       cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                       std::int64_t stride_a, cl::sycl::buffer<float, 1> &b,
+                                       std::int64_t ldb, std::int64_t stride_b,
+                                       cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                       std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatdiv_batch_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                        cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                        std::int64_t stride_a, cl::sycl::buffer<float, 1> &b,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                        std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatdiv_batch_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                       cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                       std::int64_t stride_a, cl::sycl::buffer<double, 1> &b,
+                                       std::int64_t ldb, std::int64_t stride_b,
+                                       cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                       std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatdiv_batch_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                        cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                        std::int64_t stride_a, cl::sycl::buffer<double, 1> &b,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                        std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatdiv_batch_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                       cl::sycl::buffer<std::complex<float>, 1> &a,
+                                       std::int64_t lda, std::int64_t stride_a,
+                                       cl::sycl::buffer<std::complex<float>, 1> &b,
+                                       std::int64_t ldb, std::int64_t stride_b,
+                                       cl::sycl::buffer<std::complex<float>, 1> &c,
+                                       std::int64_t ldc, std::int64_t stride_c,
+                                       std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatdiv_batch_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                        cl::sycl::buffer<std::complex<float>, 1> &a,
+                                        std::int64_t lda, std::int64_t stride_a,
+                                        cl::sycl::buffer<std::complex<float>, 1> &b,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        cl::sycl::buffer<std::complex<float>, 1> &c,
+                                        std::int64_t ldc, std::int64_t stride_c,
+                                        std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatdiv_batch_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                       cl::sycl::buffer<std::complex<double>, 1> &a,
+                                       std::int64_t lda, std::int64_t stride_a,
+                                       cl::sycl::buffer<std::complex<double>, 1> &b,
+                                       std::int64_t ldb, std::int64_t stride_b,
+                                       cl::sycl::buffer<std::complex<double>, 1> &c,
+                                       std::int64_t ldc, std::int64_t stride_c,
+                                       std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatdiv_batch_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                        cl::sycl::buffer<std::complex<double>, 1> &a,
+                                        std::int64_t lda, std::int64_t stride_a,
+                                        cl::sycl::buffer<std::complex<double>, 1> &b,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        cl::sycl::buffer<std::complex<double>, 1> &c,
+                                        std::int64_t ldc, std::int64_t stride_c,
+                                        std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatfma_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                 cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+                                 cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatfma_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                  float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                  cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+                                  cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatfma_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                 cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+                                 cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatfma_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                  double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                  cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+                                  cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatfma_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 std::complex<float> alpha,
+                                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                 cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                                 std::complex<float> beta,
+                                 cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatfma_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                  std::complex<float> alpha,
+                                  cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                  cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                                  std::complex<float> beta,
+                                  cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatfma_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 std::complex<double> alpha,
+                                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                 cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                 std::complex<double> beta,
+                                 cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatfma_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                  std::complex<double> alpha,
+                                  cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                  cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                  std::complex<double> beta,
+                                  cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatfma_batch_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                       float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                       std::int64_t stride_a, cl::sycl::buffer<float, 1> &b,
+                                       std::int64_t ldb, std::int64_t stride_b, float beta,
+                                       cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                       std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatfma_batch_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                        float alpha, cl::sycl::buffer<float, 1> &a,
+                                        std::int64_t lda, std::int64_t stride_a,
+                                        cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                        std::int64_t stride_b, float beta,
+                                        cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                        std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatfma_batch_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                       double alpha, cl::sycl::buffer<double, 1> &a,
+                                       std::int64_t lda, std::int64_t stride_a,
+                                       cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                       std::int64_t stride_b, double beta,
+                                       cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                       std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatfma_batch_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                        double alpha, cl::sycl::buffer<double, 1> &a,
+                                        std::int64_t lda, std::int64_t stride_a,
+                                        cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                        std::int64_t stride_b, double beta,
+                                        cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                        std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatfma_batch_precondition(
+    cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<float> alpha,
+    cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda, std::int64_t stride_a,
+    cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+    std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+    std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatfma_batch_postcondition(
+    cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<float> alpha,
+    cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda, std::int64_t stride_a,
+    cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+    std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+    std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatfma_batch_precondition(
+    cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<double> alpha,
+    cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda, std::int64_t stride_a,
+    cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+    std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+    std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatfma_batch_postcondition(
+    cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<double> alpha,
+    cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda, std::int64_t stride_a,
+    cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+    std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+    std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatmul_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                 cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                 cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatmul_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                  cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                  cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                  cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatmul_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                 cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                 cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatmul_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                  cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                  cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                  cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatmul_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                 cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                                 cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatmul_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                  cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                  cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                                  cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatmul_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                 cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                 cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatmul_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                  cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                  cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                  cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatmul_batch_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                       cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                       std::int64_t stride_a, cl::sycl::buffer<float, 1> &b,
+                                       std::int64_t ldb, std::int64_t stride_b,
+                                       cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                       std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatmul_batch_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                        cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                        std::int64_t stride_a, cl::sycl::buffer<float, 1> &b,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                        std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatmul_batch_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                       cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                       std::int64_t stride_a, cl::sycl::buffer<double, 1> &b,
+                                       std::int64_t ldb, std::int64_t stride_b,
+                                       cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                       std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatmul_batch_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                        cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                        std::int64_t stride_a, cl::sycl::buffer<double, 1> &b,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                        std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatmul_batch_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                       cl::sycl::buffer<std::complex<float>, 1> &a,
+                                       std::int64_t lda, std::int64_t stride_a,
+                                       cl::sycl::buffer<std::complex<float>, 1> &b,
+                                       std::int64_t ldb, std::int64_t stride_b,
+                                       cl::sycl::buffer<std::complex<float>, 1> &c,
+                                       std::int64_t ldc, std::int64_t stride_c,
+                                       std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatmul_batch_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                        cl::sycl::buffer<std::complex<float>, 1> &a,
+                                        std::int64_t lda, std::int64_t stride_a,
+                                        cl::sycl::buffer<std::complex<float>, 1> &b,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        cl::sycl::buffer<std::complex<float>, 1> &c,
+                                        std::int64_t ldc, std::int64_t stride_c,
+                                        std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void omatmul_batch_precondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                       cl::sycl::buffer<std::complex<double>, 1> &a,
+                                       std::int64_t lda, std::int64_t stride_a,
+                                       cl::sycl::buffer<std::complex<double>, 1> &b,
+                                       std::int64_t ldb, std::int64_t stride_b,
+                                       cl::sycl::buffer<std::complex<double>, 1> &c,
+                                       std::int64_t ldc, std::int64_t stride_c,
+                                       std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void omatmul_batch_postcondition(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                        cl::sycl::buffer<std::complex<double>, 1> &a,
+                                        std::int64_t lda, std::int64_t stride_a,
+                                        cl::sycl::buffer<std::complex<double>, 1> &b,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        cl::sycl::buffer<std::complex<double>, 1> &c,
+                                        std::int64_t ldc, std::int64_t stride_c,
+                                        std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void vclamp_precondition(cl::sycl::queue &queue, std::int64_t n, float lo, float hi,
+                                cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void vclamp_postcondition(cl::sycl::queue &queue, std::int64_t n, float lo, float hi,
+                                 cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                 cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void vclamp_precondition(cl::sycl::queue &queue, std::int64_t n, double lo, double hi,
+                                cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void vclamp_postcondition(cl::sycl::queue &queue, std::int64_t n, double lo, double hi,
+                                 cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                 cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void vdiv_precondition(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                              std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                              cl::sycl::buffer<float, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void vdiv_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                               cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                               cl::sycl::buffer<float, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void vdiv_precondition(cl::sycl::queue &queue, std::int64_t n,
+                              cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                              cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                              cl::sycl::buffer<double, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void vdiv_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                               cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                               cl::sycl::buffer<double, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void vdiv_precondition(cl::sycl::queue &queue, std::int64_t n,
+                              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                              cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                              cl::sycl::buffer<std::complex<float>, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void vdiv_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                               cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                               cl::sycl::buffer<std::complex<float>, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void vdiv_precondition(cl::sycl::queue &queue, std::int64_t n,
+                              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                              cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                              cl::sycl::buffer<std::complex<double>, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void vdiv_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                               cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                               cl::sycl::buffer<std::complex<double>, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void vfma_precondition(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                              cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                              cl::sycl::buffer<float, 1> &y, std::int64_t incy, float beta,
+                              cl::sycl::buffer<float, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void vfma_postcondition(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                               cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                               cl::sycl::buffer<float, 1> &y, std::int64_t incy, float beta,
+                               cl::sycl::buffer<float, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void vfma_precondition(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                              cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                              cl::sycl::buffer<double, 1> &y, std::int64_t incy, double beta,
+                              cl::sycl::buffer<double, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void vfma_postcondition(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                               cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                               cl::sycl::buffer<double, 1> &y, std::int64_t incy, double beta,
+                               cl::sycl::buffer<double, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void vfma_precondition(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                              cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                              std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &z,
+                              std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void vfma_postcondition(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                               cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                               cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                               std::complex<float> beta,
+                               cl::sycl::buffer<std::complex<float>, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void vfma_precondition(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                              cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                              std::complex<double> beta,
+                              cl::sycl::buffer<std::complex<double>, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void vfma_postcondition(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                               cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                               cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                               std::complex<double> beta,
+                               cl::sycl::buffer<std::complex<double>, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void vmul_precondition(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                              std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                              cl::sycl::buffer<float, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void vmul_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                               cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                               cl::sycl::buffer<float, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void vmul_precondition(cl::sycl::queue &queue, std::int64_t n,
+                              cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                              cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                              cl::sycl::buffer<double, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void vmul_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                               cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                               cl::sycl::buffer<double, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void vmul_precondition(cl::sycl::queue &queue, std::int64_t n,
+                              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                              cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                              cl::sycl::buffer<std::complex<float>, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void vmul_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                               cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                               cl::sycl::buffer<std::complex<float>, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void vmul_precondition(cl::sycl::queue &queue, std::int64_t n,
+                              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                              cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                              cl::sycl::buffer<std::complex<double>, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void vmul_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                               cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                               cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                               cl::sycl::buffer<std::complex<double>, 1> &z, std::int64_t incz) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm3m_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                std::int64_t m, std::int64_t n, std::int64_t k,
+                                std::complex<float> alpha,
+                                cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                                std::complex<float> beta,
+                                cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm3m_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                 std::int64_t m, std::int64_t n, std::int64_t k,
+                                 std::complex<float> alpha,
+                                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                 cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                                 std::complex<float> beta,
+                                 cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm3m_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                std::int64_t m, std::int64_t n, std::int64_t k,
+                                std::complex<double> alpha,
+                                cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                std::complex<double> beta,
+                                cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm3m_postcondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                 std::int64_t m, std::int64_t n, std::int64_t k,
+                                 std::complex<double> alpha,
+                                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                 cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                 std::complex<double> beta,
+                                 cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm3m_batch_precondition(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                      std::int64_t m, std::int64_t n, std::int64_t k,
+                                      std::complex<float> alpha,
+                                      cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                      std::int64_t stride_a,
+                                      cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                                      std::int64_t stride_b, std::complex<float> beta,
+                                      cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                                      std::int64_t stride_c, std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm3m_batch_postcondition(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+    std::int64_t lda, std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+    std::int64_t ldb, std::int64_t stride_b, std::complex<float> beta,
+    cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm3m_batch_precondition(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+    std::int64_t lda, std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+    std::int64_t ldb, std::int64_t stride_b, std::complex<double> beta,
+    cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm3m_batch_postcondition(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+    std::int64_t lda, std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+    std::int64_t ldb, std::int64_t stride_b, std::complex<double> beta,
+    cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+        /* add postchecks to queue here for input args.  */
+#endif
+}
+
 } //namespace blas
 } //namespace onemkl
 
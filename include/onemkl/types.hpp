@@ -20,6 +20,10 @@
 #ifndef _ONEMKL_TYPES_HPP_
 #define _ONEMKL_TYPES_HPP_
 
+#include <cstdint>
+
+#include "onemkl/bfloat16.hpp"
+
 namespace onemkl {
 
 // BLAS flag types.
@@ -33,6 +37,47 @@ enum class side : char { left = 0, right = 1, L = 0, R = 1 };
 
 enum class offset : char { row = 0, column = 1, fix = 2, R = 0, C = 1, F = 2 };
 
+enum class identifier : char { a = 0, b = 1, A = 0, B = 1 };
+
+enum class tile_schedule : char { blocked = 0, work_stealing = 1 };
+
+// Accumulation of the float dot, nrm2 and asum: native runs the plain float
+// routines, extended accumulates in double and pairwise adds float partial
+// sums pairwise, so that the rounding error grows with log(n) instead of n.
+enum class accumulation : char { native = 0, extended = 1, pairwise = 2 };
+
+// Reduction applied to each row or column of a matrix by reduce_rows and
+// reduce_columns: the sum, the sum of absolute values, the largest absolute
+// value or the Euclidean norm of its entries.
+enum class reduction : char { sum = 0, asum = 1, amax = 2, nrm2 = 3 };
+
+// Matrix norm computed by lange: the largest absolute value, the largest
+// column sum of absolute values, the largest row sum of absolute values or
+// the Frobenius norm, as LAPACK's 'M', 'O', 'I' and 'F'.
+enum class norm_type : char {
+    max       = 0,
+    one       = 1,
+    inf       = 2,
+    frobenius = 3,
+    M         = 0,
+    O         = 1,
+    I         = 2,
+    F         = 3
+};
+
+// Compact batch layout used by the *_compact routines. The matrices of a batch
+// are interleaved in packs of compact_width<T>() matrices, so that one 64-byte
+// vector holds the same element of every matrix of a pack. Element (i, j) of
+// matrix p, stored with leading dimension ld, is at index
+//   ((p / w) * ld * cols + i + ld * j) * w + p % w
+// with w = compact_width<T>() and cols the number of columns of the matrices.
+// A batch of batch_size matrices thus takes ceil(batch_size / w) * ld * cols * w
+// elements. Unused entries of the last pack are filled by gepack_compact.
+template <typename T>
+constexpr std::int64_t compact_width() {
+    return 64 / sizeof(T);
+}
+
 // LAPACK flag types.
 enum class job : char {
     novec        = 0,
@@ -180,5 +180,964 @@ void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, trans
                 std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
     throw std::runtime_error("Not implemented for cublas");
 }
+void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+                cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                cl::sycl::buffer<float, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+                cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+                cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+                cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                cl::sycl::buffer<double, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+                cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<double, 1> &beta,
+                cl::sycl::buffer<double, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+                cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                cl::sycl::buffer<std::complex<float>, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+                cl::sycl::buffer<std::int64_t, 1> &offset_b,
+                cl::sycl::buffer<std::complex<float>, 1> &beta,
+                cl::sycl::buffer<std::complex<float>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+                cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                cl::sycl::buffer<std::complex<double>, 1> &b,
+                cl::sycl::buffer<std::int64_t, 1> &ldb, cl::sycl::buffer<std::int64_t, 1> &offset_b,
+                cl::sycl::buffer<std::complex<double>, 1> &beta,
+                cl::sycl::buffer<std::complex<double>, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, cl::sycl::buffer<std::int64_t, 1> &offset_c,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+void herk_batch(cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<float, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void herk_batch(cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<double, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<double, 1> &beta,
+                cl::sycl::buffer<std::complex<double>, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+void herk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
+                std::int64_t k, float alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                std::int64_t lda, std::int64_t stride_a, float beta,
+                cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void herk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
+                std::int64_t k, double alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                std::int64_t lda, std::int64_t stride_a, double beta,
+                cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+void syrk_batch(cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<float, 1> &alpha,
+                cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void syrk_batch(cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<double, 1> &alpha,
+                cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void syrk_batch(cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<float>, 1> &beta,
+                cl::sycl::buffer<std::complex<float>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void syrk_batch(cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<double>, 1> &beta,
+                cl::sycl::buffer<std::complex<double>, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
+                std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
+                std::int64_t k, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, double beta, cl::sycl::buffer<double, 1> &c,
+                std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
+                std::int64_t k, std::complex<float> alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, std::complex<float> beta,
+                cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
+                std::int64_t k, std::complex<double> alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, std::complex<double> beta,
+                cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+void gemv_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<float, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<float, 1> &beta,
+                cl::sycl::buffer<float, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemv_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<double, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<double, 1> &beta,
+                cl::sycl::buffer<double, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemv_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<float>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<float>, 1> &beta,
+                cl::sycl::buffer<std::complex<float>, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemv_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<double>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<double>, 1> &beta,
+                cl::sycl::buffer<std::complex<double>, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+void gemv_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                cl::sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stride_x, float beta,
+                cl::sycl::buffer<float, 1> &y, std::int64_t incy, std::int64_t stride_y,
+                std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemv_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, double beta, cl::sycl::buffer<double, 1> &y,
+                std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemv_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                std::int64_t lda, std::int64_t stride_a,
+                cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, std::complex<float> beta,
+                cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                std::int64_t stride_y, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemv_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                std::int64_t lda, std::int64_t stride_a,
+                cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, std::complex<double> beta,
+                cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                std::int64_t stride_y, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+void dgmm_batch(cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void dgmm_batch(cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<double, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<double, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void dgmm_batch(cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<float>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<float>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void dgmm_batch(cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<double>, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<double>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<double>, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+void dgmm_batch(cl::sycl::queue &queue, side left_right, std::int64_t m, std::int64_t n,
+                cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                cl::sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stride_x,
+                cl::sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void dgmm_batch(cl::sycl::queue &queue, side left_right, std::int64_t m, std::int64_t n,
+                cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                cl::sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stride_x,
+                cl::sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void dgmm_batch(cl::sycl::queue &queue, side left_right, std::int64_t m, std::int64_t n,
+                cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &x,
+                std::int64_t incx, std::int64_t stride_x,
+                cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void dgmm_batch(cl::sycl::queue &queue, side left_right, std::int64_t m, std::int64_t n,
+                cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &x,
+                std::int64_t incx, std::int64_t stride_x,
+                cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+void axpy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<float, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void axpy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<double, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void axpy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<float>, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void axpy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<double>, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+void axpy_batch(cl::sycl::queue &queue, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+                std::int64_t incx, std::int64_t stride_x, cl::sycl::buffer<float, 1> &y,
+                std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void axpy_batch(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                cl::sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stride_x,
+                cl::sycl::buffer<double, 1> &y, std::int64_t incy, std::int64_t stride_y,
+                std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void axpy_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, cl::sycl::buffer<std::complex<float>, 1> &y,
+                std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void axpy_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, cl::sycl::buffer<std::complex<double>, 1> &y,
+                std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+void copy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<float, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void copy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<double, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void copy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<float>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<float>, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void copy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<double>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<double>, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+void copy_batch(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                std::int64_t incx, std::int64_t stride_x, cl::sycl::buffer<float, 1> &y,
+                std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void copy_batch(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                std::int64_t incx, std::int64_t stride_x, cl::sycl::buffer<double, 1> &y,
+                std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void copy_batch(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
+                std::int64_t incx, std::int64_t stride_x,
+                cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                std::int64_t stride_y, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void copy_batch(cl::sycl::queue &queue, std::int64_t n,
+                cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, cl::sycl::buffer<std::complex<double>, 1> &y,
+                std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+void dot_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+               cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+               cl::sycl::buffer<float, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+               cl::sycl::buffer<float, 1> &result, std::int64_t group_count,
+               cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void dot_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+               cl::sycl::buffer<double, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+               cl::sycl::buffer<double, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+               cl::sycl::buffer<double, 1> &result, std::int64_t group_count,
+               cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+void dot_batch(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+               std::int64_t incx, std::int64_t stride_x, cl::sycl::buffer<float, 1> &y,
+               std::int64_t incy, std::int64_t stride_y, cl::sycl::buffer<float, 1> &result,
+               std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void dot_batch(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+               std::int64_t incx, std::int64_t stride_x, cl::sycl::buffer<double, 1> &y,
+               std::int64_t incy, std::int64_t stride_y, cl::sycl::buffer<double, 1> &result,
+               std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+void scal_batch(cl::sycl::queue &queue, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+                std::int64_t incx, std::int64_t stride_x, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void scal_batch(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                cl::sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stride_x,
+                std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void scal_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void scal_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void scal_batch(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void scal_batch(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+                cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<half, 1> &alpha, cl::sycl::buffer<half, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                cl::sycl::buffer<half, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+                cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<half, 1> &beta,
+                cl::sycl::buffer<half, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                std::int64_t n, std::int64_t k, half alpha, cl::sycl::buffer<half, 1> &a,
+                std::int64_t lda, std::int64_t stride_a, cl::sycl::buffer<half, 1> &b,
+                std::int64_t ldb, std::int64_t stride_b, half beta, cl::sycl::buffer<half, 1> &c,
+                std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+                cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<half, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                cl::sycl::buffer<half, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+                cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+                cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<half, 1> &a,
+                std::int64_t lda, std::int64_t stride_a, cl::sycl::buffer<half, 1> &b,
+                std::int64_t ldb, std::int64_t stride_b, float beta, cl::sycl::buffer<float, 1> &c,
+                std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+                cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<int8_t, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                cl::sycl::buffer<uint8_t, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+                cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+                cl::sycl::buffer<int32_t, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<int8_t, 1> &a,
+                std::int64_t lda, std::int64_t stride_a, cl::sycl::buffer<uint8_t, 1> &b,
+                std::int64_t ldb, std::int64_t stride_b, float beta,
+                cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                    float alpha, cl::sycl::buffer<float, 1> &ab, std::int64_t lda, std::int64_t ldb,
+                    std::int64_t stride, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                    double alpha, cl::sycl::buffer<double, 1> &ab, std::int64_t lda,
+                    std::int64_t ldb, std::int64_t stride, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                    std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &ab,
+                    std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                    std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                    std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &ab,
+                    std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                    std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                   std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, float beta, cl::sycl::buffer<float, 1> &b,
+                   std::int64_t ldb, std::int64_t stride_b, cl::sycl::buffer<float, 1> &c,
+                   std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                   std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, double beta, cl::sycl::buffer<double, 1> &b,
+                   std::int64_t ldb, std::int64_t stride_b, cl::sycl::buffer<double, 1> &c,
+                   std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                   std::int64_t n, std::complex<float> alpha,
+                   cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, std::complex<float> beta,
+                   cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, cl::sycl::buffer<std::complex<float>, 1> &c,
+                   std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                   std::int64_t n, std::complex<double> alpha,
+                   cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, std::complex<double> beta,
+                   cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, cl::sycl::buffer<std::complex<double>, 1> &c,
+                   std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                    float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                    std::int64_t stride_b, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                    double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                    std::int64_t stride_b, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                    std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                    std::int64_t lda, std::int64_t stride_a,
+                    cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                    std::int64_t stride_b, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                    std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                    std::int64_t lda, std::int64_t stride_a,
+                    cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                    std::int64_t stride_b, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gbtge_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                 std::int64_t ku, cl::sycl::buffer<float, 1> &ab, std::int64_t ldab,
+                 std::int64_t stride_ab, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                 std::int64_t stride_a, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gbtge_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                 std::int64_t ku, cl::sycl::buffer<double, 1> &ab, std::int64_t ldab,
+                 std::int64_t stride_ab, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                 std::int64_t stride_a, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gbtge_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                 std::int64_t ku, cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t ldab,
+                 std::int64_t stride_ab, cl::sycl::buffer<std::complex<float>, 1> &a,
+                 std::int64_t lda, std::int64_t stride_a, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gbtge_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                 std::int64_t ku, cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t ldab,
+                 std::int64_t stride_ab, cl::sycl::buffer<std::complex<double>, 1> &a,
+                 std::int64_t lda, std::int64_t stride_a, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gettgb_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                  std::int64_t ku, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                  std::int64_t stride_a, cl::sycl::buffer<float, 1> &ab, std::int64_t ldab,
+                  std::int64_t stride_ab, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gettgb_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                  std::int64_t ku, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                  std::int64_t stride_a, cl::sycl::buffer<double, 1> &ab, std::int64_t ldab,
+                  std::int64_t stride_ab, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gettgb_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                  std::int64_t ku, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                  std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &ab,
+                  std::int64_t ldab, std::int64_t stride_ab, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gettgb_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                  std::int64_t ku, cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                  std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &ab,
+                  std::int64_t ldab, std::int64_t stride_ab, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void tpttr_batch(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<float, 1> &ap, std::int64_t stride_ap,
+                 cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                 std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void tpttr_batch(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<double, 1> &ap, std::int64_t stride_ap,
+                 cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                 std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void tpttr_batch(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<std::complex<float>, 1> &ap, std::int64_t stride_ap,
+                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                 std::int64_t stride_a, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void tpttr_batch(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<std::complex<double>, 1> &ap, std::int64_t stride_ap,
+                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                 std::int64_t stride_a, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void trttp_batch(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                 cl::sycl::buffer<float, 1> &ap, std::int64_t stride_ap, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void trttp_batch(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                 cl::sycl::buffer<double, 1> &ap, std::int64_t stride_ap, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void trttp_batch(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                 std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &ap,
+                 std::int64_t stride_ap, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void trttp_batch(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                 std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &ap,
+                 std::int64_t stride_ap, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemv_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                float alpha, cl::sycl::buffer<half, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                cl::sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stride_x, float beta,
+                cl::sycl::buffer<float, 1> &y, std::int64_t incy, std::int64_t stride_y,
+                std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemv_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                float alpha, cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                std::int64_t stride_y, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatclamp_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float lo, float hi,
+                     cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                     cl::sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                     std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatclamp_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, double lo, double hi,
+                     cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                     cl::sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                     std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatdiv_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                   std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatdiv_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                   std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatdiv_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                   std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatdiv_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                   std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatfma_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float alpha,
+                   cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatfma_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, double alpha,
+                   cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatfma_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                   std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, std::complex<float> beta,
+                   cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatfma_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                   std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, std::complex<double> beta,
+                   cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatmul_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                   std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatmul_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                   std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatmul_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                   std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatmul_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                   std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm3m_batch(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                  std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                  cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                  std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                  std::int64_t ldb, std::int64_t stride_b, std::complex<float> beta,
+                  cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                  std::int64_t stride_c, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm3m_batch(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                  std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                  cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                  std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                  std::int64_t ldb, std::int64_t stride_b, std::complex<double> beta,
+                  cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                  std::int64_t stride_c, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
 } // namespace cublas
 } // namespace onemkl
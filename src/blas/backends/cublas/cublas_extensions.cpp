@@ -109,5 +109,597 @@ void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, std::i
     throw std::runtime_error("Not implemented for cublas");
 }
 
+void convert(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<half, 1> &x,
+             cl::sycl::buffer<float, 1> &y) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void convert(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+             cl::sycl::buffer<half, 1> &y) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void convert(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<bfloat16, 1> &x,
+             cl::sycl::buffer<float, 1> &y) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void convert(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+             cl::sycl::buffer<bfloat16, 1> &y) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void convert(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, cl::sycl::buffer<half, 1> &a,
+             std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void convert(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a,
+             std::int64_t lda, cl::sycl::buffer<half, 1> &b, std::int64_t ldb) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void convert(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+             std::int64_t ldb) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void convert(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a,
+             std::int64_t lda, cl::sycl::buffer<bfloat16, 1> &b, std::int64_t ldb) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, offset offsetc,
+              std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+              cl::sycl::buffer<int16_t, 1> &a, std::int64_t lda, int16_t ao,
+              cl::sycl::buffer<int16_t, 1> &b, std::int64_t ldb, int16_t bo, float beta,
+              cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, offset offsetc,
+              std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+              cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+              cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo, float beta,
+              cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, offset offsetc,
+              std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+              cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
+              cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo, float beta,
+              cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, offset scalec,
+              std::int64_t m, std::int64_t n, std::int64_t k, cl::sycl::buffer<int8_t, 1> &a,
+              std::int64_t lda, int8_t ao, cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb,
+              uint8_t bo, cl::sycl::buffer<float, 1> &scales, int8_t zc,
+              cl::sycl::buffer<int8_t, 1> &c, std::int64_t ldc) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, offset scalec,
+              std::int64_t m, std::int64_t n, std::int64_t k, cl::sycl::buffer<int8_t, 1> &a,
+              std::int64_t lda, int8_t ao, cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb,
+              uint8_t bo, cl::sycl::buffer<float, 1> &scales, uint8_t zc,
+              cl::sycl::buffer<uint8_t, 1> &c, std::int64_t ldc) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, offset scalec,
+              std::int64_t m, std::int64_t n, std::int64_t k, cl::sycl::buffer<int8_t, 1> &a,
+              std::int64_t lda, int8_t ao, cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb,
+              int8_t bo, cl::sycl::buffer<float, 1> &scales, int8_t zc,
+              cl::sycl::buffer<int8_t, 1> &c, std::int64_t ldc) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, offset scalec,
+              std::int64_t m, std::int64_t n, std::int64_t k, cl::sycl::buffer<int8_t, 1> &a,
+              std::int64_t lda, int8_t ao, cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb,
+              int8_t bo, cl::sycl::buffer<float, 1> &scales, uint8_t zc,
+              cl::sycl::buffer<uint8_t, 1> &c, std::int64_t ldc) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, offset scalec,
+              std::int64_t m, std::int64_t n, std::int64_t k, cl::sycl::buffer<uint8_t, 1> &a,
+              std::int64_t lda, uint8_t ao, cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb,
+              int8_t bo, cl::sycl::buffer<float, 1> &scales, int8_t zc,
+              cl::sycl::buffer<int8_t, 1> &c, std::int64_t ldc) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, offset scalec,
+              std::int64_t m, std::int64_t n, std::int64_t k, cl::sycl::buffer<uint8_t, 1> &a,
+              std::int64_t lda, uint8_t ao, cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb,
+              int8_t bo, cl::sycl::buffer<float, 1> &scales, uint8_t zc,
+              cl::sycl::buffer<uint8_t, 1> &c, std::int64_t ldc) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm_s8u8s32_compute(cl::sycl::queue &queue, transpose transb, offset offsetc, std::int64_t m,
+                          std::int64_t n, std::int64_t k, float alpha,
+                          cl::sycl::buffer<int8_t, 1> &packed_a, int8_t ao,
+                          cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo, float beta,
+                          cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                          cl::sycl::buffer<int32_t, 1> &co) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm_s8u8s32_compute(cl::sycl::queue &queue, transpose transa, offset offsetc, std::int64_t m,
+                          std::int64_t n, std::int64_t k, float alpha,
+                          cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+                          cl::sycl::buffer<uint8_t, 1> &packed_b, uint8_t bo, float beta,
+                          cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                          cl::sycl::buffer<int32_t, 1> &co) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm_s8u8s32_pack(cl::sycl::queue &queue, transpose transa, std::int64_t m, std::int64_t n,
+                       std::int64_t k, cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda,
+                       cl::sycl::buffer<int8_t, 1> &packed_a) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm_s8u8s32_pack(cl::sycl::queue &queue, transpose transb, std::int64_t m, std::int64_t n,
+                       std::int64_t k, cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb,
+                       cl::sycl::buffer<uint8_t, 1> &packed_b) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+std::int64_t gemm_s8u8s32_pack_get_size(cl::sycl::queue &queue, identifier which, std::int64_t m,
+                                        std::int64_t n, std::int64_t k) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gepack_compact(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                    cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                    cl::sycl::buffer<float, 1> &ap, std::int64_t ldap, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gepack_compact(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                    cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                    cl::sycl::buffer<double, 1> &ap, std::int64_t ldap, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void geunpack_compact(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                      cl::sycl::buffer<float, 1> &ap, std::int64_t ldap,
+                      cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                      std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void geunpack_compact(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                      cl::sycl::buffer<double, 1> &ap, std::int64_t ldap,
+                      cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                      std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm_compact(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                  std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a,
+                  std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+                  cl::sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemm_compact(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                  std::int64_t n, std::int64_t k, double alpha, cl::sycl::buffer<double, 1> &a,
+                  std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+                  cl::sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void trsm_compact(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
+                  diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
+                  cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+                  std::int64_t ldb, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void trsm_compact(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
+                  diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
+                  cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+                  std::int64_t ldb, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void getrfnp_compact(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                     cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void getrfnp_compact(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                     cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t batch_size) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, float alpha,
+              cl::sycl::buffer<float, 1> &ab, std::int64_t lda, std::int64_t ldb) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, double alpha,
+              cl::sycl::buffer<double, 1> &ab, std::int64_t lda, std::int64_t ldb) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+              std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &ab,
+              std::int64_t lda, std::int64_t ldb) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+              std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &ab,
+              std::int64_t lda, std::int64_t ldb) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+             std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+             float beta, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+             std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+             double beta, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+             std::int64_t n, std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+             std::int64_t lda, std::complex<float> beta,
+             cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+             std::int64_t n, std::complex<double> alpha,
+             cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+             std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &b,
+             std::int64_t ldb, cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, float alpha,
+              cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+              std::int64_t ldb) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, double alpha,
+              cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+              std::int64_t ldb) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+              std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+              std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+              std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+              std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gbtge(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl, std::int64_t ku,
+           cl::sycl::buffer<float, 1> &ab, std::int64_t ldab, cl::sycl::buffer<float, 1> &a,
+           std::int64_t lda) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gbtge(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl, std::int64_t ku,
+           cl::sycl::buffer<double, 1> &ab, std::int64_t ldab, cl::sycl::buffer<double, 1> &a,
+           std::int64_t lda) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gbtge(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl, std::int64_t ku,
+           cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t ldab,
+           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gbtge(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl, std::int64_t ku,
+           cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t ldab,
+           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gettgb(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+            std::int64_t ku, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<float, 1> &ab, std::int64_t ldab) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gettgb(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+            std::int64_t ku, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<double, 1> &ab, std::int64_t ldab) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gettgb(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+            std::int64_t ku, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t ldab) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gettgb(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+            std::int64_t ku, cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t ldab) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void tpttr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, cl::sycl::buffer<float, 1> &ap,
+           cl::sycl::buffer<float, 1> &a, std::int64_t lda) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void tpttr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<double, 1> &ap, cl::sycl::buffer<double, 1> &a, std::int64_t lda) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void tpttr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<std::complex<float>, 1> &ap,
+           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void tpttr(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<std::complex<double>, 1> &ap,
+           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void trttp(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, cl::sycl::buffer<float, 1> &a,
+           std::int64_t lda, cl::sycl::buffer<float, 1> &ap) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void trttp(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, cl::sycl::buffer<double, 1> &a,
+           std::int64_t lda, cl::sycl::buffer<double, 1> &ap) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void trttp(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+           cl::sycl::buffer<std::complex<float>, 1> &ap) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void trttp(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+           cl::sycl::buffer<std::complex<double>, 1> &ap) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void lange(cl::sycl::queue &queue, norm_type norm, transpose trans, std::int64_t m, std::int64_t n,
+           cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &result) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void lange(cl::sycl::queue &queue, norm_type norm, transpose trans, std::int64_t m, std::int64_t n,
+           cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &result) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void reduce_columns(cl::sycl::queue &queue, reduction op, transpose trans, std::int64_t m,
+                    std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                    cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void reduce_columns(cl::sycl::queue &queue, reduction op, transpose trans, std::int64_t m,
+                    std::int64_t n, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                    cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void reduce_rows(cl::sycl::queue &queue, reduction op, transpose trans, std::int64_t m,
+                 std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                 cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void reduce_rows(cl::sycl::queue &queue, reduction op, transpose trans, std::int64_t m,
+                 std::int64_t n, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                 cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatclamp(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float lo, float hi,
+               cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+               std::int64_t ldb) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatclamp(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, double lo, double hi,
+               cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+               std::int64_t ldb) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatdiv(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a,
+             std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatdiv(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, cl::sycl::buffer<double, 1> &a,
+             std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatdiv(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+             cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatdiv(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+             cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatfma(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float alpha,
+             cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+             std::int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatfma(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, double alpha,
+             cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+             std::int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatfma(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<float> alpha,
+             cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+             cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+             std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+             std::int64_t ldc) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatfma(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<double> alpha,
+             cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+             cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+             std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+             std::int64_t ldc) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatmul(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a,
+             std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatmul(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, cl::sycl::buffer<double, 1> &a,
+             std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatmul(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+             cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void omatmul(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+             cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void vclamp(cl::sycl::queue &queue, std::int64_t n, float lo, float hi,
+            cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
+            std::int64_t incy) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void vclamp(cl::sycl::queue &queue, std::int64_t n, double lo, double hi,
+            cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
+            std::int64_t incy) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void vdiv(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<float, 1> &y, std::int64_t incy, cl::sycl::buffer<float, 1> &z,
+          std::int64_t incz) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void vdiv(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<double, 1> &y, std::int64_t incy, cl::sycl::buffer<double, 1> &z,
+          std::int64_t incz) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void vdiv(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
+          std::int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+          cl::sycl::buffer<std::complex<float>, 1> &z, std::int64_t incz) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void vdiv(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x,
+          std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+          cl::sycl::buffer<std::complex<double>, 1> &z, std::int64_t incz) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void vfma(cl::sycl::queue &queue, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+          std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy, float beta,
+          cl::sycl::buffer<float, 1> &z, std::int64_t incz) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void vfma(cl::sycl::queue &queue, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
+          std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy, double beta,
+          cl::sycl::buffer<double, 1> &z, std::int64_t incz) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void vfma(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy, std::complex<float> beta,
+          cl::sycl::buffer<std::complex<float>, 1> &z, std::int64_t incz) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void vfma(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+          std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &z,
+          std::int64_t incz) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void vmul(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<float, 1> &y, std::int64_t incy, cl::sycl::buffer<float, 1> &z,
+          std::int64_t incz) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void vmul(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<double, 1> &y, std::int64_t incy, cl::sycl::buffer<double, 1> &z,
+          std::int64_t incz) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void vmul(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
+          std::int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+          cl::sycl::buffer<std::complex<float>, 1> &z, std::int64_t incz) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void vmul(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x,
+          std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+          cl::sycl::buffer<std::complex<double>, 1> &z, std::int64_t incz) {
+    throw std::runtime_error("Not implemented for cublas");
+}
 } // namespace cublas
 } // namespace onemkl
@@ -602,5 +602,178 @@ NRM2_LAUNCHER(std::complex<float>, float, cublasScnrm2)
 NRM2_LAUNCHER(std::complex<double>, double, cublasDznrm2)
 #undef NRM2_LAUNCHER
 
+void axpby(cl::sycl::queue &queue, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+           std::int64_t incx, float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void axpby(cl::sycl::queue &queue, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
+           std::int64_t incx, double beta, cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void axpby(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::complex<float> beta,
+           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void axpby(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
+           std::int64_t incy) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void asum(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<float, 1> &result, accumulation acc) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void dot(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+         cl::sycl::buffer<float, 1> &y, std::int64_t incy, cl::sycl::buffer<float, 1> &result,
+         accumulation acc) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void nrm2(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<float, 1> &result, accumulation acc) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void axpbypcz(cl::sycl::queue &queue, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+              std::int64_t incx, float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+              float gamma, cl::sycl::buffer<float, 1> &z, std::int64_t incz) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void axpbypcz(cl::sycl::queue &queue, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
+              std::int64_t incx, double beta, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+              double gamma, cl::sycl::buffer<double, 1> &z, std::int64_t incz) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void axpbypcz_dot(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                  cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                  cl::sycl::buffer<float, 1> &y, std::int64_t incy, float gamma,
+                  cl::sycl::buffer<float, 1> &z, std::int64_t incz, cl::sycl::buffer<float, 1> &w,
+                  std::int64_t incw, cl::sycl::buffer<float, 1> &result) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void axpbypcz_dot(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                  cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                  cl::sycl::buffer<double, 1> &y, std::int64_t incy, double gamma,
+                  cl::sycl::buffer<double, 1> &z, std::int64_t incz, cl::sycl::buffer<double, 1> &w,
+                  std::int64_t incw, cl::sycl::buffer<double, 1> &result) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+cl::sycl::event asum(cl::sycl::queue &queue, std::int64_t n,
+                     cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                     float *result) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+cl::sycl::event asum(cl::sycl::queue &queue, std::int64_t n,
+                     cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                     double *result) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+cl::sycl::event asum(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                     std::int64_t incx, float *result) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+cl::sycl::event asum(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                     std::int64_t incx, double *result) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+cl::sycl::event dot(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                    std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                    float *result) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+cl::sycl::event dot(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                    std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                    double *result) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+cl::sycl::event dot(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                    std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                    double *result) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+cl::sycl::event iamin(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                      std::int64_t incx, std::int64_t *result) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+cl::sycl::event iamin(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                      std::int64_t incx, std::int64_t *result) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+cl::sycl::event iamin(cl::sycl::queue &queue, std::int64_t n,
+                      cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                      std::int64_t *result) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+cl::sycl::event iamin(cl::sycl::queue &queue, std::int64_t n,
+                      cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                      std::int64_t *result) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+cl::sycl::event iamax(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                      std::int64_t incx, std::int64_t *result) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+cl::sycl::event iamax(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                      std::int64_t incx, std::int64_t *result) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+cl::sycl::event iamax(cl::sycl::queue &queue, std::int64_t n,
+                      cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                      std::int64_t *result) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+cl::sycl::event iamax(cl::sycl::queue &queue, std::int64_t n,
+                      cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                      std::int64_t *result) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+cl::sycl::event nrm2(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                     std::int64_t incx, float *result) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+cl::sycl::event nrm2(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                     std::int64_t incx, double *result) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+cl::sycl::event nrm2(cl::sycl::queue &queue, std::int64_t n,
+                     cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                     float *result) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+cl::sycl::event nrm2(cl::sycl::queue &queue, std::int64_t n,
+                     cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                     double *result) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
 } // namespace cublas
 } // namespace onemkl
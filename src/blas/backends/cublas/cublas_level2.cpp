@@ -840,5 +840,17 @@ TRSV_LAUNCHER(std::complex<double>, cublasZtrsv)
 
 #undef TRSV_LAUNCHER
 
+void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, float alpha,
+          cl::sycl::buffer<half, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &x,
+          std::int64_t incx, float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
+void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, float alpha,
+          cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &x,
+          std::int64_t incx, float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    throw std::runtime_error("Not implemented for cublas");
+}
+
 } // namespace cublas
 } // namespace onemkl
@@ -63,6 +63,20 @@ GEMM_LAUNCHER(std::complex<double>, cublasZgemm)
 
 #undef GEMM_LAUNCHER
 
+// cuBLAS gemm3m takes the same arguments as gemm.
+#define GEMM3M_LAUNCHER(TYPE, CUBLAS_ROUTINE)                                                      \
+    void gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,  \
+                int64_t k, TYPE alpha, cl::sycl::buffer<TYPE, 1> &a, int64_t lda,                  \
+                cl::sycl::buffer<TYPE, 1> &b, int64_t ldb, TYPE beta,                              \
+                cl::sycl::buffer<TYPE, 1> &c, int64_t ldc) {                                       \
+        gemm(CUBLAS_ROUTINE, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc); \
+    }
+
+GEMM3M_LAUNCHER(std::complex<float>, cublasCgemm3m)
+GEMM3M_LAUNCHER(std::complex<double>, cublasZgemm3m)
+
+#undef GEMM3M_LAUNCHER
+
 void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
           std::int64_t n, std::int64_t k, half alpha, cl::sycl::buffer<half, 1> &a,
           std::int64_t lda, cl::sycl::buffer<half, 1> &b, std::int64_t ldb, half beta,
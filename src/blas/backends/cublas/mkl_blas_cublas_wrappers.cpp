@@ -201,4 +201,248 @@ extern "C" function_table_t mkl_blas_table = {
     onemkl::cublas::gemm_ext,
     onemkl::cublas::gemm_ext,
     onemkl::cublas::gemm_ext,
+    onemkl::cublas::convert,
+    onemkl::cublas::convert,
+    onemkl::cublas::convert,
+    onemkl::cublas::convert,
+    onemkl::cublas::convert,
+    onemkl::cublas::convert,
+    onemkl::cublas::convert,
+    onemkl::cublas::convert,
+    onemkl::cublas::gemm_ext,
+    onemkl::cublas::gemm_ext,
+    onemkl::cublas::gemm_ext,
+    onemkl::cublas::gemm_ext,
+    onemkl::cublas::gemm_ext,
+    onemkl::cublas::gemm_ext,
+    onemkl::cublas::gemm_ext,
+    onemkl::cublas::gemm_ext,
+    onemkl::cublas::gemm_ext,
+    onemkl::cublas::gemm_s8u8s32_compute,
+    onemkl::cublas::gemm_s8u8s32_compute,
+    onemkl::cublas::gemm_s8u8s32_pack,
+    onemkl::cublas::gemm_s8u8s32_pack,
+    onemkl::cublas::gemm_s8u8s32_pack_get_size,
+    onemkl::cublas::gemm_batch,
+    onemkl::cublas::gemm_batch,
+    onemkl::cublas::gemm_batch,
+    onemkl::cublas::gemm_batch,
+    onemkl::cublas::herk_batch,
+    onemkl::cublas::herk_batch,
+    onemkl::cublas::herk_batch,
+    onemkl::cublas::herk_batch,
+    onemkl::cublas::syrk_batch,
+    onemkl::cublas::syrk_batch,
+    onemkl::cublas::syrk_batch,
+    onemkl::cublas::syrk_batch,
+    onemkl::cublas::syrk_batch,
+    onemkl::cublas::syrk_batch,
+    onemkl::cublas::syrk_batch,
+    onemkl::cublas::syrk_batch,
+    onemkl::cublas::gemv_batch,
+    onemkl::cublas::gemv_batch,
+    onemkl::cublas::gemv_batch,
+    onemkl::cublas::gemv_batch,
+    onemkl::cublas::gemv_batch,
+    onemkl::cublas::gemv_batch,
+    onemkl::cublas::gemv_batch,
+    onemkl::cublas::gemv_batch,
+    onemkl::cublas::dgmm_batch,
+    onemkl::cublas::dgmm_batch,
+    onemkl::cublas::dgmm_batch,
+    onemkl::cublas::dgmm_batch,
+    onemkl::cublas::dgmm_batch,
+    onemkl::cublas::dgmm_batch,
+    onemkl::cublas::dgmm_batch,
+    onemkl::cublas::dgmm_batch,
+    onemkl::cublas::axpy_batch,
+    onemkl::cublas::axpy_batch,
+    onemkl::cublas::axpy_batch,
+    onemkl::cublas::axpy_batch,
+    onemkl::cublas::axpy_batch,
+    onemkl::cublas::axpy_batch,
+    onemkl::cublas::axpy_batch,
+    onemkl::cublas::axpy_batch,
+    onemkl::cublas::copy_batch,
+    onemkl::cublas::copy_batch,
+    onemkl::cublas::copy_batch,
+    onemkl::cublas::copy_batch,
+    onemkl::cublas::copy_batch,
+    onemkl::cublas::copy_batch,
+    onemkl::cublas::copy_batch,
+    onemkl::cublas::copy_batch,
+    onemkl::cublas::dot_batch,
+    onemkl::cublas::dot_batch,
+    onemkl::cublas::dot_batch,
+    onemkl::cublas::dot_batch,
+    onemkl::cublas::scal_batch,
+    onemkl::cublas::scal_batch,
+    onemkl::cublas::scal_batch,
+    onemkl::cublas::scal_batch,
+    onemkl::cublas::scal_batch,
+    onemkl::cublas::scal_batch,
+    onemkl::cublas::scal_batch,
+    onemkl::cublas::scal_batch,
+    onemkl::cublas::scal_batch,
+    onemkl::cublas::scal_batch,
+    onemkl::cublas::scal_batch,
+    onemkl::cublas::scal_batch,
+    onemkl::cublas::gemm_batch,
+    onemkl::cublas::gemm_batch,
+    onemkl::cublas::gemm_batch,
+    onemkl::cublas::gemm_batch,
+    onemkl::cublas::gemm_batch,
+    onemkl::cublas::gemm_batch,
+    onemkl::cublas::gepack_compact,
+    onemkl::cublas::gepack_compact,
+    onemkl::cublas::geunpack_compact,
+    onemkl::cublas::geunpack_compact,
+    onemkl::cublas::gemm_compact,
+    onemkl::cublas::gemm_compact,
+    onemkl::cublas::trsm_compact,
+    onemkl::cublas::trsm_compact,
+    onemkl::cublas::getrfnp_compact,
+    onemkl::cublas::getrfnp_compact,
+    onemkl::cublas::axpby,
+    onemkl::cublas::axpby,
+    onemkl::cublas::axpby,
+    onemkl::cublas::axpby,
+    onemkl::cublas::imatcopy,
+    onemkl::cublas::imatcopy,
+    onemkl::cublas::imatcopy,
+    onemkl::cublas::imatcopy,
+    onemkl::cublas::omatadd,
+    onemkl::cublas::omatadd,
+    onemkl::cublas::omatadd,
+    onemkl::cublas::omatadd,
+    onemkl::cublas::omatcopy,
+    onemkl::cublas::omatcopy,
+    onemkl::cublas::omatcopy,
+    onemkl::cublas::omatcopy,
+    onemkl::cublas::imatcopy_batch,
+    onemkl::cublas::imatcopy_batch,
+    onemkl::cublas::imatcopy_batch,
+    onemkl::cublas::imatcopy_batch,
+    onemkl::cublas::omatadd_batch,
+    onemkl::cublas::omatadd_batch,
+    onemkl::cublas::omatadd_batch,
+    onemkl::cublas::omatadd_batch,
+    onemkl::cublas::omatcopy_batch,
+    onemkl::cublas::omatcopy_batch,
+    onemkl::cublas::omatcopy_batch,
+    onemkl::cublas::omatcopy_batch,
+    onemkl::cublas::asum,
+    onemkl::cublas::dot,
+    onemkl::cublas::nrm2,
+    onemkl::cublas::axpbypcz,
+    onemkl::cublas::axpbypcz,
+    onemkl::cublas::axpbypcz_dot,
+    onemkl::cublas::axpbypcz_dot,
+    onemkl::cublas::asum,
+    onemkl::cublas::asum,
+    onemkl::cublas::asum,
+    onemkl::cublas::asum,
+    onemkl::cublas::dot,
+    onemkl::cublas::dot,
+    onemkl::cublas::dot,
+    onemkl::cublas::iamin,
+    onemkl::cublas::iamin,
+    onemkl::cublas::iamin,
+    onemkl::cublas::iamin,
+    onemkl::cublas::iamax,
+    onemkl::cublas::iamax,
+    onemkl::cublas::iamax,
+    onemkl::cublas::iamax,
+    onemkl::cublas::nrm2,
+    onemkl::cublas::nrm2,
+    onemkl::cublas::nrm2,
+    onemkl::cublas::nrm2,
+    onemkl::cublas::gbtge,
+    onemkl::cublas::gbtge,
+    onemkl::cublas::gbtge,
+    onemkl::cublas::gbtge,
+    onemkl::cublas::gettgb,
+    onemkl::cublas::gettgb,
+    onemkl::cublas::gettgb,
+    onemkl::cublas::gettgb,
+    onemkl::cublas::tpttr,
+    onemkl::cublas::tpttr,
+    onemkl::cublas::tpttr,
+    onemkl::cublas::tpttr,
+    onemkl::cublas::trttp,
+    onemkl::cublas::trttp,
+    onemkl::cublas::trttp,
+    onemkl::cublas::trttp,
+    onemkl::cublas::gbtge_batch,
+    onemkl::cublas::gbtge_batch,
+    onemkl::cublas::gbtge_batch,
+    onemkl::cublas::gbtge_batch,
+    onemkl::cublas::gettgb_batch,
+    onemkl::cublas::gettgb_batch,
+    onemkl::cublas::gettgb_batch,
+    onemkl::cublas::gettgb_batch,
+    onemkl::cublas::tpttr_batch,
+    onemkl::cublas::tpttr_batch,
+    onemkl::cublas::tpttr_batch,
+    onemkl::cublas::tpttr_batch,
+    onemkl::cublas::trttp_batch,
+    onemkl::cublas::trttp_batch,
+    onemkl::cublas::trttp_batch,
+    onemkl::cublas::trttp_batch,
+    onemkl::cublas::gemv,
+    onemkl::cublas::gemv,
+    onemkl::cublas::gemv_batch,
+    onemkl::cublas::gemv_batch,
+    onemkl::cublas::lange,
+    onemkl::cublas::lange,
+    onemkl::cublas::reduce_columns,
+    onemkl::cublas::reduce_columns,
+    onemkl::cublas::reduce_rows,
+    onemkl::cublas::reduce_rows,
+    onemkl::cublas::omatclamp,
+    onemkl::cublas::omatclamp,
+    onemkl::cublas::omatclamp_batch,
+    onemkl::cublas::omatclamp_batch,
+    onemkl::cublas::omatdiv,
+    onemkl::cublas::omatdiv,
+    onemkl::cublas::omatdiv,
+    onemkl::cublas::omatdiv,
+    onemkl::cublas::omatdiv_batch,
+    onemkl::cublas::omatdiv_batch,
+    onemkl::cublas::omatdiv_batch,
+    onemkl::cublas::omatdiv_batch,
+    onemkl::cublas::omatfma,
+    onemkl::cublas::omatfma,
+    onemkl::cublas::omatfma,
+    onemkl::cublas::omatfma,
+    onemkl::cublas::omatfma_batch,
+    onemkl::cublas::omatfma_batch,
+    onemkl::cublas::omatfma_batch,
+    onemkl::cublas::omatfma_batch,
+    onemkl::cublas::omatmul,
+    onemkl::cublas::omatmul,
+    onemkl::cublas::omatmul,
+    onemkl::cublas::omatmul,
+    onemkl::cublas::omatmul_batch,
+    onemkl::cublas::omatmul_batch,
+    onemkl::cublas::omatmul_batch,
+    onemkl::cublas::omatmul_batch,
+    onemkl::cublas::vclamp,
+    onemkl::cublas::vclamp,
+    onemkl::cublas::vdiv,
+    onemkl::cublas::vdiv,
+    onemkl::cublas::vdiv,
+    onemkl::cublas::vdiv,
+    onemkl::cublas::vfma,
+    onemkl::cublas::vfma,
+    onemkl::cublas::vfma,
+    onemkl::cublas::vfma,
+    onemkl::cublas::vmul,
+    onemkl::cublas::vmul,
+    onemkl::cublas::vmul,
+    onemkl::cublas::vmul,
+    onemkl::cublas::gemm3m,
+    onemkl::cublas::gemm3m,
+    onemkl::cublas::gemm3m_batch,
+    onemkl::cublas::gemm3m_batch,
 };
@@ -18,12 +18,558 @@
 *******************************************************************************/
 
 #include <CL/sycl.hpp>
+#include <array>
+#include <cstdlib>
+#include <limits>
+#include <type_traits>
 
+#include "cpu_batch_cache.hpp"
+#include "cpu_batch_schedule.hpp"
 #include "cpu_common.hpp"
+#include "cpu_elementwise.hpp"
+#include "cpu_hgemm.hpp"
+#include "cpu_hgemv.hpp"
+#include "cpu_storage.hpp"
 
 namespace onemkl {
 namespace mklcpu {
 
+// A grouped batch flattened into one entry per problem, so that it can be
+//  split across threads regardless of the group sizes. The N operands of all
+//  problems are stored back to back in their buffers: sizes(i) gives the
+//  number of elements of each operand of a problem of group i, and work(i)
+//  its number of multiply-adds.
+template <std::size_t N>
+class flat_batch {
+public:
+    template <typename S, typename W>
+    flat_batch(int64_t group_count, const int64_t *group_size, S sizes, W work) {
+        std::array<int64_t, N> offset = {};
+        for (int64_t i = 0; i < group_count; i++) {
+            const std::array<int64_t, N> size = sizes(i);
+            for (int64_t j = 0; j < group_size[i]; j++) {
+                group_.push_back(i);
+                offset_.push_back(offset);
+                for (std::size_t o = 0; o < N; o++)
+                    offset[o] += size[o];
+            }
+            work_ += work(i) * group_size[i];
+        }
+    }
+
+    // Calls f(i, offset) for every problem, i being its group and offset the
+    //  offsets of its operands.
+    template <typename F>
+    void run(F f) const {
+        const int64_t total_size = group_.size();
+        if (total_size == 0)
+            return;
+        batch_parallel_for(total_size, work_ / total_size, [&](int64_t begin, int64_t end) {
+            for (int64_t idx = begin; idx < end; idx++)
+                f(group_[idx], offset_[idx]);
+        });
+    }
+
+private:
+    std::vector<int64_t> group_;
+    std::vector<std::array<int64_t, N>> offset_;
+    double work_ = 0.0;
+};
+
+// Number of elements spanned by a vector of n elements with increment inc.
+static inline int64_t vector_size(int64_t n, int64_t inc) {
+    return (n > 0) ? 1 + (n - 1) * std::abs(inc) : 0;
+}
+
+// Rank-k updates of a grouped batch, syrk being ?syrk or ?herk.
+template <typename T, typename T_scalar, typename F>
+static inline void rk_batch(F syrk, int64_t group_count, const uplo *upper_lower,
+                            const transpose *trans, const int64_t *n, const int64_t *k,
+                            const T_scalar *alpha, const T *a, const int64_t *lda,
+                            const T_scalar *beta, T *c, const int64_t *ldc,
+                            const int64_t *group_size) {
+    flat_batch<2> batch(
+        group_count, group_size,
+        [=](int64_t i) {
+            const int64_t size_a = lda[i] * ((trans[i] == transpose::nontrans) ? k[i] : n[i]);
+            return std::array<int64_t, 2>{ { size_a, ldc[i] * n[i] } };
+        },
+        [=](int64_t i) { return 0.5 * n[i] * n[i] * k[i]; });
+    batch.run([=](int64_t i, const std::array<int64_t, 2> &offset) {
+        syrk(fortran_char(upper_lower[i]), fortran_char(trans[i]), (const MKL_INT *)&n[i],
+             (const MKL_INT *)&k[i], alpha + i, a + offset[0], (const MKL_INT *)&lda[i], beta + i,
+             c + offset[1], (const MKL_INT *)&ldc[i]);
+    });
+}
+
+// Rank-k updates of a strided batch, syrk being ?syrk or ?herk.
+template <typename T, typename T_scalar, typename F>
+static inline void rk_batch(F syrk, uplo upper_lower, transpose trans, int64_t n, int64_t k,
+                            T_scalar alpha, const T *a, int64_t lda, int64_t stride_a,
+                            T_scalar beta, T *c, int64_t ldc, int64_t stride_c,
+                            int64_t batch_size) {
+    const char uplo_  = *fortran_char(upper_lower);
+    const char trans_ = *fortran_char(trans);
+    batch_parallel_for(batch_size, 0.5 * n * n * k, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; i++) {
+            syrk(&uplo_, &trans_, (const MKL_INT *)&n, (const MKL_INT *)&k, &alpha,
+                 a + stride_a * i, (const MKL_INT *)&lda, &beta, c + stride_c * i,
+                 (const MKL_INT *)&ldc);
+        }
+    });
+}
+
+// Matrix-vector products of a grouped batch, gemv being ?gemv.
+template <typename T, typename F>
+static inline void mv_batch(F gemv, int64_t group_count, const transpose *trans, const int64_t *m,
+                            const int64_t *n, const T *alpha, const T *a, const int64_t *lda,
+                            const T *x, const int64_t *incx, const T *beta, T *y,
+                            const int64_t *incy, const int64_t *group_size) {
+    flat_batch<3> batch(
+        group_count, group_size,
+        [=](int64_t i) {
+            const bool nontrans = (trans[i] == transpose::nontrans);
+            return std::array<int64_t, 3>{ { lda[i] * n[i],
+                                              vector_size(nontrans ? n[i] : m[i], incx[i]),
+                                              vector_size(nontrans ? m[i] : n[i], incy[i]) } };
+        },
+        [=](int64_t i) { return double(m[i]) * n[i]; });
+    batch.run([=](int64_t i, const std::array<int64_t, 3> &offset) {
+        gemv(fortran_char(trans[i]), (const MKL_INT *)&m[i], (const MKL_INT *)&n[i], alpha + i,
+             a + offset[0], (const MKL_INT *)&lda[i], x + offset[1], (const MKL_INT *)&incx[i],
+             beta + i, y + offset[2], (const MKL_INT *)&incy[i]);
+    });
+}
+
+// Matrix-vector products of a strided batch, gemv being ?gemv.
+template <typename T, typename F>
+static inline void mv_batch(F gemv, transpose trans, int64_t m, int64_t n, T alpha, const T *a,
+                            int64_t lda, int64_t stride_a, const T *x, int64_t incx,
+                            int64_t stride_x, T beta, T *y, int64_t incy, int64_t stride_y,
+                            int64_t batch_size) {
+    const char trans_ = *fortran_char(trans);
+    batch_parallel_for(batch_size, double(m) * n, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; i++) {
+            gemv(&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n, &alpha, a + stride_a * i,
+                 (const MKL_INT *)&lda, x + stride_x * i, (const MKL_INT *)&incx, &beta,
+                 y + stride_y * i, (const MKL_INT *)&incy);
+        }
+    });
+}
+
+// C = diag(x) * A or C = A * diag(x) for a single m x n matrix.
+template <typename T>
+static inline void dgmm(side left_right, int64_t m, int64_t n, const T *a, int64_t lda,
+                        const T *x, int64_t incx, T *c, int64_t ldc) {
+    // Point x at its first element, so that element i is x[i * incx].
+    if (incx < 0)
+        x -= ((left_right == side::left) ? m - 1 : n - 1) * incx;
+    for (int64_t j = 0; j < n; j++) {
+        const T *a_col = a + lda * j;
+        T *c_col       = c + ldc * j;
+        if (left_right == side::left) {
+            for (int64_t i = 0; i < m; i++)
+                c_col[i] = x[incx * i] * a_col[i];
+        }
+        else {
+            const T x_j = x[incx * j];
+            for (int64_t i = 0; i < m; i++)
+                c_col[i] = x_j * a_col[i];
+        }
+    }
+}
+
+// Diagonal scalings of a grouped batch.
+template <typename T>
+static inline void dm_batch(int64_t group_count, const side *left_right, const int64_t *m,
+                            const int64_t *n, const T *a, const int64_t *lda, const T *x,
+                            const int64_t *incx, T *c, const int64_t *ldc,
+                            const int64_t *group_size) {
+    flat_batch<3> batch(
+        group_count, group_size,
+        [=](int64_t i) {
+            const int64_t len_x = (left_right[i] == side::left) ? m[i] : n[i];
+            return std::array<int64_t, 3>{ { lda[i] * n[i], vector_size(len_x, incx[i]),
+                                              ldc[i] * n[i] } };
+        },
+        [=](int64_t i) { return double(m[i]) * n[i]; });
+    batch.run([=](int64_t i, const std::array<int64_t, 3> &offset) {
+        dgmm(left_right[i], m[i], n[i], a + offset[0], lda[i], x + offset[1], incx[i],
+             c + offset[2], ldc[i]);
+    });
+}
+
+// Diagonal scalings of a strided batch.
+template <typename T>
+static inline void dm_batch(side left_right, int64_t m, int64_t n, const T *a, int64_t lda,
+                            int64_t stride_a, const T *x, int64_t incx, int64_t stride_x, T *c,
+                            int64_t ldc, int64_t stride_c, int64_t batch_size) {
+    batch_parallel_for(batch_size, double(m) * n, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; i++) {
+            dgmm(left_right, m, n, a + stride_a * i, lda, x + stride_x * i, incx,
+                 c + stride_c * i, ldc);
+        }
+    });
+}
+
+// ?axpy of a grouped batch of vectors.
+template <typename T, typename F>
+static inline void xaxpy_batch(F axpy, int64_t group_count, const int64_t *n, const T *alpha,
+                               const T *x, const int64_t *incx, T *y, const int64_t *incy,
+                               const int64_t *group_size) {
+    flat_batch<2> batch(
+        group_count, group_size,
+        [=](int64_t i) {
+            return std::array<int64_t, 2>{ { vector_size(n[i], incx[i]),
+                                              vector_size(n[i], incy[i]) } };
+        },
+        [=](int64_t i) { return double(n[i]); });
+    batch.run([=](int64_t i, const std::array<int64_t, 2> &offset) {
+        axpy((const MKL_INT *)&n[i], alpha + i, x + offset[0], (const MKL_INT *)&incx[i],
+             y + offset[1], (const MKL_INT *)&incy[i]);
+    });
+}
+
+// ?axpy of a strided batch of vectors.
+template <typename T, typename F>
+static inline void xaxpy_batch(F axpy, int64_t n, T alpha, const T *x, int64_t incx,
+                               int64_t stride_x, T *y, int64_t incy, int64_t stride_y,
+                               int64_t batch_size) {
+    batch_parallel_for(batch_size, double(n), [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; i++) {
+            axpy((const MKL_INT *)&n, &alpha, x + stride_x * i, (const MKL_INT *)&incx,
+                 y + stride_y * i, (const MKL_INT *)&incy);
+        }
+    });
+}
+
+// ?copy of a grouped batch of vectors.
+template <typename T, typename F>
+static inline void xcopy_batch(F copy, int64_t group_count, const int64_t *n, const T *x,
+                               const int64_t *incx, T *y, const int64_t *incy,
+                               const int64_t *group_size) {
+    flat_batch<2> batch(
+        group_count, group_size,
+        [=](int64_t i) {
+            return std::array<int64_t, 2>{ { vector_size(n[i], incx[i]),
+                                              vector_size(n[i], incy[i]) } };
+        },
+        [=](int64_t i) { return double(n[i]); });
+    batch.run([=](int64_t i, const std::array<int64_t, 2> &offset) {
+        copy((const MKL_INT *)&n[i], x + offset[0], (const MKL_INT *)&incx[i], y + offset[1],
+             (const MKL_INT *)&incy[i]);
+    });
+}
+
+// ?copy of a strided batch of vectors.
+template <typename T, typename F>
+static inline void xcopy_batch(F copy, int64_t n, const T *x, int64_t incx, int64_t stride_x,
+                               T *y, int64_t incy, int64_t stride_y, int64_t batch_size) {
+    batch_parallel_for(batch_size, double(n), [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; i++) {
+            copy((const MKL_INT *)&n, x + stride_x * i, (const MKL_INT *)&incx, y + stride_y * i,
+                 (const MKL_INT *)&incy);
+        }
+    });
+}
+
+// ?dot of a grouped batch of vectors. The results of all problems are written
+//  to consecutive elements of result, so its offset is the problem index.
+template <typename T, typename F>
+static inline void xdot_batch(F dot, int64_t group_count, const int64_t *n, const T *x,
+                              const int64_t *incx, const T *y, const int64_t *incy, T *result,
+                              const int64_t *group_size) {
+    flat_batch<3> batch(
+        group_count, group_size,
+        [=](int64_t i) {
+            return std::array<int64_t, 3>{ { vector_size(n[i], incx[i]),
+                                              vector_size(n[i], incy[i]), 1 } };
+        },
+        [=](int64_t i) { return double(n[i]); });
+    batch.run([=](int64_t i, const std::array<int64_t, 3> &offset) {
+        result[offset[2]] = dot((const MKL_INT *)&n[i], x + offset[0], (const MKL_INT *)&incx[i],
+                                y + offset[1], (const MKL_INT *)&incy[i]);
+    });
+}
+
+// ?dot of a strided batch of vectors.
+template <typename T, typename F>
+static inline void xdot_batch(F dot, int64_t n, const T *x, int64_t incx, int64_t stride_x,
+                              const T *y, int64_t incy, int64_t stride_y, T *result,
+                              int64_t batch_size) {
+    batch_parallel_for(batch_size, double(n), [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; i++) {
+            result[i] = dot((const MKL_INT *)&n, x + stride_x * i, (const MKL_INT *)&incx,
+                            y + stride_y * i, (const MKL_INT *)&incy);
+        }
+    });
+}
+
+// ?scal of a grouped batch of vectors, T_scalar being T or its real type.
+template <typename T, typename T_scalar, typename F>
+static inline void xscal_batch(F scal, int64_t group_count, const int64_t *n,
+                               const T_scalar *alpha, T *x, const int64_t *incx,
+                               const int64_t *group_size) {
+    flat_batch<1> batch(
+        group_count, group_size,
+        [=](int64_t i) { return std::array<int64_t, 1>{ { vector_size(n[i], incx[i]) } }; },
+        [=](int64_t i) { return double(n[i]); });
+    batch.run([=](int64_t i, const std::array<int64_t, 1> &offset) {
+        scal((const MKL_INT *)&n[i], alpha + i, x + offset[0], (const MKL_INT *)&incx[i]);
+    });
+}
+
+// ?scal of a strided batch of vectors, T_scalar being T or its real type.
+template <typename T, typename T_scalar, typename F>
+static inline void xscal_batch(F scal, int64_t n, T_scalar alpha, T *x, int64_t incx,
+                               int64_t stride_x, int64_t batch_size) {
+    batch_parallel_for(batch_size, double(n), [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; i++)
+            scal((const MKL_INT *)&n, &alpha, x + stride_x * i, (const MKL_INT *)&incx);
+    });
+}
+
+// ?gemm_batch of a grouped batch given by pointer arrays, gemm being ?gemm
+//  and gemm_batch ?gemm_batch. Batches mixing large and small problems follow
+//  their size-bucketing schedule, the others are left to a single MKL call.
+template <typename T, typename F, typename G>
+static inline void xgemm_batch(F gemm, G gemm_batch, const gemm_batch_schedule &schedule,
+                               const char *transa, const char *transb, const MKL_INT *m,
+                               const MKL_INT *n, const MKL_INT *k, const T *alpha,
+                               const T **a_array, const MKL_INT *lda, const T **b_array,
+                               const MKL_INT *ldb, const T *beta, T **c_array, const MKL_INT *ldc,
+                               int64_t group_count, const MKL_INT *group_size) {
+    if (!schedule.bucketed()) {
+        gemm_batch(transa, transb, m, n, k, alpha, a_array, lda, b_array, ldb, beta, c_array, ldc,
+                   (const MKL_INT *)&group_count, group_size);
+        return;
+    }
+    schedule.run([=](int64_t idx, int64_t i) {
+        gemm(transa + i, transb + i, m + i, n + i, k + i, alpha + i, a_array[idx], lda + i,
+             b_array[idx], ldb + i, beta + i, c_array[idx], ldc + i);
+    });
+}
+
+// mkl_?omatcopy of a strided batch.
+template <typename T, typename F>
+static inline void xomatcopy_batch(F omatcopy, transpose trans, int64_t m, int64_t n, T alpha,
+                                   const T *a, int64_t lda, int64_t stride_a, T *b, int64_t ldb,
+                                   int64_t stride_b, int64_t batch_size) {
+    const char trans_ = *fortran_char(trans);
+    batch_parallel_for(batch_size, double(m) * n, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; i++)
+            omatcopy('C', trans_, m, n, alpha, a + stride_a * i, lda, b + stride_b * i, ldb);
+    });
+}
+
+// mkl_?imatcopy of a strided batch, each matrix taking stride elements both
+//  before and after the operation.
+template <typename T, typename F>
+static inline void ximatcopy_batch(F imatcopy, transpose trans, int64_t m, int64_t n, T alpha,
+                                   T *ab, int64_t lda, int64_t ldb, int64_t stride,
+                                   int64_t batch_size) {
+    const char trans_ = *fortran_char(trans);
+    batch_parallel_for(batch_size, double(m) * n, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; i++)
+            imatcopy('C', trans_, m, n, alpha, ab + stride * i, lda, ldb);
+    });
+}
+
+// mkl_?omatadd of a strided batch.
+template <typename T, typename F>
+static inline void xomatadd_batch(F omatadd, transpose transa, transpose transb, int64_t m,
+                                  int64_t n, T alpha, const T *a, int64_t lda, int64_t stride_a,
+                                  T beta, const T *b, int64_t ldb, int64_t stride_b, T *c,
+                                  int64_t ldc, int64_t stride_c, int64_t batch_size) {
+    const char transa_ = *fortran_char(transa);
+    const char transb_ = *fortran_char(transb);
+    batch_parallel_for(batch_size, 2.0 * m * n, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; i++)
+            omatadd('C', transa_, transb_, m, n, alpha, a + stride_a * i, lda, beta,
+                    b + stride_b * i, ldb, c + stride_c * i, ldc);
+    });
+}
+
+// Strided batch sharing its A or its B, i.e. with a zero stride, as a single
+//  ?gemm. With A shared, the op(B) and C of the batch stored side by side are
+//  the columns of one k x (n * batch_size) and one m x (n * batch_size)
+//  matrix; with B shared, op(A) and C stacked on top of each other are the
+//  rows of one (m * batch_size) x k and (m * batch_size) x n matrix. The shared
+//  operand is then read once for the whole batch instead of once per product.
+//  Returns false when the strides do not allow it.
+template <typename T, typename F>
+static inline bool gemm_batch_shared(F gemm, transpose transa, transpose transb, int64_t m,
+                                     int64_t n, int64_t k, T alpha, const T *a, int64_t lda,
+                                     int64_t stride_a, const T *b, int64_t ldb, int64_t stride_b,
+                                     T beta, T *c, int64_t ldc, int64_t stride_c,
+                                     int64_t batch_size) {
+    if (batch_size < 2 || (stride_a != 0 && stride_b != 0))
+        return false;
+
+    // Shared A: op(B_i) and C_i must start right after the last column of the
+    //  previous ones.
+    const int64_t col_b = (transb == transpose::nontrans) ? ldb : 1;
+    const bool shared_a = (stride_a == 0) && (stride_b == n * col_b) && (stride_c == n * ldc) &&
+                          (transb == transpose::nontrans || ldb >= n * batch_size);
+
+    // Shared B: op(A_i) and C_i must start right after the last row of the
+    //  previous ones.
+    const int64_t row_a = (transa == transpose::nontrans) ? 1 : lda;
+    const bool shared_b = (stride_b == 0) && (stride_a == m * row_a) && (stride_c == m) &&
+                          (transa != transpose::nontrans || lda >= m * batch_size) &&
+                          (ldc >= m * batch_size);
+
+    const int64_t fused = (shared_a ? n : m) * batch_size;
+    if ((!shared_a && !shared_b) || fused > std::numeric_limits<MKL_INT>::max())
+        return false;
+
+    const MKL_INT m_ = shared_b ? fused : m;
+    const MKL_INT n_ = shared_a ? fused : n;
+    const MKL_INT k_ = k, lda_ = lda, ldb_ = ldb, ldc_ = ldc;
+    gemm(fortran_char(transa), fortran_char(transb), &m_, &n_, &k_, &alpha, a, &lda_, b, &ldb_,
+         &beta, c, &ldc_);
+    return true;
+}
+
+// Problems of a grouped batch whose matrices are located by per-problem
+//  offsets: the group of each problem, the largest dimensions over the batch,
+//  which bound the per-thread scratch, and the average number of multiply-adds.
+class offset_gemm_batch {
+public:
+    offset_gemm_batch(int64_t group_count, const int64_t *m, const int64_t *n, const int64_t *k,
+                      const int64_t *group_size) {
+        double work = 0.0;
+        for (int64_t i = 0; i < group_count; i++) {
+            if (group_size[i] <= 0)
+                continue;
+            group_.insert(group_.end(), group_size[i], i);
+            max_m_ = std::max(max_m_, m[i]);
+            max_n_ = std::max(max_n_, n[i]);
+            max_k_ = std::max(max_k_, k[i]);
+            work += double(m[i]) * n[i] * k[i] * group_size[i];
+        }
+        if (!group_.empty())
+            work_ = work / group_.size();
+    }
+
+    // Calls f(begin, end) on chunks of problems, as batch_parallel_for.
+    template <typename F>
+    void run(F f) const {
+        batch_parallel_for(group_.size(), work_, f);
+    }
+
+    int64_t group(int64_t idx) const {
+        return group_[idx];
+    }
+    int64_t max_m() const {
+        return max_m_;
+    }
+    int64_t max_n() const {
+        return max_n_;
+    }
+    int64_t max_k() const {
+        return max_k_;
+    }
+
+private:
+    std::vector<int64_t> group_;
+    int64_t max_m_ = 0, max_n_ = 0, max_k_ = 0;
+    double work_   = 0.0;
+};
+
+// fp16 gemm of a grouped batch located by offsets, T_c being uint16_t for an
+//  fp16 C or float. Each thread converts tiles of op(A), op(B) and C into its
+//  own float scratch, reused by all of its problems and bounded by the tile
+//  sizes whatever the size of the matrices.
+template <typename T_c>
+static inline void hgemm_batch(int64_t group_count, const transpose *transa,
+                               const transpose *transb, const int64_t *m, const int64_t *n,
+                               const int64_t *k, const float *alpha, const uint16_t *a,
+                               const int64_t *lda, const int64_t *offset_a, const uint16_t *b,
+                               const int64_t *ldb, const int64_t *offset_b, const float *beta,
+                               T_c *c, const int64_t *ldc, const int64_t *offset_c,
+                               const int64_t *group_size) {
+    const offset_gemm_batch batch(group_count, m, n, k, group_size);
+    batch.run([&](int64_t begin, int64_t end) {
+        half_gemm_tiles tiles(batch.max_m(), batch.max_n(), batch.max_k(),
+                              std::is_same<T_c, uint16_t>::value);
+        for (int64_t idx = begin; idx < end; idx++) {
+            const int64_t i = batch.group(idx);
+            gemm_f16_blocked(transa[i], transb[i], m[i], n[i], k[i], alpha[i], a + offset_a[idx],
+                             lda[i], b + offset_b[idx], ldb[i], beta[i], c + offset_c[idx], ldc[i],
+                             tiles.a.data(), tiles.b.data(), tiles.c.data());
+        }
+    });
+}
+
+// fp16 gemm of a strided batch, T_c being uint16_t for an fp16 C or float.
+template <typename T_c>
+static inline void hgemm_batch(transpose transa, transpose transb, int64_t m, int64_t n,
+                               int64_t k, float alpha, const uint16_t *a, int64_t lda,
+                               int64_t stride_a, const uint16_t *b, int64_t ldb, int64_t stride_b,
+                               float beta, T_c *c, int64_t ldc, int64_t stride_c,
+                               int64_t batch_size) {
+    batch_parallel_for(batch_size, double(m) * n * k, [&](int64_t begin, int64_t end) {
+        half_gemm_tiles tiles(m, n, k, std::is_same<T_c, uint16_t>::value);
+        for (int64_t i = begin; i < end; i++) {
+            gemm_f16_blocked(transa, transb, m, n, k, alpha, a + stride_a * i, lda,
+                             b + stride_b * i, ldb, beta, c + stride_c * i, ldc, tiles.a.data(),
+                             tiles.b.data(), tiles.c.data());
+        }
+    });
+}
+
+// int8 x uint8 -> int32 gemm of a single matrix without offsets.
+static inline void gemm_s8u8s32_no_offsets(char transa, char transb, int64_t m, int64_t n,
+                                           int64_t k, float alpha, const int8_t *a, int64_t lda,
+                                           const uint8_t *b, int64_t ldb, float beta, int32_t *c,
+                                           int64_t ldc) {
+    const char offsetc = 'F';
+    const MKL_INT8 ao  = 0;
+    const MKL_INT8 bo  = 0;
+    const MKL_INT32 co = 0;
+    ::gemm_s8u8s32(&transa, &transb, &offsetc, (const MKL_INT *)&m, (const MKL_INT *)&n,
+                   (const MKL_INT *)&k, &alpha, (const MKL_INT8 *)a, (const MKL_INT *)&lda, &ao,
+                   (const MKL_UINT8 *)b, (const MKL_INT *)&ldb, &bo, &beta, (MKL_INT32 *)c,
+                   (const MKL_INT *)&ldc, &co);
+}
+
+// int8 x uint8 -> int32 gemm of a grouped batch located by offsets.
+static inline void gemm_s8u8s32_batch(int64_t group_count, const transpose *transa,
+                                      const transpose *transb, const int64_t *m, const int64_t *n,
+                                      const int64_t *k, const float *alpha, const int8_t *a,
+                                      const int64_t *lda, const int64_t *offset_a,
+                                      const uint8_t *b, const int64_t *ldb,
+                                      const int64_t *offset_b, const float *beta, int32_t *c,
+                                      const int64_t *ldc, const int64_t *offset_c,
+                                      const int64_t *group_size) {
+    const offset_gemm_batch batch(group_count, m, n, k, group_size);
+    batch.run([&](int64_t begin, int64_t end) {
+        for (int64_t idx = begin; idx < end; idx++) {
+            const int64_t i = batch.group(idx);
+            gemm_s8u8s32_no_offsets(*fortran_char(transa[i]), *fortran_char(transb[i]), m[i],
+                                    n[i], k[i], alpha[i], a + offset_a[idx], lda[i],
+                                    b + offset_b[idx], ldb[i], beta[i], c + offset_c[idx], ldc[i]);
+        }
+    });
+}
+
+// int8 x uint8 -> int32 gemm of a strided batch.
+static inline void gemm_s8u8s32_batch(transpose transa, transpose transb, int64_t m, int64_t n,
+                                      int64_t k, float alpha, const int8_t *a, int64_t lda,
+                                      int64_t stride_a, const uint8_t *b, int64_t ldb,
+                                      int64_t stride_b, float beta, int32_t *c, int64_t ldc,
+                                      int64_t stride_c, int64_t batch_size) {
+    const char transa_ = *fortran_char(transa);
+    const char transb_ = *fortran_char(transb);
+    batch_parallel_for(batch_size, double(m) * n * k, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; i++) {
+            gemm_s8u8s32_no_offsets(transa_, transb_, m, n, k, alpha, a + stride_a * i, lda,
+                                    b + stride_b * i, ldb, beta, c + stride_c * i, ldc);
+        }
+    });
+}
+
 void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
                 cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<int64_t, 1> &m,
                 cl::sycl::buffer<int64_t, 1> &n, cl::sycl::buffer<int64_t, 1> &k,
@@ -49,74 +595,20 @@ void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
         auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
 
         host_task<class mkl_kernel_init_sgemm_batch>(cgh, [=]() {
-            int64_t total_size = 0;
-
-            for (int64_t i = 0; i < group_count; i++) {
-                total_size += group_size_acc[i];
-            }
-
-            float **a_array      = (float **)::malloc(sizeof(float *) * total_size);
-            float **b_array      = (float **)::malloc(sizeof(float *) * total_size);
-            float **c_array      = (float **)::malloc(sizeof(float *) * total_size);
-            MKL_INT *m_          = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            MKL_INT *n_          = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            MKL_INT *k_          = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            MKL_INT *lda_        = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            MKL_INT *ldb_        = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            MKL_INT *ldc_        = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            MKL_INT *group_size_ = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            int64_t offset_a = 0, offset_b = 0, offset_c = 0, idx = 0;
-            char *transa_ = (char *)::malloc(sizeof(char) * group_count);
-            char *transb_ = (char *)::malloc(sizeof(char) * group_count);
-
-            for (int64_t i = 0; i < group_count; i++) {
-                m_[i]          = m_acc[i];
-                n_[i]          = n_acc[i];
-                k_[i]          = k_acc[i];
-                lda_[i]        = lda_acc[i];
-                ldb_[i]        = ldb_acc[i];
-                ldc_[i]        = ldc_acc[i];
-                group_size_[i] = group_size_acc[i];
-                transa_[i]     = *fortran_char(transa_acc[i]);
-                transb_[i]     = *fortran_char(transb_acc[i]);
-
-                for (int64_t j = 0; j < group_size_acc[i]; j++) {
-                    if (idx == 0) {
-                        a_array[0] = a_acc.get_pointer();
-                        b_array[0] = b_acc.get_pointer();
-                        c_array[0] = c_acc.get_pointer();
-                    }
-                    else {
-                        a_array[idx] = a_array[idx - 1] + offset_a;
-                        b_array[idx] = b_array[idx - 1] + offset_b;
-                        c_array[idx] = c_array[idx - 1] + offset_c;
-                    }
-                    idx++;
-                    offset_a = (transa_acc[i] == transpose::nontrans) ? lda_acc[i] * k_acc[i]
-                                                                      : lda_acc[i] * m_acc[i];
-                    offset_b = (transb_acc[i] == transpose::nontrans) ? ldb_acc[i] * n_acc[i]
-                                                                      : ldb_acc[i] * k_acc[i];
-                    offset_c = ldc_acc[i] * n_acc[i];
-                }
-            }
-
-            ::sgemm_batch(transa_, transb_, m_, n_, k_, alpha_acc.get_pointer(),
-                          (const float **)a_array, lda_, (const float **)b_array, ldb_,
-                          beta_acc.get_pointer(), c_array, ldc_, (MKL_INT *)&group_count,
-                          group_size_);
-
-            ::free(a_array);
-            ::free(b_array);
-            ::free(c_array);
-            ::free(m_);
-            ::free(n_);
-            ::free(k_);
-            ::free(lda_);
-            ::free(ldb_);
-            ::free(ldc_);
-            ::free(group_size_);
-            ::free(transa_);
-            ::free(transb_);
+            auto batch = gemm_batch_cache<float>::get(
+                group_count, transa_acc.get_pointer(), transb_acc.get_pointer(),
+                m_acc.get_pointer(), n_acc.get_pointer(), k_acc.get_pointer(),
+                lda_acc.get_pointer(), ldb_acc.get_pointer(), ldc_acc.get_pointer(),
+                group_size_acc.get_pointer(), a_acc.get_pointer(), b_acc.get_pointer(),
+                c_acc.get_pointer());
+
+            xgemm_batch<float>(::sgemm, ::sgemm_batch, batch->schedule, batch->transa.data(),
+                               batch->transb.data(), batch->m.data(), batch->n.data(),
+                               batch->k.data(), alpha_acc.get_pointer(),
+                               (const float **)batch->a_array.data(), batch->lda.data(),
+                               (const float **)batch->b_array.data(), batch->ldb.data(),
+                               beta_acc.get_pointer(), (float **)batch->c_array.data(),
+                               batch->ldc.data(), group_count, batch->group_size.data());
         });
     });
 }
@@ -146,74 +638,20 @@ void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
         auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
 
         host_task<class mkl_kernel_dgemm_batch>(cgh, [=]() {
-            int64_t total_size = 0;
-
-            for (int64_t i = 0; i < group_count; i++) {
-                total_size += group_size_acc[i];
-            }
-
-            double **a_array     = (double **)::malloc(sizeof(double *) * total_size);
-            double **b_array     = (double **)::malloc(sizeof(double *) * total_size);
-            double **c_array     = (double **)::malloc(sizeof(double *) * total_size);
-            MKL_INT *m_          = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            MKL_INT *n_          = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            MKL_INT *k_          = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            MKL_INT *lda_        = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            MKL_INT *ldb_        = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            MKL_INT *ldc_        = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            MKL_INT *group_size_ = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            int64_t offset_a = 0, offset_b = 0, offset_c = 0, idx = 0;
-            char *transa_ = (char *)::malloc(sizeof(char) * group_count);
-            char *transb_ = (char *)::malloc(sizeof(char) * group_count);
-
-            for (int64_t i = 0; i < group_count; i++) {
-                m_[i]          = m_acc[i];
-                n_[i]          = n_acc[i];
-                k_[i]          = k_acc[i];
-                lda_[i]        = lda_acc[i];
-                ldb_[i]        = ldb_acc[i];
-                ldc_[i]        = ldc_acc[i];
-                group_size_[i] = group_size_acc[i];
-                transa_[i]     = *fortran_char(transa_acc[i]);
-                transb_[i]     = *fortran_char(transb_acc[i]);
-
-                for (int64_t j = 0; j < group_size_acc[i]; j++) {
-                    if (idx == 0) {
-                        a_array[0] = a_acc.get_pointer();
-                        b_array[0] = b_acc.get_pointer();
-                        c_array[0] = c_acc.get_pointer();
-                    }
-                    else {
-                        a_array[idx] = a_array[idx - 1] + offset_a;
-                        b_array[idx] = b_array[idx - 1] + offset_b;
-                        c_array[idx] = c_array[idx - 1] + offset_c;
-                    }
-                    idx++;
-                    offset_a = (transa_acc[i] == transpose::nontrans) ? lda_acc[i] * k_acc[i]
-                                                                      : lda_acc[i] * m_acc[i];
-                    offset_b = (transb_acc[i] == transpose::nontrans) ? ldb_acc[i] * n_acc[i]
-                                                                      : ldb_acc[i] * k_acc[i];
-                    offset_c = ldc_acc[i] * n_acc[i];
-                }
-            }
-
-            ::dgemm_batch(transa_, transb_, m_, n_, k_, alpha_acc.get_pointer(),
-                          (const double **)a_array, lda_, (const double **)b_array, ldb_,
-                          beta_acc.get_pointer(), c_array, ldc_, (MKL_INT *)&group_count,
-                          group_size_);
-
-            ::free(a_array);
-            ::free(b_array);
-            ::free(c_array);
-            ::free(m_);
-            ::free(n_);
-            ::free(k_);
-            ::free(lda_);
-            ::free(ldb_);
-            ::free(ldc_);
-            ::free(group_size_);
-            ::free(transa_);
-            ::free(transb_);
+            auto batch = gemm_batch_cache<double>::get(
+                group_count, transa_acc.get_pointer(), transb_acc.get_pointer(),
+                m_acc.get_pointer(), n_acc.get_pointer(), k_acc.get_pointer(),
+                lda_acc.get_pointer(), ldb_acc.get_pointer(), ldc_acc.get_pointer(),
+                group_size_acc.get_pointer(), a_acc.get_pointer(), b_acc.get_pointer(),
+                c_acc.get_pointer());
+
+            xgemm_batch<double>(::dgemm, ::dgemm_batch, batch->schedule, batch->transa.data(),
+                                batch->transb.data(), batch->m.data(), batch->n.data(),
+                                batch->k.data(), alpha_acc.get_pointer(),
+                                (const double **)batch->a_array.data(), batch->lda.data(),
+                                (const double **)batch->b_array.data(), batch->ldb.data(),
+                                beta_acc.get_pointer(), (double **)batch->c_array.data(),
+                                batch->ldc.data(), group_count, batch->group_size.data());
         });
     });
 }
@@ -244,74 +682,22 @@ void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
         auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
 
         host_task<class mkl_kernel_cgemm_batch>(cgh, [=]() {
-            int64_t total_size = 0;
-
-            for (int64_t i = 0; i < group_count; i++) {
-                total_size += group_size_acc[i];
-            }
-
-            MKL_Complex8 **a_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * total_size);
-            MKL_Complex8 **b_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * total_size);
-            MKL_Complex8 **c_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * total_size);
-            MKL_INT *m_            = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            MKL_INT *n_            = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            MKL_INT *k_            = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            MKL_INT *lda_          = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            MKL_INT *ldb_          = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            MKL_INT *ldc_          = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            MKL_INT *group_size_   = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            int64_t offset_a = 0, offset_b = 0, offset_c = 0, idx = 0;
-            char *transa_ = (char *)::malloc(sizeof(char) * group_count);
-            char *transb_ = (char *)::malloc(sizeof(char) * group_count);
-
-            for (int64_t i = 0; i < group_count; i++) {
-                m_[i]          = m_acc[i];
-                n_[i]          = n_acc[i];
-                k_[i]          = k_acc[i];
-                lda_[i]        = lda_acc[i];
-                ldb_[i]        = ldb_acc[i];
-                ldc_[i]        = ldc_acc[i];
-                group_size_[i] = group_size_acc[i];
-                transa_[i]     = *fortran_char(transa_acc[i]);
-                transb_[i]     = *fortran_char(transb_acc[i]);
-
-                for (int64_t j = 0; j < group_size_acc[i]; j++) {
-                    if (idx == 0) {
-                        a_array[0] = a_acc.get_pointer();
-                        b_array[0] = b_acc.get_pointer();
-                        c_array[0] = c_acc.get_pointer();
-                    }
-                    else {
-                        a_array[idx] = a_array[idx - 1] + offset_a;
-                        b_array[idx] = b_array[idx - 1] + offset_b;
-                        c_array[idx] = c_array[idx - 1] + offset_c;
-                    }
-                    idx++;
-                    offset_a = (transa_acc[i] == transpose::nontrans) ? lda_acc[i] * k_acc[i]
-                                                                      : lda_acc[i] * m_acc[i];
-                    offset_b = (transb_acc[i] == transpose::nontrans) ? ldb_acc[i] * n_acc[i]
-                                                                      : ldb_acc[i] * k_acc[i];
-                    offset_c = ldc_acc[i] * n_acc[i];
-                }
-            }
-
-            ::cgemm_batch(transa_, transb_, m_, n_, k_, alpha_acc.get_pointer(),
-                          (const MKL_Complex8 **)a_array, lda_, (const MKL_Complex8 **)b_array,
-                          ldb_, beta_acc.get_pointer(), c_array, ldc_, (MKL_INT *)&group_count,
-                          group_size_);
-
-            ::free(a_array);
-            ::free(b_array);
-            ::free(c_array);
-            ::free(m_);
-            ::free(n_);
-            ::free(k_);
-            ::free(lda_);
-            ::free(ldb_);
-            ::free(ldc_);
-            ::free(group_size_);
-            ::free(transa_);
-            ::free(transb_);
+            auto batch = gemm_batch_cache<MKL_Complex8>::get(
+                group_count, transa_acc.get_pointer(), transb_acc.get_pointer(),
+                m_acc.get_pointer(), n_acc.get_pointer(), k_acc.get_pointer(),
+                lda_acc.get_pointer(), ldb_acc.get_pointer(), ldc_acc.get_pointer(),
+                group_size_acc.get_pointer(), a_acc.get_pointer(), b_acc.get_pointer(),
+                c_acc.get_pointer());
+
+            xgemm_batch<MKL_Complex8>(::cgemm, ::cgemm_batch, batch->schedule, batch->transa.data(),
+                                      batch->transb.data(), batch->m.data(), batch->n.data(),
+                                      batch->k.data(), alpha_acc.get_pointer(),
+                                      (const MKL_Complex8 **)batch->a_array.data(),
+                                      batch->lda.data(),
+                                      (const MKL_Complex8 **)batch->b_array.data(),
+                                      batch->ldb.data(), beta_acc.get_pointer(),
+                                      (MKL_Complex8 **)batch->c_array.data(), batch->ldc.data(),
+                                      group_count, batch->group_size.data());
         });
     });
 }
@@ -342,77 +728,294 @@ void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
         auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
 
         host_task<class mkl_kernel_zgemm_batch>(cgh, [=]() {
-            int64_t total_size = 0;
+            auto batch = gemm_batch_cache<MKL_Complex16>::get(
+                group_count, transa_acc.get_pointer(), transb_acc.get_pointer(),
+                m_acc.get_pointer(), n_acc.get_pointer(), k_acc.get_pointer(),
+                lda_acc.get_pointer(), ldb_acc.get_pointer(), ldc_acc.get_pointer(),
+                group_size_acc.get_pointer(), a_acc.get_pointer(), b_acc.get_pointer(),
+                c_acc.get_pointer());
+
+            xgemm_batch<MKL_Complex16>(::zgemm, ::zgemm_batch, batch->schedule,
+                                       batch->transa.data(), batch->transb.data(), batch->m.data(),
+                                       batch->n.data(), batch->k.data(), alpha_acc.get_pointer(),
+                                       (const MKL_Complex16 **)batch->a_array.data(),
+                                       batch->lda.data(),
+                                       (const MKL_Complex16 **)batch->b_array.data(),
+                                       batch->ldb.data(), beta_acc.get_pointer(),
+                                       (MKL_Complex16 **)batch->c_array.data(), batch->ldc.data(),
+                                       group_count, batch->group_size.data());
+        });
+    });
+}
+
+void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<int64_t, 1> &m,
+                cl::sycl::buffer<int64_t, 1> &n, cl::sycl::buffer<int64_t, 1> &k,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+                cl::sycl::buffer<int64_t, 1> &lda, cl::sycl::buffer<int64_t, 1> &offset_a,
+                cl::sycl::buffer<float, 1> &b, cl::sycl::buffer<int64_t, 1> &ldb,
+                cl::sycl::buffer<int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+                cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<int64_t, 1> &ldc,
+                cl::sycl::buffer<int64_t, 1> &offset_c, int64_t group_count,
+                cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto transa_acc     = transa.get_access<cl::sycl::access::mode::read>(cgh);
+        auto transb_acc     = transb.get_access<cl::sycl::access::mode::read>(cgh);
+        auto m_acc          = m.get_access<cl::sycl::access::mode::read>(cgh);
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto k_acc          = k.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc      = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc          = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto lda_acc        = lda.get_access<cl::sycl::access::mode::read>(cgh);
+        auto offset_a_acc   = offset_a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc          = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto ldb_acc        = ldb.get_access<cl::sycl::access::mode::read>(cgh);
+        auto offset_b_acc   = offset_b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto beta_acc       = beta.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc          = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto ldc_acc        = ldc.get_access<cl::sycl::access::mode::read>(cgh);
+        auto offset_c_acc   = offset_c.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
 
+        host_task<class mkl_kernel_sgemm_batch_offset>(cgh, [=]() {
+            int64_t total_size = 0;
+            std::vector<char> transa_(group_count), transb_(group_count);
             for (int64_t i = 0; i < group_count; i++) {
                 total_size += group_size_acc[i];
+                transa_[i] = *fortran_char(transa_acc[i]);
+                transb_[i] = *fortran_char(transb_acc[i]);
             }
 
-            MKL_Complex16 **a_array =
-                (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * total_size);
-            MKL_Complex16 **b_array =
-                (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * total_size);
-            MKL_Complex16 **c_array =
-                (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * total_size);
-            MKL_INT *m_          = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            MKL_INT *n_          = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            MKL_INT *k_          = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            MKL_INT *lda_        = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            MKL_INT *ldb_        = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            MKL_INT *ldc_        = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            MKL_INT *group_size_ = (MKL_INT *)::malloc(sizeof(MKL_INT) * group_count);
-            int64_t offset_a = 0, offset_b = 0, offset_c = 0, idx = 0;
-            char *transa_ = (char *)::malloc(sizeof(char) * group_count);
-            char *transb_ = (char *)::malloc(sizeof(char) * group_count);
+            // Every matrix is located by its own offset, so they may be
+            //  placed anywhere in the buffers and in any order.
+            const float *a_ = a_acc.get_pointer();
+            const float *b_ = b_acc.get_pointer();
+            float *c_ = c_acc.get_pointer();
+            std::vector<const float *> a_array(total_size), b_array(total_size);
+            std::vector<float *> c_array(total_size);
+            for (int64_t i = 0; i < total_size; i++) {
+                a_array[i] = a_ + offset_a_acc[i];
+                b_array[i] = b_ + offset_b_acc[i];
+                c_array[i] = c_ + offset_c_acc[i];
+            }
 
-            for (int64_t i = 0; i < group_count; i++) {
-                m_[i]          = m_acc[i];
-                n_[i]          = n_acc[i];
-                k_[i]          = k_acc[i];
-                lda_[i]        = lda_acc[i];
-                ldb_[i]        = ldb_acc[i];
-                ldc_[i]        = ldc_acc[i];
-                group_size_[i] = group_size_acc[i];
-                transa_[i]     = *fortran_char(transa_acc[i]);
-                transb_[i]     = *fortran_char(transb_acc[i]);
+            const gemm_batch_schedule schedule(group_count, m_acc.get_pointer(),
+                                               n_acc.get_pointer(), k_acc.get_pointer(),
+                                               group_size_acc.get_pointer());
+            xgemm_batch<float>(::sgemm, ::sgemm_batch, schedule, transa_.data(), transb_.data(),
+                               (const MKL_INT *)m_acc.get_pointer(),
+                               (const MKL_INT *)n_acc.get_pointer(),
+                               (const MKL_INT *)k_acc.get_pointer(), alpha_acc.get_pointer(),
+                               a_array.data(), (const MKL_INT *)lda_acc.get_pointer(),
+                               b_array.data(), (const MKL_INT *)ldb_acc.get_pointer(),
+                               beta_acc.get_pointer(), c_array.data(),
+                               (const MKL_INT *)ldc_acc.get_pointer(), group_count,
+                               (const MKL_INT *)group_size_acc.get_pointer());
+        });
+    });
+}
 
-                for (int64_t j = 0; j < group_size_acc[i]; j++) {
-                    if (idx == 0) {
-                        a_array[0] = a_acc.get_pointer();
-                        b_array[0] = b_acc.get_pointer();
-                        c_array[0] = c_acc.get_pointer();
-                    }
-                    else {
-                        a_array[idx] = a_array[idx - 1] + offset_a;
-                        b_array[idx] = b_array[idx - 1] + offset_b;
-                        c_array[idx] = c_array[idx - 1] + offset_c;
-                    }
-                    idx++;
-                    offset_a = (transa_acc[i] == transpose::nontrans) ? lda_acc[i] * k_acc[i]
-                                                                      : lda_acc[i] * m_acc[i];
-                    offset_b = (transb_acc[i] == transpose::nontrans) ? ldb_acc[i] * n_acc[i]
-                                                                      : ldb_acc[i] * k_acc[i];
-                    offset_c = ldc_acc[i] * n_acc[i];
-                }
+void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<int64_t, 1> &m,
+                cl::sycl::buffer<int64_t, 1> &n, cl::sycl::buffer<int64_t, 1> &k,
+                cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+                cl::sycl::buffer<int64_t, 1> &lda, cl::sycl::buffer<int64_t, 1> &offset_a,
+                cl::sycl::buffer<double, 1> &b, cl::sycl::buffer<int64_t, 1> &ldb,
+                cl::sycl::buffer<int64_t, 1> &offset_b, cl::sycl::buffer<double, 1> &beta,
+                cl::sycl::buffer<double, 1> &c, cl::sycl::buffer<int64_t, 1> &ldc,
+                cl::sycl::buffer<int64_t, 1> &offset_c, int64_t group_count,
+                cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto transa_acc     = transa.get_access<cl::sycl::access::mode::read>(cgh);
+        auto transb_acc     = transb.get_access<cl::sycl::access::mode::read>(cgh);
+        auto m_acc          = m.get_access<cl::sycl::access::mode::read>(cgh);
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto k_acc          = k.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc      = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc          = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto lda_acc        = lda.get_access<cl::sycl::access::mode::read>(cgh);
+        auto offset_a_acc   = offset_a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc          = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto ldb_acc        = ldb.get_access<cl::sycl::access::mode::read>(cgh);
+        auto offset_b_acc   = offset_b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto beta_acc       = beta.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc          = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto ldc_acc        = ldc.get_access<cl::sycl::access::mode::read>(cgh);
+        auto offset_c_acc   = offset_c.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+
+        host_task<class mkl_kernel_dgemm_batch_offset>(cgh, [=]() {
+            int64_t total_size = 0;
+            std::vector<char> transa_(group_count), transb_(group_count);
+            for (int64_t i = 0; i < group_count; i++) {
+                total_size += group_size_acc[i];
+                transa_[i] = *fortran_char(transa_acc[i]);
+                transb_[i] = *fortran_char(transb_acc[i]);
             }
 
-            ::zgemm_batch(transa_, transb_, m_, n_, k_, alpha_acc.get_pointer(),
-                          (const MKL_Complex16 **)a_array, lda_, (const MKL_Complex16 **)b_array,
-                          ldb_, beta_acc.get_pointer(), c_array, ldc_, (MKL_INT *)&group_count,
-                          group_size_);
+            // Every matrix is located by its own offset, so they may be
+            //  placed anywhere in the buffers and in any order.
+            const double *a_ = a_acc.get_pointer();
+            const double *b_ = b_acc.get_pointer();
+            double *c_ = c_acc.get_pointer();
+            std::vector<const double *> a_array(total_size), b_array(total_size);
+            std::vector<double *> c_array(total_size);
+            for (int64_t i = 0; i < total_size; i++) {
+                a_array[i] = a_ + offset_a_acc[i];
+                b_array[i] = b_ + offset_b_acc[i];
+                c_array[i] = c_ + offset_c_acc[i];
+            }
 
-            ::free(a_array);
-            ::free(b_array);
-            ::free(c_array);
-            ::free(m_);
-            ::free(n_);
-            ::free(k_);
-            ::free(lda_);
-            ::free(ldb_);
-            ::free(ldc_);
-            ::free(group_size_);
-            ::free(transa_);
-            ::free(transb_);
+            const gemm_batch_schedule schedule(group_count, m_acc.get_pointer(),
+                                               n_acc.get_pointer(), k_acc.get_pointer(),
+                                               group_size_acc.get_pointer());
+            xgemm_batch<double>(::dgemm, ::dgemm_batch, schedule, transa_.data(), transb_.data(),
+                                (const MKL_INT *)m_acc.get_pointer(),
+                                (const MKL_INT *)n_acc.get_pointer(),
+                                (const MKL_INT *)k_acc.get_pointer(), alpha_acc.get_pointer(),
+                                a_array.data(), (const MKL_INT *)lda_acc.get_pointer(),
+                                b_array.data(), (const MKL_INT *)ldb_acc.get_pointer(),
+                                beta_acc.get_pointer(), c_array.data(),
+                                (const MKL_INT *)ldc_acc.get_pointer(), group_count,
+                                (const MKL_INT *)group_size_acc.get_pointer());
+        });
+    });
+}
+
+void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<int64_t, 1> &m,
+                cl::sycl::buffer<int64_t, 1> &n, cl::sycl::buffer<int64_t, 1> &k,
+                cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<int64_t, 1> &lda,
+                cl::sycl::buffer<int64_t, 1> &offset_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                cl::sycl::buffer<int64_t, 1> &ldb, cl::sycl::buffer<int64_t, 1> &offset_b,
+                cl::sycl::buffer<std::complex<float>, 1> &beta,
+                cl::sycl::buffer<std::complex<float>, 1> &c, cl::sycl::buffer<int64_t, 1> &ldc,
+                cl::sycl::buffer<int64_t, 1> &offset_c, int64_t group_count,
+                cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto transa_acc     = transa.get_access<cl::sycl::access::mode::read>(cgh);
+        auto transb_acc     = transb.get_access<cl::sycl::access::mode::read>(cgh);
+        auto m_acc          = m.get_access<cl::sycl::access::mode::read>(cgh);
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto k_acc          = k.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc      = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc          = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto lda_acc        = lda.get_access<cl::sycl::access::mode::read>(cgh);
+        auto offset_a_acc   = offset_a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc          = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto ldb_acc        = ldb.get_access<cl::sycl::access::mode::read>(cgh);
+        auto offset_b_acc   = offset_b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto beta_acc       = beta.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc          = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto ldc_acc        = ldc.get_access<cl::sycl::access::mode::read>(cgh);
+        auto offset_c_acc   = offset_c.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+
+        host_task<class mkl_kernel_cgemm_batch_offset>(cgh, [=]() {
+            int64_t total_size = 0;
+            std::vector<char> transa_(group_count), transb_(group_count);
+            for (int64_t i = 0; i < group_count; i++) {
+                total_size += group_size_acc[i];
+                transa_[i] = *fortran_char(transa_acc[i]);
+                transb_[i] = *fortran_char(transb_acc[i]);
+            }
+
+            // Every matrix is located by its own offset, so they may be
+            //  placed anywhere in the buffers and in any order.
+            const MKL_Complex8 *a_ = a_acc.get_pointer();
+            const MKL_Complex8 *b_ = b_acc.get_pointer();
+            MKL_Complex8 *c_ = c_acc.get_pointer();
+            std::vector<const MKL_Complex8 *> a_array(total_size), b_array(total_size);
+            std::vector<MKL_Complex8 *> c_array(total_size);
+            for (int64_t i = 0; i < total_size; i++) {
+                a_array[i] = a_ + offset_a_acc[i];
+                b_array[i] = b_ + offset_b_acc[i];
+                c_array[i] = c_ + offset_c_acc[i];
+            }
+
+            const gemm_batch_schedule schedule(group_count, m_acc.get_pointer(),
+                                               n_acc.get_pointer(), k_acc.get_pointer(),
+                                               group_size_acc.get_pointer());
+            xgemm_batch<MKL_Complex8>(::cgemm, ::cgemm_batch, schedule, transa_.data(),
+                                      transb_.data(), (const MKL_INT *)m_acc.get_pointer(),
+                                      (const MKL_INT *)n_acc.get_pointer(),
+                                      (const MKL_INT *)k_acc.get_pointer(), alpha_acc.get_pointer(),
+                                      a_array.data(), (const MKL_INT *)lda_acc.get_pointer(),
+                                      b_array.data(), (const MKL_INT *)ldb_acc.get_pointer(),
+                                      beta_acc.get_pointer(), c_array.data(),
+                                      (const MKL_INT *)ldc_acc.get_pointer(), group_count,
+                                      (const MKL_INT *)group_size_acc.get_pointer());
+        });
+    });
+}
+
+void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<int64_t, 1> &m,
+                cl::sycl::buffer<int64_t, 1> &n, cl::sycl::buffer<int64_t, 1> &k,
+                cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a, cl::sycl::buffer<int64_t, 1> &lda,
+                cl::sycl::buffer<int64_t, 1> &offset_a,
+                cl::sycl::buffer<std::complex<double>, 1> &b, cl::sycl::buffer<int64_t, 1> &ldb,
+                cl::sycl::buffer<int64_t, 1> &offset_b,
+                cl::sycl::buffer<std::complex<double>, 1> &beta,
+                cl::sycl::buffer<std::complex<double>, 1> &c, cl::sycl::buffer<int64_t, 1> &ldc,
+                cl::sycl::buffer<int64_t, 1> &offset_c, int64_t group_count,
+                cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto transa_acc     = transa.get_access<cl::sycl::access::mode::read>(cgh);
+        auto transb_acc     = transb.get_access<cl::sycl::access::mode::read>(cgh);
+        auto m_acc          = m.get_access<cl::sycl::access::mode::read>(cgh);
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto k_acc          = k.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc      = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc          = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto lda_acc        = lda.get_access<cl::sycl::access::mode::read>(cgh);
+        auto offset_a_acc   = offset_a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc          = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto ldb_acc        = ldb.get_access<cl::sycl::access::mode::read>(cgh);
+        auto offset_b_acc   = offset_b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto beta_acc       = beta.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc          = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto ldc_acc        = ldc.get_access<cl::sycl::access::mode::read>(cgh);
+        auto offset_c_acc   = offset_c.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+
+        host_task<class mkl_kernel_zgemm_batch_offset>(cgh, [=]() {
+            int64_t total_size = 0;
+            std::vector<char> transa_(group_count), transb_(group_count);
+            for (int64_t i = 0; i < group_count; i++) {
+                total_size += group_size_acc[i];
+                transa_[i] = *fortran_char(transa_acc[i]);
+                transb_[i] = *fortran_char(transb_acc[i]);
+            }
+
+            // Every matrix is located by its own offset, so they may be
+            //  placed anywhere in the buffers and in any order.
+            const MKL_Complex16 *a_ = a_acc.get_pointer();
+            const MKL_Complex16 *b_ = b_acc.get_pointer();
+            MKL_Complex16 *c_ = c_acc.get_pointer();
+            std::vector<const MKL_Complex16 *> a_array(total_size), b_array(total_size);
+            std::vector<MKL_Complex16 *> c_array(total_size);
+            for (int64_t i = 0; i < total_size; i++) {
+                a_array[i] = a_ + offset_a_acc[i];
+                b_array[i] = b_ + offset_b_acc[i];
+                c_array[i] = c_ + offset_c_acc[i];
+            }
+
+            const gemm_batch_schedule schedule(group_count, m_acc.get_pointer(),
+                                               n_acc.get_pointer(), k_acc.get_pointer(),
+                                               group_size_acc.get_pointer());
+            xgemm_batch<MKL_Complex16>(::zgemm, ::zgemm_batch, schedule, transa_.data(),
+                                       transb_.data(), (const MKL_INT *)m_acc.get_pointer(),
+                                       (const MKL_INT *)n_acc.get_pointer(),
+                                       (const MKL_INT *)k_acc.get_pointer(),
+                                       alpha_acc.get_pointer(), a_array.data(),
+                                       (const MKL_INT *)lda_acc.get_pointer(), b_array.data(),
+                                       (const MKL_INT *)ldb_acc.get_pointer(),
+                                       beta_acc.get_pointer(), c_array.data(),
+                                       (const MKL_INT *)ldc_acc.get_pointer(), group_count,
+                                       (const MKL_INT *)group_size_acc.get_pointer());
         });
     });
 }
@@ -431,6 +1034,12 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
         MKL_INT one  = 1;
 
         host_task<class mkl_kernel_init_sgemm_batch_stride>(cgh, [=]() {
+            if (gemm_batch_shared<float>(::sgemm, transa, transb, m, n, k, alpha,
+                                         a_acc.get_pointer(), lda, stride_a, b_acc.get_pointer(),
+                                         ldb, stride_b, beta, c_acc.get_pointer(), ldc, stride_c,
+                                         batch_size))
+                return;
+
             float **a_array = (float **)::malloc(sizeof(float *) * batch_size);
             float **b_array = (float **)::malloc(sizeof(float *) * batch_size);
             float **c_array = (float **)::malloc(sizeof(float *) * batch_size);
@@ -475,6 +1084,12 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
         MKL_INT one  = 1;
 
         host_task<class mkl_kernel_init_dgemm_batch_stride>(cgh, [=]() {
+            if (gemm_batch_shared<double>(::dgemm, transa, transb, m, n, k, alpha,
+                                          a_acc.get_pointer(), lda, stride_a, b_acc.get_pointer(),
+                                          ldb, stride_b, beta, c_acc.get_pointer(), ldc, stride_c,
+                                          batch_size))
+                return;
+
             double **a_array = (double **)::malloc(sizeof(double *) * batch_size);
             double **b_array = (double **)::malloc(sizeof(double *) * batch_size);
             double **c_array = (double **)::malloc(sizeof(double *) * batch_size);
@@ -520,6 +1135,13 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
         MKL_INT one  = 1;
 
         host_task<class mkl_kernel_init_cgemm_batch_stride>(cgh, [=]() {
+            if (gemm_batch_shared<std::complex<float>>(::cgemm, transa, transb, m, n, k, alpha,
+                                                       a_acc.get_pointer(), lda, stride_a,
+                                                       b_acc.get_pointer(), ldb, stride_b, beta,
+                                                       c_acc.get_pointer(), ldc, stride_c,
+                                                       batch_size))
+                return;
+
             MKL_Complex8 **a_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * batch_size);
             MKL_Complex8 **b_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * batch_size);
             MKL_Complex8 **c_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * batch_size);
@@ -565,6 +1187,13 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
         MKL_INT one  = 1;
 
         host_task<class mkl_kernel_init_zgemm_batch_stride>(cgh, [=]() {
+            if (gemm_batch_shared<std::complex<double>>(::zgemm, transa, transb, m, n, k, alpha,
+                                                        a_acc.get_pointer(), lda, stride_a,
+                                                        b_acc.get_pointer(), ldb, stride_b, beta,
+                                                        c_acc.get_pointer(), ldc, stride_c,
+                                                        batch_size))
+                return;
+
             MKL_Complex16 **a_array =
                 (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * batch_size);
             MKL_Complex16 **b_array =
@@ -598,6 +1227,115 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
     });
 }
 
+// Strided gemm_batch with three real matrix products instead of four, with MKL
+//  ?gemm3m and ?gemm3m_batch.
+void gemm3m_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                  int64_t k, std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                  int64_t lda, int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                  int64_t ldb, int64_t stride_b, std::complex<float> beta,
+                  cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc, int64_t stride_c,
+                  int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc   = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc   = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc   = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        char transa_ = *fortran_char(transa);
+        char transb_ = *fortran_char(transb);
+        MKL_INT one  = 1;
+
+        host_task<class mkl_kernel_init_cgemm3m_batch_stride>(cgh, [=]() {
+            if (gemm_batch_shared<std::complex<float>>(::cgemm3m, transa, transb, m, n, k, alpha,
+                                                       a_acc.get_pointer(), lda, stride_a,
+                                                       b_acc.get_pointer(), ldb, stride_b, beta,
+                                                       c_acc.get_pointer(), ldc, stride_c,
+                                                       batch_size))
+                return;
+
+            MKL_Complex8 **a_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * batch_size);
+            MKL_Complex8 **b_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * batch_size);
+            MKL_Complex8 **c_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * batch_size);
+
+            for (int64_t i = 0; i < batch_size; i++) {
+                if (i == 0) {
+                    a_array[0] = a_acc.get_pointer();
+                    b_array[0] = b_acc.get_pointer();
+                    c_array[0] = c_acc.get_pointer();
+                }
+                else {
+                    a_array[i] = a_array[i - 1] + stride_a;
+                    b_array[i] = b_array[i - 1] + stride_b;
+                    c_array[i] = c_array[i - 1] + stride_c;
+                }
+            }
+
+            ::cgemm3m_batch(&transa_, &transb_, (const MKL_INT *)&m, (const MKL_INT *)&n,
+                            (const MKL_INT *)&k, &alpha, (const MKL_Complex8 **)a_array,
+                            (const MKL_INT *)&lda, (const MKL_Complex8 **)b_array,
+                            (const MKL_INT *)&ldb, &beta, c_array, (const MKL_INT *)&ldc,
+                            (const MKL_INT *)&one, (const MKL_INT *)&batch_size);
+
+            ::free(a_array);
+            ::free(b_array);
+            ::free(c_array);
+        });
+    });
+}
+
+void gemm3m_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                  int64_t k, std::complex<double> alpha,
+                  cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda, int64_t stride_a,
+                  cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, int64_t stride_b,
+                  std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+                  int64_t ldc, int64_t stride_c, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc   = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc   = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc   = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        char transa_ = *fortran_char(transa);
+        char transb_ = *fortran_char(transb);
+        MKL_INT one  = 1;
+
+        host_task<class mkl_kernel_init_zgemm3m_batch_stride>(cgh, [=]() {
+            if (gemm_batch_shared<std::complex<double>>(::zgemm3m, transa, transb, m, n, k, alpha,
+                                                        a_acc.get_pointer(), lda, stride_a,
+                                                        b_acc.get_pointer(), ldb, stride_b, beta,
+                                                        c_acc.get_pointer(), ldc, stride_c,
+                                                        batch_size))
+                return;
+
+            MKL_Complex16 **a_array =
+                (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * batch_size);
+            MKL_Complex16 **b_array =
+                (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * batch_size);
+            MKL_Complex16 **c_array =
+                (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * batch_size);
+
+            for (int64_t i = 0; i < batch_size; i++) {
+                if (i == 0) {
+                    a_array[0] = a_acc.get_pointer();
+                    b_array[0] = b_acc.get_pointer();
+                    c_array[0] = c_acc.get_pointer();
+                }
+                else {
+                    a_array[i] = a_array[i - 1] + stride_a;
+                    b_array[i] = b_array[i - 1] + stride_b;
+                    c_array[i] = c_array[i - 1] + stride_c;
+                }
+            }
+
+            ::zgemm3m_batch(&transa_, &transb_, (const MKL_INT *)&m, (const MKL_INT *)&n,
+                            (const MKL_INT *)&k, &alpha, (const MKL_Complex16 **)a_array,
+                            (const MKL_INT *)&lda, (const MKL_Complex16 **)b_array,
+                            (const MKL_INT *)&ldb, &beta, c_array, (const MKL_INT *)&ldc,
+                            (const MKL_INT *)&one, (const MKL_INT *)&batch_size);
+
+            ::free(a_array);
+            ::free(b_array);
+            ::free(c_array);
+        });
+    });
+}
+
 void trsm_batch(cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
                 cl::sycl::buffer<uplo, 1> &upper_lower, cl::sycl::buffer<transpose, 1> &trans,
                 cl::sycl::buffer<diag, 1> &unit_diag, cl::sycl::buffer<int64_t, 1> &m,
@@ -1103,5 +1841,2042 @@ void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, trans
     });
 }
 
+void syrk_batch(cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<int64_t, 1> &k, cl::sycl::buffer<float, 1> &alpha,
+                cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<int64_t, 1> &lda,
+                cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &c,
+                cl::sycl::buffer<int64_t, 1> &ldc, int64_t group_count,
+                cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto upper_lower_acc = upper_lower.get_access<cl::sycl::access::mode::read>(cgh);
+        auto trans_acc       = trans.get_access<cl::sycl::access::mode::read>(cgh);
+        auto n_acc           = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto k_acc           = k.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc       = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc           = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto lda_acc         = lda.get_access<cl::sycl::access::mode::read>(cgh);
+        auto beta_acc        = beta.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc           = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto ldc_acc         = ldc.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc  = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_ssyrk_batch>(cgh, [=]() {
+            rk_batch<float, float>(::ssyrk, group_count, upper_lower_acc.get_pointer(),
+                                   trans_acc.get_pointer(), n_acc.get_pointer(),
+                                   k_acc.get_pointer(), alpha_acc.get_pointer(),
+                                   a_acc.get_pointer(), lda_acc.get_pointer(),
+                                   beta_acc.get_pointer(), c_acc.get_pointer(),
+                                   ldc_acc.get_pointer(), group_size_acc.get_pointer());
+        });
+    });
+}
+
+void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
+                float alpha, cl::sycl::buffer<float, 1> &a, int64_t lda, int64_t stride_a,
+                float beta, cl::sycl::buffer<float, 1> &c, int64_t ldc, int64_t stride_c,
+                int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_ssyrk_batch_stride>(cgh, [=]() {
+            rk_batch<float, float>(::ssyrk, upper_lower, trans, n, k, alpha, a_acc.get_pointer(),
+                                   lda, stride_a, beta, c_acc.get_pointer(), ldc, stride_c,
+                                   batch_size);
+        });
+    });
+}
+
+void syrk_batch(cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<int64_t, 1> &k, cl::sycl::buffer<double, 1> &alpha,
+                cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<int64_t, 1> &lda,
+                cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &c,
+                cl::sycl::buffer<int64_t, 1> &ldc, int64_t group_count,
+                cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto upper_lower_acc = upper_lower.get_access<cl::sycl::access::mode::read>(cgh);
+        auto trans_acc       = trans.get_access<cl::sycl::access::mode::read>(cgh);
+        auto n_acc           = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto k_acc           = k.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc       = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc           = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto lda_acc         = lda.get_access<cl::sycl::access::mode::read>(cgh);
+        auto beta_acc        = beta.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc           = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto ldc_acc         = ldc.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc  = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_dsyrk_batch>(cgh, [=]() {
+            rk_batch<double, double>(::dsyrk, group_count, upper_lower_acc.get_pointer(),
+                                     trans_acc.get_pointer(), n_acc.get_pointer(),
+                                     k_acc.get_pointer(), alpha_acc.get_pointer(),
+                                     a_acc.get_pointer(), lda_acc.get_pointer(),
+                                     beta_acc.get_pointer(), c_acc.get_pointer(),
+                                     ldc_acc.get_pointer(), group_size_acc.get_pointer());
+        });
+    });
+}
+
+void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
+                double alpha, cl::sycl::buffer<double, 1> &a, int64_t lda, int64_t stride_a,
+                double beta, cl::sycl::buffer<double, 1> &c, int64_t ldc, int64_t stride_c,
+                int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_dsyrk_batch_stride>(cgh, [=]() {
+            rk_batch<double, double>(::dsyrk, upper_lower, trans, n, k, alpha, a_acc.get_pointer(),
+                                     lda, stride_a, beta, c_acc.get_pointer(), ldc, stride_c,
+                                     batch_size);
+        });
+    });
+}
+
+void syrk_batch(cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<int64_t, 1> &k, cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<float>, 1> &beta,
+                cl::sycl::buffer<std::complex<float>, 1> &c, cl::sycl::buffer<int64_t, 1> &ldc,
+                int64_t group_count, cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto upper_lower_acc = upper_lower.get_access<cl::sycl::access::mode::read>(cgh);
+        auto trans_acc       = trans.get_access<cl::sycl::access::mode::read>(cgh);
+        auto n_acc           = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto k_acc           = k.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc       = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc           = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto lda_acc         = lda.get_access<cl::sycl::access::mode::read>(cgh);
+        auto beta_acc        = beta.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc           = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto ldc_acc         = ldc.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc  = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_csyrk_batch>(cgh, [=]() {
+            rk_batch<MKL_Complex8, MKL_Complex8>(::csyrk, group_count,
+                                                 upper_lower_acc.get_pointer(),
+                                                 trans_acc.get_pointer(), n_acc.get_pointer(),
+                                                 k_acc.get_pointer(), alpha_acc.get_pointer(),
+                                                 a_acc.get_pointer(), lda_acc.get_pointer(),
+                                                 beta_acc.get_pointer(), c_acc.get_pointer(),
+                                                 ldc_acc.get_pointer(),
+                                                 group_size_acc.get_pointer());
+        });
+    });
+}
+
+void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
+                std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+                int64_t stride_a, std::complex<float> beta,
+                cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc, int64_t stride_c,
+                int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_csyrk_batch_stride>(cgh, [=]() {
+            rk_batch<MKL_Complex8, MKL_Complex8>(::csyrk, upper_lower, trans, n, k, alpha,
+                                                 a_acc.get_pointer(), lda, stride_a, beta,
+                                                 c_acc.get_pointer(), ldc, stride_c, batch_size);
+        });
+    });
+}
+
+void syrk_batch(cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<int64_t, 1> &k, cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a, cl::sycl::buffer<int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<double>, 1> &beta,
+                cl::sycl::buffer<std::complex<double>, 1> &c, cl::sycl::buffer<int64_t, 1> &ldc,
+                int64_t group_count, cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto upper_lower_acc = upper_lower.get_access<cl::sycl::access::mode::read>(cgh);
+        auto trans_acc       = trans.get_access<cl::sycl::access::mode::read>(cgh);
+        auto n_acc           = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto k_acc           = k.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc       = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc           = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto lda_acc         = lda.get_access<cl::sycl::access::mode::read>(cgh);
+        auto beta_acc        = beta.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc           = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto ldc_acc         = ldc.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc  = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_zsyrk_batch>(cgh, [=]() {
+            rk_batch<MKL_Complex16, MKL_Complex16>(::zsyrk, group_count,
+                                                   upper_lower_acc.get_pointer(),
+                                                   trans_acc.get_pointer(), n_acc.get_pointer(),
+                                                   k_acc.get_pointer(), alpha_acc.get_pointer(),
+                                                   a_acc.get_pointer(), lda_acc.get_pointer(),
+                                                   beta_acc.get_pointer(), c_acc.get_pointer(),
+                                                   ldc_acc.get_pointer(),
+                                                   group_size_acc.get_pointer());
+        });
+    });
+}
+
+void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
+                std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                int64_t lda, int64_t stride_a, std::complex<double> beta,
+                cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc, int64_t stride_c,
+                int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zsyrk_batch_stride>(cgh, [=]() {
+            rk_batch<MKL_Complex16, MKL_Complex16>(::zsyrk, upper_lower, trans, n, k, alpha,
+                                                   a_acc.get_pointer(), lda, stride_a, beta,
+                                                   c_acc.get_pointer(), ldc, stride_c, batch_size);
+        });
+    });
+}
+
+void herk_batch(cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<int64_t, 1> &k, cl::sycl::buffer<float, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<int64_t, 1> &lda,
+                cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+                cl::sycl::buffer<int64_t, 1> &ldc, int64_t group_count,
+                cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto upper_lower_acc = upper_lower.get_access<cl::sycl::access::mode::read>(cgh);
+        auto trans_acc       = trans.get_access<cl::sycl::access::mode::read>(cgh);
+        auto n_acc           = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto k_acc           = k.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc       = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc           = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto lda_acc         = lda.get_access<cl::sycl::access::mode::read>(cgh);
+        auto beta_acc        = beta.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc           = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto ldc_acc         = ldc.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc  = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_cherk_batch>(cgh, [=]() {
+            rk_batch<MKL_Complex8, float>(::cherk, group_count, upper_lower_acc.get_pointer(),
+                                          trans_acc.get_pointer(), n_acc.get_pointer(),
+                                          k_acc.get_pointer(), alpha_acc.get_pointer(),
+                                          a_acc.get_pointer(), lda_acc.get_pointer(),
+                                          beta_acc.get_pointer(), c_acc.get_pointer(),
+                                          ldc_acc.get_pointer(), group_size_acc.get_pointer());
+        });
+    });
+}
+
+void herk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
+                float alpha, cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+                int64_t stride_a, float beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+                int64_t ldc, int64_t stride_c, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_cherk_batch_stride>(cgh, [=]() {
+            rk_batch<MKL_Complex8, float>(::cherk, upper_lower, trans, n, k, alpha,
+                                          a_acc.get_pointer(), lda, stride_a, beta,
+                                          c_acc.get_pointer(), ldc, stride_c, batch_size);
+        });
+    });
+}
+
+void herk_batch(cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<int64_t, 1> &k, cl::sycl::buffer<double, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a, cl::sycl::buffer<int64_t, 1> &lda,
+                cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+                cl::sycl::buffer<int64_t, 1> &ldc, int64_t group_count,
+                cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto upper_lower_acc = upper_lower.get_access<cl::sycl::access::mode::read>(cgh);
+        auto trans_acc       = trans.get_access<cl::sycl::access::mode::read>(cgh);
+        auto n_acc           = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto k_acc           = k.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc       = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc           = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto lda_acc         = lda.get_access<cl::sycl::access::mode::read>(cgh);
+        auto beta_acc        = beta.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc           = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto ldc_acc         = ldc.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc  = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_zherk_batch>(cgh, [=]() {
+            rk_batch<MKL_Complex16, double>(::zherk, group_count, upper_lower_acc.get_pointer(),
+                                            trans_acc.get_pointer(), n_acc.get_pointer(),
+                                            k_acc.get_pointer(), alpha_acc.get_pointer(),
+                                            a_acc.get_pointer(), lda_acc.get_pointer(),
+                                            beta_acc.get_pointer(), c_acc.get_pointer(),
+                                            ldc_acc.get_pointer(), group_size_acc.get_pointer());
+        });
+    });
+}
+
+void herk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
+                double alpha, cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
+                int64_t stride_a, double beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+                int64_t ldc, int64_t stride_c, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zherk_batch_stride>(cgh, [=]() {
+            rk_batch<MKL_Complex16, double>(::zherk, upper_lower, trans, n, k, alpha,
+                                            a_acc.get_pointer(), lda, stride_a, beta,
+                                            c_acc.get_pointer(), ldc, stride_c, batch_size);
+        });
+    });
+}
+
+void gemv_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+                cl::sycl::buffer<int64_t, 1> &m, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+                cl::sycl::buffer<int64_t, 1> &lda, cl::sycl::buffer<float, 1> &x,
+                cl::sycl::buffer<int64_t, 1> &incx, cl::sycl::buffer<float, 1> &beta,
+                cl::sycl::buffer<float, 1> &y, cl::sycl::buffer<int64_t, 1> &incy,
+                int64_t group_count, cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto trans_acc      = trans.get_access<cl::sycl::access::mode::read>(cgh);
+        auto m_acc          = m.get_access<cl::sycl::access::mode::read>(cgh);
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc      = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc          = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto lda_acc        = lda.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc          = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto incx_acc       = incx.get_access<cl::sycl::access::mode::read>(cgh);
+        auto beta_acc       = beta.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc          = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto incy_acc       = incy.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_sgemv_batch>(cgh, [=]() {
+            mv_batch<float>(::sgemv, group_count, trans_acc.get_pointer(), m_acc.get_pointer(),
+                            n_acc.get_pointer(), alpha_acc.get_pointer(), a_acc.get_pointer(),
+                            lda_acc.get_pointer(), x_acc.get_pointer(), incx_acc.get_pointer(),
+                            beta_acc.get_pointer(), y_acc.get_pointer(), incy_acc.get_pointer(),
+                            group_size_acc.get_pointer());
+        });
+    });
+}
+
+void gemv_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
+                cl::sycl::buffer<float, 1> &a, int64_t lda, int64_t stride_a,
+                cl::sycl::buffer<float, 1> &x, int64_t incx, int64_t stride_x, float beta,
+                cl::sycl::buffer<float, 1> &y, int64_t incy, int64_t stride_y, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_sgemv_batch_stride>(cgh, [=]() {
+            mv_batch<float>(::sgemv, trans, m, n, alpha, a_acc.get_pointer(), lda, stride_a,
+                            x_acc.get_pointer(), incx, stride_x, beta, y_acc.get_pointer(), incy,
+                            stride_y, batch_size);
+        });
+    });
+}
+
+void gemv_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+                cl::sycl::buffer<int64_t, 1> &m, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+                cl::sycl::buffer<int64_t, 1> &lda, cl::sycl::buffer<double, 1> &x,
+                cl::sycl::buffer<int64_t, 1> &incx, cl::sycl::buffer<double, 1> &beta,
+                cl::sycl::buffer<double, 1> &y, cl::sycl::buffer<int64_t, 1> &incy,
+                int64_t group_count, cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto trans_acc      = trans.get_access<cl::sycl::access::mode::read>(cgh);
+        auto m_acc          = m.get_access<cl::sycl::access::mode::read>(cgh);
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc      = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc          = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto lda_acc        = lda.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc          = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto incx_acc       = incx.get_access<cl::sycl::access::mode::read>(cgh);
+        auto beta_acc       = beta.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc          = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto incy_acc       = incy.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_dgemv_batch>(cgh, [=]() {
+            mv_batch<double>(::dgemv, group_count, trans_acc.get_pointer(), m_acc.get_pointer(),
+                             n_acc.get_pointer(), alpha_acc.get_pointer(), a_acc.get_pointer(),
+                             lda_acc.get_pointer(), x_acc.get_pointer(), incx_acc.get_pointer(),
+                             beta_acc.get_pointer(), y_acc.get_pointer(), incy_acc.get_pointer(),
+                             group_size_acc.get_pointer());
+        });
+    });
+}
+
+void gemv_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, double alpha,
+                cl::sycl::buffer<double, 1> &a, int64_t lda, int64_t stride_a,
+                cl::sycl::buffer<double, 1> &x, int64_t incx, int64_t stride_x, double beta,
+                cl::sycl::buffer<double, 1> &y, int64_t incy, int64_t stride_y,
+                int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_dgemv_batch_stride>(cgh, [=]() {
+            mv_batch<double>(::dgemv, trans, m, n, alpha, a_acc.get_pointer(), lda, stride_a,
+                             x_acc.get_pointer(), incx, stride_x, beta, y_acc.get_pointer(), incy,
+                             stride_y, batch_size);
+        });
+    });
+}
+
+void gemv_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+                cl::sycl::buffer<int64_t, 1> &m, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<float>, 1> &x, cl::sycl::buffer<int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<float>, 1> &beta,
+                cl::sycl::buffer<std::complex<float>, 1> &y, cl::sycl::buffer<int64_t, 1> &incy,
+                int64_t group_count, cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto trans_acc      = trans.get_access<cl::sycl::access::mode::read>(cgh);
+        auto m_acc          = m.get_access<cl::sycl::access::mode::read>(cgh);
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc      = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc          = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto lda_acc        = lda.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc          = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto incx_acc       = incx.get_access<cl::sycl::access::mode::read>(cgh);
+        auto beta_acc       = beta.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc          = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto incy_acc       = incy.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_cgemv_batch>(cgh, [=]() {
+            mv_batch<MKL_Complex8>(::cgemv, group_count, trans_acc.get_pointer(),
+                                   m_acc.get_pointer(), n_acc.get_pointer(),
+                                   alpha_acc.get_pointer(), a_acc.get_pointer(),
+                                   lda_acc.get_pointer(), x_acc.get_pointer(),
+                                   incx_acc.get_pointer(), beta_acc.get_pointer(),
+                                   y_acc.get_pointer(), incy_acc.get_pointer(),
+                                   group_size_acc.get_pointer());
+        });
+    });
+}
+
+void gemv_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+                int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
+                int64_t stride_x, std::complex<float> beta,
+                cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy, int64_t stride_y,
+                int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_cgemv_batch_stride>(cgh, [=]() {
+            mv_batch<MKL_Complex8>(::cgemv, trans, m, n, alpha, a_acc.get_pointer(), lda, stride_a,
+                                   x_acc.get_pointer(), incx, stride_x, beta, y_acc.get_pointer(),
+                                   incy, stride_y, batch_size);
+        });
+    });
+}
+
+void gemv_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+                cl::sycl::buffer<int64_t, 1> &m, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a, cl::sycl::buffer<int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<double>, 1> &x, cl::sycl::buffer<int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<double>, 1> &beta,
+                cl::sycl::buffer<std::complex<double>, 1> &y, cl::sycl::buffer<int64_t, 1> &incy,
+                int64_t group_count, cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto trans_acc      = trans.get_access<cl::sycl::access::mode::read>(cgh);
+        auto m_acc          = m.get_access<cl::sycl::access::mode::read>(cgh);
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc      = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc          = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto lda_acc        = lda.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc          = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto incx_acc       = incx.get_access<cl::sycl::access::mode::read>(cgh);
+        auto beta_acc       = beta.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc          = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto incy_acc       = incy.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_zgemv_batch>(cgh, [=]() {
+            mv_batch<MKL_Complex16>(::zgemv, group_count, trans_acc.get_pointer(),
+                                    m_acc.get_pointer(), n_acc.get_pointer(),
+                                    alpha_acc.get_pointer(), a_acc.get_pointer(),
+                                    lda_acc.get_pointer(), x_acc.get_pointer(),
+                                    incx_acc.get_pointer(), beta_acc.get_pointer(),
+                                    y_acc.get_pointer(), incy_acc.get_pointer(),
+                                    group_size_acc.get_pointer());
+        });
+    });
+}
+
+void gemv_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                int64_t lda, int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &x,
+                int64_t incx, int64_t stride_x, std::complex<double> beta,
+                cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy, int64_t stride_y,
+                int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zgemv_batch_stride>(cgh, [=]() {
+            mv_batch<MKL_Complex16>(::zgemv, trans, m, n, alpha, a_acc.get_pointer(), lda, stride_a,
+                                    x_acc.get_pointer(), incx, stride_x, beta, y_acc.get_pointer(),
+                                    incy, stride_y, batch_size);
+        });
+    });
+}
+
+void gemv_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
+                cl::sycl::buffer<half, 1> &a, int64_t lda, int64_t stride_a,
+                cl::sycl::buffer<float, 1> &x, int64_t incx, int64_t stride_x, float beta,
+                cl::sycl::buffer<float, 1> &y, int64_t incy, int64_t stride_y, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_gemv_f16f32_batch_stride>(cgh, [=]() {
+            const uint16_t *a_mat =
+                static_cast<const uint16_t *>(static_cast<void *>(a_acc.get_pointer()));
+            hgemv_batch(convert_f16_to_f32, trans, m, n, alpha, a_mat, lda, stride_a,
+                        x_acc.get_pointer(), incx, stride_x, beta, y_acc.get_pointer(), incy,
+                        stride_y, batch_size);
+        });
+    });
+}
+
+void gemv_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
+                cl::sycl::buffer<bfloat16, 1> &a, int64_t lda, int64_t stride_a,
+                cl::sycl::buffer<float, 1> &x, int64_t incx, int64_t stride_x, float beta,
+                cl::sycl::buffer<float, 1> &y, int64_t incy, int64_t stride_y, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_gemv_bf16f32_batch_stride>(cgh, [=]() {
+            const uint16_t *a_mat =
+                static_cast<const uint16_t *>(static_cast<void *>(a_acc.get_pointer()));
+            hgemv_batch(convert_bf16_to_f32, trans, m, n, alpha, a_mat, lda, stride_a,
+                        x_acc.get_pointer(), incx, stride_x, beta, y_acc.get_pointer(), incy,
+                        stride_y, batch_size);
+        });
+    });
+}
+
+void dgmm_batch(cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                cl::sycl::buffer<int64_t, 1> &m, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<int64_t, 1> &lda,
+                cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<int64_t, 1> &incx,
+                cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<int64_t, 1> &ldc,
+                int64_t group_count, cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto left_right_acc = left_right.get_access<cl::sycl::access::mode::read>(cgh);
+        auto m_acc          = m.get_access<cl::sycl::access::mode::read>(cgh);
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc          = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto lda_acc        = lda.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc          = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto incx_acc       = incx.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc          = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto ldc_acc        = ldc.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_sdgmm_batch>(cgh, [=]() {
+            dm_batch<float>(group_count, left_right_acc.get_pointer(), m_acc.get_pointer(),
+                            n_acc.get_pointer(), a_acc.get_pointer(), lda_acc.get_pointer(),
+                            x_acc.get_pointer(), incx_acc.get_pointer(), c_acc.get_pointer(),
+                            ldc_acc.get_pointer(), group_size_acc.get_pointer());
+        });
+    });
+}
+
+void dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, int64_t n,
+                cl::sycl::buffer<float, 1> &a, int64_t lda, int64_t stride_a,
+                cl::sycl::buffer<float, 1> &x, int64_t incx, int64_t stride_x,
+                cl::sycl::buffer<float, 1> &c, int64_t ldc, int64_t stride_c, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_sdgmm_batch_stride>(cgh, [=]() {
+            dm_batch<float>(left_right, m, n, a_acc.get_pointer(), lda, stride_a,
+                            x_acc.get_pointer(), incx, stride_x, c_acc.get_pointer(), ldc, stride_c,
+                            batch_size);
+        });
+    });
+}
+
+void dgmm_batch(cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                cl::sycl::buffer<int64_t, 1> &m, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<int64_t, 1> &lda,
+                cl::sycl::buffer<double, 1> &x, cl::sycl::buffer<int64_t, 1> &incx,
+                cl::sycl::buffer<double, 1> &c, cl::sycl::buffer<int64_t, 1> &ldc,
+                int64_t group_count, cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto left_right_acc = left_right.get_access<cl::sycl::access::mode::read>(cgh);
+        auto m_acc          = m.get_access<cl::sycl::access::mode::read>(cgh);
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc          = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto lda_acc        = lda.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc          = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto incx_acc       = incx.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc          = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto ldc_acc        = ldc.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_ddgmm_batch>(cgh, [=]() {
+            dm_batch<double>(group_count, left_right_acc.get_pointer(), m_acc.get_pointer(),
+                             n_acc.get_pointer(), a_acc.get_pointer(), lda_acc.get_pointer(),
+                             x_acc.get_pointer(), incx_acc.get_pointer(), c_acc.get_pointer(),
+                             ldc_acc.get_pointer(), group_size_acc.get_pointer());
+        });
+    });
+}
+
+void dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, int64_t n,
+                cl::sycl::buffer<double, 1> &a, int64_t lda, int64_t stride_a,
+                cl::sycl::buffer<double, 1> &x, int64_t incx, int64_t stride_x,
+                cl::sycl::buffer<double, 1> &c, int64_t ldc, int64_t stride_c, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_ddgmm_batch_stride>(cgh, [=]() {
+            dm_batch<double>(left_right, m, n, a_acc.get_pointer(), lda, stride_a,
+                             x_acc.get_pointer(), incx, stride_x, c_acc.get_pointer(), ldc,
+                             stride_c, batch_size);
+        });
+    });
+}
+
+void dgmm_batch(cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                cl::sycl::buffer<int64_t, 1> &m, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<float>, 1> &x, cl::sycl::buffer<int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<float>, 1> &c, cl::sycl::buffer<int64_t, 1> &ldc,
+                int64_t group_count, cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto left_right_acc = left_right.get_access<cl::sycl::access::mode::read>(cgh);
+        auto m_acc          = m.get_access<cl::sycl::access::mode::read>(cgh);
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc          = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto lda_acc        = lda.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc          = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto incx_acc       = incx.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc          = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto ldc_acc        = ldc.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_cdgmm_batch>(cgh, [=]() {
+            dm_batch<MKL_Complex8>(group_count, left_right_acc.get_pointer(), m_acc.get_pointer(),
+                                   n_acc.get_pointer(), a_acc.get_pointer(), lda_acc.get_pointer(),
+                                   x_acc.get_pointer(), incx_acc.get_pointer(), c_acc.get_pointer(),
+                                   ldc_acc.get_pointer(), group_size_acc.get_pointer());
+        });
+    });
+}
+
+void dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, int64_t n,
+                cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda, int64_t stride_a,
+                cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx, int64_t stride_x,
+                cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc, int64_t stride_c,
+                int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_cdgmm_batch_stride>(cgh, [=]() {
+            dm_batch<MKL_Complex8>(left_right, m, n, a_acc.get_pointer(), lda, stride_a,
+                                   x_acc.get_pointer(), incx, stride_x, c_acc.get_pointer(), ldc,
+                                   stride_c, batch_size);
+        });
+    });
+}
+
+void dgmm_batch(cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                cl::sycl::buffer<int64_t, 1> &m, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<double>, 1> &a, cl::sycl::buffer<int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<double>, 1> &x, cl::sycl::buffer<int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<double>, 1> &c, cl::sycl::buffer<int64_t, 1> &ldc,
+                int64_t group_count, cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto left_right_acc = left_right.get_access<cl::sycl::access::mode::read>(cgh);
+        auto m_acc          = m.get_access<cl::sycl::access::mode::read>(cgh);
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc          = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto lda_acc        = lda.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc          = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto incx_acc       = incx.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc          = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto ldc_acc        = ldc.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_zdgmm_batch>(cgh, [=]() {
+            dm_batch<MKL_Complex16>(group_count, left_right_acc.get_pointer(), m_acc.get_pointer(),
+                                    n_acc.get_pointer(), a_acc.get_pointer(), lda_acc.get_pointer(),
+                                    x_acc.get_pointer(), incx_acc.get_pointer(),
+                                    c_acc.get_pointer(), ldc_acc.get_pointer(),
+                                    group_size_acc.get_pointer());
+        });
+    });
+}
+
+void dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, int64_t n,
+                cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda, int64_t stride_a,
+                cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx, int64_t stride_x,
+                cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc, int64_t stride_c,
+                int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zdgmm_batch_stride>(cgh, [=]() {
+            dm_batch<MKL_Complex16>(left_right, m, n, a_acc.get_pointer(), lda, stride_a,
+                                    x_acc.get_pointer(), incx, stride_x, c_acc.get_pointer(), ldc,
+                                    stride_c, batch_size);
+        });
+    });
+}
+
+void axpy_batch(cl::sycl::queue &queue, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &x,
+                cl::sycl::buffer<int64_t, 1> &incx, cl::sycl::buffer<float, 1> &y,
+                cl::sycl::buffer<int64_t, 1> &incy, int64_t group_count,
+                cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc      = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc          = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto incx_acc       = incx.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc          = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto incy_acc       = incy.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_saxpy_batch>(cgh, [=]() {
+            xaxpy_batch<float>(::saxpy, group_count, n_acc.get_pointer(), alpha_acc.get_pointer(),
+                               x_acc.get_pointer(), incx_acc.get_pointer(), y_acc.get_pointer(),
+                               incy_acc.get_pointer(), group_size_acc.get_pointer());
+        });
+    });
+}
+
+void axpy_batch(cl::sycl::queue &queue, int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+                int64_t incx, int64_t stride_x, cl::sycl::buffer<float, 1> &y, int64_t incy,
+                int64_t stride_y, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto x_acc = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_saxpy_batch_stride>(cgh, [=]() {
+            xaxpy_batch<float>(::saxpy, n, alpha, x_acc.get_pointer(), incx, stride_x,
+                               y_acc.get_pointer(), incy, stride_y, batch_size);
+        });
+    });
+}
+
+void axpy_batch(cl::sycl::queue &queue, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &x,
+                cl::sycl::buffer<int64_t, 1> &incx, cl::sycl::buffer<double, 1> &y,
+                cl::sycl::buffer<int64_t, 1> &incy, int64_t group_count,
+                cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc      = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc          = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto incx_acc       = incx.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc          = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto incy_acc       = incy.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_daxpy_batch>(cgh, [=]() {
+            xaxpy_batch<double>(::daxpy, group_count, n_acc.get_pointer(), alpha_acc.get_pointer(),
+                                x_acc.get_pointer(), incx_acc.get_pointer(), y_acc.get_pointer(),
+                                incy_acc.get_pointer(), group_size_acc.get_pointer());
+        });
+    });
+}
+
+void axpy_batch(cl::sycl::queue &queue, int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
+                int64_t incx, int64_t stride_x, cl::sycl::buffer<double, 1> &y, int64_t incy,
+                int64_t stride_y, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto x_acc = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_daxpy_batch_stride>(cgh, [=]() {
+            xaxpy_batch<double>(::daxpy, n, alpha, x_acc.get_pointer(), incx, stride_x,
+                                y_acc.get_pointer(), incy, stride_y, batch_size);
+        });
+    });
+}
+
+void axpy_batch(cl::sycl::queue &queue, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x, cl::sycl::buffer<int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<float>, 1> &y, cl::sycl::buffer<int64_t, 1> &incy,
+                int64_t group_count, cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc      = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc          = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto incx_acc       = incx.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc          = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto incy_acc       = incy.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_caxpy_batch>(cgh, [=]() {
+            xaxpy_batch<MKL_Complex8>(::caxpy, group_count, n_acc.get_pointer(),
+                                      alpha_acc.get_pointer(), x_acc.get_pointer(),
+                                      incx_acc.get_pointer(), y_acc.get_pointer(),
+                                      incy_acc.get_pointer(), group_size_acc.get_pointer());
+        });
+    });
+}
+
+void axpy_batch(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx, int64_t stride_x,
+                cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy, int64_t stride_y,
+                int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto x_acc = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_caxpy_batch_stride>(cgh, [=]() {
+            xaxpy_batch<MKL_Complex8>(::caxpy, n, alpha, x_acc.get_pointer(), incx, stride_x,
+                                      y_acc.get_pointer(), incy, stride_y, batch_size);
+        });
+    });
+}
+
+void axpy_batch(cl::sycl::queue &queue, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x, cl::sycl::buffer<int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<double>, 1> &y, cl::sycl::buffer<int64_t, 1> &incy,
+                int64_t group_count, cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc      = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc          = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto incx_acc       = incx.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc          = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto incy_acc       = incy.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_zaxpy_batch>(cgh, [=]() {
+            xaxpy_batch<MKL_Complex16>(::zaxpy, group_count, n_acc.get_pointer(),
+                                       alpha_acc.get_pointer(), x_acc.get_pointer(),
+                                       incx_acc.get_pointer(), y_acc.get_pointer(),
+                                       incy_acc.get_pointer(), group_size_acc.get_pointer());
+        });
+    });
+}
+
+void axpy_batch(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx, int64_t stride_x,
+                cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy, int64_t stride_y,
+                int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto x_acc = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zaxpy_batch_stride>(cgh, [=]() {
+            xaxpy_batch<MKL_Complex16>(::zaxpy, n, alpha, x_acc.get_pointer(), incx, stride_x,
+                                       y_acc.get_pointer(), incy, stride_y, batch_size);
+        });
+    });
+}
+
+void copy_batch(cl::sycl::queue &queue, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<int64_t, 1> &incx,
+                cl::sycl::buffer<float, 1> &y, cl::sycl::buffer<int64_t, 1> &incy,
+                int64_t group_count, cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc          = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto incx_acc       = incx.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc          = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto incy_acc       = incy.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_scopy_batch>(cgh, [=]() {
+            xcopy_batch<float>(::scopy, group_count, n_acc.get_pointer(), x_acc.get_pointer(),
+                               incx_acc.get_pointer(), y_acc.get_pointer(), incy_acc.get_pointer(),
+                               group_size_acc.get_pointer());
+        });
+    });
+}
+
+void copy_batch(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
+                int64_t stride_x, cl::sycl::buffer<float, 1> &y, int64_t incy, int64_t stride_y,
+                int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto x_acc = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_scopy_batch_stride>(cgh, [=]() {
+            xcopy_batch<float>(::scopy, n, x_acc.get_pointer(), incx, stride_x, y_acc.get_pointer(),
+                               incy, stride_y, batch_size);
+        });
+    });
+}
+
+void copy_batch(cl::sycl::queue &queue, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &x, cl::sycl::buffer<int64_t, 1> &incx,
+                cl::sycl::buffer<double, 1> &y, cl::sycl::buffer<int64_t, 1> &incy,
+                int64_t group_count, cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc          = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto incx_acc       = incx.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc          = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto incy_acc       = incy.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_dcopy_batch>(cgh, [=]() {
+            xcopy_batch<double>(::dcopy, group_count, n_acc.get_pointer(), x_acc.get_pointer(),
+                                incx_acc.get_pointer(), y_acc.get_pointer(), incy_acc.get_pointer(),
+                                group_size_acc.get_pointer());
+        });
+    });
+}
+
+void copy_batch(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int64_t incx,
+                int64_t stride_x, cl::sycl::buffer<double, 1> &y, int64_t incy, int64_t stride_y,
+                int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto x_acc = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_dcopy_batch_stride>(cgh, [=]() {
+            xcopy_batch<double>(::dcopy, n, x_acc.get_pointer(), incx, stride_x,
+                                y_acc.get_pointer(), incy, stride_y, batch_size);
+        });
+    });
+}
+
+void copy_batch(cl::sycl::queue &queue, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<float>, 1> &x, cl::sycl::buffer<int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<float>, 1> &y, cl::sycl::buffer<int64_t, 1> &incy,
+                int64_t group_count, cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc          = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto incx_acc       = incx.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc          = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto incy_acc       = incy.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_ccopy_batch>(cgh, [=]() {
+            xcopy_batch<MKL_Complex8>(::ccopy, group_count, n_acc.get_pointer(),
+                                      x_acc.get_pointer(), incx_acc.get_pointer(),
+                                      y_acc.get_pointer(), incy_acc.get_pointer(),
+                                      group_size_acc.get_pointer());
+        });
+    });
+}
+
+void copy_batch(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
+                int64_t incx, int64_t stride_x, cl::sycl::buffer<std::complex<float>, 1> &y,
+                int64_t incy, int64_t stride_y, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto x_acc = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_ccopy_batch_stride>(cgh, [=]() {
+            xcopy_batch<MKL_Complex8>(::ccopy, n, x_acc.get_pointer(), incx, stride_x,
+                                      y_acc.get_pointer(), incy, stride_y, batch_size);
+        });
+    });
+}
+
+void copy_batch(cl::sycl::queue &queue, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<double>, 1> &x, cl::sycl::buffer<int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<double>, 1> &y, cl::sycl::buffer<int64_t, 1> &incy,
+                int64_t group_count, cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc          = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto incx_acc       = incx.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc          = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto incy_acc       = incy.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_zcopy_batch>(cgh, [=]() {
+            xcopy_batch<MKL_Complex16>(::zcopy, group_count, n_acc.get_pointer(),
+                                       x_acc.get_pointer(), incx_acc.get_pointer(),
+                                       y_acc.get_pointer(), incy_acc.get_pointer(),
+                                       group_size_acc.get_pointer());
+        });
+    });
+}
+
+void copy_batch(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x,
+                int64_t incx, int64_t stride_x, cl::sycl::buffer<std::complex<double>, 1> &y,
+                int64_t incy, int64_t stride_y, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto x_acc = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zcopy_batch_stride>(cgh, [=]() {
+            xcopy_batch<MKL_Complex16>(::zcopy, n, x_acc.get_pointer(), incx, stride_x,
+                                       y_acc.get_pointer(), incy, stride_y, batch_size);
+        });
+    });
+}
+
+void dot_batch(cl::sycl::queue &queue, cl::sycl::buffer<int64_t, 1> &n,
+               cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<int64_t, 1> &incx,
+               cl::sycl::buffer<float, 1> &y, cl::sycl::buffer<int64_t, 1> &incy,
+               cl::sycl::buffer<float, 1> &result, int64_t group_count,
+               cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc          = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto incx_acc       = incx.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc          = y.get_access<cl::sycl::access::mode::read>(cgh);
+        auto incy_acc       = incy.get_access<cl::sycl::access::mode::read>(cgh);
+        auto result_acc     = result.get_access<cl::sycl::access::mode::write>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_sdot_batch>(cgh, [=]() {
+            xdot_batch<float>(::sdot, group_count, n_acc.get_pointer(), x_acc.get_pointer(),
+                              incx_acc.get_pointer(), y_acc.get_pointer(), incy_acc.get_pointer(),
+                              result_acc.get_pointer(), group_size_acc.get_pointer());
+        });
+    });
+}
+
+void dot_batch(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
+               int64_t stride_x, cl::sycl::buffer<float, 1> &y, int64_t incy, int64_t stride_y,
+               cl::sycl::buffer<float, 1> &result, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto x_acc      = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc      = y.get_access<cl::sycl::access::mode::read>(cgh);
+        auto result_acc = result.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class mkl_kernel_sdot_batch_stride>(cgh, [=]() {
+            xdot_batch<float>(::sdot, n, x_acc.get_pointer(), incx, stride_x, y_acc.get_pointer(),
+                              incy, stride_y, result_acc.get_pointer(), batch_size);
+        });
+    });
+}
+
+void dot_batch(cl::sycl::queue &queue, cl::sycl::buffer<int64_t, 1> &n,
+               cl::sycl::buffer<double, 1> &x, cl::sycl::buffer<int64_t, 1> &incx,
+               cl::sycl::buffer<double, 1> &y, cl::sycl::buffer<int64_t, 1> &incy,
+               cl::sycl::buffer<double, 1> &result, int64_t group_count,
+               cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc          = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto incx_acc       = incx.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc          = y.get_access<cl::sycl::access::mode::read>(cgh);
+        auto incy_acc       = incy.get_access<cl::sycl::access::mode::read>(cgh);
+        auto result_acc     = result.get_access<cl::sycl::access::mode::write>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_ddot_batch>(cgh, [=]() {
+            xdot_batch<double>(::ddot, group_count, n_acc.get_pointer(), x_acc.get_pointer(),
+                               incx_acc.get_pointer(), y_acc.get_pointer(), incy_acc.get_pointer(),
+                               result_acc.get_pointer(), group_size_acc.get_pointer());
+        });
+    });
+}
+
+void dot_batch(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int64_t incx,
+               int64_t stride_x, cl::sycl::buffer<double, 1> &y, int64_t incy, int64_t stride_y,
+               cl::sycl::buffer<double, 1> &result, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto x_acc      = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto y_acc      = y.get_access<cl::sycl::access::mode::read>(cgh);
+        auto result_acc = result.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class mkl_kernel_ddot_batch_stride>(cgh, [=]() {
+            xdot_batch<double>(::ddot, n, x_acc.get_pointer(), incx, stride_x, y_acc.get_pointer(),
+                               incy, stride_y, result_acc.get_pointer(), batch_size);
+        });
+    });
+}
+
+void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &x,
+                cl::sycl::buffer<int64_t, 1> &incx, int64_t group_count,
+                cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc      = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc          = x.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto incx_acc       = incx.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_sscal_batch>(cgh, [=]() {
+            xscal_batch<float, float>(::sscal, group_count, n_acc.get_pointer(),
+                                      alpha_acc.get_pointer(), x_acc.get_pointer(),
+                                      incx_acc.get_pointer(), group_size_acc.get_pointer());
+        });
+    });
+}
+
+void scal_batch(cl::sycl::queue &queue, int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+                int64_t incx, int64_t stride_x, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto x_acc = x.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_sscal_batch_stride>(cgh, [=]() {
+            xscal_batch<float, float>(::sscal, n, alpha, x_acc.get_pointer(), incx, stride_x,
+                                      batch_size);
+        });
+    });
+}
+
+void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &x,
+                cl::sycl::buffer<int64_t, 1> &incx, int64_t group_count,
+                cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc      = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc          = x.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto incx_acc       = incx.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_dscal_batch>(cgh, [=]() {
+            xscal_batch<double, double>(::dscal, group_count, n_acc.get_pointer(),
+                                        alpha_acc.get_pointer(), x_acc.get_pointer(),
+                                        incx_acc.get_pointer(), group_size_acc.get_pointer());
+        });
+    });
+}
+
+void scal_batch(cl::sycl::queue &queue, int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
+                int64_t incx, int64_t stride_x, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto x_acc = x.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_dscal_batch_stride>(cgh, [=]() {
+            xscal_batch<double, double>(::dscal, n, alpha, x_acc.get_pointer(), incx, stride_x,
+                                        batch_size);
+        });
+    });
+}
+
+void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x, cl::sycl::buffer<int64_t, 1> &incx,
+                int64_t group_count, cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc      = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc          = x.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto incx_acc       = incx.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_cscal_batch>(cgh, [=]() {
+            xscal_batch<MKL_Complex8, MKL_Complex8>(::cscal, group_count, n_acc.get_pointer(),
+                                                    alpha_acc.get_pointer(), x_acc.get_pointer(),
+                                                    incx_acc.get_pointer(),
+                                                    group_size_acc.get_pointer());
+        });
+    });
+}
+
+void scal_batch(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx, int64_t stride_x,
+                int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto x_acc = x.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_cscal_batch_stride>(cgh, [=]() {
+            xscal_batch<MKL_Complex8, MKL_Complex8>(::cscal, n, alpha, x_acc.get_pointer(), incx,
+                                                    stride_x, batch_size);
+        });
+    });
+}
+
+void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x, cl::sycl::buffer<int64_t, 1> &incx,
+                int64_t group_count, cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc      = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc          = x.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto incx_acc       = incx.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_zscal_batch>(cgh, [=]() {
+            xscal_batch<MKL_Complex16, MKL_Complex16>(::zscal, group_count, n_acc.get_pointer(),
+                                                      alpha_acc.get_pointer(), x_acc.get_pointer(),
+                                                      incx_acc.get_pointer(),
+                                                      group_size_acc.get_pointer());
+        });
+    });
+}
+
+void scal_batch(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx, int64_t stride_x,
+                int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto x_acc = x.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zscal_batch_stride>(cgh, [=]() {
+            xscal_batch<MKL_Complex16, MKL_Complex16>(::zscal, n, alpha, x_acc.get_pointer(), incx,
+                                                      stride_x, batch_size);
+        });
+    });
+}
+
+void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
+                cl::sycl::buffer<int64_t, 1> &incx, int64_t group_count,
+                cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc      = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc          = x.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto incx_acc       = incx.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_csscal_batch>(cgh, [=]() {
+            xscal_batch<MKL_Complex8, float>(::csscal, group_count, n_acc.get_pointer(),
+                                             alpha_acc.get_pointer(), x_acc.get_pointer(),
+                                             incx_acc.get_pointer(), group_size_acc.get_pointer());
+        });
+    });
+}
+
+void scal_batch(cl::sycl::queue &queue, int64_t n, float alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx, int64_t stride_x,
+                int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto x_acc = x.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_csscal_batch_stride>(cgh, [=]() {
+            xscal_batch<MKL_Complex8, float>(::csscal, n, alpha, x_acc.get_pointer(), incx,
+                                             stride_x, batch_size);
+        });
+    });
+}
+
+void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
+                cl::sycl::buffer<int64_t, 1> &incx, int64_t group_count,
+                cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc      = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto x_acc          = x.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto incx_acc       = incx.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_zdscal_batch>(cgh, [=]() {
+            xscal_batch<MKL_Complex16, double>(::zdscal, group_count, n_acc.get_pointer(),
+                                               alpha_acc.get_pointer(), x_acc.get_pointer(),
+                                               incx_acc.get_pointer(),
+                                               group_size_acc.get_pointer());
+        });
+    });
+}
+
+void scal_batch(cl::sycl::queue &queue, int64_t n, double alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx, int64_t stride_x,
+                int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto x_acc = x.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zdscal_batch_stride>(cgh, [=]() {
+            xscal_batch<MKL_Complex16, double>(::zdscal, n, alpha, x_acc.get_pointer(), incx,
+                                               stride_x, batch_size);
+        });
+    });
+}
+
+void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<int64_t, 1> &m,
+                cl::sycl::buffer<int64_t, 1> &n, cl::sycl::buffer<int64_t, 1> &k,
+                cl::sycl::buffer<half, 1> &alpha, cl::sycl::buffer<half, 1> &a,
+                cl::sycl::buffer<int64_t, 1> &lda, cl::sycl::buffer<int64_t, 1> &offset_a,
+                cl::sycl::buffer<half, 1> &b, cl::sycl::buffer<int64_t, 1> &ldb,
+                cl::sycl::buffer<int64_t, 1> &offset_b, cl::sycl::buffer<half, 1> &beta,
+                cl::sycl::buffer<half, 1> &c, cl::sycl::buffer<int64_t, 1> &ldc,
+                cl::sycl::buffer<int64_t, 1> &offset_c, int64_t group_count,
+                cl::sycl::buffer<int64_t, 1> &group_size) {
+    auto a_fp16 = a.reinterpret<fp16, 1>(a.get_range());
+    auto b_fp16 = b.reinterpret<fp16, 1>(b.get_range());
+    auto c_fp16 = c.reinterpret<fp16, 1>(c.get_range());
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto transa_acc     = transa.get_access<cl::sycl::access::mode::read>(cgh);
+        auto transb_acc     = transb.get_access<cl::sycl::access::mode::read>(cgh);
+        auto m_acc          = m.get_access<cl::sycl::access::mode::read>(cgh);
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto k_acc          = k.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc      = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc          = a_fp16.get_access<cl::sycl::access::mode::read>(cgh);
+        auto lda_acc        = lda.get_access<cl::sycl::access::mode::read>(cgh);
+        auto offset_a_acc   = offset_a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc          = b_fp16.get_access<cl::sycl::access::mode::read>(cgh);
+        auto ldb_acc        = ldb.get_access<cl::sycl::access::mode::read>(cgh);
+        auto offset_b_acc   = offset_b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto beta_acc       = beta.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc          = c_fp16.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto ldc_acc        = ldc.get_access<cl::sycl::access::mode::read>(cgh);
+        auto offset_c_acc   = offset_c.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_hgemm_batch_offset>(cgh, [=]() {
+            std::vector<float> alpha_(group_count), beta_(group_count);
+            for (int64_t i = 0; i < group_count; i++) {
+                alpha_[i] = (float)alpha_acc[i];
+                beta_[i]  = (float)beta_acc[i];
+            }
+            const uint16_t *a_mat =
+                static_cast<const uint16_t *>(static_cast<void *>(a_acc.get_pointer()));
+            const uint16_t *b_mat =
+                static_cast<const uint16_t *>(static_cast<void *>(b_acc.get_pointer()));
+            uint16_t *c_mat = static_cast<uint16_t *>(static_cast<void *>(c_acc.get_pointer()));
+            hgemm_batch(group_count, transa_acc.get_pointer(), transb_acc.get_pointer(),
+                        m_acc.get_pointer(), n_acc.get_pointer(), k_acc.get_pointer(),
+                        alpha_.data(), a_mat, lda_acc.get_pointer(), offset_a_acc.get_pointer(),
+                        b_mat, ldb_acc.get_pointer(), offset_b_acc.get_pointer(), beta_.data(),
+                        c_mat, ldc_acc.get_pointer(), offset_c_acc.get_pointer(),
+                        group_size_acc.get_pointer());
+        });
+    });
+}
+
+void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                int64_t k, half alpha, cl::sycl::buffer<half, 1> &a, int64_t lda,
+                int64_t stride_a, cl::sycl::buffer<half, 1> &b, int64_t ldb, int64_t stride_b,
+                half beta, cl::sycl::buffer<half, 1> &c, int64_t ldc, int64_t stride_c,
+                int64_t batch_size) {
+    auto a_fp16 = a.reinterpret<fp16, 1>(a.get_range());
+    auto b_fp16 = b.reinterpret<fp16, 1>(b.get_range());
+    auto c_fp16 = c.reinterpret<fp16, 1>(c.get_range());
+    queue.submit([&](cl::sycl::handler &cgh) {
+        float f32_alpha = (float)alpha;
+        float f32_beta  = (float)beta;
+        auto a_acc      = a_fp16.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc      = b_fp16.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc      = c_fp16.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_hgemm_batch_stride>(cgh, [=]() {
+            const uint16_t *a_mat =
+                static_cast<const uint16_t *>(static_cast<void *>(a_acc.get_pointer()));
+            const uint16_t *b_mat =
+                static_cast<const uint16_t *>(static_cast<void *>(b_acc.get_pointer()));
+            uint16_t *c_mat = static_cast<uint16_t *>(static_cast<void *>(c_acc.get_pointer()));
+            hgemm_batch(transa, transb, m, n, k, f32_alpha, a_mat, lda, stride_a, b_mat, ldb,
+                        stride_b, f32_beta, c_mat, ldc, stride_c, batch_size);
+        });
+    });
+}
+
+void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<int64_t, 1> &m,
+                cl::sycl::buffer<int64_t, 1> &n, cl::sycl::buffer<int64_t, 1> &k,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<half, 1> &a,
+                cl::sycl::buffer<int64_t, 1> &lda, cl::sycl::buffer<int64_t, 1> &offset_a,
+                cl::sycl::buffer<half, 1> &b, cl::sycl::buffer<int64_t, 1> &ldb,
+                cl::sycl::buffer<int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+                cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<int64_t, 1> &ldc,
+                cl::sycl::buffer<int64_t, 1> &offset_c, int64_t group_count,
+                cl::sycl::buffer<int64_t, 1> &group_size) {
+    auto a_fp16 = a.reinterpret<fp16, 1>(a.get_range());
+    auto b_fp16 = b.reinterpret<fp16, 1>(b.get_range());
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto transa_acc     = transa.get_access<cl::sycl::access::mode::read>(cgh);
+        auto transb_acc     = transb.get_access<cl::sycl::access::mode::read>(cgh);
+        auto m_acc          = m.get_access<cl::sycl::access::mode::read>(cgh);
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto k_acc          = k.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc      = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc          = a_fp16.get_access<cl::sycl::access::mode::read>(cgh);
+        auto lda_acc        = lda.get_access<cl::sycl::access::mode::read>(cgh);
+        auto offset_a_acc   = offset_a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc          = b_fp16.get_access<cl::sycl::access::mode::read>(cgh);
+        auto ldb_acc        = ldb.get_access<cl::sycl::access::mode::read>(cgh);
+        auto offset_b_acc   = offset_b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto beta_acc       = beta.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc          = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto ldc_acc        = ldc.get_access<cl::sycl::access::mode::read>(cgh);
+        auto offset_c_acc   = offset_c.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_gemm_f16f16f32_batch_offset>(cgh, [=]() {
+            const uint16_t *a_mat =
+                static_cast<const uint16_t *>(static_cast<void *>(a_acc.get_pointer()));
+            const uint16_t *b_mat =
+                static_cast<const uint16_t *>(static_cast<void *>(b_acc.get_pointer()));
+            hgemm_batch(group_count, transa_acc.get_pointer(), transb_acc.get_pointer(),
+                        m_acc.get_pointer(), n_acc.get_pointer(), k_acc.get_pointer(),
+                        alpha_acc.get_pointer(), a_mat, lda_acc.get_pointer(),
+                        offset_a_acc.get_pointer(), b_mat, ldb_acc.get_pointer(),
+                        offset_b_acc.get_pointer(), beta_acc.get_pointer(), c_acc.get_pointer(),
+                        ldc_acc.get_pointer(), offset_c_acc.get_pointer(),
+                        group_size_acc.get_pointer());
+        });
+    });
+}
+
+void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                int64_t k, float alpha, cl::sycl::buffer<half, 1> &a, int64_t lda,
+                int64_t stride_a, cl::sycl::buffer<half, 1> &b, int64_t ldb, int64_t stride_b,
+                float beta, cl::sycl::buffer<float, 1> &c, int64_t ldc, int64_t stride_c,
+                int64_t batch_size) {
+    auto a_fp16 = a.reinterpret<fp16, 1>(a.get_range());
+    auto b_fp16 = b.reinterpret<fp16, 1>(b.get_range());
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a_fp16.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b_fp16.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_gemm_f16f16f32_batch_stride>(cgh, [=]() {
+            const uint16_t *a_mat =
+                static_cast<const uint16_t *>(static_cast<void *>(a_acc.get_pointer()));
+            const uint16_t *b_mat =
+                static_cast<const uint16_t *>(static_cast<void *>(b_acc.get_pointer()));
+            hgemm_batch(transa, transb, m, n, k, alpha, a_mat, lda, stride_a, b_mat, ldb,
+                        stride_b, beta, c_acc.get_pointer(), ldc, stride_c, batch_size);
+        });
+    });
+}
+
+void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<int64_t, 1> &m,
+                cl::sycl::buffer<int64_t, 1> &n, cl::sycl::buffer<int64_t, 1> &k,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<int8_t, 1> &a,
+                cl::sycl::buffer<int64_t, 1> &lda, cl::sycl::buffer<int64_t, 1> &offset_a,
+                cl::sycl::buffer<uint8_t, 1> &b, cl::sycl::buffer<int64_t, 1> &ldb,
+                cl::sycl::buffer<int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+                cl::sycl::buffer<int32_t, 1> &c, cl::sycl::buffer<int64_t, 1> &ldc,
+                cl::sycl::buffer<int64_t, 1> &offset_c, int64_t group_count,
+                cl::sycl::buffer<int64_t, 1> &group_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto transa_acc     = transa.get_access<cl::sycl::access::mode::read>(cgh);
+        auto transb_acc     = transb.get_access<cl::sycl::access::mode::read>(cgh);
+        auto m_acc          = m.get_access<cl::sycl::access::mode::read>(cgh);
+        auto n_acc          = n.get_access<cl::sycl::access::mode::read>(cgh);
+        auto k_acc          = k.get_access<cl::sycl::access::mode::read>(cgh);
+        auto alpha_acc      = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc          = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto lda_acc        = lda.get_access<cl::sycl::access::mode::read>(cgh);
+        auto offset_a_acc   = offset_a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc          = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto ldb_acc        = ldb.get_access<cl::sycl::access::mode::read>(cgh);
+        auto offset_b_acc   = offset_b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto beta_acc       = beta.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc          = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto ldc_acc        = ldc.get_access<cl::sycl::access::mode::read>(cgh);
+        auto offset_c_acc   = offset_c.get_access<cl::sycl::access::mode::read>(cgh);
+        auto group_size_acc = group_size.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_gemm_s8u8s32_batch_offset>(cgh, [=]() {
+            gemm_s8u8s32_batch(group_count, transa_acc.get_pointer(), transb_acc.get_pointer(),
+                               m_acc.get_pointer(), n_acc.get_pointer(), k_acc.get_pointer(),
+                               alpha_acc.get_pointer(), a_acc.get_pointer(), lda_acc.get_pointer(),
+                               offset_a_acc.get_pointer(), b_acc.get_pointer(),
+                               ldb_acc.get_pointer(), offset_b_acc.get_pointer(),
+                               beta_acc.get_pointer(), c_acc.get_pointer(), ldc_acc.get_pointer(),
+                               offset_c_acc.get_pointer(), group_size_acc.get_pointer());
+        });
+    });
+}
+
+void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                int64_t k, float alpha, cl::sycl::buffer<int8_t, 1> &a, int64_t lda,
+                int64_t stride_a, cl::sycl::buffer<uint8_t, 1> &b, int64_t ldb, int64_t stride_b,
+                float beta, cl::sycl::buffer<int32_t, 1> &c, int64_t ldc, int64_t stride_c,
+                int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_gemm_s8u8s32_batch_stride>(cgh, [=]() {
+            gemm_s8u8s32_batch(transa, transb, m, n, k, alpha, a_acc.get_pointer(), lda, stride_a,
+                               b_acc.get_pointer(), ldb, stride_b, beta, c_acc.get_pointer(), ldc,
+                               stride_c, batch_size);
+        });
+    });
+}
+
+void omatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
+                    cl::sycl::buffer<float, 1> &a, int64_t lda, int64_t stride_a,
+                    cl::sycl::buffer<float, 1> &b, int64_t ldb, int64_t stride_b,
+                    int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_somatcopy_batch_stride>(cgh, [=]() {
+            xomatcopy_batch<float>(::mkl_somatcopy, trans, m, n, alpha, a_acc.get_pointer(), lda,
+                                   stride_a, b_acc.get_pointer(), ldb, stride_b, batch_size);
+        });
+    });
+}
+
+void omatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, double alpha,
+                    cl::sycl::buffer<double, 1> &a, int64_t lda, int64_t stride_a,
+                    cl::sycl::buffer<double, 1> &b, int64_t ldb, int64_t stride_b,
+                    int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_domatcopy_batch_stride>(cgh, [=]() {
+            xomatcopy_batch<double>(::mkl_domatcopy, trans, m, n, alpha, a_acc.get_pointer(), lda,
+                                    stride_a, b_acc.get_pointer(), ldb, stride_b, batch_size);
+        });
+    });
+}
+
+void omatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                    std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                    int64_t lda, int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                    int64_t ldb, int64_t stride_b, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_comatcopy_batch_stride>(cgh, [=]() {
+            xomatcopy_batch<std::complex<float>>(::mkl_comatcopy, trans, m, n, alpha,
+                                                 a_acc.get_pointer(), lda, stride_a,
+                                                 b_acc.get_pointer(), ldb, stride_b, batch_size);
+        });
+    });
+}
+
+void omatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                    std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                    int64_t lda, int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                    int64_t ldb, int64_t stride_b, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zomatcopy_batch_stride>(cgh, [=]() {
+            xomatcopy_batch<std::complex<double>>(::mkl_zomatcopy, trans, m, n, alpha,
+                                                  a_acc.get_pointer(), lda, stride_a,
+                                                  b_acc.get_pointer(), ldb, stride_b, batch_size);
+        });
+    });
+}
+
+void imatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
+                    cl::sycl::buffer<float, 1> &ab, int64_t lda, int64_t ldb, int64_t stride,
+                    int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto ab_acc = ab.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_simatcopy_batch_stride>(cgh, [=]() {
+            ximatcopy_batch<float>(::mkl_simatcopy, trans, m, n, alpha, ab_acc.get_pointer(), lda,
+                                   ldb, stride, batch_size);
+        });
+    });
+}
+
+void imatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, double alpha,
+                    cl::sycl::buffer<double, 1> &ab, int64_t lda, int64_t ldb, int64_t stride,
+                    int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto ab_acc = ab.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_dimatcopy_batch_stride>(cgh, [=]() {
+            ximatcopy_batch<double>(::mkl_dimatcopy, trans, m, n, alpha, ab_acc.get_pointer(), lda,
+                                    ldb, stride, batch_size);
+        });
+    });
+}
+
+void imatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                    std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &ab,
+                    int64_t lda, int64_t ldb, int64_t stride, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto ab_acc = ab.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_cimatcopy_batch_stride>(cgh, [=]() {
+            ximatcopy_batch<std::complex<float>>(::mkl_cimatcopy, trans, m, n, alpha,
+                                                 ab_acc.get_pointer(), lda, ldb, stride,
+                                                 batch_size);
+        });
+    });
+}
+
+void imatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                    std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &ab,
+                    int64_t lda, int64_t ldb, int64_t stride, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto ab_acc = ab.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zimatcopy_batch_stride>(cgh, [=]() {
+            ximatcopy_batch<std::complex<double>>(::mkl_zimatcopy, trans, m, n, alpha,
+                                                  ab_acc.get_pointer(), lda, ldb, stride,
+                                                  batch_size);
+        });
+    });
+}
+
+void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   float alpha, cl::sycl::buffer<float, 1> &a, int64_t lda, int64_t stride_a,
+                   float beta, cl::sycl::buffer<float, 1> &b, int64_t ldb, int64_t stride_b,
+                   cl::sycl::buffer<float, 1> &c, int64_t ldc, int64_t stride_c,
+                   int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_somatadd_batch_stride>(cgh, [=]() {
+            xomatadd_batch<float>(::mkl_somatadd, transa, transb, m, n, alpha, a_acc.get_pointer(),
+                                  lda, stride_a, beta, b_acc.get_pointer(), ldb, stride_b,
+                                  c_acc.get_pointer(), ldc, stride_c, batch_size);
+        });
+    });
+}
+
+void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   double alpha, cl::sycl::buffer<double, 1> &a, int64_t lda, int64_t stride_a,
+                   double beta, cl::sycl::buffer<double, 1> &b, int64_t ldb, int64_t stride_b,
+                   cl::sycl::buffer<double, 1> &c, int64_t ldc, int64_t stride_c,
+                   int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_domatadd_batch_stride>(cgh, [=]() {
+            xomatadd_batch<double>(::mkl_domatadd, transa, transb, m, n, alpha, a_acc.get_pointer(),
+                                   lda, stride_a, beta, b_acc.get_pointer(), ldb, stride_b,
+                                   c_acc.get_pointer(), ldc, stride_c, batch_size);
+        });
+    });
+}
+
+void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                   int64_t lda, int64_t stride_a, std::complex<float> beta,
+                   cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, int64_t stride_b,
+                   cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc, int64_t stride_c,
+                   int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_comatadd_batch_stride>(cgh, [=]() {
+            xomatadd_batch<std::complex<float>>(::mkl_comatadd, transa, transb, m, n, alpha,
+                                                a_acc.get_pointer(), lda, stride_a, beta,
+                                                b_acc.get_pointer(), ldb, stride_b,
+                                                c_acc.get_pointer(), ldc, stride_c, batch_size);
+        });
+    });
+}
+
+void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                   int64_t lda, int64_t stride_a, std::complex<double> beta,
+                   cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, int64_t stride_b,
+                   cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc, int64_t stride_c,
+                   int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zomatadd_batch_stride>(cgh, [=]() {
+            xomatadd_batch<std::complex<double>>(::mkl_zomatadd, transa, transb, m, n, alpha,
+                                                 a_acc.get_pointer(), lda, stride_a, beta,
+                                                 b_acc.get_pointer(), ldb, stride_b,
+                                                 c_acc.get_pointer(), ldc, stride_c, batch_size);
+        });
+    });
+}
+
+void trttp_batch(cl::sycl::queue &queue, uplo upper_lower, int64_t n, cl::sycl::buffer<float, 1> &a,
+                 int64_t lda, int64_t stride_a, cl::sycl::buffer<float, 1> &ap, int64_t stride_ap,
+                 int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc  = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto ap_acc = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_strttp_batch_stride>(cgh, [=]() {
+            xtrttp_batch<float>(upper_lower, n, a_acc.get_pointer(), lda, stride_a,
+                                ap_acc.get_pointer(), stride_ap, batch_size);
+        });
+    });
+}
+
+void trttp_batch(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
+                 cl::sycl::buffer<double, 1> &a, int64_t lda, int64_t stride_a,
+                 cl::sycl::buffer<double, 1> &ap, int64_t stride_ap, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc  = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto ap_acc = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_dtrttp_batch_stride>(cgh, [=]() {
+            xtrttp_batch<double>(upper_lower, n, a_acc.get_pointer(), lda, stride_a,
+                                 ap_acc.get_pointer(), stride_ap, batch_size);
+        });
+    });
+}
+
+void trttp_batch(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
+                 cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda, int64_t stride_a,
+                 cl::sycl::buffer<std::complex<float>, 1> &ap, int64_t stride_ap,
+                 int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc  = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto ap_acc = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_ctrttp_batch_stride>(cgh, [=]() {
+            xtrttp_batch<std::complex<float>>(upper_lower, n, a_acc.get_pointer(), lda, stride_a,
+                                              ap_acc.get_pointer(), stride_ap, batch_size);
+        });
+    });
+}
+
+void trttp_batch(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
+                 cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda, int64_t stride_a,
+                 cl::sycl::buffer<std::complex<double>, 1> &ap, int64_t stride_ap,
+                 int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc  = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto ap_acc = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_ztrttp_batch_stride>(cgh, [=]() {
+            xtrttp_batch<std::complex<double>>(upper_lower, n, a_acc.get_pointer(), lda, stride_a,
+                                               ap_acc.get_pointer(), stride_ap, batch_size);
+        });
+    });
+}
+
+void tpttr_batch(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
+                 cl::sycl::buffer<float, 1> &ap, int64_t stride_ap, cl::sycl::buffer<float, 1> &a,
+                 int64_t lda, int64_t stride_a, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto ap_acc = ap.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc  = a.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_stpttr_batch_stride>(cgh, [=]() {
+            xtpttr_batch<float>(upper_lower, n, ap_acc.get_pointer(), stride_ap,
+                                a_acc.get_pointer(), lda, stride_a, batch_size);
+        });
+    });
+}
+
+void tpttr_batch(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
+                 cl::sycl::buffer<double, 1> &ap, int64_t stride_ap, cl::sycl::buffer<double, 1> &a,
+                 int64_t lda, int64_t stride_a, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto ap_acc = ap.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc  = a.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_dtpttr_batch_stride>(cgh, [=]() {
+            xtpttr_batch<double>(upper_lower, n, ap_acc.get_pointer(), stride_ap,
+                                 a_acc.get_pointer(), lda, stride_a, batch_size);
+        });
+    });
+}
+
+void tpttr_batch(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
+                 cl::sycl::buffer<std::complex<float>, 1> &ap, int64_t stride_ap,
+                 cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda, int64_t stride_a,
+                 int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto ap_acc = ap.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc  = a.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_ctpttr_batch_stride>(cgh, [=]() {
+            xtpttr_batch<std::complex<float>>(upper_lower, n, ap_acc.get_pointer(), stride_ap,
+                                              a_acc.get_pointer(), lda, stride_a, batch_size);
+        });
+    });
+}
+
+void tpttr_batch(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
+                 cl::sycl::buffer<std::complex<double>, 1> &ap, int64_t stride_ap,
+                 cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda, int64_t stride_a,
+                 int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto ap_acc = ap.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc  = a.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_ztpttr_batch_stride>(cgh, [=]() {
+            xtpttr_batch<std::complex<double>>(upper_lower, n, ap_acc.get_pointer(), stride_ap,
+                                               a_acc.get_pointer(), lda, stride_a, batch_size);
+        });
+    });
+}
+
+void gettgb_batch(cl::sycl::queue &queue, int64_t m, int64_t n, int64_t kl, int64_t ku,
+                  cl::sycl::buffer<float, 1> &a, int64_t lda, int64_t stride_a,
+                  cl::sycl::buffer<float, 1> &ab, int64_t ldab, int64_t stride_ab,
+                  int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc  = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto ab_acc = ab.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_sgettgb_batch_stride>(cgh, [=]() {
+            xgettgb_batch<float>(m, n, kl, ku, a_acc.get_pointer(), lda, stride_a,
+                                 ab_acc.get_pointer(), ldab, stride_ab, batch_size);
+        });
+    });
+}
+
+void gettgb_batch(cl::sycl::queue &queue, int64_t m, int64_t n, int64_t kl, int64_t ku,
+                  cl::sycl::buffer<double, 1> &a, int64_t lda, int64_t stride_a,
+                  cl::sycl::buffer<double, 1> &ab, int64_t ldab, int64_t stride_ab,
+                  int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc  = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto ab_acc = ab.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_dgettgb_batch_stride>(cgh, [=]() {
+            xgettgb_batch<double>(m, n, kl, ku, a_acc.get_pointer(), lda, stride_a,
+                                  ab_acc.get_pointer(), ldab, stride_ab, batch_size);
+        });
+    });
+}
+
+void gettgb_batch(cl::sycl::queue &queue, int64_t m, int64_t n, int64_t kl, int64_t ku,
+                  cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda, int64_t stride_a,
+                  cl::sycl::buffer<std::complex<float>, 1> &ab, int64_t ldab, int64_t stride_ab,
+                  int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc  = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto ab_acc = ab.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_cgettgb_batch_stride>(cgh, [=]() {
+            xgettgb_batch<std::complex<float>>(m, n, kl, ku, a_acc.get_pointer(), lda, stride_a,
+                                               ab_acc.get_pointer(), ldab, stride_ab, batch_size);
+        });
+    });
+}
+
+void gettgb_batch(cl::sycl::queue &queue, int64_t m, int64_t n, int64_t kl, int64_t ku,
+                  cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda, int64_t stride_a,
+                  cl::sycl::buffer<std::complex<double>, 1> &ab, int64_t ldab, int64_t stride_ab,
+                  int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc  = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto ab_acc = ab.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zgettgb_batch_stride>(cgh, [=]() {
+            xgettgb_batch<std::complex<double>>(m, n, kl, ku, a_acc.get_pointer(), lda, stride_a,
+                                                ab_acc.get_pointer(), ldab, stride_ab, batch_size);
+        });
+    });
+}
+
+void gbtge_batch(cl::sycl::queue &queue, int64_t m, int64_t n, int64_t kl, int64_t ku,
+                 cl::sycl::buffer<float, 1> &ab, int64_t ldab, int64_t stride_ab,
+                 cl::sycl::buffer<float, 1> &a, int64_t lda, int64_t stride_a, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto ab_acc = ab.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc  = a.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_sgbtge_batch_stride>(cgh, [=]() {
+            xgbtge_batch<float>(m, n, kl, ku, ab_acc.get_pointer(), ldab, stride_ab,
+                                a_acc.get_pointer(), lda, stride_a, batch_size);
+        });
+    });
+}
+
+void gbtge_batch(cl::sycl::queue &queue, int64_t m, int64_t n, int64_t kl, int64_t ku,
+                 cl::sycl::buffer<double, 1> &ab, int64_t ldab, int64_t stride_ab,
+                 cl::sycl::buffer<double, 1> &a, int64_t lda, int64_t stride_a,
+                 int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto ab_acc = ab.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc  = a.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_dgbtge_batch_stride>(cgh, [=]() {
+            xgbtge_batch<double>(m, n, kl, ku, ab_acc.get_pointer(), ldab, stride_ab,
+                                 a_acc.get_pointer(), lda, stride_a, batch_size);
+        });
+    });
+}
+
+void gbtge_batch(cl::sycl::queue &queue, int64_t m, int64_t n, int64_t kl, int64_t ku,
+                 cl::sycl::buffer<std::complex<float>, 1> &ab, int64_t ldab, int64_t stride_ab,
+                 cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda, int64_t stride_a,
+                 int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto ab_acc = ab.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc  = a.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_cgbtge_batch_stride>(cgh, [=]() {
+            xgbtge_batch<std::complex<float>>(m, n, kl, ku, ab_acc.get_pointer(), ldab, stride_ab,
+                                              a_acc.get_pointer(), lda, stride_a, batch_size);
+        });
+    });
+}
+
+void gbtge_batch(cl::sycl::queue &queue, int64_t m, int64_t n, int64_t kl, int64_t ku,
+                 cl::sycl::buffer<std::complex<double>, 1> &ab, int64_t ldab, int64_t stride_ab,
+                 cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda, int64_t stride_a,
+                 int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto ab_acc = ab.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc  = a.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zgbtge_batch_stride>(cgh, [=]() {
+            xgbtge_batch<std::complex<double>>(m, n, kl, ku, ab_acc.get_pointer(), ldab, stride_ab,
+                                               a_acc.get_pointer(), lda, stride_a, batch_size);
+        });
+    });
+}
+
+void omatmul_batch(cl::sycl::queue &queue, int64_t m, int64_t n, cl::sycl::buffer<float, 1> &a,
+                   int64_t lda, int64_t stride_a, cl::sycl::buffer<float, 1> &b, int64_t ldb,
+                   int64_t stride_b, cl::sycl::buffer<float, 1> &c, int64_t ldc, int64_t stride_c,
+                   int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_somatmul_batch_stride>(cgh, [=]() {
+            elementwise<float>(m, n, a_acc.get_pointer(), 1, lda, stride_a, b_acc.get_pointer(), 1,
+                               ldb, stride_b, c_acc.get_pointer(), 1, ldc, stride_c, batch_size,
+                               mul_op<float>{});
+        });
+    });
+}
+
+void omatmul_batch(cl::sycl::queue &queue, int64_t m, int64_t n, cl::sycl::buffer<double, 1> &a,
+                   int64_t lda, int64_t stride_a, cl::sycl::buffer<double, 1> &b, int64_t ldb,
+                   int64_t stride_b, cl::sycl::buffer<double, 1> &c, int64_t ldc, int64_t stride_c,
+                   int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_domatmul_batch_stride>(cgh, [=]() {
+            elementwise<double>(m, n, a_acc.get_pointer(), 1, lda, stride_a, b_acc.get_pointer(), 1,
+                                ldb, stride_b, c_acc.get_pointer(), 1, ldc, stride_c, batch_size,
+                                mul_op<double>{});
+        });
+    });
+}
+
+void omatmul_batch(cl::sycl::queue &queue, int64_t m, int64_t n,
+                   cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda, int64_t stride_a,
+                   cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, int64_t stride_b,
+                   cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc, int64_t stride_c,
+                   int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_comatmul_batch_stride>(cgh, [=]() {
+            elementwise<std::complex<float>>(m, n, a_acc.get_pointer(), 1, lda, stride_a,
+                                             b_acc.get_pointer(), 1, ldb, stride_b,
+                                             c_acc.get_pointer(), 1, ldc, stride_c, batch_size,
+                                             mul_op<std::complex<float>>{});
+        });
+    });
+}
+
+void omatmul_batch(cl::sycl::queue &queue, int64_t m, int64_t n,
+                   cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda, int64_t stride_a,
+                   cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, int64_t stride_b,
+                   cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc, int64_t stride_c,
+                   int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zomatmul_batch_stride>(cgh, [=]() {
+            elementwise<std::complex<double>>(m, n, a_acc.get_pointer(), 1, lda, stride_a,
+                                              b_acc.get_pointer(), 1, ldb, stride_b,
+                                              c_acc.get_pointer(), 1, ldc, stride_c, batch_size,
+                                              mul_op<std::complex<double>>{});
+        });
+    });
+}
+
+void omatdiv_batch(cl::sycl::queue &queue, int64_t m, int64_t n, cl::sycl::buffer<float, 1> &a,
+                   int64_t lda, int64_t stride_a, cl::sycl::buffer<float, 1> &b, int64_t ldb,
+                   int64_t stride_b, cl::sycl::buffer<float, 1> &c, int64_t ldc, int64_t stride_c,
+                   int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_somatdiv_batch_stride>(cgh, [=]() {
+            elementwise<float>(m, n, a_acc.get_pointer(), 1, lda, stride_a, b_acc.get_pointer(), 1,
+                               ldb, stride_b, c_acc.get_pointer(), 1, ldc, stride_c, batch_size,
+                               div_op<float>{});
+        });
+    });
+}
+
+void omatdiv_batch(cl::sycl::queue &queue, int64_t m, int64_t n, cl::sycl::buffer<double, 1> &a,
+                   int64_t lda, int64_t stride_a, cl::sycl::buffer<double, 1> &b, int64_t ldb,
+                   int64_t stride_b, cl::sycl::buffer<double, 1> &c, int64_t ldc, int64_t stride_c,
+                   int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_domatdiv_batch_stride>(cgh, [=]() {
+            elementwise<double>(m, n, a_acc.get_pointer(), 1, lda, stride_a, b_acc.get_pointer(), 1,
+                                ldb, stride_b, c_acc.get_pointer(), 1, ldc, stride_c, batch_size,
+                                div_op<double>{});
+        });
+    });
+}
+
+void omatdiv_batch(cl::sycl::queue &queue, int64_t m, int64_t n,
+                   cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda, int64_t stride_a,
+                   cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, int64_t stride_b,
+                   cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc, int64_t stride_c,
+                   int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_comatdiv_batch_stride>(cgh, [=]() {
+            elementwise<std::complex<float>>(m, n, a_acc.get_pointer(), 1, lda, stride_a,
+                                             b_acc.get_pointer(), 1, ldb, stride_b,
+                                             c_acc.get_pointer(), 1, ldc, stride_c, batch_size,
+                                             div_op<std::complex<float>>{});
+        });
+    });
+}
+
+void omatdiv_batch(cl::sycl::queue &queue, int64_t m, int64_t n,
+                   cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda, int64_t stride_a,
+                   cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, int64_t stride_b,
+                   cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc, int64_t stride_c,
+                   int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zomatdiv_batch_stride>(cgh, [=]() {
+            elementwise<std::complex<double>>(m, n, a_acc.get_pointer(), 1, lda, stride_a,
+                                              b_acc.get_pointer(), 1, ldb, stride_b,
+                                              c_acc.get_pointer(), 1, ldc, stride_c, batch_size,
+                                              div_op<std::complex<double>>{});
+        });
+    });
+}
+
+void omatfma_batch(cl::sycl::queue &queue, int64_t m, int64_t n, float alpha,
+                   cl::sycl::buffer<float, 1> &a, int64_t lda, int64_t stride_a,
+                   cl::sycl::buffer<float, 1> &b, int64_t ldb, int64_t stride_b, float beta,
+                   cl::sycl::buffer<float, 1> &c, int64_t ldc, int64_t stride_c,
+                   int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_somatfma_batch_stride>(cgh, [=]() {
+            elementwise<float>(m, n, a_acc.get_pointer(), 1, lda, stride_a, b_acc.get_pointer(), 1,
+                               ldb, stride_b, c_acc.get_pointer(), 1, ldc, stride_c, batch_size,
+                               fma_op<float>{ alpha, beta });
+        });
+    });
+}
+
+void omatfma_batch(cl::sycl::queue &queue, int64_t m, int64_t n, double alpha,
+                   cl::sycl::buffer<double, 1> &a, int64_t lda, int64_t stride_a,
+                   cl::sycl::buffer<double, 1> &b, int64_t ldb, int64_t stride_b, double beta,
+                   cl::sycl::buffer<double, 1> &c, int64_t ldc, int64_t stride_c,
+                   int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_domatfma_batch_stride>(cgh, [=]() {
+            elementwise<double>(m, n, a_acc.get_pointer(), 1, lda, stride_a, b_acc.get_pointer(), 1,
+                                ldb, stride_b, c_acc.get_pointer(), 1, ldc, stride_c, batch_size,
+                                fma_op<double>{ alpha, beta });
+        });
+    });
+}
+
+void omatfma_batch(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<float> alpha,
+                   cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda, int64_t stride_a,
+                   cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, int64_t stride_b,
+                   std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+                   int64_t ldc, int64_t stride_c, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_comatfma_batch_stride>(cgh, [=]() {
+            elementwise<std::complex<float>>(m, n, a_acc.get_pointer(), 1, lda, stride_a,
+                                             b_acc.get_pointer(), 1, ldb, stride_b,
+                                             c_acc.get_pointer(), 1, ldc, stride_c, batch_size,
+                                             fma_op<std::complex<float>>{ alpha, beta });
+        });
+    });
+}
+
+void omatfma_batch(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<double> alpha,
+                   cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda, int64_t stride_a,
+                   cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, int64_t stride_b,
+                   std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+                   int64_t ldc, int64_t stride_c, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zomatfma_batch_stride>(cgh, [=]() {
+            elementwise<std::complex<double>>(m, n, a_acc.get_pointer(), 1, lda, stride_a,
+                                              b_acc.get_pointer(), 1, ldb, stride_b,
+                                              c_acc.get_pointer(), 1, ldc, stride_c, batch_size,
+                                              fma_op<std::complex<double>>{ alpha, beta });
+        });
+    });
+}
+
+void omatclamp_batch(cl::sycl::queue &queue, int64_t m, int64_t n, float lo, float hi,
+                     cl::sycl::buffer<float, 1> &a, int64_t lda, int64_t stride_a,
+                     cl::sycl::buffer<float, 1> &b, int64_t ldb, int64_t stride_b,
+                     int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_somatclamp_batch_stride>(cgh, [=]() {
+            elementwise<float>(m, n, a_acc.get_pointer(), 1, lda, stride_a, a_acc.get_pointer(), 1,
+                               lda, stride_a, b_acc.get_pointer(), 1, ldb, stride_b, batch_size,
+                               clamp_op<float>{ lo, hi });
+        });
+    });
+}
+
+void omatclamp_batch(cl::sycl::queue &queue, int64_t m, int64_t n, double lo, double hi,
+                     cl::sycl::buffer<double, 1> &a, int64_t lda, int64_t stride_a,
+                     cl::sycl::buffer<double, 1> &b, int64_t ldb, int64_t stride_b,
+                     int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_domatclamp_batch_stride>(cgh, [=]() {
+            elementwise<double>(m, n, a_acc.get_pointer(), 1, lda, stride_a, a_acc.get_pointer(), 1,
+                                lda, stride_a, b_acc.get_pointer(), 1, ldb, stride_b, batch_size,
+                                clamp_op<double>{ lo, hi });
+        });
+    });
+}
+
 } // namespace mklcpu
 } // namespace onemkl
@@ -0,0 +1,155 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_CPU_BATCH_CACHE_HPP_
+#define _MKL_CPU_BATCH_CACHE_HPP_
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "cpu_batch_schedule.hpp"
+#include "cpu_common.hpp"
+
+namespace onemkl {
+namespace mklcpu {
+
+// Arguments of a grouped gemm_batch call in the form ?gemm_batch takes them.
+//  The matrices of all groups are stored back to back starting at a_base,
+//  b_base and c_base, so the pointer arrays only depend on those and on the
+//  group configuration. The size-bucketing schedule is built along with
+//  them.
+template <typename T>
+struct gemm_batch_descriptor {
+    const T *a_base;
+    const T *b_base;
+    T *c_base;
+    std::vector<char> transa, transb;
+    std::vector<MKL_INT> m, n, k, lda, ldb, ldc, group_size;
+    std::vector<const T *> a_array, b_array;
+    std::vector<T *> c_array;
+    gemm_batch_schedule schedule;
+
+    bool matches(int64_t group_count, const transpose *transa_, const transpose *transb_,
+                 const int64_t *m_, const int64_t *n_, const int64_t *k_, const int64_t *lda_,
+                 const int64_t *ldb_, const int64_t *ldc_, const int64_t *group_size_,
+                 const T *a, const T *b, T *c) const {
+        if (a != a_base || b != b_base || c != c_base || int64_t(m.size()) != group_count)
+            return false;
+        for (int64_t i = 0; i < group_count; i++) {
+            if (transa[i] != *fortran_char(transa_[i]) ||
+                transb[i] != *fortran_char(transb_[i]) || m[i] != m_[i] || n[i] != n_[i] ||
+                k[i] != k_[i] || lda[i] != lda_[i] || ldb[i] != ldb_[i] || ldc[i] != ldc_[i] ||
+                group_size[i] != group_size_[i])
+                return false;
+        }
+        return true;
+    }
+};
+
+// Training and inference loops issue the same grouped batch on the same
+//  buffers over and over, so the converted descriptors of the most recent
+//  calls are kept and handed out again instead of being rebuilt. Descriptors
+//  are immutable once built and shared, so concurrent host tasks may use the
+//  same one. A descriptor is a pure function of its key, so an entry whose
+//  buffers have been freed is harmless: it is only returned again for
+//  identical arguments.
+template <typename T>
+class gemm_batch_cache {
+public:
+    static constexpr std::size_t capacity = 16;
+
+    static std::shared_ptr<const gemm_batch_descriptor<T>> get(
+        int64_t group_count, const transpose *transa, const transpose *transb, const int64_t *m,
+        const int64_t *n, const int64_t *k, const int64_t *lda, const int64_t *ldb,
+        const int64_t *ldc, const int64_t *group_size, const T *a, const T *b, T *c) {
+        static std::mutex mutex;
+        static std::list<std::shared_ptr<const gemm_batch_descriptor<T>>> entries;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (auto it = entries.begin(); it != entries.end(); ++it) {
+                if ((*it)->matches(group_count, transa, transb, m, n, k, lda, ldb, ldc,
+                                   group_size, a, b, c)) {
+                    // Most recently used entries are kept at the front.
+                    entries.splice(entries.begin(), entries, it);
+                    return entries.front();
+                }
+            }
+        }
+
+        auto entry = build(group_count, transa, transb, m, n, k, lda, ldb, ldc, group_size, a, b,
+                           c);
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.push_front(entry);
+        if (entries.size() > capacity)
+            entries.pop_back();
+        return entry;
+    }
+
+private:
+    static std::shared_ptr<const gemm_batch_descriptor<T>> build(
+        int64_t group_count, const transpose *transa, const transpose *transb, const int64_t *m,
+        const int64_t *n, const int64_t *k, const int64_t *lda, const int64_t *ldb,
+        const int64_t *ldc, const int64_t *group_size, const T *a, const T *b, T *c) {
+        auto d    = std::make_shared<gemm_batch_descriptor<T>>();
+        d->a_base = a;
+        d->b_base = b;
+        d->c_base = c;
+        d->transa.resize(group_count);
+        d->transb.resize(group_count);
+        d->m.assign(m, m + group_count);
+        d->n.assign(n, n + group_count);
+        d->k.assign(k, k + group_count);
+        d->lda.assign(lda, lda + group_count);
+        d->ldb.assign(ldb, ldb + group_count);
+        d->ldc.assign(ldc, ldc + group_count);
+        d->group_size.assign(group_size, group_size + group_count);
+
+        int64_t total_size = 0;
+        for (int64_t i = 0; i < group_count; i++)
+            total_size += group_size[i];
+        d->a_array.reserve(total_size);
+        d->b_array.reserve(total_size);
+        d->c_array.reserve(total_size);
+
+        int64_t offset_a = 0, offset_b = 0, offset_c = 0;
+        for (int64_t i = 0; i < group_count; i++) {
+            d->transa[i] = *fortran_char(transa[i]);
+            d->transb[i] = *fortran_char(transb[i]);
+            for (int64_t j = 0; j < group_size[i]; j++) {
+                d->a_array.push_back(a + offset_a);
+                d->b_array.push_back(b + offset_b);
+                d->c_array.push_back(c + offset_c);
+                offset_a += (transa[i] == transpose::nontrans) ? lda[i] * k[i] : lda[i] * m[i];
+                offset_b += (transb[i] == transpose::nontrans) ? ldb[i] * n[i] : ldb[i] * k[i];
+                offset_c += ldc[i] * n[i];
+            }
+        }
+        d->schedule = gemm_batch_schedule(group_count, m, n, k, group_size);
+        return d;
+    }
+};
+
+} // namespace mklcpu
+} // namespace onemkl
+
+#endif //_MKL_CPU_BATCH_CACHE_HPP_
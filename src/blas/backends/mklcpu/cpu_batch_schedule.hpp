@@ -0,0 +1,126 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_CPU_BATCH_SCHEDULE_HPP_
+#define _MKL_CPU_BATCH_SCHEDULE_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "cpu_common.hpp"
+
+namespace onemkl {
+namespace mklcpu {
+
+// Size-bucketing schedule of a grouped gemm_batch.
+//  When shapes vary a lot, one ?gemm_batch call balances poorly: the few
+//  large products finish last while most threads idle. The problems are
+//  therefore split by their number of multiply-adds. Large ones run one
+//  after the other with multithreaded MKL, while the small ones are handed
+//  out in chunks to the remaining threads, each running MKL single threaded.
+//  The mkl_get_max_threads() threads are split in proportion to the work of
+//  each bucket, the small one running on the shared thread_pool, and the
+//  thread running the large bucket joins the small one once it is done.
+class gemm_batch_schedule {
+public:
+    // Products of at least this many multiply-adds scale with MKL threading.
+    static constexpr double large_work = batch_large_work;
+
+    gemm_batch_schedule() = default;
+
+    gemm_batch_schedule(int64_t group_count, const int64_t *m, const int64_t *n,
+                        const int64_t *k, const int64_t *group_size) {
+        std::vector<double> work;
+        for (int64_t i = 0; i < group_count; i++) {
+            const double w   = double(m[i]) * n[i] * k[i];
+            const bool large = (w >= large_work);
+            for (int64_t j = 0; j < group_size[i]; j++) {
+                (large ? large_ : small_).push_back(int64_t(group_.size()));
+                (large ? large_work_ : small_work_) += w;
+                group_.push_back(i);
+                work.push_back(w);
+            }
+        }
+
+        // Costliest problems first in both buckets, so that the tail of the
+        //  schedule is made of the cheapest ones.
+        auto by_work = [&](int64_t a, int64_t b) { return work[a] > work[b]; };
+        std::stable_sort(large_.begin(), large_.end(), by_work);
+        std::stable_sort(small_.begin(), small_.end(), by_work);
+
+        // Each chunk of small problems is about 2^18 multiply-adds.
+        if (!small_.empty())
+            chunk_ = std::max<int64_t>(
+                int64_t((1 << 18) * small_.size() / std::max(small_work_, 1.0)), 1);
+    }
+
+    // Whether the batch mixes large and small problems. Otherwise a single
+    //  ?gemm_batch call already balances it.
+    bool bucketed() const {
+        return !large_.empty() && !small_.empty() && mkl_get_max_threads() > 1;
+    }
+
+    // Calls f(idx, i) for every problem, idx being its position in the batch
+    //  and i its group.
+    template <typename F>
+    void run(F f) const {
+        const int64_t nthreads      = std::max<int64_t>(mkl_get_max_threads(), 2);
+        const int64_t large_threads = std::min<int64_t>(
+            std::max<int64_t>(std::llround(nthreads * large_work_ / (large_work_ + small_work_)),
+                              1),
+            nthreads - 1);
+
+        // The first thread of the pool job takes the large bucket, so that it
+        //  runs even when no worker is free, and every thread ends on the
+        //  small one.
+        const int64_t small_count = small_.size();
+        std::atomic<bool> large_taken(false);
+        std::atomic<int64_t> next(0);
+        thread_pool::instance().run(nthreads - large_threads, [&]() {
+            if (!large_taken.exchange(true)) {
+                int nthreads_mkl = mkl_set_num_threads_local(int(large_threads));
+                for (int64_t idx : large_)
+                    f(idx, group_[idx]);
+                mkl_set_num_threads_local(nthreads_mkl);
+            }
+            int nthreads_mkl = mkl_set_num_threads_local(1);
+            for (int64_t begin = next.fetch_add(chunk_); begin < small_count;
+                 begin         = next.fetch_add(chunk_)) {
+                const int64_t end = std::min(begin + chunk_, small_count);
+                for (int64_t s = begin; s < end; s++)
+                    f(small_[s], group_[small_[s]]);
+            }
+            mkl_set_num_threads_local(nthreads_mkl);
+        });
+    }
+
+private:
+    std::vector<int64_t> group_;
+    std::vector<int64_t> large_, small_;
+    double large_work_ = 0.0, small_work_ = 0.0;
+    int64_t chunk_     = 1;
+};
+
+} // namespace mklcpu
+} // namespace onemkl
+
+#endif //_MKL_CPU_BATCH_SCHEDULE_HPP_
@@ -24,10 +24,20 @@
 #define MKL_Complex16 std::complex<double>
 
 #include <CL/sycl.hpp>
+#include <algorithm>
+#include <atomic>
 #include <complex>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "mkl_blas.h"
 #include "mkl_cblas.h"
+#include "mkl_service.h"
+#include "mkl_trans.h"
 
 #include "onemkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
 #include "onemkl/types.hpp"
@@ -52,6 +62,138 @@ static inline void host_task(H &cgh, F f) {
     (void)host_task_internal<K>(cgh, f, 0);
 }
 
+// Worker threads shared by every parallel_for, started on first use, so that
+//  no thread is created per call and concurrent host tasks share the same
+//  workers instead of oversubscribing the machine. The thread posting a job
+//  runs it too and withdraws the postings no worker has picked up once it is
+//  done, so nested and concurrent jobs always complete.
+class thread_pool {
+public:
+    static thread_pool &instance() {
+        static thread_pool pool;
+        return pool;
+    }
+
+    // Runs f on the calling thread and on up to helpers workers. f is
+    //  expected to share its work out between the threads running it.
+    void run(int64_t helpers, const std::function<void()> &f) {
+        job j(f);
+        helpers = std::min<int64_t>(helpers, workers_.size());
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queue_.insert(queue_.end(), helpers, &j);
+        }
+        for (int64_t i = 0; i < helpers; i++)
+            ready_.notify_one();
+        f();
+        std::unique_lock<std::mutex> lock(mutex_);
+        queue_.erase(std::remove(queue_.begin(), queue_.end(), &j), queue_.end());
+        done_.wait(lock, [&]() {
+            return j.running == 0;
+        });
+    }
+
+    ~thread_pool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        ready_.notify_all();
+        for (auto &t : workers_)
+            t.join();
+    }
+
+private:
+    struct job {
+        explicit job(const std::function<void()> &f) : f(f) {}
+        const std::function<void()> &f;
+        int64_t running = 0;
+    };
+
+    thread_pool() {
+        const int64_t nworkers = std::max<int64_t>(std::thread::hardware_concurrency(), 1) - 1;
+        for (int64_t i = 0; i < nworkers; i++)
+            workers_.emplace_back([this]() {
+                work();
+            });
+    }
+
+    void work() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            ready_.wait(lock, [this]() {
+                return stop_ || !queue_.empty();
+            });
+            if (stop_)
+                return;
+            job *j = queue_.front();
+            queue_.pop_front();
+            j->running++;
+            lock.unlock();
+            j->f();
+            lock.lock();
+            if (--j->running == 0)
+                done_.notify_all();
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::deque<job *> queue_;
+    std::mutex mutex_;
+    std::condition_variable ready_, done_;
+    bool stop_ = false;
+};
+
+// parallel_for splits [0, n) into contiguous chunks of at least grain
+//  elements and calls f(begin, end) on each of them, on up to
+//  mkl_get_max_threads() threads of the shared pool including the calling
+//  one. This follows MKL_NUM_THREADS and the MKL threading layer, and runs
+//  sequentially wherever MKL is set to a single thread.
+template <typename F>
+static inline void parallel_for(int64_t n, int64_t grain, F f) {
+    int64_t nthreads = std::max<int64_t>(mkl_get_max_threads(), 1);
+    nthreads         = std::min(nthreads, (n + grain - 1) / grain);
+    if (nthreads <= 1) {
+        if (n > 0)
+            f(int64_t(0), n);
+        return;
+    }
+    const int64_t chunk = (n + nthreads - 1) / nthreads;
+    std::atomic<int64_t> next(0);
+    thread_pool::instance().run(nthreads - 1, [&]() {
+        for (int64_t begin = next.fetch_add(chunk); begin < n; begin = next.fetch_add(chunk))
+            f(begin, std::min(begin + chunk, n));
+    });
+}
+
+// Problems of at least this many multiply-adds scale with MKL threading.
+static constexpr double batch_large_work = double(1 << 21);
+
+// batch_parallel_for runs f(begin, end) on chunks of a batch of independent
+//  problems, work being the average number of multiply-adds of one of them.
+//  Large problems run one after the other as a single chunk with MKL keeping
+//  all of its threads. Otherwise the batch is split across threads, one
+//  problem per chunk when the batch is shorter than the thread count, and MKL
+//  runs single threaded inside each chunk, which parallel_for nested in f
+//  follows as well.
+template <typename F>
+static inline void batch_parallel_for(int64_t batch_size, double work, F f) {
+    if (work >= batch_large_work) {
+        if (batch_size > 0)
+            f(int64_t(0), batch_size);
+        return;
+    }
+    const int64_t nthreads = std::max<int64_t>(mkl_get_max_threads(), 1);
+    int64_t grain          = std::max<int64_t>(int64_t((1 << 20) / std::max(work, 1.0)), 1);
+    if (batch_size < nthreads)
+        grain = 1;
+    parallel_for(batch_size, grain, [=](int64_t begin, int64_t end) {
+        int nthreads = mkl_set_num_threads_local(1);
+        f(begin, end);
+        mkl_set_num_threads_local(nthreads);
+    });
+}
+
 // Conversion functions to traditional Fortran characters.
 inline const char *fortran_char(transpose t) {
     if (t == transpose::nontrans)
@@ -73,6 +215,14 @@ inline const char *fortran_char(offset t) {
     return "N";
 }
 
+inline const char *fortran_char(identifier i) {
+    if (i == identifier::a)
+        return "A";
+    if (i == identifier::b)
+        return "B";
+    return "A";
+}
+
 inline const char *fortran_char(uplo u) {
     if (u == uplo::upper)
         return "U";
@@ -0,0 +1,350 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+
+#include "cpu_common.hpp"
+
+namespace onemkl {
+namespace mklcpu {
+
+// Kernels on the compact batch layout described with compact_width in
+//  types.hpp. They work on one pack of w matrices at a time, the innermost
+//  loop running over the w interleaved matrices so that it maps to a single
+//  vector operation. For matrices this small, doing so removes the per-matrix
+//  call and loop overhead that dominates a regular batched call.
+
+// Runs f(p) on every pack of a batch, work being the number of multiply-adds
+//  of one of its matrices.
+template <typename T, typename F>
+static inline void for_each_pack(int64_t batch_size, double work, F f) {
+    constexpr int64_t w  = compact_width<T>();
+    const int64_t npacks = (batch_size + w - 1) / w;
+    const int64_t grain  = std::max<int64_t>(int64_t((1 << 20) / std::max(work * w, 1.0)), 1);
+    parallel_for(npacks, grain, [=](int64_t begin, int64_t end) {
+        for (int64_t p = begin; p < end; p++)
+            f(p);
+    });
+}
+
+// Lanes of element (i, j) of op(M), M being a pack with leading dimension ld.
+template <typename T>
+static inline const T *op_lanes(const T *m, transpose trans, int64_t ld, int64_t i, int64_t j) {
+    constexpr int64_t w = compact_width<T>();
+    return (trans == transpose::nontrans) ? m + (i + ld * j) * w : m + (j + ld * i) * w;
+}
+
+// Interleaves a strided batch into packs. The lanes past the end of the batch
+//  repeat its last matrix, so that kernels never divide by zero there.
+template <typename T>
+static inline void compact_pack(int64_t rows, int64_t cols, const T *a, int64_t lda,
+                                int64_t stride_a, T *ap, int64_t ldap, int64_t batch_size) {
+    constexpr int64_t w = compact_width<T>();
+    for_each_pack<T>(batch_size, double(rows) * cols, [=](int64_t p) {
+        const T *mat[w];
+        for (int64_t l = 0; l < w; l++)
+            mat[l] = a + stride_a * std::min(p * w + l, batch_size - 1);
+        T *pack = ap + p * ldap * cols * w;
+        for (int64_t j = 0; j < cols; j++) {
+            for (int64_t i = 0; i < rows; i++) {
+                T *dest = pack + (i + ldap * j) * w;
+                for (int64_t l = 0; l < w; l++)
+                    dest[l] = mat[l][i + lda * j];
+            }
+        }
+    });
+}
+
+// Writes the packs of a compact batch back to a strided batch.
+template <typename T>
+static inline void compact_unpack(int64_t rows, int64_t cols, const T *ap, int64_t ldap, T *a,
+                                  int64_t lda, int64_t stride_a, int64_t batch_size) {
+    constexpr int64_t w = compact_width<T>();
+    for_each_pack<T>(batch_size, double(rows) * cols, [=](int64_t p) {
+        const T *pack    = ap + p * ldap * cols * w;
+        const int64_t nl = std::min(w, batch_size - p * w);
+        for (int64_t l = 0; l < nl; l++) {
+            T *dest = a + stride_a * (p * w + l);
+            for (int64_t j = 0; j < cols; j++) {
+                for (int64_t i = 0; i < rows; i++)
+                    dest[i + lda * j] = pack[(i + ldap * j) * w + l];
+            }
+        }
+    });
+}
+
+template <typename T>
+static inline void compact_gemm(transpose transa, transpose transb, int64_t m, int64_t n,
+                                int64_t k, T alpha, const T *a, int64_t lda, const T *b,
+                                int64_t ldb, T beta, T *c, int64_t ldc, int64_t batch_size) {
+    constexpr int64_t w  = compact_width<T>();
+    const int64_t cols_a = (transa == transpose::nontrans) ? k : m;
+    const int64_t cols_b = (transb == transpose::nontrans) ? n : k;
+    for_each_pack<T>(batch_size, double(m) * n * k, [=](int64_t p) {
+        const T *a_p = a + p * lda * cols_a * w;
+        const T *b_p = b + p * ldb * cols_b * w;
+        T *c_p       = c + p * ldc * n * w;
+        for (int64_t j = 0; j < n; j++) {
+            T *c_j = c_p + ldc * j * w;
+            for (int64_t i = 0; i < m * w; i++)
+                c_j[i] = (beta == T(0)) ? T(0) : beta * c_j[i];
+            for (int64_t q = 0; q < k; q++) {
+                const T *b_qj = op_lanes(b_p, transb, ldb, q, j);
+                T alpha_b[w];
+                for (int64_t l = 0; l < w; l++)
+                    alpha_b[l] = alpha * b_qj[l];
+                for (int64_t i = 0; i < m; i++) {
+                    const T *a_iq = op_lanes(a_p, transa, lda, i, q);
+                    for (int64_t l = 0; l < w; l++)
+                        c_j[i * w + l] += a_iq[l] * alpha_b[l];
+                }
+            }
+        }
+    });
+}
+
+template <typename T>
+static inline void compact_trsm(side left_right, uplo upper_lower, transpose trans,
+                                diag unit_diag, int64_t m, int64_t n, T alpha, const T *a,
+                                int64_t lda, T *b, int64_t ldb, int64_t batch_size) {
+    constexpr int64_t w = compact_width<T>();
+    const bool left     = (left_right == side::left);
+    const int64_t dim   = left ? m : n;
+    // op(A) is upper triangular for an upper A that is not transposed, or a
+    //  lower A that is.
+    const bool upper   = ((upper_lower == uplo::upper) == (trans == transpose::nontrans));
+    const bool nonunit = (unit_diag == diag::nonunit);
+    for_each_pack<T>(batch_size, 0.5 * m * n * dim, [=](int64_t p) {
+        const T *a_p = a + p * lda * dim * w;
+        T *b_p       = b + p * ldb * n * w;
+        for (int64_t j = 0; j < n; j++) {
+            for (int64_t i = 0; i < m * w; i++)
+                b_p[ldb * j * w + i] *= alpha;
+        }
+        if (left) {
+            // op(A) * X = B, one column of X at a time, from its last row up
+            //  for an upper op(A).
+            for (int64_t j = 0; j < n; j++) {
+                T *x_j = b_p + ldb * j * w;
+                for (int64_t s = 0; s < m; s++) {
+                    const int64_t i     = upper ? m - 1 - s : s;
+                    const int64_t begin = upper ? i + 1 : 0;
+                    const int64_t end   = upper ? m : i;
+                    for (int64_t q = begin; q < end; q++) {
+                        const T *a_iq = op_lanes(a_p, trans, lda, i, q);
+                        for (int64_t l = 0; l < w; l++)
+                            x_j[i * w + l] -= a_iq[l] * x_j[q * w + l];
+                    }
+                    if (nonunit) {
+                        const T *a_ii = op_lanes(a_p, trans, lda, i, i);
+                        for (int64_t l = 0; l < w; l++)
+                            x_j[i * w + l] /= a_ii[l];
+                    }
+                }
+            }
+        }
+        else {
+            // X * op(A) = B, one column of X at a time, from the first one for
+            //  an upper op(A).
+            for (int64_t s = 0; s < n; s++) {
+                const int64_t j     = upper ? s : n - 1 - s;
+                const int64_t begin = upper ? 0 : j + 1;
+                const int64_t end   = upper ? j : n;
+                T *x_j              = b_p + ldb * j * w;
+                for (int64_t q = begin; q < end; q++) {
+                    const T *a_qj = op_lanes(a_p, trans, lda, q, j);
+                    const T *x_q  = b_p + ldb * q * w;
+                    for (int64_t i = 0; i < m; i++) {
+                        for (int64_t l = 0; l < w; l++)
+                            x_j[i * w + l] -= x_q[i * w + l] * a_qj[l];
+                    }
+                }
+                if (nonunit) {
+                    const T *a_jj = op_lanes(a_p, trans, lda, j, j);
+                    for (int64_t i = 0; i < m; i++) {
+                        for (int64_t l = 0; l < w; l++)
+                            x_j[i * w + l] /= a_jj[l];
+                    }
+                }
+            }
+        }
+    });
+}
+
+// LU factorization without pivoting, A = L * U with a unit lower L.
+template <typename T>
+static inline void compact_getrfnp(int64_t m, int64_t n, T *a, int64_t lda, int64_t batch_size) {
+    constexpr int64_t w = compact_width<T>();
+    const int64_t mn    = std::min(m, n);
+    for_each_pack<T>(batch_size, double(m) * n * mn, [=](int64_t p) {
+        T *a_p = a + p * lda * n * w;
+        for (int64_t q = 0; q < mn; q++) {
+            T *a_q = a_p + lda * q * w;
+            T inv[w];
+            for (int64_t l = 0; l < w; l++)
+                inv[l] = T(1) / a_q[q * w + l];
+            for (int64_t i = q + 1; i < m; i++) {
+                for (int64_t l = 0; l < w; l++)
+                    a_q[i * w + l] *= inv[l];
+            }
+            for (int64_t j = q + 1; j < n; j++) {
+                T *a_j = a_p + lda * j * w;
+                for (int64_t i = q + 1; i < m; i++) {
+                    for (int64_t l = 0; l < w; l++)
+                        a_j[i * w + l] -= a_q[i * w + l] * a_j[q * w + l];
+                }
+            }
+        }
+    });
+}
+
+void gepack_compact(cl::sycl::queue &queue, int64_t rows, int64_t cols,
+                    cl::sycl::buffer<float, 1> &a, int64_t lda, int64_t stride_a,
+                    cl::sycl::buffer<float, 1> &ap, int64_t ldap, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc  = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto ap_acc = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_sgepack_compact>(cgh, [=]() {
+            compact_pack<float>(rows, cols, a_acc.get_pointer(), lda, stride_a,
+                                ap_acc.get_pointer(), ldap, batch_size);
+        });
+    });
+}
+
+void gepack_compact(cl::sycl::queue &queue, int64_t rows, int64_t cols,
+                    cl::sycl::buffer<double, 1> &a, int64_t lda, int64_t stride_a,
+                    cl::sycl::buffer<double, 1> &ap, int64_t ldap, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc  = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto ap_acc = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_dgepack_compact>(cgh, [=]() {
+            compact_pack<double>(rows, cols, a_acc.get_pointer(), lda, stride_a,
+                                 ap_acc.get_pointer(), ldap, batch_size);
+        });
+    });
+}
+
+void geunpack_compact(cl::sycl::queue &queue, int64_t rows, int64_t cols,
+                      cl::sycl::buffer<float, 1> &ap, int64_t ldap, cl::sycl::buffer<float, 1> &a,
+                      int64_t lda, int64_t stride_a, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto ap_acc = ap.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc  = a.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_sgeunpack_compact>(cgh, [=]() {
+            compact_unpack<float>(rows, cols, ap_acc.get_pointer(), ldap, a_acc.get_pointer(), lda,
+                                  stride_a, batch_size);
+        });
+    });
+}
+
+void geunpack_compact(cl::sycl::queue &queue, int64_t rows, int64_t cols,
+                      cl::sycl::buffer<double, 1> &ap, int64_t ldap, cl::sycl::buffer<double, 1> &a,
+                      int64_t lda, int64_t stride_a, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto ap_acc = ap.get_access<cl::sycl::access::mode::read>(cgh);
+        auto a_acc  = a.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_dgeunpack_compact>(cgh, [=]() {
+            compact_unpack<double>(rows, cols, ap_acc.get_pointer(), ldap, a_acc.get_pointer(), lda,
+                                   stride_a, batch_size);
+        });
+    });
+}
+
+void gemm_compact(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                  int64_t k, float alpha, cl::sycl::buffer<float, 1> &a, int64_t lda,
+                  cl::sycl::buffer<float, 1> &b, int64_t ldb, float beta,
+                  cl::sycl::buffer<float, 1> &c, int64_t ldc, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_sgemm_compact>(cgh, [=]() {
+            compact_gemm<float>(transa, transb, m, n, k, alpha, a_acc.get_pointer(), lda,
+                                b_acc.get_pointer(), ldb, beta, c_acc.get_pointer(), ldc,
+                                batch_size);
+        });
+    });
+}
+
+void gemm_compact(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                  int64_t k, double alpha, cl::sycl::buffer<double, 1> &a, int64_t lda,
+                  cl::sycl::buffer<double, 1> &b, int64_t ldb, double beta,
+                  cl::sycl::buffer<double, 1> &c, int64_t ldc, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_dgemm_compact>(cgh, [=]() {
+            compact_gemm<double>(transa, transb, m, n, k, alpha, a_acc.get_pointer(), lda,
+                                 b_acc.get_pointer(), ldb, beta, c_acc.get_pointer(), ldc,
+                                 batch_size);
+        });
+    });
+}
+
+void trsm_compact(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
+                  diag unit_diag, int64_t m, int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                  int64_t lda, cl::sycl::buffer<float, 1> &b, int64_t ldb, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_strsm_compact>(cgh, [=]() {
+            compact_trsm<float>(left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                                a_acc.get_pointer(), lda, b_acc.get_pointer(), ldb, batch_size);
+        });
+    });
+}
+
+void trsm_compact(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
+                  diag unit_diag, int64_t m, int64_t n, double alpha,
+                  cl::sycl::buffer<double, 1> &a, int64_t lda, cl::sycl::buffer<double, 1> &b,
+                  int64_t ldb, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_dtrsm_compact>(cgh, [=]() {
+            compact_trsm<double>(left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                                 a_acc.get_pointer(), lda, b_acc.get_pointer(), ldb, batch_size);
+        });
+    });
+}
+
+void getrfnp_compact(cl::sycl::queue &queue, int64_t m, int64_t n, cl::sycl::buffer<float, 1> &a,
+                     int64_t lda, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_sgetrfnp_compact>(cgh, [=]() {
+            compact_getrfnp<float>(m, n, a_acc.get_pointer(), lda, batch_size);
+        });
+    });
+}
+
+void getrfnp_compact(cl::sycl::queue &queue, int64_t m, int64_t n, cl::sycl::buffer<double, 1> &a,
+                     int64_t lda, int64_t batch_size) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_dgetrfnp_compact>(cgh, [=]() {
+            compact_getrfnp<double>(m, n, a_acc.get_pointer(), lda, batch_size);
+        });
+    });
+}
+
+} // namespace mklcpu
+} // namespace onemkl
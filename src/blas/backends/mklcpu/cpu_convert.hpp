@@ -0,0 +1,374 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_CPU_CONVERT_HPP_
+#define _MKL_CPU_CONVERT_HPP_
+
+#include <cstdint>
+#include <cstring>
+
+#include "cpu_common.hpp"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #define MKLCPU_CONVERT_X86
+    #include <cpuid.h>
+    #include <immintrin.h>
+#endif
+
+namespace onemkl {
+namespace mklcpu {
+
+// Bulk conversions between fp16/bf16 (stored as raw 16-bit values) and fp32.
+//  The x86 kernels are chosen at run time: AVX-512F, then AVX2 + F16C, then
+//  portable scalar code. All of them round to nearest even and handle
+//  denormals and infinities the same way. NaNs are quieted and keep the top
+//  bits of their payload, as the F16C instructions do, so results do not
+//  depend on the kernel.
+
+namespace convert_impl {
+
+static inline uint32_t bits(float f) {
+    uint32_t i;
+    std::memcpy(&i, &f, sizeof(i));
+    return i;
+}
+
+static inline float from_bits(uint32_t i) {
+    float f;
+    std::memcpy(&f, &i, sizeof(f));
+    return f;
+}
+
+static inline float f16_to_f32(uint16_t h) {
+    const uint32_t shifted_exp = 0x7C00 << 13;
+    uint32_t o                 = (h & 0x7FFF) << 13;
+    uint32_t exp               = shifted_exp & o;
+    o += (127 - 15) << 23;
+    if (exp == shifted_exp) {
+        // inf/nan, a nan is quieted
+        o += (128 - 16) << 23;
+        if (h & 0x03FF)
+            o |= 0x00400000;
+    }
+    else if (exp == 0) {
+        // zero/denormal, renormalize through a float subtraction
+        o += 1 << 23;
+        o = bits(from_bits(o) - from_bits(113 << 23));
+    }
+    return from_bits(o | (uint32_t(h & 0x8000) << 16));
+}
+
+static inline uint16_t f32_to_f16(float f) {
+    const uint32_t f16_max      = (127 + 16) << 23;
+    const uint32_t denorm_magic = ((127 - 15) + (23 - 10) + 1) << 23;
+    uint32_t x                  = bits(f);
+    const uint32_t sign         = x & 0x80000000;
+    uint32_t o;
+    x ^= sign;
+    if (x >= f16_max) {
+        // overflow to inf, nan is quieted and keeps the top of its payload
+        o = (x > 0x7F800000) ? (0x7E00 | ((x >> 13) & 0x03FF)) : 0x7C00;
+    }
+    else if (x < (113 << 23)) {
+        // denormal result, let the float adder do the rounding
+        o = bits(from_bits(x) + from_bits(denorm_magic)) - denorm_magic;
+    }
+    else {
+        const uint32_t mant_odd = (x >> 13) & 1;
+        x += ((15 - 127) << 23) + 0xFFF + mant_odd;
+        o = x >> 13;
+    }
+    return uint16_t(o | (sign >> 16));
+}
+
+static inline float bf16_to_f32(uint16_t h) {
+    return from_bits(uint32_t(h) << 16);
+}
+
+static inline uint16_t f32_to_bf16(float f) {
+    const uint32_t x = bits(f);
+    if ((x & 0x7FFFFFFF) > 0x7F800000)
+        return uint16_t((x >> 16) | 0x0040);
+    return uint16_t((x + 0x7FFF + ((x >> 16) & 1)) >> 16);
+}
+
+static inline void f16_to_f32_ref(const uint16_t *x, float *y, int64_t n) {
+    for (int64_t i = 0; i < n; i++)
+        y[i] = f16_to_f32(x[i]);
+}
+
+static inline void f32_to_f16_ref(const float *x, uint16_t *y, int64_t n) {
+    for (int64_t i = 0; i < n; i++)
+        y[i] = f32_to_f16(x[i]);
+}
+
+static inline void bf16_to_f32_ref(const uint16_t *x, float *y, int64_t n) {
+    for (int64_t i = 0; i < n; i++)
+        y[i] = bf16_to_f32(x[i]);
+}
+
+static inline void f32_to_bf16_ref(const float *x, uint16_t *y, int64_t n) {
+    for (int64_t i = 0; i < n; i++)
+        y[i] = f32_to_bf16(x[i]);
+}
+
+#ifdef MKLCPU_CONVERT_X86
+
+// __builtin_cpu_supports does not know F16C on every compiler, read it from
+//  cpuid leaf 1 instead.
+static inline bool cpu_has_f16c() {
+    unsigned int eax, ebx, ecx, edx;
+    return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_F16C);
+}
+
+// Each SIMD kernel handles the remainder by running its vector body once more
+//  on a zero-padded copy, so that every element goes through the same code.
+
+__attribute__((target("avx2,f16c"))) static inline void f16_to_f32_avx2(const uint16_t *x,
+                                                                         float *y, int64_t n) {
+    int64_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_ps(y + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(x + i))));
+    if (i < n) {
+        uint16_t xt[8] = { 0 };
+        float yt[8];
+        std::memcpy(xt, x + i, (n - i) * sizeof(uint16_t));
+        _mm256_storeu_ps(yt, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)xt)));
+        std::memcpy(y + i, yt, (n - i) * sizeof(float));
+    }
+}
+
+__attribute__((target("avx2,f16c"))) static inline void f32_to_f16_avx2(const float *x,
+                                                                         uint16_t *y, int64_t n) {
+    int64_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm_storeu_si128((__m128i *)(y + i),
+                         _mm256_cvtps_ph(_mm256_loadu_ps(x + i), _MM_FROUND_TO_NEAREST_INT));
+    if (i < n) {
+        float xt[8] = { 0 };
+        uint16_t yt[8];
+        std::memcpy(xt, x + i, (n - i) * sizeof(float));
+        _mm_storeu_si128((__m128i *)yt,
+                         _mm256_cvtps_ph(_mm256_loadu_ps(xt), _MM_FROUND_TO_NEAREST_INT));
+        std::memcpy(y + i, yt, (n - i) * sizeof(uint16_t));
+    }
+}
+
+__attribute__((target("avx2"))) static inline __m256 bf16x8_to_f32(__m128i h) {
+    return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(h), 16));
+}
+
+__attribute__((target("avx2"))) static inline __m128i f32x8_to_bf16(__m256 f) {
+    const __m256i x    = _mm256_castps_si256(f);
+    const __m256i lsb  = _mm256_and_si256(_mm256_srli_epi32(x, 16), _mm256_set1_epi32(1));
+    const __m256i bias = _mm256_add_epi32(lsb, _mm256_set1_epi32(0x7FFF));
+    const __m256i nan  = _mm256_or_si256(_mm256_srli_epi32(x, 16), _mm256_set1_epi32(0x0040));
+    const __m256i mask = _mm256_castps_si256(_mm256_cmp_ps(f, f, _CMP_UNORD_Q));
+    __m256i r          = _mm256_srli_epi32(_mm256_add_epi32(x, bias), 16);
+    r                  = _mm256_blendv_epi8(r, nan, mask);
+    // packus works within 128-bit lanes, gather the two useful quadwords
+    r = _mm256_permute4x64_epi64(_mm256_packus_epi32(r, r), 0x08);
+    return _mm256_castsi256_si128(r);
+}
+
+__attribute__((target("avx2"))) static inline void bf16_to_f32_avx2(const uint16_t *x, float *y,
+                                                                     int64_t n) {
+    int64_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_ps(y + i, bf16x8_to_f32(_mm_loadu_si128((const __m128i *)(x + i))));
+    if (i < n) {
+        uint16_t xt[8] = { 0 };
+        float yt[8];
+        std::memcpy(xt, x + i, (n - i) * sizeof(uint16_t));
+        _mm256_storeu_ps(yt, bf16x8_to_f32(_mm_loadu_si128((const __m128i *)xt)));
+        std::memcpy(y + i, yt, (n - i) * sizeof(float));
+    }
+}
+
+__attribute__((target("avx2"))) static inline void f32_to_bf16_avx2(const float *x, uint16_t *y,
+                                                                     int64_t n) {
+    int64_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm_storeu_si128((__m128i *)(y + i), f32x8_to_bf16(_mm256_loadu_ps(x + i)));
+    if (i < n) {
+        float xt[8] = { 0 };
+        uint16_t yt[8];
+        std::memcpy(xt, x + i, (n - i) * sizeof(float));
+        _mm_storeu_si128((__m128i *)yt, f32x8_to_bf16(_mm256_loadu_ps(xt)));
+        std::memcpy(y + i, yt, (n - i) * sizeof(uint16_t));
+    }
+}
+
+__attribute__((target("avx512f"))) static inline void f16_to_f32_avx512(const uint16_t *x,
+                                                                         float *y, int64_t n) {
+    int64_t i = 0;
+    for (; i + 16 <= n; i += 16)
+        _mm512_storeu_ps(y + i, _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i *)(x + i))));
+    if (i < n) {
+        const __mmask16 mask = (__mmask16)((1u << (n - i)) - 1);
+        uint16_t xt[16]      = { 0 };
+        std::memcpy(xt, x + i, (n - i) * sizeof(uint16_t));
+        _mm512_mask_storeu_ps(y + i, mask,
+                              _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i *)xt)));
+    }
+}
+
+__attribute__((target("avx512f"))) static inline void f32_to_f16_avx512(const float *x,
+                                                                         uint16_t *y, int64_t n) {
+    int64_t i = 0;
+    for (; i + 16 <= n; i += 16)
+        _mm256_storeu_si256((__m256i *)(y + i),
+                            _mm512_cvtps_ph(_mm512_loadu_ps(x + i), _MM_FROUND_TO_NEAREST_INT));
+    if (i < n) {
+        const __mmask16 mask = (__mmask16)((1u << (n - i)) - 1);
+        uint16_t yt[16];
+        _mm256_storeu_si256((__m256i *)yt,
+                            _mm512_cvtps_ph(_mm512_maskz_loadu_ps(mask, x + i),
+                                            _MM_FROUND_TO_NEAREST_INT));
+        std::memcpy(y + i, yt, (n - i) * sizeof(uint16_t));
+    }
+}
+
+__attribute__((target("avx512f"))) static inline void bf16_to_f32_avx512(const uint16_t *x,
+                                                                          float *y, int64_t n) {
+    int64_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512i w = _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i *)(x + i)));
+        _mm512_storeu_ps(y + i, _mm512_castsi512_ps(_mm512_slli_epi32(w, 16)));
+    }
+    if (i < n) {
+        const __mmask16 mask = (__mmask16)((1u << (n - i)) - 1);
+        uint16_t xt[16]      = { 0 };
+        std::memcpy(xt, x + i, (n - i) * sizeof(uint16_t));
+        __m512i w = _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i *)xt));
+        _mm512_mask_storeu_ps(y + i, mask, _mm512_castsi512_ps(_mm512_slli_epi32(w, 16)));
+    }
+}
+
+__attribute__((target("avx512f"))) static inline __m256i f32x16_to_bf16(__m512 f) {
+    const __m512i x    = _mm512_castps_si512(f);
+    const __m512i lsb  = _mm512_and_si512(_mm512_srli_epi32(x, 16), _mm512_set1_epi32(1));
+    const __m512i bias = _mm512_add_epi32(lsb, _mm512_set1_epi32(0x7FFF));
+    const __m512i nan  = _mm512_or_si512(_mm512_srli_epi32(x, 16), _mm512_set1_epi32(0x0040));
+    __m512i r          = _mm512_srli_epi32(_mm512_add_epi32(x, bias), 16);
+    r                  = _mm512_mask_blend_epi32(_mm512_cmp_ps_mask(f, f, _CMP_UNORD_Q), r, nan);
+    return _mm512_cvtepi32_epi16(r);
+}
+
+__attribute__((target("avx512f"))) static inline void f32_to_bf16_avx512(const float *x,
+                                                                          uint16_t *y, int64_t n) {
+    int64_t i = 0;
+    for (; i + 16 <= n; i += 16)
+        _mm256_storeu_si256((__m256i *)(y + i), f32x16_to_bf16(_mm512_loadu_ps(x + i)));
+    if (i < n) {
+        const __mmask16 mask = (__mmask16)((1u << (n - i)) - 1);
+        uint16_t yt[16];
+        _mm256_storeu_si256((__m256i *)yt, f32x16_to_bf16(_mm512_maskz_loadu_ps(mask, x + i)));
+        std::memcpy(y + i, yt, (n - i) * sizeof(uint16_t));
+    }
+}
+
+#endif // MKLCPU_CONVERT_X86
+
+template <typename T_src, typename T_dest>
+struct kernel {
+    typedef void (*type)(const T_src *, T_dest *, int64_t);
+};
+
+// Picks the best kernel for the host CPU. The result is computed once.
+template <typename T_src, typename T_dest>
+static inline typename kernel<T_src, T_dest>::type select(
+    typename kernel<T_src, T_dest>::type avx512, typename kernel<T_src, T_dest>::type avx2,
+    typename kernel<T_src, T_dest>::type ref) {
+#ifdef MKLCPU_CONVERT_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+        return avx512;
+    // the fp16 avx2 kernels also use F16C, which some AVX2 CPUs lack
+    if (__builtin_cpu_supports("avx2") && cpu_has_f16c())
+        return avx2;
+#endif
+    return ref;
+}
+
+} // namespace convert_impl
+
+#ifdef MKLCPU_CONVERT_X86
+    #define MKLCPU_CONVERT_KERNELS(name) \
+        convert_impl::name##_avx512, convert_impl::name##_avx2, convert_impl::name##_ref
+#else
+    #define MKLCPU_CONVERT_KERNELS(name) \
+        convert_impl::name##_ref, convert_impl::name##_ref, convert_impl::name##_ref
+#endif
+
+// Single threaded conversion of n contiguous values.
+static inline void convert_f16_to_f32(const uint16_t *x, float *y, int64_t n) {
+    static const auto kernel =
+        convert_impl::select<uint16_t, float>(MKLCPU_CONVERT_KERNELS(f16_to_f32));
+    kernel(x, y, n);
+}
+
+static inline void convert_f32_to_f16(const float *x, uint16_t *y, int64_t n) {
+    static const auto kernel =
+        convert_impl::select<float, uint16_t>(MKLCPU_CONVERT_KERNELS(f32_to_f16));
+    kernel(x, y, n);
+}
+
+static inline void convert_bf16_to_f32(const uint16_t *x, float *y, int64_t n) {
+    static const auto kernel =
+        convert_impl::select<uint16_t, float>(MKLCPU_CONVERT_KERNELS(bf16_to_f32));
+    kernel(x, y, n);
+}
+
+static inline void convert_f32_to_bf16(const float *x, uint16_t *y, int64_t n) {
+    static const auto kernel =
+        convert_impl::select<float, uint16_t>(MKLCPU_CONVERT_KERNELS(f32_to_bf16));
+    kernel(x, y, n);
+}
+
+// Number of elements below which a conversion is not worth splitting across
+//  threads.
+static constexpr int64_t convert_grain = 1 << 16;
+
+// Converts the m x n column major matrix a into b using kernel on each
+//  column, or on the whole array when both matrices are contiguous. Large
+//  conversions are split across threads.
+template <typename T_src, typename T_dest>
+static inline void convert_matrix(void (*kernel)(const T_src *, T_dest *, int64_t), int64_t m,
+                                  int64_t n, const T_src *a, int64_t lda, T_dest *b, int64_t ldb,
+                                  bool threaded = true) {
+    if (m <= 0 || n <= 0)
+        return;
+    const int64_t grain = threaded ? convert_grain : m * n;
+    if ((lda == m && ldb == m) || n == 1) {
+        parallel_for(m * n, grain, [=](int64_t begin, int64_t end) {
+            kernel(a + begin, b + begin, end - begin);
+        });
+        return;
+    }
+    parallel_for(n, std::max<int64_t>(grain / m, 1), [=](int64_t begin, int64_t end) {
+        for (int64_t j = begin; j < end; j++)
+            kernel(a + lda * j, b + ldb * j, m);
+    });
+}
+
+} // namespace mklcpu
+} // namespace onemkl
+
+#endif //_MKL_CPU_CONVERT_HPP_
@@ -0,0 +1,140 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_CPU_ELEMENTWISE_HPP_
+#define _MKL_CPU_ELEMENTWISE_HPP_
+
+#include <algorithm>
+#include <cstdint>
+
+#include "cpu_common.hpp"
+#include "cpu_reduce.hpp"
+
+namespace onemkl {
+namespace mklcpu {
+
+// Elementwise operations such as c = a * b on batches of matrices, a vector
+//  being an m x 1 matrix whose rows are inc apart. The m * n * batch_size
+//  elements are split across threads in contiguous chunks, so that vectors,
+//  tall or wide matrices and batches of small ones all divide evenly, and
+//  the loop over a column is compiled separately for unit increments so
+//  that it vectorizes.
+
+// Smallest number of elements given to one thread.
+constexpr int64_t elementwise_grain = 1 << 15;
+
+// Element-wise operations, taking the elements of a and b. Operations that
+//  do not use b are given a again in its place. Only fma_op also takes the
+//  element of c, which is not loaded at all when beta is zero.
+template <typename T>
+struct mul_op {
+    T operator()(T a, T b) const {
+        return a * b;
+    }
+};
+
+template <typename T>
+struct div_op {
+    T operator()(T a, T b) const {
+        return a / b;
+    }
+};
+
+// alpha * a * b + beta * c, or alpha * a * b when beta is zero.
+template <typename T>
+struct fma_op {
+    T alpha, beta;
+    T operator()(T a, T b) const {
+        return alpha * a * b;
+    }
+    T operator()(T a, T b, T c) const {
+        return alpha * a * b + beta * c;
+    }
+};
+
+// a limited to [lo, hi], NaN staying NaN.
+template <typename T>
+struct clamp_op {
+    T lo, hi;
+    T operator()(T a, T) const {
+        return std::min(std::max(a, lo), hi);
+    }
+};
+
+// c[i] = op(a[i], b[i]) for i in [begin, end) of one column.
+template <typename T, typename S, typename Op>
+static inline void elementwise_column(int64_t begin, int64_t end, const T *a, S sa, const T *b,
+                                      S sb, T *c, S sc, Op op) {
+    for (int64_t i = begin; i < end; i++)
+        c[sc(i)] = op(a[sa(i)], b[sb(i)]);
+}
+
+// c[i] = op(a[i], b[i], c[i]) for i in [begin, end) of one column, c being
+//  neither read nor scaled when beta is zero, so that NaN in c is overwritten.
+template <typename T, typename S>
+static inline void elementwise_column(int64_t begin, int64_t end, const T *a, S sa, const T *b,
+                                      S sb, T *c, S sc, fma_op<T> op) {
+    if (op.beta == T(0)) {
+        for (int64_t i = begin; i < end; i++)
+            c[sc(i)] = op(a[sa(i)], b[sb(i)]);
+        return;
+    }
+    for (int64_t i = begin; i < end; i++)
+        c[sc(i)] = op(a[sa(i)], b[sb(i)], c[sc(i)]);
+}
+
+// c = op(a, b) for a batch of batch_size m x n matrices. Element (i, j) of
+//  matrix l of a is a[i * inca + j * lda + l * stride_a], and likewise for b
+//  and c; a negative increment runs the rows backwards as in BLAS vectors.
+template <typename T, typename Op>
+static inline void elementwise(int64_t m, int64_t n, const T *a, int64_t inca, int64_t lda,
+                               int64_t stride_a, const T *b, int64_t incb, int64_t ldb,
+                               int64_t stride_b, T *c, int64_t incc, int64_t ldc, int64_t stride_c,
+                               int64_t batch_size, Op op) {
+    if (m <= 0 || n <= 0 || batch_size <= 0)
+        return;
+    a                = first_element(m, a, inca);
+    b                = first_element(m, b, incb);
+    c                = first_element(m, c, incc);
+    const bool unit  = (inca == 1 && incb == 1 && incc == 1);
+    const int64_t mn = m * n;
+    parallel_for(mn * batch_size, elementwise_grain, [=](int64_t begin, int64_t end) {
+        for (int64_t k = begin; k < end;) {
+            const int64_t i   = k % m;
+            const int64_t j   = (k / m) % n;
+            const int64_t l   = k / mn;
+            const int64_t len = std::min(m - i, end - k);
+            const T *a_col    = a + j * lda + l * stride_a;
+            const T *b_col    = b + j * ldb + l * stride_b;
+            T *c_col          = c + j * ldc + l * stride_c;
+            if (unit)
+                elementwise_column(i, i + len, a_col, unit_stride{}, b_col, unit_stride{}, c_col,
+                                   unit_stride{}, op);
+            else
+                elementwise_column(i, i + len, a_col, any_stride{ inca }, b_col,
+                                   any_stride{ incb }, c_col, any_stride{ incc }, op);
+            k += len;
+        }
+    });
+}
+
+} // namespace mklcpu
+} // namespace onemkl
+
+#endif //_MKL_CPU_ELEMENTWISE_HPP_
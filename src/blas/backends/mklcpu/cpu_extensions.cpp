@@ -18,66 +18,20 @@
 *******************************************************************************/
 
 #include <CL/sycl.hpp>
+#include <algorithm>
 
 #include "cpu_common.hpp"
+#include "cpu_convert.hpp"
+#include "cpu_elementwise.hpp"
+#include "cpu_hgemm.hpp"
+#include "cpu_igemm.hpp"
+#include "cpu_matrix_reduce.hpp"
+#include "cpu_storage.hpp"
 #include "fp16.hpp"
 
 namespace onemkl {
 namespace mklcpu {
 
-template <typename T_src, typename T_dest>
-static inline void copy_mat(T_src &src, transpose trans, int64_t row, int64_t col, int64_t ld,
-                            T_dest off, T_dest *&dest) {
-    int64_t i, j;
-    if (trans == transpose::N) {
-        for (j = 0; j < col; j++) {
-            for (i = 0; i < row; i++) {
-                dest[i + ld * j] = (T_dest)src[i + ld * j] - off;
-            }
-        }
-    }
-    else {
-        for (i = 0; i < row; i++) {
-            for (j = 0; j < col; j++) {
-                dest[i * ld + j] = (T_dest)src[i * ld + j] - off;
-            }
-        }
-    }
-}
-
-template <typename T_src, typename T_dest, typename T_off>
-static inline void copy_mat(T_src &src, int64_t row, int64_t col, int64_t ld, offset off_kind,
-                            T_off off, T_dest &dest) {
-    using T_data = typename std::remove_reference<decltype(dest[0])>::type;
-    int64_t i, j;
-    T_data tmp;
-
-    if (off_kind == offset::F) {
-        tmp = off[0];
-        for (j = 0; j < col; j++) {
-            for (i = 0; i < row; i++) {
-                dest[i + ld * j] = tmp + (T_data)src[i + ld * j];
-            }
-        }
-    }
-    else if (off_kind == offset::C) {
-        for (j = 0; j < col; j++) {
-            for (i = 0; i < row; i++) {
-                tmp              = off[i];
-                dest[i + ld * j] = tmp + (T_data)src[i + ld * j];
-            }
-        }
-    }
-    else {
-        for (j = 0; j < col; j++) {
-            tmp = off[j];
-            for (i = 0; i < row; i++) {
-                dest[i + ld * j] = tmp + (T_data)src[i + ld * j];
-            }
-        }
-    }
-}
-
 void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
           int64_t k, half alpha, cl::sycl::buffer<half, 1> &a, int64_t lda,
           cl::sycl::buffer<half, 1> &b, int64_t ldb, half beta, cl::sycl::buffer<half, 1> &c,
@@ -87,35 +41,22 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
     auto c_fp16 = c.reinterpret<fp16, 1>(c.get_range());
 
     queue.submit([&](cl::sycl::handler &cgh) {
-        const char transa_ = *fortran_char(transa);
-        const char transb_ = *fortran_char(transb);
-        float f32_alpha    = (float)alpha;
-        float f32_beta     = (float)beta;
-        auto accessor_a    = a_fp16.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_b    = b_fp16.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_c    = c_fp16.get_access<cl::sycl::access::mode::read_write>(cgh);
+        float f32_alpha = (float)alpha;
+        float f32_beta  = (float)beta;
+        auto accessor_a = a_fp16.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b_fp16.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c_fp16.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_hgemm>(cgh, [=]() {
-            int64_t sizea, sizeb, sizec;
-            sizea = (transa == transpose::N) ? lda * k : lda * m;
-            sizeb = (transb == transpose::N) ? ldb * n : ldb * k;
-            sizec = ldc * n;
-            // copy A, B and C to float
-            float *f32_a = (float *)::malloc(sizeof(float) * sizea);
-            float *f32_b = (float *)::malloc(sizeof(float) * sizeb);
-            float *f32_c = (float *)::malloc(sizeof(float) * sizec);
-            copy_mat(accessor_a, transa, m, k, lda, 0.0f, f32_a);
-            copy_mat(accessor_b, transb, k, n, ldb, 0.0f, f32_b);
-            copy_mat(accessor_c, transpose::N, m, n, ldc, 0.0f, f32_c);
-            ::sgemm((const char *)&transa_, (const char *)&transb_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, (const float *)&f32_alpha, f32_a,
-                    (const MKL_INT *)&lda, f32_b, (const MKL_INT *)&ldb, (const float *)&f32_beta,
-                    f32_c, (const MKL_INT *)&ldc);
-            // copy C back to half
-            fp16 co = 0.0f;
-            copy_mat(f32_c, m, n, ldc, offset::F, &co, accessor_c);
-            ::free(f32_a);
-            ::free(f32_b);
-            ::free(f32_c);
+            // scratch for one tile of op(A), op(B) and C
+            half_gemm_tiles tiles(m, n, k, true);
+            const uint16_t *a_mat =
+                static_cast<const uint16_t *>(static_cast<void *>(accessor_a.get_pointer()));
+            const uint16_t *b_mat =
+                static_cast<const uint16_t *>(static_cast<void *>(accessor_b.get_pointer()));
+            uint16_t *c_mat =
+                static_cast<uint16_t *>(static_cast<void *>(accessor_c.get_pointer()));
+            gemm_f16_blocked(transa, transb, m, n, k, f32_alpha, a_mat, lda, b_mat, ldb, f32_beta,
+                             c_mat, ldc, tiles.a.data(), tiles.b.data(), tiles.c.data());
         });
     });
 }
@@ -163,26 +104,19 @@ void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, int64_
     auto a_fp16 = a.reinterpret<fp16, 1>(a.get_range());
     auto b_fp16 = b.reinterpret<fp16, 1>(b.get_range());
     queue.submit([&](cl::sycl::handler &cgh) {
-        const char transa_ = *fortran_char(transa);
-        const char transb_ = *fortran_char(transb);
-        auto accessor_a    = a_fp16.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_b    = b_fp16.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_c    = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto accessor_a = a_fp16.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b_fp16.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_gemm_f16f16f32>(cgh, [=]() {
-            int64_t sizea, sizeb;
-            sizea = (transa == transpose::N) ? lda * k : lda * m;
-            sizeb = (transb == transpose::N) ? ldb * n : ldb * k;
-            // copy A and B to float
-            float *f32_a = (float *)::malloc(sizeof(float) * sizea);
-            float *f32_b = (float *)::malloc(sizeof(float) * sizeb);
-            copy_mat(accessor_a, transa, m, k, lda, 0.0f, f32_a);
-            copy_mat(accessor_b, transb, k, n, ldb, 0.0f, f32_b);
-            ::sgemm((const char *)&transa_, (const char *)&transb_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, (const float *)&alpha, f32_a,
-                    (const MKL_INT *)&lda, f32_b, (const MKL_INT *)&ldb, (const float *)&beta,
-                    accessor_c.get_pointer(), (const MKL_INT *)&ldc);
-            ::free(f32_a);
-            ::free(f32_b);
+            // scratch for one tile of op(A) and op(B), C is updated in place
+            half_gemm_tiles tiles(m, n, k, false);
+            const uint16_t *a_mat =
+                static_cast<const uint16_t *>(static_cast<void *>(accessor_a.get_pointer()));
+            const uint16_t *b_mat =
+                static_cast<const uint16_t *>(static_cast<void *>(accessor_b.get_pointer()));
+            float *c_mat = accessor_c.get_pointer();
+            gemm_f16_blocked(transa, transb, m, n, k, alpha, a_mat, lda, b_mat, ldb, beta, c_mat,
+                             ldc, tiles.a.data(), tiles.b.data(), nullptr);
         });
     });
 }
@@ -216,6 +150,283 @@ void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, offset
     });
 }
 
+void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, offset offsetc, int64_t m,
+              int64_t n, int64_t k, float alpha, cl::sycl::buffer<int16_t, 1> &a, int64_t lda,
+              int16_t ao, cl::sycl::buffer<int16_t, 1> &b, int64_t ldb, int16_t bo, float beta,
+              cl::sycl::buffer<int32_t, 1> &c, int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char transa_  = *fortran_char(transa);
+        const char transb_  = *fortran_char(transb);
+        const char offsetc_ = *fortran_char(offsetc);
+        auto accessor_a     = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b     = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c     = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto accessor_co    = co.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_gemm_s16s16s32>(cgh, [=]() {
+            MKL_INT16 *a_mat =
+                static_cast<MKL_INT16 *>(static_cast<void *>(accessor_a.get_pointer()));
+            MKL_INT16 *b_mat =
+                static_cast<MKL_INT16 *>(static_cast<void *>(accessor_b.get_pointer()));
+            MKL_INT16 bo_internal = -bo;
+            MKL_INT16 ao_internal = -ao;
+            ::gemm_s16s16s32((const char *)&transa_, (const char *)&transb_,
+                             (const char *)&offsetc_, (const MKL_INT *)&m, (const MKL_INT *)&n,
+                             (const MKL_INT *)&k, (const float *)&alpha, a_mat,
+                             (const MKL_INT *)&lda, &ao_internal, b_mat, (const MKL_INT *)&ldb,
+                             &bo_internal, (const float *)&beta,
+                             (MKL_INT32 *)accessor_c.get_pointer(), (const MKL_INT *)&ldc,
+                             (const MKL_INT32 *)accessor_co.get_pointer());
+        });
+    });
+}
+
+// Index of the entry of a fix, row or column offset vector used for C(i, j).
+static inline int64_t offset_index(offset o, int64_t i, int64_t j) {
+    return (o == offset::fix) ? 0 : ((o == offset::column) ? i : j);
+}
+
+// Integer gemm with int32 C for the type combinations MKL does not provide:
+// C = alpha * (op(A) - ao) * (op(B) - bo) + beta * C + co, rounded to nearest
+// and saturated.
+template <typename K, typename T_a, typename T_b>
+static inline void gemm_s32_submit(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                   offset offsetc, int64_t m, int64_t n, int64_t k, float alpha,
+                                   cl::sycl::buffer<T_a, 1> &a, int64_t lda, T_a ao,
+                                   cl::sycl::buffer<T_b, 1> &b, int64_t ldb, T_b bo, float beta,
+                                   cl::sycl::buffer<int32_t, 1> &c, int64_t ldc,
+                                   cl::sycl::buffer<int32_t, 1> &co) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a  = a.template get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b  = b.template get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c  = c.template get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto accessor_co = co.template get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<K>(cgh, [=]() {
+            const T_a *a_mat      = accessor_a.get_pointer();
+            const T_b *b_mat      = accessor_b.get_pointer();
+            int32_t *c_mat        = accessor_c.get_pointer();
+            const int32_t *co_vec = accessor_co.get_pointer();
+            igemm(transa, transb, m, n, k, a_mat, lda, ao, b_mat, ldb, bo,
+                  [=](int64_t row, int64_t col, int64_t rows, int64_t cols, const int32_t *acc,
+                      int64_t ld_acc) {
+                      for (int64_t j = 0; j < cols; j++) {
+                          int32_t *c_col = c_mat + row + ldc * (col + j);
+                          for (int64_t i = 0; i < rows; i++) {
+                              double t = double(alpha) * acc[i + ld_acc * j];
+                              if (beta != 0.0f)
+                                  t += double(beta) * c_col[i];
+                              t += co_vec[offset_index(offsetc, row + i, col + j)];
+                              c_col[i] = round_saturate<int32_t>(t);
+                          }
+                      }
+                  });
+        });
+    });
+}
+
+void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, offset offsetc, int64_t m,
+              int64_t n, int64_t k, float alpha, cl::sycl::buffer<int8_t, 1> &a, int64_t lda,
+              int8_t ao, cl::sycl::buffer<int8_t, 1> &b, int64_t ldb, int8_t bo, float beta,
+              cl::sycl::buffer<int32_t, 1> &c, int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+    gemm_s32_submit<class mkl_kernel_gemm_s8s8s32>(queue, transa, transb, offsetc, m, n, k, alpha,
+                                                   a, lda, ao, b, ldb, bo, beta, c, ldc, co);
+}
+
+void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, offset offsetc, int64_t m,
+              int64_t n, int64_t k, float alpha, cl::sycl::buffer<uint8_t, 1> &a, int64_t lda,
+              uint8_t ao, cl::sycl::buffer<int8_t, 1> &b, int64_t ldb, int8_t bo, float beta,
+              cl::sycl::buffer<int32_t, 1> &c, int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+    gemm_s32_submit<class mkl_kernel_gemm_u8s8s32>(queue, transa, transb, offsetc, m, n, k, alpha,
+                                                   a, lda, ao, b, ldb, bo, beta, c, ldc, co);
+}
+
+// Integer gemm with requantized 8-bit C:
+// C = scales * (op(A) - ao) * (op(B) - bo) + zc, rounded to nearest and
+// saturated. scales holds 1, m or n values depending on scalec, in the same
+// way as co for offsetc. The int32 product only exists one tile at a time.
+template <typename K, typename T_a, typename T_b, typename T_c>
+static inline void gemm_requant_submit(cl::sycl::queue &queue, transpose transa,
+                                       transpose transb, offset scalec, int64_t m, int64_t n,
+                                       int64_t k, cl::sycl::buffer<T_a, 1> &a, int64_t lda,
+                                       T_a ao, cl::sycl::buffer<T_b, 1> &b, int64_t ldb, T_b bo,
+                                       cl::sycl::buffer<float, 1> &scales, T_c zc,
+                                       cl::sycl::buffer<T_c, 1> &c, int64_t ldc) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a      = a.template get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b      = b.template get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_scales = scales.template get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c      = c.template get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<K>(cgh, [=]() {
+            const T_a *a_mat       = accessor_a.get_pointer();
+            const T_b *b_mat       = accessor_b.get_pointer();
+            const float *scale_vec = accessor_scales.get_pointer();
+            T_c *c_mat             = accessor_c.get_pointer();
+            const float zc_        = zc;
+            igemm(transa, transb, m, n, k, a_mat, lda, ao, b_mat, ldb, bo,
+                  [=](int64_t row, int64_t col, int64_t rows, int64_t cols, const int32_t *acc,
+                      int64_t ld_acc) {
+                      for (int64_t j = 0; j < cols; j++) {
+                          T_c *c_col = c_mat + row + ldc * (col + j);
+                          for (int64_t i = 0; i < rows; i++) {
+                              const float scale =
+                                  scale_vec[offset_index(scalec, row + i, col + j)];
+                              const float t = std::nearbyint(scale * float(acc[i + ld_acc * j]));
+                              c_col[i]      = round_saturate<T_c>(t + zc_);
+                          }
+                      }
+                  });
+        });
+    });
+}
+
+void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, offset scalec, int64_t m,
+              int64_t n, int64_t k, cl::sycl::buffer<int8_t, 1> &a, int64_t lda, int8_t ao,
+              cl::sycl::buffer<uint8_t, 1> &b, int64_t ldb, uint8_t bo,
+              cl::sycl::buffer<float, 1> &scales, int8_t zc, cl::sycl::buffer<int8_t, 1> &c,
+              int64_t ldc) {
+    gemm_requant_submit<class mkl_kernel_gemm_s8u8s8>(queue, transa, transb, scalec, m, n, k, a,
+                                                      lda, ao, b, ldb, bo, scales, zc, c, ldc);
+}
+
+void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, offset scalec, int64_t m,
+              int64_t n, int64_t k, cl::sycl::buffer<int8_t, 1> &a, int64_t lda, int8_t ao,
+              cl::sycl::buffer<uint8_t, 1> &b, int64_t ldb, uint8_t bo,
+              cl::sycl::buffer<float, 1> &scales, uint8_t zc, cl::sycl::buffer<uint8_t, 1> &c,
+              int64_t ldc) {
+    gemm_requant_submit<class mkl_kernel_gemm_s8u8u8>(queue, transa, transb, scalec, m, n, k, a,
+                                                      lda, ao, b, ldb, bo, scales, zc, c, ldc);
+}
+
+void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, offset scalec, int64_t m,
+              int64_t n, int64_t k, cl::sycl::buffer<int8_t, 1> &a, int64_t lda, int8_t ao,
+              cl::sycl::buffer<int8_t, 1> &b, int64_t ldb, int8_t bo,
+              cl::sycl::buffer<float, 1> &scales, int8_t zc, cl::sycl::buffer<int8_t, 1> &c,
+              int64_t ldc) {
+    gemm_requant_submit<class mkl_kernel_gemm_s8s8s8>(queue, transa, transb, scalec, m, n, k, a,
+                                                      lda, ao, b, ldb, bo, scales, zc, c, ldc);
+}
+
+void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, offset scalec, int64_t m,
+              int64_t n, int64_t k, cl::sycl::buffer<int8_t, 1> &a, int64_t lda, int8_t ao,
+              cl::sycl::buffer<int8_t, 1> &b, int64_t ldb, int8_t bo,
+              cl::sycl::buffer<float, 1> &scales, uint8_t zc, cl::sycl::buffer<uint8_t, 1> &c,
+              int64_t ldc) {
+    gemm_requant_submit<class mkl_kernel_gemm_s8s8u8>(queue, transa, transb, scalec, m, n, k, a,
+                                                      lda, ao, b, ldb, bo, scales, zc, c, ldc);
+}
+
+void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, offset scalec, int64_t m,
+              int64_t n, int64_t k, cl::sycl::buffer<uint8_t, 1> &a, int64_t lda, uint8_t ao,
+              cl::sycl::buffer<int8_t, 1> &b, int64_t ldb, int8_t bo,
+              cl::sycl::buffer<float, 1> &scales, int8_t zc, cl::sycl::buffer<int8_t, 1> &c,
+              int64_t ldc) {
+    gemm_requant_submit<class mkl_kernel_gemm_u8s8s8>(queue, transa, transb, scalec, m, n, k, a,
+                                                      lda, ao, b, ldb, bo, scales, zc, c, ldc);
+}
+
+void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, offset scalec, int64_t m,
+              int64_t n, int64_t k, cl::sycl::buffer<uint8_t, 1> &a, int64_t lda, uint8_t ao,
+              cl::sycl::buffer<int8_t, 1> &b, int64_t ldb, int8_t bo,
+              cl::sycl::buffer<float, 1> &scales, uint8_t zc, cl::sycl::buffer<uint8_t, 1> &c,
+              int64_t ldc) {
+    gemm_requant_submit<class mkl_kernel_gemm_u8s8u8>(queue, transa, transb, scalec, m, n, k, a,
+                                                      lda, ao, b, ldb, bo, scales, zc, c, ldc);
+}
+
+int64_t gemm_s8u8s32_pack_get_size(cl::sycl::queue &queue, identifier which, int64_t m, int64_t n,
+                                   int64_t k) {
+    const char which_ = *fortran_char(which);
+    return ::gemm_s8u8s32_pack_get_size((const char *)&which_, (const MKL_INT *)&m,
+                                        (const MKL_INT *)&n, (const MKL_INT *)&k);
+}
+
+// Packs op(src) into the internal layout used by gemm_s8u8s32_compute. T_src
+// selects the operand: int8 for A, uint8 for B.
+template <typename K, typename T_src>
+static inline void gemm_s8u8s32_pack_submit(cl::sycl::queue &queue, identifier which,
+                                            transpose trans, int64_t m, int64_t n, int64_t k,
+                                            cl::sycl::buffer<T_src, 1> &src, int64_t ld,
+                                            cl::sycl::buffer<T_src, 1> &dest) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char which_  = *fortran_char(which);
+        const char trans_  = *fortran_char(trans);
+        auto accessor_src  = src.template get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_dest = dest.template get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<K>(cgh, [=]() {
+            ::gemm_s8u8s32_pack((const char *)&which_, (const char *)&trans_, (const MKL_INT *)&m,
+                                (const MKL_INT *)&n, (const MKL_INT *)&k,
+                                (const void *)accessor_src.get_pointer(), (const MKL_INT *)&ld,
+                                (void *)accessor_dest.get_pointer());
+        });
+    });
+}
+
+void gemm_s8u8s32_pack(cl::sycl::queue &queue, transpose transa, int64_t m, int64_t n, int64_t k,
+                       cl::sycl::buffer<int8_t, 1> &a, int64_t lda,
+                       cl::sycl::buffer<int8_t, 1> &packed_a) {
+    gemm_s8u8s32_pack_submit<class mkl_kernel_gemm_s8u8s32_pack_a>(queue, identifier::a, transa, m,
+                                                                   n, k, a, lda, packed_a);
+}
+
+void gemm_s8u8s32_pack(cl::sycl::queue &queue, transpose transb, int64_t m, int64_t n, int64_t k,
+                       cl::sycl::buffer<uint8_t, 1> &b, int64_t ldb,
+                       cl::sycl::buffer<uint8_t, 1> &packed_b) {
+    gemm_s8u8s32_pack_submit<class mkl_kernel_gemm_s8u8s32_pack_b>(queue, identifier::b, transb, m,
+                                                                   n, k, b, ldb, packed_b);
+}
+
+// gemm_s8u8s32 with one operand packed by gemm_s8u8s32_pack. MKL recognizes
+// the packed operand from a 'P' transpose value and ignores its leading
+// dimension.
+template <typename K>
+static inline void gemm_s8u8s32_compute_submit(
+    cl::sycl::queue &queue, char transa_, char transb_, offset offsetc, int64_t m, int64_t n,
+    int64_t k, float alpha, cl::sycl::buffer<int8_t, 1> &a, int64_t lda, int8_t ao,
+    cl::sycl::buffer<uint8_t, 1> &b, int64_t ldb, uint8_t bo, float beta,
+    cl::sycl::buffer<int32_t, 1> &c, int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char offsetc_ = *fortran_char(offsetc);
+        auto accessor_a     = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b     = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c     = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto accessor_co    = co.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<K>(cgh, [=]() {
+            MKL_INT8 *a_mat =
+                static_cast<MKL_INT8 *>(static_cast<void *>(accessor_a.get_pointer()));
+            MKL_UINT8 *b_mat =
+                static_cast<MKL_UINT8 *>(static_cast<void *>(accessor_b.get_pointer()));
+            MKL_INT8 bo_internal = -bo;
+            MKL_INT8 ao_internal = -ao;
+            ::gemm_s8u8s32_compute((const char *)&transa_, (const char *)&transb_,
+                                   (const char *)&offsetc_, (const MKL_INT *)&m,
+                                   (const MKL_INT *)&n, (const MKL_INT *)&k, (const float *)&alpha,
+                                   a_mat, (const MKL_INT *)&lda, &ao_internal, b_mat,
+                                   (const MKL_INT *)&ldb, &bo_internal, (const float *)&beta,
+                                   (MKL_INT32 *)accessor_c.get_pointer(), (const MKL_INT *)&ldc,
+                                   (const MKL_INT32 *)accessor_co.get_pointer());
+        });
+    });
+}
+
+void gemm_s8u8s32_compute(cl::sycl::queue &queue, transpose transb, offset offsetc, int64_t m,
+                          int64_t n, int64_t k, float alpha, cl::sycl::buffer<int8_t, 1> &packed_a,
+                          int8_t ao, cl::sycl::buffer<uint8_t, 1> &b, int64_t ldb, uint8_t bo,
+                          float beta, cl::sycl::buffer<int32_t, 1> &c, int64_t ldc,
+                          cl::sycl::buffer<int32_t, 1> &co) {
+    gemm_s8u8s32_compute_submit<class mkl_kernel_gemm_s8u8s32_compute_a>(
+        queue, 'P', *fortran_char(transb), offsetc, m, n, k, alpha, packed_a, m, ao, b, ldb, bo,
+        beta, c, ldc, co);
+}
+
+void gemm_s8u8s32_compute(cl::sycl::queue &queue, transpose transa, offset offsetc, int64_t m,
+                          int64_t n, int64_t k, float alpha, cl::sycl::buffer<int8_t, 1> &a,
+                          int64_t lda, int8_t ao, cl::sycl::buffer<uint8_t, 1> &packed_b,
+                          uint8_t bo, float beta, cl::sycl::buffer<int32_t, 1> &c, int64_t ldc,
+                          cl::sycl::buffer<int32_t, 1> &co) {
+    gemm_s8u8s32_compute_submit<class mkl_kernel_gemm_s8u8s32_compute_b>(
+        queue, *fortran_char(transa), 'P', offsetc, m, n, k, alpha, a, lda, ao, packed_b, k, bo,
+        beta, c, ldc, co);
+}
+
 void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb, int64_t n,
            int64_t k, float alpha, cl::sycl::buffer<float, 1> &a, int64_t lda,
            cl::sycl::buffer<float, 1> &b, int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c,
@@ -308,5 +519,644 @@ void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose
     });
 }
 
+// Converts the m x n matrix a into b on the host with the given kernel.
+template <typename K, typename T_src_raw, typename T_dest_raw, typename T_src, typename T_dest>
+static inline void convert_submit(cl::sycl::queue &queue,
+                                  void (*kernel)(const T_src_raw *, T_dest_raw *, int64_t),
+                                  int64_t m, int64_t n, cl::sycl::buffer<T_src, 1> &a, int64_t lda,
+                                  cl::sycl::buffer<T_dest, 1> &b, int64_t ldb) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.template get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.template get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<K>(cgh, [=]() {
+            const T_src_raw *a_mat =
+                static_cast<const T_src_raw *>(static_cast<void *>(accessor_a.get_pointer()));
+            T_dest_raw *b_mat =
+                static_cast<T_dest_raw *>(static_cast<void *>(accessor_b.get_pointer()));
+            convert_matrix(kernel, m, n, a_mat, lda, b_mat, ldb);
+        });
+    });
+}
+
+void convert(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<half, 1> &x,
+             cl::sycl::buffer<float, 1> &y) {
+    convert_submit<class mkl_kernel_convert_f16f32>(queue, convert_f16_to_f32, n, 1, x, n, y, n);
+}
+
+void convert(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x,
+             cl::sycl::buffer<half, 1> &y) {
+    convert_submit<class mkl_kernel_convert_f32f16>(queue, convert_f32_to_f16, n, 1, x, n, y, n);
+}
+
+void convert(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<bfloat16, 1> &x,
+             cl::sycl::buffer<float, 1> &y) {
+    convert_submit<class mkl_kernel_convert_bf16f32>(queue, convert_bf16_to_f32, n, 1, x, n, y,
+                                                     n);
+}
+
+void convert(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x,
+             cl::sycl::buffer<bfloat16, 1> &y) {
+    convert_submit<class mkl_kernel_convert_f32bf16>(queue, convert_f32_to_bf16, n, 1, x, n, y,
+                                                     n);
+}
+
+void convert(cl::sycl::queue &queue, int64_t m, int64_t n, cl::sycl::buffer<half, 1> &a,
+             int64_t lda, cl::sycl::buffer<float, 1> &b, int64_t ldb) {
+    convert_submit<class mkl_kernel_convert_f16f32_matrix>(queue, convert_f16_to_f32, m, n, a, lda,
+                                                           b, ldb);
+}
+
+void convert(cl::sycl::queue &queue, int64_t m, int64_t n, cl::sycl::buffer<float, 1> &a,
+             int64_t lda, cl::sycl::buffer<half, 1> &b, int64_t ldb) {
+    convert_submit<class mkl_kernel_convert_f32f16_matrix>(queue, convert_f32_to_f16, m, n, a, lda,
+                                                           b, ldb);
+}
+
+void convert(cl::sycl::queue &queue, int64_t m, int64_t n, cl::sycl::buffer<bfloat16, 1> &a,
+             int64_t lda, cl::sycl::buffer<float, 1> &b, int64_t ldb) {
+    convert_submit<class mkl_kernel_convert_bf16f32_matrix>(queue, convert_bf16_to_f32, m, n, a,
+                                                            lda, b, ldb);
+}
+
+void convert(cl::sycl::queue &queue, int64_t m, int64_t n, cl::sycl::buffer<float, 1> &a,
+             int64_t lda, cl::sycl::buffer<bfloat16, 1> &b, int64_t ldb) {
+    convert_submit<class mkl_kernel_convert_f32bf16_matrix>(queue, convert_f32_to_bf16, m, n, a,
+                                                            lda, b, ldb);
+}
+
+// Out-of-place scaled copy B = alpha * op(A) of an m x n matrix A with
+//  mkl_?omatcopy, which blocks the transposition for the cache.
+template <typename K, typename T, typename F>
+static inline void omatcopy_submit(cl::sycl::queue &queue, F omatcopy, transpose trans, int64_t m,
+                                   int64_t n, T alpha, cl::sycl::buffer<T, 1> &a, int64_t lda,
+                                   cl::sycl::buffer<T, 1> &b, int64_t ldb) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.template get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.template get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<K>(cgh, [=]() {
+            omatcopy('C', *fortran_char(trans), m, n, alpha, accessor_a.get_pointer(), lda,
+                     accessor_b.get_pointer(), ldb);
+        });
+    });
+}
+
+// In-place scaled copy AB = alpha * op(AB) with mkl_?imatcopy, lda and ldb
+//  being the leading dimensions of AB before and after the operation.
+template <typename K, typename T, typename F>
+static inline void imatcopy_submit(cl::sycl::queue &queue, F imatcopy, transpose trans, int64_t m,
+                                   int64_t n, T alpha, cl::sycl::buffer<T, 1> &ab, int64_t lda,
+                                   int64_t ldb) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_ab = ab.template get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<K>(cgh, [=]() {
+            imatcopy('C', *fortran_char(trans), m, n, alpha, accessor_ab.get_pointer(), lda, ldb);
+        });
+    });
+}
+
+// C = alpha * op(A) + beta * op(B) for an m x n C with mkl_?omatadd.
+template <typename K, typename T, typename F>
+static inline void omatadd_submit(cl::sycl::queue &queue, F omatadd, transpose transa,
+                                  transpose transb, int64_t m, int64_t n, T alpha,
+                                  cl::sycl::buffer<T, 1> &a, int64_t lda, T beta,
+                                  cl::sycl::buffer<T, 1> &b, int64_t ldb,
+                                  cl::sycl::buffer<T, 1> &c, int64_t ldc) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.template get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.template get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.template get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<K>(cgh, [=]() {
+            omatadd('C', *fortran_char(transa), *fortran_char(transb), m, n, alpha,
+                    accessor_a.get_pointer(), lda, beta, accessor_b.get_pointer(), ldb,
+                    accessor_c.get_pointer(), ldc);
+        });
+    });
+}
+
+void omatcopy(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
+              cl::sycl::buffer<float, 1> &a, int64_t lda, cl::sycl::buffer<float, 1> &b,
+              int64_t ldb) {
+    omatcopy_submit<class mkl_kernel_somatcopy>(queue, ::mkl_somatcopy, trans, m, n, alpha, a, lda,
+                                                b, ldb);
+}
+
+void omatcopy(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, double alpha,
+              cl::sycl::buffer<double, 1> &a, int64_t lda, cl::sycl::buffer<double, 1> &b,
+              int64_t ldb) {
+    omatcopy_submit<class mkl_kernel_domatcopy>(queue, ::mkl_domatcopy, trans, m, n, alpha, a, lda,
+                                                b, ldb);
+}
+
+void omatcopy(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+              std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+              cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb) {
+    omatcopy_submit<class mkl_kernel_comatcopy>(queue, ::mkl_comatcopy, trans, m, n, alpha, a, lda,
+                                                b, ldb);
+}
+
+void omatcopy(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+              std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
+              cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb) {
+    omatcopy_submit<class mkl_kernel_zomatcopy>(queue, ::mkl_zomatcopy, trans, m, n, alpha, a, lda,
+                                                b, ldb);
+}
+
+void imatcopy(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
+              cl::sycl::buffer<float, 1> &ab, int64_t lda, int64_t ldb) {
+    imatcopy_submit<class mkl_kernel_simatcopy>(queue, ::mkl_simatcopy, trans, m, n, alpha, ab, lda,
+                                                ldb);
+}
+
+void imatcopy(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, double alpha,
+              cl::sycl::buffer<double, 1> &ab, int64_t lda, int64_t ldb) {
+    imatcopy_submit<class mkl_kernel_dimatcopy>(queue, ::mkl_dimatcopy, trans, m, n, alpha, ab, lda,
+                                                ldb);
+}
+
+void imatcopy(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+              std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &ab, int64_t lda,
+              int64_t ldb) {
+    imatcopy_submit<class mkl_kernel_cimatcopy>(queue, ::mkl_cimatcopy, trans, m, n, alpha, ab, lda,
+                                                ldb);
+}
+
+void imatcopy(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+              std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &ab,
+              int64_t lda, int64_t ldb) {
+    imatcopy_submit<class mkl_kernel_zimatcopy>(queue, ::mkl_zimatcopy, trans, m, n, alpha, ab, lda,
+                                                ldb);
+}
+
+void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+             float alpha, cl::sycl::buffer<float, 1> &a, int64_t lda, float beta,
+             cl::sycl::buffer<float, 1> &b, int64_t ldb, cl::sycl::buffer<float, 1> &c,
+             int64_t ldc) {
+    omatadd_submit<class mkl_kernel_somatadd>(queue, ::mkl_somatadd, transa, transb, m, n, alpha, a,
+                                              lda, beta, b, ldb, c, ldc);
+}
+
+void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+             double alpha, cl::sycl::buffer<double, 1> &a, int64_t lda, double beta,
+             cl::sycl::buffer<double, 1> &b, int64_t ldb, cl::sycl::buffer<double, 1> &c,
+             int64_t ldc) {
+    omatadd_submit<class mkl_kernel_domatadd>(queue, ::mkl_domatadd, transa, transb, m, n, alpha, a,
+                                              lda, beta, b, ldb, c, ldc);
+}
+
+void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+             std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+             std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb,
+             cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    omatadd_submit<class mkl_kernel_comatadd>(queue, ::mkl_comatadd, transa, transb, m, n, alpha, a,
+                                              lda, beta, b, ldb, c, ldc);
+}
+
+void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+             std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
+             std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb,
+             cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    omatadd_submit<class mkl_kernel_zomatadd>(queue, ::mkl_zomatadd, transa, transb, m, n, alpha, a,
+                                              lda, beta, b, ldb, c, ldc);
+}
+
+// Full to packed storage of the upper_lower triangle of the n x n matrix A.
+template <typename K, typename T>
+static inline void trttp_submit(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
+                                cl::sycl::buffer<T, 1> &a, int64_t lda,
+                                cl::sycl::buffer<T, 1> &ap) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a  = a.template get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_ap = ap.template get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<K>(cgh, [=]() {
+            xtrttp_batch<T>(upper_lower, n, accessor_a.get_pointer(), lda, 0,
+                            accessor_ap.get_pointer(), 0, 1);
+        });
+    });
+}
+
+// Packed to full storage of the upper_lower triangle of the n x n matrix A.
+template <typename K, typename T>
+static inline void tpttr_submit(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
+                                cl::sycl::buffer<T, 1> &ap, cl::sycl::buffer<T, 1> &a,
+                                int64_t lda) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_ap = ap.template get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_a  = a.template get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<K>(cgh, [=]() {
+            xtpttr_batch<T>(upper_lower, n, accessor_ap.get_pointer(), 0, accessor_a.get_pointer(),
+                            lda, 0, 1);
+        });
+    });
+}
+
+// Full to band storage of the m x n matrix A with kl subdiagonals and ku
+//  superdiagonals.
+template <typename K, typename T>
+static inline void gettgb_submit(cl::sycl::queue &queue, int64_t m, int64_t n, int64_t kl,
+                                 int64_t ku, cl::sycl::buffer<T, 1> &a, int64_t lda,
+                                 cl::sycl::buffer<T, 1> &ab, int64_t ldab) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a  = a.template get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_ab = ab.template get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<K>(cgh, [=]() {
+            xgettgb_batch<T>(m, n, kl, ku, accessor_a.get_pointer(), lda, 0,
+                             accessor_ab.get_pointer(), ldab, 0, 1);
+        });
+    });
+}
+
+// Band to full storage of the m x n matrix A with kl subdiagonals and ku
+//  superdiagonals.
+template <typename K, typename T>
+static inline void gbtge_submit(cl::sycl::queue &queue, int64_t m, int64_t n, int64_t kl,
+                                int64_t ku, cl::sycl::buffer<T, 1> &ab, int64_t ldab,
+                                cl::sycl::buffer<T, 1> &a, int64_t lda) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_ab = ab.template get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_a  = a.template get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<K>(cgh, [=]() {
+            xgbtge_batch<T>(m, n, kl, ku, accessor_ab.get_pointer(), ldab, 0,
+                            accessor_a.get_pointer(), lda, 0, 1);
+        });
+    });
+}
+
+void trttp(cl::sycl::queue &queue, uplo upper_lower, int64_t n, cl::sycl::buffer<float, 1> &a,
+           int64_t lda, cl::sycl::buffer<float, 1> &ap) {
+    trttp_submit<class mkl_kernel_strttp>(queue, upper_lower, n, a, lda, ap);
+}
+
+void trttp(cl::sycl::queue &queue, uplo upper_lower, int64_t n, cl::sycl::buffer<double, 1> &a,
+           int64_t lda, cl::sycl::buffer<double, 1> &ap) {
+    trttp_submit<class mkl_kernel_dtrttp>(queue, upper_lower, n, a, lda, ap);
+}
+
+void trttp(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
+           cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+           cl::sycl::buffer<std::complex<float>, 1> &ap) {
+    trttp_submit<class mkl_kernel_ctrttp>(queue, upper_lower, n, a, lda, ap);
+}
+
+void trttp(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
+           cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
+           cl::sycl::buffer<std::complex<double>, 1> &ap) {
+    trttp_submit<class mkl_kernel_ztrttp>(queue, upper_lower, n, a, lda, ap);
+}
+
+void tpttr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, cl::sycl::buffer<float, 1> &ap,
+           cl::sycl::buffer<float, 1> &a, int64_t lda) {
+    tpttr_submit<class mkl_kernel_stpttr>(queue, upper_lower, n, ap, a, lda);
+}
+
+void tpttr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, cl::sycl::buffer<double, 1> &ap,
+           cl::sycl::buffer<double, 1> &a, int64_t lda) {
+    tpttr_submit<class mkl_kernel_dtpttr>(queue, upper_lower, n, ap, a, lda);
+}
+
+void tpttr(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
+           cl::sycl::buffer<std::complex<float>, 1> &ap,
+           cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda) {
+    tpttr_submit<class mkl_kernel_ctpttr>(queue, upper_lower, n, ap, a, lda);
+}
+
+void tpttr(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
+           cl::sycl::buffer<std::complex<double>, 1> &ap,
+           cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda) {
+    tpttr_submit<class mkl_kernel_ztpttr>(queue, upper_lower, n, ap, a, lda);
+}
+
+void gettgb(cl::sycl::queue &queue, int64_t m, int64_t n, int64_t kl, int64_t ku,
+            cl::sycl::buffer<float, 1> &a, int64_t lda, cl::sycl::buffer<float, 1> &ab,
+            int64_t ldab) {
+    gettgb_submit<class mkl_kernel_sgettgb>(queue, m, n, kl, ku, a, lda, ab, ldab);
+}
+
+void gettgb(cl::sycl::queue &queue, int64_t m, int64_t n, int64_t kl, int64_t ku,
+            cl::sycl::buffer<double, 1> &a, int64_t lda, cl::sycl::buffer<double, 1> &ab,
+            int64_t ldab) {
+    gettgb_submit<class mkl_kernel_dgettgb>(queue, m, n, kl, ku, a, lda, ab, ldab);
+}
+
+void gettgb(cl::sycl::queue &queue, int64_t m, int64_t n, int64_t kl, int64_t ku,
+            cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+            cl::sycl::buffer<std::complex<float>, 1> &ab, int64_t ldab) {
+    gettgb_submit<class mkl_kernel_cgettgb>(queue, m, n, kl, ku, a, lda, ab, ldab);
+}
+
+void gettgb(cl::sycl::queue &queue, int64_t m, int64_t n, int64_t kl, int64_t ku,
+            cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
+            cl::sycl::buffer<std::complex<double>, 1> &ab, int64_t ldab) {
+    gettgb_submit<class mkl_kernel_zgettgb>(queue, m, n, kl, ku, a, lda, ab, ldab);
+}
+
+void gbtge(cl::sycl::queue &queue, int64_t m, int64_t n, int64_t kl, int64_t ku,
+           cl::sycl::buffer<float, 1> &ab, int64_t ldab, cl::sycl::buffer<float, 1> &a,
+           int64_t lda) {
+    gbtge_submit<class mkl_kernel_sgbtge>(queue, m, n, kl, ku, ab, ldab, a, lda);
+}
+
+void gbtge(cl::sycl::queue &queue, int64_t m, int64_t n, int64_t kl, int64_t ku,
+           cl::sycl::buffer<double, 1> &ab, int64_t ldab, cl::sycl::buffer<double, 1> &a,
+           int64_t lda) {
+    gbtge_submit<class mkl_kernel_dgbtge>(queue, m, n, kl, ku, ab, ldab, a, lda);
+}
+
+void gbtge(cl::sycl::queue &queue, int64_t m, int64_t n, int64_t kl, int64_t ku,
+           cl::sycl::buffer<std::complex<float>, 1> &ab, int64_t ldab,
+           cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda) {
+    gbtge_submit<class mkl_kernel_cgbtge>(queue, m, n, kl, ku, ab, ldab, a, lda);
+}
+
+void gbtge(cl::sycl::queue &queue, int64_t m, int64_t n, int64_t kl, int64_t ku,
+           cl::sycl::buffer<std::complex<double>, 1> &ab, int64_t ldab,
+           cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda) {
+    gbtge_submit<class mkl_kernel_zgbtge>(queue, m, n, kl, ku, ab, ldab, a, lda);
+}
+
+// Reduction op of each row (rows set) or column of op(A), m x n, in one pass.
+template <typename K, typename T>
+static inline void reduce_submit(cl::sycl::queue &queue, reduction op, bool rows, transpose trans,
+                                 int64_t m, int64_t n, cl::sycl::buffer<T, 1> &a, int64_t lda,
+                                 cl::sycl::buffer<T, 1> &y, int64_t incy) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.template get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.template get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<K>(cgh, [=]() {
+            reduce_matrix<T>(op, rows, trans, m, n, accessor_a.get_pointer(), lda,
+                             accessor_y.get_pointer(), incy);
+        });
+    });
+}
+
+void reduce_rows(cl::sycl::queue &queue, reduction op, transpose trans, int64_t m, int64_t n,
+                 cl::sycl::buffer<float, 1> &a, int64_t lda, cl::sycl::buffer<float, 1> &y,
+                 int64_t incy) {
+    reduce_submit<class mkl_kernel_sreduce_rows>(queue, op, true, trans, m, n, a, lda, y, incy);
+}
+
+void reduce_rows(cl::sycl::queue &queue, reduction op, transpose trans, int64_t m, int64_t n,
+                 cl::sycl::buffer<double, 1> &a, int64_t lda, cl::sycl::buffer<double, 1> &y,
+                 int64_t incy) {
+    reduce_submit<class mkl_kernel_dreduce_rows>(queue, op, true, trans, m, n, a, lda, y, incy);
+}
+
+void reduce_columns(cl::sycl::queue &queue, reduction op, transpose trans, int64_t m, int64_t n,
+                    cl::sycl::buffer<float, 1> &a, int64_t lda, cl::sycl::buffer<float, 1> &y,
+                    int64_t incy) {
+    reduce_submit<class mkl_kernel_sreduce_columns>(queue, op, false, trans, m, n, a, lda, y,
+                                                    incy);
+}
+
+void reduce_columns(cl::sycl::queue &queue, reduction op, transpose trans, int64_t m, int64_t n,
+                    cl::sycl::buffer<double, 1> &a, int64_t lda, cl::sycl::buffer<double, 1> &y,
+                    int64_t incy) {
+    reduce_submit<class mkl_kernel_dreduce_columns>(queue, op, false, trans, m, n, a, lda, y,
+                                                    incy);
+}
+
+// Matrix norm of op(A), m x n, written to result[0].
+template <typename K, typename T>
+static inline void lange_submit(cl::sycl::queue &queue, norm_type norm, transpose trans, int64_t m,
+                                int64_t n, cl::sycl::buffer<T, 1> &a, int64_t lda,
+                                cl::sycl::buffer<T, 1> &result) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a      = a.template get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_result = result.template get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<K>(cgh, [=]() {
+            accessor_result[0] = matrix_norm<T>(norm, trans, m, n, accessor_a.get_pointer(), lda);
+        });
+    });
+}
+
+void lange(cl::sycl::queue &queue, norm_type norm, transpose trans, int64_t m, int64_t n,
+           cl::sycl::buffer<float, 1> &a, int64_t lda, cl::sycl::buffer<float, 1> &result) {
+    lange_submit<class mkl_kernel_slange>(queue, norm, trans, m, n, a, lda, result);
+}
+
+void lange(cl::sycl::queue &queue, norm_type norm, transpose trans, int64_t m, int64_t n,
+           cl::sycl::buffer<double, 1> &a, int64_t lda, cl::sycl::buffer<double, 1> &result) {
+    lange_submit<class mkl_kernel_dlange>(queue, norm, trans, m, n, a, lda, result);
+}
+
+// c = op(a, b, c) elementwise on m x n matrices whose rows are inc and columns
+//  ld apart, a vector being an m x 1 matrix.
+template <typename K, typename T, typename Op>
+static inline void elementwise_submit(cl::sycl::queue &queue, int64_t m, int64_t n,
+                                      cl::sycl::buffer<T, 1> &a, int64_t inca, int64_t lda,
+                                      cl::sycl::buffer<T, 1> &b, int64_t incb, int64_t ldb,
+                                      cl::sycl::buffer<T, 1> &c, int64_t incc, int64_t ldc, Op op) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.template get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.template get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.template get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<K>(cgh, [=]() {
+            elementwise<T>(m, n, accessor_a.get_pointer(), inca, lda, 0, accessor_b.get_pointer(),
+                           incb, ldb, 0, accessor_c.get_pointer(), incc, ldc, 0, 1, op);
+        });
+    });
+}
+
+void vmul(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
+          cl::sycl::buffer<float, 1> &y, int64_t incy, cl::sycl::buffer<float, 1> &z,
+          int64_t incz) {
+    elementwise_submit<class mkl_kernel_svmul>(queue, n, 1, x, incx, 0, y, incy, 0, z, incz, 0,
+                                               mul_op<float>{});
+}
+
+void vmul(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int64_t incx,
+          cl::sycl::buffer<double, 1> &y, int64_t incy, cl::sycl::buffer<double, 1> &z,
+          int64_t incz) {
+    elementwise_submit<class mkl_kernel_dvmul>(queue, n, 1, x, incx, 0, y, incy, 0, z, incz, 0,
+                                               mul_op<double>{});
+}
+
+void vmul(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
+          int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy,
+          cl::sycl::buffer<std::complex<float>, 1> &z, int64_t incz) {
+    elementwise_submit<class mkl_kernel_cvmul>(queue, n, 1, x, incx, 0, y, incy, 0, z, incz, 0,
+                                               mul_op<std::complex<float>>{});
+}
+
+void vmul(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x,
+          int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy,
+          cl::sycl::buffer<std::complex<double>, 1> &z, int64_t incz) {
+    elementwise_submit<class mkl_kernel_zvmul>(queue, n, 1, x, incx, 0, y, incy, 0, z, incz, 0,
+                                               mul_op<std::complex<double>>{});
+}
+
+void vdiv(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
+          cl::sycl::buffer<float, 1> &y, int64_t incy, cl::sycl::buffer<float, 1> &z,
+          int64_t incz) {
+    elementwise_submit<class mkl_kernel_svdiv>(queue, n, 1, x, incx, 0, y, incy, 0, z, incz, 0,
+                                               div_op<float>{});
+}
+
+void vdiv(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int64_t incx,
+          cl::sycl::buffer<double, 1> &y, int64_t incy, cl::sycl::buffer<double, 1> &z,
+          int64_t incz) {
+    elementwise_submit<class mkl_kernel_dvdiv>(queue, n, 1, x, incx, 0, y, incy, 0, z, incz, 0,
+                                               div_op<double>{});
+}
+
+void vdiv(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
+          int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy,
+          cl::sycl::buffer<std::complex<float>, 1> &z, int64_t incz) {
+    elementwise_submit<class mkl_kernel_cvdiv>(queue, n, 1, x, incx, 0, y, incy, 0, z, incz, 0,
+                                               div_op<std::complex<float>>{});
+}
+
+void vdiv(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x,
+          int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy,
+          cl::sycl::buffer<std::complex<double>, 1> &z, int64_t incz) {
+    elementwise_submit<class mkl_kernel_zvdiv>(queue, n, 1, x, incx, 0, y, incy, 0, z, incz, 0,
+                                               div_op<std::complex<double>>{});
+}
+
+void vfma(cl::sycl::queue &queue, int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+          int64_t incx, cl::sycl::buffer<float, 1> &y, int64_t incy, float beta,
+          cl::sycl::buffer<float, 1> &z, int64_t incz) {
+    elementwise_submit<class mkl_kernel_svfma>(queue, n, 1, x, incx, 0, y, incy, 0, z, incz, 0,
+                                               fma_op<float>{ alpha, beta });
+}
+
+void vfma(cl::sycl::queue &queue, int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
+          int64_t incx, cl::sycl::buffer<double, 1> &y, int64_t incy, double beta,
+          cl::sycl::buffer<double, 1> &z, int64_t incz) {
+    elementwise_submit<class mkl_kernel_dvfma>(queue, n, 1, x, incx, 0, y, incy, 0, z, incz, 0,
+                                               fma_op<double>{ alpha, beta });
+}
+
+void vfma(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
+          cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy, std::complex<float> beta,
+          cl::sycl::buffer<std::complex<float>, 1> &z, int64_t incz) {
+    elementwise_submit<class mkl_kernel_cvfma>(queue, n, 1, x, incx, 0, y, incy, 0, z, incz, 0,
+                                               fma_op<std::complex<float>>{ alpha, beta });
+}
+
+void vfma(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
+          cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy, std::complex<double> beta,
+          cl::sycl::buffer<std::complex<double>, 1> &z, int64_t incz) {
+    elementwise_submit<class mkl_kernel_zvfma>(queue, n, 1, x, incx, 0, y, incy, 0, z, incz, 0,
+                                               fma_op<std::complex<double>>{ alpha, beta });
+}
+
+void vclamp(cl::sycl::queue &queue, int64_t n, float lo, float hi, cl::sycl::buffer<float, 1> &x,
+            int64_t incx, cl::sycl::buffer<float, 1> &y, int64_t incy) {
+    elementwise_submit<class mkl_kernel_svclamp>(queue, n, 1, x, incx, 0, x, incx, 0, y, incy, 0,
+                                                 clamp_op<float>{ lo, hi });
+}
+
+void vclamp(cl::sycl::queue &queue, int64_t n, double lo, double hi, cl::sycl::buffer<double, 1> &x,
+            int64_t incx, cl::sycl::buffer<double, 1> &y, int64_t incy) {
+    elementwise_submit<class mkl_kernel_dvclamp>(queue, n, 1, x, incx, 0, x, incx, 0, y, incy, 0,
+                                                 clamp_op<double>{ lo, hi });
+}
+
+void omatmul(cl::sycl::queue &queue, int64_t m, int64_t n, cl::sycl::buffer<float, 1> &a,
+             int64_t lda, cl::sycl::buffer<float, 1> &b, int64_t ldb, cl::sycl::buffer<float, 1> &c,
+             int64_t ldc) {
+    elementwise_submit<class mkl_kernel_somatmul>(queue, m, n, a, 1, lda, b, 1, ldb, c, 1, ldc,
+                                                  mul_op<float>{});
+}
+
+void omatmul(cl::sycl::queue &queue, int64_t m, int64_t n, cl::sycl::buffer<double, 1> &a,
+             int64_t lda, cl::sycl::buffer<double, 1> &b, int64_t ldb,
+             cl::sycl::buffer<double, 1> &c, int64_t ldc) {
+    elementwise_submit<class mkl_kernel_domatmul>(queue, m, n, a, 1, lda, b, 1, ldb, c, 1, ldc,
+                                                  mul_op<double>{});
+}
+
+void omatmul(cl::sycl::queue &queue, int64_t m, int64_t n,
+             cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+             cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb,
+             cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    elementwise_submit<class mkl_kernel_comatmul>(queue, m, n, a, 1, lda, b, 1, ldb, c, 1, ldc,
+                                                  mul_op<std::complex<float>>{});
+}
+
+void omatmul(cl::sycl::queue &queue, int64_t m, int64_t n,
+             cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
+             cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb,
+             cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    elementwise_submit<class mkl_kernel_zomatmul>(queue, m, n, a, 1, lda, b, 1, ldb, c, 1, ldc,
+                                                  mul_op<std::complex<double>>{});
+}
+
+void omatdiv(cl::sycl::queue &queue, int64_t m, int64_t n, cl::sycl::buffer<float, 1> &a,
+             int64_t lda, cl::sycl::buffer<float, 1> &b, int64_t ldb, cl::sycl::buffer<float, 1> &c,
+             int64_t ldc) {
+    elementwise_submit<class mkl_kernel_somatdiv>(queue, m, n, a, 1, lda, b, 1, ldb, c, 1, ldc,
+                                                  div_op<float>{});
+}
+
+void omatdiv(cl::sycl::queue &queue, int64_t m, int64_t n, cl::sycl::buffer<double, 1> &a,
+             int64_t lda, cl::sycl::buffer<double, 1> &b, int64_t ldb,
+             cl::sycl::buffer<double, 1> &c, int64_t ldc) {
+    elementwise_submit<class mkl_kernel_domatdiv>(queue, m, n, a, 1, lda, b, 1, ldb, c, 1, ldc,
+                                                  div_op<double>{});
+}
+
+void omatdiv(cl::sycl::queue &queue, int64_t m, int64_t n,
+             cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+             cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb,
+             cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    elementwise_submit<class mkl_kernel_comatdiv>(queue, m, n, a, 1, lda, b, 1, ldb, c, 1, ldc,
+                                                  div_op<std::complex<float>>{});
+}
+
+void omatdiv(cl::sycl::queue &queue, int64_t m, int64_t n,
+             cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
+             cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb,
+             cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    elementwise_submit<class mkl_kernel_zomatdiv>(queue, m, n, a, 1, lda, b, 1, ldb, c, 1, ldc,
+                                                  div_op<std::complex<double>>{});
+}
+
+void omatfma(cl::sycl::queue &queue, int64_t m, int64_t n, float alpha,
+             cl::sycl::buffer<float, 1> &a, int64_t lda, cl::sycl::buffer<float, 1> &b, int64_t ldb,
+             float beta, cl::sycl::buffer<float, 1> &c, int64_t ldc) {
+    elementwise_submit<class mkl_kernel_somatfma>(queue, m, n, a, 1, lda, b, 1, ldb, c, 1, ldc,
+                                                  fma_op<float>{ alpha, beta });
+}
+
+void omatfma(cl::sycl::queue &queue, int64_t m, int64_t n, double alpha,
+             cl::sycl::buffer<double, 1> &a, int64_t lda, cl::sycl::buffer<double, 1> &b,
+             int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c, int64_t ldc) {
+    elementwise_submit<class mkl_kernel_domatfma>(queue, m, n, a, 1, lda, b, 1, ldb, c, 1, ldc,
+                                                  fma_op<double>{ alpha, beta });
+}
+
+void omatfma(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<float> alpha,
+             cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+             cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, std::complex<float> beta,
+             cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    elementwise_submit<class mkl_kernel_comatfma>(queue, m, n, a, 1, lda, b, 1, ldb, c, 1, ldc,
+                                                  fma_op<std::complex<float>>{ alpha, beta });
+}
+
+void omatfma(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<double> alpha,
+             cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
+             cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, std::complex<double> beta,
+             cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    elementwise_submit<class mkl_kernel_zomatfma>(queue, m, n, a, 1, lda, b, 1, ldb, c, 1, ldc,
+                                                  fma_op<std::complex<double>>{ alpha, beta });
+}
+
+void omatclamp(cl::sycl::queue &queue, int64_t m, int64_t n, float lo, float hi,
+               cl::sycl::buffer<float, 1> &a, int64_t lda, cl::sycl::buffer<float, 1> &b,
+               int64_t ldb) {
+    elementwise_submit<class mkl_kernel_somatclamp>(queue, m, n, a, 1, lda, a, 1, lda, b, 1, ldb,
+                                                    clamp_op<float>{ lo, hi });
+}
+
+void omatclamp(cl::sycl::queue &queue, int64_t m, int64_t n, double lo, double hi,
+               cl::sycl::buffer<double, 1> &a, int64_t lda, cl::sycl::buffer<double, 1> &b,
+               int64_t ldb) {
+    elementwise_submit<class mkl_kernel_domatclamp>(queue, m, n, a, 1, lda, a, 1, lda, b, 1, ldb,
+                                                    clamp_op<double>{ lo, hi });
+}
+
 } // namespace mklcpu
 } // namespace onemkl
@@ -0,0 +1,138 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_CPU_HGEMM_HPP_
+#define _MKL_CPU_HGEMM_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "cpu_common.hpp"
+#include "cpu_convert.hpp"
+#include "fp16.hpp"
+
+namespace onemkl {
+namespace mklcpu {
+
+// Tile sizes used by the half precision gemm paths. C is processed in
+// tiles of half_gemm_m_block x half_gemm_n_block and k in blocks of
+// half_gemm_k_block. Each half_gemm_k_block x half_gemm_n_block block of op(B)
+// is converted to float once and shared by every block of rows.
+static constexpr int64_t half_gemm_m_block = 512;
+static constexpr int64_t half_gemm_n_block = 512;
+static constexpr int64_t half_gemm_k_block = 256;
+
+// Converts the block of op(a) with rows [row, row + rows) and columns
+// [col, col + cols) into dest, keeping the storage orientation of a so that
+// the result can be passed to sgemm with the same transpose value.
+// Returns the leading dimension of the converted block.
+static inline int64_t convert_op_block(const uint16_t *a, transpose trans, int64_t lda, int64_t row,
+                                       int64_t col, int64_t rows, int64_t cols, float *dest,
+                                       bool threaded) {
+    if (trans == transpose::N) {
+        convert_matrix(convert_f16_to_f32, rows, cols, a + row + lda * col, lda, dest, rows,
+                       threaded);
+        return std::max(rows, (int64_t)1);
+    }
+    convert_matrix(convert_f16_to_f32, cols, rows, a + col + lda * row, lda, dest, cols, threaded);
+    return std::max(cols, (int64_t)1);
+}
+
+// Returns the float tile of C with rows [row, row + rows) and columns
+// [col, col + cols). A float C is updated in place, an fp16 C is converted
+// into c_tile and written back by store_c_tile.
+static inline float *load_c_tile(float *c, int64_t ldc, int64_t row, int64_t col, int64_t rows,
+                                 int64_t cols, float *c_tile, int64_t &ld_tile, bool threaded) {
+    ld_tile = ldc;
+    return c + row + ldc * col;
+}
+
+static inline float *load_c_tile(uint16_t *c, int64_t ldc, int64_t row, int64_t col, int64_t rows,
+                                 int64_t cols, float *c_tile, int64_t &ld_tile, bool threaded) {
+    convert_matrix(convert_f16_to_f32, rows, cols, c + row + ldc * col, ldc, c_tile, rows,
+                   threaded);
+    ld_tile = rows;
+    return c_tile;
+}
+
+static inline void store_c_tile(float *c, int64_t ldc, int64_t row, int64_t col, int64_t rows,
+                                int64_t cols, float *c_tile, bool threaded) {}
+
+static inline void store_c_tile(uint16_t *c, int64_t ldc, int64_t row, int64_t col, int64_t rows,
+                                int64_t cols, float *c_tile, bool threaded) {
+    convert_matrix(convert_f32_to_f16, rows, cols, c_tile, rows, c + row + ldc * col, ldc,
+                   threaded);
+}
+
+// Computes C = alpha * op(A) * op(B) + beta * C for fp16 A and B one tile at a
+// time in float. b_tile holds half_gemm_k_block x half_gemm_n_block floats and
+// c_tile is only used when C is an fp16 matrix, which is then rounded to fp16
+// after every k block. Conversions are split across threads unless threaded is
+// false, and stay on the calling thread wherever MKL is single threaded, as in
+// the chunks of a batch split across threads.
+template <typename T_c>
+static inline void gemm_f16_blocked(transpose transa, transpose transb, int64_t m, int64_t n,
+                                    int64_t k, float alpha, const uint16_t *a, int64_t lda,
+                                    const uint16_t *b, int64_t ldb, float beta, T_c *c, int64_t ldc,
+                                    float *a_tile, float *b_tile, float *c_tile,
+                                    bool threaded = true) {
+    const char transa_ = *fortran_char(transa);
+    const char transb_ = *fortran_char(transb);
+    for (int64_t jj = 0; jj < n; jj += half_gemm_n_block) {
+        const int64_t nc = std::min(half_gemm_n_block, n - jj);
+        // The first k block applies beta to every tile of C, the following ones
+        // accumulate. k == 0 still takes one pass so that C is scaled by beta.
+        for (int64_t kk = 0; kk == 0 || kk < k; kk += half_gemm_k_block) {
+            const int64_t kc       = std::min(half_gemm_k_block, k - kk);
+            const float beta_      = (kk == 0) ? beta : 1.0f;
+            const int64_t ldb_tile =
+                convert_op_block(b, transb, ldb, kk, jj, kc, nc, b_tile, threaded);
+            for (int64_t ii = 0; ii < m; ii += half_gemm_m_block) {
+                const int64_t mc = std::min(half_gemm_m_block, m - ii);
+                int64_t ldc_tile;
+                float *c_ptr     = load_c_tile(c, ldc, ii, jj, mc, nc, c_tile, ldc_tile, threaded);
+                int64_t lda_tile =
+                    convert_op_block(a, transa, lda, ii, kk, mc, kc, a_tile, threaded);
+                ::sgemm((const char *)&transa_, (const char *)&transb_, (const MKL_INT *)&mc,
+                        (const MKL_INT *)&nc, (const MKL_INT *)&kc, (const float *)&alpha, a_tile,
+                        (const MKL_INT *)&lda_tile, b_tile, (const MKL_INT *)&ldb_tile,
+                        (const float *)&beta_, c_ptr, (const MKL_INT *)&ldc_tile);
+                store_c_tile(c, ldc, ii, jj, mc, nc, c_tile, threaded);
+            }
+        }
+    }
+}
+
+// Float scratch for one tile of op(A), one block of op(B) and one tile of C,
+// sized for products of at most m x n x k. Batched paths allocate it once per
+// thread and reuse it for every problem, c only being needed for an fp16 C.
+struct half_gemm_tiles {
+    half_gemm_tiles(int64_t m, int64_t n, int64_t k, bool fp16_c)
+            : a(std::min(m, half_gemm_m_block) * std::min(k, half_gemm_k_block)),
+              b(std::min(k, half_gemm_k_block) * std::min(n, half_gemm_n_block)),
+              c(fp16_c ? std::min(m, half_gemm_m_block) * std::min(n, half_gemm_n_block) : 0) {}
+
+    std::vector<float> a, b, c;
+};
+
+} // namespace mklcpu
+} // namespace onemkl
+
+#endif //_MKL_CPU_HGEMM_HPP_
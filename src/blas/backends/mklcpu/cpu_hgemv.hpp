@@ -0,0 +1,162 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_CPU_HGEMV_HPP_
+#define _MKL_CPU_HGEMV_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "cpu_common.hpp"
+#include "cpu_convert.hpp"
+
+namespace onemkl {
+namespace mklcpu {
+
+// Mixed precision gemv y = alpha * op(A) * x + beta * y for an fp16 or bf16 A,
+//  stored as raw 16-bit values, and float x and y, accumulated in float. A is
+//  the only large operand, so it is read exactly once and converted
+//  hgemv_block values at a time into a scratch array that stays in L1: no
+//  float copy of the matrix is ever made and the bytes read are halved.
+static constexpr int64_t hgemv_block = 256;
+
+// Number of entries of A below which gemv is not worth splitting across
+//  threads.
+static constexpr int64_t hgemv_grain = 1 << 16;
+
+// Index of the i-th of n entries of a vector with increment inc.
+static inline int64_t hgemv_index(int64_t i, int64_t n, int64_t inc) {
+    return (inc > 0) ? i * inc : (n - 1 - i) * -inc;
+}
+
+// y[i] = acc[i] + beta * y[i], y not being read when beta is zero.
+static inline void hgemv_update(int64_t n, const float *acc, float beta, float *y, int64_t n_y,
+                                int64_t incy, int64_t first) {
+    for (int64_t i = 0; i < n; i++) {
+        float &y_i = y[hgemv_index(first + i, n_y, incy)];
+        y_i        = (beta == 0.0f) ? acc[i] : acc[i] + beta * y_i;
+    }
+}
+
+// y = alpha * A * x + beta * y. Threads take contiguous ranges of rows and
+//  stream the matching part of every column of A, so both A and their part of
+//  y are accessed contiguously.
+static inline void hgemv_n(void (*kernel)(const uint16_t *, float *, int64_t), int64_t m,
+                           int64_t n, const uint16_t *a, int64_t lda, const float *x_alpha,
+                           float beta, float *y, int64_t incy, bool threaded) {
+    const int64_t grain = threaded ? std::max<int64_t>(hgemv_grain / n, 1) : m;
+    parallel_for(m, grain, [=](int64_t begin, int64_t end) {
+        std::vector<float> acc(end - begin, 0.0f);
+        float a_block[hgemv_block];
+        for (int64_t j = 0; j < n; j++) {
+            const float x_j = x_alpha[j];
+            for (int64_t i = begin; i < end; i += hgemv_block) {
+                const int64_t len = std::min(hgemv_block, end - i);
+                kernel(a + i + j * lda, a_block, len);
+                float *acc_i = acc.data() + (i - begin);
+                for (int64_t l = 0; l < len; l++)
+                    acc_i[l] += a_block[l] * x_j;
+            }
+        }
+        hgemv_update(end - begin, acc.data(), beta, y, m, incy, begin);
+    });
+}
+
+// Number of independent partial sums of the dot products of hgemv_t, enough
+//  to fill the vector units.
+static constexpr int64_t hgemv_lanes = 16;
+
+// y = alpha * A^T * x + beta * y. Threads take contiguous ranges of columns,
+//  each entry of y being the dot product of one column with x.
+static inline void hgemv_t(void (*kernel)(const uint16_t *, float *, int64_t), int64_t m,
+                           int64_t n, const uint16_t *a, int64_t lda, const float *x_alpha,
+                           float beta, float *y, int64_t incy, bool threaded) {
+    const int64_t grain = threaded ? std::max<int64_t>(hgemv_grain / m, 1) : n;
+    parallel_for(n, grain, [=](int64_t begin, int64_t end) {
+        std::vector<float> acc(end - begin);
+        float a_block[hgemv_block];
+        for (int64_t j = begin; j < end; j++) {
+            float sum[hgemv_lanes] = { 0.0f };
+            for (int64_t i = 0; i < m; i += hgemv_block) {
+                const int64_t len = std::min(hgemv_block, m - i);
+                kernel(a + i + j * lda, a_block, len);
+                const float *x_i = x_alpha + i;
+                int64_t l        = 0;
+                for (; l + hgemv_lanes <= len; l += hgemv_lanes)
+                    for (int64_t lane = 0; lane < hgemv_lanes; lane++)
+                        sum[lane] += a_block[l + lane] * x_i[l + lane];
+                for (; l < len; l++)
+                    sum[l % hgemv_lanes] += a_block[l] * x_i[l];
+            }
+            float total = 0.0f;
+            for (int64_t l = 0; l < hgemv_lanes; l++)
+                total += sum[l];
+            acc[j - begin] = total;
+        }
+        hgemv_update(end - begin, acc.data(), beta, y, n, incy, begin);
+    });
+}
+
+// Mixed precision gemv on the host, kernel converting A to float. alpha is
+//  folded into a contiguous copy of x. threaded set to false keeps A on the
+//  calling thread, as does a single threaded MKL inside the chunks of a batch.
+static inline void hgemv(void (*kernel)(const uint16_t *, float *, int64_t), transpose trans,
+                         int64_t m, int64_t n, float alpha, const uint16_t *a, int64_t lda,
+                         const float *x, int64_t incx, float beta, float *y, int64_t incy,
+                         bool threaded = true) {
+    if (m <= 0 || n <= 0)
+        return;
+    const bool nontrans = (trans == transpose::nontrans);
+    const int64_t len_x = nontrans ? n : m;
+    const int64_t len_y = nontrans ? m : n;
+    if (alpha == 0.0f) {
+        std::vector<float> zero(len_y, 0.0f);
+        hgemv_update(len_y, zero.data(), beta, y, len_y, incy, 0);
+        return;
+    }
+    std::vector<float> x_alpha(len_x);
+    for (int64_t i = 0; i < len_x; i++)
+        x_alpha[i] = alpha * x[hgemv_index(i, len_x, incx)];
+    if (nontrans)
+        hgemv_n(kernel, m, n, a, lda, x_alpha.data(), beta, y, incy, threaded);
+    else
+        hgemv_t(kernel, m, n, a, lda, x_alpha.data(), beta, y, incy, threaded);
+}
+
+// Mixed precision gemv of a strided batch. Matrices of at least hgemv_grain
+//  elements are threaded one after the other, as batch_parallel_for does with
+//  large problems; smaller ones follow batch_parallel_for.
+static inline void hgemv_batch(void (*kernel)(const uint16_t *, float *, int64_t),
+                               transpose trans, int64_t m, int64_t n, float alpha,
+                               const uint16_t *a, int64_t lda, int64_t stride_a, const float *x,
+                               int64_t incx, int64_t stride_x, float beta, float *y, int64_t incy,
+                               int64_t stride_y, int64_t batch_size) {
+    const double work = (m * n >= hgemv_grain) ? batch_large_work : double(m) * n;
+    batch_parallel_for(batch_size, work, [=](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; i++)
+            hgemv(kernel, trans, m, n, alpha, a + stride_a * i, lda, x + stride_x * i, incx, beta,
+                  y + stride_y * i, incy);
+    });
+}
+
+} // namespace mklcpu
+} // namespace onemkl
+
+#endif //_MKL_CPU_HGEMV_HPP_
@@ -0,0 +1,302 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_CPU_IGEMM_HPP_
+#define _MKL_CPU_IGEMM_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "cpu_common.hpp"
+
+namespace onemkl {
+namespace mklcpu {
+
+// 8-bit integer gemm for the combinations MKL does not provide.
+//  int8 x uint8 and int8 x int8 products run through MKL gemm_s8u8s32 without
+//  offsets, B being shifted by 128 into uint8 in the second case, and the
+//  offsets and the shift are then removed exactly with the row sums of op(A)
+//  and the column sums of op(B). Other products use a blocked kernel: op(A) - ao
+//  and op(B) - bo are packed into 16-bit panels and products are accumulated
+//  in 32-bit integers one m_block x n_block tile at a time.
+//  In both cases every finished block of the int32 product is handed to an
+//  epilogue that writes C, so the int32 result never has to be stored for the
+//  whole matrix.
+//  Entries of (op(A) - ao) * (op(B) - bo) are exact as long as they fit in
+//  int32. Since |op(A) - ao| and |op(B) - bo| are at most 255, this always
+//  holds for k <= igemm_max_k. Longer products of large values wrap around.
+static constexpr int64_t igemm_max_k = (int64_t(1) << 31) / (255 * 255);
+
+namespace igemm_impl {
+
+static constexpr int64_t m_block = 64;
+static constexpr int64_t n_block = 64;
+static constexpr int64_t k_block = 512;
+
+// Number of int32 entries of the product computed by one MKL call. Blocks
+//  span whole columns of C and have at least n_block columns.
+static constexpr int64_t mkl_block = int64_t(1) << 22;
+
+// Packs vectors [v0, v0 + nv) of depth [p0, p0 + np) into dest, one vector of
+//  ld_dest values after the other. A vector is a row of op(A) or a column of
+//  op(B); depth_major tells whether its elements are contiguous in src.
+template <typename T>
+static inline void pack(const T *src, int64_t ld, bool depth_major, int64_t v0, int64_t nv,
+                        int64_t p0, int64_t np, int32_t off, int16_t *dest, int64_t ld_dest) {
+    if (depth_major) {
+        for (int64_t v = 0; v < nv; v++) {
+            const T *s = src + p0 + ld * (v0 + v);
+            int16_t *d = dest + ld_dest * v;
+            for (int64_t p = 0; p < np; p++)
+                d[p] = int16_t(int32_t(s[p]) - off);
+        }
+    }
+    else {
+        for (int64_t p = 0; p < np; p++) {
+            const T *s = src + v0 + ld * (p0 + p);
+            for (int64_t v = 0; v < nv; v++)
+                dest[ld_dest * v + p] = int16_t(int32_t(s[v]) - off);
+        }
+    }
+}
+
+// acc(i, j) (+)= sum_p a(i, p) * b(j, p) for a rows x cols tile. Four columns
+//  are processed together so each row of the A panel is loaded once per group.
+static inline void kernel(int64_t rows, int64_t cols, int64_t np, const int16_t *a, int64_t lda,
+                          const int16_t *b, int64_t ldb, int32_t *acc, int64_t ld_acc,
+                          bool first) {
+    int64_t j = 0;
+    for (; j + 4 <= cols; j += 4) {
+        const int16_t *b0 = b + ldb * j;
+        const int16_t *b1 = b0 + ldb;
+        const int16_t *b2 = b1 + ldb;
+        const int16_t *b3 = b2 + ldb;
+        for (int64_t i = 0; i < rows; i++) {
+            const int16_t *x = a + lda * i;
+            int32_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+            for (int64_t p = 0; p < np; p++) {
+                const int32_t xp = x[p];
+                s0 += xp * b0[p];
+                s1 += xp * b1[p];
+                s2 += xp * b2[p];
+                s3 += xp * b3[p];
+            }
+            int32_t *c = acc + i + ld_acc * j;
+            if (first) {
+                c[0]          = s0;
+                c[ld_acc]     = s1;
+                c[2 * ld_acc] = s2;
+                c[3 * ld_acc] = s3;
+            }
+            else {
+                c[0] += s0;
+                c[ld_acc] += s1;
+                c[2 * ld_acc] += s2;
+                c[3 * ld_acc] += s3;
+            }
+        }
+    }
+    for (; j < cols; j++) {
+        const int16_t *y = b + ldb * j;
+        for (int64_t i = 0; i < rows; i++) {
+            const int16_t *x = a + lda * i;
+            int32_t s        = 0;
+            for (int64_t p = 0; p < np; p++)
+                s += int32_t(x[p]) * y[p];
+            acc[i + ld_acc * j] = first ? s : acc[i + ld_acc * j] + s;
+        }
+    }
+}
+
+} // namespace igemm_impl
+
+// Computes (op(A) - ao) * (op(B) - bo) with 8-bit A and B and calls
+//  epilogue(row, col, rows, cols, acc, ld_acc) on every int32 tile of the
+//  product. Tiles are distributed across threads, so the epilogue may run
+//  concurrently on disjoint tiles.
+template <typename T_a, typename T_b, typename E>
+static inline void igemm(transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+                         const T_a *a, int64_t lda, int32_t ao, const T_b *b, int64_t ldb,
+                         int32_t bo, E epilogue) {
+    using namespace igemm_impl;
+    if (m <= 0 || n <= 0)
+        return;
+    const bool a_depth_major = (transa != transpose::nontrans);
+    const bool b_depth_major = (transb == transpose::nontrans);
+    const int64_t m_blocks   = (m + m_block - 1) / m_block;
+    const int64_t n_blocks   = (n + n_block - 1) / n_block;
+    const int64_t work       = m_block * std::max(k, int64_t(1)) * n_block;
+    const int64_t grain      = std::max<int64_t>((int64_t(1) << 22) / work, 1);
+
+    // Tiles are numbered down the columns of C, so that the tiles of a thread
+    //  mostly share their block of op(B), which is packed once for all of them.
+    parallel_for(m_blocks * n_blocks, grain, [=](int64_t begin, int64_t end) {
+        std::vector<int16_t> a_pack(m_block * std::min(k, k_block));
+        std::vector<int16_t> b_pack(n_block * k);
+        std::vector<int32_t> acc(m_block * n_block);
+        int64_t packed = -1;
+        for (int64_t t = begin; t < end; t++) {
+            const int64_t jb   = t / m_blocks;
+            const int64_t i0   = (t % m_blocks) * m_block;
+            const int64_t j0   = jb * n_block;
+            const int64_t rows = std::min(m_block, m - i0);
+            const int64_t cols = std::min(n_block, n - j0);
+            if (jb != packed) {
+                pack(b, ldb, b_depth_major, j0, cols, 0, k, bo, b_pack.data(), k);
+                packed = jb;
+            }
+            if (k == 0)
+                std::fill(acc.begin(), acc.end(), 0);
+            for (int64_t p0 = 0; p0 < k; p0 += k_block) {
+                const int64_t np = std::min(k_block, k - p0);
+                pack(a, lda, a_depth_major, i0, rows, p0, np, ao, a_pack.data(), np);
+                kernel(rows, cols, np, a_pack.data(), np, b_pack.data() + p0, k, acc.data(),
+                       m_block, p0 == 0);
+            }
+            epilogue(i0, j0, rows, cols, (const int32_t *)acc.data(), m_block);
+        }
+    });
+}
+
+namespace igemm_impl {
+
+// (op(A) - ao) * (op(B) - bo) through MKL gemm_s8u8s32, B being uint8 or int8.
+//  MKL computes op(A) * op(B') on blocks of columns, B' being op(B) copied to
+//  uint8 with every value increased by shift, which is 0 for uint8 and 128 for
+//  int8 B. With bo' = bo + shift, every entry is then corrected as
+//  acc = Q - bo' * ra_i - ao * cb_j + k * ao * bo', ra being the row sums of
+//  op(A) and cb the column sums of op(B'). The correction is done modulo 2^32,
+//  so it is exact whenever the result fits in int32.
+template <typename T_b, typename E>
+static inline void igemm_mkl(transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+                             const int8_t *a, int64_t lda, int32_t ao, const T_b *b, int64_t ldb,
+                             int32_t bo, uint8_t shift, E epilogue) {
+    if (m <= 0 || n <= 0)
+        return;
+    const bool a_nontrans = (transa == transpose::nontrans);
+    const bool b_nontrans = (transb == transpose::nontrans);
+    const int64_t nc_max  = std::min(std::max(mkl_block / m, n_block), n);
+    const int64_t ldq     = m;
+    const int64_t ld_pack = std::max(k, int64_t(1));
+    const uint32_t bo_    = uint32_t(bo + shift);
+    const uint32_t kab    = uint32_t(k) * uint32_t(ao) * bo_;
+
+    // Row sums of op(A).
+    std::vector<int64_t> ra(m, 0);
+    const int64_t grain_a = std::max<int64_t>((int64_t(1) << 16) / ld_pack, 1);
+    parallel_for(m, grain_a, [&](int64_t begin, int64_t end) {
+        if (a_nontrans) {
+            for (int64_t p = 0; p < k; p++) {
+                for (int64_t i = begin; i < end; i++)
+                    ra[i] += a[i + lda * p];
+            }
+        }
+        else {
+            for (int64_t i = begin; i < end; i++) {
+                for (int64_t p = 0; p < k; p++)
+                    ra[i] += a[p + lda * i];
+            }
+        }
+    });
+
+    std::vector<uint8_t> b_pack(ld_pack * nc_max);
+    std::vector<int64_t> cb(nc_max);
+    std::vector<int32_t> q(ldq * nc_max);
+    const char transa_       = *fortran_char(transa);
+    const char transb_       = 'N';
+    const char offsetc_      = 'F';
+    const float one          = 1.0f;
+    const float zero         = 0.0f;
+    const MKL_INT8 no_offset = 0;
+    const MKL_INT32 co       = 0;
+    const int64_t grain_b    = std::max<int64_t>((int64_t(1) << 16) / ld_pack, 1);
+    const int64_t grain_c    = std::max<int64_t>((int64_t(1) << 16) / m, 1);
+    for (int64_t j0 = 0; j0 < n; j0 += nc_max) {
+        const int64_t nc = std::min(nc_max, n - j0);
+
+        // op(B') and its column sums.
+        parallel_for(nc, grain_b, [&](int64_t begin, int64_t end) {
+            for (int64_t j = begin; j < end; j++) {
+                uint8_t *d         = b_pack.data() + ld_pack * j;
+                const T_b *src     = b + (b_nontrans ? ldb * (j0 + j) : j0 + j);
+                const int64_t incs = b_nontrans ? 1 : ldb;
+                int64_t sum        = 0;
+                for (int64_t p = 0; p < k; p++) {
+                    d[p] = uint8_t(src[incs * p] + shift);
+                    sum += d[p];
+                }
+                cb[j] = sum;
+            }
+        });
+
+        if (k > 0) {
+            ::gemm_s8u8s32(&transa_, &transb_, &offsetc_, (const MKL_INT *)&m,
+                           (const MKL_INT *)&nc, (const MKL_INT *)&k, &one, (const MKL_INT8 *)a,
+                           (const MKL_INT *)&lda, &no_offset, (const MKL_UINT8 *)b_pack.data(),
+                           (const MKL_INT *)&ld_pack, &no_offset, &zero, (MKL_INT32 *)q.data(),
+                           (const MKL_INT *)&ldq, &co);
+        }
+        else {
+            std::fill(q.begin(), q.end(), 0);
+        }
+
+        parallel_for(nc, grain_c, [&](int64_t begin, int64_t end) {
+            for (int64_t j = begin; j < end; j++) {
+                int32_t *q_col   = q.data() + ldq * j;
+                const uint32_t t = kab - uint32_t(ao) * uint32_t(cb[j]);
+                for (int64_t i = 0; i < m; i++)
+                    q_col[i] = int32_t(uint32_t(q_col[i]) - bo_ * uint32_t(ra[i]) + t);
+            }
+            epilogue(0, j0 + begin, m, end - begin, (const int32_t *)q.data() + ldq * begin, ldq);
+        });
+    }
+}
+
+} // namespace igemm_impl
+
+template <typename E>
+static inline void igemm(transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+                         const int8_t *a, int64_t lda, int32_t ao, const uint8_t *b, int64_t ldb,
+                         int32_t bo, E epilogue) {
+    igemm_impl::igemm_mkl(transa, transb, m, n, k, a, lda, ao, b, ldb, bo, 0, epilogue);
+}
+
+template <typename E>
+static inline void igemm(transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+                         const int8_t *a, int64_t lda, int32_t ao, const int8_t *b, int64_t ldb,
+                         int32_t bo, E epilogue) {
+    igemm_impl::igemm_mkl(transa, transb, m, n, k, a, lda, ao, b, ldb, bo, 128, epilogue);
+}
+
+// Rounds to nearest even and saturates to the range of T.
+template <typename T, typename F>
+static inline T round_saturate(F x) {
+    x = std::nearbyint(x);
+    x = std::max(x, F(std::numeric_limits<T>::min()));
+    x = std::min(x, F(std::numeric_limits<T>::max()));
+    return T(x);
+}
+
+} // namespace mklcpu
+} // namespace onemkl
+
+#endif //_MKL_CPU_IGEMM_HPP_
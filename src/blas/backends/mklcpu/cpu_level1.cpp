@@ -20,6 +20,7 @@
 #include <CL/sycl.hpp>
 
 #include "cpu_common.hpp"
+#include "cpu_reduce.hpp"
 
 namespace onemkl {
 namespace mklcpu {
@@ -36,6 +37,32 @@ void asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int6
     });
 }
 
+cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
+                     float *result) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_sasum_host>(cgh, [=]() {
+            *result =
+                ::sasum((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+        });
+    });
+}
+
+void asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
+          cl::sycl::buffer<float, 1> &result, accumulation acc) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class mkl_kernel_sasum_accumulation>(cgh, [=]() {
+            if (acc == accumulation::native)
+                accessor_result[0] =
+                    ::sasum((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+            else
+                accessor_result[0] = asum_accumulate(acc, n, accessor_x.get_pointer(), incx);
+        });
+    });
+}
+
 void asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int64_t incx,
           cl::sycl::buffer<double, 1> &result) {
     queue.submit([&](cl::sycl::handler &cgh) {
@@ -48,6 +75,17 @@ void asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int
     });
 }
 
+cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x,
+                     int64_t incx, double *result) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_dasum_host>(cgh, [=]() {
+            *result =
+                ::dasum((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+        });
+    });
+}
+
 void asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
           int64_t incx, cl::sycl::buffer<float, 1> &result) {
     queue.submit([&](cl::sycl::handler &cgh) {
@@ -60,6 +98,17 @@ void asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float
     });
 }
 
+cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
+                     int64_t incx, float *result) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_scasum_host>(cgh, [=]() {
+            *result =
+                ::scasum((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+        });
+    });
+}
+
 void asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x,
           int64_t incx, cl::sycl::buffer<double, 1> &result) {
     queue.submit([&](cl::sycl::handler &cgh) {
@@ -72,6 +121,146 @@ void asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doubl
     });
 }
 
+cl::sycl::event asum(cl::sycl::queue &queue, int64_t n,
+                     cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx, double *result) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_dzasum_host>(cgh, [=]() {
+            *result =
+                ::dzasum((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+        });
+    });
+}
+
+void axpby(cl::sycl::queue &queue, int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+           int64_t incx, float beta, cl::sycl::buffer<float, 1> &y, int64_t incy) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_saxpby>(cgh, [=]() {
+            ::saxpby((const MKL_INT *)&n, (const float *)&alpha, accessor_x.get_pointer(),
+                     (const MKL_INT *)&incx, (const float *)&beta, accessor_y.get_pointer(),
+                     (const MKL_INT *)&incy);
+        });
+    });
+}
+
+void axpby(cl::sycl::queue &queue, int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
+           int64_t incx, double beta, cl::sycl::buffer<double, 1> &y, int64_t incy) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_daxpby>(cgh, [=]() {
+            ::daxpby((const MKL_INT *)&n, (const double *)&alpha, accessor_x.get_pointer(),
+                     (const MKL_INT *)&incx, (const double *)&beta, accessor_y.get_pointer(),
+                     (const MKL_INT *)&incy);
+        });
+    });
+}
+
+void axpby(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
+           cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx, std::complex<float> beta,
+           cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        float beta_real = beta.real(), beta_imag = beta.imag();
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_caxpby>(cgh, [=]() {
+            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+            MKL_Complex8 beta_  = { beta_real, beta_imag };
+            ::caxpby((const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_, accessor_x.get_pointer(),
+                     (const MKL_INT *)&incx, (const MKL_Complex8 *)&beta_, accessor_y.get_pointer(),
+                     (const MKL_INT *)&incy);
+        });
+    });
+}
+
+void axpby(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
+           cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx, std::complex<double> beta,
+           cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        double beta_real = beta.real(), beta_imag = beta.imag();
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zaxpby>(cgh, [=]() {
+            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+            MKL_Complex16 beta_  = { beta_real, beta_imag };
+            ::zaxpby((const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_, accessor_x.get_pointer(),
+                     (const MKL_INT *)&incx, (const MKL_Complex16 *)&beta_,
+                     accessor_y.get_pointer(), (const MKL_INT *)&incy);
+        });
+    });
+}
+
+void axpbypcz(cl::sycl::queue &queue, int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+              int64_t incx, float beta, cl::sycl::buffer<float, 1> &y, int64_t incy, float gamma,
+              cl::sycl::buffer<float, 1> &z, int64_t incz) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto accessor_z = z.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_saxpbypcz>(cgh, [=]() {
+            axpbypcz_fused<float>(n, alpha, accessor_x.get_pointer(), incx, beta,
+                                  accessor_y.get_pointer(), incy, gamma, accessor_z.get_pointer(),
+                                  incz, nullptr, 1);
+        });
+    });
+}
+
+void axpbypcz(cl::sycl::queue &queue, int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
+              int64_t incx, double beta, cl::sycl::buffer<double, 1> &y, int64_t incy, double gamma,
+              cl::sycl::buffer<double, 1> &z, int64_t incz) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto accessor_z = z.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_daxpbypcz>(cgh, [=]() {
+            axpbypcz_fused<double>(n, alpha, accessor_x.get_pointer(), incx, beta,
+                                   accessor_y.get_pointer(), incy, gamma, accessor_z.get_pointer(),
+                                   incz, nullptr, 1);
+        });
+    });
+}
+
+void axpbypcz_dot(cl::sycl::queue &queue, int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+                  int64_t incx, float beta, cl::sycl::buffer<float, 1> &y, int64_t incy,
+                  float gamma, cl::sycl::buffer<float, 1> &z, int64_t incz,
+                  cl::sycl::buffer<float, 1> &w, int64_t incw, cl::sycl::buffer<float, 1> &result) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y      = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto accessor_z      = z.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_w      = w.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class mkl_kernel_saxpbypcz_dot>(cgh, [=]() {
+            accessor_result[0] = axpbypcz_fused<float>(
+                n, alpha, accessor_x.get_pointer(), incx, beta, accessor_y.get_pointer(), incy,
+                gamma, accessor_z.get_pointer(), incz, accessor_w.get_pointer(), incw);
+        });
+    });
+}
+
+void axpbypcz_dot(cl::sycl::queue &queue, int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
+                  int64_t incx, double beta, cl::sycl::buffer<double, 1> &y, int64_t incy,
+                  double gamma, cl::sycl::buffer<double, 1> &z, int64_t incz,
+                  cl::sycl::buffer<double, 1> &w, int64_t incw,
+                  cl::sycl::buffer<double, 1> &result) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y      = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        auto accessor_z      = z.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_w      = w.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class mkl_kernel_daxpbypcz_dot>(cgh, [=]() {
+            accessor_result[0] = axpbypcz_fused<double>(
+                n, alpha, accessor_x.get_pointer(), incx, beta, accessor_y.get_pointer(), incy,
+                gamma, accessor_z.get_pointer(), incz, accessor_w.get_pointer(), incw);
+        });
+    });
+}
+
 void axpy(cl::sycl::queue &queue, int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
           int64_t incx, cl::sycl::buffer<float, 1> &y, int64_t incy) {
     queue.submit([&](cl::sycl::handler &cgh) {
@@ -188,6 +377,37 @@ void dot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64
     });
 }
 
+cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
+                    cl::sycl::buffer<float, 1> &y, int64_t incy, float *result) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_sdot_host>(cgh, [=]() {
+            *result = ::sdot((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
+                             accessor_y.get_pointer(), (const MKL_INT *)&incy);
+        });
+    });
+}
+
+void dot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
+         cl::sycl::buffer<float, 1> &y, int64_t incy, cl::sycl::buffer<float, 1> &result,
+         accumulation acc) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y      = y.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class mkl_kernel_sdot_accumulation>(cgh, [=]() {
+            if (acc == accumulation::native)
+                accessor_result[0] =
+                    ::sdot((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
+                           accessor_y.get_pointer(), (const MKL_INT *)&incy);
+            else
+                accessor_result[0] = dot_accumulate(acc, n, accessor_x.get_pointer(), incx,
+                                                    accessor_y.get_pointer(), incy);
+        });
+    });
+}
+
 void dot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int64_t incx,
          cl::sycl::buffer<double, 1> &y, int64_t incy, cl::sycl::buffer<double, 1> &result) {
     queue.submit([&](cl::sycl::handler &cgh) {
@@ -202,6 +422,18 @@ void dot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int6
     });
 }
 
+cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int64_t incx,
+                    cl::sycl::buffer<double, 1> &y, int64_t incy, double *result) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_ddot_host>(cgh, [=]() {
+            *result = ::ddot((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
+                             accessor_y.get_pointer(), (const MKL_INT *)&incy);
+        });
+    });
+}
+
 void dot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
          cl::sycl::buffer<float, 1> &y, int64_t incy, cl::sycl::buffer<double, 1> &result) {
     queue.submit([&](cl::sycl::handler &cgh) {
@@ -216,6 +448,18 @@ void dot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64
     });
 }
 
+cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
+                    cl::sycl::buffer<float, 1> &y, int64_t incy, double *result) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_dsdot_host>(cgh, [=]() {
+            *result = ::dsdot((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
+                              accessor_y.get_pointer(), (const MKL_INT *)&incy);
+        });
+    });
+}
+
 void dotc(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
           int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy,
           cl::sycl::buffer<std::complex<float>, 1> &result) {
@@ -284,6 +528,16 @@ void iamin(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int
     });
 }
 
+cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x,
+                      int64_t incx, int64_t *result) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_isamin_host>(cgh, [=]() {
+            *result = ::cblas_isamin((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
+        });
+    });
+}
+
 void iamin(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int64_t incx,
            cl::sycl::buffer<int64_t, 1> &result) {
     queue.submit([&](cl::sycl::handler &cgh) {
@@ -296,6 +550,16 @@ void iamin(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, in
     });
 }
 
+cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x,
+                      int64_t incx, int64_t *result) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_idamin_host>(cgh, [=]() {
+            *result = ::cblas_idamin((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
+        });
+    });
+}
+
 void iamin(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
            int64_t incx, cl::sycl::buffer<int64_t, 1> &result) {
     queue.submit([&](cl::sycl::handler &cgh) {
@@ -308,6 +572,16 @@ void iamin(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<floa
     });
 }
 
+cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n,
+                      cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx, int64_t *result) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_icamin_host>(cgh, [=]() {
+            *result = ::cblas_icamin((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
+        });
+    });
+}
+
 void iamin(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x,
            int64_t incx, cl::sycl::buffer<int64_t, 1> &result) {
     queue.submit([&](cl::sycl::handler &cgh) {
@@ -320,6 +594,16 @@ void iamin(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doub
     });
 }
 
+cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n,
+                      cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx, int64_t *result) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_izamin_host>(cgh, [=]() {
+            *result = ::cblas_izamin((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
+        });
+    });
+}
+
 void iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
            cl::sycl::buffer<int64_t, 1> &result) {
     queue.submit([&](cl::sycl::handler &cgh) {
@@ -332,6 +616,16 @@ void iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int
     });
 }
 
+cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x,
+                      int64_t incx, int64_t *result) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_isamax_host>(cgh, [=]() {
+            *result = ::cblas_isamax((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
+        });
+    });
+}
+
 void iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int64_t incx,
            cl::sycl::buffer<int64_t, 1> &result) {
     queue.submit([&](cl::sycl::handler &cgh) {
@@ -344,6 +638,16 @@ void iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, in
     });
 }
 
+cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x,
+                      int64_t incx, int64_t *result) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_idamax_host>(cgh, [=]() {
+            *result = ::cblas_idamax((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
+        });
+    });
+}
+
 void iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
            int64_t incx, cl::sycl::buffer<int64_t, 1> &result) {
     queue.submit([&](cl::sycl::handler &cgh) {
@@ -356,6 +660,16 @@ void iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<floa
     });
 }
 
+cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n,
+                      cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx, int64_t *result) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_icamax_host>(cgh, [=]() {
+            *result = ::cblas_icamax((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
+        });
+    });
+}
+
 void iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x,
            int64_t incx, cl::sycl::buffer<int64_t, 1> &result) {
     queue.submit([&](cl::sycl::handler &cgh) {
@@ -368,6 +682,16 @@ void iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doub
     });
 }
 
+cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n,
+                      cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx, int64_t *result) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_izamax_host>(cgh, [=]() {
+            *result = ::cblas_izamax((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
+        });
+    });
+}
+
 void nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
           cl::sycl::buffer<float, 1> &result) {
     queue.submit([&](cl::sycl::handler &cgh) {
@@ -380,6 +704,32 @@ void nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int6
     });
 }
 
+cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
+                     float *result) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_snrm2_host>(cgh, [=]() {
+            *result =
+                ::snrm2((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+        });
+    });
+}
+
+void nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
+          cl::sycl::buffer<float, 1> &result, accumulation acc) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x      = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class mkl_kernel_snrm2_accumulation>(cgh, [=]() {
+            if (acc == accumulation::native)
+                accessor_result[0] =
+                    ::snrm2((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+            else
+                accessor_result[0] = nrm2_accumulate(acc, n, accessor_x.get_pointer(), incx);
+        });
+    });
+}
+
 void nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int64_t incx,
           cl::sycl::buffer<double, 1> &result) {
     queue.submit([&](cl::sycl::handler &cgh) {
@@ -392,6 +742,17 @@ void nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int
     });
 }
 
+cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x,
+                     int64_t incx, double *result) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_dnrm2_host>(cgh, [=]() {
+            *result =
+                ::dnrm2((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+        });
+    });
+}
+
 void nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
           int64_t incx, cl::sycl::buffer<float, 1> &result) {
     queue.submit([&](cl::sycl::handler &cgh) {
@@ -404,6 +765,17 @@ void nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float
     });
 }
 
+cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
+                     int64_t incx, float *result) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_scnrm2_host>(cgh, [=]() {
+            *result =
+                ::scnrm2((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+        });
+    });
+}
+
 void nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x,
           int64_t incx, cl::sycl::buffer<double, 1> &result) {
     queue.submit([&](cl::sycl::handler &cgh) {
@@ -416,6 +788,17 @@ void nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doubl
     });
 }
 
+cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n,
+                     cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx, double *result) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task<class mkl_kernel_dznrm2_host>(cgh, [=]() {
+            *result =
+                ::dznrm2((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+        });
+    });
+}
+
 void rot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
          cl::sycl::buffer<float, 1> &y, int64_t incy, float c, float s) {
     queue.submit([&](cl::sycl::handler &cgh) {
@@ -20,6 +20,7 @@
 #include <CL/sycl.hpp>
 
 #include "cpu_common.hpp"
+#include "cpu_hgemv.hpp"
 
 namespace onemkl {
 namespace mklcpu {
@@ -184,6 +185,41 @@ void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, std::co
     });
 }
 
+// gemv with an fp16 or bf16 A and float x and y, kernel converting A to float.
+template <typename K, typename T_a>
+static inline void hgemv_submit(cl::sycl::queue &queue,
+                                void (*kernel)(const uint16_t *, float *, int64_t),
+                                transpose trans, int64_t m, int64_t n, float alpha,
+                                cl::sycl::buffer<T_a, 1> &a, int64_t lda,
+                                cl::sycl::buffer<float, 1> &x, int64_t incx, float beta,
+                                cl::sycl::buffer<float, 1> &y, int64_t incy) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.template get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<K>(cgh, [=]() {
+            const uint16_t *a_mat =
+                static_cast<const uint16_t *>(static_cast<void *>(accessor_a.get_pointer()));
+            hgemv(kernel, trans, m, n, alpha, a_mat, lda, accessor_x.get_pointer(), incx, beta,
+                  accessor_y.get_pointer(), incy);
+        });
+    });
+}
+
+void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
+          cl::sycl::buffer<half, 1> &a, int64_t lda, cl::sycl::buffer<float, 1> &x, int64_t incx,
+          float beta, cl::sycl::buffer<float, 1> &y, int64_t incy) {
+    hgemv_submit<class mkl_kernel_gemv_f16f32>(queue, convert_f16_to_f32, trans, m, n, alpha, a,
+                                               lda, x, incx, beta, y, incy);
+}
+
+void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
+          cl::sycl::buffer<bfloat16, 1> &a, int64_t lda, cl::sycl::buffer<float, 1> &x,
+          int64_t incx, float beta, cl::sycl::buffer<float, 1> &y, int64_t incy) {
+    hgemv_submit<class mkl_kernel_gemv_bf16f32>(queue, convert_bf16_to_f32, trans, m, n, alpha, a,
+                                                lda, x, incx, beta, y, incy);
+}
+
 void ger(cl::sycl::queue &queue, int64_t m, int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
          int64_t incx, cl::sycl::buffer<float, 1> &y, int64_t incy, cl::sycl::buffer<float, 1> &a,
          int64_t lda) {
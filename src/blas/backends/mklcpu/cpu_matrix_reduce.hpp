@@ -0,0 +1,205 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_CPU_MATRIX_REDUCE_HPP_
+#define _MKL_CPU_MATRIX_REDUCE_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "cpu_common.hpp"
+#include "cpu_reduce.hpp"
+
+namespace onemkl {
+namespace mklcpu {
+
+// Reductions of the rows or columns of a column-major matrix, and matrix
+//  norms built on them, each in one pass over the matrix. Every entry is
+//  accumulated in double. Reducing the stored columns, threads take ranges
+//  of columns and sum each contiguous column pairwise. Reducing the stored
+//  rows, threads take ranges of rows and stream their part of every column
+//  into one accumulator per row, so the matrix is still read contiguously.
+
+// Largest absolute value, NaN if any of the values is NaN.
+static inline double max_nan(double acc, double v) {
+    return (v <= acc || std::isnan(acc)) ? acc : v;
+}
+
+// Euclidean norm from the sum of squares ssq of n values x[i * inc]. Squares
+//  of floats are exact and in range in double. Squares of doubles may over-
+//  or underflow, in which case the norm is computed again from the values
+//  scaled by the largest of them.
+template <typename T>
+static inline double norm_from_ssq(double ssq, int64_t n, const T *x, int64_t inc) {
+    if (std::is_same<T, float>::value || (std::isfinite(ssq) && ssq >= std::ldexp(double(n), -968)))
+        return std::sqrt(ssq);
+    double scale = 0.0;
+    for (int64_t i = 0; i < n; i++)
+        scale = max_nan(scale, std::abs(double(x[i * inc])));
+    if (scale == 0.0 || !std::isfinite(scale))
+        return scale;
+    ssq = sum_pairwise<double>(0, n, [=](int64_t i) {
+        const double v = double(x[i * inc]) / scale;
+        return v * v;
+    });
+    return scale * std::sqrt(ssq);
+}
+
+// Reduction op of the n contiguous values x.
+template <typename T>
+static inline double reduce_vector(reduction op, int64_t n, const T *x) {
+    switch (op) {
+        case reduction::sum:
+            return sum_pairwise<double>(0, n, [=](int64_t i) { return double(x[i]); });
+        case reduction::asum:
+            return sum_pairwise<double>(0, n, [=](int64_t i) { return std::abs(double(x[i])); });
+        case reduction::amax: {
+            double acc = 0.0;
+            for (int64_t i = 0; i < n; i++)
+                acc = max_nan(acc, std::abs(double(x[i])));
+            return acc;
+        }
+        default: {
+            const double ssq = sum_pairwise<double>(0, n, [=](int64_t i) {
+                return double(x[i]) * double(x[i]);
+            });
+            return norm_from_ssq(ssq, n, x, 1);
+        }
+    }
+}
+
+// out(j, r) for the reduction r of each column j of the rows x cols matrix a.
+template <typename T, typename F>
+static inline void reduce_stored_columns(reduction op, int64_t rows, int64_t cols, const T *a,
+                                         int64_t lda, F out) {
+    const int64_t grain = std::max<int64_t>(reduce_grain / std::max<int64_t>(rows, 1), 1);
+    parallel_for(cols, grain, [=](int64_t begin, int64_t end) {
+        for (int64_t j = begin; j < end; j++)
+            out(j, reduce_vector(op, rows, a + j * lda));
+    });
+}
+
+// acc[i] = update(acc[i], a(i, j)) over the columns j of the rows [begin, end).
+template <typename T, typename G>
+static inline void accumulate_rows(int64_t begin, int64_t end, int64_t cols, const T *a,
+                                   int64_t lda, double *acc, G update) {
+    for (int64_t j = 0; j < cols; j++) {
+        const T *col = a + j * lda;
+        for (int64_t i = begin; i < end; i++)
+            acc[i - begin] = update(acc[i - begin], double(col[i]));
+    }
+}
+
+// out(i, r) for the reduction r of each row i of the rows x cols matrix a.
+template <typename T, typename F>
+static inline void reduce_stored_rows(reduction op, int64_t rows, int64_t cols, const T *a,
+                                      int64_t lda, F out) {
+    const int64_t grain = std::max<int64_t>(reduce_grain / std::max<int64_t>(cols, 1), 1);
+    parallel_for(rows, grain, [=](int64_t begin, int64_t end) {
+        std::vector<double> acc(end - begin, 0.0);
+        switch (op) {
+            case reduction::sum:
+                accumulate_rows(begin, end, cols, a, lda, acc.data(),
+                                [](double s, double v) { return s + v; });
+                break;
+            case reduction::asum:
+                accumulate_rows(begin, end, cols, a, lda, acc.data(),
+                                [](double s, double v) { return s + std::abs(v); });
+                break;
+            case reduction::amax:
+                accumulate_rows(begin, end, cols, a, lda, acc.data(),
+                                [](double s, double v) { return max_nan(s, std::abs(v)); });
+                break;
+            default:
+                accumulate_rows(begin, end, cols, a, lda, acc.data(),
+                                [](double s, double v) { return s + v * v; });
+                for (int64_t i = begin; i < end; i++)
+                    acc[i - begin] = norm_from_ssq(acc[i - begin], cols, a + i, lda);
+                break;
+        }
+        for (int64_t i = begin; i < end; i++)
+            out(i, acc[i - begin]);
+    });
+}
+
+// Reduction op of each row (rows set) or column of op(A), m x n, written to
+//  y with increment incy.
+template <typename T>
+static inline void reduce_matrix(reduction op, bool rows, transpose trans, int64_t m, int64_t n,
+                                 const T *a, int64_t lda, T *y, int64_t incy) {
+    if (m <= 0 || n <= 0)
+        return;
+    const int64_t len = rows ? m : n;
+    T *y0             = first_element(len, y, incy);
+    auto out          = [=](int64_t i, double v) { y0[i * incy] = T(v); };
+    // Columns of op(A) are the stored columns of A, or its stored rows when
+    //  op(A) is transposed.
+    if (rows == (trans == transpose::nontrans))
+        reduce_stored_rows(op, rows ? m : n, rows ? n : m, a, lda, out);
+    else
+        reduce_stored_columns(op, rows ? n : m, rows ? m : n, a, lda, out);
+}
+
+// Matrix norm of op(A), m x n. The one and infinity norms are the largest
+//  column or row sum of absolute values, the max norm the largest absolute
+//  value and the Frobenius norm the Euclidean norm of the column norms.
+template <typename T>
+static inline T matrix_norm(norm_type norm, transpose trans, int64_t m, int64_t n, const T *a,
+                            int64_t lda) {
+    if (m <= 0 || n <= 0)
+        return T(0);
+    const bool nontrans = (trans == transpose::nontrans);
+    const int64_t rows  = nontrans ? m : n;
+    const int64_t cols  = nontrans ? n : m;
+    std::vector<double> partial;
+    // The infinity norm of A is the one norm of its transpose.
+    if (norm == norm_type::one || norm == norm_type::inf) {
+        const bool stored_columns = ((norm == norm_type::one) == nontrans);
+        partial.resize(stored_columns ? cols : rows);
+        double *p = partial.data();
+        auto out  = [=](int64_t i, double v) { p[i] = v; };
+        if (stored_columns)
+            reduce_stored_columns(reduction::asum, rows, cols, a, lda, out);
+        else
+            reduce_stored_rows(reduction::asum, rows, cols, a, lda, out);
+    }
+    else {
+        partial.resize(cols);
+        double *p = partial.data();
+        reduce_stored_columns((norm == norm_type::max) ? reduction::amax : reduction::nrm2, rows,
+                              cols, a, lda, [=](int64_t j, double v) { p[j] = v; });
+    }
+    if (norm == norm_type::frobenius) {
+        const double ssq = sum_pairwise<double>(0, int64_t(partial.size()),
+                                                [&](int64_t j) { return partial[j] * partial[j]; });
+        return T(norm_from_ssq(ssq, int64_t(partial.size()), partial.data(), 1));
+    }
+    double result = 0.0;
+    for (double v : partial)
+        result = max_nan(result, v);
+    return T(result);
+}
+
+} // namespace mklcpu
+} // namespace onemkl
+
+#endif //_MKL_CPU_MATRIX_REDUCE_HPP_
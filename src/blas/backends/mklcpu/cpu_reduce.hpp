@@ -0,0 +1,228 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_CPU_REDUCE_HPP_
+#define _MKL_CPU_REDUCE_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "cpu_common.hpp"
+
+namespace onemkl {
+namespace mklcpu {
+
+// Float reductions accumulated beyond float precision, in one streaming pass
+//  split across threads in contiguous chunks. Terms are accumulated in T:
+//  double for accumulation::extended, where the product or the square of two
+//  floats is exact, and float for accumulation::pairwise, which runs at the
+//  full float vector width. In both cases reduce_lanes independent sums cover
+//  a block of reduce_block terms, and the block sums are added pairwise, so
+//  that the rounding error grows with log(n) rather than n. Unlike Kahan
+//  summation, none of this relies on the compiler preserving the order of
+//  floating-point operations.
+
+// Independent partial sums of a block, enough to fill the vector registers.
+constexpr int64_t reduce_lanes = 32;
+// Terms of a block, summed before entering the pairwise cascade.
+constexpr int64_t reduce_block = 16 * reduce_lanes;
+// Smallest number of terms given to one thread.
+constexpr int64_t reduce_grain = 1 << 16;
+
+// Sum of term(i) for i in [begin, end).
+template <typename T, typename F>
+static inline double sum_pairwise(int64_t begin, int64_t end, F term) {
+    // level[l] holds the sum of 2^l blocks while it waits for its pair, the
+    //  bits of count telling which levels are in use.
+    T level[64];
+    int64_t count = 0;
+    int64_t i     = begin;
+    for (; i + reduce_block <= end; i += reduce_block) {
+        T acc[reduce_lanes] = {};
+        for (int64_t j = i; j < i + reduce_block; j += reduce_lanes)
+            for (int64_t l = 0; l < reduce_lanes; l++)
+                acc[l] += term(j + l);
+        for (int64_t w = reduce_lanes / 2; w > 0; w /= 2)
+            for (int64_t l = 0; l < w; l++)
+                acc[l] += acc[l + w];
+
+        T s   = acc[0];
+        int l = 0;
+        for (; (count >> l) & 1; l++)
+            s = level[l] + s;
+        level[l] = s;
+        count++;
+    }
+
+    double s = 0.0;
+    for (; i < end; i++)
+        s += term(i);
+    for (int l = 0; (count >> l) != 0; l++) {
+        if ((count >> l) & 1)
+            s += level[l];
+    }
+    return s;
+}
+
+// Sum of term(i) for i in [0, n). The sums of the chunks are added in a fixed
+//  order, so the result does not depend on thread scheduling.
+template <typename T, typename F>
+static inline double reduce(int64_t n, F term) {
+    const int64_t nthreads = std::max<int64_t>(mkl_get_max_threads(), 1);
+    const int64_t nchunks  = std::max<int64_t>(std::min(nthreads, n / reduce_grain), 1);
+    const int64_t chunk    = (n + nchunks - 1) / nchunks;
+    std::vector<double> partial(nchunks, 0.0);
+    parallel_for(nchunks, 1, [&](int64_t begin, int64_t end) {
+        for (int64_t c = begin; c < end; c++)
+            partial[c] = sum_pairwise<T>(c * chunk, std::min(n, (c + 1) * chunk), term);
+    });
+
+    double s = 0.0;
+    for (double p : partial)
+        s += p;
+    return s;
+}
+
+// First element of a vector in BLAS order, which starts from the far end
+//  when the increment is negative.
+template <typename T>
+static inline T *first_element(int64_t n, T *x, int64_t inc) {
+    return (inc < 0) ? x - (n - 1) * inc : x;
+}
+
+// Offset of element i of a vector, the increment being known at compile time
+//  when it is one so that the loops over contiguous vectors vectorize.
+struct unit_stride {
+    int64_t operator()(int64_t i) const {
+        return i;
+    }
+};
+
+struct any_stride {
+    int64_t inc;
+    int64_t operator()(int64_t i) const {
+        return i * inc;
+    }
+};
+
+template <typename T>
+static inline double dot_sum(int64_t n, const float *x, int64_t incx, const float *y,
+                             int64_t incy) {
+    if (incx == 1 && incy == 1)
+        return reduce<T>(n, [=](int64_t i) { return T(x[i]) * T(y[i]); });
+    const float *x0 = first_element(n, x, incx);
+    const float *y0 = first_element(n, y, incy);
+    return reduce<T>(n, [=](int64_t i) { return T(x0[i * incx]) * T(y0[i * incy]); });
+}
+
+template <typename T>
+static inline double sqr_sum(int64_t n, const float *x, int64_t incx) {
+    if (incx == 1)
+        return reduce<T>(n, [=](int64_t i) { return T(x[i]) * T(x[i]); });
+    return reduce<T>(n, [=](int64_t i) { return T(x[i * incx]) * T(x[i * incx]); });
+}
+
+template <typename T>
+static inline double abs_sum(int64_t n, const float *x, int64_t incx) {
+    if (incx == 1)
+        return reduce<T>(n, [=](int64_t i) { return T(std::abs(x[i])); });
+    return reduce<T>(n, [=](int64_t i) { return T(std::abs(x[i * incx])); });
+}
+
+// x^T y in the extended or pairwise mode.
+static inline float dot_accumulate(accumulation acc, int64_t n, const float *x, int64_t incx,
+                                   const float *y, int64_t incy) {
+    if (n <= 0)
+        return 0.0f;
+    return float((acc == accumulation::extended) ? dot_sum<double>(n, x, incx, y, incy)
+                                                 : dot_sum<float>(n, x, incx, y, incy));
+}
+
+// ||x||_2 in the extended or pairwise mode. Squares in float overflow for
+//  large elements and lose the tiny ones, so when the float sum of squares
+//  falls outside the range where that cannot matter, it is computed again in
+//  double, where the square of a float is exact and in range.
+static inline float nrm2_accumulate(accumulation acc, int64_t n, const float *x, int64_t incx) {
+    if (n <= 0 || incx <= 0)
+        return 0.0f;
+    if (acc == accumulation::pairwise) {
+        const double ssq = sqr_sum<float>(n, x, incx);
+        if (std::isfinite(ssq) && ssq >= std::ldexp(double(n), -100))
+            return float(std::sqrt(ssq));
+    }
+    return float(std::sqrt(sqr_sum<double>(n, x, incx)));
+}
+
+// sum |x_i| in the extended or pairwise mode.
+static inline float asum_accumulate(accumulation acc, int64_t n, const float *x, int64_t incx) {
+    if (n <= 0 || incx <= 0)
+        return 0.0f;
+    return float((acc == accumulation::extended) ? abs_sum<double>(n, x, incx)
+                                                 : abs_sum<float>(n, x, incx));
+}
+
+// y := alpha * x + beta * y + gamma * z, returning y^T w if w is not null,
+//  in one pass over the vectors. The vectors come first in BLAS order and a
+//  term whose coefficient is zero is not read.
+template <typename T, typename S>
+static inline T axpbypcz_pass(int64_t n, T alpha, const T *x, S sx, T beta, T *y, S sy, T gamma,
+                              const T *z, S sz, const T *w, S sw) {
+    auto update = [=](int64_t i) {
+        T v = (beta == T(0)) ? T(0) : beta * y[sy(i)];
+        if (alpha != T(0))
+            v += alpha * x[sx(i)];
+        if (gamma != T(0))
+            v += gamma * z[sz(i)];
+        y[sy(i)] = v;
+        return v;
+    };
+    if (w == nullptr) {
+        parallel_for(n, reduce_grain, [=](int64_t begin, int64_t end) {
+            for (int64_t i = begin; i < end; i++)
+                update(i);
+        });
+        return T(0);
+    }
+    return T(reduce<T>(n, [=](int64_t i) { return update(i) * w[sw(i)]; }));
+}
+
+// Fused y := alpha * x + beta * y + gamma * z, followed by y^T w when w is
+//  not null. The dot product of y is taken while y is written, so the whole
+//  chain streams each vector once.
+template <typename T>
+static inline T axpbypcz_fused(int64_t n, T alpha, const T *x, int64_t incx, T beta, T *y,
+                               int64_t incy, T gamma, const T *z, int64_t incz, const T *w,
+                               int64_t incw) {
+    if (n <= 0)
+        return T(0);
+    if (incx == 1 && incy == 1 && incz == 1 && (w == nullptr || incw == 1))
+        return axpbypcz_pass(n, alpha, x, unit_stride(), beta, y, unit_stride(), gamma, z,
+                             unit_stride(), w, unit_stride());
+    return axpbypcz_pass(n, alpha, first_element(n, x, incx), any_stride{ incx }, beta,
+                         first_element(n, y, incy), any_stride{ incy }, gamma,
+                         first_element(n, z, incz), any_stride{ incz },
+                         w ? first_element(n, w, incw) : w, any_stride{ incw });
+}
+
+} // namespace mklcpu
+} // namespace onemkl
+
+#endif //_MKL_CPU_REDUCE_HPP_
@@ -0,0 +1,175 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_CPU_STORAGE_HPP_
+#define _MKL_CPU_STORAGE_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "cpu_common.hpp"
+
+namespace onemkl {
+namespace mklcpu {
+
+// Conversions between full, packed and band storage of column-major
+//  matrices. A strided batch is treated as one long sequence of output
+//  elements (packed) or columns (band) that is cut into equal contiguous
+//  chunks, one per thread, so that threads get the same share of a triangle
+//  and small matrices of a batch are grouped together. Inside a chunk columns
+//  are visited in order and each column is one contiguous copy on both sides,
+//  so source and destination are streamed through the cache exactly once.
+
+// Number of elements copied by one thread at least.
+constexpr int64_t storage_grain = 1 << 16;
+
+// Runs f(idx, begin, end) on the items [begin, end) of the problems idx of a
+//  batch of batch_size problems of size items each, weight being the number of
+//  elements copied per item.
+template <typename F>
+static inline void storage_parallel_for(int64_t batch_size, int64_t size, int64_t weight, F f) {
+    if (batch_size <= 0 || size <= 0)
+        return;
+    const int64_t grain = std::max<int64_t>(storage_grain / std::max<int64_t>(weight, 1), 1);
+    parallel_for(batch_size * size, grain, [=](int64_t begin, int64_t end) {
+        for (int64_t idx = begin / size; idx * size < end; idx++) {
+            const int64_t first = idx * size;
+            f(idx, std::max(begin, first) - first, std::min(end, first + size) - first);
+        }
+    });
+}
+
+// Offset in packed storage of the first element of column j.
+static inline int64_t packed_column_start(uplo upper_lower, int64_t n, int64_t j) {
+    return (upper_lower == uplo::upper) ? j * (j + 1) / 2 : j * (2 * n - j + 1) / 2;
+}
+
+// Column holding the element p of packed storage.
+static inline int64_t packed_column(uplo upper_lower, int64_t n, int64_t p) {
+    int64_t j;
+    if (upper_lower == uplo::upper) {
+        j = int64_t((std::sqrt(8.0 * p + 1.0) - 1.0) / 2.0);
+    }
+    else {
+        const double b = 2.0 * n + 1.0;
+        j              = int64_t((b - std::sqrt(std::max(b * b - 8.0 * p, 0.0))) / 2.0);
+    }
+    // Correct the rounding of the square root.
+    j = std::min(std::max<int64_t>(j, 0), n - 1);
+    while (j > 0 && packed_column_start(upper_lower, n, j) > p)
+        j--;
+    while (j + 1 < n && packed_column_start(upper_lower, n, j + 1) <= p)
+        j++;
+    return j;
+}
+
+// Calls f(j, i, p, len) for the pieces of columns that make up the packed
+//  elements [begin, end): len elements of column j starting at row i, which
+//  are stored from offset p in packed storage.
+template <typename F>
+static inline void packed_segments(uplo upper_lower, int64_t n, int64_t begin, int64_t end, F f) {
+    const bool upper = (upper_lower == uplo::upper);
+    for (int64_t p = begin, j = packed_column(upper_lower, n, begin); p < end; j++) {
+        const int64_t skip = p - packed_column_start(upper_lower, n, j);
+        const int64_t rows = upper ? j + 1 : n - j;
+        const int64_t len  = std::min(rows - skip, end - p);
+        f(j, (upper ? 0 : j) + skip, p, len);
+        p += len;
+    }
+}
+
+// Full to packed storage of the upper_lower triangle of a strided batch of
+//  n x n matrices.
+template <typename T>
+static inline void xtrttp_batch(uplo upper_lower, int64_t n, const T *a, int64_t lda,
+                                int64_t stride_a, T *ap, int64_t stride_ap, int64_t batch_size) {
+    const int64_t size = n * (n + 1) / 2;
+    storage_parallel_for(batch_size, size, 1, [=](int64_t idx, int64_t begin, int64_t end) {
+        const T *a_idx = a + stride_a * idx;
+        T *ap_idx      = ap + stride_ap * idx;
+        auto copy = [=](int64_t j, int64_t i, int64_t p, int64_t len) {
+            std::copy(a_idx + i + j * lda, a_idx + i + j * lda + len, ap_idx + p);
+        };
+        packed_segments(upper_lower, n, begin, end, copy);
+    });
+}
+
+// Packed to full storage of the upper_lower triangle of a strided batch of
+//  n x n matrices. The other triangle is not referenced.
+template <typename T>
+static inline void xtpttr_batch(uplo upper_lower, int64_t n, const T *ap, int64_t stride_ap,
+                                T *a, int64_t lda, int64_t stride_a, int64_t batch_size) {
+    const int64_t size = n * (n + 1) / 2;
+    storage_parallel_for(batch_size, size, 1, [=](int64_t idx, int64_t begin, int64_t end) {
+        const T *ap_idx = ap + stride_ap * idx;
+        T *a_idx        = a + stride_a * idx;
+        auto copy = [=](int64_t j, int64_t i, int64_t p, int64_t len) {
+            std::copy(ap_idx + p, ap_idx + p + len, a_idx + i + j * lda);
+        };
+        packed_segments(upper_lower, n, begin, end, copy);
+    });
+}
+
+// Full to band storage of a strided batch of m x n matrices with kl
+//  subdiagonals and ku superdiagonals: A(i, j) goes to AB(ku + i - j, j).
+//  Entries of AB outside of the matrix are not referenced.
+template <typename T>
+static inline void xgettgb_batch(int64_t m, int64_t n, int64_t kl, int64_t ku, const T *a,
+                                 int64_t lda, int64_t stride_a, T *ab, int64_t ldab,
+                                 int64_t stride_ab, int64_t batch_size) {
+    storage_parallel_for(batch_size, n, kl + ku + 1, [=](int64_t idx, int64_t begin, int64_t end) {
+        const T *a_idx = a + stride_a * idx;
+        T *ab_idx      = ab + stride_ab * idx;
+        for (int64_t j = begin; j < end; j++) {
+            const int64_t first = std::max<int64_t>(j - ku, 0);
+            const int64_t last  = std::min(j + kl + 1, m);
+            if (first < last)
+                std::copy(a_idx + first + j * lda, a_idx + last + j * lda,
+                          ab_idx + ku + first - j + j * ldab);
+        }
+    });
+}
+
+// Band to full storage of a strided batch of m x n matrices with kl
+//  subdiagonals and ku superdiagonals. Entries of A outside of the band are
+//  set to zero.
+template <typename T>
+static inline void xgbtge_batch(int64_t m, int64_t n, int64_t kl, int64_t ku, const T *ab,
+                                int64_t ldab, int64_t stride_ab, T *a, int64_t lda,
+                                int64_t stride_a, int64_t batch_size) {
+    storage_parallel_for(batch_size, n, m, [=](int64_t idx, int64_t begin, int64_t end) {
+        const T *ab_idx = ab + stride_ab * idx;
+        T *a_idx        = a + stride_a * idx;
+        for (int64_t j = begin; j < end; j++) {
+            const int64_t first = std::min(std::max<int64_t>(j - ku, 0), m);
+            const int64_t last  = std::max(std::min(j + kl + 1, m), first);
+            T *col              = a_idx + j * lda;
+            std::fill(col, col + first, T(0));
+            std::copy(ab_idx + ku + first - j + j * ldab, ab_idx + ku + last - j + j * ldab,
+                      col + first);
+            std::fill(col + last, col + m, T(0));
+        }
+    });
+}
+
+} // namespace mklcpu
+} // namespace onemkl
+
+#endif //_MKL_CPU_STORAGE_HPP_
@@ -202,4 +202,248 @@ extern "C" function_table_t mkl_blas_table = {
     onemkl::mklcpu::gemm_ext,
     onemkl::mklcpu::gemm_ext,
     onemkl::mklcpu::gemm_ext,
+    onemkl::mklcpu::convert,
+    onemkl::mklcpu::convert,
+    onemkl::mklcpu::convert,
+    onemkl::mklcpu::convert,
+    onemkl::mklcpu::convert,
+    onemkl::mklcpu::convert,
+    onemkl::mklcpu::convert,
+    onemkl::mklcpu::convert,
+    onemkl::mklcpu::gemm_ext,
+    onemkl::mklcpu::gemm_ext,
+    onemkl::mklcpu::gemm_ext,
+    onemkl::mklcpu::gemm_ext,
+    onemkl::mklcpu::gemm_ext,
+    onemkl::mklcpu::gemm_ext,
+    onemkl::mklcpu::gemm_ext,
+    onemkl::mklcpu::gemm_ext,
+    onemkl::mklcpu::gemm_ext,
+    onemkl::mklcpu::gemm_s8u8s32_compute,
+    onemkl::mklcpu::gemm_s8u8s32_compute,
+    onemkl::mklcpu::gemm_s8u8s32_pack,
+    onemkl::mklcpu::gemm_s8u8s32_pack,
+    onemkl::mklcpu::gemm_s8u8s32_pack_get_size,
+    onemkl::mklcpu::gemm_batch,
+    onemkl::mklcpu::gemm_batch,
+    onemkl::mklcpu::gemm_batch,
+    onemkl::mklcpu::gemm_batch,
+    onemkl::mklcpu::herk_batch,
+    onemkl::mklcpu::herk_batch,
+    onemkl::mklcpu::herk_batch,
+    onemkl::mklcpu::herk_batch,
+    onemkl::mklcpu::syrk_batch,
+    onemkl::mklcpu::syrk_batch,
+    onemkl::mklcpu::syrk_batch,
+    onemkl::mklcpu::syrk_batch,
+    onemkl::mklcpu::syrk_batch,
+    onemkl::mklcpu::syrk_batch,
+    onemkl::mklcpu::syrk_batch,
+    onemkl::mklcpu::syrk_batch,
+    onemkl::mklcpu::gemv_batch,
+    onemkl::mklcpu::gemv_batch,
+    onemkl::mklcpu::gemv_batch,
+    onemkl::mklcpu::gemv_batch,
+    onemkl::mklcpu::gemv_batch,
+    onemkl::mklcpu::gemv_batch,
+    onemkl::mklcpu::gemv_batch,
+    onemkl::mklcpu::gemv_batch,
+    onemkl::mklcpu::dgmm_batch,
+    onemkl::mklcpu::dgmm_batch,
+    onemkl::mklcpu::dgmm_batch,
+    onemkl::mklcpu::dgmm_batch,
+    onemkl::mklcpu::dgmm_batch,
+    onemkl::mklcpu::dgmm_batch,
+    onemkl::mklcpu::dgmm_batch,
+    onemkl::mklcpu::dgmm_batch,
+    onemkl::mklcpu::axpy_batch,
+    onemkl::mklcpu::axpy_batch,
+    onemkl::mklcpu::axpy_batch,
+    onemkl::mklcpu::axpy_batch,
+    onemkl::mklcpu::axpy_batch,
+    onemkl::mklcpu::axpy_batch,
+    onemkl::mklcpu::axpy_batch,
+    onemkl::mklcpu::axpy_batch,
+    onemkl::mklcpu::copy_batch,
+    onemkl::mklcpu::copy_batch,
+    onemkl::mklcpu::copy_batch,
+    onemkl::mklcpu::copy_batch,
+    onemkl::mklcpu::copy_batch,
+    onemkl::mklcpu::copy_batch,
+    onemkl::mklcpu::copy_batch,
+    onemkl::mklcpu::copy_batch,
+    onemkl::mklcpu::dot_batch,
+    onemkl::mklcpu::dot_batch,
+    onemkl::mklcpu::dot_batch,
+    onemkl::mklcpu::dot_batch,
+    onemkl::mklcpu::scal_batch,
+    onemkl::mklcpu::scal_batch,
+    onemkl::mklcpu::scal_batch,
+    onemkl::mklcpu::scal_batch,
+    onemkl::mklcpu::scal_batch,
+    onemkl::mklcpu::scal_batch,
+    onemkl::mklcpu::scal_batch,
+    onemkl::mklcpu::scal_batch,
+    onemkl::mklcpu::scal_batch,
+    onemkl::mklcpu::scal_batch,
+    onemkl::mklcpu::scal_batch,
+    onemkl::mklcpu::scal_batch,
+    onemkl::mklcpu::gemm_batch,
+    onemkl::mklcpu::gemm_batch,
+    onemkl::mklcpu::gemm_batch,
+    onemkl::mklcpu::gemm_batch,
+    onemkl::mklcpu::gemm_batch,
+    onemkl::mklcpu::gemm_batch,
+    onemkl::mklcpu::gepack_compact,
+    onemkl::mklcpu::gepack_compact,
+    onemkl::mklcpu::geunpack_compact,
+    onemkl::mklcpu::geunpack_compact,
+    onemkl::mklcpu::gemm_compact,
+    onemkl::mklcpu::gemm_compact,
+    onemkl::mklcpu::trsm_compact,
+    onemkl::mklcpu::trsm_compact,
+    onemkl::mklcpu::getrfnp_compact,
+    onemkl::mklcpu::getrfnp_compact,
+    onemkl::mklcpu::axpby,
+    onemkl::mklcpu::axpby,
+    onemkl::mklcpu::axpby,
+    onemkl::mklcpu::axpby,
+    onemkl::mklcpu::imatcopy,
+    onemkl::mklcpu::imatcopy,
+    onemkl::mklcpu::imatcopy,
+    onemkl::mklcpu::imatcopy,
+    onemkl::mklcpu::omatadd,
+    onemkl::mklcpu::omatadd,
+    onemkl::mklcpu::omatadd,
+    onemkl::mklcpu::omatadd,
+    onemkl::mklcpu::omatcopy,
+    onemkl::mklcpu::omatcopy,
+    onemkl::mklcpu::omatcopy,
+    onemkl::mklcpu::omatcopy,
+    onemkl::mklcpu::imatcopy_batch,
+    onemkl::mklcpu::imatcopy_batch,
+    onemkl::mklcpu::imatcopy_batch,
+    onemkl::mklcpu::imatcopy_batch,
+    onemkl::mklcpu::omatadd_batch,
+    onemkl::mklcpu::omatadd_batch,
+    onemkl::mklcpu::omatadd_batch,
+    onemkl::mklcpu::omatadd_batch,
+    onemkl::mklcpu::omatcopy_batch,
+    onemkl::mklcpu::omatcopy_batch,
+    onemkl::mklcpu::omatcopy_batch,
+    onemkl::mklcpu::omatcopy_batch,
+    onemkl::mklcpu::asum,
+    onemkl::mklcpu::dot,
+    onemkl::mklcpu::nrm2,
+    onemkl::mklcpu::axpbypcz,
+    onemkl::mklcpu::axpbypcz,
+    onemkl::mklcpu::axpbypcz_dot,
+    onemkl::mklcpu::axpbypcz_dot,
+    onemkl::mklcpu::asum,
+    onemkl::mklcpu::asum,
+    onemkl::mklcpu::asum,
+    onemkl::mklcpu::asum,
+    onemkl::mklcpu::dot,
+    onemkl::mklcpu::dot,
+    onemkl::mklcpu::dot,
+    onemkl::mklcpu::iamin,
+    onemkl::mklcpu::iamin,
+    onemkl::mklcpu::iamin,
+    onemkl::mklcpu::iamin,
+    onemkl::mklcpu::iamax,
+    onemkl::mklcpu::iamax,
+    onemkl::mklcpu::iamax,
+    onemkl::mklcpu::iamax,
+    onemkl::mklcpu::nrm2,
+    onemkl::mklcpu::nrm2,
+    onemkl::mklcpu::nrm2,
+    onemkl::mklcpu::nrm2,
+    onemkl::mklcpu::gbtge,
+    onemkl::mklcpu::gbtge,
+    onemkl::mklcpu::gbtge,
+    onemkl::mklcpu::gbtge,
+    onemkl::mklcpu::gettgb,
+    onemkl::mklcpu::gettgb,
+    onemkl::mklcpu::gettgb,
+    onemkl::mklcpu::gettgb,
+    onemkl::mklcpu::tpttr,
+    onemkl::mklcpu::tpttr,
+    onemkl::mklcpu::tpttr,
+    onemkl::mklcpu::tpttr,
+    onemkl::mklcpu::trttp,
+    onemkl::mklcpu::trttp,
+    onemkl::mklcpu::trttp,
+    onemkl::mklcpu::trttp,
+    onemkl::mklcpu::gbtge_batch,
+    onemkl::mklcpu::gbtge_batch,
+    onemkl::mklcpu::gbtge_batch,
+    onemkl::mklcpu::gbtge_batch,
+    onemkl::mklcpu::gettgb_batch,
+    onemkl::mklcpu::gettgb_batch,
+    onemkl::mklcpu::gettgb_batch,
+    onemkl::mklcpu::gettgb_batch,
+    onemkl::mklcpu::tpttr_batch,
+    onemkl::mklcpu::tpttr_batch,
+    onemkl::mklcpu::tpttr_batch,
+    onemkl::mklcpu::tpttr_batch,
+    onemkl::mklcpu::trttp_batch,
+    onemkl::mklcpu::trttp_batch,
+    onemkl::mklcpu::trttp_batch,
+    onemkl::mklcpu::trttp_batch,
+    onemkl::mklcpu::gemv,
+    onemkl::mklcpu::gemv,
+    onemkl::mklcpu::gemv_batch,
+    onemkl::mklcpu::gemv_batch,
+    onemkl::mklcpu::lange,
+    onemkl::mklcpu::lange,
+    onemkl::mklcpu::reduce_columns,
+    onemkl::mklcpu::reduce_columns,
+    onemkl::mklcpu::reduce_rows,
+    onemkl::mklcpu::reduce_rows,
+    onemkl::mklcpu::omatclamp,
+    onemkl::mklcpu::omatclamp,
+    onemkl::mklcpu::omatclamp_batch,
+    onemkl::mklcpu::omatclamp_batch,
+    onemkl::mklcpu::omatdiv,
+    onemkl::mklcpu::omatdiv,
+    onemkl::mklcpu::omatdiv,
+    onemkl::mklcpu::omatdiv,
+    onemkl::mklcpu::omatdiv_batch,
+    onemkl::mklcpu::omatdiv_batch,
+    onemkl::mklcpu::omatdiv_batch,
+    onemkl::mklcpu::omatdiv_batch,
+    onemkl::mklcpu::omatfma,
+    onemkl::mklcpu::omatfma,
+    onemkl::mklcpu::omatfma,
+    onemkl::mklcpu::omatfma,
+    onemkl::mklcpu::omatfma_batch,
+    onemkl::mklcpu::omatfma_batch,
+    onemkl::mklcpu::omatfma_batch,
+    onemkl::mklcpu::omatfma_batch,
+    onemkl::mklcpu::omatmul,
+    onemkl::mklcpu::omatmul,
+    onemkl::mklcpu::omatmul,
+    onemkl::mklcpu::omatmul,
+    onemkl::mklcpu::omatmul_batch,
+    onemkl::mklcpu::omatmul_batch,
+    onemkl::mklcpu::omatmul_batch,
+    onemkl::mklcpu::omatmul_batch,
+    onemkl::mklcpu::vclamp,
+    onemkl::mklcpu::vclamp,
+    onemkl::mklcpu::vdiv,
+    onemkl::mklcpu::vdiv,
+    onemkl::mklcpu::vdiv,
+    onemkl::mklcpu::vdiv,
+    onemkl::mklcpu::vfma,
+    onemkl::mklcpu::vfma,
+    onemkl::mklcpu::vfma,
+    onemkl::mklcpu::vfma,
+    onemkl::mklcpu::vmul,
+    onemkl::mklcpu::vmul,
+    onemkl::mklcpu::vmul,
+    onemkl::mklcpu::vmul,
+    onemkl::mklcpu::gemm3m,
+    onemkl::mklcpu::gemm3m,
+    onemkl::mklcpu::gemm3m_batch,
+    onemkl::mklcpu::gemm3m_batch,
 };
@@ -202,4 +202,248 @@ extern "C" function_table_t mkl_blas_table = {
     onemkl::mklgpu::gemm_ext,
     onemkl::mklgpu::gemm_ext,
     onemkl::mklgpu::gemm_ext,
+    onemkl::mklgpu::convert,
+    onemkl::mklgpu::convert,
+    onemkl::mklgpu::convert,
+    onemkl::mklgpu::convert,
+    onemkl::mklgpu::convert,
+    onemkl::mklgpu::convert,
+    onemkl::mklgpu::convert,
+    onemkl::mklgpu::convert,
+    onemkl::mklgpu::gemm_ext,
+    onemkl::mklgpu::gemm_ext,
+    onemkl::mklgpu::gemm_ext,
+    onemkl::mklgpu::gemm_ext,
+    onemkl::mklgpu::gemm_ext,
+    onemkl::mklgpu::gemm_ext,
+    onemkl::mklgpu::gemm_ext,
+    onemkl::mklgpu::gemm_ext,
+    onemkl::mklgpu::gemm_ext,
+    onemkl::mklgpu::gemm_s8u8s32_compute,
+    onemkl::mklgpu::gemm_s8u8s32_compute,
+    onemkl::mklgpu::gemm_s8u8s32_pack,
+    onemkl::mklgpu::gemm_s8u8s32_pack,
+    onemkl::mklgpu::gemm_s8u8s32_pack_get_size,
+    onemkl::mklgpu::gemm_batch,
+    onemkl::mklgpu::gemm_batch,
+    onemkl::mklgpu::gemm_batch,
+    onemkl::mklgpu::gemm_batch,
+    onemkl::mklgpu::herk_batch,
+    onemkl::mklgpu::herk_batch,
+    onemkl::mklgpu::herk_batch,
+    onemkl::mklgpu::herk_batch,
+    onemkl::mklgpu::syrk_batch,
+    onemkl::mklgpu::syrk_batch,
+    onemkl::mklgpu::syrk_batch,
+    onemkl::mklgpu::syrk_batch,
+    onemkl::mklgpu::syrk_batch,
+    onemkl::mklgpu::syrk_batch,
+    onemkl::mklgpu::syrk_batch,
+    onemkl::mklgpu::syrk_batch,
+    onemkl::mklgpu::gemv_batch,
+    onemkl::mklgpu::gemv_batch,
+    onemkl::mklgpu::gemv_batch,
+    onemkl::mklgpu::gemv_batch,
+    onemkl::mklgpu::gemv_batch,
+    onemkl::mklgpu::gemv_batch,
+    onemkl::mklgpu::gemv_batch,
+    onemkl::mklgpu::gemv_batch,
+    onemkl::mklgpu::dgmm_batch,
+    onemkl::mklgpu::dgmm_batch,
+    onemkl::mklgpu::dgmm_batch,
+    onemkl::mklgpu::dgmm_batch,
+    onemkl::mklgpu::dgmm_batch,
+    onemkl::mklgpu::dgmm_batch,
+    onemkl::mklgpu::dgmm_batch,
+    onemkl::mklgpu::dgmm_batch,
+    onemkl::mklgpu::axpy_batch,
+    onemkl::mklgpu::axpy_batch,
+    onemkl::mklgpu::axpy_batch,
+    onemkl::mklgpu::axpy_batch,
+    onemkl::mklgpu::axpy_batch,
+    onemkl::mklgpu::axpy_batch,
+    onemkl::mklgpu::axpy_batch,
+    onemkl::mklgpu::axpy_batch,
+    onemkl::mklgpu::copy_batch,
+    onemkl::mklgpu::copy_batch,
+    onemkl::mklgpu::copy_batch,
+    onemkl::mklgpu::copy_batch,
+    onemkl::mklgpu::copy_batch,
+    onemkl::mklgpu::copy_batch,
+    onemkl::mklgpu::copy_batch,
+    onemkl::mklgpu::copy_batch,
+    onemkl::mklgpu::dot_batch,
+    onemkl::mklgpu::dot_batch,
+    onemkl::mklgpu::dot_batch,
+    onemkl::mklgpu::dot_batch,
+    onemkl::mklgpu::scal_batch,
+    onemkl::mklgpu::scal_batch,
+    onemkl::mklgpu::scal_batch,
+    onemkl::mklgpu::scal_batch,
+    onemkl::mklgpu::scal_batch,
+    onemkl::mklgpu::scal_batch,
+    onemkl::mklgpu::scal_batch,
+    onemkl::mklgpu::scal_batch,
+    onemkl::mklgpu::scal_batch,
+    onemkl::mklgpu::scal_batch,
+    onemkl::mklgpu::scal_batch,
+    onemkl::mklgpu::scal_batch,
+    onemkl::mklgpu::gemm_batch,
+    onemkl::mklgpu::gemm_batch,
+    onemkl::mklgpu::gemm_batch,
+    onemkl::mklgpu::gemm_batch,
+    onemkl::mklgpu::gemm_batch,
+    onemkl::mklgpu::gemm_batch,
+    onemkl::mklgpu::gepack_compact,
+    onemkl::mklgpu::gepack_compact,
+    onemkl::mklgpu::geunpack_compact,
+    onemkl::mklgpu::geunpack_compact,
+    onemkl::mklgpu::gemm_compact,
+    onemkl::mklgpu::gemm_compact,
+    onemkl::mklgpu::trsm_compact,
+    onemkl::mklgpu::trsm_compact,
+    onemkl::mklgpu::getrfnp_compact,
+    onemkl::mklgpu::getrfnp_compact,
+    onemkl::mklgpu::axpby,
+    onemkl::mklgpu::axpby,
+    onemkl::mklgpu::axpby,
+    onemkl::mklgpu::axpby,
+    onemkl::mklgpu::imatcopy,
+    onemkl::mklgpu::imatcopy,
+    onemkl::mklgpu::imatcopy,
+    onemkl::mklgpu::imatcopy,
+    onemkl::mklgpu::omatadd,
+    onemkl::mklgpu::omatadd,
+    onemkl::mklgpu::omatadd,
+    onemkl::mklgpu::omatadd,
+    onemkl::mklgpu::omatcopy,
+    onemkl::mklgpu::omatcopy,
+    onemkl::mklgpu::omatcopy,
+    onemkl::mklgpu::omatcopy,
+    onemkl::mklgpu::imatcopy_batch,
+    onemkl::mklgpu::imatcopy_batch,
+    onemkl::mklgpu::imatcopy_batch,
+    onemkl::mklgpu::imatcopy_batch,
+    onemkl::mklgpu::omatadd_batch,
+    onemkl::mklgpu::omatadd_batch,
+    onemkl::mklgpu::omatadd_batch,
+    onemkl::mklgpu::omatadd_batch,
+    onemkl::mklgpu::omatcopy_batch,
+    onemkl::mklgpu::omatcopy_batch,
+    onemkl::mklgpu::omatcopy_batch,
+    onemkl::mklgpu::omatcopy_batch,
+    onemkl::mklgpu::asum,
+    onemkl::mklgpu::dot,
+    onemkl::mklgpu::nrm2,
+    onemkl::mklgpu::axpbypcz,
+    onemkl::mklgpu::axpbypcz,
+    onemkl::mklgpu::axpbypcz_dot,
+    onemkl::mklgpu::axpbypcz_dot,
+    onemkl::mklgpu::asum,
+    onemkl::mklgpu::asum,
+    onemkl::mklgpu::asum,
+    onemkl::mklgpu::asum,
+    onemkl::mklgpu::dot,
+    onemkl::mklgpu::dot,
+    onemkl::mklgpu::dot,
+    onemkl::mklgpu::iamin,
+    onemkl::mklgpu::iamin,
+    onemkl::mklgpu::iamin,
+    onemkl::mklgpu::iamin,
+    onemkl::mklgpu::iamax,
+    onemkl::mklgpu::iamax,
+    onemkl::mklgpu::iamax,
+    onemkl::mklgpu::iamax,
+    onemkl::mklgpu::nrm2,
+    onemkl::mklgpu::nrm2,
+    onemkl::mklgpu::nrm2,
+    onemkl::mklgpu::nrm2,
+    onemkl::mklgpu::gbtge,
+    onemkl::mklgpu::gbtge,
+    onemkl::mklgpu::gbtge,
+    onemkl::mklgpu::gbtge,
+    onemkl::mklgpu::gettgb,
+    onemkl::mklgpu::gettgb,
+    onemkl::mklgpu::gettgb,
+    onemkl::mklgpu::gettgb,
+    onemkl::mklgpu::tpttr,
+    onemkl::mklgpu::tpttr,
+    onemkl::mklgpu::tpttr,
+    onemkl::mklgpu::tpttr,
+    onemkl::mklgpu::trttp,
+    onemkl::mklgpu::trttp,
+    onemkl::mklgpu::trttp,
+    onemkl::mklgpu::trttp,
+    onemkl::mklgpu::gbtge_batch,
+    onemkl::mklgpu::gbtge_batch,
+    onemkl::mklgpu::gbtge_batch,
+    onemkl::mklgpu::gbtge_batch,
+    onemkl::mklgpu::gettgb_batch,
+    onemkl::mklgpu::gettgb_batch,
+    onemkl::mklgpu::gettgb_batch,
+    onemkl::mklgpu::gettgb_batch,
+    onemkl::mklgpu::tpttr_batch,
+    onemkl::mklgpu::tpttr_batch,
+    onemkl::mklgpu::tpttr_batch,
+    onemkl::mklgpu::tpttr_batch,
+    onemkl::mklgpu::trttp_batch,
+    onemkl::mklgpu::trttp_batch,
+    onemkl::mklgpu::trttp_batch,
+    onemkl::mklgpu::trttp_batch,
+    onemkl::mklgpu::gemv,
+    onemkl::mklgpu::gemv,
+    onemkl::mklgpu::gemv_batch,
+    onemkl::mklgpu::gemv_batch,
+    onemkl::mklgpu::lange,
+    onemkl::mklgpu::lange,
+    onemkl::mklgpu::reduce_columns,
+    onemkl::mklgpu::reduce_columns,
+    onemkl::mklgpu::reduce_rows,
+    onemkl::mklgpu::reduce_rows,
+    onemkl::mklgpu::omatclamp,
+    onemkl::mklgpu::omatclamp,
+    onemkl::mklgpu::omatclamp_batch,
+    onemkl::mklgpu::omatclamp_batch,
+    onemkl::mklgpu::omatdiv,
+    onemkl::mklgpu::omatdiv,
+    onemkl::mklgpu::omatdiv,
+    onemkl::mklgpu::omatdiv,
+    onemkl::mklgpu::omatdiv_batch,
+    onemkl::mklgpu::omatdiv_batch,
+    onemkl::mklgpu::omatdiv_batch,
+    onemkl::mklgpu::omatdiv_batch,
+    onemkl::mklgpu::omatfma,
+    onemkl::mklgpu::omatfma,
+    onemkl::mklgpu::omatfma,
+    onemkl::mklgpu::omatfma,
+    onemkl::mklgpu::omatfma_batch,
+    onemkl::mklgpu::omatfma_batch,
+    onemkl::mklgpu::omatfma_batch,
+    onemkl::mklgpu::omatfma_batch,
+    onemkl::mklgpu::omatmul,
+    onemkl::mklgpu::omatmul,
+    onemkl::mklgpu::omatmul,
+    onemkl::mklgpu::omatmul,
+    onemkl::mklgpu::omatmul_batch,
+    onemkl::mklgpu::omatmul_batch,
+    onemkl::mklgpu::omatmul_batch,
+    onemkl::mklgpu::omatmul_batch,
+    onemkl::mklgpu::vclamp,
+    onemkl::mklgpu::vclamp,
+    onemkl::mklgpu::vdiv,
+    onemkl::mklgpu::vdiv,
+    onemkl::mklgpu::vdiv,
+    onemkl::mklgpu::vdiv,
+    onemkl::mklgpu::vfma,
+    onemkl::mklgpu::vfma,
+    onemkl::mklgpu::vfma,
+    onemkl::mklgpu::vfma,
+    onemkl::mklgpu::vmul,
+    onemkl::mklgpu::vmul,
+    onemkl::mklgpu::vmul,
+    onemkl::mklgpu::vmul,
+    onemkl::mklgpu::gemm3m,
+    onemkl::mklgpu::gemm3m,
+    onemkl::mklgpu::gemm3m_batch,
+    onemkl::mklgpu::gemm3m_batch,
 };
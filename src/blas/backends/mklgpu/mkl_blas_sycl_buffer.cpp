@@ -1248,5 +1248,1815 @@ void gemm_ext(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpos
     //UNSUPPORTED
 }
 
+void convert(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<half, 1> &x,
+             cl::sycl::buffer<float, 1> &y) {
+    //UNSUPPORTED
+}
+
+void convert(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+             cl::sycl::buffer<half, 1> &y) {
+    //UNSUPPORTED
+}
+
+void convert(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<bfloat16, 1> &x,
+             cl::sycl::buffer<float, 1> &y) {
+    //UNSUPPORTED
+}
+
+void convert(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+             cl::sycl::buffer<bfloat16, 1> &y) {
+    //UNSUPPORTED
+}
+
+void convert(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, cl::sycl::buffer<half, 1> &a,
+             std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb) {
+    //UNSUPPORTED
+}
+
+void convert(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a,
+             std::int64_t lda, cl::sycl::buffer<half, 1> &b, std::int64_t ldb) {
+    //UNSUPPORTED
+}
+
+void convert(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+             std::int64_t ldb) {
+    //UNSUPPORTED
+}
+
+void convert(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a,
+             std::int64_t lda, cl::sycl::buffer<bfloat16, 1> &b, std::int64_t ldb) {
+    //UNSUPPORTED
+}
+
+void gemm_ext(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+              onemkl::offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+              cl::sycl::buffer<int16_t, 1> &a, std::int64_t lda, int16_t ao,
+              cl::sycl::buffer<int16_t, 1> &b, std::int64_t ldb, int16_t bo, float beta,
+              cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+    //UNSUPPORTED
+}
+
+void gemm_ext(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+              onemkl::offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+              cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+              cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo, float beta,
+              cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+    //UNSUPPORTED
+}
+
+void gemm_ext(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+              onemkl::offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+              cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
+              cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo, float beta,
+              cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+    //UNSUPPORTED
+}
+
+void gemm_ext(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+              onemkl::offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+              cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo,
+              cl::sycl::buffer<float, 1> &scales, int8_t zc, cl::sycl::buffer<int8_t, 1> &c,
+              std::int64_t ldc) {
+    //UNSUPPORTED
+}
+
+void gemm_ext(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+              onemkl::offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+              cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo,
+              cl::sycl::buffer<float, 1> &scales, uint8_t zc, cl::sycl::buffer<uint8_t, 1> &c,
+              std::int64_t ldc) {
+    //UNSUPPORTED
+}
+
+void gemm_ext(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+              onemkl::offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+              cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+              cl::sycl::buffer<float, 1> &scales, int8_t zc, cl::sycl::buffer<int8_t, 1> &c,
+              std::int64_t ldc) {
+    //UNSUPPORTED
+}
+
+void gemm_ext(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+              onemkl::offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+              cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+              cl::sycl::buffer<float, 1> &scales, uint8_t zc, cl::sycl::buffer<uint8_t, 1> &c,
+              std::int64_t ldc) {
+    //UNSUPPORTED
+}
+
+void gemm_ext(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+              onemkl::offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
+              cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+              cl::sycl::buffer<float, 1> &scales, int8_t zc, cl::sycl::buffer<int8_t, 1> &c,
+              std::int64_t ldc) {
+    //UNSUPPORTED
+}
+
+void gemm_ext(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+              onemkl::offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
+              cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+              cl::sycl::buffer<float, 1> &scales, uint8_t zc, cl::sycl::buffer<uint8_t, 1> &c,
+              std::int64_t ldc) {
+    //UNSUPPORTED
+}
+
+void gemm_s8u8s32_compute(cl::sycl::queue &queue, onemkl::transpose transb, onemkl::offset offsetc,
+                          std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                          cl::sycl::buffer<int8_t, 1> &packed_a, int8_t ao,
+                          cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo, float beta,
+                          cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                          cl::sycl::buffer<int32_t, 1> &co) {
+    //UNSUPPORTED
+}
+
+void gemm_s8u8s32_compute(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::offset offsetc,
+                          std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                          cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+                          cl::sycl::buffer<uint8_t, 1> &packed_b, uint8_t bo, float beta,
+                          cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                          cl::sycl::buffer<int32_t, 1> &co) {
+    //UNSUPPORTED
+}
+
+void gemm_s8u8s32_pack(cl::sycl::queue &queue, onemkl::transpose transa, std::int64_t m,
+                       std::int64_t n, std::int64_t k, cl::sycl::buffer<int8_t, 1> &a,
+                       std::int64_t lda, cl::sycl::buffer<int8_t, 1> &packed_a) {
+    //UNSUPPORTED
+}
+
+void gemm_s8u8s32_pack(cl::sycl::queue &queue, onemkl::transpose transb, std::int64_t m,
+                       std::int64_t n, std::int64_t k, cl::sycl::buffer<uint8_t, 1> &b,
+                       std::int64_t ldb, cl::sycl::buffer<uint8_t, 1> &packed_b) {
+    //UNSUPPORTED
+}
+
+std::int64_t gemm_s8u8s32_pack_get_size(cl::sycl::queue &queue, onemkl::identifier which,
+                                        std::int64_t m, std::int64_t n, std::int64_t k) {
+    //UNSUPPORTED
+    return {};
+}
+
+void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<onemkl::transpose, 1> &transa,
+                cl::sycl::buffer<onemkl::transpose, 1> &transb,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<float, 1> &alpha,
+                cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::int64_t, 1> &offset_a, cl::sycl::buffer<float, 1> &b,
+                cl::sycl::buffer<std::int64_t, 1> &ldb, cl::sycl::buffer<std::int64_t, 1> &offset_b,
+                cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, cl::sycl::buffer<std::int64_t, 1> &offset_c,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<onemkl::transpose, 1> &transa,
+                cl::sycl::buffer<onemkl::transpose, 1> &transb,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<double, 1> &alpha,
+                cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::int64_t, 1> &offset_a, cl::sycl::buffer<double, 1> &b,
+                cl::sycl::buffer<std::int64_t, 1> &ldb, cl::sycl::buffer<std::int64_t, 1> &offset_b,
+                cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, cl::sycl::buffer<std::int64_t, 1> &offset_c,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<onemkl::transpose, 1> &transa,
+                cl::sycl::buffer<onemkl::transpose, 1> &transb,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                cl::sycl::buffer<std::complex<float>, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+                cl::sycl::buffer<std::int64_t, 1> &offset_b,
+                cl::sycl::buffer<std::complex<float>, 1> &beta,
+                cl::sycl::buffer<std::complex<float>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<onemkl::transpose, 1> &transa,
+                cl::sycl::buffer<onemkl::transpose, 1> &transb,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                cl::sycl::buffer<std::complex<double>, 1> &b,
+                cl::sycl::buffer<std::int64_t, 1> &ldb, cl::sycl::buffer<std::int64_t, 1> &offset_b,
+                cl::sycl::buffer<std::complex<double>, 1> &beta,
+                cl::sycl::buffer<std::complex<double>, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, cl::sycl::buffer<std::int64_t, 1> &offset_c,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void herk_batch(cl::sycl::queue &queue, cl::sycl::buffer<onemkl::uplo, 1> &upper_lower,
+                cl::sycl::buffer<onemkl::transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<float, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void herk_batch(cl::sycl::queue &queue, cl::sycl::buffer<onemkl::uplo, 1> &upper_lower,
+                cl::sycl::buffer<onemkl::transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<double, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<double, 1> &beta,
+                cl::sycl::buffer<std::complex<double>, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void herk_batch(cl::sycl::queue &queue, onemkl::uplo upper_lower, onemkl::transpose trans,
+                std::int64_t n, std::int64_t k, float alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, float beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+                std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void herk_batch(cl::sycl::queue &queue, onemkl::uplo upper_lower, onemkl::transpose trans,
+                std::int64_t n, std::int64_t k, double alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, double beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+                std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void syrk_batch(cl::sycl::queue &queue, cl::sycl::buffer<onemkl::uplo, 1> &upper_lower,
+                cl::sycl::buffer<onemkl::transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<float, 1> &alpha,
+                cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void syrk_batch(cl::sycl::queue &queue, cl::sycl::buffer<onemkl::uplo, 1> &upper_lower,
+                cl::sycl::buffer<onemkl::transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<double, 1> &alpha,
+                cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void syrk_batch(cl::sycl::queue &queue, cl::sycl::buffer<onemkl::uplo, 1> &upper_lower,
+                cl::sycl::buffer<onemkl::transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<float>, 1> &beta,
+                cl::sycl::buffer<std::complex<float>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void syrk_batch(cl::sycl::queue &queue, cl::sycl::buffer<onemkl::uplo, 1> &upper_lower,
+                cl::sycl::buffer<onemkl::transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<double>, 1> &beta,
+                cl::sycl::buffer<std::complex<double>, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void syrk_batch(cl::sycl::queue &queue, onemkl::uplo upper_lower, onemkl::transpose trans,
+                std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a,
+                std::int64_t lda, std::int64_t stride_a, float beta, cl::sycl::buffer<float, 1> &c,
+                std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void syrk_batch(cl::sycl::queue &queue, onemkl::uplo upper_lower, onemkl::transpose trans,
+                std::int64_t n, std::int64_t k, double alpha, cl::sycl::buffer<double, 1> &a,
+                std::int64_t lda, std::int64_t stride_a, double beta,
+                cl::sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void syrk_batch(cl::sycl::queue &queue, onemkl::uplo upper_lower, onemkl::transpose trans,
+                std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, std::complex<float> beta,
+                cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void syrk_batch(cl::sycl::queue &queue, onemkl::uplo upper_lower, onemkl::transpose trans,
+                std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, std::complex<double> beta,
+                cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void gemv_batch(cl::sycl::queue &queue, cl::sycl::buffer<onemkl::transpose, 1> &trans,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<float, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<float, 1> &beta,
+                cl::sycl::buffer<float, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void gemv_batch(cl::sycl::queue &queue, cl::sycl::buffer<onemkl::transpose, 1> &trans,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<double, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<double, 1> &beta,
+                cl::sycl::buffer<double, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void gemv_batch(cl::sycl::queue &queue, cl::sycl::buffer<onemkl::transpose, 1> &trans,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<float>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<float>, 1> &beta,
+                cl::sycl::buffer<std::complex<float>, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void gemv_batch(cl::sycl::queue &queue, cl::sycl::buffer<onemkl::transpose, 1> &trans,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<double>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<double>, 1> &beta,
+                cl::sycl::buffer<std::complex<double>, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void gemv_batch(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m, std::int64_t n,
+                float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                cl::sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stride_x, float beta,
+                cl::sycl::buffer<float, 1> &y, std::int64_t incy, std::int64_t stride_y,
+                std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void gemv_batch(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m, std::int64_t n,
+                double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, double beta, cl::sycl::buffer<double, 1> &y,
+                std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void gemv_batch(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m, std::int64_t n,
+                std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                std::int64_t lda, std::int64_t stride_a,
+                cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, std::complex<float> beta,
+                cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                std::int64_t stride_y, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void gemv_batch(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m, std::int64_t n,
+                std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                std::int64_t lda, std::int64_t stride_a,
+                cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, std::complex<double> beta,
+                cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                std::int64_t stride_y, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void dgmm_batch(cl::sycl::queue &queue, cl::sycl::buffer<onemkl::side, 1> &left_right,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void dgmm_batch(cl::sycl::queue &queue, cl::sycl::buffer<onemkl::side, 1> &left_right,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<double, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<double, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void dgmm_batch(cl::sycl::queue &queue, cl::sycl::buffer<onemkl::side, 1> &left_right,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<float>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<float>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void dgmm_batch(cl::sycl::queue &queue, cl::sycl::buffer<onemkl::side, 1> &left_right,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<double>, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<double>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<double>, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void dgmm_batch(cl::sycl::queue &queue, onemkl::side left_right, std::int64_t m, std::int64_t n,
+                cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                cl::sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stride_x,
+                cl::sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void dgmm_batch(cl::sycl::queue &queue, onemkl::side left_right, std::int64_t m, std::int64_t n,
+                cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                cl::sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stride_x,
+                cl::sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void dgmm_batch(cl::sycl::queue &queue, onemkl::side left_right, std::int64_t m, std::int64_t n,
+                cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &x,
+                std::int64_t incx, std::int64_t stride_x,
+                cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void dgmm_batch(cl::sycl::queue &queue, onemkl::side left_right, std::int64_t m, std::int64_t n,
+                cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &x,
+                std::int64_t incx, std::int64_t stride_x,
+                cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void axpy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<float, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void axpy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<double, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void axpy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<float>, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void axpy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<double>, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void axpy_batch(cl::sycl::queue &queue, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+                std::int64_t incx, std::int64_t stride_x, cl::sycl::buffer<float, 1> &y,
+                std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void axpy_batch(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                cl::sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stride_x,
+                cl::sycl::buffer<double, 1> &y, std::int64_t incy, std::int64_t stride_y,
+                std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void axpy_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, cl::sycl::buffer<std::complex<float>, 1> &y,
+                std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void axpy_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, cl::sycl::buffer<std::complex<double>, 1> &y,
+                std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void copy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<float, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void copy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<double, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void copy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<float>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<float>, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void copy_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<double>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<double>, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void copy_batch(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                std::int64_t incx, std::int64_t stride_x, cl::sycl::buffer<float, 1> &y,
+                std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void copy_batch(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                std::int64_t incx, std::int64_t stride_x, cl::sycl::buffer<double, 1> &y,
+                std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void copy_batch(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
+                std::int64_t incx, std::int64_t stride_x,
+                cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                std::int64_t stride_y, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void copy_batch(cl::sycl::queue &queue, std::int64_t n,
+                cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, cl::sycl::buffer<std::complex<double>, 1> &y,
+                std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void dot_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+               cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+               cl::sycl::buffer<float, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+               cl::sycl::buffer<float, 1> &result, std::int64_t group_count,
+               cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void dot_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+               cl::sycl::buffer<double, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+               cl::sycl::buffer<double, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+               cl::sycl::buffer<double, 1> &result, std::int64_t group_count,
+               cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void dot_batch(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+               std::int64_t incx, std::int64_t stride_x, cl::sycl::buffer<float, 1> &y,
+               std::int64_t incy, std::int64_t stride_y, cl::sycl::buffer<float, 1> &result,
+               std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void dot_batch(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+               std::int64_t incx, std::int64_t stride_x, cl::sycl::buffer<double, 1> &y,
+               std::int64_t incy, std::int64_t stride_y, cl::sycl::buffer<double, 1> &result,
+               std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void scal_batch(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void scal_batch(cl::sycl::queue &queue, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+                std::int64_t incx, std::int64_t stride_x, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void scal_batch(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                cl::sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stride_x,
+                std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void scal_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void scal_batch(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void scal_batch(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void scal_batch(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<onemkl::transpose, 1> &transa,
+                cl::sycl::buffer<onemkl::transpose, 1> &transb,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<half, 1> &alpha,
+                cl::sycl::buffer<half, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::int64_t, 1> &offset_a, cl::sycl::buffer<half, 1> &b,
+                cl::sycl::buffer<std::int64_t, 1> &ldb, cl::sycl::buffer<std::int64_t, 1> &offset_b,
+                cl::sycl::buffer<half, 1> &beta, cl::sycl::buffer<half, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, cl::sycl::buffer<std::int64_t, 1> &offset_c,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void gemm_batch(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+                std::int64_t m, std::int64_t n, std::int64_t k, half alpha,
+                cl::sycl::buffer<half, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                cl::sycl::buffer<half, 1> &b, std::int64_t ldb, std::int64_t stride_b, half beta,
+                cl::sycl::buffer<half, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<onemkl::transpose, 1> &transa,
+                cl::sycl::buffer<onemkl::transpose, 1> &transb,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<float, 1> &alpha,
+                cl::sycl::buffer<half, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::int64_t, 1> &offset_a, cl::sycl::buffer<half, 1> &b,
+                cl::sycl::buffer<std::int64_t, 1> &ldb, cl::sycl::buffer<std::int64_t, 1> &offset_b,
+                cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, cl::sycl::buffer<std::int64_t, 1> &offset_c,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void gemm_batch(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+                std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                cl::sycl::buffer<half, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                cl::sycl::buffer<half, 1> &b, std::int64_t ldb, std::int64_t stride_b, float beta,
+                cl::sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<onemkl::transpose, 1> &transa,
+                cl::sycl::buffer<onemkl::transpose, 1> &transb,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<float, 1> &alpha,
+                cl::sycl::buffer<int8_t, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::int64_t, 1> &offset_a, cl::sycl::buffer<uint8_t, 1> &b,
+                cl::sycl::buffer<std::int64_t, 1> &ldb, cl::sycl::buffer<std::int64_t, 1> &offset_b,
+                cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<int32_t, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, cl::sycl::buffer<std::int64_t, 1> &offset_c,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    //UNSUPPORTED
+}
+
+void gemm_batch(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+                std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                float beta, cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void gepack_compact(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                    cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                    cl::sycl::buffer<float, 1> &ap, std::int64_t ldap, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void gepack_compact(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                    cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                    cl::sycl::buffer<double, 1> &ap, std::int64_t ldap, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void geunpack_compact(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                      cl::sycl::buffer<float, 1> &ap, std::int64_t ldap,
+                      cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                      std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void geunpack_compact(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                      cl::sycl::buffer<double, 1> &ap, std::int64_t ldap,
+                      cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                      std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void gemm_compact(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+                  std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                  cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+                  std::int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                  std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void gemm_compact(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+                  std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                  cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+                  std::int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                  std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void trsm_compact(cl::sycl::queue &queue, onemkl::side left_right, onemkl::uplo upper_lower,
+                  onemkl::transpose trans, onemkl::diag unit_diag, std::int64_t m, std::int64_t n,
+                  float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                  cl::sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void trsm_compact(cl::sycl::queue &queue, onemkl::side left_right, onemkl::uplo upper_lower,
+                  onemkl::transpose trans, onemkl::diag unit_diag, std::int64_t m, std::int64_t n,
+                  double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                  cl::sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void getrfnp_compact(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                     cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void getrfnp_compact(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                     cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void axpby(cl::sycl::queue &queue, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+           std::int64_t incx, float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    //UNSUPPORTED
+}
+
+void axpby(cl::sycl::queue &queue, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
+           std::int64_t incx, double beta, cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+    //UNSUPPORTED
+}
+
+void axpby(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::complex<float> beta,
+           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
+    //UNSUPPORTED
+}
+
+void axpby(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
+           std::int64_t incy) {
+    //UNSUPPORTED
+}
+
+void imatcopy(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m, std::int64_t n,
+              float alpha, cl::sycl::buffer<float, 1> &ab, std::int64_t lda, std::int64_t ldb) {
+    //UNSUPPORTED
+}
+
+void imatcopy(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m, std::int64_t n,
+              double alpha, cl::sycl::buffer<double, 1> &ab, std::int64_t lda, std::int64_t ldb) {
+    //UNSUPPORTED
+}
+
+void imatcopy(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m, std::int64_t n,
+              std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &ab,
+              std::int64_t lda, std::int64_t ldb) {
+    //UNSUPPORTED
+}
+
+void imatcopy(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m, std::int64_t n,
+              std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &ab,
+              std::int64_t lda, std::int64_t ldb) {
+    //UNSUPPORTED
+}
+
+void omatadd(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+             std::int64_t m, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+             std::int64_t lda, float beta, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    //UNSUPPORTED
+}
+
+void omatadd(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+             std::int64_t m, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+             std::int64_t lda, double beta, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    //UNSUPPORTED
+}
+
+void omatadd(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+             std::int64_t m, std::int64_t n, std::complex<float> alpha,
+             cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+             std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &b,
+             std::int64_t ldb, cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    //UNSUPPORTED
+}
+
+void omatadd(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+             std::int64_t m, std::int64_t n, std::complex<double> alpha,
+             cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+             std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &b,
+             std::int64_t ldb, cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    //UNSUPPORTED
+}
+
+void omatcopy(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m, std::int64_t n,
+              float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<float, 1> &b, std::int64_t ldb) {
+    //UNSUPPORTED
+}
+
+void omatcopy(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m, std::int64_t n,
+              double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<double, 1> &b, std::int64_t ldb) {
+    //UNSUPPORTED
+}
+
+void omatcopy(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m, std::int64_t n,
+              std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+              std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
+    //UNSUPPORTED
+}
+
+void omatcopy(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m, std::int64_t n,
+              std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+              std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
+    //UNSUPPORTED
+}
+
+void imatcopy_batch(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m, std::int64_t n,
+                    float alpha, cl::sycl::buffer<float, 1> &ab, std::int64_t lda, std::int64_t ldb,
+                    std::int64_t stride, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void imatcopy_batch(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m, std::int64_t n,
+                    double alpha, cl::sycl::buffer<double, 1> &ab, std::int64_t lda,
+                    std::int64_t ldb, std::int64_t stride, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void imatcopy_batch(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m, std::int64_t n,
+                    std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &ab,
+                    std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                    std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void imatcopy_batch(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m, std::int64_t n,
+                    std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &ab,
+                    std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                    std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void omatadd_batch(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+                   std::int64_t m, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                   std::int64_t lda, std::int64_t stride_a, float beta,
+                   cl::sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                   std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void omatadd_batch(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+                   std::int64_t m, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+                   std::int64_t lda, std::int64_t stride_a, double beta,
+                   cl::sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                   std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void omatadd_batch(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+                   std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                   cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, std::complex<float> beta,
+                   cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, cl::sycl::buffer<std::complex<float>, 1> &c,
+                   std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void omatadd_batch(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+                   std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                   cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, std::complex<double> beta,
+                   cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, cl::sycl::buffer<std::complex<double>, 1> &c,
+                   std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void omatcopy_batch(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m, std::int64_t n,
+                    float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                    std::int64_t stride_b, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void omatcopy_batch(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m, std::int64_t n,
+                    double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                    std::int64_t stride_b, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void omatcopy_batch(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m, std::int64_t n,
+                    std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                    std::int64_t lda, std::int64_t stride_a,
+                    cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                    std::int64_t stride_b, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void omatcopy_batch(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m, std::int64_t n,
+                    std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                    std::int64_t lda, std::int64_t stride_a,
+                    cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                    std::int64_t stride_b, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void asum(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<float, 1> &result, onemkl::accumulation acc) {
+    //UNSUPPORTED
+}
+
+void dot(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+         cl::sycl::buffer<float, 1> &y, std::int64_t incy, cl::sycl::buffer<float, 1> &result,
+         onemkl::accumulation acc) {
+    //UNSUPPORTED
+}
+
+void nrm2(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<float, 1> &result, onemkl::accumulation acc) {
+    //UNSUPPORTED
+}
+
+void axpbypcz(cl::sycl::queue &queue, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+              std::int64_t incx, float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+              float gamma, cl::sycl::buffer<float, 1> &z, std::int64_t incz) {
+    //UNSUPPORTED
+}
+
+void axpbypcz(cl::sycl::queue &queue, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
+              std::int64_t incx, double beta, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+              double gamma, cl::sycl::buffer<double, 1> &z, std::int64_t incz) {
+    //UNSUPPORTED
+}
+
+void axpbypcz_dot(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                  cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                  cl::sycl::buffer<float, 1> &y, std::int64_t incy, float gamma,
+                  cl::sycl::buffer<float, 1> &z, std::int64_t incz, cl::sycl::buffer<float, 1> &w,
+                  std::int64_t incw, cl::sycl::buffer<float, 1> &result) {
+    //UNSUPPORTED
+}
+
+void axpbypcz_dot(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                  cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                  cl::sycl::buffer<double, 1> &y, std::int64_t incy, double gamma,
+                  cl::sycl::buffer<double, 1> &z, std::int64_t incz, cl::sycl::buffer<double, 1> &w,
+                  std::int64_t incw, cl::sycl::buffer<double, 1> &result) {
+    //UNSUPPORTED
+}
+
+cl::sycl::event asum(cl::sycl::queue &queue, std::int64_t n,
+                     cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                     float *result) {
+    //UNSUPPORTED
+    return {};
+}
+
+cl::sycl::event asum(cl::sycl::queue &queue, std::int64_t n,
+                     cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                     double *result) {
+    //UNSUPPORTED
+    return {};
+}
+
+cl::sycl::event asum(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                     std::int64_t incx, float *result) {
+    //UNSUPPORTED
+    return {};
+}
+
+cl::sycl::event asum(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                     std::int64_t incx, double *result) {
+    //UNSUPPORTED
+    return {};
+}
+
+cl::sycl::event dot(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                    std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                    float *result) {
+    //UNSUPPORTED
+    return {};
+}
+
+cl::sycl::event dot(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                    std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                    double *result) {
+    //UNSUPPORTED
+    return {};
+}
+
+cl::sycl::event dot(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                    std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                    double *result) {
+    //UNSUPPORTED
+    return {};
+}
+
+cl::sycl::event iamin(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                      std::int64_t incx, std::int64_t *result) {
+    //UNSUPPORTED
+    return {};
+}
+
+cl::sycl::event iamin(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                      std::int64_t incx, std::int64_t *result) {
+    //UNSUPPORTED
+    return {};
+}
+
+cl::sycl::event iamin(cl::sycl::queue &queue, std::int64_t n,
+                      cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                      std::int64_t *result) {
+    //UNSUPPORTED
+    return {};
+}
+
+cl::sycl::event iamin(cl::sycl::queue &queue, std::int64_t n,
+                      cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                      std::int64_t *result) {
+    //UNSUPPORTED
+    return {};
+}
+
+cl::sycl::event iamax(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                      std::int64_t incx, std::int64_t *result) {
+    //UNSUPPORTED
+    return {};
+}
+
+cl::sycl::event iamax(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                      std::int64_t incx, std::int64_t *result) {
+    //UNSUPPORTED
+    return {};
+}
+
+cl::sycl::event iamax(cl::sycl::queue &queue, std::int64_t n,
+                      cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                      std::int64_t *result) {
+    //UNSUPPORTED
+    return {};
+}
+
+cl::sycl::event iamax(cl::sycl::queue &queue, std::int64_t n,
+                      cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                      std::int64_t *result) {
+    //UNSUPPORTED
+    return {};
+}
+
+cl::sycl::event nrm2(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                     std::int64_t incx, float *result) {
+    //UNSUPPORTED
+    return {};
+}
+
+cl::sycl::event nrm2(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                     std::int64_t incx, double *result) {
+    //UNSUPPORTED
+    return {};
+}
+
+cl::sycl::event nrm2(cl::sycl::queue &queue, std::int64_t n,
+                     cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                     float *result) {
+    //UNSUPPORTED
+    return {};
+}
+
+cl::sycl::event nrm2(cl::sycl::queue &queue, std::int64_t n,
+                     cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                     double *result) {
+    //UNSUPPORTED
+    return {};
+}
+
+void gbtge(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl, std::int64_t ku,
+           cl::sycl::buffer<float, 1> &ab, std::int64_t ldab, cl::sycl::buffer<float, 1> &a,
+           std::int64_t lda) {
+    //UNSUPPORTED
+}
+
+void gbtge(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl, std::int64_t ku,
+           cl::sycl::buffer<double, 1> &ab, std::int64_t ldab, cl::sycl::buffer<double, 1> &a,
+           std::int64_t lda) {
+    //UNSUPPORTED
+}
+
+void gbtge(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl, std::int64_t ku,
+           cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t ldab,
+           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
+    //UNSUPPORTED
+}
+
+void gbtge(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl, std::int64_t ku,
+           cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t ldab,
+           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
+    //UNSUPPORTED
+}
+
+void gettgb(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+            std::int64_t ku, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<float, 1> &ab, std::int64_t ldab) {
+    //UNSUPPORTED
+}
+
+void gettgb(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+            std::int64_t ku, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<double, 1> &ab, std::int64_t ldab) {
+    //UNSUPPORTED
+}
+
+void gettgb(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+            std::int64_t ku, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t ldab) {
+    //UNSUPPORTED
+}
+
+void gettgb(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+            std::int64_t ku, cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t ldab) {
+    //UNSUPPORTED
+}
+
+void tpttr(cl::sycl::queue &queue, onemkl::uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<float, 1> &ap, cl::sycl::buffer<float, 1> &a, std::int64_t lda) {
+    //UNSUPPORTED
+}
+
+void tpttr(cl::sycl::queue &queue, onemkl::uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<double, 1> &ap, cl::sycl::buffer<double, 1> &a, std::int64_t lda) {
+    //UNSUPPORTED
+}
+
+void tpttr(cl::sycl::queue &queue, onemkl::uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<std::complex<float>, 1> &ap,
+           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
+    //UNSUPPORTED
+}
+
+void tpttr(cl::sycl::queue &queue, onemkl::uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<std::complex<double>, 1> &ap,
+           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
+    //UNSUPPORTED
+}
+
+void trttp(cl::sycl::queue &queue, onemkl::uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &ap) {
+    //UNSUPPORTED
+}
+
+void trttp(cl::sycl::queue &queue, onemkl::uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &ap) {
+    //UNSUPPORTED
+}
+
+void trttp(cl::sycl::queue &queue, onemkl::uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+           cl::sycl::buffer<std::complex<float>, 1> &ap) {
+    //UNSUPPORTED
+}
+
+void trttp(cl::sycl::queue &queue, onemkl::uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+           cl::sycl::buffer<std::complex<double>, 1> &ap) {
+    //UNSUPPORTED
+}
+
+void gbtge_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                 std::int64_t ku, cl::sycl::buffer<float, 1> &ab, std::int64_t ldab,
+                 std::int64_t stride_ab, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                 std::int64_t stride_a, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void gbtge_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                 std::int64_t ku, cl::sycl::buffer<double, 1> &ab, std::int64_t ldab,
+                 std::int64_t stride_ab, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                 std::int64_t stride_a, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void gbtge_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                 std::int64_t ku, cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t ldab,
+                 std::int64_t stride_ab, cl::sycl::buffer<std::complex<float>, 1> &a,
+                 std::int64_t lda, std::int64_t stride_a, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void gbtge_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                 std::int64_t ku, cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t ldab,
+                 std::int64_t stride_ab, cl::sycl::buffer<std::complex<double>, 1> &a,
+                 std::int64_t lda, std::int64_t stride_a, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void gettgb_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                  std::int64_t ku, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                  std::int64_t stride_a, cl::sycl::buffer<float, 1> &ab, std::int64_t ldab,
+                  std::int64_t stride_ab, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void gettgb_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                  std::int64_t ku, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                  std::int64_t stride_a, cl::sycl::buffer<double, 1> &ab, std::int64_t ldab,
+                  std::int64_t stride_ab, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void gettgb_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                  std::int64_t ku, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                  std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &ab,
+                  std::int64_t ldab, std::int64_t stride_ab, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void gettgb_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                  std::int64_t ku, cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                  std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &ab,
+                  std::int64_t ldab, std::int64_t stride_ab, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void tpttr_batch(cl::sycl::queue &queue, onemkl::uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<float, 1> &ap, std::int64_t stride_ap,
+                 cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                 std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void tpttr_batch(cl::sycl::queue &queue, onemkl::uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<double, 1> &ap, std::int64_t stride_ap,
+                 cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                 std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void tpttr_batch(cl::sycl::queue &queue, onemkl::uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<std::complex<float>, 1> &ap, std::int64_t stride_ap,
+                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                 std::int64_t stride_a, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void tpttr_batch(cl::sycl::queue &queue, onemkl::uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<std::complex<double>, 1> &ap, std::int64_t stride_ap,
+                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                 std::int64_t stride_a, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void trttp_batch(cl::sycl::queue &queue, onemkl::uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                 cl::sycl::buffer<float, 1> &ap, std::int64_t stride_ap, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void trttp_batch(cl::sycl::queue &queue, onemkl::uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                 cl::sycl::buffer<double, 1> &ap, std::int64_t stride_ap, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void trttp_batch(cl::sycl::queue &queue, onemkl::uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                 std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &ap,
+                 std::int64_t stride_ap, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void trttp_batch(cl::sycl::queue &queue, onemkl::uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                 std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &ap,
+                 std::int64_t stride_ap, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void gemv(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m, std::int64_t n,
+          float alpha, cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+          cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+          cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    //UNSUPPORTED
+}
+
+void gemv(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m, std::int64_t n,
+          float alpha, cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+          cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+          cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    //UNSUPPORTED
+}
+
+void gemv_batch(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m, std::int64_t n,
+                float alpha, cl::sycl::buffer<half, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                cl::sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stride_x, float beta,
+                cl::sycl::buffer<float, 1> &y, std::int64_t incy, std::int64_t stride_y,
+                std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void gemv_batch(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m, std::int64_t n,
+                float alpha, cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                std::int64_t stride_y, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void lange(cl::sycl::queue &queue, onemkl::norm_type norm, onemkl::transpose trans, std::int64_t m,
+           std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+           cl::sycl::buffer<float, 1> &result) {
+    //UNSUPPORTED
+}
+
+void lange(cl::sycl::queue &queue, onemkl::norm_type norm, onemkl::transpose trans, std::int64_t m,
+           std::int64_t n, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+           cl::sycl::buffer<double, 1> &result) {
+    //UNSUPPORTED
+}
+
+void reduce_columns(cl::sycl::queue &queue, onemkl::reduction op, onemkl::transpose trans,
+                    std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                    cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    //UNSUPPORTED
+}
+
+void reduce_columns(cl::sycl::queue &queue, onemkl::reduction op, onemkl::transpose trans,
+                    std::int64_t m, std::int64_t n, cl::sycl::buffer<double, 1> &a,
+                    std::int64_t lda, cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+    //UNSUPPORTED
+}
+
+void reduce_rows(cl::sycl::queue &queue, onemkl::reduction op, onemkl::transpose trans,
+                 std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                 cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    //UNSUPPORTED
+}
+
+void reduce_rows(cl::sycl::queue &queue, onemkl::reduction op, onemkl::transpose trans,
+                 std::int64_t m, std::int64_t n, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                 cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+    //UNSUPPORTED
+}
+
+void omatclamp(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float lo, float hi,
+               cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+               std::int64_t ldb) {
+    //UNSUPPORTED
+}
+
+void omatclamp(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, double lo, double hi,
+               cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+               std::int64_t ldb) {
+    //UNSUPPORTED
+}
+
+void omatclamp_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float lo, float hi,
+                     cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                     cl::sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                     std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void omatclamp_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, double lo, double hi,
+                     cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                     cl::sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                     std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void omatdiv(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a,
+             std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    //UNSUPPORTED
+}
+
+void omatdiv(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, cl::sycl::buffer<double, 1> &a,
+             std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    //UNSUPPORTED
+}
+
+void omatdiv(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+             cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    //UNSUPPORTED
+}
+
+void omatdiv(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+             cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    //UNSUPPORTED
+}
+
+void omatdiv_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                   std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void omatdiv_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                   std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void omatdiv_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                   std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void omatdiv_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                   std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void omatfma(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float alpha,
+             cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+             std::int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    //UNSUPPORTED
+}
+
+void omatfma(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, double alpha,
+             cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+             std::int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    //UNSUPPORTED
+}
+
+void omatfma(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<float> alpha,
+             cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+             cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+             std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+             std::int64_t ldc) {
+    //UNSUPPORTED
+}
+
+void omatfma(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<double> alpha,
+             cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+             cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+             std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+             std::int64_t ldc) {
+    //UNSUPPORTED
+}
+
+void omatfma_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float alpha,
+                   cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void omatfma_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, double alpha,
+                   cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void omatfma_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                   std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, std::complex<float> beta,
+                   cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void omatfma_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                   std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, std::complex<double> beta,
+                   cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void omatmul(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a,
+             std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    //UNSUPPORTED
+}
+
+void omatmul(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, cl::sycl::buffer<double, 1> &a,
+             std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    //UNSUPPORTED
+}
+
+void omatmul(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+             cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    //UNSUPPORTED
+}
+
+void omatmul(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+             cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    //UNSUPPORTED
+}
+
+void omatmul_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                   std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void omatmul_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                   std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void omatmul_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                   std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void omatmul_batch(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                   std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void vclamp(cl::sycl::queue &queue, std::int64_t n, float lo, float hi,
+            cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
+            std::int64_t incy) {
+    //UNSUPPORTED
+}
+
+void vclamp(cl::sycl::queue &queue, std::int64_t n, double lo, double hi,
+            cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
+            std::int64_t incy) {
+    //UNSUPPORTED
+}
+
+void vdiv(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<float, 1> &y, std::int64_t incy, cl::sycl::buffer<float, 1> &z,
+          std::int64_t incz) {
+    //UNSUPPORTED
+}
+
+void vdiv(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<double, 1> &y, std::int64_t incy, cl::sycl::buffer<double, 1> &z,
+          std::int64_t incz) {
+    //UNSUPPORTED
+}
+
+void vdiv(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
+          std::int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+          cl::sycl::buffer<std::complex<float>, 1> &z, std::int64_t incz) {
+    //UNSUPPORTED
+}
+
+void vdiv(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x,
+          std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+          cl::sycl::buffer<std::complex<double>, 1> &z, std::int64_t incz) {
+    //UNSUPPORTED
+}
+
+void vfma(cl::sycl::queue &queue, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+          std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy, float beta,
+          cl::sycl::buffer<float, 1> &z, std::int64_t incz) {
+    //UNSUPPORTED
+}
+
+void vfma(cl::sycl::queue &queue, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
+          std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy, double beta,
+          cl::sycl::buffer<double, 1> &z, std::int64_t incz) {
+    //UNSUPPORTED
+}
+
+void vfma(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy, std::complex<float> beta,
+          cl::sycl::buffer<std::complex<float>, 1> &z, std::int64_t incz) {
+    //UNSUPPORTED
+}
+
+void vfma(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+          std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &z,
+          std::int64_t incz) {
+    //UNSUPPORTED
+}
+
+void vmul(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<float, 1> &y, std::int64_t incy, cl::sycl::buffer<float, 1> &z,
+          std::int64_t incz) {
+    //UNSUPPORTED
+}
+
+void vmul(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<double, 1> &y, std::int64_t incy, cl::sycl::buffer<double, 1> &z,
+          std::int64_t incz) {
+    //UNSUPPORTED
+}
+
+void vmul(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
+          std::int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+          cl::sycl::buffer<std::complex<float>, 1> &z, std::int64_t incz) {
+    //UNSUPPORTED
+}
+
+void vmul(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x,
+          std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+          cl::sycl::buffer<std::complex<double>, 1> &z, std::int64_t incz) {
+    //UNSUPPORTED
+}
+
+void gemm3m(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+            std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+            cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+            cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    //UNSUPPORTED
+}
+
+void gemm3m(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+            std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+            cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+            std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+            std::int64_t ldc) {
+    //UNSUPPORTED
+}
+
+void gemm3m_batch(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+                  std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                  cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                  std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                  std::int64_t ldb, std::int64_t stride_b, std::complex<float> beta,
+                  cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                  std::int64_t stride_c, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
+void gemm3m_batch(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+                  std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                  cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                  std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                  std::int64_t ldb, std::int64_t stride_b, std::complex<double> beta,
+                  cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                  std::int64_t stride_c, std::int64_t batch_size) {
+    //UNSUPPORTED
+}
+
 } // namespace mklgpu
 } // namespace onemkl
@@ -1314,6 +1314,2002 @@ void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa, transpose
                                             beta, c, ldc);
 }
 
+void convert(char *libname, cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<half, 1> &x,
+             cl::sycl::buffer<float, 1> &y) {
+    function_tables[libname].convert_f16f32_sycl(queue, n, x, y);
+}
+
+void convert(char *libname, cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+             cl::sycl::buffer<half, 1> &y) {
+    function_tables[libname].convert_f32f16_sycl(queue, n, x, y);
+}
+
+void convert(char *libname, cl::sycl::queue &queue, std::int64_t n,
+             cl::sycl::buffer<bfloat16, 1> &x, cl::sycl::buffer<float, 1> &y) {
+    function_tables[libname].convert_bf16f32_sycl(queue, n, x, y);
+}
+
+void convert(char *libname, cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+             cl::sycl::buffer<bfloat16, 1> &y) {
+    function_tables[libname].convert_f32bf16_sycl(queue, n, x, y);
+}
+
+void convert(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<half, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+             std::int64_t ldb) {
+    function_tables[libname].convert_f16f32_matrix_sycl(queue, m, n, a, lda, b, ldb);
+}
+
+void convert(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<half, 1> &b,
+             std::int64_t ldb) {
+    function_tables[libname].convert_f32f16_matrix_sycl(queue, m, n, a, lda, b, ldb);
+}
+
+void convert(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+             std::int64_t ldb) {
+    function_tables[libname].convert_bf16f32_matrix_sycl(queue, m, n, a, lda, b, ldb);
+}
+
+void convert(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<bfloat16, 1> &b,
+             std::int64_t ldb) {
+    function_tables[libname].convert_f32bf16_matrix_sycl(queue, m, n, a, lda, b, ldb);
+}
+
+void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+              offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+              cl::sycl::buffer<int16_t, 1> &a, std::int64_t lda, int16_t ao,
+              cl::sycl::buffer<int16_t, 1> &b, std::int64_t ldb, int16_t bo, float beta,
+              cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+    function_tables[libname].gemm_s16s16s32_ext_sycl(queue, transa, transb, offsetc, m, n, k, alpha,
+                                                     a, lda, ao, b, ldb, bo, beta, c, ldc, co);
+}
+
+void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+              offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+              cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+              cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo, float beta,
+              cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+    function_tables[libname].gemm_s8s8s32_ext_sycl(queue, transa, transb, offsetc, m, n, k, alpha,
+                                                   a, lda, ao, b, ldb, bo, beta, c, ldc, co);
+}
+
+void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+              offset offsetc, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+              cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
+              cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo, float beta,
+              cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+    function_tables[libname].gemm_u8s8s32_ext_sycl(queue, transa, transb, offsetc, m, n, k, alpha,
+                                                   a, lda, ao, b, ldb, bo, beta, c, ldc, co);
+}
+
+void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+              offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+              cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo,
+              cl::sycl::buffer<float, 1> &scales, int8_t zc, cl::sycl::buffer<int8_t, 1> &c,
+              std::int64_t ldc) {
+    function_tables[libname].gemm_s8u8s8_ext_sycl(queue, transa, transb, scalec, m, n, k, a, lda,
+                                                  ao, b, ldb, bo, scales, zc, c, ldc);
+}
+
+void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+              offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+              cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo,
+              cl::sycl::buffer<float, 1> &scales, uint8_t zc, cl::sycl::buffer<uint8_t, 1> &c,
+              std::int64_t ldc) {
+    function_tables[libname].gemm_s8u8u8_ext_sycl(queue, transa, transb, scalec, m, n, k, a, lda,
+                                                  ao, b, ldb, bo, scales, zc, c, ldc);
+}
+
+void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+              offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+              cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+              cl::sycl::buffer<float, 1> &scales, int8_t zc, cl::sycl::buffer<int8_t, 1> &c,
+              std::int64_t ldc) {
+    function_tables[libname].gemm_s8s8s8_ext_sycl(queue, transa, transb, scalec, m, n, k, a, lda,
+                                                  ao, b, ldb, bo, scales, zc, c, ldc);
+}
+
+void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+              offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+              cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+              cl::sycl::buffer<float, 1> &scales, uint8_t zc, cl::sycl::buffer<uint8_t, 1> &c,
+              std::int64_t ldc) {
+    function_tables[libname].gemm_s8s8u8_ext_sycl(queue, transa, transb, scalec, m, n, k, a, lda,
+                                                  ao, b, ldb, bo, scales, zc, c, ldc);
+}
+
+void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+              offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
+              cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+              cl::sycl::buffer<float, 1> &scales, int8_t zc, cl::sycl::buffer<int8_t, 1> &c,
+              std::int64_t ldc) {
+    function_tables[libname].gemm_u8s8s8_ext_sycl(queue, transa, transb, scalec, m, n, k, a, lda,
+                                                  ao, b, ldb, bo, scales, zc, c, ldc);
+}
+
+void gemm_ext(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+              offset scalec, std::int64_t m, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
+              cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+              cl::sycl::buffer<float, 1> &scales, uint8_t zc, cl::sycl::buffer<uint8_t, 1> &c,
+              std::int64_t ldc) {
+    function_tables[libname].gemm_u8s8u8_ext_sycl(queue, transa, transb, scalec, m, n, k, a, lda,
+                                                  ao, b, ldb, bo, scales, zc, c, ldc);
+}
+
+void gemm_s8u8s32_compute(char *libname, cl::sycl::queue &queue, transpose transb, offset offsetc,
+                          std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                          cl::sycl::buffer<int8_t, 1> &packed_a, int8_t ao,
+                          cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo, float beta,
+                          cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                          cl::sycl::buffer<int32_t, 1> &co) {
+    function_tables[libname].gemm_s8u8s32_compute_packed_a_sycl(queue, transb, offsetc, m, n, k,
+                                                                alpha, packed_a, ao, b, ldb, bo,
+                                                                beta, c, ldc, co);
+}
+
+void gemm_s8u8s32_compute(char *libname, cl::sycl::queue &queue, transpose transa, offset offsetc,
+                          std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                          cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+                          cl::sycl::buffer<uint8_t, 1> &packed_b, uint8_t bo, float beta,
+                          cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                          cl::sycl::buffer<int32_t, 1> &co) {
+    function_tables[libname].gemm_s8u8s32_compute_packed_b_sycl(queue, transa, offsetc, m, n, k,
+                                                                alpha, a, lda, ao, packed_b, bo,
+                                                                beta, c, ldc, co);
+}
+
+void gemm_s8u8s32_pack(char *libname, cl::sycl::queue &queue, transpose transa, std::int64_t m,
+                       std::int64_t n, std::int64_t k, cl::sycl::buffer<int8_t, 1> &a,
+                       std::int64_t lda, cl::sycl::buffer<int8_t, 1> &packed_a) {
+    function_tables[libname].gemm_s8u8s32_pack_a_sycl(queue, transa, m, n, k, a, lda, packed_a);
+}
+
+void gemm_s8u8s32_pack(char *libname, cl::sycl::queue &queue, transpose transb, std::int64_t m,
+                       std::int64_t n, std::int64_t k, cl::sycl::buffer<uint8_t, 1> &b,
+                       std::int64_t ldb, cl::sycl::buffer<uint8_t, 1> &packed_b) {
+    function_tables[libname].gemm_s8u8s32_pack_b_sycl(queue, transb, m, n, k, b, ldb, packed_b);
+}
+
+std::int64_t gemm_s8u8s32_pack_get_size(char *libname, cl::sycl::queue &queue, identifier which,
+                                        std::int64_t m, std::int64_t n, std::int64_t k) {
+    return function_tables[libname].gemm_s8u8s32_pack_get_size_sycl(queue, which, m, n, k);
+}
+
+void gemm_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+                cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                cl::sycl::buffer<float, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+                cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+                cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].sgemm_batch_group_offset_sycl(queue, transa, transb, m, n, k, alpha, a,
+                                                           lda, offset_a, b, ldb, offset_b, beta, c,
+                                                           ldc, offset_c, group_count, group_size);
+}
+
+void gemm_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+                cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                cl::sycl::buffer<double, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+                cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<double, 1> &beta,
+                cl::sycl::buffer<double, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].dgemm_batch_group_offset_sycl(queue, transa, transb, m, n, k, alpha, a,
+                                                           lda, offset_a, b, ldb, offset_b, beta, c,
+                                                           ldc, offset_c, group_count, group_size);
+}
+
+void gemm_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+                cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                cl::sycl::buffer<std::complex<float>, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+                cl::sycl::buffer<std::int64_t, 1> &offset_b,
+                cl::sycl::buffer<std::complex<float>, 1> &beta,
+                cl::sycl::buffer<std::complex<float>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].cgemm_batch_group_offset_sycl(queue, transa, transb, m, n, k, alpha, a,
+                                                           lda, offset_a, b, ldb, offset_b, beta, c,
+                                                           ldc, offset_c, group_count, group_size);
+}
+
+void gemm_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+                cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                cl::sycl::buffer<std::complex<double>, 1> &b,
+                cl::sycl::buffer<std::int64_t, 1> &ldb, cl::sycl::buffer<std::int64_t, 1> &offset_b,
+                cl::sycl::buffer<std::complex<double>, 1> &beta,
+                cl::sycl::buffer<std::complex<double>, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, cl::sycl::buffer<std::int64_t, 1> &offset_c,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].zgemm_batch_group_offset_sycl(queue, transa, transb, m, n, k, alpha, a,
+                                                           lda, offset_a, b, ldb, offset_b, beta, c,
+                                                           ldc, offset_c, group_count, group_size);
+}
+
+void herk_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<float, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].cherk_batch_group_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
+                                                    beta, c, ldc, group_count, group_size);
+}
+
+void herk_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<double, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<double, 1> &beta,
+                cl::sycl::buffer<std::complex<double>, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].zherk_batch_group_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
+                                                    beta, c, ldc, group_count, group_size);
+}
+
+void herk_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                std::int64_t n, std::int64_t k, float alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, float beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+                std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    function_tables[libname].cherk_batch_strided_sycl(queue, upper_lower, trans, n, k, alpha, a,
+                                                      lda, stride_a, beta, c, ldc, stride_c,
+                                                      batch_size);
+}
+
+void herk_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                std::int64_t n, std::int64_t k, double alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, double beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+                std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    function_tables[libname].zherk_batch_strided_sycl(queue, upper_lower, trans, n, k, alpha, a,
+                                                      lda, stride_a, beta, c, ldc, stride_c,
+                                                      batch_size);
+}
+
+void syrk_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<float, 1> &alpha,
+                cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].ssyrk_batch_group_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
+                                                    beta, c, ldc, group_count, group_size);
+}
+
+void syrk_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<double, 1> &alpha,
+                cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].dsyrk_batch_group_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
+                                                    beta, c, ldc, group_count, group_size);
+}
+
+void syrk_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<float>, 1> &beta,
+                cl::sycl::buffer<std::complex<float>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].csyrk_batch_group_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
+                                                    beta, c, ldc, group_count, group_size);
+}
+
+void syrk_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<uplo, 1> &upper_lower,
+                cl::sycl::buffer<transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<double>, 1> &beta,
+                cl::sycl::buffer<std::complex<double>, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].zsyrk_batch_group_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
+                                                    beta, c, ldc, group_count, group_size);
+}
+
+void syrk_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a,
+                std::int64_t lda, std::int64_t stride_a, float beta, cl::sycl::buffer<float, 1> &c,
+                std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    function_tables[libname].ssyrk_batch_strided_sycl(queue, upper_lower, trans, n, k, alpha, a,
+                                                      lda, stride_a, beta, c, ldc, stride_c,
+                                                      batch_size);
+}
+
+void syrk_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                std::int64_t n, std::int64_t k, double alpha, cl::sycl::buffer<double, 1> &a,
+                std::int64_t lda, std::int64_t stride_a, double beta,
+                cl::sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                std::int64_t batch_size) {
+    function_tables[libname].dsyrk_batch_strided_sycl(queue, upper_lower, trans, n, k, alpha, a,
+                                                      lda, stride_a, beta, c, ldc, stride_c,
+                                                      batch_size);
+}
+
+void syrk_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, std::complex<float> beta,
+                cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size) {
+    function_tables[libname].csyrk_batch_strided_sycl(queue, upper_lower, trans, n, k, alpha, a,
+                                                      lda, stride_a, beta, c, ldc, stride_c,
+                                                      batch_size);
+}
+
+void syrk_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
+                std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, std::complex<double> beta,
+                cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size) {
+    function_tables[libname].zsyrk_batch_strided_sycl(queue, upper_lower, trans, n, k, alpha, a,
+                                                      lda, stride_a, beta, c, ldc, stride_c,
+                                                      batch_size);
+}
+
+void gemv_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<float, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<float, 1> &beta,
+                cl::sycl::buffer<float, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].sgemv_batch_group_sycl(queue, trans, m, n, alpha, a, lda, x, incx,
+                                                    beta, y, incy, group_count, group_size);
+}
+
+void gemv_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<double, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<double, 1> &beta,
+                cl::sycl::buffer<double, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].dgemv_batch_group_sycl(queue, trans, m, n, alpha, a, lda, x, incx,
+                                                    beta, y, incy, group_count, group_size);
+}
+
+void gemv_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<float>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<float>, 1> &beta,
+                cl::sycl::buffer<std::complex<float>, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].cgemv_batch_group_sycl(queue, trans, m, n, alpha, a, lda, x, incx,
+                                                    beta, y, incy, group_count, group_size);
+}
+
+void gemv_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &trans,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<double>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<double>, 1> &beta,
+                cl::sycl::buffer<std::complex<double>, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].zgemv_batch_group_sycl(queue, trans, m, n, alpha, a, lda, x, incx,
+                                                    beta, y, incy, group_count, group_size);
+}
+
+void gemv_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                std::int64_t stride_y, std::int64_t batch_size) {
+    function_tables[libname].sgemv_batch_strided_sycl(queue, trans, m, n, alpha, a, lda, stride_a,
+                                                      x, incx, stride_x, beta, y, incy, stride_y,
+                                                      batch_size);
+}
+
+void gemv_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, double beta, cl::sycl::buffer<double, 1> &y,
+                std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    function_tables[libname].dgemv_batch_strided_sycl(queue, trans, m, n, alpha, a, lda, stride_a,
+                                                      x, incx, stride_x, beta, y, incy, stride_y,
+                                                      batch_size);
+}
+
+void gemv_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                std::int64_t n, std::complex<float> alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &x,
+                std::int64_t incx, std::int64_t stride_x, std::complex<float> beta,
+                cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                std::int64_t stride_y, std::int64_t batch_size) {
+    function_tables[libname].cgemv_batch_strided_sycl(queue, trans, m, n, alpha, a, lda, stride_a,
+                                                      x, incx, stride_x, beta, y, incy, stride_y,
+                                                      batch_size);
+}
+
+void gemv_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                std::int64_t n, std::complex<double> alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &x,
+                std::int64_t incx, std::int64_t stride_x, std::complex<double> beta,
+                cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                std::int64_t stride_y, std::int64_t batch_size) {
+    function_tables[libname].zgemv_batch_strided_sycl(queue, trans, m, n, alpha, a, lda, stride_a,
+                                                      x, incx, stride_x, beta, y, incy, stride_y,
+                                                      batch_size);
+}
+
+void dgmm_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].sdgmm_batch_group_sycl(queue, left_right, m, n, a, lda, x, incx, c,
+                                                    ldc, group_count, group_size);
+}
+
+void dgmm_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<double, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<double, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].ddgmm_batch_group_sycl(queue, left_right, m, n, a, lda, x, incx, c,
+                                                    ldc, group_count, group_size);
+}
+
+void dgmm_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<float>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<float>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].cdgmm_batch_group_sycl(queue, left_right, m, n, a, lda, x, incx, c,
+                                                    ldc, group_count, group_size);
+}
+
+void dgmm_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<side, 1> &left_right,
+                cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<double>, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda,
+                cl::sycl::buffer<std::complex<double>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<double>, 1> &c,
+                cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].zdgmm_batch_group_sycl(queue, left_right, m, n, a, lda, x, incx, c,
+                                                    ldc, group_count, group_size);
+}
+
+void dgmm_batch(char *libname, cl::sycl::queue &queue, side left_right, std::int64_t m,
+                std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size) {
+    function_tables[libname].sdgmm_batch_strided_sycl(queue, left_right, m, n, a, lda, stride_a, x,
+                                                      incx, stride_x, c, ldc, stride_c, batch_size);
+}
+
+void dgmm_batch(char *libname, cl::sycl::queue &queue, side left_right, std::int64_t m,
+                std::int64_t n, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size) {
+    function_tables[libname].ddgmm_batch_strided_sycl(queue, left_right, m, n, a, lda, stride_a, x,
+                                                      incx, stride_x, c, ldc, stride_c, batch_size);
+}
+
+void dgmm_batch(char *libname, cl::sycl::queue &queue, side left_right, std::int64_t m,
+                std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &x,
+                std::int64_t incx, std::int64_t stride_x,
+                cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size) {
+    function_tables[libname].cdgmm_batch_strided_sycl(queue, left_right, m, n, a, lda, stride_a, x,
+                                                      incx, stride_x, c, ldc, stride_c, batch_size);
+}
+
+void dgmm_batch(char *libname, cl::sycl::queue &queue, side left_right, std::int64_t m,
+                std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &x,
+                std::int64_t incx, std::int64_t stride_x,
+                cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size) {
+    function_tables[libname].zdgmm_batch_strided_sycl(queue, left_right, m, n, a, lda, stride_a, x,
+                                                      incx, stride_x, c, ldc, stride_c, batch_size);
+}
+
+void axpy_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<float, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].saxpy_batch_group_sycl(queue, n, alpha, x, incx, y, incy, group_count,
+                                                    group_size);
+}
+
+void axpy_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<double, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].daxpy_batch_group_sycl(queue, n, alpha, x, incx, y, incy, group_count,
+                                                    group_size);
+}
+
+void axpy_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<float>, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].caxpy_batch_group_sycl(queue, n, alpha, x, incx, y, incy, group_count,
+                                                    group_size);
+}
+
+void axpy_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<double>, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].zaxpy_batch_group_sycl(queue, n, alpha, x, incx, y, incy, group_count,
+                                                    group_size);
+}
+
+void axpy_batch(char *libname, cl::sycl::queue &queue, std::int64_t n, float alpha,
+                cl::sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stride_x,
+                cl::sycl::buffer<float, 1> &y, std::int64_t incy, std::int64_t stride_y,
+                std::int64_t batch_size) {
+    function_tables[libname].saxpy_batch_strided_sycl(queue, n, alpha, x, incx, stride_x, y, incy,
+                                                      stride_y, batch_size);
+}
+
+void axpy_batch(char *libname, cl::sycl::queue &queue, std::int64_t n, double alpha,
+                cl::sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stride_x,
+                cl::sycl::buffer<double, 1> &y, std::int64_t incy, std::int64_t stride_y,
+                std::int64_t batch_size) {
+    function_tables[libname].daxpy_batch_strided_sycl(queue, n, alpha, x, incx, stride_x, y, incy,
+                                                      stride_y, batch_size);
+}
+
+void axpy_batch(char *libname, cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, cl::sycl::buffer<std::complex<float>, 1> &y,
+                std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    function_tables[libname].caxpy_batch_strided_sycl(queue, n, alpha, x, incx, stride_x, y, incy,
+                                                      stride_y, batch_size);
+}
+
+void axpy_batch(char *libname, cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, cl::sycl::buffer<std::complex<double>, 1> &y,
+                std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    function_tables[libname].zaxpy_batch_strided_sycl(queue, n, alpha, x, incx, stride_x, y, incy,
+                                                      stride_y, batch_size);
+}
+
+void copy_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<float, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].scopy_batch_group_sycl(queue, n, x, incx, y, incy, group_count,
+                                                    group_size);
+}
+
+void copy_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<double, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+                std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].dcopy_batch_group_sycl(queue, n, x, incx, y, incy, group_count,
+                                                    group_size);
+}
+
+void copy_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<float>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<float>, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].ccopy_batch_group_sycl(queue, n, x, incx, y, incy, group_count,
+                                                    group_size);
+}
+
+void copy_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<double>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx,
+                cl::sycl::buffer<std::complex<double>, 1> &y,
+                cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].zcopy_batch_group_sycl(queue, n, x, incx, y, incy, group_count,
+                                                    group_size);
+}
+
+void copy_batch(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                cl::sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stride_x,
+                cl::sycl::buffer<float, 1> &y, std::int64_t incy, std::int64_t stride_y,
+                std::int64_t batch_size) {
+    function_tables[libname].scopy_batch_strided_sycl(queue, n, x, incx, stride_x, y, incy,
+                                                      stride_y, batch_size);
+}
+
+void copy_batch(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                cl::sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stride_x,
+                cl::sycl::buffer<double, 1> &y, std::int64_t incy, std::int64_t stride_y,
+                std::int64_t batch_size) {
+    function_tables[libname].dcopy_batch_strided_sycl(queue, n, x, incx, stride_x, y, incy,
+                                                      stride_y, batch_size);
+}
+
+void copy_batch(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, cl::sycl::buffer<std::complex<float>, 1> &y,
+                std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    function_tables[libname].ccopy_batch_strided_sycl(queue, n, x, incx, stride_x, y, incy,
+                                                      stride_y, batch_size);
+}
+
+void copy_batch(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, cl::sycl::buffer<std::complex<double>, 1> &y,
+                std::int64_t incy, std::int64_t stride_y, std::int64_t batch_size) {
+    function_tables[libname].zcopy_batch_strided_sycl(queue, n, x, incx, stride_x, y, incy,
+                                                      stride_y, batch_size);
+}
+
+void dot_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+               cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+               cl::sycl::buffer<float, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+               cl::sycl::buffer<float, 1> &result, std::int64_t group_count,
+               cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].sdot_batch_group_sycl(queue, n, x, incx, y, incy, result, group_count,
+                                                   group_size);
+}
+
+void dot_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+               cl::sycl::buffer<double, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+               cl::sycl::buffer<double, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+               cl::sycl::buffer<double, 1> &result, std::int64_t group_count,
+               cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].ddot_batch_group_sycl(queue, n, x, incx, y, incy, result, group_count,
+                                                   group_size);
+}
+
+void dot_batch(char *libname, cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+               std::int64_t incx, std::int64_t stride_x, cl::sycl::buffer<float, 1> &y,
+               std::int64_t incy, std::int64_t stride_y, cl::sycl::buffer<float, 1> &result,
+               std::int64_t batch_size) {
+    function_tables[libname].sdot_batch_strided_sycl(queue, n, x, incx, stride_x, y, incy, stride_y,
+                                                     result, batch_size);
+}
+
+void dot_batch(char *libname, cl::sycl::queue &queue, std::int64_t n,
+               cl::sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stride_x,
+               cl::sycl::buffer<double, 1> &y, std::int64_t incy, std::int64_t stride_y,
+               cl::sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+    function_tables[libname].ddot_batch_strided_sycl(queue, n, x, incx, stride_x, y, incy, stride_y,
+                                                     result, batch_size);
+}
+
+void scal_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].sscal_batch_group_sycl(queue, n, alpha, x, incx, group_count,
+                                                    group_size);
+}
+
+void scal_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].dscal_batch_group_sycl(queue, n, alpha, x, incx, group_count,
+                                                    group_size);
+}
+
+void scal_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].cscal_batch_group_sycl(queue, n, alpha, x, incx, group_count,
+                                                    group_size);
+}
+
+void scal_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].zscal_batch_group_sycl(queue, n, alpha, x, incx, group_count,
+                                                    group_size);
+}
+
+void scal_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].csscal_batch_group_sycl(queue, n, alpha, x, incx, group_count,
+                                                     group_size);
+}
+
+void scal_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
+                cl::sycl::buffer<std::int64_t, 1> &incx, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].zdscal_batch_group_sycl(queue, n, alpha, x, incx, group_count,
+                                                     group_size);
+}
+
+void scal_batch(char *libname, cl::sycl::queue &queue, std::int64_t n, float alpha,
+                cl::sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stride_x,
+                std::int64_t batch_size) {
+    function_tables[libname].sscal_batch_strided_sycl(queue, n, alpha, x, incx, stride_x,
+                                                      batch_size);
+}
+
+void scal_batch(char *libname, cl::sycl::queue &queue, std::int64_t n, double alpha,
+                cl::sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stride_x,
+                std::int64_t batch_size) {
+    function_tables[libname].dscal_batch_strided_sycl(queue, n, alpha, x, incx, stride_x,
+                                                      batch_size);
+}
+
+void scal_batch(char *libname, cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, std::int64_t batch_size) {
+    function_tables[libname].cscal_batch_strided_sycl(queue, n, alpha, x, incx, stride_x,
+                                                      batch_size);
+}
+
+void scal_batch(char *libname, cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, std::int64_t batch_size) {
+    function_tables[libname].zscal_batch_strided_sycl(queue, n, alpha, x, incx, stride_x,
+                                                      batch_size);
+}
+
+void scal_batch(char *libname, cl::sycl::queue &queue, std::int64_t n, float alpha,
+                cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, std::int64_t batch_size) {
+    function_tables[libname].csscal_batch_strided_sycl(queue, n, alpha, x, incx, stride_x,
+                                                       batch_size);
+}
+
+void scal_batch(char *libname, cl::sycl::queue &queue, std::int64_t n, double alpha,
+                cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, std::int64_t batch_size) {
+    function_tables[libname].zdscal_batch_strided_sycl(queue, n, alpha, x, incx, stride_x,
+                                                       batch_size);
+}
+
+void gemm_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+                cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<half, 1> &alpha, cl::sycl::buffer<half, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                cl::sycl::buffer<half, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+                cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<half, 1> &beta,
+                cl::sycl::buffer<half, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].hgemm_batch_group_offset_sycl(queue, transa, transb, m, n, k, alpha, a,
+                                                           lda, offset_a, b, ldb, offset_b, beta, c,
+                                                           ldc, offset_c, group_count, group_size);
+}
+
+void gemm_batch(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+                std::int64_t m, std::int64_t n, std::int64_t k, half alpha,
+                cl::sycl::buffer<half, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                cl::sycl::buffer<half, 1> &b, std::int64_t ldb, std::int64_t stride_b, half beta,
+                cl::sycl::buffer<half, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                std::int64_t batch_size) {
+    function_tables[libname].hgemm_batch_strided_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
+                                                      stride_a, b, ldb, stride_b, beta, c, ldc,
+                                                      stride_c, batch_size);
+}
+
+void gemm_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+                cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<half, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                cl::sycl::buffer<half, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+                cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+                cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].gemm_f16f16f32_batch_group_offset_sycl(queue, transa, transb, m, n, k,
+                                                                    alpha, a, lda, offset_a, b, ldb,
+                                                                    offset_b, beta, c, ldc,
+                                                                    offset_c, group_count,
+                                                                    group_size);
+}
+
+void gemm_batch(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+                std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                cl::sycl::buffer<half, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                cl::sycl::buffer<half, 1> &b, std::int64_t ldb, std::int64_t stride_b, float beta,
+                cl::sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                std::int64_t batch_size) {
+    function_tables[libname].gemm_f16f16f32_batch_strided_sycl(queue, transa, transb, m, n, k,
+                                                               alpha, a, lda, stride_a, b, ldb,
+                                                               stride_b, beta, c, ldc, stride_c,
+                                                               batch_size);
+}
+
+void gemm_batch(char *libname, cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
+                cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+                cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+                cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<int8_t, 1> &a,
+                cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+                cl::sycl::buffer<uint8_t, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+                cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+                cl::sycl::buffer<int32_t, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+                cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+                cl::sycl::buffer<std::int64_t, 1> &group_size) {
+    function_tables[libname].gemm_s8u8s32_batch_group_offset_sycl(queue, transa, transb, m, n, k,
+                                                                  alpha, a, lda, offset_a, b, ldb,
+                                                                  offset_b, beta, c, ldc, offset_c,
+                                                                  group_count, group_size);
+}
+
+void gemm_batch(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+                std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                float beta, cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size) {
+    function_tables[libname].gemm_s8u8s32_batch_strided_sycl(queue, transa, transb, m, n, k, alpha,
+                                                             a, lda, stride_a, b, ldb, stride_b,
+                                                             beta, c, ldc, stride_c, batch_size);
+}
+
+void gepack_compact(char *libname, cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                    cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                    cl::sycl::buffer<float, 1> &ap, std::int64_t ldap, std::int64_t batch_size) {
+    function_tables[libname].sgepack_compact_sycl(queue, rows, cols, a, lda, stride_a, ap, ldap,
+                                                  batch_size);
+}
+
+void gepack_compact(char *libname, cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                    cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                    cl::sycl::buffer<double, 1> &ap, std::int64_t ldap, std::int64_t batch_size) {
+    function_tables[libname].dgepack_compact_sycl(queue, rows, cols, a, lda, stride_a, ap, ldap,
+                                                  batch_size);
+}
+
+void geunpack_compact(char *libname, cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                      cl::sycl::buffer<float, 1> &ap, std::int64_t ldap,
+                      cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                      std::int64_t batch_size) {
+    function_tables[libname].sgeunpack_compact_sycl(queue, rows, cols, ap, ldap, a, lda, stride_a,
+                                                    batch_size);
+}
+
+void geunpack_compact(char *libname, cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                      cl::sycl::buffer<double, 1> &ap, std::int64_t ldap,
+                      cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                      std::int64_t batch_size) {
+    function_tables[libname].dgeunpack_compact_sycl(queue, rows, cols, ap, ldap, a, lda, stride_a,
+                                                    batch_size);
+}
+
+void gemm_compact(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+                  std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                  cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+                  std::int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                  std::int64_t batch_size) {
+    function_tables[libname].sgemm_compact_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b,
+                                                ldb, beta, c, ldc, batch_size);
+}
+
+void gemm_compact(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+                  std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                  cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+                  std::int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                  std::int64_t batch_size) {
+    function_tables[libname].dgemm_compact_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b,
+                                                ldb, beta, c, ldc, batch_size);
+}
+
+void trsm_compact(char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                  transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
+                  cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+                  std::int64_t ldb, std::int64_t batch_size) {
+    function_tables[libname].strsm_compact_sycl(queue, left_right, upper_lower, trans, unit_diag, m,
+                                                n, alpha, a, lda, b, ldb, batch_size);
+}
+
+void trsm_compact(char *libname, cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                  transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
+                  cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+                  std::int64_t ldb, std::int64_t batch_size) {
+    function_tables[libname].dtrsm_compact_sycl(queue, left_right, upper_lower, trans, unit_diag, m,
+                                                n, alpha, a, lda, b, ldb, batch_size);
+}
+
+void getrfnp_compact(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                     cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t batch_size) {
+    function_tables[libname].sgetrfnp_compact_sycl(queue, m, n, a, lda, batch_size);
+}
+
+void getrfnp_compact(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                     cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t batch_size) {
+    function_tables[libname].dgetrfnp_compact_sycl(queue, m, n, a, lda, batch_size);
+}
+
+void axpby(char *libname, cl::sycl::queue &queue, std::int64_t n, float alpha,
+           cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+           cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    function_tables[libname].saxpby_sycl(queue, n, alpha, x, incx, beta, y, incy);
+}
+
+void axpby(char *libname, cl::sycl::queue &queue, std::int64_t n, double alpha,
+           cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+           cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+    function_tables[libname].daxpby_sycl(queue, n, alpha, x, incx, beta, y, incy);
+}
+
+void axpby(char *libname, cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::complex<float> beta,
+           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
+    function_tables[libname].caxpby_sycl(queue, n, alpha, x, incx, beta, y, incy);
+}
+
+void axpby(char *libname, cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
+           std::int64_t incy) {
+    function_tables[libname].zaxpby_sycl(queue, n, alpha, x, incx, beta, y, incy);
+}
+
+void imatcopy(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &ab, std::int64_t lda,
+              std::int64_t ldb) {
+    function_tables[libname].simatcopy_sycl(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+void imatcopy(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &ab, std::int64_t lda,
+              std::int64_t ldb) {
+    function_tables[libname].dimatcopy_sycl(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+void imatcopy(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, std::complex<float> alpha,
+              cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t lda, std::int64_t ldb) {
+    function_tables[libname].cimatcopy_sycl(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+void imatcopy(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, std::complex<double> alpha,
+              cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t lda, std::int64_t ldb) {
+    function_tables[libname].zimatcopy_sycl(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+void omatadd(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+             std::int64_t m, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+             std::int64_t lda, float beta, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    function_tables[libname].somatadd_sycl(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb,
+                                           c, ldc);
+}
+
+void omatadd(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+             std::int64_t m, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+             std::int64_t lda, double beta, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    function_tables[libname].domatadd_sycl(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb,
+                                           c, ldc);
+}
+
+void omatadd(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+             std::int64_t m, std::int64_t n, std::complex<float> alpha,
+             cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+             std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &b,
+             std::int64_t ldb, cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    function_tables[libname].comatadd_sycl(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb,
+                                           c, ldc);
+}
+
+void omatadd(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+             std::int64_t m, std::int64_t n, std::complex<double> alpha,
+             cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+             std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &b,
+             std::int64_t ldb, cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    function_tables[libname].zomatadd_sycl(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb,
+                                           c, ldc);
+}
+
+void omatcopy(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<float, 1> &b, std::int64_t ldb) {
+    function_tables[libname].somatcopy_sycl(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+void omatcopy(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<double, 1> &b, std::int64_t ldb) {
+    function_tables[libname].domatcopy_sycl(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+void omatcopy(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, std::complex<float> alpha,
+              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
+    function_tables[libname].comatcopy_sycl(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+void omatcopy(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, std::complex<double> alpha,
+              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
+    function_tables[libname].zomatcopy_sycl(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+void imatcopy_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                    std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &ab, std::int64_t lda,
+                    std::int64_t ldb, std::int64_t stride, std::int64_t batch_size) {
+    function_tables[libname].simatcopy_batch_strided_sycl(queue, trans, m, n, alpha, ab, lda, ldb,
+                                                          stride, batch_size);
+}
+
+void imatcopy_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                    std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &ab, std::int64_t lda,
+                    std::int64_t ldb, std::int64_t stride, std::int64_t batch_size) {
+    function_tables[libname].dimatcopy_batch_strided_sycl(queue, trans, m, n, alpha, ab, lda, ldb,
+                                                          stride, batch_size);
+}
+
+void imatcopy_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                    std::int64_t n, std::complex<float> alpha,
+                    cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t lda,
+                    std::int64_t ldb, std::int64_t stride, std::int64_t batch_size) {
+    function_tables[libname].cimatcopy_batch_strided_sycl(queue, trans, m, n, alpha, ab, lda, ldb,
+                                                          stride, batch_size);
+}
+
+void imatcopy_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                    std::int64_t n, std::complex<double> alpha,
+                    cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t lda,
+                    std::int64_t ldb, std::int64_t stride, std::int64_t batch_size) {
+    function_tables[libname].zimatcopy_batch_strided_sycl(queue, trans, m, n, alpha, ab, lda, ldb,
+                                                          stride, batch_size);
+}
+
+void omatadd_batch(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+                   std::int64_t m, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                   std::int64_t lda, std::int64_t stride_a, float beta,
+                   cl::sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                   std::int64_t batch_size) {
+    function_tables[libname].somatadd_batch_strided_sycl(queue, transa, transb, m, n, alpha, a, lda,
+                                                         stride_a, beta, b, ldb, stride_b, c, ldc,
+                                                         stride_c, batch_size);
+}
+
+void omatadd_batch(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+                   std::int64_t m, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+                   std::int64_t lda, std::int64_t stride_a, double beta,
+                   cl::sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                   std::int64_t batch_size) {
+    function_tables[libname].domatadd_batch_strided_sycl(queue, transa, transb, m, n, alpha, a, lda,
+                                                         stride_a, beta, b, ldb, stride_b, c, ldc,
+                                                         stride_c, batch_size);
+}
+
+void omatadd_batch(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+                   std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                   cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, std::complex<float> beta,
+                   cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, cl::sycl::buffer<std::complex<float>, 1> &c,
+                   std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    function_tables[libname].comatadd_batch_strided_sycl(queue, transa, transb, m, n, alpha, a, lda,
+                                                         stride_a, beta, b, ldb, stride_b, c, ldc,
+                                                         stride_c, batch_size);
+}
+
+void omatadd_batch(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+                   std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                   cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, std::complex<double> beta,
+                   cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, cl::sycl::buffer<std::complex<double>, 1> &c,
+                   std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    function_tables[libname].zomatadd_batch_strided_sycl(queue, transa, transb, m, n, alpha, a, lda,
+                                                         stride_a, beta, b, ldb, stride_b, c, ldc,
+                                                         stride_c, batch_size);
+}
+
+void omatcopy_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                    std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                    std::int64_t stride_b, std::int64_t batch_size) {
+    function_tables[libname].somatcopy_batch_strided_sycl(queue, trans, m, n, alpha, a, lda,
+                                                          stride_a, b, ldb, stride_b, batch_size);
+}
+
+void omatcopy_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                    std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                    std::int64_t stride_b, std::int64_t batch_size) {
+    function_tables[libname].domatcopy_batch_strided_sycl(queue, trans, m, n, alpha, a, lda,
+                                                          stride_a, b, ldb, stride_b, batch_size);
+}
+
+void omatcopy_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                    std::int64_t n, std::complex<float> alpha,
+                    cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+    function_tables[libname].comatcopy_batch_strided_sycl(queue, trans, m, n, alpha, a, lda,
+                                                          stride_a, b, ldb, stride_b, batch_size);
+}
+
+void omatcopy_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                    std::int64_t n, std::complex<double> alpha,
+                    cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+    function_tables[libname].zomatcopy_batch_strided_sycl(queue, trans, m, n, alpha, a, lda,
+                                                          stride_a, b, ldb, stride_b, batch_size);
+}
+
+void asum(char *libname, cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+          std::int64_t incx, cl::sycl::buffer<float, 1> &result, accumulation acc) {
+    function_tables[libname].sasum_accumulation_sycl(queue, n, x, incx, result, acc);
+}
+
+void dot(char *libname, cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+         std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+         cl::sycl::buffer<float, 1> &result, accumulation acc) {
+    function_tables[libname].sdot_accumulation_sycl(queue, n, x, incx, y, incy, result, acc);
+}
+
+void nrm2(char *libname, cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+          std::int64_t incx, cl::sycl::buffer<float, 1> &result, accumulation acc) {
+    function_tables[libname].snrm2_accumulation_sycl(queue, n, x, incx, result, acc);
+}
+
+void axpbypcz(char *libname, cl::sycl::queue &queue, std::int64_t n, float alpha,
+              cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+              cl::sycl::buffer<float, 1> &y, std::int64_t incy, float gamma,
+              cl::sycl::buffer<float, 1> &z, std::int64_t incz) {
+    function_tables[libname].saxpbypcz_sycl(queue, n, alpha, x, incx, beta, y, incy, gamma, z,
+                                            incz);
+}
+
+void axpbypcz(char *libname, cl::sycl::queue &queue, std::int64_t n, double alpha,
+              cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+              cl::sycl::buffer<double, 1> &y, std::int64_t incy, double gamma,
+              cl::sycl::buffer<double, 1> &z, std::int64_t incz) {
+    function_tables[libname].daxpbypcz_sycl(queue, n, alpha, x, incx, beta, y, incy, gamma, z,
+                                            incz);
+}
+
+void axpbypcz_dot(char *libname, cl::sycl::queue &queue, std::int64_t n, float alpha,
+                  cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                  cl::sycl::buffer<float, 1> &y, std::int64_t incy, float gamma,
+                  cl::sycl::buffer<float, 1> &z, std::int64_t incz, cl::sycl::buffer<float, 1> &w,
+                  std::int64_t incw, cl::sycl::buffer<float, 1> &result) {
+    function_tables[libname].saxpbypcz_dot_sycl(queue, n, alpha, x, incx, beta, y, incy, gamma, z,
+                                                incz, w, incw, result);
+}
+
+void axpbypcz_dot(char *libname, cl::sycl::queue &queue, std::int64_t n, double alpha,
+                  cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                  cl::sycl::buffer<double, 1> &y, std::int64_t incy, double gamma,
+                  cl::sycl::buffer<double, 1> &z, std::int64_t incz, cl::sycl::buffer<double, 1> &w,
+                  std::int64_t incw, cl::sycl::buffer<double, 1> &result) {
+    function_tables[libname].daxpbypcz_dot_sycl(queue, n, alpha, x, incx, beta, y, incy, gamma, z,
+                                                incz, w, incw, result);
+}
+
+cl::sycl::event asum(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                     cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                     float *result) {
+    return function_tables[libname].scasum_host_sycl(queue, n, x, incx, result);
+}
+
+cl::sycl::event asum(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                     cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                     double *result) {
+    return function_tables[libname].dzasum_host_sycl(queue, n, x, incx, result);
+}
+
+cl::sycl::event asum(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                     cl::sycl::buffer<float, 1> &x, std::int64_t incx, float *result) {
+    return function_tables[libname].sasum_host_sycl(queue, n, x, incx, result);
+}
+
+cl::sycl::event asum(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                     cl::sycl::buffer<double, 1> &x, std::int64_t incx, double *result) {
+    return function_tables[libname].dasum_host_sycl(queue, n, x, incx, result);
+}
+
+cl::sycl::event dot(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                    cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
+                    std::int64_t incy, float *result) {
+    return function_tables[libname].sdot_host_sycl(queue, n, x, incx, y, incy, result);
+}
+
+cl::sycl::event dot(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                    cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                    cl::sycl::buffer<double, 1> &y, std::int64_t incy, double *result) {
+    return function_tables[libname].ddot_host_sycl(queue, n, x, incx, y, incy, result);
+}
+
+cl::sycl::event dot(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                    cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
+                    std::int64_t incy, double *result) {
+    return function_tables[libname].dsdot_host_sycl(queue, n, x, incx, y, incy, result);
+}
+
+cl::sycl::event iamin(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                      cl::sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t *result) {
+    return function_tables[libname].isamin_host_sycl(queue, n, x, incx, result);
+}
+
+cl::sycl::event iamin(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                      cl::sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t *result) {
+    return function_tables[libname].idamin_host_sycl(queue, n, x, incx, result);
+}
+
+cl::sycl::event iamin(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                      cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                      std::int64_t *result) {
+    return function_tables[libname].icamin_host_sycl(queue, n, x, incx, result);
+}
+
+cl::sycl::event iamin(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                      cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                      std::int64_t *result) {
+    return function_tables[libname].izamin_host_sycl(queue, n, x, incx, result);
+}
+
+cl::sycl::event iamax(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                      cl::sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t *result) {
+    return function_tables[libname].isamax_host_sycl(queue, n, x, incx, result);
+}
+
+cl::sycl::event iamax(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                      cl::sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t *result) {
+    return function_tables[libname].idamax_host_sycl(queue, n, x, incx, result);
+}
+
+cl::sycl::event iamax(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                      cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                      std::int64_t *result) {
+    return function_tables[libname].icamax_host_sycl(queue, n, x, incx, result);
+}
+
+cl::sycl::event iamax(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                      cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                      std::int64_t *result) {
+    return function_tables[libname].izamax_host_sycl(queue, n, x, incx, result);
+}
+
+cl::sycl::event nrm2(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                     cl::sycl::buffer<float, 1> &x, std::int64_t incx, float *result) {
+    return function_tables[libname].snrm2_host_sycl(queue, n, x, incx, result);
+}
+
+cl::sycl::event nrm2(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                     cl::sycl::buffer<double, 1> &x, std::int64_t incx, double *result) {
+    return function_tables[libname].dnrm2_host_sycl(queue, n, x, incx, result);
+}
+
+cl::sycl::event nrm2(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                     cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                     float *result) {
+    return function_tables[libname].scnrm2_host_sycl(queue, n, x, incx, result);
+}
+
+cl::sycl::event nrm2(char *libname, cl::sycl::queue &queue, std::int64_t n,
+                     cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                     double *result) {
+    return function_tables[libname].dznrm2_host_sycl(queue, n, x, incx, result);
+}
+
+void gbtge(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+           std::int64_t ku, cl::sycl::buffer<float, 1> &ab, std::int64_t ldab,
+           cl::sycl::buffer<float, 1> &a, std::int64_t lda) {
+    function_tables[libname].sgbtge_sycl(queue, m, n, kl, ku, ab, ldab, a, lda);
+}
+
+void gbtge(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+           std::int64_t ku, cl::sycl::buffer<double, 1> &ab, std::int64_t ldab,
+           cl::sycl::buffer<double, 1> &a, std::int64_t lda) {
+    function_tables[libname].dgbtge_sycl(queue, m, n, kl, ku, ab, ldab, a, lda);
+}
+
+void gbtge(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+           std::int64_t ku, cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t ldab,
+           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
+    function_tables[libname].cgbtge_sycl(queue, m, n, kl, ku, ab, ldab, a, lda);
+}
+
+void gbtge(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+           std::int64_t ku, cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t ldab,
+           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
+    function_tables[libname].zgbtge_sycl(queue, m, n, kl, ku, ab, ldab, a, lda);
+}
+
+void gettgb(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+            std::int64_t ku, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<float, 1> &ab, std::int64_t ldab) {
+    function_tables[libname].sgettgb_sycl(queue, m, n, kl, ku, a, lda, ab, ldab);
+}
+
+void gettgb(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+            std::int64_t ku, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<double, 1> &ab, std::int64_t ldab) {
+    function_tables[libname].dgettgb_sycl(queue, m, n, kl, ku, a, lda, ab, ldab);
+}
+
+void gettgb(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+            std::int64_t ku, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t ldab) {
+    function_tables[libname].cgettgb_sycl(queue, m, n, kl, ku, a, lda, ab, ldab);
+}
+
+void gettgb(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+            std::int64_t ku, cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t ldab) {
+    function_tables[libname].zgettgb_sycl(queue, m, n, kl, ku, a, lda, ab, ldab);
+}
+
+void tpttr(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<float, 1> &ap, cl::sycl::buffer<float, 1> &a, std::int64_t lda) {
+    function_tables[libname].stpttr_sycl(queue, upper_lower, n, ap, a, lda);
+}
+
+void tpttr(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<double, 1> &ap, cl::sycl::buffer<double, 1> &a, std::int64_t lda) {
+    function_tables[libname].dtpttr_sycl(queue, upper_lower, n, ap, a, lda);
+}
+
+void tpttr(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<std::complex<float>, 1> &ap,
+           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
+    function_tables[libname].ctpttr_sycl(queue, upper_lower, n, ap, a, lda);
+}
+
+void tpttr(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<std::complex<double>, 1> &ap,
+           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
+    function_tables[libname].ztpttr_sycl(queue, upper_lower, n, ap, a, lda);
+}
+
+void trttp(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &ap) {
+    function_tables[libname].strttp_sycl(queue, upper_lower, n, a, lda, ap);
+}
+
+void trttp(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &ap) {
+    function_tables[libname].dtrttp_sycl(queue, upper_lower, n, a, lda, ap);
+}
+
+void trttp(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+           cl::sycl::buffer<std::complex<float>, 1> &ap) {
+    function_tables[libname].ctrttp_sycl(queue, upper_lower, n, a, lda, ap);
+}
+
+void trttp(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+           cl::sycl::buffer<std::complex<double>, 1> &ap) {
+    function_tables[libname].ztrttp_sycl(queue, upper_lower, n, a, lda, ap);
+}
+
+void gbtge_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                 std::int64_t kl, std::int64_t ku, cl::sycl::buffer<float, 1> &ab,
+                 std::int64_t ldab, std::int64_t stride_ab, cl::sycl::buffer<float, 1> &a,
+                 std::int64_t lda, std::int64_t stride_a, std::int64_t batch_size) {
+    function_tables[libname].sgbtge_batch_strided_sycl(queue, m, n, kl, ku, ab, ldab, stride_ab, a,
+                                                       lda, stride_a, batch_size);
+}
+
+void gbtge_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                 std::int64_t kl, std::int64_t ku, cl::sycl::buffer<double, 1> &ab,
+                 std::int64_t ldab, std::int64_t stride_ab, cl::sycl::buffer<double, 1> &a,
+                 std::int64_t lda, std::int64_t stride_a, std::int64_t batch_size) {
+    function_tables[libname].dgbtge_batch_strided_sycl(queue, m, n, kl, ku, ab, ldab, stride_ab, a,
+                                                       lda, stride_a, batch_size);
+}
+
+void gbtge_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                 std::int64_t kl, std::int64_t ku, cl::sycl::buffer<std::complex<float>, 1> &ab,
+                 std::int64_t ldab, std::int64_t stride_ab,
+                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                 std::int64_t stride_a, std::int64_t batch_size) {
+    function_tables[libname].cgbtge_batch_strided_sycl(queue, m, n, kl, ku, ab, ldab, stride_ab, a,
+                                                       lda, stride_a, batch_size);
+}
+
+void gbtge_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                 std::int64_t kl, std::int64_t ku, cl::sycl::buffer<std::complex<double>, 1> &ab,
+                 std::int64_t ldab, std::int64_t stride_ab,
+                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                 std::int64_t stride_a, std::int64_t batch_size) {
+    function_tables[libname].zgbtge_batch_strided_sycl(queue, m, n, kl, ku, ab, ldab, stride_ab, a,
+                                                       lda, stride_a, batch_size);
+}
+
+void gettgb_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                  std::int64_t kl, std::int64_t ku, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                  std::int64_t stride_a, cl::sycl::buffer<float, 1> &ab, std::int64_t ldab,
+                  std::int64_t stride_ab, std::int64_t batch_size) {
+    function_tables[libname].sgettgb_batch_strided_sycl(queue, m, n, kl, ku, a, lda, stride_a, ab,
+                                                        ldab, stride_ab, batch_size);
+}
+
+void gettgb_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                  std::int64_t kl, std::int64_t ku, cl::sycl::buffer<double, 1> &a,
+                  std::int64_t lda, std::int64_t stride_a, cl::sycl::buffer<double, 1> &ab,
+                  std::int64_t ldab, std::int64_t stride_ab, std::int64_t batch_size) {
+    function_tables[libname].dgettgb_batch_strided_sycl(queue, m, n, kl, ku, a, lda, stride_a, ab,
+                                                        ldab, stride_ab, batch_size);
+}
+
+void gettgb_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                  std::int64_t kl, std::int64_t ku, cl::sycl::buffer<std::complex<float>, 1> &a,
+                  std::int64_t lda, std::int64_t stride_a,
+                  cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t ldab,
+                  std::int64_t stride_ab, std::int64_t batch_size) {
+    function_tables[libname].cgettgb_batch_strided_sycl(queue, m, n, kl, ku, a, lda, stride_a, ab,
+                                                        ldab, stride_ab, batch_size);
+}
+
+void gettgb_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                  std::int64_t kl, std::int64_t ku, cl::sycl::buffer<std::complex<double>, 1> &a,
+                  std::int64_t lda, std::int64_t stride_a,
+                  cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t ldab,
+                  std::int64_t stride_ab, std::int64_t batch_size) {
+    function_tables[libname].zgettgb_batch_strided_sycl(queue, m, n, kl, ku, a, lda, stride_a, ab,
+                                                        ldab, stride_ab, batch_size);
+}
+
+void tpttr_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<float, 1> &ap, std::int64_t stride_ap,
+                 cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                 std::int64_t batch_size) {
+    function_tables[libname].stpttr_batch_strided_sycl(queue, upper_lower, n, ap, stride_ap, a, lda,
+                                                       stride_a, batch_size);
+}
+
+void tpttr_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<double, 1> &ap, std::int64_t stride_ap,
+                 cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                 std::int64_t batch_size) {
+    function_tables[libname].dtpttr_batch_strided_sycl(queue, upper_lower, n, ap, stride_ap, a, lda,
+                                                       stride_a, batch_size);
+}
+
+void tpttr_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<std::complex<float>, 1> &ap, std::int64_t stride_ap,
+                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                 std::int64_t stride_a, std::int64_t batch_size) {
+    function_tables[libname].ctpttr_batch_strided_sycl(queue, upper_lower, n, ap, stride_ap, a, lda,
+                                                       stride_a, batch_size);
+}
+
+void tpttr_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<std::complex<double>, 1> &ap, std::int64_t stride_ap,
+                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                 std::int64_t stride_a, std::int64_t batch_size) {
+    function_tables[libname].ztpttr_batch_strided_sycl(queue, upper_lower, n, ap, stride_ap, a, lda,
+                                                       stride_a, batch_size);
+}
+
+void trttp_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                 cl::sycl::buffer<float, 1> &ap, std::int64_t stride_ap, std::int64_t batch_size) {
+    function_tables[libname].strttp_batch_strided_sycl(queue, upper_lower, n, a, lda, stride_a, ap,
+                                                       stride_ap, batch_size);
+}
+
+void trttp_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                 cl::sycl::buffer<double, 1> &ap, std::int64_t stride_ap, std::int64_t batch_size) {
+    function_tables[libname].dtrttp_batch_strided_sycl(queue, upper_lower, n, a, lda, stride_a, ap,
+                                                       stride_ap, batch_size);
+}
+
+void trttp_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                 std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &ap,
+                 std::int64_t stride_ap, std::int64_t batch_size) {
+    function_tables[libname].ctrttp_batch_strided_sycl(queue, upper_lower, n, a, lda, stride_a, ap,
+                                                       stride_ap, batch_size);
+}
+
+void trttp_batch(char *libname, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
+                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                 std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &ap,
+                 std::int64_t stride_ap, std::int64_t batch_size) {
+    function_tables[libname].ztrttp_batch_strided_sycl(queue, upper_lower, n, a, lda, stride_a, ap,
+                                                       stride_ap, batch_size);
+}
+
+void gemv(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+          float alpha, cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+          cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+          cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    function_tables[libname].gemv_f16f32_sycl(queue, trans, m, n, alpha, a, lda, x, incx, beta, y,
+                                              incy);
+}
+
+void gemv(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+          float alpha, cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+          cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+          cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    function_tables[libname].gemv_bf16f32_sycl(queue, trans, m, n, alpha, a, lda, x, incx, beta, y,
+                                               incy);
+}
+
+void gemv_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                std::int64_t n, float alpha, cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                std::int64_t stride_y, std::int64_t batch_size) {
+    function_tables[libname].gemv_f16f32_batch_strided_sycl(queue, trans, m, n, alpha, a, lda,
+                                                            stride_a, x, incx, stride_x, beta, y,
+                                                            incy, stride_y, batch_size);
+}
+
+void gemv_batch(char *libname, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                std::int64_t n, float alpha, cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                std::int64_t stride_a, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                std::int64_t stride_x, float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                std::int64_t stride_y, std::int64_t batch_size) {
+    function_tables[libname].gemv_bf16f32_batch_strided_sycl(queue, trans, m, n, alpha, a, lda,
+                                                             stride_a, x, incx, stride_x, beta, y,
+                                                             incy, stride_y, batch_size);
+}
+
+void lange(char *libname, cl::sycl::queue &queue, norm_type norm, transpose trans, std::int64_t m,
+           std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+           cl::sycl::buffer<float, 1> &result) {
+    function_tables[libname].slange_sycl(queue, norm, trans, m, n, a, lda, result);
+}
+
+void lange(char *libname, cl::sycl::queue &queue, norm_type norm, transpose trans, std::int64_t m,
+           std::int64_t n, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+           cl::sycl::buffer<double, 1> &result) {
+    function_tables[libname].dlange_sycl(queue, norm, trans, m, n, a, lda, result);
+}
+
+void reduce_columns(char *libname, cl::sycl::queue &queue, reduction op, transpose trans,
+                    std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                    cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    function_tables[libname].sreduce_columns_sycl(queue, op, trans, m, n, a, lda, y, incy);
+}
+
+void reduce_columns(char *libname, cl::sycl::queue &queue, reduction op, transpose trans,
+                    std::int64_t m, std::int64_t n, cl::sycl::buffer<double, 1> &a,
+                    std::int64_t lda, cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+    function_tables[libname].dreduce_columns_sycl(queue, op, trans, m, n, a, lda, y, incy);
+}
+
+void reduce_rows(char *libname, cl::sycl::queue &queue, reduction op, transpose trans,
+                 std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                 cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    function_tables[libname].sreduce_rows_sycl(queue, op, trans, m, n, a, lda, y, incy);
+}
+
+void reduce_rows(char *libname, cl::sycl::queue &queue, reduction op, transpose trans,
+                 std::int64_t m, std::int64_t n, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                 cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+    function_tables[libname].dreduce_rows_sycl(queue, op, trans, m, n, a, lda, y, incy);
+}
+
+void omatclamp(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float lo,
+               float hi, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+               cl::sycl::buffer<float, 1> &b, std::int64_t ldb) {
+    function_tables[libname].somatclamp_sycl(queue, m, n, lo, hi, a, lda, b, ldb);
+}
+
+void omatclamp(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n, double lo,
+               double hi, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+               cl::sycl::buffer<double, 1> &b, std::int64_t ldb) {
+    function_tables[libname].domatclamp_sycl(queue, m, n, lo, hi, a, lda, b, ldb);
+}
+
+void omatclamp_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                     float lo, float hi, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                     std::int64_t stride_a, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                     std::int64_t stride_b, std::int64_t batch_size) {
+    function_tables[libname].somatclamp_batch_strided_sycl(queue, m, n, lo, hi, a, lda, stride_a, b,
+                                                           ldb, stride_b, batch_size);
+}
+
+void omatclamp_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                     double lo, double hi, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                     std::int64_t stride_a, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                     std::int64_t stride_b, std::int64_t batch_size) {
+    function_tables[libname].domatclamp_batch_strided_sycl(queue, m, n, lo, hi, a, lda, stride_a, b,
+                                                           ldb, stride_b, batch_size);
+}
+
+void omatdiv(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+             std::int64_t ldb, cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    function_tables[libname].somatdiv_sycl(queue, m, n, a, lda, b, ldb, c, ldc);
+}
+
+void omatdiv(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+             std::int64_t ldb, cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    function_tables[libname].domatdiv_sycl(queue, m, n, a, lda, b, ldb, c, ldc);
+}
+
+void omatdiv(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+             cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    function_tables[libname].comatdiv_sycl(queue, m, n, a, lda, b, ldb, c, ldc);
+}
+
+void omatdiv(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+             cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    function_tables[libname].zomatdiv_sycl(queue, m, n, a, lda, b, ldb, c, ldc);
+}
+
+void omatdiv_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                   std::int64_t batch_size) {
+    function_tables[libname].somatdiv_batch_strided_sycl(queue, m, n, a, lda, stride_a, b, ldb,
+                                                         stride_b, c, ldc, stride_c, batch_size);
+}
+
+void omatdiv_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                   std::int64_t batch_size) {
+    function_tables[libname].domatdiv_batch_strided_sycl(queue, m, n, a, lda, stride_a, b, ldb,
+                                                         stride_b, c, ldc, stride_c, batch_size);
+}
+
+void omatdiv_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                   std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    function_tables[libname].comatdiv_batch_strided_sycl(queue, m, n, a, lda, stride_a, b, ldb,
+                                                         stride_b, c, ldc, stride_c, batch_size);
+}
+
+void omatdiv_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                   std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    function_tables[libname].zomatdiv_batch_strided_sycl(queue, m, n, a, lda, stride_a, b, ldb,
+                                                         stride_b, c, ldc, stride_c, batch_size);
+}
+
+void omatfma(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float alpha,
+             cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+             std::int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    function_tables[libname].somatfma_sycl(queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+void omatfma(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n, double alpha,
+             cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+             std::int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    function_tables[libname].domatfma_sycl(queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+void omatfma(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+             std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+             std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+             std::int64_t ldc) {
+    function_tables[libname].comatfma_sycl(queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+void omatfma(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+             std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+             std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+             std::int64_t ldc) {
+    function_tables[libname].zomatfma_sycl(queue, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+void omatfma_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, float beta, cl::sycl::buffer<float, 1> &c,
+                   std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    function_tables[libname].somatfma_batch_strided_sycl(queue, m, n, alpha, a, lda, stride_a, b,
+                                                         ldb, stride_b, beta, c, ldc, stride_c,
+                                                         batch_size);
+}
+
+void omatfma_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, double beta, cl::sycl::buffer<double, 1> &c,
+                   std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    function_tables[libname].domatfma_batch_strided_sycl(queue, m, n, alpha, a, lda, stride_a, b,
+                                                         ldb, stride_b, beta, c, ldc, stride_c,
+                                                         batch_size);
+}
+
+void omatfma_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                   std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, std::complex<float> beta,
+                   cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    function_tables[libname].comatfma_batch_strided_sycl(queue, m, n, alpha, a, lda, stride_a, b,
+                                                         ldb, stride_b, beta, c, ldc, stride_c,
+                                                         batch_size);
+}
+
+void omatfma_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                   std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, std::complex<double> beta,
+                   cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    function_tables[libname].zomatfma_batch_strided_sycl(queue, m, n, alpha, a, lda, stride_a, b,
+                                                         ldb, stride_b, beta, c, ldc, stride_c,
+                                                         batch_size);
+}
+
+void omatmul(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+             std::int64_t ldb, cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    function_tables[libname].somatmul_sycl(queue, m, n, a, lda, b, ldb, c, ldc);
+}
+
+void omatmul(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+             std::int64_t ldb, cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    function_tables[libname].domatmul_sycl(queue, m, n, a, lda, b, ldb, c, ldc);
+}
+
+void omatmul(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+             cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    function_tables[libname].comatmul_sycl(queue, m, n, a, lda, b, ldb, c, ldc);
+}
+
+void omatmul(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+             cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+             cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    function_tables[libname].zomatmul_sycl(queue, m, n, a, lda, b, ldb, c, ldc);
+}
+
+void omatmul_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                   std::int64_t batch_size) {
+    function_tables[libname].somatmul_batch_strided_sycl(queue, m, n, a, lda, stride_a, b, ldb,
+                                                         stride_b, c, ldc, stride_c, batch_size);
+}
+
+void omatmul_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                   cl::sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+                   std::int64_t batch_size) {
+    function_tables[libname].domatmul_batch_strided_sycl(queue, m, n, a, lda, stride_a, b, ldb,
+                                                         stride_b, c, ldc, stride_c, batch_size);
+}
+
+void omatmul_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                   std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    function_tables[libname].comatmul_batch_strided_sycl(queue, m, n, a, lda, stride_a, b, ldb,
+                                                         stride_b, c, ldc, stride_c, batch_size);
+}
+
+void omatmul_batch(char *libname, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                   std::int64_t ldb, std::int64_t stride_b,
+                   cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    function_tables[libname].zomatmul_batch_strided_sycl(queue, m, n, a, lda, stride_a, b, ldb,
+                                                         stride_b, c, ldc, stride_c, batch_size);
+}
+
+void vclamp(char *libname, cl::sycl::queue &queue, std::int64_t n, float lo, float hi,
+            cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
+            std::int64_t incy) {
+    function_tables[libname].svclamp_sycl(queue, n, lo, hi, x, incx, y, incy);
+}
+
+void vclamp(char *libname, cl::sycl::queue &queue, std::int64_t n, double lo, double hi,
+            cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
+            std::int64_t incy) {
+    function_tables[libname].dvclamp_sycl(queue, n, lo, hi, x, incx, y, incy);
+}
+
+void vdiv(char *libname, cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+          std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+          cl::sycl::buffer<float, 1> &z, std::int64_t incz) {
+    function_tables[libname].svdiv_sycl(queue, n, x, incx, y, incy, z, incz);
+}
+
+void vdiv(char *libname, cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+          std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+          cl::sycl::buffer<double, 1> &z, std::int64_t incz) {
+    function_tables[libname].dvdiv_sycl(queue, n, x, incx, y, incy, z, incz);
+}
+
+void vdiv(char *libname, cl::sycl::queue &queue, std::int64_t n,
+          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+          cl::sycl::buffer<std::complex<float>, 1> &z, std::int64_t incz) {
+    function_tables[libname].cvdiv_sycl(queue, n, x, incx, y, incy, z, incz);
+}
+
+void vdiv(char *libname, cl::sycl::queue &queue, std::int64_t n,
+          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+          cl::sycl::buffer<std::complex<double>, 1> &z, std::int64_t incz) {
+    function_tables[libname].zvdiv_sycl(queue, n, x, incx, y, incy, z, incz);
+}
+
+void vfma(char *libname, cl::sycl::queue &queue, std::int64_t n, float alpha,
+          cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
+          std::int64_t incy, float beta, cl::sycl::buffer<float, 1> &z, std::int64_t incz) {
+    function_tables[libname].svfma_sycl(queue, n, alpha, x, incx, y, incy, beta, z, incz);
+}
+
+void vfma(char *libname, cl::sycl::queue &queue, std::int64_t n, double alpha,
+          cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
+          std::int64_t incy, double beta, cl::sycl::buffer<double, 1> &z, std::int64_t incz) {
+    function_tables[libname].dvfma_sycl(queue, n, alpha, x, incx, y, incy, beta, z, incz);
+}
+
+void vfma(char *libname, cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy, std::complex<float> beta,
+          cl::sycl::buffer<std::complex<float>, 1> &z, std::int64_t incz) {
+    function_tables[libname].cvfma_sycl(queue, n, alpha, x, incx, y, incy, beta, z, incz);
+}
+
+void vfma(char *libname, cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+          std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &z,
+          std::int64_t incz) {
+    function_tables[libname].zvfma_sycl(queue, n, alpha, x, incx, y, incy, beta, z, incz);
+}
+
+void vmul(char *libname, cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+          std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+          cl::sycl::buffer<float, 1> &z, std::int64_t incz) {
+    function_tables[libname].svmul_sycl(queue, n, x, incx, y, incy, z, incz);
+}
+
+void vmul(char *libname, cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+          std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+          cl::sycl::buffer<double, 1> &z, std::int64_t incz) {
+    function_tables[libname].dvmul_sycl(queue, n, x, incx, y, incy, z, incz);
+}
+
+void vmul(char *libname, cl::sycl::queue &queue, std::int64_t n,
+          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+          cl::sycl::buffer<std::complex<float>, 1> &z, std::int64_t incz) {
+    function_tables[libname].cvmul_sycl(queue, n, x, incx, y, incy, z, incz);
+}
+
+void vmul(char *libname, cl::sycl::queue &queue, std::int64_t n,
+          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+          cl::sycl::buffer<std::complex<double>, 1> &z, std::int64_t incz) {
+    function_tables[libname].zvmul_sycl(queue, n, x, incx, y, incy, z, incz);
+}
+
+void gemm3m(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+            std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+            cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+            cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    function_tables[libname].cgemm3m_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                                          beta, c, ldc);
+}
+
+void gemm3m(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+            std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+            cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+            std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+            std::int64_t ldc) {
+    function_tables[libname].zgemm3m_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                                          beta, c, ldc);
+}
+
+void gemm3m_batch(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+                  std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                  cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                  std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                  std::int64_t ldb, std::int64_t stride_b, std::complex<float> beta,
+                  cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                  std::int64_t stride_c, std::int64_t batch_size) {
+    function_tables[libname].cgemm3m_batch_strided_sycl(queue, transa, transb, m, n, k, alpha, a,
+                                                        lda, stride_a, b, ldb, stride_b, beta, c,
+                                                        ldc, stride_c, batch_size);
+}
+
+void gemm3m_batch(char *libname, cl::sycl::queue &queue, transpose transa, transpose transb,
+                  std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                  cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                  std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                  std::int64_t ldb, std::int64_t stride_b, std::complex<double> beta,
+                  cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                  std::int64_t stride_c, std::int64_t batch_size) {
+    function_tables[libname].zgemm3m_batch_strided_sycl(queue, transa, transb, m, n, k, alpha, a,
+                                                        lda, stride_a, b, ldb, stride_b, beta, c,
+                                                        ldc, stride_c, batch_size);
+}
+
 } /*namespace detail */
 } /* namespace blas */
 } /* namespace onemkl */
@@ -801,6 +801,1300 @@ typedef struct {
                            half alpha, cl::sycl::buffer<half, 1> &a, std::int64_t lda,
                            cl::sycl::buffer<half, 1> &b, std::int64_t ldb, half beta,
                            cl::sycl::buffer<half, 1> &c, std::int64_t ldc);
+    void (*convert_f16f32_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                cl::sycl::buffer<half, 1> &x, cl::sycl::buffer<float, 1> &y);
+    void (*convert_f32f16_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<half, 1> &y);
+    void (*convert_bf16f32_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                 cl::sycl::buffer<onemkl::bfloat16, 1> &x,
+                                 cl::sycl::buffer<float, 1> &y);
+    void (*convert_f32bf16_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                 cl::sycl::buffer<float, 1> &x,
+                                 cl::sycl::buffer<onemkl::bfloat16, 1> &y);
+    void (*convert_f16f32_matrix_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                       cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+                                       cl::sycl::buffer<float, 1> &b, std::int64_t ldb);
+    void (*convert_f32f16_matrix_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                       cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                       cl::sycl::buffer<half, 1> &b, std::int64_t ldb);
+    void (*convert_bf16f32_matrix_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                        cl::sycl::buffer<onemkl::bfloat16, 1> &a, std::int64_t lda,
+                                        cl::sycl::buffer<float, 1> &b, std::int64_t ldb);
+    void (*convert_f32bf16_matrix_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                        cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                        cl::sycl::buffer<onemkl::bfloat16, 1> &b, std::int64_t ldb);
+    void (*gemm_s16s16s32_ext_sycl)(cl::sycl::queue &queue, onemkl::transpose transa,
+                                    onemkl::transpose transb, onemkl::offset offsetc,
+                                    std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                    cl::sycl::buffer<int16_t, 1> &a, std::int64_t lda, int16_t ao,
+                                    cl::sycl::buffer<int16_t, 1> &b, std::int64_t ldb, int16_t bo,
+                                    float beta, cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                                    cl::sycl::buffer<int32_t, 1> &co);
+    void (*gemm_s8s8s32_ext_sycl)(cl::sycl::queue &queue, onemkl::transpose transa,
+                                  onemkl::transpose transb, onemkl::offset offsetc, std::int64_t m,
+                                  std::int64_t n, std::int64_t k, float alpha,
+                                  cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
+                                  cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+                                  float beta, cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                                  cl::sycl::buffer<int32_t, 1> &co);
+    void (*gemm_u8s8s32_ext_sycl)(cl::sycl::queue &queue, onemkl::transpose transa,
+                                  onemkl::transpose transb, onemkl::offset offsetc, std::int64_t m,
+                                  std::int64_t n, std::int64_t k, float alpha,
+                                  cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
+                                  cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo,
+                                  float beta, cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                                  cl::sycl::buffer<int32_t, 1> &co);
+    void (*gemm_s8u8s8_ext_sycl)(cl::sycl::queue &queue, onemkl::transpose transa,
+                                 onemkl::transpose transb, onemkl::offset scalec, std::int64_t m,
+                                 std::int64_t n, std::int64_t k, cl::sycl::buffer<int8_t, 1> &a,
+                                 std::int64_t lda, int8_t ao, cl::sycl::buffer<uint8_t, 1> &b,
+                                 std::int64_t ldb, uint8_t bo, cl::sycl::buffer<float, 1> &scales,
+                                 int8_t zc, cl::sycl::buffer<int8_t, 1> &c, std::int64_t ldc);
+    void (*gemm_s8u8u8_ext_sycl)(cl::sycl::queue &queue, onemkl::transpose transa,
+                                 onemkl::transpose transb, onemkl::offset scalec, std::int64_t m,
+                                 std::int64_t n, std::int64_t k, cl::sycl::buffer<int8_t, 1> &a,
+                                 std::int64_t lda, int8_t ao, cl::sycl::buffer<uint8_t, 1> &b,
+                                 std::int64_t ldb, uint8_t bo, cl::sycl::buffer<float, 1> &scales,
+                                 uint8_t zc, cl::sycl::buffer<uint8_t, 1> &c, std::int64_t ldc);
+    void (*gemm_s8s8s8_ext_sycl)(cl::sycl::queue &queue, onemkl::transpose transa,
+                                 onemkl::transpose transb, onemkl::offset scalec, std::int64_t m,
+                                 std::int64_t n, std::int64_t k, cl::sycl::buffer<int8_t, 1> &a,
+                                 std::int64_t lda, int8_t ao, cl::sycl::buffer<int8_t, 1> &b,
+                                 std::int64_t ldb, int8_t bo, cl::sycl::buffer<float, 1> &scales,
+                                 int8_t zc, cl::sycl::buffer<int8_t, 1> &c, std::int64_t ldc);
+    void (*gemm_s8s8u8_ext_sycl)(cl::sycl::queue &queue, onemkl::transpose transa,
+                                 onemkl::transpose transb, onemkl::offset scalec, std::int64_t m,
+                                 std::int64_t n, std::int64_t k, cl::sycl::buffer<int8_t, 1> &a,
+                                 std::int64_t lda, int8_t ao, cl::sycl::buffer<int8_t, 1> &b,
+                                 std::int64_t ldb, int8_t bo, cl::sycl::buffer<float, 1> &scales,
+                                 uint8_t zc, cl::sycl::buffer<uint8_t, 1> &c, std::int64_t ldc);
+    void (*gemm_u8s8s8_ext_sycl)(cl::sycl::queue &queue, onemkl::transpose transa,
+                                 onemkl::transpose transb, onemkl::offset scalec, std::int64_t m,
+                                 std::int64_t n, std::int64_t k, cl::sycl::buffer<uint8_t, 1> &a,
+                                 std::int64_t lda, uint8_t ao, cl::sycl::buffer<int8_t, 1> &b,
+                                 std::int64_t ldb, int8_t bo, cl::sycl::buffer<float, 1> &scales,
+                                 int8_t zc, cl::sycl::buffer<int8_t, 1> &c, std::int64_t ldc);
+    void (*gemm_u8s8u8_ext_sycl)(cl::sycl::queue &queue, onemkl::transpose transa,
+                                 onemkl::transpose transb, onemkl::offset scalec, std::int64_t m,
+                                 std::int64_t n, std::int64_t k, cl::sycl::buffer<uint8_t, 1> &a,
+                                 std::int64_t lda, uint8_t ao, cl::sycl::buffer<int8_t, 1> &b,
+                                 std::int64_t ldb, int8_t bo, cl::sycl::buffer<float, 1> &scales,
+                                 uint8_t zc, cl::sycl::buffer<uint8_t, 1> &c, std::int64_t ldc);
+    void (*gemm_s8u8s32_compute_packed_a_sycl)(cl::sycl::queue &queue, onemkl::transpose transb,
+                                               onemkl::offset offsetc, std::int64_t m,
+                                               std::int64_t n, std::int64_t k, float alpha,
+                                               cl::sycl::buffer<int8_t, 1> &packed_a, int8_t ao,
+                                               cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb,
+                                               uint8_t bo, float beta,
+                                               cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                                               cl::sycl::buffer<int32_t, 1> &co);
+    void (*gemm_s8u8s32_compute_packed_b_sycl)(cl::sycl::queue &queue, onemkl::transpose transa,
+                                               onemkl::offset offsetc, std::int64_t m,
+                                               std::int64_t n, std::int64_t k, float alpha,
+                                               cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda,
+                                               int8_t ao, cl::sycl::buffer<uint8_t, 1> &packed_b,
+                                               uint8_t bo, float beta,
+                                               cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                                               cl::sycl::buffer<int32_t, 1> &co);
+    void (*gemm_s8u8s32_pack_a_sycl)(cl::sycl::queue &queue, onemkl::transpose transa,
+                                     std::int64_t m, std::int64_t n, std::int64_t k,
+                                     cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda,
+                                     cl::sycl::buffer<int8_t, 1> &packed_a);
+    void (*gemm_s8u8s32_pack_b_sycl)(cl::sycl::queue &queue, onemkl::transpose transb,
+                                     std::int64_t m, std::int64_t n, std::int64_t k,
+                                     cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb,
+                                     cl::sycl::buffer<uint8_t, 1> &packed_b);
+    std::int64_t (*gemm_s8u8s32_pack_get_size_sycl)(cl::sycl::queue &queue,
+                                                    onemkl::identifier which, std::int64_t m,
+                                                    std::int64_t n, std::int64_t k);
+    void (*sgemm_batch_group_offset_sycl)(
+        cl::sycl::queue &queue, cl::sycl::buffer<onemkl::transpose, 1> &transa,
+        cl::sycl::buffer<onemkl::transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+        cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+        cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+        cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+        cl::sycl::buffer<float, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+        cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+        cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+        cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+        cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*dgemm_batch_group_offset_sycl)(
+        cl::sycl::queue &queue, cl::sycl::buffer<onemkl::transpose, 1> &transa,
+        cl::sycl::buffer<onemkl::transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+        cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+        cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+        cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+        cl::sycl::buffer<double, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+        cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<double, 1> &beta,
+        cl::sycl::buffer<double, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+        cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+        cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*cgemm_batch_group_offset_sycl)(
+        cl::sycl::queue &queue, cl::sycl::buffer<onemkl::transpose, 1> &transa,
+        cl::sycl::buffer<onemkl::transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+        cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+        cl::sycl::buffer<std::complex<float>, 1> &alpha,
+        cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+        cl::sycl::buffer<std::int64_t, 1> &offset_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+        cl::sycl::buffer<std::int64_t, 1> &ldb, cl::sycl::buffer<std::int64_t, 1> &offset_b,
+        cl::sycl::buffer<std::complex<float>, 1> &beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+        cl::sycl::buffer<std::int64_t, 1> &ldc, cl::sycl::buffer<std::int64_t, 1> &offset_c,
+        std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*zgemm_batch_group_offset_sycl)(
+        cl::sycl::queue &queue, cl::sycl::buffer<onemkl::transpose, 1> &transa,
+        cl::sycl::buffer<onemkl::transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+        cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+        cl::sycl::buffer<std::complex<double>, 1> &alpha,
+        cl::sycl::buffer<std::complex<double>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+        cl::sycl::buffer<std::int64_t, 1> &offset_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+        cl::sycl::buffer<std::int64_t, 1> &ldb, cl::sycl::buffer<std::int64_t, 1> &offset_b,
+        cl::sycl::buffer<std::complex<double>, 1> &beta,
+        cl::sycl::buffer<std::complex<double>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+        cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+        cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*cherk_batch_group_sycl)(
+        cl::sycl::queue &queue, cl::sycl::buffer<onemkl::uplo, 1> &upper_lower,
+        cl::sycl::buffer<onemkl::transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+        cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<float, 1> &alpha,
+        cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+        cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+        cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+        cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*zherk_batch_group_sycl)(
+        cl::sycl::queue &queue, cl::sycl::buffer<onemkl::uplo, 1> &upper_lower,
+        cl::sycl::buffer<onemkl::transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+        cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<double, 1> &alpha,
+        cl::sycl::buffer<std::complex<double>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+        cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+        cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+        cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*cherk_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::uplo upper_lower,
+                                     onemkl::transpose trans, std::int64_t n, std::int64_t k,
+                                     float alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                                     std::int64_t lda, std::int64_t stride_a, float beta,
+                                     cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                                     std::int64_t stride_c, std::int64_t batch_size);
+    void (*zherk_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::uplo upper_lower,
+                                     onemkl::transpose trans, std::int64_t n, std::int64_t k,
+                                     double alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                                     std::int64_t lda, std::int64_t stride_a, double beta,
+                                     cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                     std::int64_t stride_c, std::int64_t batch_size);
+    void (*ssyrk_batch_group_sycl)(cl::sycl::queue &queue,
+                                   cl::sycl::buffer<onemkl::uplo, 1> &upper_lower,
+                                   cl::sycl::buffer<onemkl::transpose, 1> &trans,
+                                   cl::sycl::buffer<std::int64_t, 1> &n,
+                                   cl::sycl::buffer<std::int64_t, 1> &k,
+                                   cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+                                   cl::sycl::buffer<std::int64_t, 1> &lda,
+                                   cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &c,
+                                   cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+                                   cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*dsyrk_batch_group_sycl)(
+        cl::sycl::queue &queue, cl::sycl::buffer<onemkl::uplo, 1> &upper_lower,
+        cl::sycl::buffer<onemkl::transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+        cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<double, 1> &alpha,
+        cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+        cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &c,
+        cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+        cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*csyrk_batch_group_sycl)(
+        cl::sycl::queue &queue, cl::sycl::buffer<onemkl::uplo, 1> &upper_lower,
+        cl::sycl::buffer<onemkl::transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+        cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<std::complex<float>, 1> &alpha,
+        cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+        cl::sycl::buffer<std::complex<float>, 1> &beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+        cl::sycl::buffer<std::int64_t, 1> &ldc, std::int64_t group_count,
+        cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*zsyrk_batch_group_sycl)(
+        cl::sycl::queue &queue, cl::sycl::buffer<onemkl::uplo, 1> &upper_lower,
+        cl::sycl::buffer<onemkl::transpose, 1> &trans, cl::sycl::buffer<std::int64_t, 1> &n,
+        cl::sycl::buffer<std::int64_t, 1> &k, cl::sycl::buffer<std::complex<double>, 1> &alpha,
+        cl::sycl::buffer<std::complex<double>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+        cl::sycl::buffer<std::complex<double>, 1> &beta,
+        cl::sycl::buffer<std::complex<double>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+        std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*ssyrk_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::uplo upper_lower,
+                                     onemkl::transpose trans, std::int64_t n, std::int64_t k,
+                                     float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a, float beta,
+                                     cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                     std::int64_t stride_c, std::int64_t batch_size);
+    void (*dsyrk_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::uplo upper_lower,
+                                     onemkl::transpose trans, std::int64_t n, std::int64_t k,
+                                     double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a, double beta,
+                                     cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                     std::int64_t stride_c, std::int64_t batch_size);
+    void (*csyrk_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::uplo upper_lower,
+                                     onemkl::transpose trans, std::int64_t n, std::int64_t k,
+                                     std::complex<float> alpha,
+                                     cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a, std::complex<float> beta,
+                                     cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                                     std::int64_t stride_c, std::int64_t batch_size);
+    void (*zsyrk_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::uplo upper_lower,
+                                     onemkl::transpose trans, std::int64_t n, std::int64_t k,
+                                     std::complex<double> alpha,
+                                     cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a, std::complex<double> beta,
+                                     cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                     std::int64_t stride_c, std::int64_t batch_size);
+    void (*sgemv_batch_group_sycl)(
+        cl::sycl::queue &queue, cl::sycl::buffer<onemkl::transpose, 1> &trans,
+        cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+        cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+        cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<float, 1> &x,
+        cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<float, 1> &beta,
+        cl::sycl::buffer<float, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+        std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*dgemv_batch_group_sycl)(
+        cl::sycl::queue &queue, cl::sycl::buffer<onemkl::transpose, 1> &trans,
+        cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+        cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+        cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<double, 1> &x,
+        cl::sycl::buffer<std::int64_t, 1> &incx, cl::sycl::buffer<double, 1> &beta,
+        cl::sycl::buffer<double, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+        std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*cgemv_batch_group_sycl)(
+        cl::sycl::queue &queue, cl::sycl::buffer<onemkl::transpose, 1> &trans,
+        cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+        cl::sycl::buffer<std::complex<float>, 1> &alpha,
+        cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+        cl::sycl::buffer<std::complex<float>, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+        cl::sycl::buffer<std::complex<float>, 1> &beta, cl::sycl::buffer<std::complex<float>, 1> &y,
+        cl::sycl::buffer<std::int64_t, 1> &incy, std::int64_t group_count,
+        cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*zgemv_batch_group_sycl)(
+        cl::sycl::queue &queue, cl::sycl::buffer<onemkl::transpose, 1> &trans,
+        cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+        cl::sycl::buffer<std::complex<double>, 1> &alpha,
+        cl::sycl::buffer<std::complex<double>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+        cl::sycl::buffer<std::complex<double>, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+        cl::sycl::buffer<std::complex<double>, 1> &beta,
+        cl::sycl::buffer<std::complex<double>, 1> &y, cl::sycl::buffer<std::int64_t, 1> &incy,
+        std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*sgemv_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::transpose trans,
+                                     std::int64_t m, std::int64_t n, float alpha,
+                                     cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a, cl::sycl::buffer<float, 1> &x,
+                                     std::int64_t incx, std::int64_t stride_x, float beta,
+                                     cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                                     std::int64_t stride_y, std::int64_t batch_size);
+    void (*dgemv_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::transpose trans,
+                                     std::int64_t m, std::int64_t n, double alpha,
+                                     cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a, cl::sycl::buffer<double, 1> &x,
+                                     std::int64_t incx, std::int64_t stride_x, double beta,
+                                     cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                                     std::int64_t stride_y, std::int64_t batch_size);
+    void (*cgemv_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::transpose trans,
+                                     std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                                     cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a,
+                                     cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x, std::complex<float> beta,
+                                     cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                                     std::int64_t stride_y, std::int64_t batch_size);
+    void (*zgemv_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::transpose trans,
+                                     std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                                     cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a,
+                                     cl::sycl::buffer<std::complex<double>, 1> &x,
+                                     std::int64_t incx, std::int64_t stride_x,
+                                     std::complex<double> beta,
+                                     cl::sycl::buffer<std::complex<double>, 1> &y,
+                                     std::int64_t incy, std::int64_t stride_y,
+                                     std::int64_t batch_size);
+    void (*sdgmm_batch_group_sycl)(
+        cl::sycl::queue &queue, cl::sycl::buffer<onemkl::side, 1> &left_right,
+        cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+        cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+        cl::sycl::buffer<float, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+        cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+        std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*ddgmm_batch_group_sycl)(
+        cl::sycl::queue &queue, cl::sycl::buffer<onemkl::side, 1> &left_right,
+        cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+        cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+        cl::sycl::buffer<double, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+        cl::sycl::buffer<double, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+        std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*cdgmm_batch_group_sycl)(
+        cl::sycl::queue &queue, cl::sycl::buffer<onemkl::side, 1> &left_right,
+        cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+        cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+        cl::sycl::buffer<std::complex<float>, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+        cl::sycl::buffer<std::complex<float>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+        std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*zdgmm_batch_group_sycl)(
+        cl::sycl::queue &queue, cl::sycl::buffer<onemkl::side, 1> &left_right,
+        cl::sycl::buffer<std::int64_t, 1> &m, cl::sycl::buffer<std::int64_t, 1> &n,
+        cl::sycl::buffer<std::complex<double>, 1> &a, cl::sycl::buffer<std::int64_t, 1> &lda,
+        cl::sycl::buffer<std::complex<double>, 1> &x, cl::sycl::buffer<std::int64_t, 1> &incx,
+        cl::sycl::buffer<std::complex<double>, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+        std::int64_t group_count, cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*sdgmm_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::side left_right,
+                                     std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a,
+                                     std::int64_t lda, std::int64_t stride_a,
+                                     cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x, cl::sycl::buffer<float, 1> &c,
+                                     std::int64_t ldc, std::int64_t stride_c,
+                                     std::int64_t batch_size);
+    void (*ddgmm_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::side left_right,
+                                     std::int64_t m, std::int64_t n, cl::sycl::buffer<double, 1> &a,
+                                     std::int64_t lda, std::int64_t stride_a,
+                                     cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x, cl::sycl::buffer<double, 1> &c,
+                                     std::int64_t ldc, std::int64_t stride_c,
+                                     std::int64_t batch_size);
+    void (*cdgmm_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::side left_right,
+                                     std::int64_t m, std::int64_t n,
+                                     cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a,
+                                     cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x,
+                                     cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                                     std::int64_t stride_c, std::int64_t batch_size);
+    void (*zdgmm_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::side left_right,
+                                     std::int64_t m, std::int64_t n,
+                                     cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a,
+                                     cl::sycl::buffer<std::complex<double>, 1> &x,
+                                     std::int64_t incx, std::int64_t stride_x,
+                                     cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                     std::int64_t stride_c, std::int64_t batch_size);
+    void (*saxpy_batch_group_sycl)(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                   cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &x,
+                                   cl::sycl::buffer<std::int64_t, 1> &incx,
+                                   cl::sycl::buffer<float, 1> &y,
+                                   cl::sycl::buffer<std::int64_t, 1> &incy,
+                                   std::int64_t group_count,
+                                   cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*daxpy_batch_group_sycl)(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                   cl::sycl::buffer<double, 1> &alpha,
+                                   cl::sycl::buffer<double, 1> &x,
+                                   cl::sycl::buffer<std::int64_t, 1> &incx,
+                                   cl::sycl::buffer<double, 1> &y,
+                                   cl::sycl::buffer<std::int64_t, 1> &incy,
+                                   std::int64_t group_count,
+                                   cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*caxpy_batch_group_sycl)(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                   cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                                   cl::sycl::buffer<std::complex<float>, 1> &x,
+                                   cl::sycl::buffer<std::int64_t, 1> &incx,
+                                   cl::sycl::buffer<std::complex<float>, 1> &y,
+                                   cl::sycl::buffer<std::int64_t, 1> &incy,
+                                   std::int64_t group_count,
+                                   cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*zaxpy_batch_group_sycl)(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                   cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                                   cl::sycl::buffer<std::complex<double>, 1> &x,
+                                   cl::sycl::buffer<std::int64_t, 1> &incx,
+                                   cl::sycl::buffer<std::complex<double>, 1> &y,
+                                   cl::sycl::buffer<std::int64_t, 1> &incy,
+                                   std::int64_t group_count,
+                                   cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*saxpy_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                                     cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x, cl::sycl::buffer<float, 1> &y,
+                                     std::int64_t incy, std::int64_t stride_y,
+                                     std::int64_t batch_size);
+    void (*daxpy_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                                     cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x, cl::sycl::buffer<double, 1> &y,
+                                     std::int64_t incy, std::int64_t stride_y,
+                                     std::int64_t batch_size);
+    void (*caxpy_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                     std::complex<float> alpha,
+                                     cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x,
+                                     cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                                     std::int64_t stride_y, std::int64_t batch_size);
+    void (*zaxpy_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                     std::complex<double> alpha,
+                                     cl::sycl::buffer<std::complex<double>, 1> &x,
+                                     std::int64_t incx, std::int64_t stride_x,
+                                     cl::sycl::buffer<std::complex<double>, 1> &y,
+                                     std::int64_t incy, std::int64_t stride_y,
+                                     std::int64_t batch_size);
+    void (*scopy_batch_group_sycl)(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                   cl::sycl::buffer<float, 1> &x,
+                                   cl::sycl::buffer<std::int64_t, 1> &incx,
+                                   cl::sycl::buffer<float, 1> &y,
+                                   cl::sycl::buffer<std::int64_t, 1> &incy,
+                                   std::int64_t group_count,
+                                   cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*dcopy_batch_group_sycl)(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                   cl::sycl::buffer<double, 1> &x,
+                                   cl::sycl::buffer<std::int64_t, 1> &incx,
+                                   cl::sycl::buffer<double, 1> &y,
+                                   cl::sycl::buffer<std::int64_t, 1> &incy,
+                                   std::int64_t group_count,
+                                   cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*ccopy_batch_group_sycl)(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                   cl::sycl::buffer<std::complex<float>, 1> &x,
+                                   cl::sycl::buffer<std::int64_t, 1> &incx,
+                                   cl::sycl::buffer<std::complex<float>, 1> &y,
+                                   cl::sycl::buffer<std::int64_t, 1> &incy,
+                                   std::int64_t group_count,
+                                   cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*zcopy_batch_group_sycl)(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                   cl::sycl::buffer<std::complex<double>, 1> &x,
+                                   cl::sycl::buffer<std::int64_t, 1> &incx,
+                                   cl::sycl::buffer<std::complex<double>, 1> &y,
+                                   cl::sycl::buffer<std::int64_t, 1> &incy,
+                                   std::int64_t group_count,
+                                   cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*scopy_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                     cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x, cl::sycl::buffer<float, 1> &y,
+                                     std::int64_t incy, std::int64_t stride_y,
+                                     std::int64_t batch_size);
+    void (*dcopy_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                     cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x, cl::sycl::buffer<double, 1> &y,
+                                     std::int64_t incy, std::int64_t stride_y,
+                                     std::int64_t batch_size);
+    void (*ccopy_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                     cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x,
+                                     cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                                     std::int64_t stride_y, std::int64_t batch_size);
+    void (*zcopy_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                     cl::sycl::buffer<std::complex<double>, 1> &x,
+                                     std::int64_t incx, std::int64_t stride_x,
+                                     cl::sycl::buffer<std::complex<double>, 1> &y,
+                                     std::int64_t incy, std::int64_t stride_y,
+                                     std::int64_t batch_size);
+    void (*sdot_batch_group_sycl)(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                  cl::sycl::buffer<float, 1> &x,
+                                  cl::sycl::buffer<std::int64_t, 1> &incx,
+                                  cl::sycl::buffer<float, 1> &y,
+                                  cl::sycl::buffer<std::int64_t, 1> &incy,
+                                  cl::sycl::buffer<float, 1> &result, std::int64_t group_count,
+                                  cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*ddot_batch_group_sycl)(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                  cl::sycl::buffer<double, 1> &x,
+                                  cl::sycl::buffer<std::int64_t, 1> &incx,
+                                  cl::sycl::buffer<double, 1> &y,
+                                  cl::sycl::buffer<std::int64_t, 1> &incy,
+                                  cl::sycl::buffer<double, 1> &result, std::int64_t group_count,
+                                  cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*sdot_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x, cl::sycl::buffer<float, 1> &y,
+                                    std::int64_t incy, std::int64_t stride_y,
+                                    cl::sycl::buffer<float, 1> &result, std::int64_t batch_size);
+    void (*ddot_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                    std::int64_t stride_x, cl::sycl::buffer<double, 1> &y,
+                                    std::int64_t incy, std::int64_t stride_y,
+                                    cl::sycl::buffer<double, 1> &result, std::int64_t batch_size);
+    void (*sscal_batch_group_sycl)(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                   cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &x,
+                                   cl::sycl::buffer<std::int64_t, 1> &incx,
+                                   std::int64_t group_count,
+                                   cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*dscal_batch_group_sycl)(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                   cl::sycl::buffer<double, 1> &alpha,
+                                   cl::sycl::buffer<double, 1> &x,
+                                   cl::sycl::buffer<std::int64_t, 1> &incx,
+                                   std::int64_t group_count,
+                                   cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*cscal_batch_group_sycl)(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                   cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                                   cl::sycl::buffer<std::complex<float>, 1> &x,
+                                   cl::sycl::buffer<std::int64_t, 1> &incx,
+                                   std::int64_t group_count,
+                                   cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*zscal_batch_group_sycl)(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                   cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                                   cl::sycl::buffer<std::complex<double>, 1> &x,
+                                   cl::sycl::buffer<std::int64_t, 1> &incx,
+                                   std::int64_t group_count,
+                                   cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*csscal_batch_group_sycl)(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                    cl::sycl::buffer<float, 1> &alpha,
+                                    cl::sycl::buffer<std::complex<float>, 1> &x,
+                                    cl::sycl::buffer<std::int64_t, 1> &incx,
+                                    std::int64_t group_count,
+                                    cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*zdscal_batch_group_sycl)(cl::sycl::queue &queue, cl::sycl::buffer<std::int64_t, 1> &n,
+                                    cl::sycl::buffer<double, 1> &alpha,
+                                    cl::sycl::buffer<std::complex<double>, 1> &x,
+                                    cl::sycl::buffer<std::int64_t, 1> &incx,
+                                    std::int64_t group_count,
+                                    cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*sscal_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                                     cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x, std::int64_t batch_size);
+    void (*dscal_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                                     cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x, std::int64_t batch_size);
+    void (*cscal_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                     std::complex<float> alpha,
+                                     cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                     std::int64_t stride_x, std::int64_t batch_size);
+    void (*zscal_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                     std::complex<double> alpha,
+                                     cl::sycl::buffer<std::complex<double>, 1> &x,
+                                     std::int64_t incx, std::int64_t stride_x,
+                                     std::int64_t batch_size);
+    void (*csscal_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                                      cl::sycl::buffer<std::complex<float>, 1> &x,
+                                      std::int64_t incx, std::int64_t stride_x,
+                                      std::int64_t batch_size);
+    void (*zdscal_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                                      cl::sycl::buffer<std::complex<double>, 1> &x,
+                                      std::int64_t incx, std::int64_t stride_x,
+                                      std::int64_t batch_size);
+    void (*hgemm_batch_group_offset_sycl)(
+        cl::sycl::queue &queue, cl::sycl::buffer<onemkl::transpose, 1> &transa,
+        cl::sycl::buffer<onemkl::transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+        cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+        cl::sycl::buffer<half, 1> &alpha, cl::sycl::buffer<half, 1> &a,
+        cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+        cl::sycl::buffer<half, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+        cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<half, 1> &beta,
+        cl::sycl::buffer<half, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+        cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+        cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*hgemm_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::transpose transa,
+                                     onemkl::transpose transb, std::int64_t m, std::int64_t n,
+                                     std::int64_t k, half alpha, cl::sycl::buffer<half, 1> &a,
+                                     std::int64_t lda, std::int64_t stride_a,
+                                     cl::sycl::buffer<half, 1> &b, std::int64_t ldb,
+                                     std::int64_t stride_b, half beta, cl::sycl::buffer<half, 1> &c,
+                                     std::int64_t ldc, std::int64_t stride_c,
+                                     std::int64_t batch_size);
+    void (*gemm_f16f16f32_batch_group_offset_sycl)(
+        cl::sycl::queue &queue, cl::sycl::buffer<onemkl::transpose, 1> &transa,
+        cl::sycl::buffer<onemkl::transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+        cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+        cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<half, 1> &a,
+        cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+        cl::sycl::buffer<half, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+        cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+        cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+        cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+        cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*gemm_f16f16f32_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::transpose transa,
+                                              onemkl::transpose transb, std::int64_t m,
+                                              std::int64_t n, std::int64_t k, float alpha,
+                                              cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+                                              std::int64_t stride_a, cl::sycl::buffer<half, 1> &b,
+                                              std::int64_t ldb, std::int64_t stride_b, float beta,
+                                              cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                              std::int64_t stride_c, std::int64_t batch_size);
+    void (*gemm_s8u8s32_batch_group_offset_sycl)(
+        cl::sycl::queue &queue, cl::sycl::buffer<onemkl::transpose, 1> &transa,
+        cl::sycl::buffer<onemkl::transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
+        cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
+        cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<int8_t, 1> &a,
+        cl::sycl::buffer<std::int64_t, 1> &lda, cl::sycl::buffer<std::int64_t, 1> &offset_a,
+        cl::sycl::buffer<uint8_t, 1> &b, cl::sycl::buffer<std::int64_t, 1> &ldb,
+        cl::sycl::buffer<std::int64_t, 1> &offset_b, cl::sycl::buffer<float, 1> &beta,
+        cl::sycl::buffer<int32_t, 1> &c, cl::sycl::buffer<std::int64_t, 1> &ldc,
+        cl::sycl::buffer<std::int64_t, 1> &offset_c, std::int64_t group_count,
+        cl::sycl::buffer<std::int64_t, 1> &group_size);
+    void (*gemm_s8u8s32_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::transpose transa,
+                                            onemkl::transpose transb, std::int64_t m,
+                                            std::int64_t n, std::int64_t k, float alpha,
+                                            cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda,
+                                            std::int64_t stride_a, cl::sycl::buffer<uint8_t, 1> &b,
+                                            std::int64_t ldb, std::int64_t stride_b, float beta,
+                                            cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                                            std::int64_t stride_c, std::int64_t batch_size);
+    void (*sgepack_compact_sycl)(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                                 cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, cl::sycl::buffer<float, 1> &ap,
+                                 std::int64_t ldap, std::int64_t batch_size);
+    void (*dgepack_compact_sycl)(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                                 cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, cl::sycl::buffer<double, 1> &ap,
+                                 std::int64_t ldap, std::int64_t batch_size);
+    void (*sgeunpack_compact_sycl)(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                                   cl::sycl::buffer<float, 1> &ap, std::int64_t ldap,
+                                   cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                   std::int64_t stride_a, std::int64_t batch_size);
+    void (*dgeunpack_compact_sycl)(cl::sycl::queue &queue, std::int64_t rows, std::int64_t cols,
+                                   cl::sycl::buffer<double, 1> &ap, std::int64_t ldap,
+                                   cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                   std::int64_t stride_a, std::int64_t batch_size);
+    void (*sgemm_compact_sycl)(cl::sycl::queue &queue, onemkl::transpose transa,
+                               onemkl::transpose transb, std::int64_t m, std::int64_t n,
+                               std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a,
+                               std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                               float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                               std::int64_t batch_size);
+    void (*dgemm_compact_sycl)(cl::sycl::queue &queue, onemkl::transpose transa,
+                               onemkl::transpose transb, std::int64_t m, std::int64_t n,
+                               std::int64_t k, double alpha, cl::sycl::buffer<double, 1> &a,
+                               std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                               double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                               std::int64_t batch_size);
+    void (*strsm_compact_sycl)(cl::sycl::queue &queue, onemkl::side left_right,
+                               onemkl::uplo upper_lower, onemkl::transpose trans,
+                               onemkl::diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
+                               cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                               cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                               std::int64_t batch_size);
+    void (*dtrsm_compact_sycl)(cl::sycl::queue &queue, onemkl::side left_right,
+                               onemkl::uplo upper_lower, onemkl::transpose trans,
+                               onemkl::diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
+                               cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                               cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                               std::int64_t batch_size);
+    void (*sgetrfnp_compact_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                  cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                  std::int64_t batch_size);
+    void (*dgetrfnp_compact_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                  cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                  std::int64_t batch_size);
+    void (*saxpby_sycl)(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                        cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                        cl::sycl::buffer<float, 1> &y, std::int64_t incy);
+    void (*daxpby_sycl)(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                        cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                        cl::sycl::buffer<double, 1> &y, std::int64_t incy);
+    void (*caxpby_sycl)(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                        std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
+                        std::int64_t incy);
+    void (*zaxpby_sycl)(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                        std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
+                        std::int64_t incy);
+    void (*simatcopy_sycl)(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m,
+                           std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &ab,
+                           std::int64_t lda, std::int64_t ldb);
+    void (*dimatcopy_sycl)(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m,
+                           std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &ab,
+                           std::int64_t lda, std::int64_t ldb);
+    void (*cimatcopy_sycl)(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m,
+                           std::int64_t n, std::complex<float> alpha,
+                           cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t lda,
+                           std::int64_t ldb);
+    void (*zimatcopy_sycl)(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m,
+                           std::int64_t n, std::complex<double> alpha,
+                           cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t lda,
+                           std::int64_t ldb);
+    void (*somatadd_sycl)(cl::sycl::queue &queue, onemkl::transpose transa,
+                          onemkl::transpose transb, std::int64_t m, std::int64_t n, float alpha,
+                          cl::sycl::buffer<float, 1> &a, std::int64_t lda, float beta,
+                          cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                          cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+    void (*domatadd_sycl)(cl::sycl::queue &queue, onemkl::transpose transa,
+                          onemkl::transpose transb, std::int64_t m, std::int64_t n, double alpha,
+                          cl::sycl::buffer<double, 1> &a, std::int64_t lda, double beta,
+                          cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                          cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
+    void (*comatadd_sycl)(cl::sycl::queue &queue, onemkl::transpose transa,
+                          onemkl::transpose transb, std::int64_t m, std::int64_t n,
+                          std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                          std::int64_t lda, std::complex<float> beta,
+                          cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                          cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+    void (*zomatadd_sycl)(cl::sycl::queue &queue, onemkl::transpose transa,
+                          onemkl::transpose transb, std::int64_t m, std::int64_t n,
+                          std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                          std::int64_t lda, std::complex<double> beta,
+                          cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                          cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+    void (*somatcopy_sycl)(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m,
+                           std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                           std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb);
+    void (*domatcopy_sycl)(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m,
+                           std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+                           std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t ldb);
+    void (*comatcopy_sycl)(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m,
+                           std::int64_t n, std::complex<float> alpha,
+                           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb);
+    void (*zomatcopy_sycl)(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m,
+                           std::int64_t n, std::complex<double> alpha,
+                           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb);
+    void (*simatcopy_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::transpose trans,
+                                         std::int64_t m, std::int64_t n, float alpha,
+                                         cl::sycl::buffer<float, 1> &ab, std::int64_t lda,
+                                         std::int64_t ldb, std::int64_t stride,
+                                         std::int64_t batch_size);
+    void (*dimatcopy_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::transpose trans,
+                                         std::int64_t m, std::int64_t n, double alpha,
+                                         cl::sycl::buffer<double, 1> &ab, std::int64_t lda,
+                                         std::int64_t ldb, std::int64_t stride,
+                                         std::int64_t batch_size);
+    void (*cimatcopy_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::transpose trans,
+                                         std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                                         cl::sycl::buffer<std::complex<float>, 1> &ab,
+                                         std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                                         std::int64_t batch_size);
+    void (*zimatcopy_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::transpose trans,
+                                         std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                                         cl::sycl::buffer<std::complex<double>, 1> &ab,
+                                         std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                                         std::int64_t batch_size);
+    void (*somatadd_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::transpose transa,
+                                        onemkl::transpose transb, std::int64_t m, std::int64_t n,
+                                        float alpha, cl::sycl::buffer<float, 1> &a,
+                                        std::int64_t lda, std::int64_t stride_a, float beta,
+                                        cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                        std::int64_t stride_b, cl::sycl::buffer<float, 1> &c,
+                                        std::int64_t ldc, std::int64_t stride_c,
+                                        std::int64_t batch_size);
+    void (*domatadd_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::transpose transa,
+                                        onemkl::transpose transb, std::int64_t m, std::int64_t n,
+                                        double alpha, cl::sycl::buffer<double, 1> &a,
+                                        std::int64_t lda, std::int64_t stride_a, double beta,
+                                        cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                        std::int64_t stride_b, cl::sycl::buffer<double, 1> &c,
+                                        std::int64_t ldc, std::int64_t stride_c,
+                                        std::int64_t batch_size);
+    void (*comatadd_batch_strided_sycl)(
+        cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb, std::int64_t m,
+        std::int64_t n, std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+        std::int64_t lda, std::int64_t stride_a, std::complex<float> beta,
+        cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+        cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+        std::int64_t batch_size);
+    void (*zomatadd_batch_strided_sycl)(
+        cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb, std::int64_t m,
+        std::int64_t n, std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+        std::int64_t lda, std::int64_t stride_a, std::complex<double> beta,
+        cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+        cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc, std::int64_t stride_c,
+        std::int64_t batch_size);
+    void (*somatcopy_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::transpose trans,
+                                         std::int64_t m, std::int64_t n, float alpha,
+                                         cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                         std::int64_t stride_a, cl::sycl::buffer<float, 1> &b,
+                                         std::int64_t ldb, std::int64_t stride_b,
+                                         std::int64_t batch_size);
+    void (*domatcopy_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::transpose trans,
+                                         std::int64_t m, std::int64_t n, double alpha,
+                                         cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                         std::int64_t stride_a, cl::sycl::buffer<double, 1> &b,
+                                         std::int64_t ldb, std::int64_t stride_b,
+                                         std::int64_t batch_size);
+    void (*comatcopy_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::transpose trans,
+                                         std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                                         cl::sycl::buffer<std::complex<float>, 1> &a,
+                                         std::int64_t lda, std::int64_t stride_a,
+                                         cl::sycl::buffer<std::complex<float>, 1> &b,
+                                         std::int64_t ldb, std::int64_t stride_b,
+                                         std::int64_t batch_size);
+    void (*zomatcopy_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::transpose trans,
+                                         std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                                         cl::sycl::buffer<std::complex<double>, 1> &a,
+                                         std::int64_t lda, std::int64_t stride_a,
+                                         cl::sycl::buffer<std::complex<double>, 1> &b,
+                                         std::int64_t ldb, std::int64_t stride_b,
+                                         std::int64_t batch_size);
+    void (*sasum_accumulation_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                    cl::sycl::buffer<float, 1> &result, onemkl::accumulation acc);
+    void (*sdot_accumulation_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                   cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                   cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                                   cl::sycl::buffer<float, 1> &result, onemkl::accumulation acc);
+    void (*snrm2_accumulation_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                    cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                    cl::sycl::buffer<float, 1> &result, onemkl::accumulation acc);
+    void (*saxpbypcz_sycl)(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                           cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                           cl::sycl::buffer<float, 1> &y, std::int64_t incy, float gamma,
+                           cl::sycl::buffer<float, 1> &z, std::int64_t incz);
+    void (*daxpbypcz_sycl)(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                           cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                           cl::sycl::buffer<double, 1> &y, std::int64_t incy, double gamma,
+                           cl::sycl::buffer<double, 1> &z, std::int64_t incz);
+    void (*saxpbypcz_dot_sycl)(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                               cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                               cl::sycl::buffer<float, 1> &y, std::int64_t incy, float gamma,
+                               cl::sycl::buffer<float, 1> &z, std::int64_t incz,
+                               cl::sycl::buffer<float, 1> &w, std::int64_t incw,
+                               cl::sycl::buffer<float, 1> &result);
+    void (*daxpbypcz_dot_sycl)(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                               cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                               cl::sycl::buffer<double, 1> &y, std::int64_t incy, double gamma,
+                               cl::sycl::buffer<double, 1> &z, std::int64_t incz,
+                               cl::sycl::buffer<double, 1> &w, std::int64_t incw,
+                               cl::sycl::buffer<double, 1> &result);
+    cl::sycl::event (*scasum_host_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                        cl::sycl::buffer<std::complex<float>, 1> &x,
+                                        std::int64_t incx, float *result);
+    cl::sycl::event (*dzasum_host_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                        cl::sycl::buffer<std::complex<double>, 1> &x,
+                                        std::int64_t incx, double *result);
+    cl::sycl::event (*sasum_host_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                       cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                       float *result);
+    cl::sycl::event (*dasum_host_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                       cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                       double *result);
+    cl::sycl::event (*sdot_host_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                      cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                      cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                                      float *result);
+    cl::sycl::event (*ddot_host_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                      cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                      cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                                      double *result);
+    cl::sycl::event (*dsdot_host_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                       cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                       cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                                       double *result);
+    cl::sycl::event (*isamin_host_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                       cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                       std::int64_t *result);
+    cl::sycl::event (*idamin_host_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                       cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                       std::int64_t *result);
+    cl::sycl::event (*icamin_host_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                       cl::sycl::buffer<std::complex<float>, 1> &x,
+                                       std::int64_t incx, std::int64_t *result);
+    cl::sycl::event (*izamin_host_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                       cl::sycl::buffer<std::complex<double>, 1> &x,
+                                       std::int64_t incx, std::int64_t *result);
+    cl::sycl::event (*isamax_host_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                       cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                       std::int64_t *result);
+    cl::sycl::event (*idamax_host_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                       cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                       std::int64_t *result);
+    cl::sycl::event (*icamax_host_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                       cl::sycl::buffer<std::complex<float>, 1> &x,
+                                       std::int64_t incx, std::int64_t *result);
+    cl::sycl::event (*izamax_host_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                       cl::sycl::buffer<std::complex<double>, 1> &x,
+                                       std::int64_t incx, std::int64_t *result);
+    cl::sycl::event (*snrm2_host_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                       cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                       float *result);
+    cl::sycl::event (*dnrm2_host_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                       cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                       double *result);
+    cl::sycl::event (*scnrm2_host_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                        cl::sycl::buffer<std::complex<float>, 1> &x,
+                                        std::int64_t incx, float *result);
+    cl::sycl::event (*dznrm2_host_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                        cl::sycl::buffer<std::complex<double>, 1> &x,
+                                        std::int64_t incx, double *result);
+    void (*sgbtge_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                        std::int64_t ku, cl::sycl::buffer<float, 1> &ab, std::int64_t ldab,
+                        cl::sycl::buffer<float, 1> &a, std::int64_t lda);
+    void (*dgbtge_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                        std::int64_t ku, cl::sycl::buffer<double, 1> &ab, std::int64_t ldab,
+                        cl::sycl::buffer<double, 1> &a, std::int64_t lda);
+    void (*cgbtge_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                        std::int64_t ku, cl::sycl::buffer<std::complex<float>, 1> &ab,
+                        std::int64_t ldab, cl::sycl::buffer<std::complex<float>, 1> &a,
+                        std::int64_t lda);
+    void (*zgbtge_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                        std::int64_t ku, cl::sycl::buffer<std::complex<double>, 1> &ab,
+                        std::int64_t ldab, cl::sycl::buffer<std::complex<double>, 1> &a,
+                        std::int64_t lda);
+    void (*sgettgb_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                         std::int64_t ku, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                         cl::sycl::buffer<float, 1> &ab, std::int64_t ldab);
+    void (*dgettgb_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                         std::int64_t ku, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                         cl::sycl::buffer<double, 1> &ab, std::int64_t ldab);
+    void (*cgettgb_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                         std::int64_t ku, cl::sycl::buffer<std::complex<float>, 1> &a,
+                         std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &ab,
+                         std::int64_t ldab);
+    void (*zgettgb_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                         std::int64_t ku, cl::sycl::buffer<std::complex<double>, 1> &a,
+                         std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &ab,
+                         std::int64_t ldab);
+    void (*stpttr_sycl)(cl::sycl::queue &queue, onemkl::uplo upper_lower, std::int64_t n,
+                        cl::sycl::buffer<float, 1> &ap, cl::sycl::buffer<float, 1> &a,
+                        std::int64_t lda);
+    void (*dtpttr_sycl)(cl::sycl::queue &queue, onemkl::uplo upper_lower, std::int64_t n,
+                        cl::sycl::buffer<double, 1> &ap, cl::sycl::buffer<double, 1> &a,
+                        std::int64_t lda);
+    void (*ctpttr_sycl)(cl::sycl::queue &queue, onemkl::uplo upper_lower, std::int64_t n,
+                        cl::sycl::buffer<std::complex<float>, 1> &ap,
+                        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda);
+    void (*ztpttr_sycl)(cl::sycl::queue &queue, onemkl::uplo upper_lower, std::int64_t n,
+                        cl::sycl::buffer<std::complex<double>, 1> &ap,
+                        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda);
+    void (*strttp_sycl)(cl::sycl::queue &queue, onemkl::uplo upper_lower, std::int64_t n,
+                        cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<float, 1> &ap);
+    void (*dtrttp_sycl)(cl::sycl::queue &queue, onemkl::uplo upper_lower, std::int64_t n,
+                        cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<double, 1> &ap);
+    void (*ctrttp_sycl)(cl::sycl::queue &queue, onemkl::uplo upper_lower, std::int64_t n,
+                        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<std::complex<float>, 1> &ap);
+    void (*ztrttp_sycl)(cl::sycl::queue &queue, onemkl::uplo upper_lower, std::int64_t n,
+                        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<std::complex<double>, 1> &ap);
+    void (*sgbtge_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                      std::int64_t kl, std::int64_t ku,
+                                      cl::sycl::buffer<float, 1> &ab, std::int64_t ldab,
+                                      std::int64_t stride_ab, cl::sycl::buffer<float, 1> &a,
+                                      std::int64_t lda, std::int64_t stride_a,
+                                      std::int64_t batch_size);
+    void (*dgbtge_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                      std::int64_t kl, std::int64_t ku,
+                                      cl::sycl::buffer<double, 1> &ab, std::int64_t ldab,
+                                      std::int64_t stride_ab, cl::sycl::buffer<double, 1> &a,
+                                      std::int64_t lda, std::int64_t stride_a,
+                                      std::int64_t batch_size);
+    void (*cgbtge_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                      std::int64_t kl, std::int64_t ku,
+                                      cl::sycl::buffer<std::complex<float>, 1> &ab,
+                                      std::int64_t ldab, std::int64_t stride_ab,
+                                      cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                      std::int64_t stride_a, std::int64_t batch_size);
+    void (*zgbtge_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                      std::int64_t kl, std::int64_t ku,
+                                      cl::sycl::buffer<std::complex<double>, 1> &ab,
+                                      std::int64_t ldab, std::int64_t stride_ab,
+                                      cl::sycl::buffer<std::complex<double>, 1> &a,
+                                      std::int64_t lda, std::int64_t stride_a,
+                                      std::int64_t batch_size);
+    void (*sgettgb_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                       std::int64_t kl, std::int64_t ku,
+                                       cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                       std::int64_t stride_a, cl::sycl::buffer<float, 1> &ab,
+                                       std::int64_t ldab, std::int64_t stride_ab,
+                                       std::int64_t batch_size);
+    void (*dgettgb_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                       std::int64_t kl, std::int64_t ku,
+                                       cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                       std::int64_t stride_a, cl::sycl::buffer<double, 1> &ab,
+                                       std::int64_t ldab, std::int64_t stride_ab,
+                                       std::int64_t batch_size);
+    void (*cgettgb_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                       std::int64_t kl, std::int64_t ku,
+                                       cl::sycl::buffer<std::complex<float>, 1> &a,
+                                       std::int64_t lda, std::int64_t stride_a,
+                                       cl::sycl::buffer<std::complex<float>, 1> &ab,
+                                       std::int64_t ldab, std::int64_t stride_ab,
+                                       std::int64_t batch_size);
+    void (*zgettgb_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                       std::int64_t kl, std::int64_t ku,
+                                       cl::sycl::buffer<std::complex<double>, 1> &a,
+                                       std::int64_t lda, std::int64_t stride_a,
+                                       cl::sycl::buffer<std::complex<double>, 1> &ab,
+                                       std::int64_t ldab, std::int64_t stride_ab,
+                                       std::int64_t batch_size);
+    void (*stpttr_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::uplo upper_lower,
+                                      std::int64_t n, cl::sycl::buffer<float, 1> &ap,
+                                      std::int64_t stride_ap, cl::sycl::buffer<float, 1> &a,
+                                      std::int64_t lda, std::int64_t stride_a,
+                                      std::int64_t batch_size);
+    void (*dtpttr_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::uplo upper_lower,
+                                      std::int64_t n, cl::sycl::buffer<double, 1> &ap,
+                                      std::int64_t stride_ap, cl::sycl::buffer<double, 1> &a,
+                                      std::int64_t lda, std::int64_t stride_a,
+                                      std::int64_t batch_size);
+    void (*ctpttr_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::uplo upper_lower,
+                                      std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &ap,
+                                      std::int64_t stride_ap,
+                                      cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                      std::int64_t stride_a, std::int64_t batch_size);
+    void (*ztpttr_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::uplo upper_lower,
+                                      std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &ap,
+                                      std::int64_t stride_ap,
+                                      cl::sycl::buffer<std::complex<double>, 1> &a,
+                                      std::int64_t lda, std::int64_t stride_a,
+                                      std::int64_t batch_size);
+    void (*strttp_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::uplo upper_lower,
+                                      std::int64_t n, cl::sycl::buffer<float, 1> &a,
+                                      std::int64_t lda, std::int64_t stride_a,
+                                      cl::sycl::buffer<float, 1> &ap, std::int64_t stride_ap,
+                                      std::int64_t batch_size);
+    void (*dtrttp_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::uplo upper_lower,
+                                      std::int64_t n, cl::sycl::buffer<double, 1> &a,
+                                      std::int64_t lda, std::int64_t stride_a,
+                                      cl::sycl::buffer<double, 1> &ap, std::int64_t stride_ap,
+                                      std::int64_t batch_size);
+    void (*ctrttp_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::uplo upper_lower,
+                                      std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
+                                      std::int64_t lda, std::int64_t stride_a,
+                                      cl::sycl::buffer<std::complex<float>, 1> &ap,
+                                      std::int64_t stride_ap, std::int64_t batch_size);
+    void (*ztrttp_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::uplo upper_lower,
+                                      std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &a,
+                                      std::int64_t lda, std::int64_t stride_a,
+                                      cl::sycl::buffer<std::complex<double>, 1> &ap,
+                                      std::int64_t stride_ap, std::int64_t batch_size);
+    void (*gemv_f16f32_sycl)(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m,
+                             std::int64_t n, float alpha, cl::sycl::buffer<half, 1> &a,
+                             std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                             float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy);
+    void (*gemv_bf16f32_sycl)(cl::sycl::queue &queue, onemkl::transpose trans, std::int64_t m,
+                              std::int64_t n, float alpha, cl::sycl::buffer<onemkl::bfloat16, 1> &a,
+                              std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                              float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy);
+    void (*gemv_f16f32_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::transpose trans,
+                                           std::int64_t m, std::int64_t n, float alpha,
+                                           cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+                                           std::int64_t stride_a, cl::sycl::buffer<float, 1> &x,
+                                           std::int64_t incx, std::int64_t stride_x, float beta,
+                                           cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                                           std::int64_t stride_y, std::int64_t batch_size);
+    void (*gemv_bf16f32_batch_strided_sycl)(cl::sycl::queue &queue, onemkl::transpose trans,
+                                            std::int64_t m, std::int64_t n, float alpha,
+                                            cl::sycl::buffer<onemkl::bfloat16, 1> &a,
+                                            std::int64_t lda, std::int64_t stride_a,
+                                            cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                            std::int64_t stride_x, float beta,
+                                            cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                                            std::int64_t stride_y, std::int64_t batch_size);
+    void (*slange_sycl)(cl::sycl::queue &queue, onemkl::norm_type norm, onemkl::transpose trans,
+                        std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a,
+                        std::int64_t lda, cl::sycl::buffer<float, 1> &result);
+    void (*dlange_sycl)(cl::sycl::queue &queue, onemkl::norm_type norm, onemkl::transpose trans,
+                        std::int64_t m, std::int64_t n, cl::sycl::buffer<double, 1> &a,
+                        std::int64_t lda, cl::sycl::buffer<double, 1> &result);
+    void (*sreduce_columns_sycl)(cl::sycl::queue &queue, onemkl::reduction op,
+                                 onemkl::transpose trans, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                 cl::sycl::buffer<float, 1> &y, std::int64_t incy);
+    void (*dreduce_columns_sycl)(cl::sycl::queue &queue, onemkl::reduction op,
+                                 onemkl::transpose trans, std::int64_t m, std::int64_t n,
+                                 cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                 cl::sycl::buffer<double, 1> &y, std::int64_t incy);
+    void (*sreduce_rows_sycl)(cl::sycl::queue &queue, onemkl::reduction op, onemkl::transpose trans,
+                              std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a,
+                              std::int64_t lda, cl::sycl::buffer<float, 1> &y, std::int64_t incy);
+    void (*dreduce_rows_sycl)(cl::sycl::queue &queue, onemkl::reduction op, onemkl::transpose trans,
+                              std::int64_t m, std::int64_t n, cl::sycl::buffer<double, 1> &a,
+                              std::int64_t lda, cl::sycl::buffer<double, 1> &y, std::int64_t incy);
+    void (*somatclamp_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float lo,
+                            float hi, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                            cl::sycl::buffer<float, 1> &b, std::int64_t ldb);
+    void (*domatclamp_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, double lo,
+                            double hi, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                            cl::sycl::buffer<double, 1> &b, std::int64_t ldb);
+    void (*somatclamp_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                          float lo, float hi, cl::sycl::buffer<float, 1> &a,
+                                          std::int64_t lda, std::int64_t stride_a,
+                                          cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                          std::int64_t stride_b, std::int64_t batch_size);
+    void (*domatclamp_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                          double lo, double hi, cl::sycl::buffer<double, 1> &a,
+                                          std::int64_t lda, std::int64_t stride_a,
+                                          cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                          std::int64_t stride_b, std::int64_t batch_size);
+    void (*somatdiv_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                          cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                          cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                          cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+    void (*domatdiv_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                          cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                          cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                          cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
+    void (*comatdiv_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                          cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                          cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                          cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+    void (*zomatdiv_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                          cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                          cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                          cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+    void (*somatdiv_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                        cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                        std::int64_t stride_a, cl::sycl::buffer<float, 1> &b,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                        std::int64_t stride_c, std::int64_t batch_size);
+    void (*domatdiv_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                        cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                        std::int64_t stride_a, cl::sycl::buffer<double, 1> &b,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                        std::int64_t stride_c, std::int64_t batch_size);
+    void (*comatdiv_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                        cl::sycl::buffer<std::complex<float>, 1> &a,
+                                        std::int64_t lda, std::int64_t stride_a,
+                                        cl::sycl::buffer<std::complex<float>, 1> &b,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        cl::sycl::buffer<std::complex<float>, 1> &c,
+                                        std::int64_t ldc, std::int64_t stride_c,
+                                        std::int64_t batch_size);
+    void (*zomatdiv_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                        cl::sycl::buffer<std::complex<double>, 1> &a,
+                                        std::int64_t lda, std::int64_t stride_a,
+                                        cl::sycl::buffer<std::complex<double>, 1> &b,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        cl::sycl::buffer<std::complex<double>, 1> &c,
+                                        std::int64_t ldc, std::int64_t stride_c,
+                                        std::int64_t batch_size);
+    void (*somatfma_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float alpha,
+                          cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                          cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+                          cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+    void (*domatfma_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, double alpha,
+                          cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                          cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+                          cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
+    void (*comatfma_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                          std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                          std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
+                          std::int64_t ldb, std::complex<float> beta,
+                          cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+    void (*zomatfma_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                          std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                          std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
+                          std::int64_t ldb, std::complex<double> beta,
+                          cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+    void (*somatfma_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                        float alpha, cl::sycl::buffer<float, 1> &a,
+                                        std::int64_t lda, std::int64_t stride_a,
+                                        cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                        std::int64_t stride_b, float beta,
+                                        cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                        std::int64_t stride_c, std::int64_t batch_size);
+    void (*domatfma_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                        double alpha, cl::sycl::buffer<double, 1> &a,
+                                        std::int64_t lda, std::int64_t stride_a,
+                                        cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                        std::int64_t stride_b, double beta,
+                                        cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                        std::int64_t stride_c, std::int64_t batch_size);
+    void (*comatfma_batch_strided_sycl)(
+        cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<float> alpha,
+        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda, std::int64_t stride_a,
+        cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+        std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+        std::int64_t stride_c, std::int64_t batch_size);
+    void (*zomatfma_batch_strided_sycl)(
+        cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<double> alpha,
+        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda, std::int64_t stride_a,
+        cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+        std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+        std::int64_t stride_c, std::int64_t batch_size);
+    void (*somatmul_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                          cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                          cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                          cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+    void (*domatmul_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                          cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                          cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                          cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
+    void (*comatmul_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                          cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                          cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                          cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+    void (*zomatmul_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                          cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                          cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                          cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+    void (*somatmul_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                        cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                        std::int64_t stride_a, cl::sycl::buffer<float, 1> &b,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                        std::int64_t stride_c, std::int64_t batch_size);
+    void (*domatmul_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                        cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                        std::int64_t stride_a, cl::sycl::buffer<double, 1> &b,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                        std::int64_t stride_c, std::int64_t batch_size);
+    void (*comatmul_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                        cl::sycl::buffer<std::complex<float>, 1> &a,
+                                        std::int64_t lda, std::int64_t stride_a,
+                                        cl::sycl::buffer<std::complex<float>, 1> &b,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        cl::sycl::buffer<std::complex<float>, 1> &c,
+                                        std::int64_t ldc, std::int64_t stride_c,
+                                        std::int64_t batch_size);
+    void (*zomatmul_batch_strided_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                        cl::sycl::buffer<std::complex<double>, 1> &a,
+                                        std::int64_t lda, std::int64_t stride_a,
+                                        cl::sycl::buffer<std::complex<double>, 1> &b,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        cl::sycl::buffer<std::complex<double>, 1> &c,
+                                        std::int64_t ldc, std::int64_t stride_c,
+                                        std::int64_t batch_size);
+    void (*svclamp_sycl)(cl::sycl::queue &queue, std::int64_t n, float lo, float hi,
+                         cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                         cl::sycl::buffer<float, 1> &y, std::int64_t incy);
+    void (*dvclamp_sycl)(cl::sycl::queue &queue, std::int64_t n, double lo, double hi,
+                         cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                         cl::sycl::buffer<double, 1> &y, std::int64_t incy);
+    void (*svdiv_sycl)(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                       std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                       cl::sycl::buffer<float, 1> &z, std::int64_t incz);
+    void (*dvdiv_sycl)(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                       std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                       cl::sycl::buffer<double, 1> &z, std::int64_t incz);
+    void (*cvdiv_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                       cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                       cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                       cl::sycl::buffer<std::complex<float>, 1> &z, std::int64_t incz);
+    void (*zvdiv_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                       cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                       cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                       cl::sycl::buffer<std::complex<double>, 1> &z, std::int64_t incz);
+    void (*svfma_sycl)(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                       cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                       cl::sycl::buffer<float, 1> &y, std::int64_t incy, float beta,
+                       cl::sycl::buffer<float, 1> &z, std::int64_t incz);
+    void (*dvfma_sycl)(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                       cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                       cl::sycl::buffer<double, 1> &y, std::int64_t incy, double beta,
+                       cl::sycl::buffer<double, 1> &z, std::int64_t incz);
+    void (*cvfma_sycl)(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                       cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                       cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                       std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &z,
+                       std::int64_t incz);
+    void (*zvfma_sycl)(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                       cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                       cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                       std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &z,
+                       std::int64_t incz);
+    void (*svmul_sycl)(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                       std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                       cl::sycl::buffer<float, 1> &z, std::int64_t incz);
+    void (*dvmul_sycl)(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
+                       std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                       cl::sycl::buffer<double, 1> &z, std::int64_t incz);
+    void (*cvmul_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                       cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                       cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                       cl::sycl::buffer<std::complex<float>, 1> &z, std::int64_t incz);
+    void (*zvmul_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                       cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                       cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                       cl::sycl::buffer<std::complex<double>, 1> &z, std::int64_t incz);
+    void (*cgemm3m_sycl)(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+                         std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                         cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                         std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+                         std::int64_t ldc);
+    void (*zgemm3m_sycl)(cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb,
+                         std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                         cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                         std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+                         std::int64_t ldc);
+    void (*cgemm3m_batch_strided_sycl)(
+        cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb, std::int64_t m,
+        std::int64_t n, std::int64_t k, std::complex<float> alpha,
+        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda, std::int64_t stride_a,
+        cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+        std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+        std::int64_t stride_c, std::int64_t batch_size);
+    void (*zgemm3m_batch_strided_sycl)(
+        cl::sycl::queue &queue, onemkl::transpose transa, onemkl::transpose transb, std::int64_t m,
+        std::int64_t n, std::int64_t k, std::complex<double> alpha,
+        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda, std::int64_t stride_a,
+        cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::int64_t stride_b,
+        std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+        std::int64_t stride_c, std::int64_t batch_size);
 } function_table_t;
 
 #endif //_BLAS_FUNCTION_TABLE_HPP_
@@ -0,0 +1,166 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// The second group always uses unit increments, the first one takes its
+// parameters from the test.
+template <typename fp>
+bool test(const device& dev, int incx, int incy, fp alpha) {
+    // Batched axpy is not implemented by the mklgpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare the group configuration.
+    const int64_t group_count = 2;
+    vector<int64_t> n = { 1357, 63 }, incx_array = { incx, 1 }, incy_array = { incy, 1 };
+    vector<int64_t> group_size = { 3, 4 };
+    vector<fp> alpha_array = { alpha, fp(-1.0) };
+
+    // Vectors of the groups are stored back to back.
+    vector<fp, allocator_helper<fp, 64>> x, y, y_ref;
+    vector<int64_t> offset_x, offset_y;
+    for (int64_t i = 0; i < group_count; i++) {
+        for (int64_t j = 0; j < group_size[i]; j++) {
+            offset_x.push_back(x.size());
+            offset_y.push_back(y.size());
+            x.resize(x.size() + 1 + (n[i] - 1) * std::abs(incx_array[i]));
+            y.resize(y.size() + 1 + (n[i] - 1) * std::abs(incy_array[i]));
+        }
+    }
+    for (auto& v : x)
+        v = rand_scalar<fp>();
+    for (auto& v : y)
+        v = rand_scalar<fp>();
+    y_ref = y;
+
+    // Call Reference AXPY on every vector of the batch.
+    using fp_ref = typename ref_type_info<fp>::type;
+
+    for (int64_t i = 0, idx = 0; i < group_count; i++) {
+        const int N_ref = n[i], incx_ref = incx_array[i], incy_ref = incy_array[i];
+        for (int64_t j = 0; j < group_size[i]; j++, idx++) {
+            ::axpy(&N_ref, (fp_ref*)&alpha_array[i], (fp_ref*)x.data() + offset_x[idx], &incx_ref,
+                   (fp_ref*)y_ref.data() + offset_y[idx], &incy_ref);
+        }
+    }
+
+    // Call DPC++ AXPY_BATCH.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during AXPY_BATCH:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<int64_t, 1> n_buffer(n.data(), range<1>(group_count));
+    buffer<int64_t, 1> incx_buffer(incx_array.data(), range<1>(group_count));
+    buffer<int64_t, 1> incy_buffer(incy_array.data(), range<1>(group_count));
+    buffer<int64_t, 1> group_size_buffer(group_size.data(), range<1>(group_count));
+    buffer<fp, 1> alpha_buffer(alpha_array.data(), range<1>(group_count));
+    buffer<fp, 1> x_buffer(x.data(), range<1>(x.size()));
+    buffer<fp, 1> y_buffer(y.data(), range<1>(y.size()));
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::axpy_batch(main_queue, n_buffer, alpha_buffer, x_buffer, incx_buffer,
+                                 y_buffer, incy_buffer, group_count, group_size_buffer);
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::axpy_batch,
+                    (main_queue, n_buffer, alpha_buffer, x_buffer, incx_buffer, y_buffer,
+                     incy_buffer, group_count, group_size_buffer));
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during AXPY_BATCH:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good;
+    {
+        auto y_accessor = y_buffer.template get_access<access::mode::read>();
+        good            = check_equal_vector(y_accessor, y_ref, y.size(), 1, n[0], std::cout);
+    }
+
+    return good;
+}
+
+class AxpyBatchGroupTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(AxpyBatchGroupTests, RealSinglePrecision) {
+    float alpha(2.0);
+    EXPECT_TRUE(test<float>(GetParam(), 2, 3, alpha));
+    EXPECT_TRUE(test<float>(GetParam(), -2, -3, alpha));
+}
+TEST_P(AxpyBatchGroupTests, RealDoublePrecision) {
+    double alpha(2.0);
+    EXPECT_TRUE(test<double>(GetParam(), 2, 3, alpha));
+    EXPECT_TRUE(test<double>(GetParam(), -2, -3, alpha));
+}
+TEST_P(AxpyBatchGroupTests, ComplexSinglePrecision) {
+    std::complex<float> alpha(2.0, -0.5);
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), 2, 3, alpha));
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), -2, -3, alpha));
+}
+TEST_P(AxpyBatchGroupTests, ComplexDoublePrecision) {
+    std::complex<double> alpha(2.0, -0.5);
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), 2, 3, alpha));
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), -2, -3, alpha));
+}
+
+INSTANTIATE_TEST_SUITE_P(AxpyBatchGroupTestSuite, AxpyBatchGroupTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,184 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// Reference DGMM: C = diag(x) * A or C = A * diag(x).
+template <typename fp>
+void ref_dgmm(onemkl::side left_right, int m, int n, const fp* A, int lda, const fp* x, int incx,
+              fp* C, int ldc) {
+    const int len_x = (left_right == onemkl::side::left) ? m : n;
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < m; i++) {
+            const int l  = (left_right == onemkl::side::left) ? i : j;
+            const fp x_l = x[(incx > 0) ? l * incx : (len_x - 1 - l) * -incx];
+            C[i + ldc * j] = x_l * A[i + lda * j];
+        }
+    }
+}
+
+// The second group always scales the columns with a unit increment, the first
+// one takes its parameters from the test.
+template <typename fp>
+bool test(const device& dev, onemkl::side left_right, int incx) {
+    // Batched dgmm is not implemented by the mklgpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare the group configuration.
+    const int64_t group_count = 2;
+    vector<onemkl::side> side = { left_right, onemkl::side::right };
+    vector<int64_t> m = { 25, 9 }, n = { 30, 14 }, lda = { 42, 11 }, ldc = { 27, 9 };
+    vector<int64_t> incx_array = { incx, 1 };
+    vector<int64_t> group_size = { 3, 5 };
+
+    // Operands of the groups are stored back to back.
+    vector<fp, allocator_helper<fp, 64>> A, x, C, C_ref;
+    vector<int64_t> offset_a, offset_x, offset_c;
+    for (int64_t i = 0; i < group_count; i++) {
+        const int x_len = (side[i] == onemkl::side::left) ? m[i] : n[i];
+        for (int64_t j = 0; j < group_size[i]; j++) {
+            offset_a.push_back(A.size());
+            offset_x.push_back(x.size());
+            offset_c.push_back(C.size());
+            A.resize(A.size() + lda[i] * n[i]);
+            x.resize(x.size() + 1 + (x_len - 1) * std::abs(incx_array[i]));
+            C.resize(C.size() + ldc[i] * n[i]);
+            rand_matrix(A.data() + offset_a.back(), onemkl::transpose::nontrans, m[i], n[i],
+                        lda[i]);
+        }
+    }
+    for (auto& v : x)
+        v = rand_scalar<fp>();
+    for (auto& v : C)
+        v = rand_scalar<fp>();
+    C_ref = C;
+
+    // Call Reference DGMM on every problem of the batch.
+    for (int64_t i = 0, idx = 0; i < group_count; i++) {
+        for (int64_t j = 0; j < group_size[i]; j++, idx++) {
+            ref_dgmm(side[i], m[i], n[i], A.data() + offset_a[idx], lda[i],
+                     x.data() + offset_x[idx], incx_array[i], C_ref.data() + offset_c[idx],
+                     ldc[i]);
+        }
+    }
+
+    // Call DPC++ DGMM_BATCH.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during DGMM_BATCH:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<onemkl::side, 1> side_buffer(side.data(), range<1>(group_count));
+    buffer<int64_t, 1> m_buffer(m.data(), range<1>(group_count));
+    buffer<int64_t, 1> n_buffer(n.data(), range<1>(group_count));
+    buffer<int64_t, 1> lda_buffer(lda.data(), range<1>(group_count));
+    buffer<int64_t, 1> incx_buffer(incx_array.data(), range<1>(group_count));
+    buffer<int64_t, 1> ldc_buffer(ldc.data(), range<1>(group_count));
+    buffer<int64_t, 1> group_size_buffer(group_size.data(), range<1>(group_count));
+    buffer<fp, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<fp, 1> x_buffer(x.data(), range<1>(x.size()));
+    buffer<fp, 1> C_buffer(C.data(), range<1>(C.size()));
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::dgmm_batch(main_queue, side_buffer, m_buffer, n_buffer, A_buffer,
+                                 lda_buffer, x_buffer, incx_buffer, C_buffer, ldc_buffer,
+                                 group_count, group_size_buffer);
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::dgmm_batch,
+                    (main_queue, side_buffer, m_buffer, n_buffer, A_buffer, lda_buffer, x_buffer,
+                     incx_buffer, C_buffer, ldc_buffer, group_count, group_size_buffer));
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during DGMM_BATCH:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good;
+    {
+        auto C_accessor = C_buffer.template get_access<access::mode::read>();
+        good            = check_equal_vector(C_accessor, C_ref, C.size(), 1, 1, std::cout);
+    }
+
+    return good;
+}
+
+class DgmmBatchGroupTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(DgmmBatchGroupTests, RealSinglePrecision) {
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::side::left, 2));
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::side::right, -3));
+}
+TEST_P(DgmmBatchGroupTests, RealDoublePrecision) {
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::side::left, 2));
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::side::right, -3));
+}
+TEST_P(DgmmBatchGroupTests, ComplexSinglePrecision) {
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::side::left, 2));
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::side::right, -3));
+}
+TEST_P(DgmmBatchGroupTests, ComplexDoublePrecision) {
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::side::left, 2));
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::side::right, -3));
+}
+
+INSTANTIATE_TEST_SUITE_P(DgmmBatchGroupTestSuite, DgmmBatchGroupTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,166 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// Reference DGMM: C = diag(x) * A or C = A * diag(x).
+template <typename fp>
+void ref_dgmm(onemkl::side left_right, int m, int n, const fp* A, int lda, const fp* x, int incx,
+              fp* C, int ldc) {
+    const int len_x = (left_right == onemkl::side::left) ? m : n;
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < m; i++) {
+            const int l  = (left_right == onemkl::side::left) ? i : j;
+            const fp x_l = x[(incx > 0) ? l * incx : (len_x - 1 - l) * -incx];
+            C[i + ldc * j] = x_l * A[i + lda * j];
+        }
+    }
+}
+
+template <typename fp>
+bool test(const device& dev, onemkl::side left_right, int m, int n, int lda, int incx, int ldc,
+          int batch_size) {
+    // Batched dgmm is not implemented by the mklgpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data.
+    const int x_len        = (left_right == onemkl::side::left) ? m : n;
+    const int64_t stride_a = lda * n + 3;
+    const int64_t stride_x = x_len * std::abs(incx) + 2;
+    const int64_t stride_c = ldc * n + 1;
+    vector<fp, allocator_helper<fp, 64>> A(stride_a * batch_size), x(stride_x * batch_size),
+        C(stride_c * batch_size), C_ref;
+    for (auto& v : x)
+        v = rand_scalar<fp>();
+    for (auto& v : C)
+        v = rand_scalar<fp>();
+    for (int i = 0; i < batch_size; i++)
+        rand_matrix(A.data() + stride_a * i, onemkl::transpose::nontrans, m, n, lda);
+    C_ref = C;
+
+    // Call Reference DGMM on every problem of the batch.
+    for (int i = 0; i < batch_size; i++) {
+        ref_dgmm(left_right, m, n, A.data() + stride_a * i, lda, x.data() + stride_x * i, incx,
+                 C_ref.data() + stride_c * i, ldc);
+    }
+
+    // Call DPC++ DGMM_BATCH.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during DGMM_BATCH:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<fp, 1> x_buffer(x.data(), range<1>(x.size()));
+    buffer<fp, 1> C_buffer(C.data(), range<1>(C.size()));
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::dgmm_batch(main_queue, left_right, m, n, A_buffer, lda, stride_a, x_buffer,
+                                 incx, stride_x, C_buffer, ldc, stride_c, batch_size);
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::dgmm_batch,
+                    (main_queue, left_right, m, n, A_buffer, lda, stride_a, x_buffer, incx,
+                     stride_x, C_buffer, ldc, stride_c, batch_size));
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during DGMM_BATCH:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good;
+    {
+        auto C_accessor = C_buffer.template get_access<access::mode::read>();
+        good            = check_equal_vector(C_accessor, C_ref, C.size(), 1, 1, std::cout);
+    }
+
+    return good;
+}
+
+class DgmmBatchStrideTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(DgmmBatchStrideTests, RealSinglePrecision) {
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::side::left, 25, 30, 42, 2, 27, 7));
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::side::right, 25, 30, 42, -3, 27, 7));
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::side::left, 25, 30, 42, -1, 27, 7));
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::side::right, 25, 30, 42, 1, 25, 7));
+}
+TEST_P(DgmmBatchStrideTests, RealDoublePrecision) {
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::side::left, 25, 30, 42, 2, 27, 7));
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::side::right, 25, 30, 42, -3, 27, 7));
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::side::left, 25, 30, 42, -1, 27, 7));
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::side::right, 25, 30, 42, 1, 25, 7));
+}
+TEST_P(DgmmBatchStrideTests, ComplexSinglePrecision) {
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::side::left, 25, 30, 42, 2, 27, 7));
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::side::right, 25, 30, 42, -3, 27, 7));
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::side::left, 25, 30, 42, -1, 27, 7));
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::side::right, 25, 30, 42, 1, 25, 7));
+}
+TEST_P(DgmmBatchStrideTests, ComplexDoublePrecision) {
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::side::left, 25, 30, 42, 2, 27, 7));
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::side::right, 25, 30, 42, -3, 27, 7));
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::side::left, 25, 30, 42, -1, 27, 7));
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::side::right, 25, 30, 42, 1, 25, 7));
+}
+
+INSTANTIATE_TEST_SUITE_P(DgmmBatchStrideTestSuite, DgmmBatchStrideTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
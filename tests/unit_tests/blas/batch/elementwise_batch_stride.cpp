@@ -0,0 +1,232 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// Catch asynchronous exceptions.
+auto exception_handler = [](exception_list exceptions) {
+    for (std::exception_ptr const& e : exceptions) {
+        try {
+            std::rethrow_exception(e);
+        }
+        catch (exception const& e) {
+            std::cout << "Caught asynchronous SYCL exception during ELEMENTWISE_BATCH:\n"
+                      << e.what() << std::endl
+                      << "OpenCL status: " << e.get_cl_code() << std::endl;
+        }
+    }
+};
+
+enum class elementwise_op { mul, div, fma };
+
+// c = a * b, c = a / b or c = alpha * a * b + beta * c, elementwise on every
+// m x n matrix of the batch through omatmul_batch, omatdiv_batch or
+// omatfma_batch.
+template <typename fp>
+bool test(const device& dev, elementwise_op op, int m, int n, fp alpha, fp beta, int batch_size) {
+    // Batched elementwise operations are only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data.
+    const int lda          = m + 3;
+    const int ldb          = m;
+    const int ldc          = m + 7;
+    const int64_t stride_a = lda * n + 2;
+    const int64_t stride_b = ldb * n;
+    const int64_t stride_c = ldc * n + 6;
+    vector<fp, allocator_helper<fp, 64>> A, B, C, C_ref;
+    rand_vector(A, stride_a * batch_size, 1);
+    rand_vector(B, stride_b * batch_size, 1);
+    rand_vector(C, stride_c * batch_size, 1);
+    // Keep the divisors away from zero.
+    for (auto& b : B)
+        b += fp(2.0);
+    C_ref = C;
+
+    // Reference elementwise operation on every matrix of the batch.
+    for (int l = 0; l < batch_size; l++) {
+        for (int j = 0; j < n; j++) {
+            for (int i = 0; i < m; i++) {
+                const fp a = A[i + j * lda + l * stride_a];
+                const fp b = B[i + j * ldb + l * stride_b];
+                fp& c      = C_ref[i + j * ldc + l * stride_c];
+                if (op == elementwise_op::mul)
+                    c = a * b;
+                else if (op == elementwise_op::div)
+                    c = a / b;
+                else
+                    c = alpha * a * b + beta * c;
+            }
+        }
+    }
+
+    // Call DPC++ elementwise batch operation.
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<fp, 1> B_buffer(B.data(), range<1>(B.size()));
+    buffer<fp, 1> C_buffer(C.data(), range<1>(C.size()));
+
+    try {
+#ifdef CALL_RT_API
+        if (op == elementwise_op::mul)
+            onemkl::blas::omatmul_batch(main_queue, m, n, A_buffer, lda, stride_a, B_buffer, ldb,
+                                        stride_b, C_buffer, ldc, stride_c, batch_size);
+        else if (op == elementwise_op::div)
+            onemkl::blas::omatdiv_batch(main_queue, m, n, A_buffer, lda, stride_a, B_buffer, ldb,
+                                        stride_b, C_buffer, ldc, stride_c, batch_size);
+        else
+            onemkl::blas::omatfma_batch(main_queue, m, n, alpha, A_buffer, lda, stride_a, B_buffer,
+                                        ldb, stride_b, beta, C_buffer, ldc, stride_c, batch_size);
+#else
+        if (op == elementwise_op::mul) {
+            TEST_RUN_CT(main_queue, onemkl::blas::omatmul_batch,
+                        (main_queue, m, n, A_buffer, lda, stride_a, B_buffer, ldb, stride_b,
+                         C_buffer, ldc, stride_c, batch_size));
+        }
+        else if (op == elementwise_op::div) {
+            TEST_RUN_CT(main_queue, onemkl::blas::omatdiv_batch,
+                        (main_queue, m, n, A_buffer, lda, stride_a, B_buffer, ldb, stride_b,
+                         C_buffer, ldc, stride_c, batch_size));
+        }
+        else {
+            TEST_RUN_CT(main_queue, onemkl::blas::omatfma_batch,
+                        (main_queue, m, n, alpha, A_buffer, lda, stride_a, B_buffer, ldb,
+                         stride_b, beta, C_buffer, ldc, stride_c, batch_size));
+        }
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during ELEMENTWISE_BATCH:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    auto C_accessor = C_buffer.template get_access<access::mode::read>();
+    bool good       = check_equal_vector(C_accessor, C_ref, C.size(), 1, 10, std::cout);
+
+    return good;
+}
+
+// b = a limited to [lo, hi], elementwise on every m x n matrix of the batch
+// through omatclamp_batch.
+template <typename fp>
+bool test_clamp(const device& dev, int m, int n, fp lo, fp hi, int batch_size) {
+    // Batched elementwise operations are only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data.
+    const int lda          = m + 3;
+    const int ldb          = m + 5;
+    const int64_t stride_a = lda * n + 2;
+    const int64_t stride_b = ldb * n + 4;
+    vector<fp, allocator_helper<fp, 64>> A, B, B_ref;
+    rand_vector(A, stride_a * batch_size, 1);
+    rand_vector(B, stride_b * batch_size, 1);
+    B_ref = B;
+
+    // Reference clamp on every matrix of the batch.
+    for (int l = 0; l < batch_size; l++)
+        for (int j = 0; j < n; j++)
+            for (int i = 0; i < m; i++)
+                B_ref[i + j * ldb + l * stride_b] =
+                    std::min(std::max(A[i + j * lda + l * stride_a], lo), hi);
+
+    // Call DPC++ OMATCLAMP_BATCH.
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<fp, 1> B_buffer(B.data(), range<1>(B.size()));
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::omatclamp_batch(main_queue, m, n, lo, hi, A_buffer, lda, stride_a, B_buffer,
+                                      ldb, stride_b, batch_size);
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::omatclamp_batch,
+                    (main_queue, m, n, lo, hi, A_buffer, lda, stride_a, B_buffer, ldb, stride_b,
+                     batch_size));
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during OMATCLAMP_BATCH:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    auto B_accessor = B_buffer.template get_access<access::mode::read>();
+    bool good       = check_equal_vector(B_accessor, B_ref, B.size(), 1, 1, std::cout);
+
+    return good;
+}
+
+class ElementwiseBatchStrideTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(ElementwiseBatchStrideTests, RealSinglePrecision) {
+    for (elementwise_op op : { elementwise_op::mul, elementwise_op::div, elementwise_op::fma })
+        EXPECT_TRUE(test<float>(GetParam(), op, 73, 27, 2.0f, 0.5f, 5));
+    EXPECT_TRUE(test_clamp<float>(GetParam(), 73, 27, -0.25f, 0.25f, 5));
+}
+TEST_P(ElementwiseBatchStrideTests, RealDoublePrecision) {
+    for (elementwise_op op : { elementwise_op::mul, elementwise_op::div, elementwise_op::fma })
+        EXPECT_TRUE(test<double>(GetParam(), op, 73, 27, 2.0, 0.0, 5));
+    EXPECT_TRUE(test_clamp<double>(GetParam(), 73, 27, -0.25, 0.25, 5));
+}
+TEST_P(ElementwiseBatchStrideTests, ComplexSinglePrecision) {
+    std::complex<float> alpha(2.0, -0.5);
+    std::complex<float> beta(-1.5, 0.5);
+    for (elementwise_op op : { elementwise_op::mul, elementwise_op::div, elementwise_op::fma })
+        EXPECT_TRUE(test<std::complex<float>>(GetParam(), op, 73, 27, alpha, beta, 5));
+}
+TEST_P(ElementwiseBatchStrideTests, ComplexDoublePrecision) {
+    std::complex<double> alpha(2.0, -0.5);
+    std::complex<double> beta(-1.5, 0.5);
+    for (elementwise_op op : { elementwise_op::mul, elementwise_op::div, elementwise_op::fma })
+        EXPECT_TRUE(test<std::complex<double>>(GetParam(), op, 73, 27, alpha, beta, 5));
+}
+
+INSTANTIATE_TEST_SUITE_P(ElementwiseBatchStrideTestSuite, ElementwiseBatchStrideTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,231 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// Calls the reference GEMM on every problem of a grouped batch whose matrices
+// are stored back to back in A, B and C.
+template <typename fp, typename vec>
+void reference_gemm_batch(const vector<onemkl::transpose>& transa,
+                          const vector<onemkl::transpose>& transb, const vector<int64_t>& m,
+                          const vector<int64_t>& n, const vector<int64_t>& k,
+                          const vector<fp>& alpha, vec& A, const vector<int64_t>& lda, vec& B,
+                          const vector<int64_t>& ldb, const vector<fp>& beta, vec& C,
+                          const vector<int64_t>& ldc, const vector<int64_t>& group_size) {
+    using fp_ref = typename ref_type_info<fp>::type;
+
+    int64_t offset_a = 0, offset_b = 0, offset_c = 0;
+    for (size_t i = 0; i < group_size.size(); i++) {
+        const int m_ref = m[i], n_ref = n[i], k_ref = k[i];
+        const int lda_ref = lda[i], ldb_ref = ldb[i], ldc_ref = ldc[i];
+        for (int64_t j = 0; j < group_size[i]; j++) {
+            ::gemm(convert_to_cblas_trans(transa[i]), convert_to_cblas_trans(transb[i]), &m_ref,
+                   &n_ref, &k_ref, (fp_ref*)&alpha[i], (fp_ref*)A.data() + offset_a, &lda_ref,
+                   (fp_ref*)B.data() + offset_b, &ldb_ref, (fp_ref*)&beta[i],
+                   (fp_ref*)C.data() + offset_c, &ldc_ref);
+            offset_a += matrix_size(transa[i], m[i], k[i], lda[i]);
+            offset_b += matrix_size(transb[i], k[i], n[i], ldb[i]);
+            offset_c += matrix_size(onemkl::transpose::nontrans, m[i], n[i], ldc[i]);
+        }
+    }
+}
+
+// Runs the same grouped batch twice on one set of buffers, then on a second
+// set, then on the first set again with different group sizes. The mklcpu
+// backend reuses the arguments it converted for a repeated call, which must
+// not carry over to the calls that differ from it.
+template <typename fp>
+bool test(const device& dev, onemkl::transpose transa, onemkl::transpose transb, fp alpha,
+          fp beta) {
+    // The reuse of converted arguments is specific to the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare the group configuration. The second group sizes need no more
+    // storage than the first ones.
+    const int64_t group_count = 2;
+    vector<onemkl::transpose> transa_array = { transa, onemkl::transpose::nontrans };
+    vector<onemkl::transpose> transb_array = { transb, onemkl::transpose::trans };
+    vector<int64_t> m = { 27, 8 }, n = { 19, 13 }, k = { 33, 5 };
+    vector<int64_t> group_size[2] = { { 3, 4 }, { 1, 5 } };
+    vector<int64_t> lda(group_count), ldb(group_count), ldc = { 31, 10 };
+    vector<fp> alpha_array = { alpha, fp(1.0) };
+    vector<fp> beta_array  = { beta, fp(0.0) };
+
+    int64_t size_a = 0, size_b = 0, size_c = 0;
+    for (int64_t i = 0; i < group_count; i++) {
+        lda[i] = inner_dimension(transa_array[i], m[i], k[i]) + 3;
+        ldb[i] = inner_dimension(transb_array[i], k[i], n[i]) + 2;
+        size_a += group_size[0][i] * matrix_size(transa_array[i], m[i], k[i], lda[i]);
+        size_b += group_size[0][i] * matrix_size(transb_array[i], k[i], n[i], ldb[i]);
+        size_c += group_size[0][i] * matrix_size(onemkl::transpose::nontrans, m[i], n[i], ldc[i]);
+    }
+
+    // Two sets of operands, and the set and group sizes of every call.
+    const int num_sets = 2, num_calls = 4;
+    vector<fp, allocator_helper<fp, 64>> A[num_sets], B[num_sets], C[num_sets], C_ref[num_sets];
+    for (int s = 0; s < num_sets; s++) {
+        rand_vector(A[s], size_a, 1);
+        rand_vector(B[s], size_b, 1);
+        rand_vector(C[s], size_c, 1);
+        C_ref[s] = C[s];
+    }
+    const int call_set[num_calls]        = { 0, 0, 1, 0 };
+    const int call_group_size[num_calls] = { 0, 0, 0, 1 };
+
+    // Call Reference GEMM on every problem of every call.
+    for (int c = 0; c < num_calls; c++) {
+        const int s = call_set[c];
+        reference_gemm_batch(transa_array, transb_array, m, n, k, alpha_array, A[s], lda, B[s],
+                             ldb, beta_array, C_ref[s], ldc, group_size[call_group_size[c]]);
+    }
+
+    // Call DPC++ GEMM_BATCH.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during GEMM_BATCH:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<onemkl::transpose, 1> transa_buffer(transa_array.data(), range<1>(group_count));
+    buffer<onemkl::transpose, 1> transb_buffer(transb_array.data(), range<1>(group_count));
+    buffer<int64_t, 1> m_buffer(m.data(), range<1>(group_count));
+    buffer<int64_t, 1> n_buffer(n.data(), range<1>(group_count));
+    buffer<int64_t, 1> k_buffer(k.data(), range<1>(group_count));
+    buffer<int64_t, 1> lda_buffer(lda.data(), range<1>(group_count));
+    buffer<int64_t, 1> ldb_buffer(ldb.data(), range<1>(group_count));
+    buffer<int64_t, 1> ldc_buffer(ldc.data(), range<1>(group_count));
+    buffer<fp, 1> alpha_buffer(alpha_array.data(), range<1>(group_count));
+    buffer<fp, 1> beta_buffer(beta_array.data(), range<1>(group_count));
+    vector<buffer<int64_t, 1>> group_size_buffer;
+    vector<buffer<fp, 1>> A_buffer, B_buffer, C_buffer;
+    for (int g = 0; g < 2; g++)
+        group_size_buffer.emplace_back(group_size[g].data(), range<1>(group_count));
+    for (int s = 0; s < num_sets; s++) {
+        A_buffer.emplace_back(A[s].data(), range<1>(A[s].size()));
+        B_buffer.emplace_back(B[s].data(), range<1>(B[s].size()));
+        C_buffer.emplace_back(C[s].data(), range<1>(C[s].size()));
+    }
+
+    try {
+        for (int c = 0; c < num_calls; c++) {
+            const int s = call_set[c], g = call_group_size[c];
+#ifdef CALL_RT_API
+            onemkl::blas::gemm_batch(main_queue, transa_buffer, transb_buffer, m_buffer, n_buffer,
+                                     k_buffer, alpha_buffer, A_buffer[s], lda_buffer, B_buffer[s],
+                                     ldb_buffer, beta_buffer, C_buffer[s], ldc_buffer,
+                                     group_count, group_size_buffer[g]);
+#else
+            TEST_RUN_CT(main_queue, onemkl::blas::gemm_batch,
+                        (main_queue, transa_buffer, transb_buffer, m_buffer, n_buffer, k_buffer,
+                         alpha_buffer, A_buffer[s], lda_buffer, B_buffer[s], ldb_buffer,
+                         beta_buffer, C_buffer[s], ldc_buffer, group_count, group_size_buffer[g]));
+#endif
+        }
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during GEMM_BATCH:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good = true;
+    for (int s = 0; s < num_sets; s++) {
+        auto C_accessor = C_buffer[s].template get_access<access::mode::read>();
+        good &= check_equal_vector(C_accessor, C_ref[s], C[s].size(), 1, 20 * k[0], std::cout);
+    }
+
+    return good;
+}
+
+class GemmBatchGroupTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(GemmBatchGroupTests, RealSinglePrecision) {
+    float alpha(2.0);
+    float beta(3.0);
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::transpose::nontrans, onemkl::transpose::nontrans,
+                            alpha, beta));
+    EXPECT_TRUE(
+        test<float>(GetParam(), onemkl::transpose::trans, onemkl::transpose::trans, alpha, beta));
+}
+TEST_P(GemmBatchGroupTests, RealDoublePrecision) {
+    double alpha(2.0);
+    double beta(3.0);
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::transpose::nontrans, onemkl::transpose::trans,
+                             alpha, beta));
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::transpose::trans, onemkl::transpose::nontrans,
+                             alpha, beta));
+}
+TEST_P(GemmBatchGroupTests, ComplexSinglePrecision) {
+    std::complex<float> alpha(2.0, -0.5);
+    std::complex<float> beta(3.0, -1.5);
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::transpose::nontrans,
+                                          onemkl::transpose::conjtrans, alpha, beta));
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::transpose::conjtrans,
+                                          onemkl::transpose::nontrans, alpha, beta));
+}
+TEST_P(GemmBatchGroupTests, ComplexDoublePrecision) {
+    std::complex<double> alpha(2.0, -0.5);
+    std::complex<double> beta(3.0, -1.5);
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::transpose::trans,
+                                           onemkl::transpose::trans, alpha, beta));
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::transpose::nontrans,
+                                           onemkl::transpose::nontrans, alpha, beta));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmBatchGroupTestSuite, GemmBatchGroupTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
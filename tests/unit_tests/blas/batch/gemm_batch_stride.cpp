@@ -0,0 +1,201 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+template <typename fp>
+bool test(const device& dev, onemkl::transpose transa, onemkl::transpose transb, int m, int n,
+          int k, int lda, int ldb, int ldc, int64_t stride_a, int64_t stride_b, int64_t stride_c,
+          fp alpha, fp beta, int batch_size) {
+    // Strided gemm_batch is not implemented by the mklgpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data. A zero stride shares the operand across the batch.
+    const int size_a = stride_a * (batch_size - 1) + matrix_size(transa, m, k, lda);
+    const int size_b = stride_b * (batch_size - 1) + matrix_size(transb, k, n, ldb);
+    const int size_c =
+        stride_c * (batch_size - 1) + matrix_size(onemkl::transpose::nontrans, m, n, ldc);
+    vector<fp, allocator_helper<fp, 64>> A, B, C, C_ref;
+    rand_vector(A, size_a, 1);
+    rand_vector(B, size_b, 1);
+    rand_vector(C, size_c, 1);
+    C_ref = C;
+
+    // Call Reference GEMM on every matrix of the batch.
+    const int m_ref = m, n_ref = n, k_ref = k;
+    const int lda_ref = lda, ldb_ref = ldb, ldc_ref = ldc;
+
+    using fp_ref = typename ref_type_info<fp>::type;
+
+    for (int i = 0; i < batch_size; i++) {
+        ::gemm(convert_to_cblas_trans(transa), convert_to_cblas_trans(transb), &m_ref, &n_ref,
+               &k_ref, (fp_ref*)&alpha, (fp_ref*)A.data() + stride_a * i, &lda_ref,
+               (fp_ref*)B.data() + stride_b * i, &ldb_ref, (fp_ref*)&beta,
+               (fp_ref*)C_ref.data() + stride_c * i, &ldc_ref);
+    }
+
+    // Call DPC++ GEMM_BATCH.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during GEMM_BATCH:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<fp, 1> B_buffer(B.data(), range<1>(B.size()));
+    buffer<fp, 1> C_buffer(C.data(), range<1>(C.size()));
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::gemm_batch(main_queue, transa, transb, m, n, k, alpha, A_buffer, lda,
+                                 stride_a, B_buffer, ldb, stride_b, beta, C_buffer, ldc, stride_c,
+                                 batch_size);
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::gemm_batch,
+                    (main_queue, transa, transb, m, n, k, alpha, A_buffer, lda, stride_a,
+                     B_buffer, ldb, stride_b, beta, C_buffer, ldc, stride_c, batch_size));
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during GEMM_BATCH:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good;
+    {
+        auto C_accessor = C_buffer.template get_access<access::mode::read>();
+        good            = check_equal_vector(C_accessor, C_ref, C.size(), 1, 10 * k, std::cout);
+    }
+
+    return good;
+}
+
+// Runs a batch of independent operands, then batches sharing A or B whose
+//  other operands are laid out so that the mklcpu backend fuses them into a
+//  single gemm.
+template <typename fp>
+bool test_all(const device& dev, onemkl::transpose transa, onemkl::transpose transb, fp alpha,
+              fp beta) {
+    const int m = 27, n = 19, k = 33, batch_size = 5;
+    const int lda          = (transa == onemkl::transpose::nontrans) ? m + 3 : k + 3;
+    const int ldb          = (transb == onemkl::transpose::nontrans) ? k + 2 : n + 2;
+    const int ldc          = m + 4;
+    const int64_t stride_a = lda * ((transa == onemkl::transpose::nontrans) ? k : m) + 5;
+    const int64_t stride_b = ldb * ((transb == onemkl::transpose::nontrans) ? n : k) + 7;
+    const int64_t stride_c = ldc * n + 9;
+
+    bool good = test<fp>(dev, transa, transb, m, n, k, lda, ldb, ldc, stride_a, stride_b,
+                         stride_c, alpha, beta, batch_size);
+
+    // Shared A, op(B) and C stored side by side.
+    const bool nontrans_b = (transb == onemkl::transpose::nontrans);
+    const int ldb_shared  = nontrans_b ? ldb : n * batch_size;
+    good &= test<fp>(dev, transa, transb, m, n, k, lda, ldb_shared, ldc, 0,
+                     nontrans_b ? int64_t(ldb) * n : n, int64_t(ldc) * n, alpha, beta,
+                     batch_size);
+
+    // Shared B, op(A) and C stacked on top of each other.
+    const bool nontrans_a = (transa == onemkl::transpose::nontrans);
+    const int lda_shared  = nontrans_a ? m * batch_size : lda;
+    good &= test<fp>(dev, transa, transb, m, n, k, lda_shared, ldb, m * batch_size,
+                     nontrans_a ? m : int64_t(lda) * m, 0, m, alpha, beta, batch_size);
+
+    // Shared A with padded strides, which cannot be fused.
+    good &= test<fp>(dev, transa, transb, m, n, k, lda, ldb, ldc, 0, stride_b, stride_c, alpha,
+                     beta, batch_size);
+    return good;
+}
+
+class GemmBatchStrideTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(GemmBatchStrideTests, RealSinglePrecision) {
+    float alpha(2.0);
+    float beta(3.0);
+    EXPECT_TRUE(test_all<float>(GetParam(), onemkl::transpose::nontrans,
+                                onemkl::transpose::nontrans, alpha, beta));
+    EXPECT_TRUE(test_all<float>(GetParam(), onemkl::transpose::trans, onemkl::transpose::trans,
+                                alpha, beta));
+}
+TEST_P(GemmBatchStrideTests, RealDoublePrecision) {
+    double alpha(2.0);
+    double beta(3.0);
+    EXPECT_TRUE(test_all<double>(GetParam(), onemkl::transpose::nontrans,
+                                 onemkl::transpose::trans, alpha, beta));
+    EXPECT_TRUE(test_all<double>(GetParam(), onemkl::transpose::trans,
+                                 onemkl::transpose::nontrans, alpha, beta));
+}
+TEST_P(GemmBatchStrideTests, ComplexSinglePrecision) {
+    std::complex<float> alpha(2.0, -0.5);
+    std::complex<float> beta(3.0, -1.5);
+    EXPECT_TRUE(test_all<std::complex<float>>(GetParam(), onemkl::transpose::nontrans,
+                                              onemkl::transpose::conjtrans, alpha, beta));
+    EXPECT_TRUE(test_all<std::complex<float>>(GetParam(), onemkl::transpose::conjtrans,
+                                              onemkl::transpose::nontrans, alpha, beta));
+}
+TEST_P(GemmBatchStrideTests, ComplexDoublePrecision) {
+    std::complex<double> alpha(2.0, -0.5);
+    std::complex<double> beta(3.0, -1.5);
+    EXPECT_TRUE(test_all<std::complex<double>>(GetParam(), onemkl::transpose::trans,
+                                               onemkl::transpose::trans, alpha, beta));
+    EXPECT_TRUE(test_all<std::complex<double>>(GetParam(), onemkl::transpose::nontrans,
+                                               onemkl::transpose::nontrans, alpha, beta));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmBatchStrideTestSuite, GemmBatchStrideTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,173 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+template <typename fp>
+bool test(const device& dev, onemkl::transpose transa, int m, int n, fp alpha, fp beta, int incx,
+          int incy, int lda, int batch_size) {
+    // Batched gemv is not implemented by the mklgpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data.
+    const int x_len        = outer_dimension(transa, m, n);
+    const int y_len        = inner_dimension(transa, m, n);
+    const int64_t stride_a = lda * n + 3;
+    const int64_t stride_x = x_len * std::abs(incx) + 2;
+    const int64_t stride_y = y_len * std::abs(incy) + 1;
+    vector<fp, allocator_helper<fp, 64>> A(stride_a * batch_size), x(stride_x * batch_size),
+        y(stride_y * batch_size), y_ref;
+    for (auto& v : x)
+        v = rand_scalar<fp>();
+    for (auto& v : y)
+        v = rand_scalar<fp>();
+    for (int i = 0; i < batch_size; i++)
+        rand_matrix(A.data() + stride_a * i, onemkl::transpose::nontrans, m, n, lda);
+    y_ref = y;
+
+    // Call Reference GEMV on every problem of the batch.
+    const int m_ref = m, n_ref = n, incx_ref = incx, incy_ref = incy, lda_ref = lda;
+    using fp_ref = typename ref_type_info<fp>::type;
+
+    for (int i = 0; i < batch_size; i++) {
+        ::gemv(convert_to_cblas_trans(transa), &m_ref, &n_ref, (fp_ref*)&alpha,
+               (fp_ref*)A.data() + stride_a * i, &lda_ref, (fp_ref*)x.data() + stride_x * i,
+               &incx_ref, (fp_ref*)&beta, (fp_ref*)y_ref.data() + stride_y * i, &incy_ref);
+    }
+
+    // Call DPC++ GEMV_BATCH.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during GEMV_BATCH:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<fp, 1> x_buffer(x.data(), range<1>(x.size()));
+    buffer<fp, 1> y_buffer(y.data(), range<1>(y.size()));
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::gemv_batch(main_queue, transa, m, n, alpha, A_buffer, lda, stride_a, x_buffer,
+                                 incx, stride_x, beta, y_buffer, incy, stride_y, batch_size);
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::gemv_batch,
+                    (main_queue, transa, m, n, alpha, A_buffer, lda, stride_a, x_buffer, incx,
+                     stride_x, beta, y_buffer, incy, stride_y, batch_size));
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during GEMV_BATCH:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good;
+    {
+        auto y_accessor = y_buffer.template get_access<access::mode::read>();
+        good = check_equal_vector(y_accessor, y_ref, y.size(), 1, std::max(m, n), std::cout);
+    }
+
+    return good;
+}
+
+class GemvBatchStrideTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(GemvBatchStrideTests, RealSinglePrecision) {
+    float alpha(2.0);
+    float beta(3.0);
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::transpose::nontrans, 25, 30, alpha, beta, 2, 3, 42,
+                            7));
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::transpose::nontrans, 25, 30, alpha, beta, -2, -3,
+                            42, 7));
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::transpose::trans, 25, 30, alpha, beta, 1, 1, 42,
+                            7));
+}
+TEST_P(GemvBatchStrideTests, RealDoublePrecision) {
+    double alpha(2.0);
+    double beta(3.0);
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::transpose::nontrans, 25, 30, alpha, beta, 2, 3, 42,
+                             7));
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::transpose::nontrans, 25, 30, alpha, beta, -2, -3,
+                             42, 7));
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::transpose::trans, 25, 30, alpha, beta, 1, 1, 42,
+                             7));
+}
+TEST_P(GemvBatchStrideTests, ComplexSinglePrecision) {
+    std::complex<float> alpha(2.0, -0.5);
+    std::complex<float> beta(3.0, -1.5);
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::transpose::nontrans, 25, 30, alpha,
+                                          beta, 2, 3, 42, 7));
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::transpose::nontrans, 25, 30, alpha,
+                                          beta, -2, -3, 42, 7));
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::transpose::trans, 25, 30, alpha, beta,
+                                          1, 1, 42, 7));
+}
+TEST_P(GemvBatchStrideTests, ComplexDoublePrecision) {
+    std::complex<double> alpha(2.0, -0.5);
+    std::complex<double> beta(3.0, -1.5);
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::transpose::nontrans, 25, 30, alpha,
+                                           beta, 2, 3, 42, 7));
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::transpose::nontrans, 25, 30, alpha,
+                                           beta, -2, -3, 42, 7));
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::transpose::trans, 25, 30, alpha,
+                                           beta, 1, 1, 42, 7));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemvBatchStrideTestSuite, GemvBatchStrideTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,185 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// The second group always uses the transposed A and the upper triangle of C,
+// the first one takes its parameters from the test.
+template <typename fp, typename fp_scalar>
+bool test(const device& dev, onemkl::uplo upper_lower, onemkl::transpose trans, fp_scalar alpha,
+          fp_scalar beta) {
+    // Batched herk is not implemented by the mklgpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare the group configuration.
+    const int64_t group_count = 2;
+    vector<onemkl::uplo> uplo = { upper_lower, onemkl::uplo::upper };
+    vector<onemkl::transpose> trans_array = { trans, onemkl::transpose::conjtrans };
+    vector<int64_t> n = { 73, 12 }, k = { 27, 19 }, lda = { 101, 21 }, ldc = { 103, 14 };
+    vector<int64_t> group_size = { 3, 4 };
+    vector<fp_scalar> alpha_array = { alpha, fp_scalar(1.0) };
+    vector<fp_scalar> beta_array  = { beta, fp_scalar(0.0) };
+
+    // Matrices of the groups are stored back to back.
+    vector<fp, allocator_helper<fp, 64>> A, C, C_ref;
+    vector<int64_t> offset_a, offset_c;
+    int max_nk = 0;
+    for (int64_t i = 0; i < group_count; i++) {
+        const int64_t size_a =
+            lda[i] * ((trans_array[i] == onemkl::transpose::nontrans) ? k[i] : n[i]);
+        for (int64_t j = 0; j < group_size[i]; j++) {
+            offset_a.push_back(A.size());
+            offset_c.push_back(C.size());
+            A.resize(A.size() + size_a);
+            C.resize(C.size() + ldc[i] * n[i]);
+            rand_matrix(A.data() + offset_a.back(), trans_array[i], n[i], k[i], lda[i]);
+            rand_matrix(C.data() + offset_c.back(), onemkl::transpose::nontrans, n[i], n[i],
+                        ldc[i]);
+        }
+        max_nk = std::max<int>(max_nk, std::max(n[i], k[i]));
+    }
+    C_ref = C;
+
+    // Call Reference HERK on every matrix of the batch.
+    using fp_ref = typename ref_type_info<fp>::type;
+
+    for (int64_t i = 0, idx = 0; i < group_count; i++) {
+        const int n_ref = n[i], k_ref = k[i];
+        const int lda_ref = lda[i], ldc_ref = ldc[i];
+        for (int64_t j = 0; j < group_size[i]; j++, idx++) {
+            ::herk(convert_to_cblas_uplo(uplo[i]), convert_to_cblas_trans(trans_array[i]), &n_ref,
+                   &k_ref, (fp_scalar*)&alpha_array[i], (fp_ref*)A.data() + offset_a[idx], &lda_ref,
+                   (fp_scalar*)&beta_array[i], (fp_ref*)C_ref.data() + offset_c[idx], &ldc_ref);
+        }
+    }
+
+    // Call DPC++ HERK_BATCH.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during HERK_BATCH:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<onemkl::uplo, 1> uplo_buffer(uplo.data(), range<1>(group_count));
+    buffer<onemkl::transpose, 1> trans_buffer(trans_array.data(), range<1>(group_count));
+    buffer<int64_t, 1> n_buffer(n.data(), range<1>(group_count));
+    buffer<int64_t, 1> k_buffer(k.data(), range<1>(group_count));
+    buffer<int64_t, 1> lda_buffer(lda.data(), range<1>(group_count));
+    buffer<int64_t, 1> ldc_buffer(ldc.data(), range<1>(group_count));
+    buffer<int64_t, 1> group_size_buffer(group_size.data(), range<1>(group_count));
+    buffer<fp_scalar, 1> alpha_buffer(alpha_array.data(), range<1>(group_count));
+    buffer<fp_scalar, 1> beta_buffer(beta_array.data(), range<1>(group_count));
+    buffer<fp, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<fp, 1> C_buffer(C.data(), range<1>(C.size()));
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::herk_batch(main_queue, uplo_buffer, trans_buffer, n_buffer, k_buffer,
+                                 alpha_buffer, A_buffer, lda_buffer, beta_buffer, C_buffer,
+                                 ldc_buffer, group_count, group_size_buffer);
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::herk_batch,
+                    (main_queue, uplo_buffer, trans_buffer, n_buffer, k_buffer, alpha_buffer,
+                     A_buffer, lda_buffer, beta_buffer, C_buffer, ldc_buffer, group_count,
+                     group_size_buffer));
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during HERK_BATCH:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good;
+    {
+        auto C_accessor = C_buffer.template get_access<access::mode::read>();
+        good = check_equal_vector(C_accessor, C_ref, C.size(), 1, 10 * max_nk, std::cout);
+    }
+
+    return good;
+}
+
+class HerkBatchGroupTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(HerkBatchGroupTests, ComplexSinglePrecision) {
+    float alpha(2.0);
+    float beta(3.0);
+    EXPECT_TRUE((test<std::complex<float>, float>(GetParam(), onemkl::uplo::lower,
+                                                  onemkl::transpose::nontrans, alpha, beta)));
+    EXPECT_TRUE((test<std::complex<float>, float>(GetParam(), onemkl::uplo::upper,
+                                                  onemkl::transpose::nontrans, alpha, beta)));
+    EXPECT_TRUE((test<std::complex<float>, float>(GetParam(), onemkl::uplo::lower,
+                                                  onemkl::transpose::conjtrans, alpha, beta)));
+    EXPECT_TRUE((test<std::complex<float>, float>(GetParam(), onemkl::uplo::upper,
+                                                  onemkl::transpose::conjtrans, alpha, beta)));
+}
+TEST_P(HerkBatchGroupTests, ComplexDoublePrecision) {
+    double alpha(2.0);
+    double beta(3.0);
+    EXPECT_TRUE((test<std::complex<double>, double>(GetParam(), onemkl::uplo::lower,
+                                                    onemkl::transpose::nontrans, alpha, beta)));
+    EXPECT_TRUE((test<std::complex<double>, double>(GetParam(), onemkl::uplo::upper,
+                                                    onemkl::transpose::nontrans, alpha, beta)));
+    EXPECT_TRUE((test<std::complex<double>, double>(GetParam(), onemkl::uplo::lower,
+                                                    onemkl::transpose::conjtrans, alpha, beta)));
+    EXPECT_TRUE((test<std::complex<double>, double>(GetParam(), onemkl::uplo::upper,
+                                                    onemkl::transpose::conjtrans, alpha, beta)));
+}
+
+INSTANTIATE_TEST_SUITE_P(HerkBatchGroupTestSuite, HerkBatchGroupTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
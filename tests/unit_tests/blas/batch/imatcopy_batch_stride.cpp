@@ -0,0 +1,163 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+template <typename fp>
+bool test(const device& dev, onemkl::transpose trans, int m, int n, int lda, int ldb, fp alpha,
+          int batch_size) {
+    // Batched imatcopy is only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data. Each matrix of the batch holds A with leading dimension
+    //  lda on input and op(A) with leading dimension ldb on output.
+    const int rows_b     = (trans == onemkl::transpose::nontrans) ? m : n;
+    const int cols_b     = (trans == onemkl::transpose::nontrans) ? n : m;
+    const int64_t stride = std::max(lda * n, ldb * cols_b) + 3;
+    vector<fp, allocator_helper<fp, 64>> AB, B_ref;
+    rand_vector(AB, stride * batch_size, 1);
+    B_ref.resize(AB.size());
+
+    // Call Reference OMATCOPY from a copy of every matrix of the batch.
+    const int m_ref = m, n_ref = n;
+    const int lda_ref = lda, ldb_ref = ldb;
+
+    using fp_ref = typename ref_type_info<fp>::type;
+
+    for (int i = 0; i < batch_size; i++) {
+        ::omatcopy(convert_to_cblas_trans(trans), &m_ref, &n_ref, (fp_ref*)&alpha,
+                   (fp_ref*)AB.data() + stride * i, &lda_ref, (fp_ref*)B_ref.data() + stride * i,
+                   &ldb_ref);
+    }
+
+    // Call DPC++ IMATCOPY_BATCH.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during IMATCOPY_BATCH:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> AB_buffer(AB.data(), range<1>(AB.size()));
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::imatcopy_batch(main_queue, trans, m, n, alpha, AB_buffer, lda, ldb, stride,
+                                     batch_size);
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::imatcopy_batch,
+                    (main_queue, trans, m, n, alpha, AB_buffer, lda, ldb, stride, batch_size));
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during IMATCOPY_BATCH:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good = true;
+    {
+        auto AB_accessor = AB_buffer.template get_access<access::mode::read>();
+        for (int i = 0; i < batch_size; i++) {
+            for (int col = 0; col < cols_b; col++) {
+                for (int row = 0; row < rows_b; row++) {
+                    const int64_t idx = stride * i + row + ldb * col;
+                    if (!check_equal(AB_accessor[idx], B_ref[idx], 1, std::cout))
+                        good = false;
+                }
+            }
+        }
+    }
+
+    return good;
+}
+
+class ImatcopyBatchStrideTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(ImatcopyBatchStrideTests, RealSinglePrecision) {
+    float alpha(2.0);
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::transpose::nontrans, 73, 27, 73, 73, alpha, 5));
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::transpose::trans, 73, 27, 73, 27, alpha, 5));
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::transpose::conjtrans, 73, 27, 101, 103, alpha, 5));
+}
+TEST_P(ImatcopyBatchStrideTests, RealDoublePrecision) {
+    double alpha(2.0);
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::transpose::nontrans, 73, 27, 73, 73, alpha, 5));
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::transpose::trans, 73, 27, 73, 27, alpha, 5));
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::transpose::conjtrans, 73, 27, 101, 103, alpha, 5));
+}
+TEST_P(ImatcopyBatchStrideTests, ComplexSinglePrecision) {
+    std::complex<float> alpha(2.0, -0.5);
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::transpose::nontrans, 73, 27, 73, 73,
+                                          alpha, 5));
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::transpose::trans, 73, 27, 73, 27,
+                                          alpha, 5));
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::transpose::conjtrans, 73, 27, 101,
+                                          103, alpha, 5));
+}
+TEST_P(ImatcopyBatchStrideTests, ComplexDoublePrecision) {
+    std::complex<double> alpha(2.0, -0.5);
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::transpose::nontrans, 73, 27, 73, 73,
+                                           alpha, 5));
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::transpose::trans, 73, 27, 73, 27,
+                                           alpha, 5));
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::transpose::conjtrans, 73, 27, 101,
+                                           103, alpha, 5));
+}
+
+INSTANTIATE_TEST_SUITE_P(ImatcopyBatchStrideTestSuite, ImatcopyBatchStrideTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
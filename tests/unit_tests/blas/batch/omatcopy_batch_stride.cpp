@@ -0,0 +1,157 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+template <typename fp>
+bool test(const device& dev, onemkl::transpose trans, int m, int n, int lda, int ldb, fp alpha,
+          int batch_size) {
+    // Batched omatcopy is only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data.
+    const int cols_b       = (trans == onemkl::transpose::nontrans) ? n : m;
+    const int64_t stride_a = lda * n + 3;
+    const int64_t stride_b = ldb * cols_b + 5;
+    vector<fp, allocator_helper<fp, 64>> A, B, B_ref;
+    rand_vector(A, stride_a * batch_size, 1);
+    rand_vector(B, stride_b * batch_size, 1);
+    B_ref = B;
+
+    // Call Reference OMATCOPY on every matrix of the batch.
+    const int m_ref = m, n_ref = n;
+    const int lda_ref = lda, ldb_ref = ldb;
+
+    using fp_ref = typename ref_type_info<fp>::type;
+
+    for (int i = 0; i < batch_size; i++) {
+        ::omatcopy(convert_to_cblas_trans(trans), &m_ref, &n_ref, (fp_ref*)&alpha,
+                   (fp_ref*)A.data() + stride_a * i, &lda_ref, (fp_ref*)B_ref.data() + stride_b * i,
+                   &ldb_ref);
+    }
+
+    // Call DPC++ OMATCOPY_BATCH.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during OMATCOPY_BATCH:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<fp, 1> B_buffer(B.data(), range<1>(B.size()));
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::omatcopy_batch(main_queue, trans, m, n, alpha, A_buffer, lda, stride_a,
+                                     B_buffer, ldb, stride_b, batch_size);
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::omatcopy_batch,
+                    (main_queue, trans, m, n, alpha, A_buffer, lda, stride_a, B_buffer, ldb,
+                     stride_b, batch_size));
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during OMATCOPY_BATCH:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good;
+    {
+        auto B_accessor = B_buffer.template get_access<access::mode::read>();
+        good            = check_equal_vector(B_accessor, B_ref, B.size(), 1, 1, std::cout);
+    }
+
+    return good;
+}
+
+class OmatcopyBatchStrideTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(OmatcopyBatchStrideTests, RealSinglePrecision) {
+    float alpha(2.0);
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::transpose::nontrans, 73, 27, 101, 103, alpha, 5));
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::transpose::trans, 73, 27, 101, 103, alpha, 5));
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::transpose::conjtrans, 73, 27, 101, 103, alpha, 5));
+}
+TEST_P(OmatcopyBatchStrideTests, RealDoublePrecision) {
+    double alpha(2.0);
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::transpose::nontrans, 73, 27, 101, 103, alpha, 5));
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::transpose::trans, 73, 27, 101, 103, alpha, 5));
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::transpose::conjtrans, 73, 27, 101, 103, alpha, 5));
+}
+TEST_P(OmatcopyBatchStrideTests, ComplexSinglePrecision) {
+    std::complex<float> alpha(2.0, -0.5);
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::transpose::nontrans, 73, 27, 101, 103,
+                                          alpha, 5));
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::transpose::trans, 73, 27, 101, 103,
+                                          alpha, 5));
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::transpose::conjtrans, 73, 27, 101,
+                                          103, alpha, 5));
+}
+TEST_P(OmatcopyBatchStrideTests, ComplexDoublePrecision) {
+    std::complex<double> alpha(2.0, -0.5);
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::transpose::nontrans, 73, 27, 101,
+                                           103, alpha, 5));
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::transpose::trans, 73, 27, 101, 103,
+                                           alpha, 5));
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::transpose::conjtrans, 73, 27, 101,
+                                           103, alpha, 5));
+}
+
+INSTANTIATE_TEST_SUITE_P(OmatcopyBatchStrideTestSuite, OmatcopyBatchStrideTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,148 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+template <typename fp, typename fp_scalar>
+bool test(const device& dev, int N, int incx, fp_scalar alpha, int batch_size) {
+    // Batched scal is not implemented by the mklgpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data.
+    const int64_t stride_x = N * std::abs(incx) + 3;
+    vector<fp, allocator_helper<fp, 64>> x(stride_x * batch_size), x_ref;
+    for (auto& v : x)
+        v = rand_scalar<fp>();
+    x_ref = x;
+
+    // Call Reference SCAL on every vector of the batch.
+    using fp_ref        = typename ref_type_info<fp>::type;
+    using fp_scalar_mkl = typename ref_type_info<fp_scalar>::type;
+    const int N_ref = N, incx_ref = incx;
+
+    for (int i = 0; i < batch_size; i++) {
+        ::scal(&N_ref, (fp_scalar_mkl*)&alpha, (fp_ref*)x_ref.data() + stride_x * i, &incx_ref);
+    }
+
+    // Call DPC++ SCAL_BATCH.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during SCAL_BATCH:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> x_buffer(x.data(), range<1>(x.size()));
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::scal_batch(main_queue, N, alpha, x_buffer, incx, stride_x, batch_size);
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::scal_batch,
+                    (main_queue, N, alpha, x_buffer, incx, stride_x, batch_size));
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during SCAL_BATCH:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good;
+    {
+        auto x_accessor = x_buffer.template get_access<access::mode::read>();
+        good            = check_equal_vector(x_accessor, x_ref, x.size(), 1, N, std::cout);
+    }
+
+    return good;
+}
+
+class ScalBatchStrideTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(ScalBatchStrideTests, RealSinglePrecision) {
+    float alpha(2.0);
+    EXPECT_TRUE((test<float, float>(GetParam(), 1357, 2, alpha, 5)));
+    EXPECT_TRUE((test<float, float>(GetParam(), 1357, 1, alpha, 5)));
+}
+TEST_P(ScalBatchStrideTests, RealDoublePrecision) {
+    double alpha(2.0);
+    EXPECT_TRUE((test<double, double>(GetParam(), 1357, 2, alpha, 5)));
+    EXPECT_TRUE((test<double, double>(GetParam(), 1357, 1, alpha, 5)));
+}
+TEST_P(ScalBatchStrideTests, ComplexSinglePrecision) {
+    std::complex<float> alpha(2.0, -0.5);
+    EXPECT_TRUE((test<std::complex<float>, std::complex<float>>(GetParam(), 1357, 2, alpha, 5)));
+    EXPECT_TRUE((test<std::complex<float>, std::complex<float>>(GetParam(), 1357, 1, alpha, 5)));
+}
+TEST_P(ScalBatchStrideTests, ComplexDoublePrecision) {
+    std::complex<double> alpha(2.0, -0.5);
+    EXPECT_TRUE((test<std::complex<double>, std::complex<double>>(GetParam(), 1357, 2, alpha, 5)));
+    EXPECT_TRUE((test<std::complex<double>, std::complex<double>>(GetParam(), 1357, 1, alpha, 5)));
+}
+TEST_P(ScalBatchStrideTests, ComplexRealSinglePrecision) {
+    float alpha(2.0);
+    EXPECT_TRUE((test<std::complex<float>, float>(GetParam(), 1357, 2, alpha, 5)));
+    EXPECT_TRUE((test<std::complex<float>, float>(GetParam(), 1357, 1, alpha, 5)));
+}
+TEST_P(ScalBatchStrideTests, ComplexRealDoublePrecision) {
+    double alpha(2.0);
+    EXPECT_TRUE((test<std::complex<double>, double>(GetParam(), 1357, 2, alpha, 5)));
+    EXPECT_TRUE((test<std::complex<double>, double>(GetParam(), 1357, 1, alpha, 5)));
+}
+
+INSTANTIATE_TEST_SUITE_P(ScalBatchStrideTestSuite, ScalBatchStrideTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,224 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// Catch asynchronous exceptions.
+auto exception_handler = [](exception_list exceptions) {
+    for (std::exception_ptr const& e : exceptions) {
+        try {
+            std::rethrow_exception(e);
+        }
+        catch (exception const& e) {
+            std::cout << "Caught asynchronous SYCL exception during STORAGE_CONVERSION_BATCH:\n"
+                      << e.what() << std::endl
+                      << "OpenCL status: " << e.get_cl_code() << std::endl;
+        }
+    }
+};
+
+// Round trip of the upper_lower triangles of a strided batch through packed
+// storage with trttp_batch and tpttr_batch.
+template <typename fp>
+bool test_packed(const device& dev, onemkl::uplo upper_lower, int n, int lda, int batch_size) {
+    // Batched storage conversions are only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data.
+    const int64_t stride_a  = lda * n + 3;
+    const int64_t stride_ap = n * (n + 1) / 2 + 5;
+    vector<fp, allocator_helper<fp, 64>> A, AP, AP_ref, A_tr, A_tr_ref;
+    rand_vector(A, stride_a * batch_size, 1);
+    rand_vector(AP, stride_ap * batch_size, 1);
+    rand_vector(A_tr, stride_a * batch_size, 1);
+    AP_ref   = AP;
+    A_tr_ref = A_tr;
+
+    // Pack every matrix of the batch on the host.
+    const bool upper = (upper_lower == onemkl::uplo::upper);
+    for (int idx = 0; idx < batch_size; idx++) {
+        for (int j = 0, p = 0; j < n; j++) {
+            for (int i = upper ? 0 : j; i <= (upper ? j : n - 1); i++, p++) {
+                AP_ref[stride_ap * idx + p]          = A[stride_a * idx + i + j * lda];
+                A_tr_ref[stride_a * idx + i + j * lda] = A[stride_a * idx + i + j * lda];
+            }
+        }
+    }
+
+    // Call DPC++ TRTTP_BATCH and TPTTR_BATCH.
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<fp, 1> AP_buffer(AP.data(), range<1>(AP.size()));
+    buffer<fp, 1> A_tr_buffer(A_tr.data(), range<1>(A_tr.size()));
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::trttp_batch(main_queue, upper_lower, n, A_buffer, lda, stride_a, AP_buffer,
+                                  stride_ap, batch_size);
+        onemkl::blas::tpttr_batch(main_queue, upper_lower, n, AP_buffer, stride_ap, A_tr_buffer,
+                                  lda, stride_a, batch_size);
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::trttp_batch,
+                    (main_queue, upper_lower, n, A_buffer, lda, stride_a, AP_buffer, stride_ap,
+                     batch_size));
+        TEST_RUN_CT(main_queue, onemkl::blas::tpttr_batch,
+                    (main_queue, upper_lower, n, AP_buffer, stride_ap, A_tr_buffer, lda, stride_a,
+                     batch_size));
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during STORAGE_CONVERSION_BATCH:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    auto AP_accessor   = AP_buffer.template get_access<access::mode::read>();
+    bool good_packed   = check_equal_vector(AP_accessor, AP_ref, AP.size(), 1, 1, std::cout);
+    auto A_tr_accessor = A_tr_buffer.template get_access<access::mode::read>();
+    bool good_full     = check_equal_vector(A_tr_accessor, A_tr_ref, A_tr.size(), 1, 1, std::cout);
+
+    return good_packed && good_full;
+}
+
+// Round trip of a strided batch through band storage with gettgb_batch and
+// gbtge_batch.
+template <typename fp>
+bool test_band(const device& dev, int m, int n, int kl, int ku, int lda, int ldab,
+               int batch_size) {
+    // Batched storage conversions are only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data.
+    const int64_t stride_a  = lda * n + 3;
+    const int64_t stride_ab = ldab * n + 5;
+    vector<fp, allocator_helper<fp, 64>> A, AB, AB_ref, A_ge, A_ge_ref;
+    rand_vector(A, stride_a * batch_size, 1);
+    rand_vector(AB, stride_ab * batch_size, 1);
+    rand_vector(A_ge, stride_a * batch_size, 1);
+    AB_ref   = AB;
+    A_ge_ref = A_ge;
+
+    // Convert every matrix of the batch on the host.
+    for (int idx = 0; idx < batch_size; idx++) {
+        for (int j = 0; j < n; j++) {
+            for (int i = 0; i < m; i++) {
+                const bool in_band = (i >= j - ku && i <= j + kl);
+                if (in_band)
+                    AB_ref[stride_ab * idx + ku + i - j + j * ldab] =
+                        A[stride_a * idx + i + j * lda];
+                A_ge_ref[stride_a * idx + i + j * lda] =
+                    in_band ? A[stride_a * idx + i + j * lda] : fp(0);
+            }
+        }
+    }
+
+    // Call DPC++ GETTGB_BATCH and GBTGE_BATCH.
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<fp, 1> AB_buffer(AB.data(), range<1>(AB.size()));
+    buffer<fp, 1> A_ge_buffer(A_ge.data(), range<1>(A_ge.size()));
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::gettgb_batch(main_queue, m, n, kl, ku, A_buffer, lda, stride_a, AB_buffer,
+                                   ldab, stride_ab, batch_size);
+        onemkl::blas::gbtge_batch(main_queue, m, n, kl, ku, AB_buffer, ldab, stride_ab,
+                                  A_ge_buffer, lda, stride_a, batch_size);
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::gettgb_batch,
+                    (main_queue, m, n, kl, ku, A_buffer, lda, stride_a, AB_buffer, ldab, stride_ab,
+                     batch_size));
+        TEST_RUN_CT(main_queue, onemkl::blas::gbtge_batch,
+                    (main_queue, m, n, kl, ku, AB_buffer, ldab, stride_ab, A_ge_buffer, lda,
+                     stride_a, batch_size));
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during STORAGE_CONVERSION_BATCH:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    auto AB_accessor   = AB_buffer.template get_access<access::mode::read>();
+    bool good_band     = check_equal_vector(AB_accessor, AB_ref, AB.size(), 1, 1, std::cout);
+    auto A_ge_accessor = A_ge_buffer.template get_access<access::mode::read>();
+    bool good_full     = check_equal_vector(A_ge_accessor, A_ge_ref, A_ge.size(), 1, 1, std::cout);
+
+    return good_band && good_full;
+}
+
+template <typename fp>
+bool test(const device& dev) {
+    bool good = true;
+    good      = test_packed<fp>(dev, onemkl::uplo::upper, 27, 30, 37) && good;
+    good      = test_packed<fp>(dev, onemkl::uplo::lower, 150, 151, 3) && good;
+    good      = test_band<fp>(dev, 27, 35, 2, 4, 30, 9, 37) && good;
+    good      = test_band<fp>(dev, 150, 120, 11, 0, 151, 12, 3) && good;
+    return good;
+}
+
+class StorageConversionBatchStrideTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(StorageConversionBatchStrideTests, RealSinglePrecision) {
+    EXPECT_TRUE(test<float>(GetParam()));
+}
+TEST_P(StorageConversionBatchStrideTests, RealDoublePrecision) {
+    EXPECT_TRUE(test<double>(GetParam()));
+}
+TEST_P(StorageConversionBatchStrideTests, ComplexSinglePrecision) {
+    EXPECT_TRUE(test<std::complex<float>>(GetParam()));
+}
+TEST_P(StorageConversionBatchStrideTests, ComplexDoublePrecision) {
+    EXPECT_TRUE(test<std::complex<double>>(GetParam()));
+}
+
+INSTANTIATE_TEST_SUITE_P(StorageConversionBatchStrideTestSuite, StorageConversionBatchStrideTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
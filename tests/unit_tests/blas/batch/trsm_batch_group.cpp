@@ -0,0 +1,194 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// The second group always solves from the right with an upper triangular
+// matrix, the first one takes its parameters from the test.
+template <typename fp>
+bool test(const device& dev, onemkl::side left_right, onemkl::uplo upper_lower,
+          onemkl::transpose transa, onemkl::diag unit_nonunit, fp alpha) {
+    // Batched trsm is not implemented by the mklgpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare the group configuration.
+    const int64_t group_count = 2;
+    vector<onemkl::side> side = { left_right, onemkl::side::right };
+    vector<onemkl::uplo> uplo = { upper_lower, onemkl::uplo::upper };
+    vector<onemkl::transpose> trans = { transa, onemkl::transpose::nontrans };
+    vector<onemkl::diag> diag = { unit_nonunit, onemkl::diag::nonunit };
+    vector<int64_t> m = { 72, 13 }, n = { 27, 21 }, lda = { 101, 25 }, ldb = { 102, 17 };
+    vector<int64_t> group_size = { 3, 4 };
+    vector<fp> alpha_array = { alpha, fp(1.0) };
+
+    // Matrices of the groups are stored back to back.
+    vector<fp, allocator_helper<fp, 64>> A, B, B_ref;
+    vector<int64_t> offset_a, offset_b;
+    int max_mn = 0;
+    for (int64_t i = 0; i < group_count; i++) {
+        const int dim_a = (side[i] == onemkl::side::left) ? m[i] : n[i];
+        for (int64_t j = 0; j < group_size[i]; j++) {
+            offset_a.push_back(A.size());
+            offset_b.push_back(B.size());
+            A.resize(A.size() + lda[i] * dim_a);
+            B.resize(B.size() + ldb[i] * n[i]);
+            rand_trsm_matrix(A.data() + offset_a.back(), trans[i], dim_a, dim_a, lda[i]);
+            rand_matrix(B.data() + offset_b.back(), onemkl::transpose::nontrans, m[i], n[i],
+                        ldb[i]);
+        }
+        max_mn = std::max<int>(max_mn, std::max(m[i], n[i]));
+    }
+    B_ref = B;
+
+    // Call Reference TRSM on every matrix of the batch.
+    using fp_ref = typename ref_type_info<fp>::type;
+
+    for (int64_t i = 0, idx = 0; i < group_count; i++) {
+        const int m_ref = m[i], n_ref = n[i];
+        const int lda_ref = lda[i], ldb_ref = ldb[i];
+        for (int64_t j = 0; j < group_size[i]; j++, idx++) {
+            ::trsm(convert_to_cblas_side(side[i]), convert_to_cblas_uplo(uplo[i]),
+                   convert_to_cblas_trans(trans[i]), convert_to_cblas_diag(diag[i]), &m_ref,
+                   &n_ref, (fp_ref*)&alpha_array[i], (fp_ref*)A.data() + offset_a[idx], &lda_ref,
+                   (fp_ref*)B_ref.data() + offset_b[idx], &ldb_ref);
+        }
+    }
+
+    // Call DPC++ TRSM_BATCH.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during TRSM_BATCH:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<onemkl::side, 1> side_buffer(side.data(), range<1>(group_count));
+    buffer<onemkl::uplo, 1> uplo_buffer(uplo.data(), range<1>(group_count));
+    buffer<onemkl::transpose, 1> trans_buffer(trans.data(), range<1>(group_count));
+    buffer<onemkl::diag, 1> diag_buffer(diag.data(), range<1>(group_count));
+    buffer<int64_t, 1> m_buffer(m.data(), range<1>(group_count));
+    buffer<int64_t, 1> n_buffer(n.data(), range<1>(group_count));
+    buffer<int64_t, 1> lda_buffer(lda.data(), range<1>(group_count));
+    buffer<int64_t, 1> ldb_buffer(ldb.data(), range<1>(group_count));
+    buffer<int64_t, 1> group_size_buffer(group_size.data(), range<1>(group_count));
+    buffer<fp, 1> alpha_buffer(alpha_array.data(), range<1>(group_count));
+    buffer<fp, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<fp, 1> B_buffer(B.data(), range<1>(B.size()));
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::trsm_batch(main_queue, side_buffer, uplo_buffer, trans_buffer, diag_buffer,
+                                 m_buffer, n_buffer, alpha_buffer, A_buffer, lda_buffer, B_buffer,
+                                 ldb_buffer, group_count, group_size_buffer);
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::trsm_batch,
+                    (main_queue, side_buffer, uplo_buffer, trans_buffer, diag_buffer, m_buffer,
+                     n_buffer, alpha_buffer, A_buffer, lda_buffer, B_buffer, ldb_buffer,
+                     group_count, group_size_buffer));
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during TRSM_BATCH:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good;
+    {
+        auto B_accessor = B_buffer.template get_access<access::mode::read>();
+        good            = check_equal_trsv_vector(B_accessor, B_ref, B.size(), 1, 10 * max_mn,
+                                       std::cout);
+    }
+
+    return good;
+}
+
+class TrsmBatchGroupTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(TrsmBatchGroupTests, RealSinglePrecision) {
+    float alpha(2.0);
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::side::left, onemkl::uplo::lower,
+                            onemkl::transpose::nontrans, onemkl::diag::unit, alpha));
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::side::right, onemkl::uplo::lower,
+                            onemkl::transpose::trans, onemkl::diag::nonunit, alpha));
+}
+TEST_P(TrsmBatchGroupTests, RealDoublePrecision) {
+    double alpha(2.0);
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::side::left, onemkl::uplo::lower,
+                             onemkl::transpose::nontrans, onemkl::diag::unit, alpha));
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::side::right, onemkl::uplo::lower,
+                             onemkl::transpose::trans, onemkl::diag::nonunit, alpha));
+}
+TEST_P(TrsmBatchGroupTests, ComplexSinglePrecision) {
+    std::complex<float> alpha(2.0, -0.5);
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::side::left, onemkl::uplo::lower,
+                                          onemkl::transpose::nontrans, onemkl::diag::unit, alpha));
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::side::right, onemkl::uplo::lower,
+                                          onemkl::transpose::conjtrans, onemkl::diag::nonunit,
+                                          alpha));
+}
+TEST_P(TrsmBatchGroupTests, ComplexDoublePrecision) {
+    std::complex<double> alpha(2.0, -0.5);
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::side::left, onemkl::uplo::lower,
+                                           onemkl::transpose::nontrans, onemkl::diag::unit, alpha));
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::side::right, onemkl::uplo::lower,
+                                           onemkl::transpose::conjtrans, onemkl::diag::nonunit,
+                                           alpha));
+}
+
+INSTANTIATE_TEST_SUITE_P(TrsmBatchGroupTestSuite, TrsmBatchGroupTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,193 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+template <typename fp>
+bool test(const device& dev, onemkl::side left_right, onemkl::uplo upper_lower,
+          onemkl::transpose transa, onemkl::diag unit_nonunit, int m, int n, int lda, int ldb,
+          fp alpha, int batch_size) {
+    // Batched trsm is not implemented by the mklgpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data.
+    const int dim_a        = (left_right == onemkl::side::left) ? m : n;
+    const int64_t stride_a = lda * dim_a + 3;
+    const int64_t stride_b = ldb * n + 5;
+    vector<fp, allocator_helper<fp, 64>> A(stride_a * batch_size), B(stride_b * batch_size), B_ref;
+    for (int i = 0; i < batch_size; i++) {
+        rand_trsm_matrix(A.data() + stride_a * i, transa, dim_a, dim_a, lda);
+        rand_matrix(B.data() + stride_b * i, onemkl::transpose::nontrans, m, n, ldb);
+    }
+    B_ref = B;
+
+    // Call Reference TRSM on every matrix of the batch.
+    const int m_ref = m, n_ref = n;
+    const int lda_ref = lda, ldb_ref = ldb;
+
+    using fp_ref = typename ref_type_info<fp>::type;
+
+    for (int i = 0; i < batch_size; i++) {
+        ::trsm(convert_to_cblas_side(left_right), convert_to_cblas_uplo(upper_lower),
+               convert_to_cblas_trans(transa), convert_to_cblas_diag(unit_nonunit), &m_ref, &n_ref,
+               (fp_ref*)&alpha, (fp_ref*)A.data() + stride_a * i, &lda_ref,
+               (fp_ref*)B_ref.data() + stride_b * i, &ldb_ref);
+    }
+
+    // Call DPC++ TRSM_BATCH.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during TRSM_BATCH:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<fp, 1> B_buffer(B.data(), range<1>(B.size()));
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::trsm_batch(main_queue, left_right, upper_lower, transa, unit_nonunit, m, n,
+                                 alpha, A_buffer, lda, stride_a, B_buffer, ldb, stride_b,
+                                 batch_size);
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::trsm_batch,
+                    (main_queue, left_right, upper_lower, transa, unit_nonunit, m, n, alpha,
+                     A_buffer, lda, stride_a, B_buffer, ldb, stride_b, batch_size));
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during TRSM_BATCH:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good;
+    {
+        auto B_accessor = B_buffer.template get_access<access::mode::read>();
+        good            = check_equal_trsv_vector(B_accessor, B_ref, B.size(), 1,
+                                                  10 * std::max(m, n), std::cout);
+    }
+
+    return good;
+}
+
+class TrsmBatchStrideTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(TrsmBatchStrideTests, RealSinglePrecision) {
+    float alpha(2.0);
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::side::left, onemkl::uplo::lower,
+                            onemkl::transpose::nontrans, onemkl::diag::unit, 72, 27, 101, 102,
+                            alpha, 5));
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::side::right, onemkl::uplo::upper,
+                            onemkl::transpose::trans, onemkl::diag::nonunit, 72, 27, 101, 102,
+                            alpha, 5));
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::side::left, onemkl::uplo::upper,
+                            onemkl::transpose::trans, onemkl::diag::nonunit, 72, 27, 101, 102,
+                            alpha, 5));
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::side::right, onemkl::uplo::lower,
+                            onemkl::transpose::nontrans, onemkl::diag::unit, 72, 27, 101, 102,
+                            alpha, 5));
+}
+TEST_P(TrsmBatchStrideTests, RealDoublePrecision) {
+    double alpha(2.0);
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::side::left, onemkl::uplo::lower,
+                             onemkl::transpose::nontrans, onemkl::diag::unit, 72, 27, 101, 102,
+                             alpha, 5));
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::side::right, onemkl::uplo::upper,
+                             onemkl::transpose::trans, onemkl::diag::nonunit, 72, 27, 101, 102,
+                             alpha, 5));
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::side::left, onemkl::uplo::upper,
+                             onemkl::transpose::trans, onemkl::diag::nonunit, 72, 27, 101, 102,
+                             alpha, 5));
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::side::right, onemkl::uplo::lower,
+                             onemkl::transpose::nontrans, onemkl::diag::unit, 72, 27, 101, 102,
+                             alpha, 5));
+}
+TEST_P(TrsmBatchStrideTests, ComplexSinglePrecision) {
+    std::complex<float> alpha(2.0, -0.5);
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::side::left, onemkl::uplo::lower,
+                                          onemkl::transpose::nontrans, onemkl::diag::unit, 72, 27,
+                                          101, 102, alpha, 5));
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::side::right, onemkl::uplo::upper,
+                                          onemkl::transpose::conjtrans, onemkl::diag::nonunit, 72,
+                                          27, 101, 102, alpha, 5));
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::side::left, onemkl::uplo::upper,
+                                          onemkl::transpose::trans, onemkl::diag::nonunit, 72, 27,
+                                          101, 102, alpha, 5));
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::side::right, onemkl::uplo::lower,
+                                          onemkl::transpose::nontrans, onemkl::diag::unit, 72, 27,
+                                          101, 102, alpha, 5));
+}
+TEST_P(TrsmBatchStrideTests, ComplexDoublePrecision) {
+    std::complex<double> alpha(2.0, -0.5);
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::side::left, onemkl::uplo::lower,
+                                           onemkl::transpose::nontrans, onemkl::diag::unit, 72, 27,
+                                           101, 102, alpha, 5));
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::side::right, onemkl::uplo::upper,
+                                           onemkl::transpose::conjtrans, onemkl::diag::nonunit, 72,
+                                           27, 101, 102, alpha, 5));
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::side::left, onemkl::uplo::upper,
+                                           onemkl::transpose::trans, onemkl::diag::nonunit, 72, 27,
+                                           101, 102, alpha, 5));
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::side::right, onemkl::uplo::lower,
+                                           onemkl::transpose::nontrans, onemkl::diag::unit, 72, 27,
+                                           101, 102, alpha, 5));
+}
+
+INSTANTIATE_TEST_SUITE_P(TrsmBatchStrideTestSuite, TrsmBatchStrideTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
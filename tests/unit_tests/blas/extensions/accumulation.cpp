@@ -0,0 +1,162 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// Element i of a vector in BLAS order.
+template <typename vec>
+float element(const vec& v, int N, int inc, int i) {
+    return v[(inc > 0) ? i * inc : (N - 1 - i) * -inc];
+}
+
+// Float dot, nrm2 and asum of long vectors with nonnegative entries, so that
+// the exact results are well conditioned and any error comes from rounding
+// during the accumulation. The references are computed in double.
+bool test(const device& dev, int N, int incx, int incy, float scale, onemkl::accumulation acc) {
+    // The accumulation modes are only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data.
+    vector<float, allocator_helper<float, 64>> x, y;
+    float result_dot = -1.0f, result_nrm2 = -1.0f, result_asum = -1.0f;
+
+    rand_vector(x, N, incx);
+    rand_vector(y, N, incy);
+    for (auto& v : x)
+        v = scale * (v + 0.5f);
+    for (auto& v : y)
+        v = v + 0.5f;
+
+    // Compute the references in double precision.
+    double dot_ref = 0.0, ssq_ref = 0.0, asum_ref = 0.0;
+    for (int i = 0; i < N; i++) {
+        const double xi = element(x, N, incx, i), yi = element(y, N, incy, i);
+        dot_ref += xi * yi;
+        ssq_ref += xi * xi;
+        asum_ref += std::abs(xi);
+    }
+
+    // Call DPC++ DOT, NRM2 and ASUM.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during DOT/NRM2/ASUM:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<float, 1> x_buffer(x.data(), range<1>(x.size()));
+    buffer<float, 1> y_buffer(y.data(), range<1>(y.size()));
+    buffer<float, 1> dot_buffer(&result_dot, range<1>(1));
+    buffer<float, 1> nrm2_buffer(&result_nrm2, range<1>(1));
+    buffer<float, 1> asum_buffer(&result_asum, range<1>(1));
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::dot(main_queue, N, x_buffer, incx, y_buffer, incy, dot_buffer, acc);
+        onemkl::blas::nrm2(main_queue, N, x_buffer, std::abs(incx), nrm2_buffer, acc);
+        onemkl::blas::asum(main_queue, N, x_buffer, std::abs(incx), asum_buffer, acc);
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::dot,
+                    (main_queue, N, x_buffer, incx, y_buffer, incy, dot_buffer, acc));
+        TEST_RUN_CT(main_queue, onemkl::blas::nrm2,
+                    (main_queue, N, x_buffer, std::abs(incx), nrm2_buffer, acc));
+        TEST_RUN_CT(main_queue, onemkl::blas::asum,
+                    (main_queue, N, x_buffer, std::abs(incx), asum_buffer, acc));
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during DOT/NRM2/ASUM:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    //  Both modes should stay within a few float roundings of the exact results,
+    //  however long the vectors.
+    bool good = true;
+    {
+        auto dot_accessor  = dot_buffer.template get_access<access::mode::read>();
+        auto nrm2_accessor = nrm2_buffer.template get_access<access::mode::read>();
+        auto asum_accessor = asum_buffer.template get_access<access::mode::read>();
+        good &= check_equal(dot_accessor[0], float(dot_ref), 10, std::cout);
+        good &= check_equal(nrm2_accessor[0], float(std::sqrt(ssq_ref)), 10, std::cout);
+        good &= check_equal(asum_accessor[0], float(asum_ref), 10, std::cout);
+    }
+
+    return good;
+}
+
+class AccumulationTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(AccumulationTests, Extended) {
+    EXPECT_TRUE(test(GetParam(), 1 << 22, 1, 1, 1.0f, onemkl::accumulation::extended));
+    EXPECT_TRUE(test(GetParam(), 1357, 1, 1, 1.0f, onemkl::accumulation::extended));
+    EXPECT_TRUE(test(GetParam(), 1 << 20, 2, -3, 1.0f, onemkl::accumulation::extended));
+}
+TEST_P(AccumulationTests, Pairwise) {
+    EXPECT_TRUE(test(GetParam(), 1 << 22, 1, 1, 1.0f, onemkl::accumulation::pairwise));
+    EXPECT_TRUE(test(GetParam(), 1357, 1, 1, 1.0f, onemkl::accumulation::pairwise));
+    EXPECT_TRUE(test(GetParam(), 1 << 20, 2, -3, 1.0f, onemkl::accumulation::pairwise));
+}
+TEST_P(AccumulationTests, PairwiseScaled) {
+    // Squares of these overflow or underflow in float, so nrm2 falls back to
+    //  double.
+    EXPECT_TRUE(test(GetParam(), 1 << 16, 1, 1, 1e20f, onemkl::accumulation::pairwise));
+    EXPECT_TRUE(test(GetParam(), 1 << 16, 1, 1, 1e-25f, onemkl::accumulation::pairwise));
+}
+
+INSTANTIATE_TEST_SUITE_P(AccumulationTestSuite, AccumulationTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
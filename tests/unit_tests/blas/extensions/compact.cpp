@@ -0,0 +1,331 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+auto exception_handler = [](exception_list exceptions) {
+    for (std::exception_ptr const& e : exceptions) {
+        try {
+            std::rethrow_exception(e);
+        }
+        catch (exception const& e) {
+            std::cout << "Caught asynchronous SYCL exception during COMPACT:\n"
+                      << e.what() << std::endl
+                      << "OpenCL status: " << e.get_cl_code() << std::endl;
+        }
+    }
+};
+
+// Number of elements of a compact batch of matrices with leading dimension ld.
+template <typename fp>
+int64_t compact_size(int64_t ld, int64_t cols, int64_t batch_size) {
+    const int64_t w = onemkl::compact_width<fp>();
+    return (batch_size + w - 1) / w * w * ld * cols;
+}
+
+template <typename fp>
+bool test_gemm(const device& dev, onemkl::transpose transa, onemkl::transpose transb, int m,
+               int n, int k, fp alpha, fp beta, int batch_size) {
+    // Compact routines are only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data.
+    const int rows_a       = (transa == onemkl::transpose::nontrans) ? m : k;
+    const int cols_a       = (transa == onemkl::transpose::nontrans) ? k : m;
+    const int rows_b       = (transb == onemkl::transpose::nontrans) ? k : n;
+    const int cols_b       = (transb == onemkl::transpose::nontrans) ? n : k;
+    const int lda          = rows_a + 1, ldb = rows_b + 2, ldc = m + 3;
+    const int64_t stride_a = lda * cols_a + 3;
+    const int64_t stride_b = ldb * cols_b + 1;
+    const int64_t stride_c = ldc * n + 2;
+    vector<fp, allocator_helper<fp, 64>> A, B, C, C_ref;
+    rand_vector(A, stride_a * batch_size, 1);
+    rand_vector(B, stride_b * batch_size, 1);
+    rand_vector(C, stride_c * batch_size, 1);
+    C_ref = C;
+
+    // Call Reference GEMM on every matrix of the batch.
+    const int m_ref = m, n_ref = n, k_ref = k;
+
+    using fp_ref = typename ref_type_info<fp>::type;
+
+    for (int i = 0; i < batch_size; i++) {
+        ::gemm(convert_to_cblas_trans(transa), convert_to_cblas_trans(transb), &m_ref, &n_ref,
+               &k_ref, (fp_ref*)&alpha, (fp_ref*)A.data() + stride_a * i, &lda,
+               (fp_ref*)B.data() + stride_b * i, &ldb, (fp_ref*)&beta,
+               (fp_ref*)C_ref.data() + stride_c * i, &ldc);
+    }
+
+    // Pack the batch, call DPC++ GEMM_COMPACT and unpack C.
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<fp, 1> B_buffer(B.data(), range<1>(B.size()));
+    buffer<fp, 1> C_buffer(C.data(), range<1>(C.size()));
+    buffer<fp, 1> AP_buffer(range<1>(compact_size<fp>(lda, cols_a, batch_size)));
+    buffer<fp, 1> BP_buffer(range<1>(compact_size<fp>(ldb, cols_b, batch_size)));
+    buffer<fp, 1> CP_buffer(range<1>(compact_size<fp>(ldc, n, batch_size)));
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::gepack_compact(main_queue, rows_a, cols_a, A_buffer, lda, stride_a,
+                                     AP_buffer, lda, batch_size);
+        onemkl::blas::gepack_compact(main_queue, rows_b, cols_b, B_buffer, ldb, stride_b,
+                                     BP_buffer, ldb, batch_size);
+        onemkl::blas::gepack_compact(main_queue, m, n, C_buffer, ldc, stride_c, CP_buffer, ldc,
+                                     batch_size);
+        onemkl::blas::gemm_compact(main_queue, transa, transb, m, n, k, alpha, AP_buffer, lda,
+                                   BP_buffer, ldb, beta, CP_buffer, ldc, batch_size);
+        onemkl::blas::geunpack_compact(main_queue, m, n, CP_buffer, ldc, C_buffer, ldc, stride_c,
+                                       batch_size);
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::gepack_compact,
+                    (main_queue, rows_a, cols_a, A_buffer, lda, stride_a, AP_buffer, lda,
+                     batch_size));
+        TEST_RUN_CT(main_queue, onemkl::blas::gepack_compact,
+                    (main_queue, rows_b, cols_b, B_buffer, ldb, stride_b, BP_buffer, ldb,
+                     batch_size));
+        TEST_RUN_CT(main_queue, onemkl::blas::gepack_compact,
+                    (main_queue, m, n, C_buffer, ldc, stride_c, CP_buffer, ldc, batch_size));
+        TEST_RUN_CT(main_queue, onemkl::blas::gemm_compact,
+                    (main_queue, transa, transb, m, n, k, alpha, AP_buffer, lda, BP_buffer, ldb,
+                     beta, CP_buffer, ldc, batch_size));
+        TEST_RUN_CT(main_queue, onemkl::blas::geunpack_compact,
+                    (main_queue, m, n, CP_buffer, ldc, C_buffer, ldc, stride_c, batch_size));
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during COMPACT:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    auto C_accessor = C_buffer.template get_access<access::mode::read>();
+    bool good       = check_equal_vector(C_accessor, C_ref, C.size(), 1, 10 * k, std::cout);
+
+    return good;
+}
+
+template <typename fp>
+bool test_trsm(const device& dev, onemkl::side left_right, onemkl::uplo upper_lower,
+               onemkl::transpose transa, onemkl::diag unit_nonunit, int m, int n, fp alpha,
+               int batch_size) {
+    // Compact routines are only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data.
+    const int dim_a        = (left_right == onemkl::side::left) ? m : n;
+    const int lda          = dim_a + 1, ldb = m + 2;
+    const int64_t stride_a = lda * dim_a + 3;
+    const int64_t stride_b = ldb * n + 5;
+    vector<fp, allocator_helper<fp, 64>> A(stride_a * batch_size), B(stride_b * batch_size), B_ref;
+    for (int i = 0; i < batch_size; i++) {
+        rand_trsm_matrix(A.data() + stride_a * i, transa, dim_a, dim_a, lda);
+        rand_matrix(B.data() + stride_b * i, onemkl::transpose::nontrans, m, n, ldb);
+    }
+    B_ref = B;
+
+    // Call Reference TRSM on every matrix of the batch.
+    const int m_ref = m, n_ref = n;
+
+    using fp_ref = typename ref_type_info<fp>::type;
+
+    for (int i = 0; i < batch_size; i++) {
+        ::trsm(convert_to_cblas_side(left_right), convert_to_cblas_uplo(upper_lower),
+               convert_to_cblas_trans(transa), convert_to_cblas_diag(unit_nonunit), &m_ref, &n_ref,
+               (fp_ref*)&alpha, (fp_ref*)A.data() + stride_a * i, &lda,
+               (fp_ref*)B_ref.data() + stride_b * i, &ldb);
+    }
+
+    // Pack the batch, call DPC++ TRSM_COMPACT and unpack B.
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<fp, 1> B_buffer(B.data(), range<1>(B.size()));
+    buffer<fp, 1> AP_buffer(range<1>(compact_size<fp>(lda, dim_a, batch_size)));
+    buffer<fp, 1> BP_buffer(range<1>(compact_size<fp>(ldb, n, batch_size)));
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::gepack_compact(main_queue, dim_a, dim_a, A_buffer, lda, stride_a, AP_buffer,
+                                     lda, batch_size);
+        onemkl::blas::gepack_compact(main_queue, m, n, B_buffer, ldb, stride_b, BP_buffer, ldb,
+                                     batch_size);
+        onemkl::blas::trsm_compact(main_queue, left_right, upper_lower, transa, unit_nonunit, m,
+                                   n, alpha, AP_buffer, lda, BP_buffer, ldb, batch_size);
+        onemkl::blas::geunpack_compact(main_queue, m, n, BP_buffer, ldb, B_buffer, ldb, stride_b,
+                                       batch_size);
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::gepack_compact,
+                    (main_queue, dim_a, dim_a, A_buffer, lda, stride_a, AP_buffer, lda,
+                     batch_size));
+        TEST_RUN_CT(main_queue, onemkl::blas::gepack_compact,
+                    (main_queue, m, n, B_buffer, ldb, stride_b, BP_buffer, ldb, batch_size));
+        TEST_RUN_CT(main_queue, onemkl::blas::trsm_compact,
+                    (main_queue, left_right, upper_lower, transa, unit_nonunit, m, n, alpha,
+                     AP_buffer, lda, BP_buffer, ldb, batch_size));
+        TEST_RUN_CT(main_queue, onemkl::blas::geunpack_compact,
+                    (main_queue, m, n, BP_buffer, ldb, B_buffer, ldb, stride_b, batch_size));
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during COMPACT:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    auto B_accessor = B_buffer.template get_access<access::mode::read>();
+    bool good = check_equal_trsv_vector(B_accessor, B_ref, B.size(), 1, std::max(m, n), std::cout);
+
+    return good;
+}
+
+// LU without pivoting is checked by multiplying its factors back.
+template <typename fp>
+bool test_getrfnp(const device& dev, int m, int n, int batch_size) {
+    // Compact routines are only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data: diagonally dominant matrices, which need no pivoting.
+    const int lda          = m + 1;
+    const int64_t stride_a = lda * n + 4;
+    vector<fp, allocator_helper<fp, 64>> A(stride_a * batch_size), A_ref;
+    for (int i = 0; i < batch_size; i++)
+        rand_trsm_matrix(A.data() + stride_a * i, onemkl::transpose::nontrans, m, n, lda);
+    A_ref = A;
+
+    // Pack the batch, call DPC++ GETRFNP_COMPACT and unpack the factors.
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<fp, 1> AP_buffer(range<1>(compact_size<fp>(lda, n, batch_size)));
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::gepack_compact(main_queue, m, n, A_buffer, lda, stride_a, AP_buffer, lda,
+                                     batch_size);
+        onemkl::blas::getrfnp_compact(main_queue, m, n, AP_buffer, lda, batch_size);
+        onemkl::blas::geunpack_compact(main_queue, m, n, AP_buffer, lda, A_buffer, lda, stride_a,
+                                       batch_size);
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::gepack_compact,
+                    (main_queue, m, n, A_buffer, lda, stride_a, AP_buffer, lda, batch_size));
+        TEST_RUN_CT(main_queue, onemkl::blas::getrfnp_compact,
+                    (main_queue, m, n, AP_buffer, lda, batch_size));
+        TEST_RUN_CT(main_queue, onemkl::blas::geunpack_compact,
+                    (main_queue, m, n, AP_buffer, lda, A_buffer, lda, stride_a, batch_size));
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during COMPACT:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare L * U with the original matrices.
+    auto A_accessor = A_buffer.template get_access<access::mode::read>();
+    bool good       = true;
+    for (int p = 0; p < batch_size; p++) {
+        const int64_t off = stride_a * p;
+        for (int j = 0; j < n; j++) {
+            for (int i = 0; i < m; i++) {
+                fp lu = 0;
+                for (int q = 0; q <= std::min(i, j); q++) {
+                    const fp l = (q == i) ? fp(1) : A_accessor[off + i + lda * q];
+                    lu += l * A_accessor[off + q + lda * j];
+                }
+                if (!check_equal(lu, A_ref[off + i + lda * j], 10 * std::min(m, n), std::cout))
+                    good = false;
+            }
+        }
+    }
+
+    return good;
+}
+
+class CompactTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(CompactTests, GemmRealSinglePrecision) {
+    EXPECT_TRUE(test_gemm<float>(GetParam(), onemkl::transpose::nontrans,
+                                 onemkl::transpose::nontrans, 8, 8, 8, 2.0f, 3.0f, 37));
+    EXPECT_TRUE(test_gemm<float>(GetParam(), onemkl::transpose::trans, onemkl::transpose::trans,
+                                 5, 7, 4, 2.0f, 0.0f, 16));
+}
+TEST_P(CompactTests, GemmRealDoublePrecision) {
+    EXPECT_TRUE(test_gemm<double>(GetParam(), onemkl::transpose::nontrans,
+                                  onemkl::transpose::trans, 4, 4, 4, 2.0, 3.0, 21));
+    EXPECT_TRUE(test_gemm<double>(GetParam(), onemkl::transpose::trans,
+                                  onemkl::transpose::nontrans, 16, 9, 12, 2.0, 0.5, 3));
+}
+TEST_P(CompactTests, TrsmRealSinglePrecision) {
+    EXPECT_TRUE(test_trsm<float>(GetParam(), onemkl::side::left, onemkl::uplo::lower,
+                                 onemkl::transpose::nontrans, onemkl::diag::nonunit, 8, 6, 2.0f,
+                                 37));
+    EXPECT_TRUE(test_trsm<float>(GetParam(), onemkl::side::right, onemkl::uplo::upper,
+                                 onemkl::transpose::trans, onemkl::diag::unit, 5, 7, 2.0f, 20));
+}
+TEST_P(CompactTests, TrsmRealDoublePrecision) {
+    EXPECT_TRUE(test_trsm<double>(GetParam(), onemkl::side::left, onemkl::uplo::upper,
+                                  onemkl::transpose::trans, onemkl::diag::nonunit, 6, 4, 2.0,
+                                  19));
+    EXPECT_TRUE(test_trsm<double>(GetParam(), onemkl::side::right, onemkl::uplo::lower,
+                                  onemkl::transpose::nontrans, onemkl::diag::nonunit, 4, 8, 0.5,
+                                  9));
+}
+TEST_P(CompactTests, GetrfnpRealSinglePrecision) {
+    EXPECT_TRUE(test_getrfnp<float>(GetParam(), 8, 8, 35));
+    EXPECT_TRUE(test_getrfnp<float>(GetParam(), 6, 4, 16));
+}
+TEST_P(CompactTests, GetrfnpRealDoublePrecision) {
+    EXPECT_TRUE(test_getrfnp<double>(GetParam(), 5, 5, 13));
+    EXPECT_TRUE(test_getrfnp<double>(GetParam(), 4, 7, 8));
+}
+
+INSTANTIATE_TEST_SUITE_P(CompactTestSuite, CompactTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,161 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// Random values with full float mantissas, spread over the normal range of fp16.
+template <typename fp>
+fp rand_convert_scalar() {
+    float mantissa = 1.5f + rand_scalar<float>();
+    if (std::rand() % 2)
+        mantissa = -mantissa;
+    return fp(std::ldexp(mantissa, std::rand() % 29 - 14));
+}
+
+template <typename fp_src, typename fp_dst>
+bool test(const device& dev, int m, int n, int lda, int ldb, bool vector_api) {
+    // Conversions are only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data.
+    vector<fp_src, allocator_helper<fp_src, 64>> A(lda * n);
+    vector<fp_dst, allocator_helper<fp_dst, 64>> B(ldb * n, fp_dst(-1.0f));
+    for (auto& a : A)
+        a = rand_convert_scalar<fp_src>();
+    auto B_ref = B;
+
+    // Reference conversion, one element at a time.
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < m; i++)
+            B_ref[i + ldb * j] = fp_dst(float(A[i + lda * j]));
+
+    // Call DPC++ conversion.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during CONVERT:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp_src, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<fp_dst, 1> B_buffer(B.data(), range<1>(B.size()));
+
+    try {
+#ifdef CALL_RT_API
+        if (vector_api)
+            onemkl::blas::convert(main_queue, m * n, A_buffer, B_buffer);
+        else
+            onemkl::blas::convert(main_queue, m, n, A_buffer, lda, B_buffer, ldb);
+#else
+        if (vector_api) {
+            TEST_RUN_CT(main_queue, onemkl::blas::convert,
+                        (main_queue, m * n, A_buffer, B_buffer));
+        }
+        else {
+            TEST_RUN_CT(main_queue, onemkl::blas::convert,
+                        (main_queue, m, n, A_buffer, lda, B_buffer, ldb));
+        }
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during CONVERT:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation. The
+    // conversion is exact, padding between columns of B must be left untouched.
+    bool good;
+    {
+        auto B_accessor = B_buffer.template get_access<access::mode::read>();
+        vector<float> B_result(B.size()), B_expected(B.size());
+        for (size_t i = 0; i < B.size(); i++) {
+            B_result[i]   = float(B_accessor[i]);
+            B_expected[i] = float(B_ref[i]);
+        }
+        good = check_equal_matrix(B_result, B_expected, ldb, n, ldb, 1, std::cout);
+    }
+
+    return good;
+}
+
+class ConvertTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(ConvertTests, HalfToSingle) {
+    EXPECT_TRUE((test<half, float>(GetParam(), 1357, 1, 1357, 1357, true)));
+    EXPECT_TRUE((test<half, float>(GetParam(), 1000, 1000, 1000, 1000, true)));
+    EXPECT_TRUE((test<half, float>(GetParam(), 79, 83, 101, 103, false)));
+    EXPECT_TRUE((test<half, float>(GetParam(), 1000, 1000, 1003, 1001, false)));
+}
+TEST_P(ConvertTests, SingleToHalf) {
+    EXPECT_TRUE((test<float, half>(GetParam(), 1357, 1, 1357, 1357, true)));
+    EXPECT_TRUE((test<float, half>(GetParam(), 1000, 1000, 1000, 1000, true)));
+    EXPECT_TRUE((test<float, half>(GetParam(), 79, 83, 101, 103, false)));
+    EXPECT_TRUE((test<float, half>(GetParam(), 1000, 1000, 1003, 1001, false)));
+}
+TEST_P(ConvertTests, BFloat16ToSingle) {
+    EXPECT_TRUE((test<onemkl::bfloat16, float>(GetParam(), 1357, 1, 1357, 1357, true)));
+    EXPECT_TRUE((test<onemkl::bfloat16, float>(GetParam(), 1000, 1000, 1000, 1000, true)));
+    EXPECT_TRUE((test<onemkl::bfloat16, float>(GetParam(), 79, 83, 101, 103, false)));
+    EXPECT_TRUE((test<onemkl::bfloat16, float>(GetParam(), 1000, 1000, 1003, 1001, false)));
+}
+TEST_P(ConvertTests, SingleToBFloat16) {
+    EXPECT_TRUE((test<float, onemkl::bfloat16>(GetParam(), 1357, 1, 1357, 1357, true)));
+    EXPECT_TRUE((test<float, onemkl::bfloat16>(GetParam(), 1000, 1000, 1000, 1000, true)));
+    EXPECT_TRUE((test<float, onemkl::bfloat16>(GetParam(), 79, 83, 101, 103, false)));
+    EXPECT_TRUE((test<float, onemkl::bfloat16>(GetParam(), 1000, 1000, 1003, 1001, false)));
+}
+
+INSTANTIATE_TEST_SUITE_P(ConvertTestSuite, ConvertTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
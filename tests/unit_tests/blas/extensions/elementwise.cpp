@@ -0,0 +1,295 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// Catch asynchronous exceptions.
+auto exception_handler = [](exception_list exceptions) {
+    for (std::exception_ptr const& e : exceptions) {
+        try {
+            std::rethrow_exception(e);
+        }
+        catch (exception const& e) {
+            std::cout << "Caught asynchronous SYCL exception during ELEMENTWISE:\n"
+                      << e.what() << std::endl
+                      << "OpenCL status: " << e.get_cl_code() << std::endl;
+        }
+    }
+};
+
+enum class elementwise_op { mul, div, fma };
+
+// Index of element (i, j) of an operand of m rows whose rows are inc and
+// columns ld apart, a negative increment running the rows backwards.
+int element_index(int i, int j, int m, int inc, int ld) {
+    return ((inc > 0) ? i * inc : (m - 1 - i) * (-inc)) + j * ld;
+}
+
+// Number of elements spanned by such an operand with n columns.
+int operand_size(int m, int n, int inc, int ld) {
+    return element_index(m - 1, n - 1, m, std::abs(inc), ld) + 1;
+}
+
+// c = a * b, c = a / b or c = alpha * a * b + beta * c, elementwise on the
+// m x n matrices a, b and c through omatmul, omatdiv or omatfma, or on the
+// vectors of m elements a, b and c through vmul, vdiv or vfma when matrix is
+// not set. ld_a, ld_b and ld_c are the leading dimensions of the matrices or
+// the increments of the vectors.
+template <typename fp>
+bool test(const device& dev, elementwise_op op, bool matrix, int m, int n, int ld_a, int ld_b,
+          int ld_c, fp alpha, fp beta) {
+    // Elementwise operations are only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+    if (!matrix)
+        n = 1;
+
+    // Prepare data.
+    const int inc_a = matrix ? 1 : ld_a, inc_b = matrix ? 1 : ld_b, inc_c = matrix ? 1 : ld_c;
+    if (!matrix)
+        ld_a = ld_b = ld_c = 0;
+
+    vector<fp, allocator_helper<fp, 64>> A, B, C, C_ref;
+    rand_vector(A, operand_size(m, n, inc_a, ld_a), 1);
+    rand_vector(B, operand_size(m, n, inc_b, ld_b), 1);
+    rand_vector(C, operand_size(m, n, inc_c, ld_c), 1);
+    // Keep the divisors away from zero.
+    for (auto& b : B)
+        b += fp(2.0);
+    // C is only read by fma with a nonzero beta. Otherwise its elements are
+    // seeded with NaN, which would reach the result if they were read.
+    if (op != elementwise_op::fma || beta == fp(0.0)) {
+        for (int j = 0; j < n; j++)
+            for (int i = 0; i < m; i++)
+                C[element_index(i, j, m, inc_c, ld_c)] =
+                    fp(std::numeric_limits<double>::quiet_NaN());
+    }
+    C_ref = C;
+
+    // Reference elementwise operation.
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < m; i++) {
+            const fp a = A[element_index(i, j, m, inc_a, ld_a)];
+            const fp b = B[element_index(i, j, m, inc_b, ld_b)];
+            fp& c      = C_ref[element_index(i, j, m, inc_c, ld_c)];
+            if (op == elementwise_op::mul)
+                c = a * b;
+            else if (op == elementwise_op::div)
+                c = a / b;
+            else if (beta == fp(0.0))
+                c = alpha * a * b;
+            else
+                c = alpha * a * b + beta * c;
+        }
+    }
+
+    // Call DPC++ elementwise operation.
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<fp, 1> B_buffer(B.data(), range<1>(B.size()));
+    buffer<fp, 1> C_buffer(C.data(), range<1>(C.size()));
+
+    try {
+#ifdef CALL_RT_API
+        if (matrix && op == elementwise_op::mul)
+            onemkl::blas::omatmul(main_queue, m, n, A_buffer, ld_a, B_buffer, ld_b, C_buffer,
+                                  ld_c);
+        else if (matrix && op == elementwise_op::div)
+            onemkl::blas::omatdiv(main_queue, m, n, A_buffer, ld_a, B_buffer, ld_b, C_buffer,
+                                  ld_c);
+        else if (matrix)
+            onemkl::blas::omatfma(main_queue, m, n, alpha, A_buffer, ld_a, B_buffer, ld_b, beta,
+                                  C_buffer, ld_c);
+        else if (op == elementwise_op::mul)
+            onemkl::blas::vmul(main_queue, m, A_buffer, inc_a, B_buffer, inc_b, C_buffer, inc_c);
+        else if (op == elementwise_op::div)
+            onemkl::blas::vdiv(main_queue, m, A_buffer, inc_a, B_buffer, inc_b, C_buffer, inc_c);
+        else
+            onemkl::blas::vfma(main_queue, m, alpha, A_buffer, inc_a, B_buffer, inc_b, beta,
+                               C_buffer, inc_c);
+#else
+        if (matrix && op == elementwise_op::mul) {
+            TEST_RUN_CT(main_queue, onemkl::blas::omatmul,
+                        (main_queue, m, n, A_buffer, ld_a, B_buffer, ld_b, C_buffer, ld_c));
+        }
+        else if (matrix && op == elementwise_op::div) {
+            TEST_RUN_CT(main_queue, onemkl::blas::omatdiv,
+                        (main_queue, m, n, A_buffer, ld_a, B_buffer, ld_b, C_buffer, ld_c));
+        }
+        else if (matrix) {
+            TEST_RUN_CT(main_queue, onemkl::blas::omatfma,
+                        (main_queue, m, n, alpha, A_buffer, ld_a, B_buffer, ld_b, beta, C_buffer,
+                         ld_c));
+        }
+        else if (op == elementwise_op::mul) {
+            TEST_RUN_CT(main_queue, onemkl::blas::vmul,
+                        (main_queue, m, A_buffer, inc_a, B_buffer, inc_b, C_buffer, inc_c));
+        }
+        else if (op == elementwise_op::div) {
+            TEST_RUN_CT(main_queue, onemkl::blas::vdiv,
+                        (main_queue, m, A_buffer, inc_a, B_buffer, inc_b, C_buffer, inc_c));
+        }
+        else {
+            TEST_RUN_CT(main_queue, onemkl::blas::vfma,
+                        (main_queue, m, alpha, A_buffer, inc_a, B_buffer, inc_b, beta, C_buffer,
+                         inc_c));
+        }
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during ELEMENTWISE:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    auto C_accessor = C_buffer.template get_access<access::mode::read>();
+    bool good       = check_equal_vector(C_accessor, C_ref, C.size(), 1, 10, std::cout);
+
+    return good;
+}
+
+// b = a limited to [lo, hi], elementwise on m x n matrices through omatclamp
+// or on vectors of m elements through vclamp when matrix is not set.
+template <typename fp>
+bool test_clamp(const device& dev, bool matrix, int m, int n, int ld_a, int ld_b, fp lo, fp hi) {
+    // Elementwise operations are only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+    if (!matrix)
+        n = 1;
+
+    // Prepare data.
+    const int inc_a = matrix ? 1 : ld_a, inc_b = matrix ? 1 : ld_b;
+    if (!matrix)
+        ld_a = ld_b = 0;
+
+    vector<fp, allocator_helper<fp, 64>> A, B, B_ref;
+    rand_vector(A, operand_size(m, n, inc_a, ld_a), 1);
+    rand_vector(B, operand_size(m, n, inc_b, ld_b), 1);
+    B_ref = B;
+
+    // Reference clamp.
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < m; i++)
+            B_ref[element_index(i, j, m, inc_b, ld_b)] =
+                std::min(std::max(A[element_index(i, j, m, inc_a, ld_a)], lo), hi);
+
+    // Call DPC++ OMATCLAMP or VCLAMP.
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<fp, 1> B_buffer(B.data(), range<1>(B.size()));
+
+    try {
+#ifdef CALL_RT_API
+        if (matrix)
+            onemkl::blas::omatclamp(main_queue, m, n, lo, hi, A_buffer, ld_a, B_buffer, ld_b);
+        else
+            onemkl::blas::vclamp(main_queue, m, lo, hi, A_buffer, inc_a, B_buffer, inc_b);
+#else
+        if (matrix) {
+            TEST_RUN_CT(main_queue, onemkl::blas::omatclamp,
+                        (main_queue, m, n, lo, hi, A_buffer, ld_a, B_buffer, ld_b));
+        }
+        else {
+            TEST_RUN_CT(main_queue, onemkl::blas::vclamp,
+                        (main_queue, m, lo, hi, A_buffer, inc_a, B_buffer, inc_b));
+        }
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during CLAMP:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    auto B_accessor = B_buffer.template get_access<access::mode::read>();
+    bool good       = check_equal_vector(B_accessor, B_ref, B.size(), 1, 1, std::cout);
+
+    return good;
+}
+
+class ElementwiseTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(ElementwiseTests, RealSinglePrecision) {
+    for (elementwise_op op : { elementwise_op::mul, elementwise_op::div, elementwise_op::fma }) {
+        EXPECT_TRUE(test<float>(GetParam(), op, false, 1357, 1, 1, 2, -3, 2.0f, 0.5f));
+        EXPECT_TRUE(test<float>(GetParam(), op, true, 73, 27, 81, 73, 75, 2.0f, 0.0f));
+    }
+    EXPECT_TRUE(test_clamp<float>(GetParam(), false, 1357, 1, -2, 1, -0.25f, 0.25f));
+    EXPECT_TRUE(test_clamp<float>(GetParam(), true, 73, 27, 81, 75, -0.25f, 0.25f));
+}
+TEST_P(ElementwiseTests, RealDoublePrecision) {
+    for (elementwise_op op : { elementwise_op::mul, elementwise_op::div, elementwise_op::fma }) {
+        EXPECT_TRUE(test<double>(GetParam(), op, false, 1357, 1, 1, 2, -3, 2.0, 0.5));
+        EXPECT_TRUE(test<double>(GetParam(), op, true, 73, 27, 81, 73, 75, 2.0, 0.0));
+    }
+    EXPECT_TRUE(test_clamp<double>(GetParam(), false, 1357, 1, -2, 1, -0.25, 0.25));
+    EXPECT_TRUE(test_clamp<double>(GetParam(), true, 73, 27, 81, 75, -0.25, 0.25));
+}
+TEST_P(ElementwiseTests, ComplexSinglePrecision) {
+    std::complex<float> alpha(2.0, -0.5);
+    std::complex<float> beta(-1.5, 0.5);
+    for (elementwise_op op : { elementwise_op::mul, elementwise_op::div, elementwise_op::fma }) {
+        EXPECT_TRUE(test<std::complex<float>>(GetParam(), op, false, 1357, 1, 1, 2, -3, alpha,
+                                              beta));
+        EXPECT_TRUE(test<std::complex<float>>(GetParam(), op, true, 73, 27, 81, 73, 75, alpha,
+                                              beta));
+    }
+}
+TEST_P(ElementwiseTests, ComplexDoublePrecision) {
+    std::complex<double> alpha(2.0, -0.5);
+    std::complex<double> beta(-1.5, 0.5);
+    for (elementwise_op op : { elementwise_op::mul, elementwise_op::div, elementwise_op::fma }) {
+        EXPECT_TRUE(test<std::complex<double>>(GetParam(), op, false, 1357, 1, 1, 2, -3, alpha,
+                                               beta));
+        EXPECT_TRUE(test<std::complex<double>>(GetParam(), op, true, 73, 27, 81, 73, 75, alpha,
+                                               beta));
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(ElementwiseTestSuite, ElementwiseTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,294 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// fp16 values are random floats rounded to half precision.
+template <typename T>
+T rand_elem() {
+    return rand_scalar<T>();
+}
+template <>
+half rand_elem<half>() {
+    return half(rand_scalar<float>());
+}
+
+template <typename T>
+double to_double(T x) {
+    return double(x);
+}
+double to_double(half x) {
+    return double(float(x));
+}
+
+// Element (i, j) of op(M).
+template <typename T>
+double op_elem(const T* M, onemkl::transpose trans, int64_t i, int64_t j, int64_t ld) {
+    return to_double((trans == onemkl::transpose::nontrans) ? M[i + ld * j] : M[j + ld * i]);
+}
+
+// Results are compared with the accuracy of C: fp16 and float C within a few
+// roundings, int32 C exactly.
+bool check_elem(half x, double x_ref, int64_t k) {
+    return std::abs(float(x) - x_ref) <= (2.0 / 1024) * (std::abs(x_ref) + 1.0);
+}
+bool check_elem(float x, double x_ref, int64_t k) {
+    return std::abs(x - x_ref) <=
+           10.0 * k * std::numeric_limits<float>::epsilon() * (std::abs(x_ref) + 1.0);
+}
+bool check_elem(int32_t x, double x_ref, int64_t k) {
+    return x == int32_t(std::nearbyint(x_ref));
+}
+
+// Mixed precision gemm_batch, either strided or grouped with offsets. The
+// problems of the batch are described one by one so that both variants share
+// the reference computation.
+template <typename fp_a, typename fp_b, typename fp_c, typename fp_s>
+bool test(const device& dev, bool grouped, onemkl::transpose transa_0, onemkl::transpose transb_0,
+          fp_s alpha_0, fp_s beta_0) {
+    // These types are only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare the batch: three groups of different shapes, or one shape
+    // repeated with a stride.
+    vector<int64_t> dim_m = { 5, 16, 33 }, dim_n = { 7, 12, 24 }, dim_k = { 9, 33, 17 };
+    vector<int64_t> group_size = { 4, 2, 3 };
+    if (!grouped) {
+        dim_m      = { 13 };
+        dim_n      = { 17 };
+        dim_k      = { 19 };
+        group_size = { 5 };
+    }
+    const int64_t group_count = dim_m.size();
+
+    vector<onemkl::transpose> transa, transb;
+    vector<int64_t> m, n, k, lda, ldb, ldc;
+    vector<fp_s> alpha, beta;
+    for (int64_t i = 0; i < group_count; i++) {
+        transa.push_back((i % 2) ? onemkl::transpose::nontrans : transa_0);
+        transb.push_back((i % 2) ? onemkl::transpose::nontrans : transb_0);
+        m.push_back(dim_m[i]);
+        n.push_back(dim_n[i]);
+        k.push_back(dim_k[i]);
+        lda.push_back(((transa[i] == onemkl::transpose::nontrans) ? m[i] : k[i]) + 3);
+        ldb.push_back(((transb[i] == onemkl::transpose::nontrans) ? k[i] : n[i]) + 2);
+        ldc.push_back(m[i] + 1);
+        alpha.push_back((i % 2) ? fp_s(1.0f) : alpha_0);
+        beta.push_back((i % 2) ? fp_s(0.0f) : beta_0);
+    }
+
+    // Matrices of the batch follow each other with a gap, which is the
+    // stride minus the matrix size in the strided case.
+    const int64_t gap = 5;
+    vector<int64_t> offset_a, offset_b, offset_c;
+    int64_t size_a = 0, size_b = 0, size_c = 0;
+    for (int64_t i = 0; i < group_count; i++) {
+        for (int64_t j = 0; j < group_size[i]; j++) {
+            offset_a.push_back(size_a);
+            offset_b.push_back(size_b);
+            offset_c.push_back(size_c);
+            size_a += matrix_size(transa[i], m[i], k[i], lda[i]) + gap;
+            size_b += matrix_size(transb[i], k[i], n[i], ldb[i]) + gap;
+            size_c += matrix_size(onemkl::transpose::nontrans, m[i], n[i], ldc[i]) + gap;
+        }
+    }
+
+    vector<fp_a, allocator_helper<fp_a, 64>> A(size_a);
+    vector<fp_b, allocator_helper<fp_b, 64>> B(size_b);
+    vector<fp_c, allocator_helper<fp_c, 64>> C(size_c);
+    std::generate(A.begin(), A.end(), rand_elem<fp_a>);
+    std::generate(B.begin(), B.end(), rand_elem<fp_b>);
+    std::generate(C.begin(), C.end(), rand_elem<fp_c>);
+
+    // Reference gemm in double on every matrix of the batch.
+    vector<double> C_ref(size_c);
+    for (int64_t i = 0, idx = 0; i < group_count; i++) {
+        for (int64_t j = 0; j < group_size[i]; j++, idx++) {
+            const fp_a* A_p = A.data() + offset_a[idx];
+            const fp_b* B_p = B.data() + offset_b[idx];
+            for (int64_t col = 0; col < n[i]; col++) {
+                for (int64_t row = 0; row < m[i]; row++) {
+                    double sum = 0.0;
+                    for (int64_t p = 0; p < k[i]; p++)
+                        sum += op_elem(A_p, transa[i], row, p, lda[i]) *
+                               op_elem(B_p, transb[i], p, col, ldb[i]);
+                    const int64_t c_idx = offset_c[idx] + row + ldc[i] * col;
+                    C_ref[c_idx] =
+                        to_double(alpha[i]) * sum + to_double(beta[i]) * to_double(C[c_idx]);
+                }
+            }
+        }
+    }
+
+    // Call DPC++ GEMM_BATCH.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during GEMM_BATCH:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp_a, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<fp_b, 1> B_buffer(B.data(), range<1>(B.size()));
+    buffer<fp_c, 1> C_buffer(C.data(), range<1>(C.size()));
+
+    try {
+        if (grouped) {
+            buffer<onemkl::transpose, 1> transa_buffer(transa.data(), range<1>(group_count));
+            buffer<onemkl::transpose, 1> transb_buffer(transb.data(), range<1>(group_count));
+            buffer<int64_t, 1> m_buffer(m.data(), range<1>(group_count));
+            buffer<int64_t, 1> n_buffer(n.data(), range<1>(group_count));
+            buffer<int64_t, 1> k_buffer(k.data(), range<1>(group_count));
+            buffer<int64_t, 1> lda_buffer(lda.data(), range<1>(group_count));
+            buffer<int64_t, 1> ldb_buffer(ldb.data(), range<1>(group_count));
+            buffer<int64_t, 1> ldc_buffer(ldc.data(), range<1>(group_count));
+            buffer<int64_t, 1> group_size_buffer(group_size.data(), range<1>(group_count));
+            buffer<fp_s, 1> alpha_buffer(alpha.data(), range<1>(group_count));
+            buffer<fp_s, 1> beta_buffer(beta.data(), range<1>(group_count));
+            buffer<int64_t, 1> offset_a_buffer(offset_a.data(), range<1>(offset_a.size()));
+            buffer<int64_t, 1> offset_b_buffer(offset_b.data(), range<1>(offset_b.size()));
+            buffer<int64_t, 1> offset_c_buffer(offset_c.data(), range<1>(offset_c.size()));
+#ifdef CALL_RT_API
+            onemkl::blas::gemm_batch(main_queue, transa_buffer, transb_buffer, m_buffer, n_buffer,
+                                     k_buffer, alpha_buffer, A_buffer, lda_buffer,
+                                     offset_a_buffer, B_buffer, ldb_buffer, offset_b_buffer,
+                                     beta_buffer, C_buffer, ldc_buffer, offset_c_buffer,
+                                     group_count, group_size_buffer);
+#else
+            TEST_RUN_CT(main_queue, onemkl::blas::gemm_batch,
+                        (main_queue, transa_buffer, transb_buffer, m_buffer, n_buffer, k_buffer,
+                         alpha_buffer, A_buffer, lda_buffer, offset_a_buffer, B_buffer,
+                         ldb_buffer, offset_b_buffer, beta_buffer, C_buffer, ldc_buffer,
+                         offset_c_buffer, group_count, group_size_buffer));
+#endif
+        }
+        else {
+            const int64_t stride_a = offset_a[1], stride_b = offset_b[1], stride_c = offset_c[1];
+#ifdef CALL_RT_API
+            onemkl::blas::gemm_batch(main_queue, transa[0], transb[0], m[0], n[0], k[0], alpha[0],
+                                     A_buffer, lda[0], stride_a, B_buffer, ldb[0], stride_b,
+                                     beta[0], C_buffer, ldc[0], stride_c, group_size[0]);
+#else
+            TEST_RUN_CT(main_queue, onemkl::blas::gemm_batch,
+                        (main_queue, transa[0], transb[0], m[0], n[0], k[0], alpha[0], A_buffer,
+                         lda[0], stride_a, B_buffer, ldb[0], stride_b, beta[0], C_buffer, ldc[0],
+                         stride_c, group_size[0]));
+#endif
+        }
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during GEMM_BATCH:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    auto C_accessor = C_buffer.template get_access<access::mode::read>();
+    bool good       = true;
+    for (int64_t i = 0, idx = 0; i < group_count; i++) {
+        for (int64_t j = 0; j < group_size[i]; j++, idx++) {
+            for (int64_t col = 0; col < n[i]; col++) {
+                for (int64_t row = 0; row < m[i]; row++) {
+                    const int64_t c_idx = offset_c[idx] + row + ldc[i] * col;
+                    if (!check_elem(C_accessor[c_idx], C_ref[c_idx], k[i])) {
+                        std::cout << "Difference in entry (" << row << ',' << col
+                                  << ") of matrix " << idx << ": DPC++ "
+                                  << to_double(C_accessor[c_idx]) << " vs. Reference "
+                                  << C_ref[c_idx] << std::endl;
+                        good = false;
+                    }
+                }
+            }
+        }
+    }
+
+    return good;
+}
+
+class GemmBatchExtTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(GemmBatchExtTests, HalfHalfHalf) {
+    for (bool grouped : { false, true }) {
+        EXPECT_TRUE((test<half, half, half, half>(GetParam(), grouped, onemkl::transpose::nontrans,
+                                                  onemkl::transpose::trans, half(2.0f),
+                                                  half(0.5f))));
+        EXPECT_TRUE((test<half, half, half, half>(GetParam(), grouped, onemkl::transpose::trans,
+                                                  onemkl::transpose::nontrans, half(0.5f),
+                                                  half(0.0f))));
+    }
+}
+TEST_P(GemmBatchExtTests, HalfHalfFloat) {
+    for (bool grouped : { false, true }) {
+        EXPECT_TRUE((test<half, half, float, float>(GetParam(), grouped,
+                                                    onemkl::transpose::trans,
+                                                    onemkl::transpose::trans, 2.0f, 3.0f)));
+        EXPECT_TRUE((test<half, half, float, float>(GetParam(), grouped,
+                                                    onemkl::transpose::nontrans,
+                                                    onemkl::transpose::nontrans, 2.0f, 0.0f)));
+    }
+}
+TEST_P(GemmBatchExtTests, Int8Uint8Int32) {
+    for (bool grouped : { false, true }) {
+        EXPECT_TRUE((test<int8_t, uint8_t, int32_t, float>(GetParam(), grouped,
+                                                           onemkl::transpose::nontrans,
+                                                           onemkl::transpose::nontrans, 2.0f,
+                                                           3.0f)));
+        EXPECT_TRUE((test<int8_t, uint8_t, int32_t, float>(GetParam(), grouped,
+                                                           onemkl::transpose::trans,
+                                                           onemkl::transpose::trans, 1.0f, 0.0f)));
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmBatchExtTestSuite, GemmBatchExtTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
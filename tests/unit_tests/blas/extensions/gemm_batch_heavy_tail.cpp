@@ -0,0 +1,201 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// Heavy-tailed batch: the number of problems of each shape falls off roughly
+// as a power of their size, so most of the batch is tiny while a couple of
+// products carry most of the work. The mklcpu backend runs the large ones
+// and the small ones in separate buckets.
+template <typename fp>
+bool test(const device& dev, onemkl::transpose transa_0, onemkl::transpose transb_0, fp alpha_0,
+          fp beta_0) {
+    // Grouped gemm_batch is only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare the group configuration.
+    vector<int64_t> dim        = { 4, 6, 8, 12, 16, 24, 32, 48, 64, 96, 160, 256 };
+    vector<int64_t> group_size = { 64, 48, 32, 24, 16, 12, 8, 6, 4, 2, 1, 1 };
+    const int64_t group_count  = dim.size();
+
+    vector<onemkl::transpose> transa, transb;
+    vector<int64_t> m, n, k, lda, ldb, ldc;
+    vector<fp> alpha, beta;
+    for (int64_t i = 0; i < group_count; i++) {
+        transa.push_back((i % 2) ? transa_0 : onemkl::transpose::nontrans);
+        transb.push_back((i % 3) ? transb_0 : onemkl::transpose::nontrans);
+        m.push_back(dim[i]);
+        n.push_back(dim[i] + i % 3);
+        k.push_back(dim[i] - i % 2);
+        lda.push_back(dim[i] + 3);
+        ldb.push_back(dim[i] + 2);
+        ldc.push_back(dim[i] + 4);
+        alpha.push_back((i % 2) ? alpha_0 : fp(1.0));
+        beta.push_back((i % 2) ? beta_0 : fp(0.5));
+    }
+
+    // Matrices of the batch are stored back to back.
+    vector<int64_t> offset_a, offset_b, offset_c;
+    int64_t size_a = 0, size_b = 0, size_c = 0, max_k = 0;
+    for (int64_t i = 0; i < group_count; i++) {
+        for (int64_t j = 0; j < group_size[i]; j++) {
+            offset_a.push_back(size_a);
+            offset_b.push_back(size_b);
+            offset_c.push_back(size_c);
+            size_a += matrix_size(transa[i], m[i], k[i], lda[i]);
+            size_b += matrix_size(transb[i], k[i], n[i], ldb[i]);
+            size_c += matrix_size(onemkl::transpose::nontrans, m[i], n[i], ldc[i]);
+        }
+        max_k = std::max(max_k, k[i]);
+    }
+
+    vector<fp, allocator_helper<fp, 64>> A, B, C, C_ref;
+    rand_vector(A, size_a, 1);
+    rand_vector(B, size_b, 1);
+    rand_vector(C, size_c, 1);
+    C_ref = C;
+
+    // Call Reference GEMM on every matrix of the batch.
+    using fp_ref = typename ref_type_info<fp>::type;
+
+    for (int64_t i = 0, idx = 0; i < group_count; i++) {
+        const int m_ref = m[i], n_ref = n[i], k_ref = k[i];
+        const int lda_ref = lda[i], ldb_ref = ldb[i], ldc_ref = ldc[i];
+        for (int64_t j = 0; j < group_size[i]; j++, idx++) {
+            ::gemm(convert_to_cblas_trans(transa[i]), convert_to_cblas_trans(transb[i]), &m_ref,
+                   &n_ref, &k_ref, (fp_ref*)&alpha[i], (fp_ref*)A.data() + offset_a[idx],
+                   &lda_ref, (fp_ref*)B.data() + offset_b[idx], &ldb_ref, (fp_ref*)&beta[i],
+                   (fp_ref*)C_ref.data() + offset_c[idx], &ldc_ref);
+        }
+    }
+
+    // Call DPC++ GEMM_BATCH.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during GEMM_BATCH:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<onemkl::transpose, 1> transa_buffer(transa.data(), range<1>(group_count));
+    buffer<onemkl::transpose, 1> transb_buffer(transb.data(), range<1>(group_count));
+    buffer<int64_t, 1> m_buffer(m.data(), range<1>(group_count));
+    buffer<int64_t, 1> n_buffer(n.data(), range<1>(group_count));
+    buffer<int64_t, 1> k_buffer(k.data(), range<1>(group_count));
+    buffer<int64_t, 1> lda_buffer(lda.data(), range<1>(group_count));
+    buffer<int64_t, 1> ldb_buffer(ldb.data(), range<1>(group_count));
+    buffer<int64_t, 1> ldc_buffer(ldc.data(), range<1>(group_count));
+    buffer<int64_t, 1> group_size_buffer(group_size.data(), range<1>(group_count));
+    buffer<fp, 1> alpha_buffer(alpha.data(), range<1>(group_count));
+    buffer<fp, 1> beta_buffer(beta.data(), range<1>(group_count));
+    buffer<int64_t, 1> offset_a_buffer(offset_a.data(), range<1>(offset_a.size()));
+    buffer<int64_t, 1> offset_b_buffer(offset_b.data(), range<1>(offset_b.size()));
+    buffer<int64_t, 1> offset_c_buffer(offset_c.data(), range<1>(offset_c.size()));
+    buffer<fp, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<fp, 1> B_buffer(B.data(), range<1>(B.size()));
+    buffer<fp, 1> C_buffer(C.data(), range<1>(C.size()));
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::gemm_batch(main_queue, transa_buffer, transb_buffer, m_buffer, n_buffer,
+                                 k_buffer, alpha_buffer, A_buffer, lda_buffer, offset_a_buffer,
+                                 B_buffer, ldb_buffer, offset_b_buffer, beta_buffer, C_buffer,
+                                 ldc_buffer, offset_c_buffer, group_count, group_size_buffer);
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::gemm_batch,
+                    (main_queue, transa_buffer, transb_buffer, m_buffer, n_buffer, k_buffer,
+                     alpha_buffer, A_buffer, lda_buffer, offset_a_buffer, B_buffer, ldb_buffer,
+                     offset_b_buffer, beta_buffer, C_buffer, ldc_buffer, offset_c_buffer,
+                     group_count, group_size_buffer));
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during GEMM_BATCH:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    auto C_accessor = C_buffer.template get_access<access::mode::read>();
+    bool good       = check_equal_vector(C_accessor, C_ref, C.size(), 1, 10 * max_k, std::cout);
+
+    return good;
+}
+
+class GemmBatchHeavyTailTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(GemmBatchHeavyTailTests, RealSinglePrecision) {
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::transpose::trans, onemkl::transpose::nontrans,
+                            2.0f, 3.0f));
+}
+TEST_P(GemmBatchHeavyTailTests, RealDoublePrecision) {
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::transpose::nontrans, onemkl::transpose::trans,
+                             2.0, 0.0));
+}
+TEST_P(GemmBatchHeavyTailTests, ComplexSinglePrecision) {
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::transpose::conjtrans,
+                                          onemkl::transpose::trans, std::complex<float>(2.0, -0.5),
+                                          std::complex<float>(3.0, -1.5)));
+}
+TEST_P(GemmBatchHeavyTailTests, ComplexDoublePrecision) {
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::transpose::trans,
+                                           onemkl::transpose::conjtrans,
+                                           std::complex<double>(2.0, -0.5),
+                                           std::complex<double>(3.0, -1.5)));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmBatchHeavyTailTestSuite, GemmBatchHeavyTailTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
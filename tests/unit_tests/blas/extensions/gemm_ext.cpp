@@ -0,0 +1,291 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// Element (i, j) of op(M).
+template <typename T>
+int32_t op_elem(const T* M, onemkl::transpose trans, int i, int j, int ld) {
+    return (trans == onemkl::transpose::nontrans) ? M[i + ld * j] : M[j + ld * i];
+}
+
+// Reference (op(A) - ao) * (op(B) - bo) at (i, j).
+template <typename fp_a, typename fp_b>
+int32_t ref_product(const fp_a* A, const fp_b* B, onemkl::transpose transa,
+                    onemkl::transpose transb, int i, int j, int k, int lda, int ldb, fp_a ao,
+                    fp_b bo) {
+    int32_t sum = 0;
+    for (int p = 0; p < k; p++)
+        sum += (op_elem(A, transa, i, p, lda) - ao) * (op_elem(B, transb, p, j, ldb) - bo);
+    return sum;
+}
+
+int offset_size(onemkl::offset o, int m, int n) {
+    return (o == onemkl::offset::fix) ? 1 : ((o == onemkl::offset::column) ? m : n);
+}
+
+int offset_index(onemkl::offset o, int i, int j) {
+    return (o == onemkl::offset::fix) ? 0 : ((o == onemkl::offset::column) ? i : j);
+}
+
+template <typename T, typename F>
+T round_saturate(F x) {
+    x = std::nearbyint(x);
+    x = std::max(x, F(std::numeric_limits<T>::min()));
+    x = std::min(x, F(std::numeric_limits<T>::max()));
+    return T(x);
+}
+
+auto exception_handler = [](exception_list exceptions) {
+    for (std::exception_ptr const& e : exceptions) {
+        try {
+            std::rethrow_exception(e);
+        }
+        catch (exception const& e) {
+            std::cout << "Caught asynchronous SYCL exception during GEMM_EXT:\n"
+                      << e.what() << std::endl
+                      << "OpenCL status: " << e.get_cl_code() << std::endl;
+        }
+    }
+};
+
+// Integer gemm with int32 C.
+template <typename fp_a, typename fp_b>
+bool test(const device& dev, onemkl::transpose transa, onemkl::transpose transb,
+          onemkl::offset offsetc, int m, int n, int k, int lda, int ldb, int ldc, float alpha,
+          float beta, fp_a ao, fp_b bo) {
+    // These combinations are only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data.
+    vector<fp_a, allocator_helper<fp_a, 64>> A;
+    vector<fp_b, allocator_helper<fp_b, 64>> B;
+    vector<int32_t, allocator_helper<int32_t, 64>> C, C_ref, CO;
+    rand_matrix(A, transa, m, k, lda);
+    rand_matrix(B, transb, k, n, ldb);
+    rand_matrix(C, onemkl::transpose::nontrans, m, n, ldc);
+    rand_vector(CO, offset_size(offsetc, m, n), 1);
+    C_ref = C;
+
+    // Reference integer gemm.
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < m; i++) {
+            double t = double(alpha) *
+                       ref_product(A.data(), B.data(), transa, transb, i, j, k, lda, ldb, ao, bo);
+            t += double(beta) * C_ref[i + ldc * j];
+            t += CO[offset_index(offsetc, i, j)];
+            C_ref[i + ldc * j] = round_saturate<int32_t>(t);
+        }
+    }
+
+    // Call DPC++ GEMM_EXT.
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp_a, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<fp_b, 1> B_buffer(B.data(), range<1>(B.size()));
+    buffer<int32_t, 1> C_buffer(C.data(), range<1>(C.size()));
+    buffer<int32_t, 1> CO_buffer(CO.data(), range<1>(CO.size()));
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::gemm_ext(main_queue, transa, transb, offsetc, m, n, k, alpha, A_buffer, lda,
+                               ao, B_buffer, ldb, bo, beta, C_buffer, ldc, CO_buffer);
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::gemm_ext,
+                    (main_queue, transa, transb, offsetc, m, n, k, alpha, A_buffer, lda, ao,
+                     B_buffer, ldb, bo, beta, C_buffer, ldc, CO_buffer));
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during GEMM_EXT:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    auto C_accessor = C_buffer.template get_access<access::mode::read>();
+    bool good       = check_equal_matrix(C_accessor, C_ref, m, n, ldc, 1, std::cout);
+
+    return good;
+}
+
+// Integer gemm with requantized 8-bit C.
+template <typename fp_a, typename fp_b, typename fp_c>
+bool test(const device& dev, onemkl::transpose transa, onemkl::transpose transb,
+          onemkl::offset scalec, int m, int n, int k, int lda, int ldb, int ldc, fp_a ao, fp_b bo,
+          fp_c zc) {
+    // Requantized output is only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data.
+    vector<fp_a, allocator_helper<fp_a, 64>> A;
+    vector<fp_b, allocator_helper<fp_b, 64>> B;
+    vector<fp_c, allocator_helper<fp_c, 64>> C, C_ref;
+    vector<float, allocator_helper<float, 64>> scales(offset_size(scalec, m, n));
+    rand_matrix(A, transa, m, k, lda);
+    rand_matrix(B, transb, k, n, ldb);
+    rand_matrix(C, onemkl::transpose::nontrans, m, n, ldc);
+    // Scales small enough that most results are in range, large enough that
+    // some of them saturate.
+    for (auto& s : scales)
+        s = (1.0f + 4.0f * (rand_scalar<float>() + 0.5f)) / (64.0f * k);
+    C_ref = C;
+
+    // Reference requantized gemm.
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < m; i++) {
+            int32_t acc =
+                ref_product(A.data(), B.data(), transa, transb, i, j, k, lda, ldb, ao, bo);
+            float t = std::nearbyint(scales[offset_index(scalec, i, j)] * float(acc));
+            C_ref[i + ldc * j] = round_saturate<fp_c>(t + float(zc));
+        }
+    }
+
+    // Call DPC++ GEMM_EXT.
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp_a, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<fp_b, 1> B_buffer(B.data(), range<1>(B.size()));
+    buffer<float, 1> scales_buffer(scales.data(), range<1>(scales.size()));
+    buffer<fp_c, 1> C_buffer(C.data(), range<1>(C.size()));
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::gemm_ext(main_queue, transa, transb, scalec, m, n, k, A_buffer, lda, ao,
+                               B_buffer, ldb, bo, scales_buffer, zc, C_buffer, ldc);
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::gemm_ext,
+                    (main_queue, transa, transb, scalec, m, n, k, A_buffer, lda, ao, B_buffer, ldb,
+                     bo, scales_buffer, zc, C_buffer, ldc));
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during GEMM_EXT:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    auto C_accessor = C_buffer.template get_access<access::mode::read>();
+    bool good       = true;
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < m; i++) {
+            if (C_accessor[i + ldc * j] != C_ref[i + ldc * j]) {
+                std::cout << "Difference in entry (" << i << ',' << j << "): DPC++ "
+                          << int(C_accessor[i + ldc * j]) << " vs. Reference "
+                          << int(C_ref[i + ldc * j]) << std::endl;
+                good = false;
+            }
+        }
+    }
+
+    return good;
+}
+
+class GemmExtTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(GemmExtTests, Int16Int16Int32) {
+    EXPECT_TRUE((test<int16_t, int16_t>(GetParam(), onemkl::transpose::nontrans,
+                                        onemkl::transpose::nontrans, onemkl::offset::fix, 79, 83,
+                                        91, 103, 105, 106, 2.0f, 3.0f, int16_t(3), int16_t(-5))));
+    EXPECT_TRUE((test<int16_t, int16_t>(GetParam(), onemkl::transpose::trans,
+                                        onemkl::transpose::trans, onemkl::offset::column, 79, 83,
+                                        91, 103, 105, 106, 2.0f, 3.0f, int16_t(3), int16_t(-5))));
+}
+TEST_P(GemmExtTests, Int8Int8Int32) {
+    EXPECT_TRUE((test<int8_t, int8_t>(GetParam(), onemkl::transpose::nontrans,
+                                      onemkl::transpose::nontrans, onemkl::offset::fix, 79, 83, 91,
+                                      103, 105, 106, 2.0f, 3.0f, int8_t(3), int8_t(-5))));
+    EXPECT_TRUE((test<int8_t, int8_t>(GetParam(), onemkl::transpose::nontrans,
+                                      onemkl::transpose::trans, onemkl::offset::row, 79, 83, 91,
+                                      103, 105, 106, 2.0f, 0.0f, int8_t(3), int8_t(-5))));
+    EXPECT_TRUE((test<int8_t, int8_t>(GetParam(), onemkl::transpose::trans,
+                                      onemkl::transpose::nontrans, onemkl::offset::column, 79, 83,
+                                      91, 103, 105, 106, 2.0f, 3.0f, int8_t(0), int8_t(0))));
+    EXPECT_TRUE((test<int8_t, int8_t>(GetParam(), onemkl::transpose::trans,
+                                      onemkl::transpose::trans, onemkl::offset::fix, 79, 83, 91,
+                                      103, 105, 106, 2.0f, 3.0f, int8_t(3), int8_t(-5))));
+}
+TEST_P(GemmExtTests, Uint8Int8Int32) {
+    EXPECT_TRUE((test<uint8_t, int8_t>(GetParam(), onemkl::transpose::nontrans,
+                                       onemkl::transpose::nontrans, onemkl::offset::fix, 79, 83,
+                                       91, 103, 105, 106, 2.0f, 3.0f, uint8_t(3), int8_t(-5))));
+    EXPECT_TRUE((test<uint8_t, int8_t>(GetParam(), onemkl::transpose::trans,
+                                       onemkl::transpose::trans, onemkl::offset::row, 79, 83, 91,
+                                       103, 105, 106, 2.0f, 3.0f, uint8_t(3), int8_t(-5))));
+}
+TEST_P(GemmExtTests, Int8Uint8Requantized) {
+    EXPECT_TRUE((test<int8_t, uint8_t, int8_t>(GetParam(), onemkl::transpose::nontrans,
+                                               onemkl::transpose::nontrans, onemkl::offset::column,
+                                               79, 83, 91, 103, 105, 106, int8_t(3), uint8_t(5),
+                                               int8_t(-7))));
+    EXPECT_TRUE((test<int8_t, uint8_t, uint8_t>(GetParam(), onemkl::transpose::trans,
+                                                onemkl::transpose::trans, onemkl::offset::row, 79,
+                                                83, 91, 103, 105, 106, int8_t(3), uint8_t(5),
+                                                uint8_t(128))));
+}
+TEST_P(GemmExtTests, Int8Int8Requantized) {
+    EXPECT_TRUE((test<int8_t, int8_t, int8_t>(GetParam(), onemkl::transpose::nontrans,
+                                              onemkl::transpose::trans, onemkl::offset::fix, 79,
+                                              83, 600, 600, 600, 106, int8_t(0), int8_t(0),
+                                              int8_t(0))));
+    EXPECT_TRUE((test<int8_t, int8_t, uint8_t>(GetParam(), onemkl::transpose::trans,
+                                               onemkl::transpose::nontrans, onemkl::offset::column,
+                                               79, 83, 91, 103, 105, 106, int8_t(-3), int8_t(5),
+                                               uint8_t(100))));
+}
+TEST_P(GemmExtTests, Uint8Int8Requantized) {
+    EXPECT_TRUE((test<uint8_t, int8_t, int8_t>(GetParam(), onemkl::transpose::nontrans,
+                                               onemkl::transpose::nontrans, onemkl::offset::row,
+                                               79, 83, 91, 103, 105, 106, uint8_t(64), int8_t(1),
+                                               int8_t(3))));
+    EXPECT_TRUE((test<uint8_t, int8_t, uint8_t>(GetParam(), onemkl::transpose::trans,
+                                                onemkl::transpose::trans, onemkl::offset::column,
+                                                79, 83, 91, 103, 105, 106, uint8_t(64), int8_t(1),
+                                                uint8_t(128))));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmExtTestSuite, GemmExtTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,219 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// fp16 values are random floats rounded to half precision.
+template <typename T>
+T rand_elem() {
+    return rand_scalar<T>();
+}
+template <>
+half rand_elem<half>() {
+    return half(rand_scalar<float>());
+}
+
+template <typename T>
+double to_double(T x) {
+    return double(x);
+}
+double to_double(half x) {
+    return double(float(x));
+}
+
+// Element (i, j) of op(M).
+double op_elem(const half* M, onemkl::transpose trans, int64_t i, int64_t j, int64_t ld) {
+    return to_double((trans == onemkl::transpose::nontrans) ? M[i + ld * j] : M[j + ld * i]);
+}
+
+// Results are compared relative to x_abs, the result computed with the
+// absolute values of every operand. The mklcpu backend rounds an fp16 C once
+// per block of 256 columns of op(A), a float C accumulates in float.
+bool check_elem(half x, double x_ref, double x_abs, int64_t k) {
+    return std::abs(float(x) - x_ref) <= (2.0 / 1024) * (k / 256 + 1) * (x_abs + 1.0);
+}
+bool check_elem(float x, double x_ref, double x_abs, int64_t k) {
+    return std::abs(x - x_ref) <=
+           10.0 * (k + 1) * std::numeric_limits<float>::epsilon() * (x_abs + 1.0);
+}
+
+// fp16 C goes through gemm. The float C variant of gemm_ext is not part of
+// the public API, a strided batch of one problem runs the same tiled kernel.
+void run_gemm(queue& main_queue, onemkl::transpose transa, onemkl::transpose transb, int64_t m,
+              int64_t n, int64_t k, half alpha, buffer<half, 1>& A, int64_t lda,
+              buffer<half, 1>& B, int64_t ldb, half beta, buffer<half, 1>& C, int64_t ldc) {
+#ifdef CALL_RT_API
+    onemkl::blas::gemm(main_queue, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+#else
+    TEST_RUN_CT(main_queue, onemkl::blas::gemm,
+                (main_queue, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc));
+#endif
+}
+void run_gemm(queue& main_queue, onemkl::transpose transa, onemkl::transpose transb, int64_t m,
+              int64_t n, int64_t k, float alpha, buffer<half, 1>& A, int64_t lda,
+              buffer<half, 1>& B, int64_t ldb, float beta, buffer<float, 1>& C, int64_t ldc) {
+    const int64_t stride_a = A.get_count(), stride_b = B.get_count(), stride_c = C.get_count();
+#ifdef CALL_RT_API
+    onemkl::blas::gemm_batch(main_queue, transa, transb, m, n, k, alpha, A, lda, stride_a, B, ldb,
+                             stride_b, beta, C, ldc, stride_c, 1);
+#else
+    TEST_RUN_CT(main_queue, onemkl::blas::gemm_batch,
+                (main_queue, transa, transb, m, n, k, alpha, A, lda, stride_a, B, ldb, stride_b,
+                 beta, C, ldc, stride_c, 1));
+#endif
+}
+
+// fp16 gemm with an fp16 or a float C. The sizes span several tiles of C and
+// several blocks of k, none of them full.
+template <typename fp_c>
+bool test(const device& dev, onemkl::transpose transa, onemkl::transpose transb, int64_t m,
+          int64_t n, int64_t k, fp_c alpha, fp_c beta) {
+    // The tiled fp16 gemm is specific to the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    const int64_t lda = ((transa == onemkl::transpose::nontrans) ? m : k) + 3;
+    const int64_t ldb = ((transb == onemkl::transpose::nontrans) ? k : n) + 2;
+    const int64_t ldc = m + 1;
+
+    vector<half, allocator_helper<half, 64>> A(matrix_size(transa, m, k, lda));
+    vector<half, allocator_helper<half, 64>> B(matrix_size(transb, k, n, ldb));
+    vector<fp_c, allocator_helper<fp_c, 64>> C(matrix_size(onemkl::transpose::nontrans, m, n, ldc));
+    std::generate(A.begin(), A.end(), rand_elem<half>);
+    std::generate(B.begin(), B.end(), rand_elem<half>);
+    std::generate(C.begin(), C.end(), rand_elem<fp_c>);
+
+    // Reference gemm in double, and the same product of absolute values.
+    vector<double> C_ref(C.size()), C_abs(C.size());
+    for (int64_t col = 0; col < n; col++) {
+        for (int64_t row = 0; row < m; row++) {
+            const int64_t c_idx = row + ldc * col;
+            double sum = 0.0, sum_abs = 0.0;
+            for (int64_t p = 0; p < k; p++) {
+                const double prod =
+                    op_elem(A.data(), transa, row, p, lda) * op_elem(B.data(), transb, p, col, ldb);
+                sum += prod;
+                sum_abs += std::abs(prod);
+            }
+            C_ref[c_idx] = to_double(alpha) * sum + to_double(beta) * to_double(C[c_idx]);
+            C_abs[c_idx] = std::abs(to_double(alpha)) * sum_abs +
+                           std::abs(to_double(beta) * to_double(C[c_idx]));
+        }
+    }
+
+    // Call DPC++ GEMM.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during GEMM:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<half, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<half, 1> B_buffer(B.data(), range<1>(B.size()));
+    buffer<fp_c, 1> C_buffer(C.data(), range<1>(C.size()));
+
+    try {
+        run_gemm(main_queue, transa, transb, m, n, k, alpha, A_buffer, lda, B_buffer, ldb, beta,
+                 C_buffer, ldc);
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during GEMM:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    auto C_accessor = C_buffer.template get_access<access::mode::read>();
+    bool good       = true;
+    for (int64_t col = 0; col < n; col++) {
+        for (int64_t row = 0; row < m; row++) {
+            const int64_t c_idx = row + ldc * col;
+            if (!check_elem(C_accessor[c_idx], C_ref[c_idx], C_abs[c_idx], k)) {
+                std::cout << "Difference in entry (" << row << ',' << col << "): DPC++ "
+                          << to_double(C_accessor[c_idx]) << " vs. Reference " << C_ref[c_idx]
+                          << std::endl;
+                good = false;
+            }
+        }
+    }
+
+    return good;
+}
+
+const onemkl::transpose trans_values[] = { onemkl::transpose::nontrans,
+                                           onemkl::transpose::trans };
+
+class GemmF16Tests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(GemmF16Tests, HalfHalfHalf) {
+    for (onemkl::transpose transa : trans_values) {
+        for (onemkl::transpose transb : trans_values) {
+            EXPECT_TRUE(test<half>(GetParam(), transa, transb, 600, 530, 300, half(1.5f),
+                                   half(-0.5f)));
+            EXPECT_TRUE(
+                test<half>(GetParam(), transa, transb, 600, 530, 0, half(1.5f), half(-0.5f)));
+        }
+    }
+}
+TEST_P(GemmF16Tests, HalfHalfFloat) {
+    for (onemkl::transpose transa : trans_values) {
+        for (onemkl::transpose transb : trans_values) {
+            EXPECT_TRUE(test<float>(GetParam(), transa, transb, 600, 530, 300, 1.5f, -0.5f));
+            EXPECT_TRUE(test<float>(GetParam(), transa, transb, 600, 530, 0, 1.5f, -0.5f));
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmF16TestSuite, GemmF16Tests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
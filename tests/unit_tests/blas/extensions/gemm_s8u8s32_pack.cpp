@@ -0,0 +1,215 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// Reference gemm_s8u8s32: C = alpha * (op(A) - ao) * (op(B) - bo) + beta * C + co.
+template <typename vec_a, typename vec_b, typename vec_c>
+void ref_gemm_s8u8s32(onemkl::transpose transa, onemkl::transpose transb, onemkl::offset offsetc,
+                      int m, int n, int k, float alpha, const vec_a& A, int lda, int8_t ao,
+                      const vec_b& B, int ldb, uint8_t bo, float beta, vec_c& C, int ldc,
+                      const vec_c& CO) {
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < m; i++) {
+            int32_t sum = 0;
+            for (int p = 0; p < k; p++) {
+                int32_t a = (transa == onemkl::transpose::nontrans) ? A[i + lda * p]
+                                                                     : A[p + lda * i];
+                int32_t b = (transb == onemkl::transpose::nontrans) ? B[p + ldb * j]
+                                                                     : B[j + ldb * p];
+                sum += (a - ao) * (b - bo);
+            }
+            int co_index = (offsetc == onemkl::offset::fix)
+                               ? 0
+                               : ((offsetc == onemkl::offset::column) ? i : j);
+            double t = double(alpha) * sum + double(beta) * C[i + ldc * j] + CO[co_index];
+            C[i + ldc * j] = int32_t(std::nearbyint(t));
+        }
+    }
+}
+
+// Packs one operand once, then reuses it for several products with
+// different unpacked operands.
+bool test(const device& dev, onemkl::identifier which, onemkl::transpose transa,
+          onemkl::transpose transb, onemkl::offset offsetc, int m, int n, int k, int lda, int ldb,
+          int ldc, float alpha, float beta, int8_t ao, uint8_t bo, int reuse) {
+    // Packed integer gemm is only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during GEMM_S8U8S32_COMPUTE:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    // Prepare the operand that is packed.
+    vector<int8_t, allocator_helper<int8_t, 64>> A;
+    vector<uint8_t, allocator_helper<uint8_t, 64>> B;
+    if (which == onemkl::identifier::a)
+        rand_matrix(A, transa, m, k, lda);
+    else
+        rand_matrix(B, transb, k, n, ldb);
+
+    bool good = true;
+    try {
+        int64_t size = 0;
+#ifdef CALL_RT_API
+        size = onemkl::blas::gemm_s8u8s32_pack_get_size(main_queue, which, m, n, k);
+#else
+        TEST_RUN_CT(main_queue, size = onemkl::blas::gemm_s8u8s32_pack_get_size,
+                    (main_queue, which, m, n, k));
+#endif
+        buffer<int8_t, 1> packed_a_buffer(range<1>(which == onemkl::identifier::a ? size : 1));
+        buffer<uint8_t, 1> packed_b_buffer(range<1>(which == onemkl::identifier::b ? size : 1));
+
+        if (which == onemkl::identifier::a) {
+            buffer<int8_t, 1> A_buffer(A.data(), range<1>(A.size()));
+#ifdef CALL_RT_API
+            onemkl::blas::gemm_s8u8s32_pack(main_queue, transa, m, n, k, A_buffer, lda,
+                                            packed_a_buffer);
+#else
+            TEST_RUN_CT(main_queue, onemkl::blas::gemm_s8u8s32_pack,
+                        (main_queue, transa, m, n, k, A_buffer, lda, packed_a_buffer));
+#endif
+        }
+        else {
+            buffer<uint8_t, 1> B_buffer(B.data(), range<1>(B.size()));
+#ifdef CALL_RT_API
+            onemkl::blas::gemm_s8u8s32_pack(main_queue, transb, m, n, k, B_buffer, ldb,
+                                            packed_b_buffer);
+#else
+            TEST_RUN_CT(main_queue, onemkl::blas::gemm_s8u8s32_pack,
+                        (main_queue, transb, m, n, k, B_buffer, ldb, packed_b_buffer));
+#endif
+        }
+
+        for (int r = 0; r < reuse; r++) {
+            // New data for the unpacked operand each time.
+            vector<int32_t, allocator_helper<int32_t, 64>> C, C_ref, CO;
+            if (which == onemkl::identifier::a)
+                rand_matrix(B, transb, k, n, ldb);
+            else
+                rand_matrix(A, transa, m, k, lda);
+            rand_matrix(C, onemkl::transpose::nontrans, m, n, ldc);
+            rand_vector(CO,
+                        (offsetc == onemkl::offset::fix)
+                            ? 1
+                            : ((offsetc == onemkl::offset::column) ? m : n),
+                        1);
+            C_ref = C;
+            ref_gemm_s8u8s32(transa, transb, offsetc, m, n, k, alpha, A, lda, ao, B, ldb, bo,
+                             beta, C_ref, ldc, CO);
+
+            buffer<int32_t, 1> C_buffer(C.data(), range<1>(C.size()));
+            buffer<int32_t, 1> CO_buffer(CO.data(), range<1>(CO.size()));
+            if (which == onemkl::identifier::a) {
+                buffer<uint8_t, 1> B_buffer(B.data(), range<1>(B.size()));
+#ifdef CALL_RT_API
+                onemkl::blas::gemm_s8u8s32_compute(main_queue, transb, offsetc, m, n, k, alpha,
+                                                   packed_a_buffer, ao, B_buffer, ldb, bo, beta,
+                                                   C_buffer, ldc, CO_buffer);
+#else
+                TEST_RUN_CT(main_queue, onemkl::blas::gemm_s8u8s32_compute,
+                            (main_queue, transb, offsetc, m, n, k, alpha, packed_a_buffer, ao,
+                             B_buffer, ldb, bo, beta, C_buffer, ldc, CO_buffer));
+#endif
+            }
+            else {
+                buffer<int8_t, 1> A_buffer(A.data(), range<1>(A.size()));
+#ifdef CALL_RT_API
+                onemkl::blas::gemm_s8u8s32_compute(main_queue, transa, offsetc, m, n, k, alpha,
+                                                   A_buffer, lda, ao, packed_b_buffer, bo, beta,
+                                                   C_buffer, ldc, CO_buffer);
+#else
+                TEST_RUN_CT(main_queue, onemkl::blas::gemm_s8u8s32_compute,
+                            (main_queue, transa, offsetc, m, n, k, alpha, A_buffer, lda, ao,
+                             packed_b_buffer, bo, beta, C_buffer, ldc, CO_buffer));
+#endif
+            }
+
+            // Compare the results of reference implementation and DPC++ implementation.
+            auto C_accessor = C_buffer.get_access<access::mode::read>();
+            good &= check_equal_matrix(C_accessor, C_ref, m, n, ldc, 1, std::cout);
+        }
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during GEMM_S8U8S32_COMPUTE:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    return good;
+}
+
+class GemmS8u8s32PackTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(GemmS8u8s32PackTests, PackedA) {
+    EXPECT_TRUE(test(GetParam(), onemkl::identifier::a, onemkl::transpose::nontrans,
+                     onemkl::transpose::nontrans, onemkl::offset::fix, 79, 83, 91, 103, 105, 106,
+                     2.0f, 3.0f, int8_t(3), uint8_t(5), 3));
+    EXPECT_TRUE(test(GetParam(), onemkl::identifier::a, onemkl::transpose::trans,
+                     onemkl::transpose::trans, onemkl::offset::column, 79, 83, 91, 103, 105, 106,
+                     2.0f, 3.0f, int8_t(-3), uint8_t(0), 3));
+}
+TEST_P(GemmS8u8s32PackTests, PackedB) {
+    EXPECT_TRUE(test(GetParam(), onemkl::identifier::b, onemkl::transpose::nontrans,
+                     onemkl::transpose::trans, onemkl::offset::row, 79, 83, 91, 103, 105, 106,
+                     2.0f, 0.0f, int8_t(3), uint8_t(5), 3));
+    EXPECT_TRUE(test(GetParam(), onemkl::identifier::b, onemkl::transpose::trans,
+                     onemkl::transpose::nontrans, onemkl::offset::fix, 79, 83, 91, 103, 105, 106,
+                     2.0f, 3.0f, int8_t(0), uint8_t(1), 3));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmS8u8s32PackTestSuite, GemmS8u8s32PackTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,204 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// One call of the test sequence: y[iy] := alpha * op(A) * x[ix] + beta * y[iy], x[ix]
+// being y[ix] when chained is set, or A := alpha * u[ix] * v[iy]^T + A for ger.
+template <typename fp>
+struct call {
+    bool ger, chained;
+    int ix, iy;
+    fp alpha, beta;
+};
+
+template <typename routines, typename fp>
+void run(queue& main_queue, onemkl::transpose transa, int m, int n, buffer<fp, 1>& A_buffer,
+         int lda, vector<buffer<fp, 1>>& x_buffers, int incx, vector<buffer<fp, 1>>& y_buffers,
+         int incy, vector<buffer<fp, 1>>& u_buffers, vector<buffer<fp, 1>>& v_buffers,
+         const vector<call<fp>>& calls) {
+    onemkl::blas::gemv_coalescer<fp, routines> coalescer(main_queue, 4);
+    for (auto& c : calls) {
+        if (c.ger)
+            coalescer.ger(m, n, c.alpha, u_buffers[c.ix], 1, v_buffers[c.iy], 1, A_buffer, lda);
+        else
+            coalescer.gemv(transa, m, n, c.alpha, A_buffer, lda,
+                           c.chained ? y_buffers[c.ix] : x_buffers[c.ix], incx, c.beta,
+                           y_buffers[c.iy], incy);
+    }
+    coalescer.flush();
+}
+
+template <onemkl::library lib, onemkl::backend backend, typename fp>
+void run_ct(queue& main_queue, onemkl::transpose transa, int m, int n, buffer<fp, 1>& A_buffer,
+            int lda, vector<buffer<fp, 1>>& x_buffers, int incx, vector<buffer<fp, 1>>& y_buffers,
+            int incy, vector<buffer<fp, 1>>& u_buffers, vector<buffer<fp, 1>>& v_buffers,
+            const vector<call<fp>>& calls) {
+    run<onemkl::blas::ct_routines<lib, backend>>(main_queue, transa, m, n, A_buffer, lda,
+                                                  x_buffers, incx, y_buffers, incy, u_buffers,
+                                                  v_buffers, calls);
+}
+
+// Bursts of gemv on the same matrix, some of which depend on each other, and
+// of ger, run through a gemv_coalescer and compared with the calls made one
+// at a time.
+template <typename fp>
+bool test(const device& dev, onemkl::transpose transa, int m, int n, int incx, int incy,
+          int lda) {
+    // Prepare the sequence of calls.
+    vector<call<fp>> calls;
+    for (int i = 0; i < 6; i++)
+        calls.push_back({ false, false, i, i, fp(1 + i % 3), (i % 2) ? fp(0.5) : fp(0) });
+    for (int i = 0; i < 3; i++)
+        calls.push_back({ true, false, i, i, fp(i - 1.5), fp(1) });
+    calls.push_back({ false, false, 0, 0, fp(2), fp(1) });
+    calls.push_back({ false, false, 1, 0, fp(1), fp(-1) });
+    if (m == n) {
+        calls.push_back({ false, false, 2, 3, fp(1), fp(0) });
+        calls.push_back({ false, true, 3, 4, fp(1), fp(2) });
+    }
+
+    // Prepare data.
+    int x_len = outer_dimension(transa, m, n);
+    int y_len = inner_dimension(transa, m, n);
+
+    vector<vector<fp>> x(6), y(6), y_ref, u(3), v(3);
+    vector<fp> A, A_ref;
+
+    for (int i = 0; i < 6; i++) {
+        rand_vector(x[i], x_len, incx);
+        rand_vector(y[i], y_len, incy);
+    }
+    for (int i = 0; i < 3; i++) {
+        rand_vector(u[i], m, 1);
+        rand_vector(v[i], n, 1);
+    }
+    rand_matrix(A, onemkl::transpose::nontrans, m, n, lda);
+    y_ref = y;
+    A_ref = A;
+
+    // Call Reference GEMV and GER one at a time.
+    const int m_ref = m, n_ref = n, incx_ref = incx, incy_ref = incy, lda_ref = lda, one = 1;
+    using fp_ref = typename ref_type_info<fp>::type;
+
+    for (auto& c : calls) {
+        if (c.ger)
+            ::ger(&m_ref, &n_ref, (fp_ref*)&c.alpha, (fp_ref*)u[c.ix].data(), &one,
+                  (fp_ref*)v[c.iy].data(), &one, (fp_ref*)A_ref.data(), &lda_ref);
+        else
+            ::gemv(convert_to_cblas_trans(transa), &m_ref, &n_ref, (fp_ref*)&c.alpha,
+                   (fp_ref*)A_ref.data(), &lda_ref,
+                   (fp_ref*)(c.chained ? y_ref[c.ix] : x[c.ix]).data(), &incx_ref,
+                   (fp_ref*)&c.beta, (fp_ref*)y_ref[c.iy].data(), &incy_ref);
+    }
+
+    // Call DPC++ GEMV and GER through a gemv_coalescer.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during GEMV_COALESCER:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    {
+        buffer<fp, 1> A_buffer(A.data(), range<1>(A.size()));
+        vector<buffer<fp, 1>> x_buffers, y_buffers, u_buffers, v_buffers;
+        for (int i = 0; i < 6; i++) {
+            x_buffers.emplace_back(x[i].data(), range<1>(x[i].size()));
+            y_buffers.emplace_back(y[i].data(), range<1>(y[i].size()));
+        }
+        for (int i = 0; i < 3; i++) {
+            u_buffers.emplace_back(u[i].data(), range<1>(u[i].size()));
+            v_buffers.emplace_back(v[i].data(), range<1>(v[i].size()));
+        }
+
+        try {
+#ifdef CALL_RT_API
+            run<onemkl::blas::rt_routines>(main_queue, transa, m, n, A_buffer, lda, x_buffers,
+                                           incx, y_buffers, incy, u_buffers, v_buffers, calls);
+#else
+            TEST_RUN_CT(main_queue, run_ct,
+                        (main_queue, transa, m, n, A_buffer, lda, x_buffers, incx, y_buffers,
+                         incy, u_buffers, v_buffers, calls));
+#endif
+        }
+        catch (exception const& e) {
+            std::cout << "Caught synchronous SYCL exception during GEMV_COALESCER:\n"
+                      << e.what() << std::endl
+                      << "OpenCL status: " << e.get_cl_code() << std::endl;
+        }
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good = check_equal_matrix(A, A_ref, m, n, lda, 10, std::cout);
+    for (int i = 0; i < 6; i++)
+        good = check_equal_vector(y[i], y_ref[i], y_len, incy, 2 * (m + n), std::cout) && good;
+
+    return good;
+}
+
+class GemvCoalescerTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(GemvCoalescerTests, RealSinglePrecision) {
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::transpose::nontrans, 77, 77, 2, -3, 101));
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::transpose::trans, 70, 50, 1, 1, 80));
+}
+TEST_P(GemvCoalescerTests, RealDoublePrecision) {
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::transpose::nontrans, 77, 77, 2, -3, 101));
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::transpose::trans, 70, 50, 1, 1, 80));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemvCoalescerTestSuite, GemvCoalescerTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,167 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// gemv with an fp16 or bf16 matrix and float vectors, through gemv or through
+// a strided gemv_batch of batch_size problems when batch_api is set. The
+// reference is float gemv on the matrix converted to float.
+template <typename fp_a>
+bool test(const device& dev, onemkl::transpose trans, int m, int n, int lda, int incx, int incy,
+          float alpha, float beta, bool batch_api, int batch_size) {
+    // Mixed precision gemv is only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+    if (!batch_api)
+        batch_size = 1;
+
+    // Prepare data.
+    const int x_len        = outer_dimension(trans, m, n);
+    const int y_len        = inner_dimension(trans, m, n);
+    const int64_t stride_a = lda * n + 3;
+    const int64_t stride_x = 1 + (x_len - 1) * std::abs(incx) + 2;
+    const int64_t stride_y = 1 + (y_len - 1) * std::abs(incy) + 1;
+
+    vector<fp_a, allocator_helper<fp_a, 64>> A(stride_a * batch_size);
+    vector<float, allocator_helper<float, 64>> A_ref(A.size()), x, y, y_ref;
+    for (size_t i = 0; i < A.size(); i++) {
+        A[i]     = fp_a(rand_scalar<float>());
+        A_ref[i] = float(A[i]);
+    }
+    rand_vector(x, stride_x * batch_size, 1);
+    rand_vector(y, stride_y * batch_size, 1);
+    y_ref = y;
+
+    // Call Reference GEMV on the converted matrices.
+    const int m_ref = m, n_ref = n, lda_ref = lda, incx_ref = incx, incy_ref = incy;
+
+    for (int i = 0; i < batch_size; i++) {
+        ::gemv(convert_to_cblas_trans(trans), &m_ref, &n_ref, &alpha, A_ref.data() + stride_a * i,
+               &lda_ref, x.data() + stride_x * i, &incx_ref, &beta, y_ref.data() + stride_y * i,
+               &incy_ref);
+    }
+
+    // Call DPC++ GEMV.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during GEMV_MIXED:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp_a, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<float, 1> x_buffer(x.data(), range<1>(x.size()));
+    buffer<float, 1> y_buffer(y.data(), range<1>(y.size()));
+
+    try {
+#ifdef CALL_RT_API
+        if (batch_api)
+            onemkl::blas::gemv_batch(main_queue, trans, m, n, alpha, A_buffer, lda, stride_a,
+                                     x_buffer, incx, stride_x, beta, y_buffer, incy, stride_y,
+                                     batch_size);
+        else
+            onemkl::blas::gemv(main_queue, trans, m, n, alpha, A_buffer, lda, x_buffer, incx, beta,
+                               y_buffer, incy);
+#else
+        if (batch_api) {
+            TEST_RUN_CT(main_queue, onemkl::blas::gemv_batch,
+                        (main_queue, trans, m, n, alpha, A_buffer, lda, stride_a, x_buffer, incx,
+                         stride_x, beta, y_buffer, incy, stride_y, batch_size));
+        }
+        else {
+            TEST_RUN_CT(main_queue, onemkl::blas::gemv,
+                        (main_queue, trans, m, n, alpha, A_buffer, lda, x_buffer, incx, beta,
+                         y_buffer, incy));
+        }
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during GEMV_MIXED:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    auto y_accessor = y_buffer.template get_access<access::mode::read>();
+    bool good       = check_equal_vector(y_accessor, y_ref, y.size(), 1, x_len, std::cout);
+
+    return good;
+}
+
+class GemvMixedTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(GemvMixedTests, HalfMatrixSingleVectors) {
+    EXPECT_TRUE(test<half>(GetParam(), onemkl::transpose::nontrans, 300, 257, 301, 1, 1, 2.0f,
+                           0.5f, false, 1));
+    EXPECT_TRUE(test<half>(GetParam(), onemkl::transpose::trans, 300, 257, 301, -2, 3, 2.0f, 0.0f,
+                           false, 1));
+    EXPECT_TRUE(test<half>(GetParam(), onemkl::transpose::nontrans, 30, 25, 31, 2, -1, 2.0f, 0.5f,
+                           true, 7));
+    EXPECT_TRUE(test<half>(GetParam(), onemkl::transpose::trans, 30, 25, 31, 1, 1, 2.0f, 0.5f,
+                           true, 7));
+}
+TEST_P(GemvMixedTests, BFloat16MatrixSingleVectors) {
+    EXPECT_TRUE(test<onemkl::bfloat16>(GetParam(), onemkl::transpose::nontrans, 300, 257, 301, 1,
+                                       1, 2.0f, 0.5f, false, 1));
+    EXPECT_TRUE(test<onemkl::bfloat16>(GetParam(), onemkl::transpose::trans, 300, 257, 301, -2, 3,
+                                       2.0f, 0.0f, false, 1));
+    EXPECT_TRUE(test<onemkl::bfloat16>(GetParam(), onemkl::transpose::nontrans, 30, 25, 31, 2, -1,
+                                       2.0f, 0.5f, true, 7));
+    EXPECT_TRUE(test<onemkl::bfloat16>(GetParam(), onemkl::transpose::trans, 30, 25, 31, 1, 1,
+                                       2.0f, 0.5f, true, 7));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemvMixedTestSuite, GemvMixedTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,209 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// ASUM, NRM2, IAMAX and IAMIN writing their results to host scalars, which
+// are valid once the returned events have completed.
+template <typename fp, typename fp_res>
+bool test(const device& dev, int N, int incx) {
+    // Host-scalar results are only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data.
+    vector<fp> x;
+    fp_res result_asum = fp_res(-1), result_nrm2 = fp_res(-1);
+    int64_t result_iamax = -1, result_iamin = -1;
+
+    rand_vector(x, N, incx);
+
+    // Call Reference ASUM, NRM2, IAMAX and IAMIN.
+    using fp_ref    = typename ref_type_info<fp>::type;
+    const int N_ref = N, incx_ref = incx;
+
+    fp_res asum_ref   = ::asum<fp_ref, fp_res>(&N_ref, (fp_ref*)x.data(), &incx_ref);
+    fp_res nrm2_ref   = ::nrm2<fp_ref, fp_res>(&N_ref, (fp_ref*)x.data(), &incx_ref);
+    int64_t iamax_ref = ::iamax(&N_ref, (fp_ref*)x.data(), &incx_ref);
+    int64_t iamin_ref = ::iamin(&N_ref, (fp_ref*)x.data(), &incx_ref);
+
+    // Call DPC++ ASUM, NRM2, IAMAX and IAMIN.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during ASUM/NRM2/IAMAX/IAMIN:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> x_buffer = make_buffer(x);
+
+    try {
+#ifdef CALL_RT_API
+        auto asum_done  = onemkl::blas::asum(main_queue, N, x_buffer, incx, &result_asum);
+        auto nrm2_done  = onemkl::blas::nrm2(main_queue, N, x_buffer, incx, &result_nrm2);
+        auto iamax_done = onemkl::blas::iamax(main_queue, N, x_buffer, incx, &result_iamax);
+        auto iamin_done = onemkl::blas::iamin(main_queue, N, x_buffer, incx, &result_iamin);
+        asum_done.wait();
+        nrm2_done.wait();
+        iamax_done.wait();
+        iamin_done.wait();
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::asum, (main_queue, N, x_buffer, incx, &result_asum));
+        TEST_RUN_CT(main_queue, onemkl::blas::nrm2, (main_queue, N, x_buffer, incx, &result_nrm2));
+        TEST_RUN_CT(main_queue, onemkl::blas::iamax,
+                    (main_queue, N, x_buffer, incx, &result_iamax));
+        TEST_RUN_CT(main_queue, onemkl::blas::iamin,
+                    (main_queue, N, x_buffer, incx, &result_iamin));
+        main_queue.wait();
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during ASUM/NRM2/IAMAX/IAMIN:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good_asum  = check_equal(result_asum, asum_ref, N, std::cout);
+    bool good_nrm2  = check_equal(result_nrm2, nrm2_ref, N, std::cout);
+    bool good_iamax = check_equal(result_iamax, iamax_ref, 0, std::cout);
+    bool good_iamin = check_equal(result_iamin, iamin_ref, 0, std::cout);
+
+    return good_asum && good_nrm2 && good_iamax && good_iamin;
+}
+
+// DOT writing its result to a host scalar.
+template <typename fp, typename fp_res>
+bool test_dot(const device& dev, int N, int incx, int incy) {
+    // Host-scalar results are only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data.
+    vector<fp> x, y;
+    fp_res result = fp_res(-1), result_ref = fp_res(-1);
+
+    rand_vector(x, N, incx);
+    rand_vector(y, N, incy);
+
+    // Call Reference DOT.
+    const int N_ref = N, incx_ref = incx, incy_ref = incy;
+
+    result_ref = ::dot<fp, fp_res>(&N_ref, (fp*)x.data(), &incx_ref, (fp*)y.data(), &incy_ref);
+
+    // Call DPC++ DOT.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during DOT:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> x_buffer = make_buffer(x);
+    buffer<fp, 1> y_buffer = make_buffer(y);
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::dot(main_queue, N, x_buffer, incx, y_buffer, incy, &result).wait();
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::dot,
+                    (main_queue, N, x_buffer, incx, y_buffer, incy, &result));
+        main_queue.wait();
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during DOT:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    return check_equal(result, result_ref, N, std::cout);
+}
+
+class HostScalarTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(HostScalarTests, RealSinglePrecision) {
+    EXPECT_TRUE((test<float, float>(GetParam(), 1357, 2)));
+    EXPECT_TRUE((test<float, float>(GetParam(), 1357, 1)));
+    EXPECT_TRUE((test_dot<float, float>(GetParam(), 1357, 2, -3)));
+    EXPECT_TRUE((test_dot<float, double>(GetParam(), 1357, 1, 1)));
+}
+TEST_P(HostScalarTests, RealDoublePrecision) {
+    EXPECT_TRUE((test<double, double>(GetParam(), 1357, 2)));
+    EXPECT_TRUE((test<double, double>(GetParam(), 1357, 1)));
+    EXPECT_TRUE((test_dot<double, double>(GetParam(), 1357, 2, -3)));
+}
+TEST_P(HostScalarTests, ComplexSinglePrecision) {
+    EXPECT_TRUE((test<std::complex<float>, float>(GetParam(), 1357, 2)));
+    EXPECT_TRUE((test<std::complex<float>, float>(GetParam(), 1357, 1)));
+}
+TEST_P(HostScalarTests, ComplexDoublePrecision) {
+    EXPECT_TRUE((test<std::complex<double>, double>(GetParam(), 1357, 2)));
+    EXPECT_TRUE((test<std::complex<double>, double>(GetParam(), 1357, 1)));
+}
+
+INSTANTIATE_TEST_SUITE_P(HostScalarTestSuite, HostScalarTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
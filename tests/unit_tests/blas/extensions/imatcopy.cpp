@@ -0,0 +1,152 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+template <typename fp>
+bool test(const device& dev, onemkl::transpose trans, int m, int n, int lda, int ldb, fp alpha) {
+    // imatcopy is only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data. AB holds the m x n A with leading dimension lda on input
+    //  and op(A) with leading dimension ldb on output.
+    const int rows_b = (trans == onemkl::transpose::nontrans) ? m : n;
+    const int cols_b = (trans == onemkl::transpose::nontrans) ? n : m;
+    vector<fp, allocator_helper<fp, 64>> AB, B_ref;
+    rand_vector(AB, std::max(lda * n, ldb * cols_b), 1);
+    B_ref.resize(ldb * cols_b);
+
+    // Call Reference OMATCOPY from a copy of the input.
+    const int m_ref = m, n_ref = n;
+    const int lda_ref = lda, ldb_ref = ldb;
+
+    using fp_ref = typename ref_type_info<fp>::type;
+
+    ::omatcopy(convert_to_cblas_trans(trans), &m_ref, &n_ref, (fp_ref*)&alpha, (fp_ref*)AB.data(),
+               &lda_ref, (fp_ref*)B_ref.data(), &ldb_ref);
+
+    // Call DPC++ IMATCOPY.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during IMATCOPY:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> AB_buffer(AB.data(), range<1>(AB.size()));
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::imatcopy(main_queue, trans, m, n, alpha, AB_buffer, lda, ldb);
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::imatcopy,
+                    (main_queue, trans, m, n, alpha, AB_buffer, lda, ldb));
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during IMATCOPY:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    auto AB_accessor = AB_buffer.template get_access<access::mode::read>();
+    bool good        = check_equal_matrix(AB_accessor, B_ref, rows_b, cols_b, ldb, 1, std::cout);
+
+    return good;
+}
+
+class ImatcopyTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(ImatcopyTests, RealSinglePrecision) {
+    float alpha(2.0f);
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::transpose::nontrans, 73, 27, 73, 73, alpha));
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::transpose::nontrans, 73, 27, 101, 103, alpha));
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::transpose::trans, 73, 27, 73, 27, alpha));
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::transpose::conjtrans, 73, 27, 101, 103, alpha));
+}
+TEST_P(ImatcopyTests, RealDoublePrecision) {
+    double alpha(2.0);
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::transpose::nontrans, 73, 27, 73, 73, alpha));
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::transpose::nontrans, 73, 27, 101, 103, alpha));
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::transpose::trans, 73, 27, 73, 27, alpha));
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::transpose::conjtrans, 73, 27, 101, 103, alpha));
+}
+TEST_P(ImatcopyTests, ComplexSinglePrecision) {
+    std::complex<float> alpha(2.0, -0.5);
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::transpose::nontrans, 73, 27, 73, 73,
+                                          alpha));
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::transpose::nontrans, 73, 27, 101, 103,
+                                          alpha));
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::transpose::trans, 73, 27, 73, 27,
+                                          alpha));
+    EXPECT_TRUE(test<std::complex<float>>(GetParam(), onemkl::transpose::conjtrans, 73, 27, 101,
+                                          103, alpha));
+}
+TEST_P(ImatcopyTests, ComplexDoublePrecision) {
+    std::complex<double> alpha(2.0, -0.5);
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::transpose::nontrans, 73, 27, 73, 73,
+                                           alpha));
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::transpose::nontrans, 73, 27, 101,
+                                           103, alpha));
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::transpose::trans, 73, 27, 73, 27,
+                                           alpha));
+    EXPECT_TRUE(test<std::complex<double>>(GetParam(), onemkl::transpose::conjtrans, 73, 27, 101,
+                                           103, alpha));
+}
+
+INSTANTIATE_TEST_SUITE_P(ImatcopyTestSuite, ImatcopyTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,226 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// Element i of a vector in BLAS order.
+template <typename vec>
+typename vec::value_type& element(vec& v, int N, int inc, int i) {
+    return v[(inc > 0) ? i * inc : (N - 1 - i) * -inc];
+}
+
+// Optimizer-like step y := a * x + b * y + c * z, r := y^T w evaluated through
+// a linear_combination, and y := y + a * x + b * z + c * w + a * v, which takes
+// two passes.
+template <typename fp>
+bool test(const device& dev, int N, int incx, int incy, int incz, int incw, fp a, fp b, fp c) {
+    // The fused level-1 routines are only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data.
+    vector<fp, allocator_helper<fp, 64>> x, y, z, w, v, y_ref;
+    fp result = fp(-1), result_ref = fp(0);
+
+    rand_vector(x, N, incx);
+    rand_vector(y, N, incy);
+    rand_vector(z, N, incz);
+    rand_vector(w, N, incw);
+    rand_vector(v, N, 1);
+    y_ref = y;
+
+    // Compute the references.
+    for (int i = 0; i < N; i++) {
+        fp& yi = element(y_ref, N, incy, i);
+        yi     = a * element(x, N, incx, i) + b * yi + c * element(z, N, incz, i);
+        result_ref += yi * element(w, N, incw, i);
+    }
+    for (int i = 0; i < N; i++) {
+        element(y_ref, N, incy, i) += a * element(x, N, incx, i) + b * element(z, N, incz, i) +
+                                      c * element(w, N, incw, i) + a * v[i];
+    }
+
+    // Call DPC++ ASSIGN_DOT and ASSIGN.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during ASSIGN:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> x_buffer(x.data(), range<1>(x.size()));
+    buffer<fp, 1> y_buffer(y.data(), range<1>(y.size()));
+    buffer<fp, 1> z_buffer(z.data(), range<1>(z.size()));
+    buffer<fp, 1> w_buffer(w.data(), range<1>(w.size()));
+    buffer<fp, 1> v_buffer(v.data(), range<1>(v.size()));
+    buffer<fp, 1> result_buffer(&result, range<1>(1));
+
+    auto xs = onemkl::blas::strided(x_buffer, incx);
+    auto ys = onemkl::blas::strided(y_buffer, incy);
+    auto zs = onemkl::blas::strided(z_buffer, incz);
+    auto ws = onemkl::blas::strided(w_buffer, incw);
+    auto vs = onemkl::blas::strided(v_buffer);
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::assign_dot(main_queue, N, ys, a * xs + b * ys + c * zs, ws, result_buffer);
+        onemkl::blas::assign(main_queue, N, ys, fp(1) * ys + a * xs + b * zs + c * ws + a * vs);
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::assign_dot,
+                    (main_queue, N, ys, a * xs + b * ys + c * zs, ws, result_buffer));
+        TEST_RUN_CT(main_queue, onemkl::blas::assign,
+                    (main_queue, N, ys, fp(1) * ys + a * xs + b * zs + c * ws + a * vs));
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during ASSIGN:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good;
+    {
+        auto y_accessor      = y_buffer.template get_access<access::mode::read>();
+        bool good_y          = check_equal_vector(y_accessor, y_ref, N, incy, 10, std::cout);
+        auto result_accessor = result_buffer.template get_access<access::mode::read>();
+        bool good_result     = check_equal(result_accessor[0], result_ref, N, std::cout);
+
+        good = good_y && good_result;
+    }
+
+    return good;
+}
+
+// y := a * x + b * y read backwards, a term on the buffer of y with another
+// increment, which is evaluated through a temporary vector.
+template <typename fp>
+bool test_overlap(const device& dev, int N, int incy, fp a, fp b) {
+    // The fused level-1 routines are only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data.
+    vector<fp, allocator_helper<fp, 64>> x, y, y_ref;
+    rand_vector(x, N, 1);
+    rand_vector(y, N, incy);
+    y_ref = y;
+
+    // Compute the reference.
+    for (int i = 0; i < N; i++)
+        element(y_ref, N, incy, i) = a * x[i] + b * element(y, N, -incy, i);
+
+    // Call DPC++ ASSIGN.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during ASSIGN:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> x_buffer(x.data(), range<1>(x.size()));
+    buffer<fp, 1> y_buffer(y.data(), range<1>(y.size()));
+
+    auto xs      = onemkl::blas::strided(x_buffer);
+    auto ys      = onemkl::blas::strided(y_buffer, incy);
+    auto ys_back = onemkl::blas::strided(y_buffer, -incy);
+
+    try {
+#ifdef CALL_RT_API
+        onemkl::blas::assign(main_queue, N, ys, a * xs + b * ys_back);
+#else
+        TEST_RUN_CT(main_queue, onemkl::blas::assign, (main_queue, N, ys, a * xs + b * ys_back));
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during ASSIGN:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    auto y_accessor = y_buffer.template get_access<access::mode::read>();
+    bool good       = check_equal_vector(y_accessor, y_ref, N, incy, 10, std::cout);
+
+    return good;
+}
+
+class Level1ExpressionTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(Level1ExpressionTests, RealSinglePrecision) {
+    EXPECT_TRUE(test<float>(GetParam(), 1357, 1, 1, 1, 1, 2.0f, 0.5f, -3.0f));
+    EXPECT_TRUE(test<float>(GetParam(), 1357, 2, -3, 1, -2, 2.0f, 0.0f, -3.0f));
+    EXPECT_TRUE(test<float>(GetParam(), 1 << 20, 1, 1, 1, 1, 1.5f, 0.5f, 0.0f));
+    EXPECT_TRUE(test_overlap<float>(GetParam(), 1357, 2, 2.0f, -3.0f));
+}
+TEST_P(Level1ExpressionTests, RealDoublePrecision) {
+    EXPECT_TRUE(test<double>(GetParam(), 1357, 1, 1, 1, 1, 2.0, 0.5, -3.0));
+    EXPECT_TRUE(test<double>(GetParam(), 1357, 2, -3, 1, -2, 2.0, 0.0, -3.0));
+    EXPECT_TRUE(test<double>(GetParam(), 1 << 20, 1, 1, 1, 1, 1.5, 0.5, 0.0));
+    EXPECT_TRUE(test_overlap<double>(GetParam(), 1357, 2, 2.0, -3.0));
+}
+
+INSTANTIATE_TEST_SUITE_P(Level1ExpressionTestSuite, Level1ExpressionTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
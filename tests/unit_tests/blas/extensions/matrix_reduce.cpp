@@ -0,0 +1,221 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// Host reference for the reduction op of each row (rows set) or column of
+// op(A), m x n, accumulated in double.
+template <typename fp>
+void reference_reduce(onemkl::reduction op, bool rows, onemkl::transpose trans, int m, int n,
+                      const fp* A, int lda, fp* y, int incy) {
+    const int len   = rows ? m : n;
+    const int other = rows ? n : m;
+    for (int i = 0; i < len; i++) {
+        double r = 0.0;
+        for (int k = 0; k < other; k++) {
+            const int row  = rows ? i : k;
+            const int col  = rows ? k : i;
+            const double v = (trans == onemkl::transpose::nontrans) ? A[row + col * lda]
+                                                                    : A[col + row * lda];
+            if (op == onemkl::reduction::sum)
+                r += v;
+            else if (op == onemkl::reduction::asum)
+                r += std::abs(v);
+            else if (op == onemkl::reduction::amax)
+                r = std::max(r, std::abs(v));
+            else
+                r += v * v;
+        }
+        if (op == onemkl::reduction::nrm2)
+            r = std::sqrt(r);
+        y[(incy > 0) ? i * incy : (len - 1 - i) * (-incy)] = fp(r);
+    }
+}
+
+// Host reference for the matrix norms of op(A), m x n.
+template <typename fp>
+fp reference_lange(onemkl::norm_type norm, onemkl::transpose trans, int m, int n, const fp* A,
+                   int lda) {
+    vector<fp> partial(std::max(m, n));
+    switch (norm) {
+        case onemkl::norm_type::max:
+            reference_reduce(onemkl::reduction::amax, false, trans, m, n, A, lda, partial.data(),
+                             1);
+            return *std::max_element(partial.begin(), partial.begin() + n);
+        case onemkl::norm_type::one:
+            reference_reduce(onemkl::reduction::asum, false, trans, m, n, A, lda, partial.data(),
+                             1);
+            return *std::max_element(partial.begin(), partial.begin() + n);
+        case onemkl::norm_type::inf:
+            reference_reduce(onemkl::reduction::asum, true, trans, m, n, A, lda, partial.data(),
+                             1);
+            return *std::max_element(partial.begin(), partial.begin() + m);
+        default: {
+            double ssq = 0.0;
+            for (int j = 0; j < n; j++)
+                for (int i = 0; i < m; i++) {
+                    const double v = (trans == onemkl::transpose::nontrans) ? A[i + j * lda]
+                                                                            : A[j + i * lda];
+                    ssq += v * v;
+                }
+            return fp(std::sqrt(ssq));
+        }
+    }
+}
+
+// Every reduction of the rows and of the columns of op(A), m x n, through
+// reduce_rows and reduce_columns, and every norm of op(A) through lange.
+template <typename fp>
+bool test(const device& dev, onemkl::transpose trans, int m, int n, int lda, int incy) {
+    // Matrix reductions are only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data.
+    vector<fp, allocator_helper<fp, 64>> A, y, y_ref;
+    rand_matrix(A, trans, m, n, lda);
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during MATRIX_REDUCE:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> A_buffer(A.data(), range<1>(A.size()));
+
+    bool good = true;
+    for (bool rows : { true, false }) {
+        for (onemkl::reduction op : { onemkl::reduction::sum, onemkl::reduction::asum,
+                                      onemkl::reduction::amax, onemkl::reduction::nrm2 }) {
+            const int len = rows ? m : n;
+            rand_vector(y, len, incy);
+            y_ref = y;
+            reference_reduce(op, rows, trans, m, n, A.data(), lda, y_ref.data(), incy);
+
+            // Call DPC++ REDUCE_ROWS or REDUCE_COLUMNS.
+            buffer<fp, 1> y_buffer(y.data(), range<1>(y.size()));
+            try {
+#ifdef CALL_RT_API
+                if (rows)
+                    onemkl::blas::reduce_rows(main_queue, op, trans, m, n, A_buffer, lda, y_buffer,
+                                              incy);
+                else
+                    onemkl::blas::reduce_columns(main_queue, op, trans, m, n, A_buffer, lda,
+                                                 y_buffer, incy);
+#else
+                if (rows) {
+                    TEST_RUN_CT(main_queue, onemkl::blas::reduce_rows,
+                                (main_queue, op, trans, m, n, A_buffer, lda, y_buffer, incy));
+                }
+                else {
+                    TEST_RUN_CT(main_queue, onemkl::blas::reduce_columns,
+                                (main_queue, op, trans, m, n, A_buffer, lda, y_buffer, incy));
+                }
+#endif
+            }
+            catch (exception const& e) {
+                std::cout << "Caught synchronous SYCL exception during MATRIX_REDUCE:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+
+            // Compare the results of reference implementation and DPC++ implementation.
+            auto y_accessor = y_buffer.template get_access<access::mode::read>();
+            bool good_y     = check_equal_vector(y_accessor, y_ref, len, incy, 10, std::cout);
+            good            = good && good_y;
+        }
+    }
+
+    for (onemkl::norm_type norm : { onemkl::norm_type::max, onemkl::norm_type::one,
+                                    onemkl::norm_type::inf, onemkl::norm_type::frobenius }) {
+        fp result     = fp(-1.0);
+        fp result_ref = reference_lange(norm, trans, m, n, A.data(), lda);
+
+        // Call DPC++ LANGE.
+        buffer<fp, 1> result_buffer(&result, range<1>(1));
+        try {
+#ifdef CALL_RT_API
+            onemkl::blas::lange(main_queue, norm, trans, m, n, A_buffer, lda, result_buffer);
+#else
+            TEST_RUN_CT(main_queue, onemkl::blas::lange,
+                        (main_queue, norm, trans, m, n, A_buffer, lda, result_buffer));
+#endif
+        }
+        catch (exception const& e) {
+            std::cout << "Caught synchronous SYCL exception during LANGE:\n"
+                      << e.what() << std::endl
+                      << "OpenCL status: " << e.get_cl_code() << std::endl;
+        }
+
+        // Compare the results of reference implementation and DPC++ implementation.
+        auto result_accessor = result_buffer.template get_access<access::mode::read>();
+        bool good_result     = check_equal(result_accessor[0], result_ref, 10, std::cout);
+        good                 = good && good_result;
+    }
+
+    return good;
+}
+
+class MatrixReduceTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(MatrixReduceTests, RealSinglePrecision) {
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::transpose::nontrans, 300, 257, 301, 1));
+    EXPECT_TRUE(test<float>(GetParam(), onemkl::transpose::trans, 300, 257, 260, -2));
+}
+TEST_P(MatrixReduceTests, RealDoublePrecision) {
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::transpose::nontrans, 300, 257, 301, -2));
+    EXPECT_TRUE(test<double>(GetParam(), onemkl::transpose::trans, 300, 257, 260, 1));
+}
+
+INSTANTIATE_TEST_SUITE_P(MatrixReduceTestSuite, MatrixReduceTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,224 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "config.hpp"
+#include "onemkl/onemkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// Catch asynchronous exceptions.
+auto exception_handler = [](exception_list exceptions) {
+    for (std::exception_ptr const& e : exceptions) {
+        try {
+            std::rethrow_exception(e);
+        }
+        catch (exception const& e) {
+            std::cout << "Caught asynchronous SYCL exception during STORAGE_CONVERSION:\n"
+                      << e.what() << std::endl
+                      << "OpenCL status: " << e.get_cl_code() << std::endl;
+        }
+    }
+};
+
+// Round trip of the upper_lower triangle of A through packed storage with
+// trttp and tpttr. The packed matrix is checked by comparing reference TPMV
+// on it with reference TRMV on A.
+template <typename fp>
+bool test_packed(const device& dev, onemkl::uplo upper_lower, int n, int lda) {
+    // Storage conversions are only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data.
+    vector<fp> A, AP, A_tr, A_tr_ref, x;
+    rand_matrix(A, onemkl::transpose::nontrans, n, n, lda);
+    rand_vector(AP, n * (n + 1) / 2, 1);
+    rand_matrix(A_tr, onemkl::transpose::nontrans, n, n, lda);
+    rand_vector(x, n, 1);
+
+    // Only the upper_lower triangle is copied back.
+    A_tr_ref = A_tr;
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < n; i++)
+            if ((upper_lower == onemkl::uplo::upper) ? (i <= j) : (i >= j))
+                A_tr_ref[i + j * lda] = A[i + j * lda];
+
+    // Call DPC++ TRTTP and TPTTR.
+    queue main_queue(dev, exception_handler);
+
+    {
+        buffer<fp, 1> A_buffer(A.data(), range<1>(A.size()));
+        buffer<fp, 1> AP_buffer(AP.data(), range<1>(AP.size()));
+        buffer<fp, 1> A_tr_buffer(A_tr.data(), range<1>(A_tr.size()));
+
+        try {
+#ifdef CALL_RT_API
+            onemkl::blas::trttp(main_queue, upper_lower, n, A_buffer, lda, AP_buffer);
+            onemkl::blas::tpttr(main_queue, upper_lower, n, AP_buffer, A_tr_buffer, lda);
+#else
+            TEST_RUN_CT(main_queue, onemkl::blas::trttp,
+                        (main_queue, upper_lower, n, A_buffer, lda, AP_buffer));
+            TEST_RUN_CT(main_queue, onemkl::blas::tpttr,
+                        (main_queue, upper_lower, n, AP_buffer, A_tr_buffer, lda));
+#endif
+        }
+        catch (exception const& e) {
+            std::cout << "Caught synchronous SYCL exception during STORAGE_CONVERSION:\n"
+                      << e.what() << std::endl
+                      << "OpenCL status: " << e.get_cl_code() << std::endl;
+        }
+    }
+
+    // Call Reference TPMV on the packed matrix and TRMV on A.
+    const int n_ref = n, lda_ref = lda, incx_ref = 1;
+    using fp_ref = typename ref_type_info<fp>::type;
+
+    vector<fp> x_tp = x, x_tr = x;
+    ::tpmv(convert_to_cblas_uplo(upper_lower), CblasNoTrans, CblasNonUnit, &n_ref,
+           (fp_ref*)AP.data(), (fp_ref*)x_tp.data(), &incx_ref);
+    ::trmv(convert_to_cblas_uplo(upper_lower), CblasNoTrans, CblasNonUnit, &n_ref,
+           (fp_ref*)A.data(), &lda_ref, (fp_ref*)x_tr.data(), &incx_ref);
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good_packed = check_equal_vector(x_tp, x_tr, n, 1, n, std::cout);
+    bool good_full   = check_equal_matrix(A_tr, A_tr_ref, n, n, lda, 1, std::cout);
+
+    return good_packed && good_full;
+}
+
+// Round trip of A through band storage with gettgb and gbtge. The band matrix
+// is checked by comparing reference GBMV on it with reference GEMV on the band
+// part of A.
+template <typename fp>
+bool test_band(const device& dev, int m, int n, int kl, int ku, int lda, int ldab) {
+    // Storage conversions are only implemented by the mklcpu backend.
+    if (dev.is_gpu())
+        return true;
+
+    // Prepare data.
+    vector<fp> A, AB, A_ge, A_band, x, y_gb, y_ge;
+    rand_matrix(A, onemkl::transpose::nontrans, m, n, lda);
+    rand_matrix(AB, onemkl::transpose::nontrans, ldab, n, ldab);
+    rand_matrix(A_ge, onemkl::transpose::nontrans, m, n, lda);
+    rand_vector(x, n, 1);
+
+    // Entries outside of the band are zeroed by gbtge.
+    A_band = A;
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < m; i++)
+            if (i < j - ku || i > j + kl)
+                A_band[i + j * lda] = fp(0);
+
+    // Call DPC++ GETTGB and GBTGE.
+    queue main_queue(dev, exception_handler);
+
+    {
+        buffer<fp, 1> A_buffer(A.data(), range<1>(A.size()));
+        buffer<fp, 1> AB_buffer(AB.data(), range<1>(AB.size()));
+        buffer<fp, 1> A_ge_buffer(A_ge.data(), range<1>(A_ge.size()));
+
+        try {
+#ifdef CALL_RT_API
+            onemkl::blas::gettgb(main_queue, m, n, kl, ku, A_buffer, lda, AB_buffer, ldab);
+            onemkl::blas::gbtge(main_queue, m, n, kl, ku, AB_buffer, ldab, A_ge_buffer, lda);
+#else
+            TEST_RUN_CT(main_queue, onemkl::blas::gettgb,
+                        (main_queue, m, n, kl, ku, A_buffer, lda, AB_buffer, ldab));
+            TEST_RUN_CT(main_queue, onemkl::blas::gbtge,
+                        (main_queue, m, n, kl, ku, AB_buffer, ldab, A_ge_buffer, lda));
+#endif
+        }
+        catch (exception const& e) {
+            std::cout << "Caught synchronous SYCL exception during STORAGE_CONVERSION:\n"
+                      << e.what() << std::endl
+                      << "OpenCL status: " << e.get_cl_code() << std::endl;
+        }
+    }
+
+    // Call Reference GBMV on the band matrix and GEMV on the band part of A.
+    int m_ref = m, n_ref = n, kl_ref = kl, ku_ref = ku;
+    const int lda_ref = lda, ldab_ref = ldab, inc_ref = 1;
+    const fp alpha(1.0), beta(0.0);
+    using fp_ref = typename ref_type_info<fp>::type;
+
+    y_gb.resize(m);
+    y_ge.resize(m);
+    ::gbmv(CblasNoTrans, &m_ref, &n_ref, &kl_ref, &ku_ref, (fp_ref*)&alpha, (fp_ref*)AB.data(),
+           &ldab_ref, (fp_ref*)x.data(), &inc_ref, (fp_ref*)&beta, (fp_ref*)y_gb.data(),
+           &inc_ref);
+    ::gemv(CblasNoTrans, &m_ref, &n_ref, (fp_ref*)&alpha, (fp_ref*)A_band.data(), &lda_ref,
+           (fp_ref*)x.data(), &inc_ref, (fp_ref*)&beta, (fp_ref*)y_ge.data(), &inc_ref);
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good_band = check_equal_vector(y_gb, y_ge, m, 1, kl + ku + 1, std::cout);
+    bool good_full = check_equal_matrix(A_ge, A_band, m, n, lda, 1, std::cout);
+
+    return good_band && good_full;
+}
+
+template <typename fp>
+bool test(const device& dev) {
+    bool good = true;
+    good      = test_packed<fp>(dev, onemkl::uplo::upper, 83, 101) && good;
+    good      = test_packed<fp>(dev, onemkl::uplo::lower, 83, 101) && good;
+    good      = test_band<fp>(dev, 83, 67, 3, 5, 101, 10) && good;
+    good      = test_band<fp>(dev, 47, 93, 0, 7, 50, 8) && good;
+    return good;
+}
+
+class StorageConversionTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(StorageConversionTests, RealSinglePrecision) {
+    EXPECT_TRUE(test<float>(GetParam()));
+}
+TEST_P(StorageConversionTests, RealDoublePrecision) {
+    EXPECT_TRUE(test<double>(GetParam()));
+}
+TEST_P(StorageConversionTests, ComplexSinglePrecision) {
+    EXPECT_TRUE(test<std::complex<float>>(GetParam()));
+}
+TEST_P(StorageConversionTests, ComplexDoublePrecision) {
+    EXPECT_TRUE(test<std::complex<double>>(GetParam()));
+}
+
+INSTANTIATE_TEST_SUITE_P(StorageConversionTestSuite, StorageConversionTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
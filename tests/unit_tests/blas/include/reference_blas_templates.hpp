@@ -1249,4 +1249,60 @@ int iamin(const int *n, const std::complex<double> *x, const int *incx) {
     return min_idx;
 }
 
+inline float conj_val(float val) {
+    return val;
+}
+
+inline double conj_val(double val) {
+    return val;
+}
+
+inline std::complex<float> conj_val(std::complex<float> val) {
+    return std::conj(val);
+}
+
+inline std::complex<double> conj_val(std::complex<double> val) {
+    return std::conj(val);
+}
+
+// Entry (i, j) of op(A).
+template <typename fp>
+static fp op_val(CBLAS_TRANSPOSE trans, const fp *a, int lda, int i, int j) {
+    if (trans == CblasNoTrans)
+        return a[i + j * lda];
+    return (trans == CblasConjTrans) ? conj_val(a[j + i * lda]) : a[j + i * lda];
+}
+
+template <typename fp>
+static void axpby(const int *n, const fp *alpha, const fp *x, const int *incx, const fp *beta,
+                  fp *y, const int *incy) {
+    for (int i = 0; i < *n; i++) {
+        const int ix = (*incx > 0) ? i * *incx : (*n - 1 - i) * -*incx;
+        const int iy = (*incy > 0) ? i * *incy : (*n - 1 - i) * -*incy;
+        y[iy]        = *alpha * x[ix] + *beta * y[iy];
+    }
+}
+
+// B = alpha * op(A), A being m x n.
+template <typename fp>
+static void omatcopy(CBLAS_TRANSPOSE trans, const int *m, const int *n, const fp *alpha,
+                     const fp *a, const int *lda, fp *b, const int *ldb) {
+    const int rows = (trans == CblasNoTrans) ? *m : *n;
+    const int cols = (trans == CblasNoTrans) ? *n : *m;
+    for (int j = 0; j < cols; j++)
+        for (int i = 0; i < rows; i++)
+            b[i + j * *ldb] = *alpha * op_val(trans, a, *lda, i, j);
+}
+
+// C = alpha * op(A) + beta * op(B), C being m x n.
+template <typename fp>
+static void omatadd(CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, const int *m, const int *n,
+                    const fp *alpha, const fp *a, const int *lda, const fp *beta, const fp *b,
+                    const int *ldb, fp *c, const int *ldc) {
+    for (int j = 0; j < *n; j++)
+        for (int i = 0; i < *m; i++)
+            c[i + j * *ldc] =
+                *alpha * op_val(transa, a, *lda, i, j) + *beta * op_val(transb, b, *ldb, i, j);
+}
+
 #endif /* header guard */
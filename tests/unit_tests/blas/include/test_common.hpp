@@ -91,6 +91,10 @@ struct ref_type_info<uint8_t> {
     using type = uint8_t;
 };
 template <>
+struct ref_type_info<int16_t> {
+    using type = int16_t;
+};
+template <>
 struct ref_type_info<int32_t> {
     using type = int32_t;
 };
@@ -117,6 +121,10 @@ int8_t rand_scalar() {
     return std::rand() % 254 - 127;
 }
 template <>
+int16_t rand_scalar() {
+    return std::rand() % 512 - 256;
+}
+template <>
 int32_t rand_scalar() {
     return std::rand() % 256 - 128;
 }